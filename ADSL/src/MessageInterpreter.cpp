@@ -15,9 +15,8 @@
 
 #include "ADSL/MessageInterpreter.h"
 
-#include <AVSCommon/Utils/Metrics/DataPointCounterBuilder.h>
-#include <AVSCommon/Utils/Metrics/DataPointStringBuilder.h>
-#include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
+#include <AVSCommon/Utils/Metrics/MetricNameRegistry.h>
+#include <AVSCommon/Utils/Metrics/MetricRecord.h>
 #include <AVSCommon/Utils/Metrics.h>
 
 #include <AVSCommon/Utils/Logger/Logger.h>
@@ -38,6 +37,21 @@ static const std::string PARSE_COMPLETE("PARSE_COMPLETE");
 /// The metric activity name for parsing completed.
 static const std::string PARSE_COMPLETE_ACTIVITY_NAME("MESSAGE_INTERPRETER-" + PARSE_COMPLETE);
 
+/// Interned name of @c PARSE_COMPLETE_ACTIVITY_NAME.
+static const MetricNameId PARSE_COMPLETE_ACTIVITY_ID = MetricNameRegistry::intern(PARSE_COMPLETE_ACTIVITY_NAME);
+
+/// Interned name of the parse completed counter.
+static const MetricNameId PARSE_COMPLETE_ID = MetricNameRegistry::intern(PARSE_COMPLETE);
+
+/// Interned name of the data point with the HTTP/2 stream the directive was received on.
+static const MetricNameId HTTP2_STREAM_ID = MetricNameRegistry::intern("HTTP2_STREAM");
+
+/// Interned name of the data point with the message id of the directive.
+static const MetricNameId DIRECTIVE_MESSAGE_ID_ID = MetricNameRegistry::intern("DIRECTIVE_MESSAGE_ID");
+
+/// Interned name of the data point with the dialog request id of the directive.
+static const MetricNameId DIALOG_REQUEST_ID_ID = MetricNameRegistry::intern("DIALOG_REQUEST_ID");
+
 /// String to identify log entries originating from this file.
 #define TAG "MessageInterpreter"
 
@@ -76,23 +90,14 @@ void MessageInterpreter::receive(const std::string& contextId, const std::string
         return;
     }
 
-    auto metricEvent =
-        MetricEventBuilder{}
-            .setActivityName(PARSE_COMPLETE_ACTIVITY_NAME)
-            .addDataPoint(DataPointCounterBuilder{}.setName(PARSE_COMPLETE).increment(1).build())
-            .addDataPoint(DataPointStringBuilder{}
-                              .setName("HTTP2_STREAM")
-                              .setValue(avsDirective->getAttachmentContextId())
-                              .build())
-            .addDataPoint(
-                DataPointStringBuilder{}.setName("DIRECTIVE_MESSAGE_ID").setValue(avsDirective->getMessageId()).build())
-            .build();
-
-    if (metricEvent == nullptr) {
-        ACSDK_ERROR(LX("Error creating metric."));
-        return;
+    MetricRecord parseComplete(PARSE_COMPLETE_ACTIVITY_ID);
+    parseComplete.addCounter(PARSE_COMPLETE_ID, 1)
+        .addString(HTTP2_STREAM_ID, avsDirective->getAttachmentContextId())
+        .addString(DIRECTIVE_MESSAGE_ID_ID, avsDirective->getMessageId());
+    if (!avsDirective->getDialogRequestId().empty()) {
+        parseComplete.addString(DIALOG_REQUEST_ID_ID, avsDirective->getDialogRequestId());
     }
-    recordMetric(m_metricRecorder, metricEvent);
+    recordMetric(m_metricRecorder, parseComplete);
 
     if (avsDirective->getName() == "StopCapture" || avsDirective->getName() == "Speak") {
         ACSDK_METRIC_MSG(TAG, avsDirective, Metrics::Location::ADSL_ENQUEUE);
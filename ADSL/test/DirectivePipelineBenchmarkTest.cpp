@@ -0,0 +1,517 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+// @file DirectivePipelineBenchmarkTest.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <ACL/Transport/MessageConsumerInterface.h>
+#include <ACL/Transport/MimeResponseSink.h>
+#include <ACL/Transport/MimeResponseStatusHandlerInterface.h>
+#include <acsdkShutdownManagerInterfaces/MockShutdownNotifier.h>
+#include <AVSCommon/AVS/Attachment/AttachmentManager.h>
+#include <AVSCommon/AVS/NamespaceAndName.h>
+#include <AVSCommon/SDKInterfaces/DirectiveHandlerInterface.h>
+#include <AVSCommon/SDKInterfaces/MockExceptionEncounteredSender.h>
+#include <AVSCommon/Utils/HTTP2/HTTP2MimeResponseDecoder.h>
+#include <AVSCommon/Utils/Logger/ConsoleLogger.h>
+#include <AVSCommon/Utils/Memory/AllocationCounter.h>
+
+#include "ADSL/DirectiveSequencer.h"
+#include "ADSL/MessageInterpreter.h"
+
+namespace alexaClientSDK {
+namespace adsl {
+namespace test {
+
+using namespace ::testing;
+using namespace acl;
+using namespace acsdkShutdownManagerInterfaces::test;
+using namespace avsCommon::avs;
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::sdkInterfaces::test;
+using namespace avsCommon::utils::http2;
+using namespace avsCommon::utils::logger;
+using namespace avsCommon::utils::memory::test;
+
+/// Clock used to timestamp directives.
+using Clock = std::chrono::steady_clock;
+
+/// The number of directives replayed by the benchmark.
+static const size_t DIRECTIVE_COUNT = 20000;
+
+/// The number of directives replayed one at a time to measure the latency of an idle pipeline.
+static const size_t PACED_DIRECTIVE_COUNT = 2000;
+
+/// The number of directives replayed before measuring, to warm up caches and thread pools.
+static const size_t WARMUP_DIRECTIVE_COUNT = 1000;
+
+/// The size of the pieces the stream is fed to the decoder in, matching the size of a typical curl receive buffer.
+static const size_t RECEIVE_BUFFER_SIZE = 16 * 1024;
+
+/// How long to wait for all directives to be handled.
+static const std::chrono::seconds HANDLING_TIMEOUT(60);
+
+/// Boundary of the multipart stream, in the format used by AVS.
+static const std::string BOUNDARY = "84109348-943b-4446-85e6-e73eda9fac43";
+
+/// CRLF sequence separating MIME lines.
+static const std::string CRLF = "\r\n";
+
+/// The context id attachments are created under.
+static const std::string ATTACHMENT_CONTEXT_ID = "benchmarkContextId";
+
+/// Prefix of the message ids of the replayed directives, which are followed by the directive's index.
+static const std::string MESSAGE_ID_PREFIX = "benchmark-";
+
+/// Namespace of the replayed directives.
+static const std::string NAMESPACE_BENCHMARK = "Benchmark";
+
+/**
+ * Payloads of the replayed directives, modeled on the sizes of the directives seen on a downchannel: a small
+ * volume-style directive, a mid-sized Speak-style directive and a large rendering directive.
+ */
+static const std::vector<std::pair<std::string, std::string>> DIRECTIVE_TEMPLATES = {
+    {"SetVolume", "{\"volume\":50}"},
+    {"Speak",
+     "{\"url\":\"cid:ValidDirectiveId_1234567890\",\"format\":\"AUDIO_MPEG\",\"token\":"
+     "\"amzn1.as-ct.v1.Domain:Application:Notifications#ACRI#ValidDirectiveId_1234567890\","
+     "\"caption\":{\"content\":\"WEBVTT\\n\\n1\\n00:00.000 --> 00:01.260\\nThe time is 2:17 PM.\","
+     "\"type\":\"WEBVTT\"}}"},
+    {"RenderTemplate", "{\"type\":\"BodyTemplate2\",\"token\":\"token\",\"title\":{\"mainTitle\":\"Title\"},"
+                       "\"textField\":\"" + std::string(2048, 'x') + "\"}"}};
+
+/**
+ * Get the index of a replayed directive from its message id.
+ *
+ * @param messageId The message id of the directive.
+ * @return The index of the directive.
+ */
+static size_t directiveIndex(const std::string& messageId) {
+    return std::strtoul(messageId.c_str() + MESSAGE_ID_PREFIX.size(), nullptr, 10);
+}
+
+/**
+ * Create a downchannel multipart stream carrying @c count directives.
+ *
+ * @param firstIndex The index of the first directive.
+ * @param count The number of directives.
+ * @param[out] partEnds If not @c nullptr, receives the offset just past each directive's part in the stream.
+ * @return The stream.
+ */
+static std::string createStream(size_t firstIndex, size_t count, std::vector<size_t>* partEnds = nullptr) {
+    std::string stream = "--" + BOUNDARY + CRLF;
+    for (size_t index = firstIndex; index < firstIndex + count; ++index) {
+        auto& directive = DIRECTIVE_TEMPLATES[index % DIRECTIVE_TEMPLATES.size()];
+        stream += "Content-Type: application/json; charset=UTF-8" + CRLF + CRLF;
+        stream += "{\"directive\":{\"header\":{\"namespace\":\"" + NAMESPACE_BENCHMARK + "\",\"name\":\"" +
+                  directive.first + "\",\"messageId\":\"" + MESSAGE_ID_PREFIX + std::to_string(index) +
+                  "\"},\"payload\":" + directive.second + "}}";
+        stream += CRLF + "--" + BOUNDARY;
+        stream += (index + 1 < firstIndex + count) ? CRLF : "--" + CRLF;
+        if (partEnds) {
+            partEnds->push_back(stream.size());
+        }
+    }
+    return stream;
+}
+
+/**
+ * A @c DirectiveSequencerInterface which records when each directive is enqueued and forwards it to the real
+ * @c DirectiveSequencer.
+ */
+class TimestampingDirectiveSequencer : public DirectiveSequencerInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param sequencer The sequencer to forward to.
+     * @param enqueueTimes Where to record the time each directive is enqueued, indexed by directive.
+     */
+    TimestampingDirectiveSequencer(
+        std::shared_ptr<DirectiveSequencerInterface> sequencer,
+        std::vector<Clock::time_point>* enqueueTimes) :
+            DirectiveSequencerInterface{"TimestampingDirectiveSequencer"},
+            m_sequencer{sequencer},
+            m_enqueueTimes{enqueueTimes} {
+    }
+
+    bool addDirectiveHandler(std::shared_ptr<DirectiveHandlerInterface> handler) override {
+        return m_sequencer->addDirectiveHandler(handler);
+    }
+
+    bool removeDirectiveHandler(std::shared_ptr<DirectiveHandlerInterface> handler) override {
+        return m_sequencer->removeDirectiveHandler(handler);
+    }
+
+    void setDialogRequestId(const std::string& dialogRequestId) override {
+        m_sequencer->setDialogRequestId(dialogRequestId);
+    }
+
+    std::string getDialogRequestId() override {
+        return m_sequencer->getDialogRequestId();
+    }
+
+    bool onDirective(std::shared_ptr<AVSDirective> directive) override {
+        (*m_enqueueTimes)[directiveIndex(directive->getMessageId())] = Clock::now();
+        return m_sequencer->onDirective(directive);
+    }
+
+    void disable() override {
+        m_sequencer->disable();
+    }
+
+    void enable() override {
+        m_sequencer->enable();
+    }
+
+protected:
+    void doShutdown() override {
+        m_sequencer->shutdown();
+    }
+
+private:
+    /// The sequencer to forward to.
+    std::shared_ptr<DirectiveSequencerInterface> m_sequencer;
+
+    /// Where to record the time each directive is enqueued.
+    std::vector<Clock::time_point>* m_enqueueTimes;
+};
+
+/**
+ * A directive handler which completes every directive straight away and records when it was handled.  It does not
+ * allocate, so that the benchmark only counts the allocations of the pipeline.
+ */
+class StubDirectiveHandler : public DirectiveHandlerInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param handleTimes Where to record the time each directive is handled, indexed by directive.
+     */
+    explicit StubDirectiveHandler(std::vector<Clock::time_point>* handleTimes) :
+            m_handleTimes{handleTimes},
+            m_results(handleTimes->size()),
+            m_handledCount{0} {
+    }
+
+    void handleDirectiveImmediately(std::shared_ptr<AVSDirective> directive) override {
+        markHandled(directiveIndex(directive->getMessageId()));
+    }
+
+    void preHandleDirective(std::shared_ptr<AVSDirective> directive, std::unique_ptr<DirectiveHandlerResultInterface>
+                                                                         result) override {
+        m_results[directiveIndex(directive->getMessageId())] = std::move(result);
+    }
+
+    bool handleDirective(const std::string& messageId) override {
+        auto index = directiveIndex(messageId);
+        markHandled(index);
+        if (m_results[index]) {
+            m_results[index]->setCompleted();
+            m_results[index].reset();
+        }
+        return true;
+    }
+
+    void cancelDirective(const std::string& messageId) override {
+        m_results[directiveIndex(messageId)].reset();
+    }
+
+    void onDeregistered() override {
+    }
+
+    DirectiveHandlerConfiguration getConfiguration() const override {
+        DirectiveHandlerConfiguration configuration;
+        auto policy = BlockingPolicy(BlockingPolicy::MEDIUMS_NONE, false);
+        for (auto& directive : DIRECTIVE_TEMPLATES) {
+            configuration[NamespaceAndName{NAMESPACE_BENCHMARK, directive.first}] = policy;
+        }
+        return configuration;
+    }
+
+    /**
+     * Wait until @c count directives have been handled in total.
+     *
+     * @param count The number of directives to wait for.
+     * @return Whether the directives were handled before @c HANDLING_TIMEOUT expired.
+     */
+    bool waitForHandled(size_t count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_wakeTrigger.wait_for(lock, HANDLING_TIMEOUT, [this, count] { return m_handledCount >= count; });
+    }
+
+private:
+    /**
+     * Record that a directive has been handled.
+     *
+     * @param index The index of the directive.
+     */
+    void markHandled(size_t index) {
+        (*m_handleTimes)[index] = Clock::now();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_handledCount;
+        m_wakeTrigger.notify_all();
+    }
+
+    /// Where to record the time each directive is handled.
+    std::vector<Clock::time_point>* m_handleTimes;
+
+    /// The results of the directives which have been pre-handled, indexed by directive.
+    std::vector<std::unique_ptr<DirectiveHandlerResultInterface>> m_results;
+
+    /// Serializes access to @c m_handledCount.
+    std::mutex m_mutex;
+
+    /// Notified when a directive has been handled.
+    std::condition_variable m_wakeTrigger;
+
+    /// The number of directives handled so far.
+    size_t m_handledCount;
+};
+
+/**
+ * A @c MessageConsumerInterface which hands the messages decoded by @c MimeResponseSink to a @c MessageInterpreter,
+ * standing in for the @c MessageRouter.
+ */
+class InterpreterMessageConsumer : public MessageConsumerInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param interpreter The interpreter to hand messages to.
+     */
+    explicit InterpreterMessageConsumer(std::shared_ptr<MessageInterpreter> interpreter) :
+            m_interpreter{interpreter} {
+    }
+
+    void consumeMessage(const std::string& contextId, const std::string& message) override {
+        m_interpreter->receive(contextId, message);
+    }
+
+private:
+    /// The interpreter to hand messages to.
+    std::shared_ptr<MessageInterpreter> m_interpreter;
+};
+
+/**
+ * A @c MimeResponseStatusHandlerInterface which accepts the response.
+ */
+class StubMimeResponseStatusHandler : public MimeResponseStatusHandlerInterface {
+public:
+    void onActivity() override {
+    }
+
+    bool onReceiveResponseCode(long responseCode) override {
+        return true;
+    }
+
+    void onResponseFinished(HTTP2ResponseFinishedStatus status, const std::string& nonMimeBody) override {
+    }
+};
+
+/**
+ * A class which helps drive the benchmarks in this file, by wiring the decoder, @c MimeResponseSink,
+ * @c MessageInterpreter, @c DirectiveSequencer and a stub handler together.
+ */
+class DirectivePipelineBenchmarkTest : public ::testing::Test {
+protected:
+    void SetUp() override;
+
+    void TearDown() override;
+
+    /**
+     * Feed a stream to a new decoder, the way a downchannel request would receive it.
+     *
+     * @param stream The multipart stream.
+     * @param partEnds If not empty, the stream is fed one directive at a time, waiting for each directive to be
+     *     handled before feeding the next one.
+     * @param firstIndex The index of the first directive in the stream.  Only used if @c partEnds is not empty.
+     */
+    void replay(const std::string& stream, const std::vector<size_t>& partEnds = {}, size_t firstIndex = 0);
+
+    /**
+     * Replay the warm-up directives.
+     */
+    void warmUp();
+
+    /**
+     * Print the measurements of a replay.
+     *
+     * @param description What was replayed.
+     * @param duration How long the replay took.
+     */
+    void report(const std::string& description, Clock::duration duration);
+
+    /// The index of the first directive measured.
+    size_t m_firstMeasuredIndex;
+
+    /// The number of directives measured.
+    size_t m_measuredCount;
+
+    /// The time each directive was enqueued to the sequencer, indexed by directive.
+    std::vector<Clock::time_point> m_enqueueTimes;
+
+    /// The time each directive was handled, indexed by directive.
+    std::vector<Clock::time_point> m_handleTimes;
+
+    /// The handler of all directives.
+    std::shared_ptr<StubDirectiveHandler> m_handler;
+
+    /// The sequencer wrapping the @c DirectiveSequencer.
+    std::shared_ptr<TimestampingDirectiveSequencer> m_sequencer;
+
+    /// The consumer of the messages decoded from the stream.
+    std::shared_ptr<InterpreterMessageConsumer> m_messageConsumer;
+
+    /// The attachment manager used by the sink and the interpreter.
+    std::shared_ptr<AttachmentManager> m_attachmentManager;
+};
+
+void DirectivePipelineBenchmarkTest::SetUp() {
+    // Debug logging would dominate the measurements.
+    getConsoleLogger()->setLevel(Level::WARN);
+    m_enqueueTimes.resize(WARMUP_DIRECTIVE_COUNT + DIRECTIVE_COUNT);
+    m_handleTimes.resize(WARMUP_DIRECTIVE_COUNT + DIRECTIVE_COUNT);
+    AllocationCounter::stop();
+    m_handler = std::make_shared<StubDirectiveHandler>(&m_handleTimes);
+    m_attachmentManager = std::make_shared<AttachmentManager>(AttachmentManager::AttachmentType::IN_PROCESS);
+    auto exceptionSender = std::make_shared<NiceMock<MockExceptionEncounteredSender>>();
+    auto shutdownNotifier = std::make_shared<NiceMock<MockShutdownNotifier>>();
+    auto sequencer = DirectiveSequencer::createDirectiveSequencerInterface(exceptionSender, shutdownNotifier, nullptr);
+    ASSERT_TRUE(sequencer);
+    m_sequencer = std::make_shared<TimestampingDirectiveSequencer>(sequencer, &m_enqueueTimes);
+    ASSERT_TRUE(m_sequencer->addDirectiveHandler(m_handler));
+    auto interpreter = std::make_shared<MessageInterpreter>(exceptionSender, m_sequencer, m_attachmentManager);
+    m_messageConsumer = std::make_shared<InterpreterMessageConsumer>(interpreter);
+}
+
+void DirectivePipelineBenchmarkTest::TearDown() {
+    m_sequencer->removeDirectiveHandler(m_handler);
+    m_sequencer->shutdown();
+}
+
+void DirectivePipelineBenchmarkTest::replay(
+    const std::string& stream,
+    const std::vector<size_t>& partEnds,
+    size_t firstIndex) {
+    auto sink = std::make_shared<MimeResponseSink>(
+        std::make_shared<StubMimeResponseStatusHandler>(),
+        m_messageConsumer,
+        m_attachmentManager,
+        ATTACHMENT_CONTEXT_ID);
+    HTTP2MimeResponseDecoder decoder(sink);
+    ASSERT_TRUE(decoder.onReceiveResponseCode(200));
+    ASSERT_TRUE(decoder.onReceiveHeaderLine("content-type: multipart/related; boundary=" + BOUNDARY));
+    if (partEnds.empty()) {
+        for (size_t offset = 0; offset < stream.size(); offset += RECEIVE_BUFFER_SIZE) {
+            auto size = std::min(RECEIVE_BUFFER_SIZE, stream.size() - offset);
+            ASSERT_EQ(decoder.onReceiveData(stream.data() + offset, size), HTTP2ReceiveDataStatus::SUCCESS);
+        }
+    } else {
+        size_t offset = 0;
+        for (size_t part = 0; part < partEnds.size(); ++part) {
+            auto size = partEnds[part] - offset;
+            ASSERT_EQ(decoder.onReceiveData(stream.data() + offset, size), HTTP2ReceiveDataStatus::SUCCESS);
+            ASSERT_TRUE(m_handler->waitForHandled(firstIndex + part + 1));
+            offset = partEnds[part];
+        }
+    }
+    decoder.onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+}
+
+void DirectivePipelineBenchmarkTest::warmUp() {
+    replay(createStream(0, WARMUP_DIRECTIVE_COUNT));
+    ASSERT_TRUE(m_handler->waitForHandled(WARMUP_DIRECTIVE_COUNT));
+}
+
+void DirectivePipelineBenchmarkTest::report(const std::string& description, Clock::duration duration) {
+    std::vector<std::chrono::nanoseconds> latencies;
+    latencies.reserve(m_measuredCount);
+    for (size_t index = m_firstMeasuredIndex; index < m_firstMeasuredIndex + m_measuredCount; ++index) {
+        latencies.push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(m_handleTimes[index] - m_enqueueTimes[index]));
+    }
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](size_t percent) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(latencies[latencies.size() * percent / 100])
+            .count();
+    };
+    auto seconds = std::chrono::duration_cast<std::chrono::duration<double>>(duration).count();
+
+    std::cout << description << ", " << m_measuredCount << " directives:" << std::endl
+              << "  throughput: " << static_cast<size_t>(m_measuredCount / seconds) << " directives/s" << std::endl
+              << "  enqueue-to-handle latency: p50 " << percentile(50) << " us, p99 " << percentile(99) << " us"
+              << std::endl
+              << "  allocations: " << static_cast<double>(AllocationCounter::getCount()) / m_measuredCount
+              << " per directive" << std::endl;
+}
+
+/**
+ * Replay a downchannel stream through the directive pipeline as fast as it can be decoded, and report its throughput,
+ * the latency from the directive being enqueued to the sequencer to it being handled (which includes queueing behind
+ * the directives before it), and the allocations made per directive.
+ */
+TEST_F(DirectivePipelineBenchmarkTest, testSlow_burstThroughputAndLatency) {
+    warmUp();
+    m_firstMeasuredIndex = WARMUP_DIRECTIVE_COUNT;
+    m_measuredCount = DIRECTIVE_COUNT;
+    auto stream = createStream(m_firstMeasuredIndex, m_measuredCount);
+
+    AllocationCounter::start();
+    auto startTime = Clock::now();
+    replay(stream);
+    ASSERT_TRUE(m_handler->waitForHandled(m_firstMeasuredIndex + m_measuredCount));
+    auto duration = Clock::now() - startTime;
+    AllocationCounter::stop();
+
+    report("Burst of " + std::to_string(stream.size()) + " bytes", duration);
+}
+
+/**
+ * Replay a downchannel stream one directive at a time, and report the same measurements for a pipeline which is idle
+ * when each directive arrives.
+ */
+TEST_F(DirectivePipelineBenchmarkTest, testSlow_pacedLatency) {
+    warmUp();
+    m_firstMeasuredIndex = WARMUP_DIRECTIVE_COUNT;
+    m_measuredCount = PACED_DIRECTIVE_COUNT;
+    std::vector<size_t> partEnds;
+    auto stream = createStream(m_firstMeasuredIndex, m_measuredCount, &partEnds);
+
+    AllocationCounter::start();
+    auto startTime = Clock::now();
+    replay(stream, partEnds, m_firstMeasuredIndex);
+    auto duration = Clock::now() - startTime;
+    AllocationCounter::stop();
+
+    report("One directive at a time", duration);
+}
+
+}  // namespace test
+}  // namespace adsl
+}  // namespace alexaClientSDK
@@ -158,6 +158,8 @@ private:
     /**
      * @c Executor which queues up operations from asynchronous API calls.
      *
+     * Its tasks only build the context and hand it to the @c ContextManager, so it may run on the shared scheduler.
+     *
      * @note This declaration needs to come *after* the Executor Thread Variables above so that the thread shuts down
      *     before the Executor Thread Variables are destroyed.
      */
@@ -22,6 +22,7 @@
 #include <AVSCommon/SDKInterfaces/FocusManagerInterface.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/String/StringUtils.h>
+#include <AVSCommon/Utils/Threading/WorkStealingScheduler.h>
 
 #include "AFML/AudioActivityTracker.h"
 
@@ -124,7 +125,8 @@ void AudioActivityTracker::notifyOfActivityUpdates(const std::vector<Channel::St
 AudioActivityTracker::AudioActivityTracker(
     std::shared_ptr<avsCommon::sdkInterfaces::ContextManagerInterface> contextManager) :
         RequiresShutdown{"AudioActivityTracker"},
-        m_contextManager{contextManager} {
+        m_contextManager{contextManager},
+        m_executor{threading::WorkStealingScheduler::getConfiguredScheduler()} {
     m_capabilityConfigurations.insert(getAudioActivityTrackerCapabilityConfiguration());
 }
 
@@ -16,8 +16,10 @@
 #define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_AVSCONTEXT_H_
 
 #include <map>
+#include <memory>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "AVSCommon/AVS/CapabilityTag.h"
 #include "AVSCommon/AVS/CapabilityState.h"
@@ -31,6 +33,9 @@ namespace avs {
  * The @c AVSContext represents a map where the key is the capabilities message identifier, which represents a unique
  * property in the device, and the value is their current state.
  *
+ * Copies of a context share their states and serialized JSON until one of them is modified, so passing a context
+ * around by value is cheap.
+ *
  * @note This class is not thread safe.
  */
 class AVSContext {
@@ -43,6 +48,15 @@ public:
      */
     AVSContext() = default;
 
+    /**
+     * Constructor for a context which has already been serialized.
+     *
+     * @param states The states in this context.
+     * @param json The serialization of @c states, which must be what @c toJson() would produce for them. It is
+     * returned by @c toJson() until the context is modified.
+     */
+    AVSContext(States states, std::string json);
+
     /**
      * Return a stringified json representation of @c AVSContext value.
      *
@@ -50,6 +64,24 @@ public:
      */
     std::string toJson() const;
 
+    /**
+     * Serialize the state of one capability as it appears in the context.
+     *
+     * @param identifier The capability identifier.
+     * @param state The capability state.
+     * @return The JSON object describing the state, or an empty string if the state is left out of the context
+     * because its value is empty.
+     */
+    static std::string buildStateJson(const CapabilityTag& identifier, const CapabilityState& state);
+
+    /**
+     * Assemble the context JSON from states serialized by @c buildStateJson().
+     *
+     * @param stateJsons The serialized states, in the order of @c States. Empty strings are skipped.
+     * @return The same JSON which @c toJson() produces for the states.
+     */
+    static std::string buildJson(const std::vector<const std::string*>& stateJsons);
+
     /**
      * Get all states available in this context.
      *
@@ -84,8 +116,18 @@ public:
     void removeState(const CapabilityTag& identifier);
 
 private:
-    /// A map of capabilities and their state.
-    States m_states;
+    /**
+     * Get the states for modification, copying them first if they are shared with another context.
+     *
+     * @return The states of this context.
+     */
+    States& mutableStates();
+
+    /// A map of capabilities and their state; @c nullptr if there are none.
+    std::shared_ptr<States> m_states;
+
+    /// The serialization of @c m_states, if known.
+    std::shared_ptr<const std::string> m_json;
 };
 
 }  // namespace avs
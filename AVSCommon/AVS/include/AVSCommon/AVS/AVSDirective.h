@@ -18,6 +18,7 @@
 
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -28,6 +29,9 @@ namespace alexaClientSDK {
 namespace avsCommon {
 namespace avs {
 
+/// The parsed payload of a directive, declared in "AVSCommon/AVS/ParsedPayload.h".
+class ParsedPayload;
+
 /**
  * A class representation of the AVS directive.
  */
@@ -111,6 +115,20 @@ public:
      */
     std::string getUnparsedDirective() const;
 
+    /**
+     * Returns the parsed payload, shared by all the consumers of this directive.
+     *
+     * For directives created from an unparsed directive, the payload references the document that was parsed during
+     * @c create(), so no additional parsing takes place. For directives created from a payload string, the payload is
+     * parsed once on first access.
+     *
+     * @note The parsed payload remains valid for as long as the returned pointer is held, even after this
+     * @c AVSDirective has been destroyed.
+     *
+     * @return The parsed payload, or @c nullptr if the payload is not a JSON object.
+     */
+    std::shared_ptr<const ParsedPayload> getParsedPayload() const;
+
     /**
      * Returns the attachmentContextId.
      */
@@ -126,6 +144,7 @@ private:
      * @param attachmentManager The attachment manager object.
      * @param attachmentContextId The contextId required to get attachments from the AttachmentManager.
      * @param endpoint Optional parameter used to identify the target endpoint for the given directive.
+     * @param parsedPayload The already parsed payload, or @c nullptr if the payload should be parsed on first access.
      */
     AVSDirective(
         const std::string& unparsedDirective,
@@ -133,7 +152,8 @@ private:
         const std::string& payload,
         std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface> attachmentManager,
         const std::string& attachmentContextId,
-        const utils::Optional<AVSMessageEndpoint>& endpoint);
+        const utils::Optional<AVSMessageEndpoint>& endpoint,
+        std::shared_ptr<const ParsedPayload> parsedPayload = nullptr);
 
     /// The unparsed directive JSON string from AVS.
     const std::string m_unparsedDirective;
@@ -141,6 +161,12 @@ private:
     std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface> m_attachmentManager;
     /// The contextId needed to acquire the right attachment from the attachmentManager.
     std::string m_attachmentContextId;
+
+    /// Guards the lazy initialization of @c m_parsedPayload.
+    mutable std::once_flag m_parsedPayloadFlag;
+
+    /// The parsed payload shared with all consumers of this directive.
+    mutable std::shared_ptr<const ParsedPayload> m_parsedPayload;
 };
 
 /**
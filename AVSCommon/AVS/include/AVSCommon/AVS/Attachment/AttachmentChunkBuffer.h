@@ -0,0 +1,243 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTCHUNKBUFFER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTCHUNKBUFFER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "AVSCommon/AVS/Attachment/AttachmentReader.h"
+#include "AVSCommon/AVS/Attachment/AttachmentWriter.h"
+#include "AVSCommon/Utils/SDS/WriterPolicy.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/**
+ * A slice of a reference counted block of attachment data.  The slice keeps the block alive, so it can be handed to
+ * consumers which release it asynchronously (for instance a media pipeline) without copying the data.
+ */
+struct AttachmentChunk {
+    /// The block of data the slice refers to.
+    std::shared_ptr<const std::vector<uint8_t>> data;
+
+    /// The offset of the slice within @c data.
+    size_t offset;
+
+    /// The size of the slice in bytes.
+    size_t size;
+};
+
+/**
+ * The data shared between a @c ChunkedAttachmentWriter and a @c ChunkedAttachmentReader.  Every write is copied once
+ * into a newly allocated, reference counted chunk, and the reader either copies data out of the chunks or takes
+ * references to them.
+ *
+ * The semantics follow the @c SharedDataStream used by @c InProcessAttachment: unless the writer is @c NONBLOCKABLE,
+ * it is held back once @c maxBufferedBytes of data have not been read yet (whether or not the reader has been
+ * attached), and data which has already been read is kept, so that the reader can seek back to it, until the total
+ * size of the chunks exceeds @c maxBufferedBytes.  Unlike a @c SharedDataStream, memory is only allocated for the data
+ * which is actually written, and it is released as soon as it has been read and is no longer needed.
+ *
+ * This class is thread-safe.
+ */
+class AttachmentChunkBuffer {
+public:
+    /**
+     * Constructor.
+     *
+     * @param maxBufferedBytes The number of bytes which may be buffered before the writer is held back or old data is
+     *     discarded.
+     */
+    explicit AttachmentChunkBuffer(size_t maxBufferedBytes);
+
+    /**
+     * Copy data into a new chunk.
+     *
+     * @param buf The data to write.
+     * @param numBytes The number of bytes to write.
+     * @param[out] writeStatus The resulting state of the write.
+     * @param policy How to deal with a full buffer: @c NONBLOCKABLE discards the oldest data, even if it has not been
+     *     read, @c ALL_OR_NOTHING fails with @c OK_BUFFER_FULL, and @c BLOCKING waits for up to @c timeout.
+     * @param timeout How long a @c BLOCKING write waits for room in the buffer.  Zero means wait forever.
+     * @return The number of bytes written, which is either @c numBytes or zero.
+     */
+    size_t write(
+        const void* buf,
+        size_t numBytes,
+        AttachmentWriter::WriteStatus* writeStatus,
+        utils::sds::WriterPolicy policy,
+        std::chrono::milliseconds timeout);
+
+    /// Mark the end of the data; the reader will see @c CLOSED once it has read everything.
+    void closeWriter();
+
+    /**
+     * Attach the (only) reader.
+     *
+     * @return Whether the reader was attached; fails if a reader has been attached before.
+     */
+    bool attachReader();
+
+    /**
+     * Take a reference to the next chunk of data, without copying it.
+     *
+     * @param maxBytes The maximum size of the returned slice.
+     * @param[out] readStatus The resulting state of the read.
+     * @param timeout How long to wait for data.  Only used if @c blocking is @c true; zero means wait forever.
+     * @param blocking Whether to wait for data.
+     * @return A slice of up to @c maxBytes bytes, which is empty (with a @c nullptr @c data) if no data was read.
+     */
+    AttachmentChunk readChunk(
+        size_t maxBytes,
+        AttachmentReader::ReadStatus* readStatus,
+        std::chrono::milliseconds timeout,
+        bool blocking);
+
+    /**
+     * Copy data out of the chunks.
+     *
+     * @param buf The buffer to copy the data to.
+     * @param numBytes The size of @c buf.
+     * @param[out] readStatus The resulting state of the read.
+     * @param timeout How long to wait for data.  Only used if @c blocking is @c true; zero means wait forever.
+     * @param blocking Whether to wait for data.
+     * @return The number of bytes copied.
+     */
+    size_t read(
+        void* buf,
+        size_t numBytes,
+        AttachmentReader::ReadStatus* readStatus,
+        std::chrono::milliseconds timeout,
+        bool blocking);
+
+    /**
+     * Move the read position.
+     *
+     * @param offset The absolute position to read from next.
+     * @return Whether @c offset refers to data which has not been discarded.  Seeking past the data written so far
+     *     is allowed.
+     */
+    bool seek(uint64_t offset);
+
+    /**
+     * Get the number of bytes which have been written but not read yet.
+     *
+     * @return The number of unread bytes.
+     */
+    uint64_t getNumUnreadBytes();
+
+    /**
+     * Detach the reader.
+     *
+     * @param closePoint Whether the reader stops immediately or after reading the data written so far.
+     */
+    void closeReader(AttachmentReader::ClosePoint closePoint);
+
+    /**
+     * Get the total size of the chunks currently held by the buffer.  Chunks which have been handed out by
+     * @c readChunk() may be kept alive by their consumers after the buffer has released them.
+     *
+     * @return The total size of the chunks held by the buffer.
+     */
+    size_t getBufferedBytes();
+
+private:
+    /// A chunk and its position in the attachment.
+    struct Chunk {
+        /// The absolute position of the first byte of the chunk.
+        uint64_t offset;
+
+        /// The data of the chunk.
+        std::shared_ptr<const std::vector<uint8_t>> data;
+    };
+
+    /**
+     * Wait until there is data to read, or the read cannot proceed.  Must be called with @c m_mutex held.
+     *
+     * @param lock The lock on @c m_mutex.
+     * @param[out] readStatus The state of the read if it cannot proceed.
+     * @param timeout How long to wait for data.  Zero means wait forever.
+     * @param blocking Whether to wait for data.
+     * @return An iterator to the chunk holding the read position, or @c m_chunks.end() if the read cannot proceed.
+     */
+    std::deque<Chunk>::iterator waitForDataLocked(
+        std::unique_lock<std::mutex>& lock,
+        AttachmentReader::ReadStatus* readStatus,
+        std::chrono::milliseconds timeout,
+        bool blocking);
+
+    /**
+     * Get the number of bytes the reader has yet to read.  Must be called with @c m_mutex held.
+     *
+     * @return The number of unread bytes.
+     */
+    uint64_t unreadBytesLocked() const;
+
+    /**
+     * Release chunks from the front while the buffer holds more than its limit.  Must be called with @c m_mutex held.
+     *
+     * @param discardUnread Whether chunks which have not been read yet may be released.
+     */
+    void trimLocked(bool discardUnread);
+
+    /// The limit on buffered data.
+    const size_t m_maxBufferedBytes;
+
+    /// Protects the members below.
+    std::mutex m_mutex;
+
+    /// Notified when data is written or read, and when either side is closed.
+    std::condition_variable m_wakeTrigger;
+
+    /// The chunks held by the buffer, in order.
+    std::deque<Chunk> m_chunks;
+
+    /// The total size of @c m_chunks.
+    size_t m_bufferedBytes;
+
+    /// The absolute position just past the last byte written.
+    uint64_t m_writeOffset;
+
+    /// The absolute position of the next byte to read.
+    uint64_t m_readOffset;
+
+    /// Whether the writer has closed.
+    bool m_writerClosed;
+
+    /// Whether a reader has been attached.
+    bool m_readerAttached;
+
+    /// Whether the reader has been closed with @c ClosePoint::IMMEDIATELY.
+    bool m_readerClosed;
+
+    /// The absolute position at which the reader stops (set when it is closed with @c AFTER_DRAINING_CURRENT_BUFFER).
+    uint64_t m_readerCloseOffset;
+};
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTCHUNKBUFFER_H_
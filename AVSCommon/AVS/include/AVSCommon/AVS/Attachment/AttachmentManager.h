@@ -20,6 +20,7 @@
 #include <unordered_map>
 
 #include "AVSCommon/AVS/Attachment/AttachmentManagerInterface.h"
+#include "AVSCommon/Utils/Configuration/ConfigurationNode.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -68,7 +69,10 @@ public:
      */
     enum class AttachmentType {
         /// This value corresponds to the @c InProcessAttachment class.
-        IN_PROCESS
+        IN_PROCESS,
+
+        /// This value corresponds to the @c ChunkedAttachment class.
+        CHUNKED
     };
 
     /**
@@ -78,6 +82,25 @@ public:
      */
     static std::shared_ptr<AttachmentManagerInterface> createInProcessAttachmentManagerInterface();
 
+    /**
+     * Factory for creating CHUNKED instances of AttachmentManagerInterface.  The attachments it manages store their
+     * data in reference counted chunks which a reader can consume without copying, but support a single reader each.
+     *
+     * @return A CHUNKED instance of AttachmentManagerInterface.
+     */
+    static std::shared_ptr<AttachmentManagerInterface> createChunkedAttachmentManagerInterface();
+
+    /**
+     * Factory for creating an instance of AttachmentManagerInterface whose attachment type is selected by the
+     * @c attachmentManager.attachmentType configuration value, which may be @c "IN_PROCESS" or @c "CHUNKED".
+     * IN_PROCESS attachments are used when the value is absent.
+     *
+     * @param configurationRoot The root of the SDK configuration.
+     * @return An instance of AttachmentManagerInterface, or @c nullptr if the configured type is not recognized.
+     */
+    static std::shared_ptr<AttachmentManagerInterface> createAttachmentManagerInterfaceFromConfiguration(
+        const std::shared_ptr<utils::configuration::ConfigurationNode>& configurationRoot);
+
     /**
      * Constructor.
      *
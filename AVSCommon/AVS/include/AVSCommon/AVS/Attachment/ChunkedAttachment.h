@@ -0,0 +1,64 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENT_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENT_H_
+
+#include "AVSCommon/AVS/Attachment/Attachment.h"
+#include "AVSCommon/AVS/Attachment/AttachmentChunkBuffer.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentReader.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentWriter.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/**
+ * A class that represents an AVS attachment following an in-process memory management model, which stores the data
+ * in reference counted chunks instead of a preallocated @c SharedDataStream.  Memory is allocated as data arrives and
+ * released once it has been read, and a reader can take references to the chunks (see
+ * @c ChunkedAttachmentReader::readChunk()) instead of copying the data out.  A @c ChunkedAttachment supports a single
+ * reader.
+ */
+class ChunkedAttachment : public Attachment {
+public:
+    /// Default limit of the data buffered by the attachment, which matches the size of an @c InProcessAttachment.
+    static const size_t DEFAULT_MAX_BUFFERED_BYTES;
+
+    /**
+     * Constructor.
+     *
+     * @param id The attachment id.
+     * @param maxBufferedBytes The number of bytes which may be buffered before the writer is held back.
+     */
+    ChunkedAttachment(const std::string& id, size_t maxBufferedBytes = DEFAULT_MAX_BUFFERED_BYTES);
+
+    std::unique_ptr<AttachmentWriter> createWriter(
+        utils::sds::WriterPolicy policy = utils::sds::WriterPolicy::ALL_OR_NOTHING) override;
+
+    std::unique_ptr<AttachmentReader> createReader(utils::sds::ReaderPolicy policy) override;
+
+private:
+    /// The buffer shared between the reader and the writer.
+    std::shared_ptr<AttachmentChunkBuffer> m_buffer;
+};
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENT_H_
@@ -0,0 +1,100 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTREADER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTREADER_H_
+
+#include <memory>
+
+#include "AVSCommon/AVS/Attachment/AttachmentChunkBuffer.h"
+#include "AVSCommon/AVS/Attachment/AttachmentReader.h"
+#include "AVSCommon/Utils/SDS/ReaderPolicy.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/**
+ * A class that provides functionality to read data from a @c ChunkedAttachment.  Besides the copying @c read(), it
+ * offers @c readChunk(), which hands out references to the chunks the data was written into.
+ */
+class ChunkedAttachmentReader : public AttachmentReader {
+public:
+    /**
+     * Create a ChunkedAttachmentReader.
+     *
+     * @param policy The policy this reader should adhere to.
+     * @param buffer The buffer shared with the writer.
+     * @return Returns a new ChunkedAttachmentReader, or nullptr if the operation failed.
+     */
+    static std::unique_ptr<ChunkedAttachmentReader> create(
+        utils::sds::ReaderPolicy policy,
+        std::shared_ptr<AttachmentChunkBuffer> buffer);
+
+    /**
+     * Destructor.
+     */
+    ~ChunkedAttachmentReader() override;
+
+    std::size_t read(
+        void* buf,
+        std::size_t numBytes,
+        ReadStatus* readStatus,
+        std::chrono::milliseconds timeoutMs = std::chrono::milliseconds(0)) override;
+
+    /**
+     * Read the next chunk of data without copying it.  The returned slice is at most the size of the chunk holding
+     * the read position, so it may be smaller than @c maxBytes even if more data is available.
+     *
+     * @param maxBytes The maximum number of bytes to read.
+     * @param[out] readStatus The out-parameter where the resulting state of the read will be expressed.
+     * @param timeoutMs The timeout for this read call in milliseconds.  This value is only used for the @c BLOCKING
+     *     reader policy.  If this parameter is zero, there is no timeout and blocking reads will wait forever.
+     * @return The slice read, which has a @c nullptr @c data member if nothing was read.
+     */
+    AttachmentChunk readChunk(
+        std::size_t maxBytes,
+        ReadStatus* readStatus,
+        std::chrono::milliseconds timeoutMs = std::chrono::milliseconds(0));
+
+    void close(ClosePoint closePoint = ClosePoint::AFTER_DRAINING_CURRENT_BUFFER) override;
+
+    bool seek(uint64_t offset) override;
+
+    uint64_t getNumUnreadBytes() override;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param policy The policy this reader should adhere to.
+     * @param buffer The buffer shared with the writer.
+     */
+    ChunkedAttachmentReader(utils::sds::ReaderPolicy policy, std::shared_ptr<AttachmentChunkBuffer> buffer);
+
+    /// Whether reads wait for data.
+    const bool m_blocking;
+
+    /// The buffer shared with the writer.
+    std::shared_ptr<AttachmentChunkBuffer> m_buffer;
+};
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTREADER_H_
@@ -0,0 +1,81 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTWRITER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTWRITER_H_
+
+#include <memory>
+
+#include "AVSCommon/AVS/Attachment/AttachmentChunkBuffer.h"
+#include "AVSCommon/AVS/Attachment/AttachmentWriter.h"
+#include "AVSCommon/Utils/SDS/WriterPolicy.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/**
+ * A class that provides functionality to write data to a @c ChunkedAttachment.  Every @c write() copies the data once,
+ * into a new chunk which the reader can take a reference to.
+ */
+class ChunkedAttachmentWriter : public AttachmentWriter {
+public:
+    /**
+     * Create a ChunkedAttachmentWriter.
+     *
+     * @param buffer The buffer shared with the reader.
+     * @param policy The policy of the new writer.
+     * @return Returns a new ChunkedAttachmentWriter, or nullptr if the operation failed.
+     */
+    static std::unique_ptr<ChunkedAttachmentWriter> create(
+        std::shared_ptr<AttachmentChunkBuffer> buffer,
+        utils::sds::WriterPolicy policy = utils::sds::WriterPolicy::ALL_OR_NOTHING);
+
+    /**
+     * Destructor.
+     */
+    ~ChunkedAttachmentWriter() override;
+
+    std::size_t write(
+        const void* buff,
+        std::size_t numBytes,
+        WriteStatus* writeStatus,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0)) override;
+
+    void close() override;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param buffer The buffer shared with the reader.
+     * @param policy The policy of the new writer.
+     */
+    ChunkedAttachmentWriter(std::shared_ptr<AttachmentChunkBuffer> buffer, utils::sds::WriterPolicy policy);
+
+    /// The policy of this writer.
+    const utils::sds::WriterPolicy m_policy;
+
+    /// The buffer shared with the reader; @c nullptr once closed.
+    std::shared_ptr<AttachmentChunkBuffer> m_buffer;
+};
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTWRITER_H_
@@ -0,0 +1,99 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_PARSEDPAYLOAD_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_PARSEDPAYLOAD_H_
+
+#include <memory>
+#include <string>
+
+#include <rapidjson/document.h>
+
+#include "AVSCommon/Utils/JSON/JSONUtils.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+
+/**
+ * The parsed payload of an @c AVSDirective. It is immutable, and shared by all the consumers of the directive so that
+ * none of them needs to parse the payload again.
+ */
+class ParsedPayload {
+public:
+    /**
+     * Parses a payload.
+     *
+     * @param payload The payload as a JSON string.
+     * @return The parsed payload, or @c nullptr if @c payload is not a JSON object.
+     */
+    static std::shared_ptr<const ParsedPayload> create(const std::string& payload);
+
+    /**
+     * Creates a parsed payload from the payload node of an already parsed directive. A payload sent as a JSON string
+     * rather than as a JSON object is parsed.
+     *
+     * @param directive The parsed directive, which is kept alive by the parsed payload.
+     * @param payload The payload node of @c directive.
+     * @return The parsed payload, or @c nullptr if @c payload is not, or does not contain, a JSON object.
+     */
+    static std::shared_ptr<const ParsedPayload> create(
+        std::shared_ptr<const rapidjson::Document> directive,
+        const rapidjson::Value& payload);
+
+    /**
+     * Returns the parsed payload object.
+     *
+     * @return The parsed payload object, which remains valid for as long as this object does.
+     */
+    const rapidjson::Value& getDocument() const;
+
+    /**
+     * Retrieves the value of a top level property of the payload.
+     *
+     * @tparam T The type of the value to retrieve. Any type supported by @c jsonUtils::retrieveValue may be used.
+     * @param key The name of the payload property.
+     * @param[out] value The output parameter which will be assigned the value of the property.
+     * @return @c true if the property was found and converted to @c T, @c false otherwise.
+     */
+    template <typename T>
+    bool retrieveValue(const std::string& key, T* value) const;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param document The document owning @c value.
+     * @param value The payload object.
+     */
+    ParsedPayload(std::shared_ptr<const rapidjson::Document> document, const rapidjson::Value& value);
+
+    /// The document owning @c m_value.
+    std::shared_ptr<const rapidjson::Document> m_document;
+
+    /// The payload object.
+    const rapidjson::Value& m_value;
+};
+
+template <typename T>
+bool ParsedPayload::retrieveValue(const std::string& key, T* value) const {
+    return utils::json::jsonUtils::retrieveValue(m_value, key, value);
+}
+
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_PARSEDPAYLOAD_H_
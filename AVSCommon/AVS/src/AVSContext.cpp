@@ -22,9 +22,6 @@ namespace alexaClientSDK {
 namespace avsCommon {
 namespace avs {
 
-/// Key used to identify the context properties.
-static const std::string PROPERTIES_KEY_STRING = "properties";
-
 /// Key used to identify an instance.
 static const std::string INSTANCE_KEY_STRING = "instance";
 
@@ -38,6 +35,12 @@ static const std::string TIME_OF_SAMPLE_KEY_STRING = "timeOfSample";
 /// https://developer.amazon.com/docs/alexa/alexa-voice-service/reportable-state-properties.html#property-object
 static const std::string UNCERTAINTY_KEY_STRING = "uncertaintyInMilliseconds";
 
+/// The context JSON preceding the first property.
+static const std::string CONTEXT_JSON_PREFIX = R"({"properties":[)";
+
+/// The context JSON following the last property.
+static const std::string CONTEXT_JSON_SUFFIX = "]}";
+
 /// String to identify log entries originating from this file.
 #define TAG "AVSContext"
 
@@ -48,49 +51,100 @@ static const std::string UNCERTAINTY_KEY_STRING = "uncertaintyInMilliseconds";
  */
 #define LX(event) utils::logger::LogEntry(TAG, event)
 
+AVSContext::AVSContext(States states, std::string json) :
+        m_states{std::make_shared<States>(std::move(states))},
+        m_json{std::make_shared<const std::string>(std::move(json))} {
+}
+
 utils::Optional<CapabilityState> AVSContext::getState(const CapabilityTag& identifier) const {
-    auto it = m_states.find(identifier);
-    return (it != m_states.end()) ? utils::Optional<CapabilityState>(it->second) : utils::Optional<CapabilityState>();
+    if (!m_states) {
+        return utils::Optional<CapabilityState>();
+    }
+    auto it = m_states->find(identifier);
+    return (it != m_states->end()) ? utils::Optional<CapabilityState>(it->second) : utils::Optional<CapabilityState>();
 }
 
 std::map<CapabilityTag, CapabilityState> AVSContext::getStates() const {
-    return m_states;
+    return m_states ? *m_states : States();
 }
 
 void AVSContext::addState(const CapabilityTag& identifier, const CapabilityState& state) {
-    m_states.insert(std::make_pair(identifier, state));
+    mutableStates().insert(std::make_pair(identifier, state));
 }
 
 void AVSContext::removeState(const CapabilityTag& identifier) {
-    m_states.erase(identifier);
+    mutableStates().erase(identifier);
 }
 
-std::string AVSContext::toJson() const {
+AVSContext::States& AVSContext::mutableStates() {
+    if (!m_states) {
+        m_states = std::make_shared<States>();
+    } else if (m_states.use_count() > 1) {
+        m_states = std::make_shared<States>(*m_states);
+    }
+    m_json.reset();
+    return *m_states;
+}
+
+std::string AVSContext::buildStateJson(const CapabilityTag& identifier, const CapabilityState& state) {
+    if (state.valuePayload.empty()) {
+        ACSDK_DEBUG0(LX("toJson").d("stateIgnored", identifier.nameSpace + "::" + identifier.name));
+        return "";
+    }
     utils::json::JsonGenerator jsonGenerator;
-    jsonGenerator.startArray(PROPERTIES_KEY_STRING);
-    for (const auto& element : m_states) {
-        auto& identifier = element.first;
-        auto& state = element.second;
-        if (!state.valuePayload.empty()) {
-            jsonGenerator.startArrayElement();
-            jsonGenerator.addMember(constants::NAMESPACE_KEY_STRING, identifier.nameSpace);
-            jsonGenerator.addMember(constants::NAME_KEY_STRING, identifier.name);
-            if (identifier.instance.hasValue()) {
-                jsonGenerator.addMember(INSTANCE_KEY_STRING, identifier.instance.value());
-            }
-
-            jsonGenerator.addRawJsonMember(VALUE_KEY_STRING, state.valuePayload);
-            jsonGenerator.addMember(TIME_OF_SAMPLE_KEY_STRING, state.timeOfSample.getTime_ISO_8601());
-            jsonGenerator.addMember(UNCERTAINTY_KEY_STRING, state.uncertaintyInMilliseconds);
-            jsonGenerator.finishArrayElement();
-        } else {
-            ACSDK_DEBUG0(LX("toJson").d("stateIgnored", identifier.nameSpace + "::" + identifier.name));
-        }
+    jsonGenerator.addMember(constants::NAMESPACE_KEY_STRING, identifier.nameSpace);
+    jsonGenerator.addMember(constants::NAME_KEY_STRING, identifier.name);
+    if (identifier.instance.hasValue()) {
+        jsonGenerator.addMember(INSTANCE_KEY_STRING, identifier.instance.value());
     }
-    jsonGenerator.finishArray();
-    ACSDK_DEBUG5(LX("toJson").sensitive("context", jsonGenerator.toString()));
+
+    jsonGenerator.addRawJsonMember(VALUE_KEY_STRING, state.valuePayload);
+    jsonGenerator.addMember(TIME_OF_SAMPLE_KEY_STRING, state.timeOfSample.getTime_ISO_8601());
+    jsonGenerator.addMember(UNCERTAINTY_KEY_STRING, state.uncertaintyInMilliseconds);
     return jsonGenerator.toString();
 }
+
+std::string AVSContext::buildJson(const std::vector<const std::string*>& stateJsons) {
+    size_t size = CONTEXT_JSON_PREFIX.size() + CONTEXT_JSON_SUFFIX.size();
+    for (auto stateJson : stateJsons) {
+        size += stateJson->size() + 1;
+    }
+    std::string json;
+    json.reserve(size);
+    json.append(CONTEXT_JSON_PREFIX);
+    bool first = true;
+    for (auto stateJson : stateJsons) {
+        if (stateJson->empty()) {
+            continue;
+        }
+        if (!first) {
+            json.push_back(',');
+        }
+        json.append(*stateJson);
+        first = false;
+    }
+    json.append(CONTEXT_JSON_SUFFIX);
+    return json;
+}
+
+std::string AVSContext::toJson() const {
+    if (m_json) {
+        return *m_json;
+    }
+    std::vector<std::string> stateJsons;
+    std::vector<const std::string*> stateJsonPointers;
+    if (m_states) {
+        stateJsons.reserve(m_states->size());
+        for (const auto& element : *m_states) {
+            stateJsons.push_back(buildStateJson(element.first, element.second));
+            stateJsonPointers.push_back(&stateJsons.back());
+        }
+    }
+    auto json = buildJson(stateJsonPointers);
+    ACSDK_DEBUG5(LX("toJson").sensitive("context", json));
+    return json;
+}
+
 }  // namespace avs
 }  // namespace avsCommon
 }  // namespace alexaClientSDK
@@ -14,6 +14,7 @@
  */
 
 #include "AVSCommon/AVS/AVSDirective.h"
+#include "AVSCommon/AVS/ParsedPayload.h"
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
 #include "AVSCommon/Utils/Logger/Logger.h"
 
@@ -180,9 +181,13 @@ static std::shared_ptr<AVSMessageHeader> parseHeader(const Document& document, A
  *
  * @param document The constructed document tree
  * @param [out] parseStatus An out parameter to express if the parse was successful
+ * @param [out] payloadNode An optional out parameter which will point at the payload node within @c document.
  * @return The payload content if it is available.
  */
-static std::string parsePayload(const Document& document, AVSDirective::ParseStatus* parseStatus) {
+static std::string parsePayload(
+    const Document& document,
+    AVSDirective::ParseStatus* parseStatus,
+    const Value** payloadNode = nullptr) {
     if (!parseStatus) {
         ACSDK_ERROR(LX("parsePayloadFailed").m("nullptr parseStatus"));
         return "";
@@ -194,12 +199,18 @@ static std::string parsePayload(const Document& document, AVSDirective::ParseSta
         return "";
     }
 
+    Value::ConstMemberIterator payloadIt;
     std::string payload;
-    if (!retrieveValue(directiveIt->value, JSON_MESSAGE_PAYLOAD_KEY, &payload)) {
+    if (!findNode(directiveIt->value, JSON_MESSAGE_PAYLOAD_KEY, &payloadIt) ||
+        !convertToValue(payloadIt->value, &payload)) {
         *parseStatus = AVSDirective::ParseStatus::ERROR_MISSING_PAYLOAD_KEY;
         return "";
     }
 
+    if (payloadNode) {
+        *payloadNode = &payloadIt->value;
+    }
+
     *parseStatus = AVSDirective::ParseStatus::SUCCESS;
     return payload;
 }
@@ -243,29 +254,33 @@ std::pair<std::unique_ptr<AVSDirective>, AVSDirective::ParseStatus> AVSDirective
     std::pair<std::unique_ptr<AVSDirective>, ParseStatus> result;
     result.second = ParseStatus::SUCCESS;
 
-    Document document;
-    if (!parseDocument(unparsedDirective, &document)) {
+    // The document is kept alive by the parsed payload view handed to the directive, so that consumers of the
+    // payload do not need to parse it again.
+    auto document = std::make_shared<Document>();
+    if (!parseDocument(unparsedDirective, document.get())) {
         ACSDK_ERROR(LX("createFailed").m("failed to parse JSON"));
         result.second = ParseStatus::ERROR_INVALID_JSON;
         return result;
     }
 
-    auto header = parseHeader(document, &(result.second));
+    auto header = parseHeader(*document, &(result.second));
     if (ParseStatus::SUCCESS != result.second) {
         ACSDK_ERROR(LX("createFailed").m("failed to parse header"));
         return result;
     }
 
-    auto payload = parsePayload(document, &(result.second));
+    const Value* payloadNode = nullptr;
+    auto payload = parsePayload(*document, &(result.second), &payloadNode);
     if (ParseStatus::SUCCESS != result.second) {
         ACSDK_ERROR(LX("createFailed").m("failed to parse payload"));
         return result;
     }
 
-    auto endpoint = parseEndpoint(document);
+    auto endpoint = parseEndpoint(*document);
 
-    result.first = std::unique_ptr<AVSDirective>(
-        new AVSDirective(unparsedDirective, header, payload, attachmentManager, attachmentContextId, endpoint));
+    auto parsedPayload = ParsedPayload::create(document, *payloadNode);
+    result.first = std::unique_ptr<AVSDirective>(new AVSDirective(
+        unparsedDirective, header, payload, attachmentManager, attachmentContextId, endpoint, parsedPayload));
 
     return result;
 }
@@ -306,17 +321,32 @@ AVSDirective::AVSDirective(
     const std::string& payload,
     std::shared_ptr<AttachmentManagerInterface> attachmentManager,
     const std::string& attachmentContextId,
-    const utils::Optional<AVSMessageEndpoint>& endpoint) :
+    const utils::Optional<AVSMessageEndpoint>& endpoint,
+    std::shared_ptr<const ParsedPayload> parsedPayload) :
         AVSMessage{avsMessageHeader, payload, endpoint},
         m_unparsedDirective{unparsedDirective},
         m_attachmentManager{attachmentManager},
-        m_attachmentContextId{attachmentContextId} {
+        m_attachmentContextId{attachmentContextId},
+        m_parsedPayload{std::move(parsedPayload)} {
 }
 
 std::string AVSDirective::getUnparsedDirective() const {
     return m_unparsedDirective;
 }
 
+std::shared_ptr<const ParsedPayload> AVSDirective::getParsedPayload() const {
+    std::call_once(m_parsedPayloadFlag, [this]() {
+        if (m_parsedPayload) {
+            return;
+        }
+        m_parsedPayload = ParsedPayload::create(getPayload());
+        if (!m_parsedPayload) {
+            ACSDK_ERROR(LX("getParsedPayloadFailed").d("reason", "parseFailed").d("messageId", getMessageId()));
+        }
+    });
+    return m_parsedPayload;
+}
+
 std::string AVSDirective::getAttachmentContextId() const {
     return m_attachmentContextId;
 }
@@ -0,0 +1,265 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "AVSCommon/AVS/Attachment/AttachmentChunkBuffer.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+using namespace utils::sds;
+
+/// Read offset which the reader never reaches, used while the reader has not been closed.
+static constexpr uint64_t NO_CLOSE_OFFSET = std::numeric_limits<uint64_t>::max();
+
+AttachmentChunkBuffer::AttachmentChunkBuffer(size_t maxBufferedBytes) :
+        m_maxBufferedBytes{maxBufferedBytes},
+        m_bufferedBytes{0},
+        m_writeOffset{0},
+        m_readOffset{0},
+        m_writerClosed{false},
+        m_readerAttached{false},
+        m_readerClosed{false},
+        m_readerCloseOffset{NO_CLOSE_OFFSET} {
+}
+
+size_t AttachmentChunkBuffer::write(
+    const void* buf,
+    size_t numBytes,
+    AttachmentWriter::WriteStatus* writeStatus,
+    WriterPolicy policy,
+    std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_writerClosed) {
+        *writeStatus = AttachmentWriter::WriteStatus::CLOSED;
+        return 0;
+    }
+    *writeStatus = AttachmentWriter::WriteStatus::OK;
+    if (0 == numBytes) {
+        return 0;
+    }
+    if (m_readerClosed) {
+        // Nobody will read this data, so there is no point in keeping it.
+        m_writeOffset += numBytes;
+        return numBytes;
+    }
+
+    // A write which does not fit is still accepted if nothing is unread, so that oversized writes cannot get stuck.
+    auto hasRoom = [this, numBytes] {
+        auto unread = unreadBytesLocked();
+        return 0 == unread || unread + numBytes <= m_maxBufferedBytes || m_writerClosed || m_readerClosed;
+    };
+    switch (policy) {
+        case WriterPolicy::NONBLOCKABLE:
+            break;
+        case WriterPolicy::ALL_OR_NOTHING:
+            if (!hasRoom()) {
+                *writeStatus = AttachmentWriter::WriteStatus::OK_BUFFER_FULL;
+                return 0;
+            }
+            break;
+        case WriterPolicy::BLOCKING:
+            if (std::chrono::milliseconds::zero() == timeout) {
+                m_wakeTrigger.wait(lock, hasRoom);
+            } else if (!m_wakeTrigger.wait_for(lock, timeout, hasRoom)) {
+                *writeStatus = AttachmentWriter::WriteStatus::TIMEDOUT;
+                return 0;
+            }
+            if (m_writerClosed) {
+                *writeStatus = AttachmentWriter::WriteStatus::CLOSED;
+                return 0;
+            }
+            break;
+    }
+
+    auto bytes = static_cast<const uint8_t*>(buf);
+    m_chunks.push_back({m_writeOffset, std::make_shared<const std::vector<uint8_t>>(bytes, bytes + numBytes)});
+    m_bufferedBytes += numBytes;
+    m_writeOffset += numBytes;
+    trimLocked(WriterPolicy::NONBLOCKABLE == policy);
+    m_wakeTrigger.notify_all();
+    return numBytes;
+}
+
+void AttachmentChunkBuffer::closeWriter() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_writerClosed = true;
+    m_wakeTrigger.notify_all();
+}
+
+bool AttachmentChunkBuffer::attachReader() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_readerAttached) {
+        return false;
+    }
+    m_readerAttached = true;
+    return true;
+}
+
+AttachmentChunk AttachmentChunkBuffer::readChunk(
+    size_t maxBytes,
+    AttachmentReader::ReadStatus* readStatus,
+    std::chrono::milliseconds timeout,
+    bool blocking) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto it = waitForDataLocked(lock, readStatus, timeout, blocking);
+    if (m_chunks.end() == it) {
+        return {nullptr, 0, 0};
+    }
+    auto offsetInChunk = static_cast<size_t>(m_readOffset - it->offset);
+    auto size = std::min(
+        {maxBytes,
+         it->data->size() - offsetInChunk,
+         static_cast<size_t>(std::min(m_writeOffset, m_readerCloseOffset) - m_readOffset)});
+    AttachmentChunk chunk{it->data, offsetInChunk, size};
+    m_readOffset += size;
+    trimLocked(false);
+    m_wakeTrigger.notify_all();
+    return chunk;
+}
+
+size_t AttachmentChunkBuffer::read(
+    void* buf,
+    size_t numBytes,
+    AttachmentReader::ReadStatus* readStatus,
+    std::chrono::milliseconds timeout,
+    bool blocking) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto it = waitForDataLocked(lock, readStatus, timeout, blocking);
+    if (m_chunks.end() == it) {
+        return 0;
+    }
+    // Copy whatever is available, up to numBytes, without waiting for more.
+    auto out = static_cast<uint8_t*>(buf);
+    auto end = std::min(m_writeOffset, m_readerCloseOffset);
+    size_t copied = 0;
+    for (; it != m_chunks.end() && copied < numBytes && m_readOffset < end; ++it) {
+        auto offsetInChunk = static_cast<size_t>(m_readOffset - it->offset);
+        auto size = std::min(
+            {numBytes - copied, it->data->size() - offsetInChunk, static_cast<size_t>(end - m_readOffset)});
+        std::memcpy(out + copied, it->data->data() + offsetInChunk, size);
+        copied += size;
+        m_readOffset += size;
+    }
+    trimLocked(false);
+    m_wakeTrigger.notify_all();
+    return copied;
+}
+
+bool AttachmentChunkBuffer::seek(uint64_t offset) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto oldestOffset = m_chunks.empty() ? m_writeOffset : m_chunks.front().offset;
+    if (m_readerClosed || offset < oldestOffset) {
+        return false;
+    }
+    m_readOffset = offset;
+    // Seeking forward may make room for the writer.
+    trimLocked(false);
+    m_wakeTrigger.notify_all();
+    return true;
+}
+
+uint64_t AttachmentChunkBuffer::getNumUnreadBytes() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_writeOffset > m_readOffset ? m_writeOffset - m_readOffset : 0;
+}
+
+void AttachmentChunkBuffer::closeReader(AttachmentReader::ClosePoint closePoint) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    switch (closePoint) {
+        case AttachmentReader::ClosePoint::IMMEDIATELY:
+            m_readerClosed = true;
+            m_chunks.clear();
+            m_bufferedBytes = 0;
+            break;
+        case AttachmentReader::ClosePoint::AFTER_DRAINING_CURRENT_BUFFER:
+            m_readerCloseOffset = std::min(m_readerCloseOffset, m_writeOffset);
+            break;
+    }
+    m_wakeTrigger.notify_all();
+}
+
+size_t AttachmentChunkBuffer::getBufferedBytes() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_bufferedBytes;
+}
+
+std::deque<AttachmentChunkBuffer::Chunk>::iterator AttachmentChunkBuffer::waitForDataLocked(
+    std::unique_lock<std::mutex>& lock,
+    AttachmentReader::ReadStatus* readStatus,
+    std::chrono::milliseconds timeout,
+    bool blocking) {
+    auto canProceed = [this] {
+        return m_readerClosed || m_readOffset >= m_readerCloseOffset || m_readOffset < m_writeOffset || m_writerClosed;
+    };
+    if (blocking && !canProceed()) {
+        if (std::chrono::milliseconds::zero() == timeout) {
+            m_wakeTrigger.wait(lock, canProceed);
+        } else if (!m_wakeTrigger.wait_for(lock, timeout, canProceed)) {
+            *readStatus = AttachmentReader::ReadStatus::OK_TIMEDOUT;
+            return m_chunks.end();
+        }
+    }
+
+    if (m_readerClosed || m_readOffset >= m_readerCloseOffset) {
+        *readStatus = AttachmentReader::ReadStatus::CLOSED;
+        return m_chunks.end();
+    }
+    if (m_readOffset >= m_writeOffset) {
+        *readStatus = m_writerClosed ? AttachmentReader::ReadStatus::CLOSED : AttachmentReader::ReadStatus::OK_WOULDBLOCK;
+        return m_chunks.end();
+    }
+    if (m_chunks.empty() || m_readOffset < m_chunks.front().offset) {
+        // The data at the read position was discarded by a NONBLOCKABLE writer.
+        *readStatus = AttachmentReader::ReadStatus::ERROR_OVERRUN;
+        return m_chunks.end();
+    }
+
+    *readStatus = AttachmentReader::ReadStatus::OK;
+    // Find the last chunk which starts at or before the read position.
+    auto it = std::upper_bound(
+        m_chunks.begin(), m_chunks.end(), m_readOffset, [](uint64_t offset, const Chunk& chunk) {
+            return offset < chunk.offset;
+        });
+    return --it;
+}
+
+uint64_t AttachmentChunkBuffer::unreadBytesLocked() const {
+    auto end = std::min(m_writeOffset, m_readerCloseOffset);
+    return end > m_readOffset ? end - m_readOffset : 0;
+}
+
+void AttachmentChunkBuffer::trimLocked(bool discardUnread) {
+    while (m_bufferedBytes > m_maxBufferedBytes && !m_chunks.empty()) {
+        auto& front = m_chunks.front();
+        auto frontSize = front.data->size();
+        if (!discardUnread && front.offset + frontSize > m_readOffset && front.offset < m_readerCloseOffset) {
+            // The reader has yet to read (part of) the front chunk, and so everything after it.
+            break;
+        }
+        m_bufferedBytes -= frontSize;
+        m_chunks.pop_front();
+    }
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
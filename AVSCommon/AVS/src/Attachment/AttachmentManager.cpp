@@ -15,6 +15,7 @@
 
 #include <vector>
 
+#include "AVSCommon/AVS/Attachment/ChunkedAttachment.h"
 #include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
 #include "AVSCommon/Utils/Logger/Logger.h"
 #include "AVSCommon/Utils/Memory/Memory.h"
@@ -46,6 +47,18 @@ constexpr std::chrono::minutes AttachmentManager::ATTACHMENT_MANAGER_TIMOUT_MINU
 // Used within generateAttachmentId().
 static const std::string ATTACHMENT_ID_COMBINING_SUBSTRING = ":";
 
+/// The key in our config file to find the root of the attachment manager configuration.
+static const std::string ATTACHMENT_MANAGER_CONFIGURATION_ROOT_KEY = "attachmentManager";
+
+/// The key in our config file to find the type of attachments to create.
+static const std::string ATTACHMENT_TYPE_KEY = "attachmentType";
+
+/// The configuration value selecting @c InProcessAttachment.
+static const std::string ATTACHMENT_TYPE_IN_PROCESS = "IN_PROCESS";
+
+/// The configuration value selecting @c ChunkedAttachment.
+static const std::string ATTACHMENT_TYPE_CHUNKED = "CHUNKED";
+
 AttachmentManager::AttachmentManagementDetails::AttachmentManagementDetails() :
         creationTime{std::chrono::steady_clock::now()} {
 }
@@ -54,6 +67,35 @@ std::shared_ptr<AttachmentManagerInterface> AttachmentManager::createInProcessAt
     return std::make_shared<AttachmentManager>(AttachmentType::IN_PROCESS);
 }
 
+std::shared_ptr<AttachmentManagerInterface> AttachmentManager::createChunkedAttachmentManagerInterface() {
+    return std::make_shared<AttachmentManager>(AttachmentType::CHUNKED);
+}
+
+std::shared_ptr<AttachmentManagerInterface> AttachmentManager::createAttachmentManagerInterfaceFromConfiguration(
+    const std::shared_ptr<configuration::ConfigurationNode>& configurationRoot) {
+    if (!configurationRoot) {
+        ACSDK_ERROR(LX("createFromConfigurationFailed").d("reason", "nullConfigurationRoot"));
+        return nullptr;
+    }
+
+    std::string attachmentType;
+    (*configurationRoot)[ATTACHMENT_MANAGER_CONFIGURATION_ROOT_KEY].getString(
+        ATTACHMENT_TYPE_KEY, &attachmentType, ATTACHMENT_TYPE_IN_PROCESS);
+
+    if (ATTACHMENT_TYPE_IN_PROCESS == attachmentType) {
+        return createInProcessAttachmentManagerInterface();
+    }
+    if (ATTACHMENT_TYPE_CHUNKED == attachmentType) {
+        ACSDK_INFO(LX("createFromConfiguration").d("attachmentType", attachmentType));
+        return createChunkedAttachmentManagerInterface();
+    }
+
+    ACSDK_ERROR(LX("createFromConfigurationFailed")
+                    .d("reason", "unknownAttachmentType")
+                    .d("attachmentType", attachmentType));
+    return nullptr;
+}
+
 AttachmentManager::AttachmentManager(AttachmentType attachmentType) :
         m_attachmentType{attachmentType},
         m_attachmentExpirationMinutes{ATTACHMENT_MANAGER_TIMOUT_MINUTES_DEFAULT} {
@@ -107,6 +149,11 @@ AttachmentManager::AttachmentManagementDetails& AttachmentManager::getDetailsLoc
                 details.attachment =
                     alexaClientSDK::avsCommon::utils::memory::make_unique<InProcessAttachment>(attachmentId);
                 break;
+            // The chunked attachment type.
+            case AttachmentType::CHUNKED:
+                details.attachment =
+                    alexaClientSDK::avsCommon::utils::memory::make_unique<ChunkedAttachment>(attachmentId);
+                break;
         }
 
         // In code compiled with no warnings, the following test should never pass.
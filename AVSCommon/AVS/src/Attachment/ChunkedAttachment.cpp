@@ -0,0 +1,54 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+#include "AVSCommon/AVS/Attachment/ChunkedAttachment.h"
+#include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+const size_t ChunkedAttachment::DEFAULT_MAX_BUFFERED_BYTES = InProcessAttachment::SDS_BUFFER_DEFAULT_SIZE_IN_BYTES;
+
+ChunkedAttachment::ChunkedAttachment(const std::string& id, size_t maxBufferedBytes) :
+        Attachment(id),
+        m_buffer{std::make_shared<AttachmentChunkBuffer>(maxBufferedBytes)} {
+}
+
+std::unique_ptr<AttachmentWriter> ChunkedAttachment::createWriter(utils::sds::WriterPolicy policy) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_hasCreatedWriter) {
+        return nullptr;
+    }
+    auto writer = ChunkedAttachmentWriter::create(m_buffer, policy);
+    if (writer) {
+        m_hasCreatedWriter = true;
+    }
+    return std::move(writer);
+}
+
+std::unique_ptr<AttachmentReader> ChunkedAttachment::createReader(utils::sds::ReaderPolicy policy) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto reader = ChunkedAttachmentReader::create(policy, m_buffer);
+    if (reader) {
+        ++m_numReaders;
+    }
+    return std::move(reader);
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,101 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentReader.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+using namespace utils::sds;
+
+/// String to identify log entries originating from this file.
+#define TAG "ChunkedAttachmentReader"
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param event The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+std::unique_ptr<ChunkedAttachmentReader> ChunkedAttachmentReader::create(
+    ReaderPolicy policy,
+    std::shared_ptr<AttachmentChunkBuffer> buffer) {
+    if (!buffer) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullBuffer"));
+        return nullptr;
+    }
+    if (!buffer->attachReader()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "readerAlreadyAttached"));
+        return nullptr;
+    }
+    return std::unique_ptr<ChunkedAttachmentReader>(new ChunkedAttachmentReader(policy, std::move(buffer)));
+}
+
+ChunkedAttachmentReader::ChunkedAttachmentReader(ReaderPolicy policy, std::shared_ptr<AttachmentChunkBuffer> buffer) :
+        m_blocking{ReaderPolicy::BLOCKING == policy},
+        m_buffer{std::move(buffer)} {
+}
+
+ChunkedAttachmentReader::~ChunkedAttachmentReader() {
+    close(ClosePoint::IMMEDIATELY);
+}
+
+std::size_t ChunkedAttachmentReader::read(
+    void* buf,
+    std::size_t numBytes,
+    ReadStatus* readStatus,
+    std::chrono::milliseconds timeoutMs) {
+    if (!readStatus) {
+        ACSDK_ERROR(LX("readFailed").d("reason", "nullReadStatus"));
+        return 0;
+    }
+    if (!buf) {
+        ACSDK_ERROR(LX("readFailed").d("reason", "nullBuffer"));
+        *readStatus = ReadStatus::ERROR_INTERNAL;
+        return 0;
+    }
+    return m_buffer->read(buf, numBytes, readStatus, timeoutMs, m_blocking);
+}
+
+AttachmentChunk ChunkedAttachmentReader::readChunk(
+    std::size_t maxBytes,
+    ReadStatus* readStatus,
+    std::chrono::milliseconds timeoutMs) {
+    if (!readStatus) {
+        ACSDK_ERROR(LX("readChunkFailed").d("reason", "nullReadStatus"));
+        return {nullptr, 0, 0};
+    }
+    return m_buffer->readChunk(maxBytes, readStatus, timeoutMs, m_blocking);
+}
+
+void ChunkedAttachmentReader::close(ClosePoint closePoint) {
+    m_buffer->closeReader(closePoint);
+}
+
+bool ChunkedAttachmentReader::seek(uint64_t offset) {
+    return m_buffer->seek(offset);
+}
+
+uint64_t ChunkedAttachmentReader::getNumUnreadBytes() {
+    return m_buffer->getNumUnreadBytes();
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,86 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentWriter.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+using namespace utils::sds;
+
+/// String to identify log entries originating from this file.
+#define TAG "ChunkedAttachmentWriter"
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param event The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+std::unique_ptr<ChunkedAttachmentWriter> ChunkedAttachmentWriter::create(
+    std::shared_ptr<AttachmentChunkBuffer> buffer,
+    WriterPolicy policy) {
+    if (!buffer) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullBuffer"));
+        return nullptr;
+    }
+    return std::unique_ptr<ChunkedAttachmentWriter>(new ChunkedAttachmentWriter(std::move(buffer), policy));
+}
+
+ChunkedAttachmentWriter::ChunkedAttachmentWriter(std::shared_ptr<AttachmentChunkBuffer> buffer, WriterPolicy policy) :
+        m_policy{policy},
+        m_buffer{std::move(buffer)} {
+}
+
+ChunkedAttachmentWriter::~ChunkedAttachmentWriter() {
+    close();
+}
+
+std::size_t ChunkedAttachmentWriter::write(
+    const void* buff,
+    std::size_t numBytes,
+    WriteStatus* writeStatus,
+    std::chrono::milliseconds timeout) {
+    if (!writeStatus) {
+        ACSDK_ERROR(LX("writeFailed").d("reason", "nullWriteStatus"));
+        return 0;
+    }
+    if (!m_buffer) {
+        ACSDK_ERROR(LX("writeFailed").d("reason", "writerClosed"));
+        *writeStatus = WriteStatus::CLOSED;
+        return 0;
+    }
+    if (!buff && numBytes > 0) {
+        ACSDK_ERROR(LX("writeFailed").d("reason", "nullBuffer"));
+        *writeStatus = WriteStatus::ERROR_INTERNAL;
+        return 0;
+    }
+    return m_buffer->write(buff, numBytes, writeStatus, m_policy, timeout);
+}
+
+void ChunkedAttachmentWriter::close() {
+    if (m_buffer) {
+        m_buffer->closeWriter();
+        m_buffer.reset();
+    }
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,79 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/AVS/ParsedPayload.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+
+using namespace rapidjson;
+using namespace utils::json::jsonUtils;
+
+/// String to identify log entries originating from this file.
+#define TAG "ParsedPayload"
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+std::shared_ptr<const ParsedPayload> ParsedPayload::create(const std::string& payload) {
+    auto document = std::make_shared<Document>();
+    if (!parseJSON(payload, document.get())) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "parseFailed"));
+        return nullptr;
+    }
+    if (!document->IsObject()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "notAnObject").d("type", document->GetType()));
+        return nullptr;
+    }
+    const Value& value = *document;
+    return std::shared_ptr<const ParsedPayload>(new ParsedPayload(std::move(document), value));
+}
+
+std::shared_ptr<const ParsedPayload> ParsedPayload::create(
+    std::shared_ptr<const Document> directive,
+    const Value& payload) {
+    if (!directive) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullDirective"));
+        return nullptr;
+    }
+    if (payload.IsString()) {
+        // The payload was sent as a string holding its JSON, as getPayload() accepts.
+        return create(std::string(payload.GetString(), payload.GetStringLength()));
+    }
+    if (!payload.IsObject()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "notAnObject").d("type", payload.GetType()));
+        return nullptr;
+    }
+    return std::shared_ptr<const ParsedPayload>(new ParsedPayload(std::move(directive), payload));
+}
+
+ParsedPayload::ParsedPayload(std::shared_ptr<const Document> document, const Value& value) :
+        m_document{std::move(document)},
+        m_value(value) {
+}
+
+const Value& ParsedPayload::getDocument() const {
+    return m_value;
+}
+
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -85,6 +85,48 @@ TEST(AVSContextTest, test_toJsonWithoutPropertyInstance) {
     EXPECT_EQ(json.find(R"("instance":)"), std::string::npos);
 }
 
+/// Test that the context is serialized as an array of property objects, skipping states without a value.
+TEST(AVSContextTest, test_toJsonFormat) {
+    CapabilityTag otherTag{"Namespace", "Other", "EndpointId", Optional<std::string>("Instance")};
+    CapabilityTag emptyTag{"Namespace", "Empty", "EndpointId"};
+    CapabilityState emptyState{""};
+    AVSContext context;
+    context.addState(CAPABILITY_TAG, CAPABILITY_STATE);
+    context.addState(otherTag, CAPABILITY_STATE);
+    context.addState(emptyTag, emptyState);
+
+    auto timeOfSample = CAPABILITY_STATE.timeOfSample.getTime_ISO_8601();
+    std::string nameJson = R"({"namespace":"Namespace","name":"Name","value":"Value","timeOfSample":")" +
+                           timeOfSample + R"(","uncertaintyInMilliseconds":0})";
+    std::string otherJson =
+        R"({"namespace":"Namespace","name":"Other","instance":"Instance","value":"Value","timeOfSample":")" +
+        timeOfSample + R"(","uncertaintyInMilliseconds":0})";
+    EXPECT_EQ(AVSContext::buildStateJson(CAPABILITY_TAG, CAPABILITY_STATE), nameJson);
+    EXPECT_EQ(AVSContext::buildStateJson(otherTag, CAPABILITY_STATE), otherJson);
+    EXPECT_TRUE(AVSContext::buildStateJson(emptyTag, emptyState).empty());
+
+    std::string expected = R"({"properties":[)" + nameJson + "," + otherJson + "]}";
+    EXPECT_EQ(context.toJson(), expected);
+    std::string emptyJson;
+    EXPECT_EQ(AVSContext::buildJson({&emptyJson, &nameJson, &otherJson}), expected);
+    EXPECT_EQ(AVSContext::buildJson({}), R"({"properties":[]})");
+}
+
+/// Test that a pre-serialized context returns its JSON until it is modified, and copies do not affect each other.
+TEST(AVSContextTest, test_preSerializedContext) {
+    AVSContext::States states{{CAPABILITY_TAG, CAPABILITY_STATE}};
+    std::string stateJson = AVSContext::buildStateJson(CAPABILITY_TAG, CAPABILITY_STATE);
+    AVSContext context{states, AVSContext::buildJson({&stateJson})};
+    AVSContext copy = context;
+    EXPECT_EQ(context.toJson(), copy.toJson());
+    EXPECT_EQ(copy.getStates().size(), 1u);
+
+    copy.removeState(CAPABILITY_TAG);
+    EXPECT_EQ(copy.toJson(), R"({"properties":[]})");
+    EXPECT_TRUE(context.getState(CAPABILITY_TAG).hasValue());
+    EXPECT_EQ(context.toJson(), AVSContext::buildJson({&stateJson}));
+}
+
 }  // namespace test
 }  // namespace avs
 }  // namespace avsCommon
@@ -17,6 +17,8 @@
 #include <gmock/gmock.h>
 
 #include "AVSCommon/AVS/AVSDirective.h"
+#include "AVSCommon/AVS/Attachment/AttachmentManager.h"
+#include "AVSCommon/AVS/ParsedPayload.h"
 #include "AVSCommon/Utils/Optional.h"
 
 namespace alexaClientSDK {
@@ -192,6 +194,92 @@ TEST(AVSDirectiveTest, test_getAttachementReaderCallIfAttachementManagerIsNullpt
     ASSERT_THAT(directive.getAttachmentReader("Token123", sds::ReaderPolicy::NONBLOCKING), IsNull());
 }
 
+TEST(AVSDirectiveTest, test_parsedPayloadSharedWithoutReparse) {
+    // clang-format off
+    std::string directiveJson = R"({
+    "directive": {
+        "header": {
+            "namespace": "Namespace",
+            "name": "Name",
+            "messageId": "Id"
+        },
+        "payload": {
+            "key":"value",
+            "number":42
+        }
+    }})";
+    // clang-format on
+    auto parseResult = AVSDirective::create(directiveJson, nullptr, "");
+    EXPECT_EQ(parseResult.second, AVSDirective::ParseStatus::SUCCESS);
+    ASSERT_THAT(parseResult.first, NotNull());
+
+    auto& directive = *parseResult.first;
+    auto payload = directive.getParsedPayload();
+    ASSERT_THAT(payload, NotNull());
+    ASSERT_TRUE(payload->getDocument().IsObject());
+    EXPECT_EQ(payload, directive.getParsedPayload());
+
+    std::string value;
+    EXPECT_TRUE(payload->retrieveValue("key", &value));
+    EXPECT_EQ(value, "value");
+    int64_t number = 0;
+    EXPECT_TRUE(payload->retrieveValue("number", &number));
+    EXPECT_EQ(number, 42);
+    EXPECT_FALSE(payload->retrieveValue("missing", &value));
+
+    // The parsed payload must outlive the directive.
+    parseResult.first.reset();
+    EXPECT_STREQ(payload->getDocument()["key"].GetString(), "value");
+}
+
+TEST(AVSDirectiveTest, test_parsedPayloadSentAsString) {
+    // clang-format off
+    std::string directiveJson = R"({
+    "directive": {
+        "header": {
+            "namespace": "Namespace",
+            "name": "Name",
+            "messageId": "Id"
+        },
+        "payload": "{\"key\":\"value\"}"
+    }})";
+    // clang-format on
+    auto parseResult = AVSDirective::create(directiveJson, nullptr, "");
+    EXPECT_EQ(parseResult.second, AVSDirective::ParseStatus::SUCCESS);
+    ASSERT_THAT(parseResult.first, NotNull());
+
+    auto payload = parseResult.first->getParsedPayload();
+    ASSERT_THAT(payload, NotNull());
+    ASSERT_TRUE(payload->getDocument().IsObject());
+    std::string value;
+    EXPECT_TRUE(payload->retrieveValue("key", &value));
+    EXPECT_EQ(value, "value");
+}
+
+TEST(AVSDirectiveTest, test_parsedPayloadFromPayloadString) {
+    auto header = std::make_shared<AVSMessageHeader>("Namespace", "Name", "Id");
+    auto attachmentManager =
+        std::make_shared<attachment::AttachmentManager>(attachment::AttachmentManager::AttachmentType::IN_PROCESS);
+    auto directive = AVSDirective::create("", header, R"({"key":"value"})", attachmentManager, "");
+    ASSERT_THAT(directive, NotNull());
+
+    auto payload = directive->getParsedPayload();
+    ASSERT_THAT(payload, NotNull());
+    std::string value;
+    EXPECT_TRUE(payload->retrieveValue("key", &value));
+    EXPECT_EQ(value, "value");
+    EXPECT_EQ(payload, directive->getParsedPayload());
+}
+
+TEST(AVSDirectiveTest, test_parsedPayloadFromInvalidPayloadString) {
+    auto header = std::make_shared<AVSMessageHeader>("Namespace", "Name", "Id");
+    auto attachmentManager =
+        std::make_shared<attachment::AttachmentManager>(attachment::AttachmentManager::AttachmentType::IN_PROCESS);
+    auto directive = AVSDirective::create("", header, "{invalid", attachmentManager, "");
+    ASSERT_THAT(directive, NotNull());
+    EXPECT_THAT(directive->getParsedPayload(), IsNull());
+}
+
 }  // namespace test
 }  // namespace avs
 }  // namespace avsCommon
@@ -16,13 +16,18 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <sstream>
+
 #include "AVSCommon/AVS/Attachment/AttachmentManager.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentReader.h"
 #include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
+#include "AVSCommon/Utils/Configuration/ConfigurationNode.h"
 
 #include "Common/Common.h"
 
 using namespace ::testing;
 using namespace alexaClientSDK::avsCommon::avs::attachment;
+using namespace alexaClientSDK::avsCommon::utils::configuration;
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -43,6 +48,10 @@ static const std::chrono::minutes TIMEOUT_REGULAR = std::chrono::minutes(60);
 static const std::chrono::minutes TIMEOUT_ZERO = std::chrono::minutes(0);
 /// A test negative timeout.
 static const std::chrono::minutes TIMEOUT_NEGATIVE = std::chrono::minutes(-1);
+/// A configuration selecting chunked attachments.
+static const std::string CHUNKED_ATTACHMENT_CONFIGURATION = R"({"attachmentManager":{"attachmentType":"CHUNKED"}})";
+/// A configuration selecting an unknown attachment type.
+static const std::string UNKNOWN_ATTACHMENT_CONFIGURATION = R"({"attachmentManager":{"attachmentType":"UNKNOWN"}})";
 
 /**
  * A class which helps drive this unit test suite.
@@ -292,6 +301,61 @@ TEST_F(AttachmentManagerTest, test_attachmentWriterAndReaderInOnePass) {
     }
 }
 
+/**
+ * Initializes the root configuration with the given JSON string.
+ *
+ * @param jsonConfiguration The configuration string.
+ * @return The root configuration node, or @c nullptr if the configuration could not be initialized.
+ */
+static std::shared_ptr<ConfigurationNode> initializeConfiguration(const std::string& jsonConfiguration) {
+    ConfigurationNode::uninitialize();
+    std::vector<std::shared_ptr<std::istream>> jsonStream;
+    jsonStream.push_back(std::make_shared<std::stringstream>(jsonConfiguration));
+    if (!ConfigurationNode::initialize(jsonStream)) {
+        return nullptr;
+    }
+    return ConfigurationNode::createRoot();
+}
+
+/**
+ * Test that the configuration factory creates IN_PROCESS attachments when no attachment type is configured.
+ */
+TEST_F(AttachmentManagerTest, test_createFromConfigurationDefaultsToInProcess) {
+    auto manager = AttachmentManager::createAttachmentManagerInterfaceFromConfiguration(initializeConfiguration("{}"));
+    ASSERT_NE(manager, nullptr);
+
+    auto reader = manager->createReader(TEST_ATTACHMENT_ID_STRING_ONE, utils::sds::ReaderPolicy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    EXPECT_EQ(dynamic_cast<ChunkedAttachmentReader*>(reader.get()), nullptr);
+    ConfigurationNode::uninitialize();
+}
+
+/**
+ * Test that the configuration factory creates CHUNKED attachments when they are configured.
+ */
+TEST_F(AttachmentManagerTest, test_createFromConfigurationSelectsChunked) {
+    auto manager = AttachmentManager::createAttachmentManagerInterfaceFromConfiguration(
+        initializeConfiguration(CHUNKED_ATTACHMENT_CONFIGURATION));
+    ASSERT_NE(manager, nullptr);
+
+    auto reader = manager->createReader(TEST_ATTACHMENT_ID_STRING_ONE, utils::sds::ReaderPolicy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    EXPECT_NE(dynamic_cast<ChunkedAttachmentReader*>(reader.get()), nullptr);
+    ConfigurationNode::uninitialize();
+}
+
+/**
+ * Test that the configuration factory fails for an unknown attachment type or a null configuration.
+ */
+TEST_F(AttachmentManagerTest, test_createFromConfigurationFailsForInvalidConfiguration) {
+    EXPECT_EQ(
+        AttachmentManager::createAttachmentManagerInterfaceFromConfiguration(
+            initializeConfiguration(UNKNOWN_ATTACHMENT_CONFIGURATION)),
+        nullptr);
+    EXPECT_EQ(AttachmentManager::createAttachmentManagerInterfaceFromConfiguration(nullptr), nullptr);
+    ConfigurationNode::uninitialize();
+}
+
 }  // namespace test
 }  // namespace avs
 }  // namespace avsCommon
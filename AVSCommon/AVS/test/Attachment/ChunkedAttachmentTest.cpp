@@ -0,0 +1,399 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/AVS/Attachment/ChunkedAttachment.h"
+#include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
+
+#include "Common/Common.h"
+
+using namespace ::testing;
+using namespace alexaClientSDK::avsCommon::avs::attachment;
+using namespace alexaClientSDK::avsCommon::utils::sds;
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace test {
+
+/// The limit on buffered data used by these tests.
+static const size_t TEST_MAX_BUFFERED_BYTES = TEST_SDS_BUFFER_SIZE_IN_BYTES;
+
+/// How long a blocking call is expected to wait in these tests.
+static const std::chrono::milliseconds SHORT_TIMEOUT_MS(50);
+
+/**
+ * A class which helps drive this unit test suite.
+ */
+class ChunkedAttachmentTest : public ::testing::Test {
+public:
+    /**
+     * Constructor.
+     */
+    ChunkedAttachmentTest() :
+            m_buffer{std::make_shared<AttachmentChunkBuffer>(TEST_MAX_BUFFERED_BYTES)},
+            m_pattern{createTestPattern(TEST_SDS_BUFFER_SIZE_IN_BYTES)} {
+    }
+
+    /**
+     * Create a reader and a writer on @c m_buffer.
+     *
+     * @param readerPolicy The policy of the reader.
+     * @param writerPolicy The policy of the writer.
+     */
+    void init(
+        ReaderPolicy readerPolicy = ReaderPolicy::NONBLOCKING,
+        WriterPolicy writerPolicy = WriterPolicy::ALL_OR_NOTHING);
+
+    /**
+     * Write @c numBytes bytes of @c m_pattern, starting at @c offset, and expect the write to succeed.
+     *
+     * @param offset The offset into @c m_pattern of the data to write.
+     * @param numBytes The number of bytes to write.
+     */
+    void writePattern(size_t offset, size_t numBytes);
+
+    /// The buffer shared by @c m_reader and @c m_writer.
+    std::shared_ptr<AttachmentChunkBuffer> m_buffer;
+
+    /// The reader under test.
+    std::unique_ptr<ChunkedAttachmentReader> m_reader;
+
+    /// The writer under test.
+    std::unique_ptr<ChunkedAttachmentWriter> m_writer;
+
+    /// The data written by the tests.
+    std::vector<uint8_t> m_pattern;
+};
+
+void ChunkedAttachmentTest::init(ReaderPolicy readerPolicy, WriterPolicy writerPolicy) {
+    m_reader = ChunkedAttachmentReader::create(readerPolicy, m_buffer);
+    ASSERT_NE(m_reader, nullptr);
+    m_writer = ChunkedAttachmentWriter::create(m_buffer, writerPolicy);
+    ASSERT_NE(m_writer, nullptr);
+}
+
+void ChunkedAttachmentTest::writePattern(size_t offset, size_t numBytes) {
+    auto status = AttachmentWriter::WriteStatus::CLOSED;
+    ASSERT_EQ(m_writer->write(m_pattern.data() + offset, numBytes, &status), numBytes);
+    ASSERT_EQ(status, AttachmentWriter::WriteStatus::OK);
+}
+
+/**
+ * Verify that a @c ChunkedAttachment hands out one writer and one reader.
+ */
+TEST_F(ChunkedAttachmentTest, test_createReaderAndWriter) {
+    ChunkedAttachment attachment(TEST_ATTACHMENT_ID_STRING_ONE);
+    EXPECT_EQ(attachment.getId(), TEST_ATTACHMENT_ID_STRING_ONE);
+    EXPECT_NE(attachment.createWriter(), nullptr);
+    EXPECT_EQ(attachment.createWriter(), nullptr);
+    EXPECT_TRUE(attachment.hasCreatedWriter());
+    EXPECT_NE(attachment.createReader(ReaderPolicy::NONBLOCKING), nullptr);
+    EXPECT_EQ(attachment.createReader(ReaderPolicy::NONBLOCKING), nullptr);
+    EXPECT_TRUE(attachment.hasCreatedReader());
+}
+
+/**
+ * Verify that data written in several writes is read back in order, across chunk boundaries.
+ */
+TEST_F(ChunkedAttachmentTest, test_writeThenRead) {
+    init();
+    writePattern(0, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    writePattern(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    EXPECT_EQ(m_reader->getNumUnreadBytes(), 2u * TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+
+    std::vector<uint8_t> result(TEST_SDS_BUFFER_SIZE_IN_BYTES);
+    auto status = AttachmentReader::ReadStatus::CLOSED;
+    auto numRead = m_reader->read(result.data(), result.size(), &status);
+    ASSERT_EQ(numRead, 2u * TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::OK);
+    EXPECT_EQ(0, std::memcmp(result.data(), m_pattern.data(), numRead));
+
+    EXPECT_EQ(m_reader->read(result.data(), result.size(), &status), 0u);
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::OK_WOULDBLOCK);
+
+    m_writer->close();
+    EXPECT_EQ(m_reader->read(result.data(), result.size(), &status), 0u);
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::CLOSED);
+}
+
+/**
+ * Verify that @c readChunk() returns references to the written chunks rather than copies of them.
+ */
+TEST_F(ChunkedAttachmentTest, test_readChunkDoesNotCopy) {
+    init();
+    writePattern(0, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    writePattern(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+
+    auto status = AttachmentReader::ReadStatus::CLOSED;
+    auto first = m_reader->readChunk(TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES / 2, &status);
+    ASSERT_EQ(status, AttachmentReader::ReadStatus::OK);
+    ASSERT_NE(first.data, nullptr);
+    EXPECT_EQ(first.offset, 0u);
+    EXPECT_EQ(first.size, static_cast<size_t>(TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES / 2));
+
+    // The rest of the first chunk comes from the same block, and a read never spans two chunks.
+    auto second = m_reader->readChunk(TEST_SDS_BUFFER_SIZE_IN_BYTES, &status);
+    ASSERT_EQ(status, AttachmentReader::ReadStatus::OK);
+    EXPECT_EQ(second.data, first.data);
+    EXPECT_EQ(second.offset, first.size);
+    EXPECT_EQ(second.size, static_cast<size_t>(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES) - first.size);
+
+    auto third = m_reader->readChunk(TEST_SDS_BUFFER_SIZE_IN_BYTES, &status);
+    ASSERT_EQ(status, AttachmentReader::ReadStatus::OK);
+    ASSERT_NE(third.data, nullptr);
+    EXPECT_NE(third.data, first.data);
+    EXPECT_EQ(third.size, static_cast<size_t>(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES));
+    EXPECT_EQ(0, std::memcmp(third.data->data(), m_pattern.data() + TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES, third.size));
+
+    auto empty = m_reader->readChunk(TEST_SDS_BUFFER_SIZE_IN_BYTES, &status);
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::OK_WOULDBLOCK);
+    EXPECT_EQ(empty.data, nullptr);
+    EXPECT_EQ(empty.size, 0u);
+}
+
+/**
+ * Verify that an @c ALL_OR_NOTHING writer is held back while the unread data would exceed the limit, and may write
+ * again once data has been read.
+ */
+TEST_F(ChunkedAttachmentTest, test_allOrNothingWriterBackpressure) {
+    init();
+    writePattern(0, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    writePattern(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    EXPECT_EQ(m_writer->write(m_pattern.data(), TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES, &writeStatus), 0u);
+    EXPECT_EQ(writeStatus, AttachmentWriter::WriteStatus::OK_BUFFER_FULL);
+
+    auto readStatus = AttachmentReader::ReadStatus::CLOSED;
+    auto chunk = m_reader->readChunk(TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES, &readStatus);
+    ASSERT_EQ(chunk.size, static_cast<size_t>(TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES));
+
+    writePattern(0, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+}
+
+/**
+ * Verify that a @c BLOCKING writer waits for the reader to make room, and times out if it does not.
+ */
+TEST_F(ChunkedAttachmentTest, test_blockingWriterWaitsForReader) {
+    init(ReaderPolicy::NONBLOCKING, WriterPolicy::BLOCKING);
+    writePattern(0, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    writePattern(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    EXPECT_EQ(
+        m_writer->write(m_pattern.data(), TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES, &writeStatus, SHORT_TIMEOUT_MS), 0u);
+    EXPECT_EQ(writeStatus, AttachmentWriter::WriteStatus::TIMEDOUT);
+
+    std::thread readerThread([this] {
+        std::this_thread::sleep_for(SHORT_TIMEOUT_MS);
+        auto readStatus = AttachmentReader::ReadStatus::CLOSED;
+        m_reader->readChunk(TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES, &readStatus);
+    });
+    writePattern(0, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    readerThread.join();
+}
+
+/**
+ * Verify that a @c BLOCKING reader waits for data and is woken up when the writer closes.
+ */
+TEST_F(ChunkedAttachmentTest, test_blockingReaderWaitsForData) {
+    init(ReaderPolicy::BLOCKING);
+    auto status = AttachmentReader::ReadStatus::CLOSED;
+    auto chunk = m_reader->readChunk(TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES, &status, SHORT_TIMEOUT_MS);
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::OK_TIMEDOUT);
+    EXPECT_EQ(chunk.data, nullptr);
+
+    std::thread writerThread([this] {
+        std::this_thread::sleep_for(SHORT_TIMEOUT_MS);
+        writePattern(0, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+        m_writer->close();
+    });
+    chunk = m_reader->readChunk(TEST_SDS_BUFFER_SIZE_IN_BYTES, &status);
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::OK);
+    EXPECT_EQ(chunk.size, static_cast<size_t>(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES));
+    chunk = m_reader->readChunk(TEST_SDS_BUFFER_SIZE_IN_BYTES, &status);
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::CLOSED);
+    writerThread.join();
+}
+
+/**
+ * Verify that the reader can seek back to data it has read while that data is within the limit, but not once it has
+ * been released.
+ */
+TEST_F(ChunkedAttachmentTest, test_seekWithinWindow) {
+    init();
+    writePattern(0, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    std::vector<uint8_t> result(TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES);
+    auto status = AttachmentReader::ReadStatus::CLOSED;
+    ASSERT_EQ(m_reader->read(result.data(), result.size(), &status), result.size());
+
+    ASSERT_TRUE(m_reader->seek(10));
+    EXPECT_EQ(m_reader->getNumUnreadBytes(), TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES - 10u);
+    ASSERT_EQ(m_reader->read(result.data(), 20, &status), 20u);
+    EXPECT_EQ(0, std::memcmp(result.data(), m_pattern.data() + 10, 20));
+
+    // Reading past the limit releases the first chunk.
+    ASSERT_TRUE(m_reader->seek(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES));
+    writePattern(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    writePattern(0, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    EXPECT_FALSE(m_reader->seek(0));
+    EXPECT_TRUE(m_reader->seek(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES));
+}
+
+/**
+ * Verify that a @c NONBLOCKABLE writer discards unread data, which the reader reports as an overrun.
+ */
+TEST_F(ChunkedAttachmentTest, test_nonBlockableWriterOverrunsReader) {
+    init(ReaderPolicy::NONBLOCKING, WriterPolicy::NONBLOCKABLE);
+    for (int i = 0; i < 3; ++i) {
+        writePattern(0, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    }
+    EXPECT_LE(m_buffer->getBufferedBytes(), TEST_MAX_BUFFERED_BYTES);
+
+    auto status = AttachmentReader::ReadStatus::CLOSED;
+    auto chunk = m_reader->readChunk(TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES, &status);
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::ERROR_OVERRUN);
+    EXPECT_EQ(chunk.data, nullptr);
+
+    ASSERT_TRUE(m_reader->seek(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES));
+    chunk = m_reader->readChunk(TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES, &status);
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::OK);
+}
+
+/**
+ * Verify the close points of the reader, and that a writer keeps succeeding after the reader has gone away.
+ */
+TEST_F(ChunkedAttachmentTest, test_readerClose) {
+    init();
+    writePattern(0, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    m_reader->close(AttachmentReader::ClosePoint::AFTER_DRAINING_CURRENT_BUFFER);
+    writePattern(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+
+    auto status = AttachmentReader::ReadStatus::CLOSED;
+    auto chunk = m_reader->readChunk(TEST_SDS_BUFFER_SIZE_IN_BYTES, &status);
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::OK);
+    EXPECT_EQ(chunk.size, static_cast<size_t>(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES));
+    m_reader->readChunk(TEST_SDS_BUFFER_SIZE_IN_BYTES, &status);
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::CLOSED);
+
+    m_reader->close(AttachmentReader::ClosePoint::IMMEDIATELY);
+    EXPECT_EQ(m_buffer->getBufferedBytes(), 0u);
+    for (int i = 0; i < 4; ++i) {
+        writePattern(0, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    }
+    EXPECT_EQ(m_buffer->getBufferedBytes(), 0u);
+
+    m_writer->close();
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    EXPECT_EQ(m_writer->write(m_pattern.data(), 1, &writeStatus), 0u);
+    EXPECT_EQ(writeStatus, AttachmentWriter::WriteStatus::CLOSED);
+}
+
+/**
+ * Verify that the memory held by the buffer stays within the limit while data streams through it, and that chunks
+ * handed out by @c readChunk() stay valid after the buffer has released them.
+ */
+TEST_F(ChunkedAttachmentTest, test_memoryIsReleasedAfterRead) {
+    init();
+    AttachmentChunk firstChunk{nullptr, 0, 0};
+    auto status = AttachmentReader::ReadStatus::CLOSED;
+    for (int i = 0; i < 10; ++i) {
+        writePattern(0, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+        auto chunk = m_reader->readChunk(TEST_SDS_BUFFER_SIZE_IN_BYTES, &status);
+        ASSERT_EQ(chunk.size, static_cast<size_t>(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES));
+        if (!firstChunk.data) {
+            firstChunk = chunk;
+        }
+        EXPECT_LE(m_buffer->getBufferedBytes(), TEST_MAX_BUFFERED_BYTES + TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    }
+    EXPECT_EQ(firstChunk.data.use_count(), 1);
+    EXPECT_EQ(0, std::memcmp(firstChunk.data->data(), m_pattern.data(), firstChunk.size));
+}
+
+/**
+ * Compare streaming attachments through an @c InProcessAttachment, copying the data out of it as a media pipeline
+ * would, with streaming them through a @c ChunkedAttachment and taking references to the chunks.
+ */
+TEST_F(ChunkedAttachmentTest, testSlow_streamingCostComparedToInProcessAttachment) {
+    // A short clip and roughly a minute of TTS audio, written in pieces of the size of an HTTP/2 DATA frame.
+    const std::vector<size_t> attachmentSizes = {64 * 1024, 8 * 1024 * 1024};
+    const size_t writeSize = 16 * 1024;
+    const size_t readSize = 4096;
+    std::vector<uint8_t> data(writeSize, 0x5a);
+    std::vector<uint8_t> mediaBuffer(readSize);
+    auto toUs = [](std::chrono::steady_clock::duration duration) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    };
+
+    for (auto totalBytes : attachmentSizes) {
+        auto startTime = std::chrono::steady_clock::now();
+        size_t inProcessCopies = 0;
+        {
+            InProcessAttachment attachment(TEST_ATTACHMENT_ID_STRING_ONE);
+            auto writer = attachment.createWriter();
+            auto reader = attachment.createReader(ReaderPolicy::NONBLOCKING);
+            auto writeStatus = AttachmentWriter::WriteStatus::OK;
+            auto readStatus = AttachmentReader::ReadStatus::OK;
+            for (size_t written = 0; written < totalBytes; written += writeSize) {
+                ASSERT_EQ(writer->write(data.data(), writeSize, &writeStatus), writeSize);
+                ++inProcessCopies;
+                while (reader->read(mediaBuffer.data(), readSize, &readStatus) > 0) {
+                    ++inProcessCopies;
+                }
+            }
+        }
+        auto inProcessDuration = std::chrono::steady_clock::now() - startTime;
+
+        startTime = std::chrono::steady_clock::now();
+        size_t chunkedCopies = 0;
+        size_t chunkedPeakBytes = 0;
+        {
+            auto buffer = std::make_shared<AttachmentChunkBuffer>(ChunkedAttachment::DEFAULT_MAX_BUFFERED_BYTES);
+            auto writer = ChunkedAttachmentWriter::create(buffer);
+            auto reader = ChunkedAttachmentReader::create(ReaderPolicy::NONBLOCKING, buffer);
+            auto writeStatus = AttachmentWriter::WriteStatus::OK;
+            auto readStatus = AttachmentReader::ReadStatus::OK;
+            for (size_t written = 0; written < totalBytes; written += writeSize) {
+                ASSERT_EQ(writer->write(data.data(), writeSize, &writeStatus), writeSize);
+                ++chunkedCopies;
+                chunkedPeakBytes = std::max(chunkedPeakBytes, buffer->getBufferedBytes());
+                while (reader->readChunk(writeSize, &readStatus).data) {
+                }
+            }
+        }
+        auto chunkedDuration = std::chrono::steady_clock::now() - startTime;
+
+        std::cout << "Streaming " << totalBytes << " bytes in " << writeSize << " byte writes:" << std::endl
+                  << "  InProcessAttachment: " << toUs(inProcessDuration) << " us, " << inProcessCopies
+                  << " copies, " << InProcessAttachment::SDS_BUFFER_DEFAULT_SIZE_IN_BYTES << " bytes buffered"
+                  << std::endl
+                  << "  ChunkedAttachment:   " << toUs(chunkedDuration) << " us, " << chunkedCopies << " copies, "
+                  << chunkedPeakBytes << " bytes buffered at most" << std::endl;
+        EXPECT_LT(chunkedCopies, inProcessCopies);
+        EXPECT_LE(chunkedPeakBytes, ChunkedAttachment::DEFAULT_MAX_BUFFERED_BYTES + writeSize);
+    }
+}
+
+}  // namespace test
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -18,6 +18,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -233,8 +234,75 @@ public:
         const std::string& componentName,
         const std::string& tableName,
         std::unordered_map<std::string, std::string>* valueContainer) = 0;
+
+    /**
+     * Gets the values associated with several keys in the table.  Keys which have no entry in the table are left out
+     * of @c values.
+     *
+     * @note The default implementation calls @c get() for each key.  Implementations should override it to read all
+     * the keys in one operation.
+     *
+     * @param componentName The component name.
+     * @param tableName The table name.
+     * @param keys The keys for the table entries.
+     * @param [out] values The container which receives the key/value pairs that were found.
+     * @return @c true If the values were found out ok, @c false if not.
+     */
+    virtual bool getMany(
+        const std::string& componentName,
+        const std::string& tableName,
+        const std::vector<std::string>& keys,
+        std::unordered_map<std::string, std::string>* values);
+
+    /**
+     * Puts several values in the table.  Each entry is added if its key doesn't already exist, or updated if it does.
+     *
+     * @note The default implementation calls @c put() for each entry, so the entries before a failing one remain
+     * stored.  Implementations should override it to store all the entries atomically.
+     *
+     * @param componentName The component name.
+     * @param tableName The table name.
+     * @param entries The key/value pairs of the table entries.
+     * @return @c true If all the values were put ok, @c false if not.
+     */
+    virtual bool putMany(
+        const std::string& componentName,
+        const std::string& tableName,
+        const std::unordered_map<std::string, std::string>& entries);
 };
 
+inline bool MiscStorageInterface::getMany(
+    const std::string& componentName,
+    const std::string& tableName,
+    const std::vector<std::string>& keys,
+    std::unordered_map<std::string, std::string>* values) {
+    if (!values) {
+        return false;
+    }
+    for (const auto& key : keys) {
+        std::string value;
+        if (!get(componentName, tableName, key, &value)) {
+            return false;
+        }
+        if (!value.empty()) {
+            (*values)[key] = value;
+        }
+    }
+    return true;
+}
+
+inline bool MiscStorageInterface::putMany(
+    const std::string& componentName,
+    const std::string& tableName,
+    const std::unordered_map<std::string, std::string>& entries) {
+    for (const auto& entry : entries) {
+        if (!put(componentName, tableName, entry.first, entry.second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 }  // namespace storage
 }  // namespace sdkInterfaces
 }  // namespace avsCommon
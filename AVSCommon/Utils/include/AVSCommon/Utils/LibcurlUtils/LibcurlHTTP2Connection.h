@@ -16,6 +16,7 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_LIBCURLHTTP2CONNECTION_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_LIBCURLHTTP2CONNECTION_H_
 
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <map>
@@ -60,6 +61,9 @@ public:
     /// @}
 
 protected:
+    /// Timeout for curl_multi_wait while there are streams expected to transfer continuously or paused streams.
+    static const std::chrono::milliseconds WAIT_FOR_ACTIVITY_TIMEOUT;
+
     /**
      * Constructor.
      *
@@ -130,10 +134,31 @@ protected:
     bool areStreamsPaused();
 
     /**
-     * UnPause all the active streams.
+     * Determine how long the network loop may wait for activity on the multi-handle. The regular timeout applies
+     * while there are streams expected to transfer continuously or paused streams; otherwise the loop may sleep
+     * longer, bounded by the earliest progress timeout of the active streams.
+     *
+     * @return The timeout to use for the next poll of the multi-handle.
+     */
+    std::chrono::milliseconds getPollTimeout();
+
+    /**
+     * UnPause the active streams that have been paused.
      */
     void unPauseActiveStreams();
 
+    /**
+     * Wake up the network loop, interrupting any wait for activity or paused-streams wait in progress.
+     */
+    void wakeupNetworkLoop();
+
+    /**
+     * Wait until the network loop is woken up, a request is queued, the loop is stopping or @c timeout elapses.
+     *
+     * @param timeout The maximum amount of time to wait.
+     */
+    void waitForWakeup(std::chrono::milliseconds timeout);
+
     /**
      * Cancel an active stream and report CANCELLED completion status.
      *
@@ -203,6 +228,10 @@ protected:
     /// Set to true when we want to exit the network loop.
     bool m_isStopping;
 
+    /// Set to true when the network loop has been woken up and should not wait for paused streams. Serialized by
+    /// @c m_mutex.
+    bool m_isWakeupRequested;
+
     /// The @c LibcurlSetCurlOptionsCallbackInterface used for this connection.
     std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface> m_setCurlOptionsCallback;
 };
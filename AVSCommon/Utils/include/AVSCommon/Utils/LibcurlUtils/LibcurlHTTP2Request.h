@@ -18,7 +18,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <memory>
+#include <mutex>
 
 #include <AVSCommon/Utils/HTTP2/HTTP2RequestConfig.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2RequestInterface.h>
@@ -111,6 +113,22 @@ public:
      */
     bool isCancelled() const;
 
+    /**
+     * Return how long this request may go without any progress before @c hasProgressTimedOut() returns true.
+     *
+     * @return The time remaining until the progress timeout, zero if it has already elapsed, or
+     * @c std::chrono::milliseconds::max() if no progress timeout applies to this request.
+     */
+    std::chrono::milliseconds getTimeUntilProgressTimeout() const;
+
+    /**
+     * Set the callback used to wake up the network loop that owns this request, for instance so that a call to
+     * @c cancel() is processed right away instead of on the next periodic pass of the loop.
+     *
+     * @param wakeupCallback The callback to invoke, or @c nullptr to detach this request from its network loop.
+     */
+    void setWakeupCallback(std::function<void()> wakeupCallback);
+
 private:
     /**
      * Callback that gets executed when data is received.
@@ -192,6 +210,12 @@ private:
 
     /// Connect timeout.
     std::chrono::milliseconds m_connectTimeout;
+
+    /// Serializes access to @c m_wakeupCallback.
+    std::mutex m_wakeupCallbackMutex;
+
+    /// Callback used to wake up the network loop that owns this request.
+    std::function<void()> m_wakeupCallback;
 };
 
 void LibcurlHTTP2Request::setTimeOfLastTransfer() {
@@ -0,0 +1,188 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCLOGGER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCLOGGER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Threading/PerThreadRingBuffers.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * A @c Logger which takes formatting and output off the logging thread.  @c emit() copies the level, time, thread
+ * moniker and text of an entry as a binary record into a ring buffer owned by the calling thread, without taking any
+ * lock, and a background thread drains the ring buffers and forwards the entries to a downstream @c Logger (for
+ * instance the @c ConsoleLogger).
+ *
+ * Every thread which logs gets its own single producer / single consumer ring buffer of a fixed size, so memory use is
+ * bounded.  When a ring buffer is full, entries are dropped rather than blocking the logging thread; dropped entries
+ * are counted, and the count is reported through the downstream @c Logger once there is room again.
+ *
+ * Entries are forwarded in order for each thread.  Entries from different threads may be interleaved differently
+ * than they were logged.
+ *
+ * To install it, pass it to @c LoggerSinkManager::initialize():
+ *
+ *     auto asyncLogger = AsyncLogger::create(getConsoleLogger());
+ *     LoggerSinkManager::instance().initialize(asyncLogger);
+ *     AsyncLogger::installCrashHandler(asyncLogger);
+ */
+class AsyncLogger : public Logger {
+public:
+    /// Default size in bytes of each per-thread ring buffer.
+    static const size_t DEFAULT_RING_BUFFER_SIZE;
+
+    /**
+     * Create an @c AsyncLogger.
+     *
+     * @param sink The @c Logger to forward entries to.
+     * @param ringBufferSize The size in bytes of each per-thread ring buffer.  Rounded up to a power of two.
+     * @return The new @c AsyncLogger, or @c nullptr if @c sink is @c nullptr.
+     */
+    static std::shared_ptr<AsyncLogger> create(
+        std::shared_ptr<Logger> sink,
+        size_t ringBufferSize = DEFAULT_RING_BUFFER_SIZE);
+
+    /**
+     * Destructor.  Forwards all buffered entries before returning.
+     */
+    ~AsyncLogger() override;
+
+    void emit(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
+        override;
+
+    /**
+     * Synchronously forward all entries which have been buffered so far.
+     */
+    void flush();
+
+    /**
+     * Get the number of entries which were dropped because a ring buffer was full.
+     *
+     * @return The number of dropped entries.
+     */
+    uint64_t getDroppedCount() const;
+
+    /**
+     * Install handlers for fatal signals (@c SIGSEGV, @c SIGBUS, @c SIGILL, @c SIGFPE and @c SIGABRT) which write
+     * the entries buffered by @c logger to standard error before the process terminates, so that the log lines leading
+     * up to a crash are not lost.
+     *
+     * @param logger The logger to flush on a crash.  Only one logger can be registered at a time; passing
+     *     @c nullptr unregisters it.
+     */
+    static void installCrashHandler(std::shared_ptr<AsyncLogger> logger);
+
+    /**
+     * Install handlers for fatal signals (@c SIGSEGV, @c SIGBUS, @c SIGILL, @c SIGFPE and @c SIGABRT) which write
+     * the entries buffered by @c logger to @c fd before the process terminates.
+     *
+     * The handlers bypass the downstream @c Logger and write the entries with @c write(2), without timestamps.
+     * Flushing from a signal handler is best effort: it is skipped if any of the locks it needs is held, for instance
+     * because the background thread is in the middle of forwarding entries or the crashing thread held it.
+     *
+     * @param logger The logger to flush on a crash.  Only one logger can be registered at a time; passing
+     *     @c nullptr unregisters it.
+     * @param fd An open file descriptor to write the entries to.  It must stay open while the handlers are installed.
+     */
+    static void installCrashHandler(std::shared_ptr<AsyncLogger> logger, int fd);
+
+private:
+    /// Forward declaration of the per-thread ring buffer.
+    class RingBuffer;
+
+    /**
+     * Constructor.
+     *
+     * @param sink The @c Logger to forward entries to.
+     * @param ringBufferSize The size in bytes of each per-thread ring buffer.
+     */
+    AsyncLogger(std::shared_ptr<Logger> sink, size_t ringBufferSize);
+
+    /// The loop of the background thread.
+    void drainLoop();
+
+    /**
+     * Forward the entries of all ring buffers to the sink.  Must be called with @c m_drainMutex held.
+     *
+     * @return Whether any entries were forwarded.
+     */
+    bool drainLocked();
+
+    /// Wake up the background thread if it is waiting for entries.
+    void wakeDrainThread();
+
+    /**
+     * Handler for fatal signals installed by @c installCrashHandler().
+     *
+     * @param signal The signal which was raised.
+     */
+    static void onFatalSignal(int signal);
+
+    /// The @c Logger to forward entries to.
+    std::shared_ptr<Logger> m_sink;
+
+    /// The ring buffers of all threads which have logged through this logger.
+    threading::PerThreadRingBuffers<RingBuffer> m_ringBuffers;
+
+    /// Serializes draining between the background thread, @c flush() and the crash handler.
+    std::mutex m_drainMutex;
+
+    /// Number of dropped entries which have already been reported to the sink.
+    uint64_t m_reportedDrops;
+
+    /// Reused storage for the thread moniker of the entry being forwarded.
+    std::string m_threadMonikerScratch;
+
+    /// Reused storage for the text of the entry being forwarded.
+    std::string m_textScratch;
+
+    /// Whether the background thread is waiting for entries.
+    std::atomic<bool> m_drainThreadIdle;
+
+    /// Whether the background thread should exit.
+    bool m_stop;
+
+    /// Protects @c m_stop and is used with @c m_wakeCondition.
+    std::mutex m_wakeMutex;
+
+    /// Condition variable used to wake up the background thread.
+    std::condition_variable m_wakeCondition;
+
+    /// The background thread.
+    std::thread m_drainThread;
+
+    /// Friend class for member access.
+    friend class AsyncLoggerTestHelper;
+};
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCLOGGER_H_
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <AVSCommon/Utils/SDKConfig.h>
 
 #include "AVSCommon/Utils/Logger/Level.h"
 #include "AVSCommon/Utils/Logger/LogEntry.h"
@@ -59,11 +60,30 @@
  */
 #define ACSDK_CONCATENATE(lhs, rhs) ACSDK_CONCATENATE_INNER(lhs, rhs)
 
+/**
+ * The lowest severity, as the integer value of a @c Level, for which the ACSDK_<LEVEL> macros generate code.  Log
+ * lines of lower severity are compiled out regardless of the log level set at runtime.  This is set with the
+ * @c ACSDK_LOG_MIN_LEVEL CMake option, which is recorded in SDKConfig.h as @c ACSDK_CONFIG_LOG_MIN_LEVEL.
+ */
+#ifndef ACSDK_LOG_MIN_LEVEL
+#define ACSDK_LOG_MIN_LEVEL ACSDK_CONFIG_LOG_MIN_LEVEL
+#endif  // ACSDK_LOG_MIN_LEVEL
+
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace utils {
 namespace logger {
 
+/**
+ * Return whether log lines of the specified @c Level are compiled in (see @c ACSDK_LOG_MIN_LEVEL).
+ *
+ * @param level The @c Level to check.
+ * @return Whether log lines of the specified @c Level are compiled in.
+ */
+constexpr bool isLevelCompiledIn(Level level) {
+    return static_cast<int>(level) >= ACSDK_LOG_MIN_LEVEL;
+}
+
 /**
  * @c Logger provides an interface for capturing log entries as well as some core logging functionality.
  * This includes:
@@ -255,7 +275,7 @@ private:
 };
 
 bool Logger::shouldLog(Level level) const {
-    return level >= m_level;
+    return level >= m_level.load(std::memory_order_relaxed);
 }
 
 /**
@@ -304,6 +324,24 @@ inline std::shared_ptr<Logger> ACSDK_GET_LOGGER_FUNCTION() {
     return moduleLogger;
 }
 
+/**
+ * Macro for the name of the function that ACSDK_<LEVEL> macros use to reach the @c Logger of the module specified by
+ * @c ACSDK_LOG_MODULE, in the form get<module name>LoggerInstance().
+ */
+#define ACSDK_GET_LOGGER_INSTANCE_FUNCTION ACSDK_CONCATENATE(ACSDK_GET_LOGGER_FUNCTION, Instance)
+
+/**
+ * Inline method to get a reference to the logger for the module specified by @c ACSDK_LOG_MODULE, without the cost of
+ * copying a @c std::shared_ptr on every log line.  The logger is deliberately never released, so the reference stays
+ * valid while static objects are destroyed.
+ *
+ * @return The @c Logger for the module specified by @c ACSDK_LOG_MODULE.
+ */
+inline Logger& ACSDK_GET_LOGGER_INSTANCE_FUNCTION() {
+    static auto moduleLogger = new std::shared_ptr<Logger>(ACSDK_GET_LOGGER_FUNCTION());
+    return **moduleLogger;
+}
+
 }  // namespace logger
 }  // namespace utils
 }  // namespace avsCommon
@@ -313,18 +351,21 @@ inline std::shared_ptr<Logger> ACSDK_GET_LOGGER_FUNCTION() {
  * @def ACSDK_LOG
  * @brief Common implementation for sending entries to the log.
  *
- * @note If @c ACSDK_LOG_ENABLED is set to OFF, then logging is disabled.
+ * @note If @c ACSDK_LOG_ENABLED is set to OFF, then logging is disabled.  Log lines with a severity below
+ * @c ACSDK_LOG_MIN_LEVEL are compiled out.  @c entry is only evaluated if the log line will be emitted.
  *
  * @param[in] level The log level to associate with the log line.
  * @param[in] entry A constructed @a LogEntry object with the log message text.
  */
 #ifdef ACSDK_LOG_ENABLED
-#define ACSDK_LOG(level, entry)                                                                      \
-    do {                                                                                             \
-        auto loggerInstance = alexaClientSDK::avsCommon::utils::logger::ACSDK_GET_LOGGER_FUNCTION(); \
-        if (loggerInstance->shouldLog(level)) {                                                      \
-            loggerInstance->log(level, entry);                                                       \
-        }                                                                                            \
+#define ACSDK_LOG(level, entry)                                                                                    \
+    do {                                                                                                           \
+        if (alexaClientSDK::avsCommon::utils::logger::isLevelCompiledIn(level)) {                                  \
+            auto& loggerInstance = alexaClientSDK::avsCommon::utils::logger::ACSDK_GET_LOGGER_INSTANCE_FUNCTION(); \
+            if (loggerInstance.shouldLog(level)) {                                                                 \
+                loggerInstance.log(level, entry);                                                                  \
+            }                                                                                                      \
+        }                                                                                                          \
     } while (false)
 #else  // ACSDK_LOG_ENABLED
 #define ACSDK_LOG(level, entry) \
@@ -0,0 +1,58 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_BINARYMETRICSINKINTERFACE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_BINARYMETRICSINKINTERFACE_H_
+
+#include <cstddef>
+
+#include "AVSCommon/Utils/Metrics/MetricRecord.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+
+/**
+ * This class provides an interface for metric sinks which consume metrics in their fixed size binary form, in
+ * batches.  It avoids the allocations of @c MetricEvent for sinks which serialize, aggregate or forward metrics
+ * themselves.  Names in the records can be resolved with @c MetricNameRegistry::getName().
+ *
+ * @note implementations of BinaryMetricSinkInterface may not be thread-safe.
+ */
+class BinaryMetricSinkInterface {
+public:
+    /**
+     * Destructor.
+     */
+    virtual ~BinaryMetricSinkInterface() = default;
+
+    /**
+     * This function allows consumption of a batch of metrics, in the order in which they were recorded by each
+     * thread; metrics recorded by different threads may be interleaved in any order.  The records are only valid for
+     * the duration of the call.
+     *
+     * @param records The first record of the batch.
+     * @param count The number of records in the batch.
+     */
+    virtual void consumeMetrics(const MetricRecord* records, size_t count) = 0;
+};
+
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_BINARYMETRICSINKINTERFACE_H_
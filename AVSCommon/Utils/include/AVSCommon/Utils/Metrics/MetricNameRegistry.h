@@ -0,0 +1,66 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_METRICNAMEREGISTRY_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_METRICNAMEREGISTRY_H_
+
+#include <cstdint>
+#include <string>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+
+/// Identifier of an interned activity or data point name.
+using MetricNameId = uint32_t;
+
+/**
+ * Process wide table of interned activity and data point names, which lets a @c MetricRecord refer to a name with a
+ * fixed size identifier instead of carrying a copy of the string.
+ *
+ * Names are meant to be interned once, typically into a static constant next to the code which records the metric;
+ * interned names are never released.
+ */
+class MetricNameRegistry {
+public:
+    /// Identifier which does not refer to any name.  Its name is the empty string.
+    static const MetricNameId INVALID_ID;
+
+    /**
+     * Get the identifier of a name, adding the name to the table if needed.  This takes a lock and should be kept
+     * off hot paths.
+     *
+     * @param name The name to intern.
+     * @return The identifier of @c name, or @c INVALID_ID if @c name is empty.
+     */
+    static MetricNameId intern(const std::string& name);
+
+    /**
+     * Get the name of an identifier returned by @c intern().
+     *
+     * @param id The identifier to look up.
+     * @return The name of @c id, or the empty string if @c id is unknown.  The reference stays valid for the lifetime
+     *     of the process.
+     */
+    static const std::string& getName(MetricNameId id);
+};
+
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_METRICNAMEREGISTRY_H_
@@ -0,0 +1,225 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_METRICRECORD_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_METRICRECORD_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "AVSCommon/Utils/Metrics/DataType.h"
+#include "AVSCommon/Utils/Metrics/MetricEvent.h"
+#include "AVSCommon/Utils/Metrics/MetricNameRegistry.h"
+#include "AVSCommon/Utils/Metrics/Priority.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+
+/**
+ * A fixed size, trivially copyable representation of a metric, for recording metrics on hot paths without any heap
+ * allocation.  Activity and data point names are @c MetricNameRegistry identifiers, counters and durations are stored
+ * as integers, and string values are copied into a small inline buffer.
+ *
+ * A record holds at most @c MAX_DATA_POINTS data points and @c STRING_STORAGE_SIZE bytes of string values; anything
+ * beyond that is dropped (string values are cut short) and the record is marked as truncated.
+ *
+ * Example:
+ *
+ *     static const MetricNameId ACTIVITY = MetricNameRegistry::intern("COMPONENT-ACTIVITY");
+ *     static const MetricNameId COUNT = MetricNameRegistry::intern("COUNT");
+ *     recordMetric(metricRecorder, MetricRecord(ACTIVITY).addCounter(COUNT, 1));
+ */
+class MetricRecord {
+public:
+    /// The maximum number of data points in a record.
+    static const size_t MAX_DATA_POINTS = 8;
+
+    /// The number of bytes available for the string values of a record.
+    static const size_t STRING_STORAGE_SIZE = 128;
+
+    /**
+     * Constructor of an empty record, which has no activity name.
+     */
+    MetricRecord();
+
+    /**
+     * Constructor.
+     *
+     * @param activityName The activity name of the metric.
+     * @param priority The priority of the metric.
+     * @param timestamp The time at which the metric was created.
+     */
+    explicit MetricRecord(
+        MetricNameId activityName,
+        Priority priority = Priority::NORMAL,
+        std::chrono::steady_clock::time_point timestamp = std::chrono::steady_clock::now());
+
+    /**
+     * Add a counter data point.
+     *
+     * @param name The name of the data point.
+     * @param count The value of the counter.
+     * @return This record, to allow chaining.
+     */
+    MetricRecord& addCounter(MetricNameId name, uint64_t count);
+
+    /**
+     * Add a duration data point.
+     *
+     * @param name The name of the data point.
+     * @param duration The duration; negative durations are recorded as zero.
+     * @return This record, to allow chaining.
+     */
+    MetricRecord& addDuration(MetricNameId name, std::chrono::milliseconds duration);
+
+    /**
+     * Add a string data point.  The value is copied into the record, and cut short if the string storage is full.
+     *
+     * @param name The name of the data point.
+     * @param value The value of the data point.
+     * @return This record, to allow chaining.
+     */
+    MetricRecord& addString(MetricNameId name, const std::string& value);
+
+    /**
+     * Get the activity name of the metric.
+     *
+     * @return The activity name, or @c MetricNameRegistry::INVALID_ID for an empty record.
+     */
+    MetricNameId getActivityName() const;
+
+    /**
+     * Get the priority of the metric.
+     *
+     * @return The priority of the metric.
+     */
+    Priority getPriority() const;
+
+    /**
+     * Get the time at which the metric was created.
+     *
+     * @return The time at which the metric was created.
+     */
+    std::chrono::steady_clock::time_point getSteadyTimestamp() const;
+
+    /**
+     * Get the number of data points in the record.
+     *
+     * @return The number of data points.
+     */
+    size_t getDataPointCount() const;
+
+    /**
+     * Get the name of a data point.
+     *
+     * @param index The index of the data point, which must be less than @c getDataPointCount().
+     * @return The name of the data point.
+     */
+    MetricNameId getDataPointName(size_t index) const;
+
+    /**
+     * Get the type of a data point.
+     *
+     * @param index The index of the data point, which must be less than @c getDataPointCount().
+     * @return The type of the data point.
+     */
+    DataType getDataPointType(size_t index) const;
+
+    /**
+     * Get the value of a counter or duration data point.  Durations are in milliseconds.
+     *
+     * @param index The index of the data point, which must be less than @c getDataPointCount().
+     * @return The value of the data point, or 0 for a string data point.
+     */
+    uint64_t getNumericValue(size_t index) const;
+
+    /**
+     * Get the value of a string data point.
+     *
+     * @param index The index of the data point, which must be less than @c getDataPointCount().
+     * @return The value of the data point, or the empty string for a counter or duration data point.
+     */
+    std::string getStringValue(size_t index) const;
+
+    /**
+     * Check whether data points or string values were dropped because the record was full.
+     *
+     * @return Whether the record was truncated.
+     */
+    bool isTruncated() const;
+
+    /**
+     * Convert the record to a @c MetricEvent, for consumers which only understand those.
+     *
+     * @return The equivalent @c MetricEvent, or @c nullptr if the record has no activity name.
+     */
+    std::shared_ptr<MetricEvent> toMetricEvent() const;
+
+private:
+    /// A data point of the record.
+    struct DataPointRecord {
+        /// The counter value, the duration in milliseconds, or the offset and size of a string value.
+        uint64_t value;
+        /// The name of the data point.
+        MetricNameId name;
+        /// The @c DataType of the data point.
+        uint8_t type;
+    };
+
+    /**
+     * Append a data point.
+     *
+     * @param name The name of the data point.
+     * @param type The type of the data point.
+     * @param value The encoded value of the data point.
+     */
+    void addDataPoint(MetricNameId name, DataType type, uint64_t value);
+
+    /// The time at which the metric was created.
+    std::chrono::steady_clock::time_point m_timestamp;
+
+    /// The activity name of the metric.
+    MetricNameId m_activityName;
+
+    /// The @c Priority of the metric.
+    uint8_t m_priority;
+
+    /// The number of entries used in @c m_dataPoints.
+    uint8_t m_dataPointCount;
+
+    /// Whether data points or string values were dropped.
+    bool m_truncated;
+
+    /// The number of bytes used in @c m_strings.
+    uint16_t m_stringSize;
+
+    /// The data points of the metric.
+    DataPointRecord m_dataPoints[MAX_DATA_POINTS];
+
+    /// Storage for the string values of the data points.
+    char m_strings[STRING_STORAGE_SIZE];
+};
+
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_METRICRECORD_H_
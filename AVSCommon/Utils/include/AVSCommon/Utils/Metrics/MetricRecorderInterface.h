@@ -16,6 +16,7 @@
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_METRICRECORDERINTERFACE_H_
 
 #include "AVSCommon/Utils/Metrics/MetricEvent.h"
+#include "AVSCommon/Utils/Metrics/MetricRecord.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -40,6 +41,21 @@ public:
      * @param metricEvent is the metric event to be recorded
      */
     virtual void recordMetric(std::shared_ptr<MetricEvent> metricEvent) = 0;
+
+    /**
+     * Record a metric in its fixed size binary form.  Recorders which support @c MetricRecord natively should
+     * override this to avoid allocating; the default implementation converts the record to a @c MetricEvent and
+     * passes it to @c recordMetric().
+     *
+     * @note implementations of this function should be non-blocking
+     * @param record The metric to be recorded.
+     */
+    virtual void recordBinaryMetric(const MetricRecord& record) {
+        auto metricEvent = record.toMetricEvent();
+        if (metricEvent) {
+            recordMetric(std::move(metricEvent));
+        }
+    }
 };
 
 /**
@@ -61,6 +77,17 @@ inline void recordMetric(
 #endif
 }
 
+inline void recordMetric(const std::shared_ptr<MetricRecorderInterface>& recorder, const MetricRecord& record) {
+#ifdef ACSDK_ENABLE_METRICS_RECORDING
+    if (recorder) {
+        recorder->recordBinaryMetric(record);
+    }
+#else
+    (void)recorder;
+    (void)record;
+#endif
+}
+
 }  // namespace metrics
 }  // namespace utils
 }  // namespace avsCommon
@@ -16,6 +16,9 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_METRICSINKINTERFACE_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_METRICSINKINTERFACE_H_
 
+#include <memory>
+#include <vector>
+
 #include "AVSCommon/Utils/Metrics/MetricEvent.h"
 
 namespace alexaClientSDK {
@@ -43,6 +46,20 @@ public:
      *         false otherwise
      */
     virtual void consumeMetric(std::shared_ptr<MetricEvent> metricEvent) = 0;
+
+    /**
+     * This function allows consumption of a batch of MetricEvents, in the order in which they were recorded by each
+     * thread; metrics recorded by different threads may be interleaved in any order.  The default implementation
+     * calls @c consumeMetric() for each of them; sinks which can handle a batch more efficiently (for instance with a
+     * single write or upload) should override it.
+     *
+     * @param metricEvents The metric events to be consumed.
+     */
+    virtual void consumeMetrics(const std::vector<std::shared_ptr<MetricEvent>>& metricEvents) {
+        for (const auto& metricEvent : metricEvents) {
+            consumeMetric(metricEvent);
+        }
+    }
 };
 
 }  // namespace metrics
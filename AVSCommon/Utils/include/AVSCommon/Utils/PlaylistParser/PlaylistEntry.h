@@ -20,6 +20,7 @@
 #include <ostream>
 #include <queue>
 #include <string>
+#include <utility>
 
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterface.h>
 #include <AVSCommon/Utils/HTTPContent.h>
@@ -239,12 +240,12 @@ inline PlaylistEntry::PlaylistEntry(
     EncryptionInfo _encryptionInfo,
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> _contentFetcher) :
         type(_type),
-        url(_url),
+        url(std::move(_url)),
         duration(_duration),
         parseResult(_parseResult),
         byteRange(_byteRange),
-        encryptionInfo(_encryptionInfo),
-        contentFetcher(_contentFetcher) {
+        encryptionInfo(std::move(_encryptionInfo)),
+        contentFetcher(std::move(_contentFetcher)) {
 }
 
 }  // namespace playlistParser
@@ -0,0 +1,267 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_FUTEXPRIMITIVES_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_FUTEXPRIMITIVES_H_
+
+#ifdef __linux__
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+namespace futex {
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "std::atomic<uint32_t> cannot be used as a futex");
+
+/**
+ * Block the calling thread while @c *word still holds @c expected.
+ *
+ * @tparam ProcessShared Whether @c word may be shared with other processes.
+ * @param word The futex word.
+ * @param expected The value @c word is expected to hold.
+ * @param timeout The maximum time to block, or @c nullptr to block until woken up.
+ * @return @c false if @c timeout expired, @c true otherwise (including spurious wake ups and value mismatches).
+ */
+template <bool ProcessShared>
+inline bool futexWait(std::atomic<uint32_t>* word, uint32_t expected, const struct timespec* timeout = nullptr) {
+    static constexpr int OPERATION = ProcessShared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE;
+    auto result = syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), OPERATION, expected, timeout, nullptr, 0);
+    return !(-1 == result && ETIMEDOUT == errno);
+}
+
+/**
+ * Wake up threads blocked in @c futexWait() on @c word.
+ *
+ * @tparam ProcessShared Whether @c word may be shared with other processes.
+ * @param word The futex word.
+ * @param count The maximum number of threads to wake up.
+ */
+template <bool ProcessShared>
+inline void futexWake(std::atomic<uint32_t>* word, int count) {
+    static constexpr int OPERATION = ProcessShared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE;
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), OPERATION, count, nullptr, nullptr, 0);
+}
+
+/**
+ * A mutex built directly on a futex word.  Locking and unlocking an uncontended mutex is a single atomic operation
+ * which never enters the kernel, and the lock owner only issues a wake up system call when another thread is actually
+ * blocked on the mutex.  A short spin precedes blocking, since the critical sections in @c SharedDataStream are only a
+ * handful of instructions long.
+ *
+ * The mutex holds no pointers and no per-process state, so the process shared variant can be placement constructed
+ * in memory which is mapped by several processes.
+ *
+ * @tparam ProcessShared Whether the mutex may be shared with other processes.
+ */
+template <bool ProcessShared>
+class BasicMutex {
+public:
+    /// Constructor.
+    BasicMutex() : m_state{UNLOCKED} {
+    }
+
+    /// Lock the mutex, blocking until it becomes available.
+    void lock() {
+        uint32_t state = UNLOCKED;
+        if (m_state.compare_exchange_strong(state, LOCKED, std::memory_order_acquire)) {
+            return;
+        }
+        for (int spin = 0; spin < MAX_SPINS && CONTENDED != state; ++spin) {
+            state = UNLOCKED;
+            if (m_state.compare_exchange_weak(state, LOCKED, std::memory_order_acquire)) {
+                return;
+            }
+        }
+        // Mark the mutex as contended, so that unlock() knows that it has to wake somebody up.
+        if (CONTENDED != state) {
+            state = m_state.exchange(CONTENDED, std::memory_order_acquire);
+        }
+        while (UNLOCKED != state) {
+            futexWait<ProcessShared>(&m_state, CONTENDED);
+            state = m_state.exchange(CONTENDED, std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * Try to lock the mutex without blocking.
+     *
+     * @return Whether the mutex was locked.
+     */
+    bool try_lock() {
+        uint32_t state = UNLOCKED;
+        return m_state.compare_exchange_strong(state, LOCKED, std::memory_order_acquire);
+    }
+
+    /// Unlock the mutex.
+    void unlock() {
+        if (CONTENDED == m_state.exchange(UNLOCKED, std::memory_order_release)) {
+            futexWake<ProcessShared>(&m_state, 1);
+        }
+    }
+
+private:
+    /// The mutex is not held.
+    static constexpr uint32_t UNLOCKED = 0;
+    /// The mutex is held and no other thread is blocked on it.
+    static constexpr uint32_t LOCKED = 1;
+    /// The mutex is held and other threads may be blocked on it.
+    static constexpr uint32_t CONTENDED = 2;
+    /// Number of attempts to acquire a held mutex before blocking.
+    static constexpr int MAX_SPINS = 64;
+
+    /// The futex word holding the mutex state.
+    std::atomic<uint32_t> m_state;
+};
+
+/**
+ * A condition variable built on a futex sequence word.  Each notification bumps the sequence, and waiters block until
+ * the sequence moves away from the value they observed while still holding the mutex, so no notification can be lost.
+ * The number of blocked threads is tracked as well, which lets @c notify_all() skip the system call entirely when
+ * nobody is waiting; this is the common case for @c SharedDataStream, where writers notify after every write but
+ * readers rarely have to block.
+ *
+ * @tparam ProcessShared Whether the condition variable may be shared with other processes.
+ */
+template <bool ProcessShared>
+class BasicConditionVariable {
+public:
+    /// Constructor.
+    BasicConditionVariable() : m_sequence{0}, m_waiters{0} {
+    }
+
+    /// Wake up one thread waiting on this condition variable.
+    void notify_one() {
+        m_sequence.fetch_add(1, std::memory_order_seq_cst);
+        if (m_waiters.load(std::memory_order_seq_cst) > 0) {
+            futexWake<ProcessShared>(&m_sequence, 1);
+        }
+    }
+
+    /// Wake up all threads waiting on this condition variable.
+    void notify_all() {
+        m_sequence.fetch_add(1, std::memory_order_seq_cst);
+        if (m_waiters.load(std::memory_order_seq_cst) > 0) {
+            futexWake<ProcessShared>(&m_sequence, INT_MAX);
+        }
+    }
+
+    /**
+     * Wait until notified.  @c lock must be locked by the calling thread.  Spurious wake ups are possible.
+     *
+     * @param lock The lock protecting the condition.
+     */
+    template <typename Lock>
+    void wait(Lock& lock) {
+        waitUntil(lock, nullptr);
+    }
+
+    /**
+     * Wait until @c predicate is satisfied.  @c lock must be locked by the calling thread.
+     *
+     * @param lock The lock protecting the condition.
+     * @param predicate The condition to wait for.
+     */
+    template <typename Lock, typename Predicate>
+    void wait(Lock& lock, Predicate predicate) {
+        while (!predicate()) {
+            waitUntil(lock, nullptr);
+        }
+    }
+
+    /**
+     * Wait up to @c timeout for @c predicate to be satisfied.  @c lock must be locked by the calling thread.
+     *
+     * @param lock The lock protecting the condition.
+     * @param timeout The maximum time to wait.
+     * @param predicate The condition to wait for.
+     * @return The value of @c predicate when the wait ended.
+     */
+    template <typename Lock, typename Rep, typename Period, typename Predicate>
+    bool wait_for(Lock& lock, const std::chrono::duration<Rep, Period>& timeout, Predicate predicate) {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!predicate()) {
+            auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                return predicate();
+            }
+            waitUntil(lock, &deadline);
+        }
+        return true;
+    }
+
+private:
+    /**
+     * Release @c lock, block until notified or until @c deadline, and then reacquire @c lock.
+     *
+     * @param lock The lock protecting the condition.
+     * @param deadline The time at which to stop waiting, or @c nullptr to wait until notified.
+     */
+    template <typename Lock>
+    void waitUntil(Lock& lock, const std::chrono::steady_clock::time_point* deadline) {
+        // Read the sequence while still holding the lock: any notification for a state change made after the caller
+        // checked its condition necessarily bumps the sequence past this value.
+        auto sequence = m_sequence.load(std::memory_order_seq_cst);
+        m_waiters.fetch_add(1, std::memory_order_seq_cst);
+        lock.unlock();
+        if (deadline) {
+            auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                *deadline - std::chrono::steady_clock::now());
+            if (remaining.count() > 0) {
+                struct timespec timeout;
+                timeout.tv_sec = static_cast<time_t>(remaining.count() / std::nano::den);
+                timeout.tv_nsec = static_cast<long>(remaining.count() % std::nano::den);
+                futexWait<ProcessShared>(&m_sequence, sequence, &timeout);
+            }
+        } else {
+            futexWait<ProcessShared>(&m_sequence, sequence);
+        }
+        m_waiters.fetch_sub(1, std::memory_order_seq_cst);
+        lock.lock();
+    }
+
+    /// The futex word which is bumped by every notification.
+    std::atomic<uint32_t> m_sequence;
+
+    /// Number of threads currently blocked on @c m_sequence.
+    std::atomic<uint32_t> m_waiters;
+};
+
+/// A futex based mutex for use between threads of a single process.
+using Mutex = BasicMutex<false>;
+
+/// A futex based condition variable for use between threads of a single process.
+using ConditionVariable = BasicConditionVariable<false>;
+
+}  // namespace futex
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_FUTEXPRIMITIVES_H_
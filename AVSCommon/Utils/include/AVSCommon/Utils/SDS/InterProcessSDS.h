@@ -0,0 +1,205 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_INTERPROCESSSDS_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_INTERPROCESSSDS_H_
+
+#ifdef __linux__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <pthread.h>
+
+#include "FutexPrimitives.h"
+#include "SharedDataStream.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/**
+ * A mutex which can be placement constructed in memory shared between processes, and which survives the death of a
+ * process holding it.  If the owner of the mutex terminates while holding it, the next call to @c lock() recovers the
+ * mutex instead of blocking forever.  This matters for a @c SharedDataStream whose @c Writer lives in a separate
+ * audio process, since that process may be restarted at any time.
+ *
+ * The state protected by this mutex in a @c SharedDataStream consists only of atomic cursors and flags, so it remains
+ * consistent when the mutex is recovered.
+ */
+class RobustMutex {
+public:
+    /// Constructor.
+    RobustMutex();
+
+    /// Destructor.
+    ~RobustMutex();
+
+    /// Lock the mutex, blocking until it becomes available.
+    void lock();
+
+    /**
+     * Try to lock the mutex without blocking.
+     *
+     * @return Whether the mutex was locked.
+     */
+    bool try_lock();
+
+    /// Unlock the mutex.
+    void unlock();
+
+    /// Deleted copy constructor.
+    RobustMutex(const RobustMutex&) = delete;
+
+    /// Deleted assignment operator.
+    RobustMutex& operator=(const RobustMutex&) = delete;
+
+private:
+    /// The underlying process shared, robust pthread mutex.
+    pthread_mutex_t m_mutex;
+};
+
+/**
+ * A buffer backed by a POSIX shared memory object, suitable for use as the @c Buffer of a @c SharedDataStream which is
+ * shared between processes.  One process calls @c create() to allocate the object and then calls
+ * @c SharedDataStream::create() on it; other processes call @c open() with the same name and then
+ * @c SharedDataStream::open() on the result.  Data written into the stream is then visible to every process without
+ * any copies.
+ *
+ * The shared memory object is unlinked when the buffer returned by @c create() is destroyed.  Processes which have
+ * already opened it keep their mapping until they destroy their own buffer.
+ */
+class SharedMemoryBuffer {
+public:
+    /**
+     * Create and map a new shared memory object.  The call fails if an object with the same name already exists.
+     *
+     * @param name The name of the shared memory object.  It must start with a '/' and contain no other '/'.
+     * @param size The size of the object in bytes (see @c SharedDataStream::calculateBufferSize()).
+     * @return The new buffer, or @c nullptr if the object could not be created.
+     */
+    static std::shared_ptr<SharedMemoryBuffer> create(const std::string& name, size_t size);
+
+    /**
+     * Map an existing shared memory object which was created by another process with @c create().
+     *
+     * @param name The name of the shared memory object.
+     * @return The buffer, or @c nullptr if the object could not be opened.
+     */
+    static std::shared_ptr<SharedMemoryBuffer> open(const std::string& name);
+
+    /**
+     * Remove the name of a shared memory object, for instance one left behind by a process which crashed.
+     *
+     * @param name The name of the shared memory object.
+     * @return Whether the name was removed.
+     */
+    static bool unlink(const std::string& name);
+
+    /// Destructor.
+    ~SharedMemoryBuffer();
+
+    /**
+     * Get the start of the mapped memory.
+     *
+     * @return The start of the mapped memory.
+     */
+    uint8_t* data();
+
+    /**
+     * Get the size of the mapped memory.
+     *
+     * @return The size of the mapped memory in bytes.
+     */
+    size_t size() const;
+
+    /**
+     * Get the name of the shared memory object.
+     *
+     * @return The name of the shared memory object.
+     */
+    const std::string& getName() const;
+
+    /// Deleted copy constructor.
+    SharedMemoryBuffer(const SharedMemoryBuffer&) = delete;
+
+    /// Deleted assignment operator.
+    SharedMemoryBuffer& operator=(const SharedMemoryBuffer&) = delete;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param name The name of the shared memory object.
+     * @param data The start of the mapped memory.
+     * @param size The size of the mapped memory in bytes.
+     * @param isOwner Whether the object should be unlinked when this buffer is destroyed.
+     */
+    SharedMemoryBuffer(const std::string& name, uint8_t* data, size_t size, bool isOwner);
+
+    /// The name of the shared memory object.
+    const std::string m_name;
+
+    /// The start of the mapped memory.
+    uint8_t* const m_data;
+
+    /// The size of the mapped memory in bytes.
+    const size_t m_size;
+
+    /// Whether this buffer created the shared memory object.
+    const bool m_isOwner;
+};
+
+/**
+ * Structure for specifying the traits of a SharedDataStream which works between processes, using a
+ * @c SharedMemoryBuffer as its storage.
+ */
+struct InterProcessSDSTraits {
+    /// Lock free std::atomic values operate directly on the shared memory and work between processes.
+    using AtomicIndex = std::atomic<uint64_t>;
+
+    /// Lock free std::atomic values operate directly on the shared memory and work between processes.
+    using AtomicBool = std::atomic<bool>;
+
+    /// A POSIX shared memory object mapped into each process.
+    using Buffer = SharedMemoryBuffer;
+
+    /// A process shared mutex which is recovered if its owner dies.
+    using Mutex = RobustMutex;
+
+    /// A process shared futex based condition variable.
+    using ConditionVariable = futex::BasicConditionVariable<true>;
+
+    /// A unique identifier representing this combination of traits.
+    static constexpr const char* traitsName = "alexaClientSDK::avsCommon::utils::sds::InterProcessSDSTraits";
+};
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "InterProcessSDSTraits::AtomicIndex must be lock free");
+static_assert(ATOMIC_BOOL_LOCK_FREE == 2, "InterProcessSDSTraits::AtomicBool must be lock free");
+
+/// Type alias for a SharedDataStream which works between processes.
+using InterProcessSDS = SharedDataStream<InterProcessSDSTraits>;
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_INTERPROCESSSDS_H_
@@ -0,0 +1,78 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_LOWLATENCYINPROCESSSDS_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_LOWLATENCYINPROCESSSDS_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "FutexPrimitives.h"
+#include "SharedDataStream.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/**
+ * Structure for specifying the traits of a SharedDataStream which works between threads in a single process, tuned
+ * for a single writer feeding several readers at a high rate (e.g. a microphone feeding the wake word engine and the
+ * AudioInputProcessor).
+ *
+ * Cursors are the same atomics as in @c InProcessSDSTraits, so the @c Reader::Policy and @c Writer::Policy semantics
+ * are unchanged.  On Linux the mutex and condition variable are futex based: uncontended locking never enters the
+ * kernel, and a writer only issues a wake up system call when a reader is actually blocked waiting for data.  On other
+ * platforms these traits fall back to the standard library primitives.
+ */
+struct LowLatencyInProcessSDSTraits {
+    /// C++11 std::atomic is sufficient for in-process atomic variables.
+    using AtomicIndex = std::atomic<uint64_t>;
+
+    /// C++11 std::atomic is sufficient for in-process atomic variables.
+    using AtomicBool = std::atomic<bool>;
+
+    /// A std::vector provides a simple container to hold a buffer for in-process usage.
+    using Buffer = std::vector<uint8_t>;
+
+#ifdef __linux__
+    /// A futex based mutex which avoids system calls unless it is contended.
+    using Mutex = futex::Mutex;
+
+    /// A futex based condition variable which avoids system calls unless a thread is waiting on it.
+    using ConditionVariable = futex::ConditionVariable;
+#else
+    /// A std::mutex provides a lock which will work for in-process usage.
+    using Mutex = std::mutex;
+
+    /// A std::condition_variable provides a condition variable which will work for in-process usage.
+    using ConditionVariable = std::condition_variable;
+#endif
+
+    /// A unique identifier representing this combination of traits.
+    static constexpr const char* traitsName = "alexaClientSDK::avsCommon::utils::sds::LowLatencyInProcessSDSTraits";
+};
+
+/// Type alias for a low latency SharedDataStream which works between threads in a single process.
+using LowLatencyInProcessSDS = SharedDataStream<LowLatencyInProcessSDSTraits>;
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_LOWLATENCYINPROCESSSDS_H_
@@ -384,6 +384,7 @@ ssize_t SharedDataStream<T>::Reader::read(OutputFunction function, size_t nWords
     size_t afterWrap = nWords - beforeWrap;
 
     // Copy the two segments.
+    Index readStartCursor = *m_readerCursor;
     if (!function(m_bufferLayout->getData(*m_readerCursor), beforeWrap)) {
         // We haven't changed the read pointer yet, just error out.
         return Error::INVALID;
@@ -398,7 +399,9 @@ ssize_t SharedDataStream<T>::Reader::read(OutputFunction function, size_t nWords
     *m_readerCursor += nWords;
 
     // Final check for overrun (do this before the updateOldestUnconsumedCursor() call below for improved accuracy).
-    bool overrun = ((header->writeEndCursor - *m_readerCursor) > m_bufferLayout->getDataSize());
+    // The check is against the cursor the data was read from, since @c function may use the data in place for long
+    // enough for the writer to overwrite its beginning.
+    bool overrun = ((header->writeEndCursor - readStartCursor) > m_bufferLayout->getDataSize());
 
     // Move the unconsumed cursor before returning.
     m_bufferLayout->updateOldestUnconsumedCursor();
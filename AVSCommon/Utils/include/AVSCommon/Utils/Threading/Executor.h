@@ -58,6 +58,16 @@ public:
      */
     Executor(const std::chrono::milliseconds& unused) noexcept;
 
+    /**
+     * Constructs an Executor which runs its tasks on a shared scheduler rather than on a thread of its own.
+     *
+     * Only use this for executors whose tasks do not block: a task waiting on a future or a condition variable ties up
+     * a scheduler worker, and thereby delays the executors sharing the scheduler.
+     *
+     * @param scheduler The scheduler to run the tasks on. If @c nullptr, the tasks run on a dedicated thread.
+     */
+    explicit Executor(std::shared_ptr<class WorkStealingScheduler> scheduler) noexcept;
+
     /**
      * Destructs an Executor.
      */
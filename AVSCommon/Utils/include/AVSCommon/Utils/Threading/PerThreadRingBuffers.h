@@ -0,0 +1,320 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_PERTHREADRINGBUFFERS_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_PERTHREADRINGBUFFERS_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/**
+ * Round @c size up to the next power of two.
+ *
+ * @param size The value to round up.
+ * @return The smallest power of two which is not smaller than @c size.
+ */
+size_t roundUpToPowerOfTwo(size_t size);
+
+/**
+ * The positions of a single producer / single consumer ring buffer owned by one thread.  The producer is the thread
+ * which owns the buffer, the consumer is whichever thread drains it, and the two never take a lock.
+ *
+ * Positions only ever increase; classes which derive from this one keep the storage and map positions into it with
+ * @c getOffset().  Entries may take more than one unit of the capacity, which lets byte buffers hold records of
+ * variable size.
+ */
+class PerThreadRingBuffer {
+public:
+    /**
+     * Constructor.
+     *
+     * @param capacity The number of units the buffer can hold; must be a power of two.
+     */
+    explicit PerThreadRingBuffer(size_t capacity);
+
+    /**
+     * Destructor.
+     */
+    virtual ~PerThreadRingBuffer() = default;
+
+    /**
+     * Check whether there are entries to consume.
+     *
+     * @return Whether the buffer is empty.
+     */
+    bool empty() const;
+
+    /**
+     * Get the number of entries dropped because the buffer was full.
+     *
+     * @return The number of dropped entries.
+     */
+    uint64_t getDroppedCount() const;
+
+    /**
+     * Check whether the owning thread has exited.
+     *
+     * @return Whether the owning thread has exited.
+     */
+    bool isAbandoned() const;
+
+protected:
+    /**
+     * Reserve room for an entry.  Called by the producer only.  If there is no room, the entry is counted as dropped.
+     *
+     * @param size The number of units the entry takes.
+     * @param[out] position The position to write the entry at.
+     * @return Whether there is room for the entry.
+     */
+    bool beginPush(size_t size, uint64_t* position);
+
+    /**
+     * Make the entries written before @c position visible to the consumer.  Called by the producer only.
+     *
+     * @param position The position after the last entry written.
+     */
+    void endPush(uint64_t position);
+
+    /**
+     * Get the position of the oldest entry.  Called by the consumer only.
+     *
+     * @param[out] position The position of the oldest entry.
+     * @return Whether there is an entry to consume.
+     */
+    bool beginPop(uint64_t* position) const;
+
+    /**
+     * Release the entries before @c position to the producer.  Called by the consumer only.
+     *
+     * @param position The position after the last entry consumed.
+     */
+    void endPop(uint64_t position);
+
+    /**
+     * Get the number of units the buffer can hold.
+     *
+     * @return The capacity of the buffer.
+     */
+    size_t getCapacity() const;
+
+    /**
+     * Map a position to an offset in the storage of the buffer.
+     *
+     * @param position The position.
+     * @return The offset, which is smaller than the capacity.
+     */
+    size_t getOffset(uint64_t position) const;
+
+private:
+    /// Mark the buffer as no longer used by its thread.
+    void abandon();
+
+    /// The number of units the buffer can hold.
+    const size_t m_capacity;
+
+    /// Mask which maps positions to offsets.
+    const uint64_t m_mask;
+
+    /// Position at which the producer writes the next entry.
+    std::atomic<uint64_t> m_head;
+
+    /// Position at which the consumer reads the next entry.
+    std::atomic<uint64_t> m_tail;
+
+    /// Number of entries dropped because the buffer was full.
+    std::atomic<uint64_t> m_dropped;
+
+    /// Whether the owning thread has exited.
+    std::atomic<bool> m_abandoned;
+
+    /// The registry marks the buffers of exited threads as abandoned.
+    friend class PerThreadRingBuffersBase;
+};
+
+/**
+ * Hands out one @c PerThreadRingBuffer per thread, and keeps track of all of them for the consumer.  This is the part
+ * of @c PerThreadRingBuffers which does not depend on the type of the ring buffers.
+ */
+class PerThreadRingBuffersBase {
+public:
+    /**
+     * Destructor.
+     */
+    virtual ~PerThreadRingBuffersBase() = default;
+
+    /**
+     * Check whether any ring buffer has entries to consume.
+     *
+     * @return Whether all ring buffers are empty.
+     */
+    bool empty() const;
+
+    /**
+     * Get the number of entries dropped by all ring buffers, including the ones which have been released.
+     *
+     * @return The number of dropped entries.
+     */
+    uint64_t getDroppedCount() const;
+
+protected:
+    /**
+     * Constructor.
+     */
+    PerThreadRingBuffersBase();
+
+    /**
+     * Get the ring buffer of the calling thread, creating it if needed.
+     *
+     * @return The ring buffer of the calling thread.
+     */
+    PerThreadRingBuffer* getThreadRingBufferBase();
+
+    /**
+     * Release the ring buffers of threads which have exited once they are drained, and get the remaining ones.
+     *
+     * @return The ring buffers to drain.
+     */
+    std::vector<std::shared_ptr<PerThreadRingBuffer>> collectBase();
+
+    /**
+     * Create the ring buffer of a thread.
+     *
+     * @return The new ring buffer.
+     */
+    virtual std::shared_ptr<PerThreadRingBuffer> createRingBuffer() const = 0;
+
+    /// Protects @c m_ringBuffers and @c m_droppedByRemovedRingBuffers.
+    mutable std::mutex m_ringBuffersMutex;
+
+    /// The ring buffers of all threads which have used this registry.
+    std::vector<std::shared_ptr<PerThreadRingBuffer>> m_ringBuffers;
+
+private:
+    /// Unique identifier of this registry, used to find the ring buffers of the calling thread.
+    const uint64_t m_id;
+
+    /// Number of entries dropped by ring buffers which have been released after their thread exited.
+    uint64_t m_droppedByRemovedRingBuffers;
+
+    /// Friend class which gives tests access to the lock of the ring buffers.
+    friend class PerThreadRingBuffersTestHelper;
+};
+
+/**
+ * Hands out one ring buffer of type @c RingBufferType per thread, so that threads can produce entries without taking
+ * any lock, and lets a consumer drain all of them.  Ring buffers are created the first time a thread asks for one, and
+ * released once the thread has exited and its ring buffer has been drained.
+ *
+ * @tparam RingBufferType The type of the ring buffers, which derives from @c PerThreadRingBuffer and is constructed
+ *     with its capacity.
+ */
+template <typename RingBufferType>
+class PerThreadRingBuffers : public PerThreadRingBuffersBase {
+public:
+    /**
+     * Constructor.
+     *
+     * @param capacity The capacity of each ring buffer; must be a power of two.
+     */
+    explicit PerThreadRingBuffers(size_t capacity);
+
+    /**
+     * Get the ring buffer of the calling thread, creating it if needed.
+     *
+     * @return The ring buffer of the calling thread.
+     */
+    RingBufferType* getThreadRingBuffer();
+
+    /**
+     * Release the ring buffers of threads which have exited once they are drained, and get the remaining ones.  The
+     * ring buffers are drained without holding any lock, so producers can keep going meanwhile.
+     *
+     * @return The ring buffers to drain.
+     */
+    std::vector<std::shared_ptr<RingBufferType>> collect();
+
+    /**
+     * Call @c function on every ring buffer, unless the list of ring buffers is locked.  This neither allocates nor
+     * blocks, so it can be used from a signal handler.
+     *
+     * @param function The function to call with each ring buffer.
+     * @return Whether @c function was called.
+     */
+    template <typename Function>
+    bool tryForEach(Function function);
+
+private:
+    /// @name PerThreadRingBuffersBase method.
+    /// @{
+    std::shared_ptr<PerThreadRingBuffer> createRingBuffer() const override;
+    /// @}
+
+    /// The capacity of each ring buffer.
+    const size_t m_capacity;
+};
+
+template <typename RingBufferType>
+PerThreadRingBuffers<RingBufferType>::PerThreadRingBuffers(size_t capacity) : m_capacity{capacity} {
+}
+
+template <typename RingBufferType>
+RingBufferType* PerThreadRingBuffers<RingBufferType>::getThreadRingBuffer() {
+    return static_cast<RingBufferType*>(getThreadRingBufferBase());
+}
+
+template <typename RingBufferType>
+std::vector<std::shared_ptr<RingBufferType>> PerThreadRingBuffers<RingBufferType>::collect() {
+    auto ringBuffers = collectBase();
+    std::vector<std::shared_ptr<RingBufferType>> result;
+    result.reserve(ringBuffers.size());
+    for (auto& ringBuffer : ringBuffers) {
+        result.push_back(std::static_pointer_cast<RingBufferType>(std::move(ringBuffer)));
+    }
+    return result;
+}
+
+template <typename RingBufferType>
+template <typename Function>
+bool PerThreadRingBuffers<RingBufferType>::tryForEach(Function function) {
+    if (!m_ringBuffersMutex.try_lock()) {
+        return false;
+    }
+    for (const auto& ringBuffer : m_ringBuffers) {
+        function(static_cast<RingBufferType&>(*ringBuffer));
+    }
+    m_ringBuffersMutex.unlock();
+    return true;
+}
+
+template <typename RingBufferType>
+std::shared_ptr<PerThreadRingBuffer> PerThreadRingBuffers<RingBufferType>::createRingBuffer() const {
+    return std::make_shared<RingBufferType>(m_capacity);
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_PERTHREADRINGBUFFERS_H_
@@ -0,0 +1,145 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_WORKSTEALINGSCHEDULER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_WORKSTEALINGSCHEDULER_H_
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/**
+ * The @c WorkStealingScheduler runs jobs on a fixed set of worker threads, one per core by default.  Every worker owns
+ * a queue of jobs: jobs scheduled from a worker thread go to that worker's queue, jobs scheduled from any other thread
+ * are spread across the queues round robin, and a worker whose queue is empty steals jobs from the other queues.
+ * There is no global lock on the scheduling path, and an idle worker is only woken up when a job becomes available.
+ *
+ * The scheduler makes no ordering guarantees between jobs; @c Executor builds serial execution on top of it by never
+ * having more than one job per executor scheduled at a time.
+ *
+ * Jobs are allowed to block (for instance on a @c std::future fulfilled by a job which is still queued).  To keep such
+ * jobs from starving the queues, a monitor thread watches for periods in which all workers are busy and no queued job
+ * gets started, and adds a spare worker when that happens.  Only a few spare workers may exist at a time, so jobs
+ * which block for long still delay the other jobs.  Spare workers exit again once they have been idle for a while, so
+ * the number of threads settles back to the number of core workers.
+ */
+class WorkStealingScheduler {
+public:
+    /// A unit of work.
+    using Job = std::function<void()>;
+
+    /**
+     * Constructor.
+     *
+     * @param numWorkers The number of core workers.  If 0, @c std::thread::hardware_concurrency() is used (with a
+     *     minimum of @c MIN_DEFAULT_WORKERS).
+     * @param starvationTimeout How long all workers may be busy without starting a queued job before a spare worker
+     *     is added.
+     */
+    explicit WorkStealingScheduler(
+        size_t numWorkers = 0,
+        std::chrono::milliseconds starvationTimeout = DEFAULT_STARVATION_TIMEOUT);
+
+    /**
+     * Destructor.  Jobs which were already scheduled are still run before the workers exit.  The destructor may be
+     * called from a job running on this scheduler.
+     */
+    ~WorkStealingScheduler();
+
+    /**
+     * Schedule a job for execution on one of the workers.
+     *
+     * @param job The job to run.  Must not be empty.
+     * @return Whether the job was accepted.
+     */
+    bool schedule(Job job);
+
+    /**
+     * Get the number of core workers.
+     *
+     * @return The number of core workers.
+     */
+    size_t getNumWorkers() const;
+
+    /**
+     * Obtain statistics for the scheduler.
+     *
+     * @param jobsRun The number of jobs which have been run.
+     * @param jobsStolen The number of jobs which were run by a worker which stole them from another worker's queue.
+     * @param spareWorkersCreated The number of spare workers which were added to work around blocked jobs.
+     */
+    void getStats(uint64_t& jobsRun, uint64_t& jobsStolen, uint64_t& spareWorkersCreated) const;
+
+    /**
+     * Obtain a shared pointer to the default scheduler, for executors which opt in to running on a shared scheduler.
+     *
+     * @return A shared pointer to the scheduler.
+     */
+    static std::shared_ptr<WorkStealingScheduler> getDefaultScheduler();
+
+    /**
+     * Obtain the scheduler for executors whose tasks never block.  These executors only share the default scheduler
+     * when the configuration enables it, for instance:
+     * @code
+     * "workStealingScheduler": {
+     *     "enabled": true
+     * }
+     * @endcode
+     *
+     * @return The default scheduler if it is enabled, @c nullptr otherwise, which keeps the executor on a thread of
+     *     its own.
+     */
+    static std::shared_ptr<WorkStealingScheduler> getConfiguredScheduler();
+
+    /// Lower bound for the number of core workers when the hardware concurrency is used.
+    static const size_t MIN_DEFAULT_WORKERS;
+
+    /// Default for the time all workers may be busy without starting a queued job before a spare worker is added.
+    static const std::chrono::milliseconds DEFAULT_STARVATION_TIMEOUT;
+
+    /// Deleted copy constructor.
+    WorkStealingScheduler(const WorkStealingScheduler&) = delete;
+
+    /// Deleted assignment operator.
+    WorkStealingScheduler& operator=(const WorkStealingScheduler&) = delete;
+
+private:
+    /// Forward declaration of the state shared with the worker threads.
+    struct Core;
+
+    /// State shared with the worker threads, which may outlive this object if it is destroyed from a worker.
+    std::shared_ptr<Core> m_core;
+
+    /// The core worker threads.
+    std::vector<std::thread> m_workers;
+
+    /// The thread watching for starvation.
+    std::thread m_monitor;
+};
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_WORKSTEALINGSCHEDULER_H_
@@ -110,8 +110,8 @@ private:
     /// A map of timers and the token used to identify the task to be run.
     std::multimap<TimePoint, Token> m_timers;
 
-    /// A map of tasks to be run.
-    std::map<Token, std::pair<TimePoint, std::function<void()>>> m_tasks;
+    /// A map of tasks to be run, with their position in @c m_timers so that cancelling does not search for it.
+    std::map<Token, std::pair<std::multimap<TimePoint, Token>::iterator, std::function<void()>>> m_tasks;
 
     /// Flag indicating whether there is an ongoing timer.
     bool m_isRunning;
@@ -0,0 +1,247 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMINGWHEEL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMINGWHEEL_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A @c TimingWheel schedules many tasks on a single shared thread using a hierarchical timing wheel.
+ *
+ * Time is divided into ticks of a fixed resolution. Pending tasks are kept in @c LEVELS wheels of @c SLOTS slots,
+ * where a slot of level @c n covers @c SLOTS^n ticks. Submitting and cancelling a task are constant time operations;
+ * a task is moved to a finer level as its expiry gets closer, and the thread sleeps until the next occupied slot
+ * instead of waking up every tick.
+ *
+ * Tasks never run before their delay has elapsed, and run up to one tick late.
+ *
+ * @note Tasks run on the timer thread one at a time, so they should not block since this delays every other task
+ * scheduled on this @c TimingWheel. A task must not release the last reference to its @c TimingWheel.
+ */
+class TimingWheel {
+public:
+    /// Alias for the token used to identify a task. This can be used to cancel a task execution.
+    using Token = uint64_t;
+
+    /// The default length of a tick.
+    static const std::chrono::milliseconds DEFAULT_RESOLUTION;
+
+    /**
+     * Factory method that creates a shared pointer to a @c TimingWheel.
+     *
+     * @param resolution The length of a tick, which must be positive.
+     * @return A new instance of @c TimingWheel, or @c nullptr if @c resolution is invalid.
+     */
+    static std::shared_ptr<TimingWheel> create(std::chrono::milliseconds resolution = DEFAULT_RESOLUTION);
+
+    /**
+     * Destructor. Pending tasks are discarded and the timer thread is stopped.
+     */
+    ~TimingWheel();
+
+    /**
+     * Submits a task to be executed after a given delay.
+     *
+     * @param delay The time to wait before calling the given task. A non-positive delay runs the task as soon as
+     * possible.
+     * @param task The task to be executed.
+     * @return A unique token that can be used to cancel this task.
+     */
+    Token submitTask(std::chrono::nanoseconds delay, std::function<void()> task);
+
+    /**
+     * Removes a task from the wheel.
+     *
+     * @param token The token used to identify the task to be canceled.
+     * @return @c true if the task was pending and will not run; @c false if it already ran, is running or is unknown.
+     */
+    bool cancelTask(Token token);
+
+    /**
+     * Get the number of pending tasks.
+     *
+     * @return The number of tasks which have been submitted and have not run or been canceled yet.
+     */
+    size_t size() const;
+
+private:
+    /// Number of bits of the tick count resolved by each level.
+    static const unsigned int SLOT_BITS = 6;
+
+    /// Number of slots of each level.
+    static const unsigned int SLOTS = 1 << SLOT_BITS;
+
+    /// Number of levels. Tasks further away than @c SLOTS^LEVELS ticks wait in an overflow list.
+    static const unsigned int LEVELS = 6;
+
+    /// Pseudo level of the tasks kept in @c m_overflow.
+    static const unsigned int OVERFLOW_LEVEL = LEVELS;
+
+    /// Pseudo level of the tasks kept in @c m_expired.
+    static const unsigned int EXPIRED_LEVEL = LEVELS + 1;
+
+    /// A scheduled task.
+    struct Entry {
+        /// The token identifying the task.
+        Token token;
+
+        /// The tick at which the task expires.
+        uint64_t expiry;
+
+        /// The task.
+        std::function<void()> task;
+
+        /// The level of the list holding this entry.
+        unsigned int level;
+
+        /// The slot of the list holding this entry.
+        unsigned int slot;
+    };
+
+    /// Alias for a list of entries.
+    using EntryList = std::list<Entry>;
+
+    /**
+     * Constructor.
+     *
+     * @param resolution The length of a tick.
+     */
+    explicit TimingWheel(std::chrono::milliseconds resolution);
+
+    /// Timer thread loop.
+    void run();
+
+    /**
+     * Convert a time point to ticks since the construction of this object.
+     *
+     * @param timePoint The time point to convert.
+     * @param roundUp Whether partial ticks are rounded up, which is used for expiries so tasks never run early.
+     * @return The tick count.
+     */
+    uint64_t toTick(std::chrono::steady_clock::time_point timePoint, bool roundUp) const;
+
+    /**
+     * Get the list holding entries of a level and slot.
+     *
+     * @param level The level.
+     * @param slot The slot, ignored for the overflow and expired pseudo levels.
+     * @return The list.
+     */
+    EntryList& listLocked(unsigned int level, unsigned int slot);
+
+    /**
+     * Move an entry to the list matching its expiry relative to @c m_currentTick.
+     *
+     * @param from The list currently holding the entry.
+     * @param it The entry.
+     */
+    void placeLocked(EntryList& from, EntryList::iterator it);
+
+    /**
+     * Remove an entry from the wheel, keeping its node for reuse.
+     *
+     * @param it The entry.
+     */
+    void releaseLocked(EntryList::iterator it);
+
+    /**
+     * Find the next tick at which a slot has to be processed. Tasks already in @c m_expired are not considered.
+     *
+     * @return The tick, or @c NO_TICK if no slot is occupied.
+     */
+    uint64_t nextTickLocked() const;
+
+    /**
+     * Advance @c m_currentTick to @c tick, cascading the slots and expiring the tasks met on the way.
+     *
+     * @param tick The tick to advance to.
+     */
+    void advanceLocked(uint64_t tick);
+
+    /**
+     * Process the slots which start at @c m_currentTick.
+     */
+    void processTickLocked();
+
+    /// The length of a tick.
+    const std::chrono::nanoseconds m_resolution;
+
+    /// The time of tick 0.
+    const std::chrono::steady_clock::time_point m_origin;
+
+    /// Moniker of the timer thread.
+    const std::string m_moniker;
+
+    /// The mutex protecting the members below.
+    mutable std::mutex m_mutex;
+
+    /// The condition variable used to wait for the next tick or a new earlier task.
+    std::condition_variable m_wakeCondition;
+
+    /// The wheels.
+    EntryList m_slots[LEVELS][SLOTS];
+
+    /// A bitmap of the non-empty slots of each level.
+    uint64_t m_occupied[LEVELS];
+
+    /// Tasks which expire beyond the reach of the wheels.
+    EntryList m_overflow;
+
+    /// Tasks which are due to run.
+    EntryList m_expired;
+
+    /// Nodes of released entries, kept so that their list nodes are reused by later tasks.
+    EntryList m_free;
+
+    /// The location of each pending task.
+    std::unordered_map<Token, EntryList::iterator> m_index;
+
+    /// The tick the wheels have been advanced to.
+    uint64_t m_currentTick;
+
+    /// The tick the timer thread sleeps until.
+    uint64_t m_wakeTick;
+
+    /// The next token available.
+    Token m_nextToken;
+
+    /// Flag indicating whether object is being destructed.
+    bool m_isShuttingDown;
+
+    /// The timer thread.
+    std::thread m_thread;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMINGWHEEL_H_
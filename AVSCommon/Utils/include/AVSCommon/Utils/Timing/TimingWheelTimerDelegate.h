@@ -0,0 +1,96 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMINGWHEELTIMERDELEGATE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMINGWHEELTIMERDELEGATE_H_
+
+#include <memory>
+
+#include <AVSCommon/SDKInterfaces/Timing/TimerDelegateInterface.h>
+#include <AVSCommon/Utils/Timing/TimingWheel.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A @c TimerDelegateInterface which schedules its task calls on a shared @c TimingWheel instead of a thread of its
+ * own. Task calls run on the thread of the @c TimingWheel, so they should not block.
+ */
+class TimingWheelTimerDelegate : public sdkInterfaces::timing::TimerDelegateInterface {
+public:
+    /// @name TimerDelegateInterface Functions
+    /// @{
+    void start(
+        std::chrono::nanoseconds delay,
+        std::chrono::nanoseconds period,
+        PeriodType periodType,
+        size_t maxCount,
+        std::function<void()> task) override;
+    void stop() override;
+    bool activate() override;
+    bool isActive() const override;
+    /// @}
+
+    /**
+     * Constructor.
+     *
+     * @param wheel The @c TimingWheel to schedule task calls on.
+     */
+    explicit TimingWheelTimerDelegate(std::shared_ptr<TimingWheel> wheel);
+
+    /// Destructor.
+    ~TimingWheelTimerDelegate() override;
+
+private:
+    /// State shared with the callbacks scheduled on the @c TimingWheel, which may outlive this object.
+    struct State;
+
+    /**
+     * Schedule the next task call. @c State::mutex must be held.
+     *
+     * @param wheel The @c TimingWheel to schedule on.
+     * @param state The timer state.
+     * @param delay The time to wait before the call.
+     */
+    static void scheduleLocked(
+        TimingWheel* wheel,
+        const std::shared_ptr<State>& state,
+        std::chrono::nanoseconds delay);
+
+    /**
+     * Make a task call and schedule the next one.
+     *
+     * @param wheel The @c TimingWheel the call was scheduled on.
+     * @param state The timer state.
+     * @param generation The value of @c State::generation when the call was scheduled. The call is dropped if the
+     * timer has been stopped or restarted since.
+     */
+    static void onTimeout(TimingWheel* wheel, const std::shared_ptr<State>& state, uint64_t generation);
+
+    /// The @c TimingWheel used by this timer.
+    std::shared_ptr<TimingWheel> m_wheel;
+
+    /// The timer state.
+    std::shared_ptr<State> m_state;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMINGWHEELTIMERDELEGATE_H_
@@ -0,0 +1,59 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMINGWHEELTIMERDELEGATEFACTORY_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMINGWHEELTIMERDELEGATEFACTORY_H_
+
+#include <memory>
+
+#include <AVSCommon/SDKInterfaces/Timing/TimerDelegateFactoryInterface.h>
+#include <AVSCommon/Utils/Timing/TimingWheel.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A @c TimerDelegateFactoryInterface whose timers all share one @c TimingWheel, and so a single thread, instead of
+ * running a thread per timer. It can replace the default @c TimerDelegateFactory through
+ * @c InitializationParametersBuilder::withTimerDelegateFactory() when timer tasks do not block.
+ */
+class TimingWheelTimerDelegateFactory : public avsCommon::sdkInterfaces::timing::TimerDelegateFactoryInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param wheel The @c TimingWheel to share between timers. If @c nullptr, a new one is created.
+     */
+    explicit TimingWheelTimerDelegateFactory(std::shared_ptr<TimingWheel> wheel = nullptr);
+
+    /// @name TimerDelegateFactoryInterface Functions
+    /// @{
+    bool supportsLowPowerMode() override;
+    std::unique_ptr<sdkInterfaces::timing::TimerDelegateInterface> getTimerDelegate() override;
+    /// @}
+
+private:
+    /// The @c TimingWheel shared by the timers.
+    std::shared_ptr<TimingWheel> m_wheel;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMINGWHEELTIMERDELEGATEFACTORY_H_
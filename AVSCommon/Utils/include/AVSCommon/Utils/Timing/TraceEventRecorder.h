@@ -0,0 +1,155 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TRACEEVENTRECORDER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TRACEEVENTRECORDER_H_
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * Class to collect timed events and serialize them in the Chrome trace event format, so that they can be
+ * inspected with chrome://tracing or Perfetto.  Each event records the thread it was recorded on, so work done in
+ * parallel shows up as separate tracks.
+ *
+ * @note This class is thread safe.
+ */
+class TraceEventRecorder {
+public:
+    /// Alias for the clock used to time events.
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Helper that records a complete event spanning its own lifetime.
+     */
+    class Scope {
+    public:
+        /**
+         * Constructor.  Starts timing the event.
+         *
+         * @param recorder The recorder to add the event to.  If @c nullptr, nothing is recorded.
+         * @param name The name of the event.
+         * @param category The category of the event.
+         */
+        Scope(std::shared_ptr<TraceEventRecorder> recorder, const std::string& name, const std::string& category);
+
+        /**
+         * Destructor.  Records the event.
+         */
+        ~Scope();
+
+    private:
+        /// The recorder to add the event to.
+        std::shared_ptr<TraceEventRecorder> m_recorder;
+
+        /// The name of the event.
+        std::string m_name;
+
+        /// The category of the event.
+        std::string m_category;
+
+        /// When the event started.
+        Clock::time_point m_start;
+    };
+
+    /**
+     * Constructor.  Event timestamps are reported relative to the time the recorder was created.
+     */
+    TraceEventRecorder();
+
+    /**
+     * Record an event with a known start and end on the calling thread.
+     *
+     * @param name The name of the event.
+     * @param category The category of the event.
+     * @param start When the event started.
+     * @param end When the event ended.
+     */
+    void recordCompleteEvent(
+        const std::string& name,
+        const std::string& category,
+        Clock::time_point start,
+        Clock::time_point end);
+
+    /**
+     * Get the number of events recorded so far.
+     *
+     * @return The number of events recorded so far.
+     */
+    size_t getEventCount() const;
+
+    /**
+     * Serialize the recorded events.
+     *
+     * @return A JSON object in the Chrome trace event format.
+     */
+    std::string toJson() const;
+
+    /**
+     * Write the recorded events to a file, replacing any previous contents.
+     *
+     * @param path The path of the file to write.
+     * @return Whether the file was written.
+     */
+    bool writeToFile(const std::string& path) const;
+
+private:
+    /// A single recorded event.
+    struct Event {
+        /// The name of the event.
+        std::string name;
+
+        /// The category of the event.
+        std::string category;
+
+        /// Start of the event, in microseconds since @c m_origin.
+        int64_t startUs;
+
+        /// Duration of the event, in microseconds.
+        int64_t durationUs;
+
+        /// Small id of the thread that recorded the event.
+        int threadId;
+    };
+
+    /// The time that event timestamps are relative to.
+    const Clock::time_point m_origin;
+
+    /// Serializes access to @c m_events and @c m_threadIds.
+    mutable std::mutex m_mutex;
+
+    /// The events recorded so far.
+    std::vector<Event> m_events;
+
+    /// Small sequential ids handed out to the threads that have recorded events, which read better than native ids.
+    std::unordered_map<std::thread::id, int> m_threadIds;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TRACEEVENTRECORDER_H_
@@ -29,6 +29,7 @@
 #include <AVSCommon/Utils/Threading/ExecutorInterface.h>
 #include <AVSCommon/Utils/Threading/Executor.h>
 #include <AVSCommon/Utils/Threading/TaskThread.h>
+#include <AVSCommon/Utils/Threading/WorkStealingScheduler.h>
 #include <AVSCommon/Utils/Power/PowerResource.h>
 
 namespace alexaClientSDK {
@@ -40,13 +41,19 @@ namespace threading {
  * @brief Shared executor implementation.
  *
  * This implementation is managed by std::shared_ptr<ExecutorInterface>.
+ *
+ * By default the executor runs its tasks on its own @c TaskThread.  If it is given a @c WorkStealingScheduler, it runs
+ * as a serial strand on that scheduler instead: while it has tasks, exactly one job which runs them is scheduled, so
+ * tasks still run one at a time and in queue order, but the executor does not own a thread.
  */
 class SharedExecutor : public virtual ExecutorInterface {
 public:
     /**
      * @brief Constructs an object.
+     *
+     * @param scheduler The scheduler to run the tasks on, or @c nullptr to run them on a dedicated thread.
      */
-    SharedExecutor() noexcept;
+    SharedExecutor(std::shared_ptr<WorkStealingScheduler> scheduler = nullptr) noexcept;
 
     /**
      * @brief Destructs an Executor.
@@ -90,6 +97,12 @@ private:
     /// The queue type to use for holding tasks.
     using Queue = std::deque<std::function<void()>>;
 
+    /**
+     * Runs up to @c MAX_TASKS_PER_TURN tasks from the queue on the calling scheduler worker, and schedules itself
+     * again if tasks remain.
+     */
+    void runStrand() noexcept;
+
     /**
      * Executes the next job in the queue.
      *
@@ -131,19 +144,25 @@ private:
     /// The queue of tasks
     Queue m_queue;
 
-    /// Flag to indicate if the taskThread already have an executing job.
+    /// Flag to indicate if the task thread or a strand job is running the tasks in @c m_queue.
     bool m_threadRunning;
 
     /// A mutex to protect access to the tasks in m_queue.
     std::mutex m_queueMutex;
 
+    /// Condition variable notified when @c m_threadRunning becomes false.
+    std::condition_variable m_strandStopped;
+
     /// A flag for whether or not the queue is expecting more tasks.
     std::atomic_bool m_shutdown;
 
     /// A @c PowerResource.
     std::shared_ptr<power::PowerResource> m_powerResource;
 
-    /// The thread to execute tasks on. The thread must be declared last to be destructed first.
+    /// The scheduler which runs this executor's tasks, or @c nullptr if they run on @c m_taskThread.
+    std::shared_ptr<WorkStealingScheduler> m_scheduler;
+
+    /// The thread to execute tasks on without a scheduler. The thread must be declared last to be destructed first.
     TaskThread m_taskThread;
 };
 
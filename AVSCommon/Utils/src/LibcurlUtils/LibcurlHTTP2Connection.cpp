@@ -12,6 +12,8 @@
  * express or implied. See the License for the specific language governing
  * permissions and limitations under the License.
  */
+#include <algorithm>
+
 #include <curl/multi.h>
 
 #include <AVSCommon/Utils/Logger/Logger.h>
@@ -44,10 +46,18 @@ using namespace avsCommon::utils::http2;
  */
 #define LX_P(event) LX(event).p("this", this)
 
-/// Timeout for curl_multi_wait
-const static std::chrono::milliseconds WAIT_FOR_ACTIVITY_TIMEOUT(50);
+const std::chrono::milliseconds LibcurlHTTP2Connection::WAIT_FOR_ACTIVITY_TIMEOUT(50);
 /// Timeout for curl_multi_wait while all non-intermittent HTTP/2 streams are paused.
 const static std::chrono::milliseconds WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT(10);
+#if CURL_AT_LEAST_VERSION(7, 68, 0)
+/// Timeout for curl_multi_poll while only intermittent HTTP/2 streams (e.g. the downchannel) are active. New requests
+/// and cancellations interrupt the poll via curl_multi_wakeup, so this only bounds how long the loop stays asleep.
+const static std::chrono::milliseconds WAIT_FOR_ACTIVITY_WHILE_IDLE_TIMEOUT(1000);
+#else
+/// Without curl_multi_wakeup the poll cannot be interrupted, so idle connections keep the regular timeout.
+const static std::chrono::milliseconds WAIT_FOR_ACTIVITY_WHILE_IDLE_TIMEOUT =
+    LibcurlHTTP2Connection::WAIT_FOR_ACTIVITY_TIMEOUT;
+#endif
 
 #ifdef ACSDK_OPENSSL_MIN_VER_REQUIRED
 /**
@@ -124,6 +134,7 @@ static bool performCurlChecks() {
 LibcurlHTTP2Connection::LibcurlHTTP2Connection(
     const std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface>& setCurlOptionsCallback) :
         m_isStopping{false},
+        m_isWakeupRequested{false},
         m_setCurlOptionsCallback{setCurlOptionsCallback} {
     ACSDK_DEBUG5(LX_P("init"));
     m_networkThread = std::thread(&LibcurlHTTP2Connection::networkLoop, this);
@@ -172,6 +183,23 @@ void LibcurlHTTP2Connection::setIsStopping() {
     }
 }
 
+void LibcurlHTTP2Connection::wakeupNetworkLoop() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isWakeupRequested = true;
+    m_cv.notify_one();
+    auto multiCurlHandle = m_multi;
+    if (multiCurlHandle) {
+        multiCurlHandle->wakeup();
+    }
+}
+
+void LibcurlHTTP2Connection::waitForWakeup(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait_for(
+        lock, timeout, [this] { return m_isStopping || m_isWakeupRequested || !m_requestQueue.empty(); });
+    m_isWakeupRequested = false;
+}
+
 std::shared_ptr<LibcurlHTTP2Request> LibcurlHTTP2Connection::dequeueRequest() {
     std::lock_guard<std::mutex> lock(m_mutex);
     if (m_isStopping || m_requestQueue.empty()) {
@@ -195,6 +223,7 @@ void LibcurlHTTP2Connection::processNextRequest() {
         m_activeStreams[handle] = stream;
     } else {
         ACSDK_ERROR(LX_P("processNextRequest").d("reason", "addHandleFailed").d("error", curl_multi_strerror(result)));
+        stream->setWakeupCallback(nullptr);
         stream->reportCompletion(HTTP2ResponseFinishedStatus::INTERNAL_ERROR);
     }
 }
@@ -241,7 +270,7 @@ void LibcurlHTTP2Connection::networkLoop() {
             processNextRequest();
 
             auto before = std::chrono::time_point<std::chrono::steady_clock>::max();
-            auto multiWaitTimeout = WAIT_FOR_ACTIVITY_TIMEOUT;
+            auto multiWaitTimeout = getPollTimeout();
             bool paused = areStreamsPaused();
             if (paused) {
                 multiWaitTimeout = WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT;
@@ -259,15 +288,17 @@ void LibcurlHTTP2Connection::networkLoop() {
 
             // @note curl_multi_wait will return immediately even if all streams are paused, because HTTP/2 streams
             // are full-duplex - so activity may have occurred on the other side. Therefore, if our intent is to pause
-            // transfers to give the readers / writers time to catch up, we must perform a local sleep of our own.
+            // transfers to give the readers / writers time to catch up, we must wait locally. The wait ends early
+            // when a new request is queued, a stream is cancelled or the loop is stopping, so that new requests (e.g.
+            // a Recognize upload) do not pay for the remainder of the paused timeout.
             if (paused) {
                 auto after = std::chrono::steady_clock::now();
                 auto elapsed = after - before;
-                auto remaining = multiWaitTimeout - elapsed;
+                auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(multiWaitTimeout - elapsed);
 
-                // sanity check that remainingMs is valid before performing a sleep.
+                // sanity check that remainingMs is valid before waiting.
                 if (remaining.count() > 0 && remaining <= WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT) {
-                    std::this_thread::sleep_for(remaining);
+                    waitForWakeup(remaining);
                 }
             }
             unPauseActiveStreams();
@@ -325,18 +356,24 @@ bool LibcurlHTTP2Connection::addStream(std::shared_ptr<LibcurlHTTP2Request> stre
         ACSDK_ERROR(LX_P("addStream").d("failed", "null stream"));
         return false;
     }
-    std::lock_guard<std::mutex> lock(m_mutex);
-    if (m_isStopping) {
-        ACSDK_ERROR(LX_P("addStream").d("failed", "network loop stopping"));
-        return false;
-    }
-    m_requestQueue.push_back(std::move(stream));
-    m_cv.notify_one();
-    auto multiCurlHandle = m_multi;
-    if (multiCurlHandle) {
-        multiCurlHandle->wakeup();
+    // The wakeup callback is installed and cleared without holding m_mutex: cancel() invokes it while holding the
+    // request's callback mutex, and the callback locks m_mutex.
+    stream->setWakeupCallback([this] { wakeupNetworkLoop(); });
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_isStopping) {
+            m_requestQueue.push_back(stream);
+            m_cv.notify_one();
+            auto multiCurlHandle = m_multi;
+            if (multiCurlHandle) {
+                multiCurlHandle->wakeup();
+            }
+            return true;
+        }
     }
-    return true;
+    ACSDK_ERROR(LX_P("addStream").d("failed", "network loop stopping"));
+    stream->setWakeupCallback(nullptr);
+    return false;
 }
 
 void LibcurlHTTP2Connection::cleanupFinishedStreams() {
@@ -398,9 +435,24 @@ bool LibcurlHTTP2Connection::areStreamsPaused() {
     return numberPausedStreams > 0 && (numberPausedStreams == numberNonIntermittentStreams);
 }
 
+std::chrono::milliseconds LibcurlHTTP2Connection::getPollTimeout() {
+    auto timeout = WAIT_FOR_ACTIVITY_WHILE_IDLE_TIMEOUT;
+    for (const auto& entry : m_activeStreams) {
+        const auto& stream = entry.second;
+        if (!stream->isIntermittentTransferExpected() || stream->isPaused()) {
+            return WAIT_FOR_ACTIVITY_TIMEOUT;
+        }
+        // Wake up in time to notice streams that stall.
+        timeout = std::min(timeout, stream->getTimeUntilProgressTimeout());
+    }
+    return timeout;
+}
+
 void LibcurlHTTP2Connection::unPauseActiveStreams() {
     for (auto& stream : m_activeStreams) {
-        stream.second->unPause();
+        if (stream.second->isPaused()) {
+            stream.second->unPause();
+        }
     }
 }
 
@@ -427,6 +479,7 @@ void LibcurlHTTP2Connection::cancelPendingStreams() {
 
     for (auto pendingStream : pendingStreamsCopy) {
         ACSDK_DEBUG9(LX_P("cancelPendingStreams").d("pending streamId", pendingStream->getId()));
+        pendingStream->setWakeupCallback(nullptr);
         pendingStream->reportCompletion(HTTP2ResponseFinishedStatus::CANCELLED);
     }
 }
@@ -441,6 +494,7 @@ bool LibcurlHTTP2Connection::releaseStream(ActiveStreamMap::iterator& iterator)
     auto stream = iterator->second;
     auto handle = stream->getCurlHandle();
     ACSDK_DEBUG9(LX_P("releaseStream").d("streamId", stream->getId()));
+    stream->setWakeupCallback(nullptr);
     auto result = m_multi->removeHandle(handle);
     iterator = m_activeStreams.erase(iterator);
     if (result != CURLM_OK) {
@@ -214,6 +214,19 @@ bool LibcurlHTTP2Request::hasProgressTimedOut() const {
     return duration_cast<milliseconds>(steady_clock::now() - m_timeOfLastTransfer) > m_activityTimeout;
 }
 
+milliseconds LibcurlHTTP2Request::getTimeUntilProgressTimeout() const {
+    milliseconds timeout;
+    if (!m_responseCodeReported && milliseconds::zero() != m_connectTimeout) {
+        timeout = m_connectTimeout;
+    } else if (m_activityTimeout != milliseconds::zero()) {
+        timeout = m_activityTimeout;
+    } else {
+        return milliseconds::max();  // no activity timeout checks
+    }
+    auto elapsed = duration_cast<milliseconds>(steady_clock::now() - m_timeOfLastTransfer);
+    return elapsed < timeout ? timeout - elapsed : milliseconds::zero();
+}
+
 bool LibcurlHTTP2Request::isIntermittentTransferExpected() const {
     return m_isIntermittentTransferExpected;
 }
@@ -233,9 +246,18 @@ bool LibcurlHTTP2Request::isCancelled() const {
 
 bool LibcurlHTTP2Request::cancel() {
     m_isCancelled = true;
+    std::lock_guard<std::mutex> lock(m_wakeupCallbackMutex);
+    if (m_wakeupCallback) {
+        m_wakeupCallback();
+    }
     return true;
 }
 
+void LibcurlHTTP2Request::setWakeupCallback(std::function<void()> wakeupCallback) {
+    std::lock_guard<std::mutex> lock(m_wakeupCallbackMutex);
+    m_wakeupCallback = std::move(wakeupCallback);
+}
+
 std::string LibcurlHTTP2Request::getId() const {
     return m_stream.getId();
 }
@@ -0,0 +1,379 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <csignal>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include <unistd.h>
+
+#include "AVSCommon/Utils/Logger/AsyncLogger.h"
+#include "AVSCommon/Utils/Logger/ThreadMoniker.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AsyncLogger");
+
+/// Configuration key for AsyncLogger settings.
+static const std::string CONFIG_KEY_ASYNC_LOGGER = "asyncLogger";
+
+const size_t AsyncLogger::DEFAULT_RING_BUFFER_SIZE = 64 * 1024;
+
+/// Smallest supported ring buffer size.
+static const size_t MIN_RING_BUFFER_SIZE = 1024;
+
+/// The logger flushed by the crash handler.
+static std::atomic<AsyncLogger*> crashLogger{nullptr};
+
+/// Keeps the logger flushed by the crash handler alive.
+static std::shared_ptr<AsyncLogger> crashLoggerReference;
+
+/// Serializes calls to @c AsyncLogger::installCrashHandler().
+static std::mutex crashLoggerMutex;
+
+/// The file descriptor the crash handler writes the buffered entries to.
+static std::atomic<int> crashFd{STDERR_FILENO};
+
+/// The fatal signals for which the crash handler is installed.
+static const int FATAL_SIGNALS[] = {SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT};
+
+/**
+ * A single producer / single consumer ring buffer of binary log records.  The producer is the thread which owns it,
+ * the consumer is whichever thread holds @c AsyncLogger::m_drainMutex.
+ */
+class AsyncLogger::RingBuffer : public threading::PerThreadRingBuffer {
+public:
+    /**
+     * Constructor.
+     *
+     * @param size The size of the buffer in bytes; must be a power of two.
+     */
+    explicit RingBuffer(size_t size) : PerThreadRingBuffer(size), m_buffer(size) {
+    }
+
+    /**
+     * Append a record.  Called by the owning thread only.
+     *
+     * @param level The severity level of the entry.
+     * @param time The time of the entry.
+     * @param threadMoniker The moniker of the logging thread.
+     * @param text The text of the entry.
+     * @return Whether the record was appended (@c false if it was dropped).
+     */
+    bool push(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text) {
+        Header header;
+        header.timeSinceEpoch = time.time_since_epoch().count();
+        header.level = static_cast<uint8_t>(level);
+        auto monikerSize = std::strlen(threadMoniker);
+        auto textSize = std::strlen(text);
+        // Keep every record below half of the buffer, so that one huge entry cannot starve all others.
+        auto maxPayload = m_buffer.size() / 2 - sizeof(Header);
+        header.monikerSize = static_cast<uint16_t>(std::min<size_t>(monikerSize, UINT16_MAX));
+        header.monikerSize = static_cast<uint16_t>(std::min<size_t>(header.monikerSize, maxPayload));
+        header.textSize = static_cast<uint32_t>(std::min<size_t>(textSize, maxPayload - header.monikerSize));
+
+        auto recordSize = sizeof(Header) + header.monikerSize + header.textSize;
+        uint64_t head;
+        if (!beginPush(recordSize, &head)) {
+            return false;
+        }
+        write(head, &header, sizeof(Header));
+        write(head + sizeof(Header), threadMoniker, header.monikerSize);
+        write(head + sizeof(Header) + header.monikerSize, text, header.textSize);
+        endPush(head + recordSize);
+        return true;
+    }
+
+    /**
+     * Remove the oldest record.  Called by the consumer only.
+     *
+     * @param[out] level The severity level of the entry.
+     * @param[out] time The time of the entry.
+     * @param[out] threadMoniker The moniker of the logging thread.
+     * @param[out] text The text of the entry.
+     * @return Whether a record was removed.
+     */
+    bool pop(Level* level, std::chrono::system_clock::time_point* time, std::string* threadMoniker, std::string* text) {
+        uint64_t tail;
+        if (!beginPop(&tail)) {
+            return false;
+        }
+        Header header;
+        read(tail, &header, sizeof(Header));
+        *level = static_cast<Level>(header.level);
+        *time = std::chrono::system_clock::time_point(std::chrono::system_clock::duration(header.timeSinceEpoch));
+        threadMoniker->resize(header.monikerSize);
+        read(tail + sizeof(Header), &(*threadMoniker)[0], header.monikerSize);
+        text->resize(header.textSize);
+        read(tail + sizeof(Header) + header.monikerSize, &(*text)[0], header.textSize);
+        endPop(tail + sizeof(Header) + header.monikerSize + header.textSize);
+        return true;
+    }
+
+    /**
+     * Write all records to a file descriptor, as "[<moniker>] <level> <text>" lines, and remove them.  Called by the
+     * consumer only.  This is async-signal-safe: it neither allocates nor locks.
+     *
+     * @param fd The file descriptor to write to.
+     */
+    void writeTo(int fd) {
+        uint64_t tail;
+        while (beginPop(&tail)) {
+            Header header;
+            read(tail, &header, sizeof(Header));
+            char level[] = {']', ' ', convertLevelToChar(static_cast<Level>(header.level)), ' '};
+            writeFully(fd, "[", 1);
+            writeTo(fd, tail + sizeof(Header), header.monikerSize);
+            writeFully(fd, level, sizeof(level));
+            writeTo(fd, tail + sizeof(Header) + header.monikerSize, header.textSize);
+            writeFully(fd, "\n", 1);
+            endPop(tail + sizeof(Header) + header.monikerSize + header.textSize);
+        }
+    }
+
+private:
+    /// The fixed size part of a record.
+    struct Header {
+        /// @c std::chrono::system_clock ticks since the epoch.
+        int64_t timeSinceEpoch;
+        /// Size of the text which follows the moniker.
+        uint32_t textSize;
+        /// Size of the moniker which follows the header.
+        uint16_t monikerSize;
+        /// The @c Level of the entry.
+        uint8_t level;
+    };
+
+    /**
+     * Copy bytes into the buffer, wrapping around its end.
+     *
+     * @param position The position to write at.
+     * @param data The bytes to copy.
+     * @param size The number of bytes to copy.
+     */
+    void write(uint64_t position, const void* data, size_t size) {
+        auto offset = getOffset(position);
+        auto first = std::min(size, m_buffer.size() - offset);
+        std::memcpy(&m_buffer[offset], data, first);
+        std::memcpy(&m_buffer[0], static_cast<const uint8_t*>(data) + first, size - first);
+    }
+
+    /**
+     * Write bytes of the buffer to a file descriptor, wrapping around its end.
+     *
+     * @param fd The file descriptor to write to.
+     * @param position The position to write from.
+     * @param size The number of bytes to write.
+     */
+    void writeTo(int fd, uint64_t position, size_t size) const {
+        auto offset = getOffset(position);
+        auto first = std::min(size, m_buffer.size() - offset);
+        writeFully(fd, &m_buffer[offset], first);
+        writeFully(fd, &m_buffer[0], size - first);
+    }
+
+    /**
+     * Write bytes to a file descriptor, retrying on short writes.  Errors are ignored, as there is nobody to report
+     * them to.
+     *
+     * @param fd The file descriptor to write to.
+     * @param data The bytes to write.
+     * @param size The number of bytes to write.
+     */
+    static void writeFully(int fd, const void* data, size_t size) {
+        auto bytes = static_cast<const uint8_t*>(data);
+        while (size > 0) {
+            auto written = ::write(fd, bytes, size);
+            if (written <= 0) {
+                return;
+            }
+            bytes += written;
+            size -= static_cast<size_t>(written);
+        }
+    }
+
+    /**
+     * Copy bytes out of the buffer, wrapping around its end.
+     *
+     * @param position The position to read from.
+     * @param data Where to copy the bytes to.
+     * @param size The number of bytes to copy.
+     */
+    void read(uint64_t position, void* data, size_t size) const {
+        auto offset = getOffset(position);
+        auto first = std::min(size, m_buffer.size() - offset);
+        std::memcpy(data, &m_buffer[offset], first);
+        std::memcpy(static_cast<uint8_t*>(data) + first, &m_buffer[0], size - first);
+    }
+
+    /// The storage of the ring buffer.
+    std::vector<uint8_t> m_buffer;
+};
+
+std::shared_ptr<AsyncLogger> AsyncLogger::create(std::shared_ptr<Logger> sink, size_t ringBufferSize) {
+    if (!sink) {
+        return nullptr;
+    }
+    ringBufferSize = threading::roundUpToPowerOfTwo(std::max(ringBufferSize, MIN_RING_BUFFER_SIZE));
+    return std::shared_ptr<AsyncLogger>(new AsyncLogger(std::move(sink), ringBufferSize));
+}
+
+AsyncLogger::AsyncLogger(std::shared_ptr<Logger> sink, size_t ringBufferSize) :
+        Logger(Level::UNKNOWN),
+        m_sink{std::move(sink)},
+        m_ringBuffers{ringBufferSize},
+        m_reportedDrops{0},
+        m_drainThreadIdle{false},
+        m_stop{false} {
+#ifdef DEBUG
+    setLevel(Level::DEBUG9);
+#else
+    setLevel(Level::INFO);
+#endif  // DEBUG
+    init(configuration::ConfigurationNode::getRoot()[CONFIG_KEY_ASYNC_LOGGER]);
+    m_drainThread = std::thread(&AsyncLogger::drainLoop, this);
+}
+
+AsyncLogger::~AsyncLogger() {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_stop = true;
+        m_wakeCondition.notify_one();
+    }
+    if (m_drainThread.joinable()) {
+        m_drainThread.join();
+    }
+}
+
+void AsyncLogger::emit(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    if (m_ringBuffers.getThreadRingBuffer()->push(level, time, threadMoniker, text) && m_drainThreadIdle.load() &&
+        m_drainThreadIdle.exchange(false)) {
+        wakeDrainThread();
+    }
+}
+
+void AsyncLogger::flush() {
+    std::lock_guard<std::mutex> lock(m_drainMutex);
+    drainLocked();
+}
+
+uint64_t AsyncLogger::getDroppedCount() const {
+    return m_ringBuffers.getDroppedCount();
+}
+
+void AsyncLogger::drainLoop() {
+    ThreadMoniker::setThisThreadMoniker(ThreadMoniker::generateMoniker());
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(m_drainMutex);
+            drainLocked();
+        }
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        if (m_stop) {
+            break;
+        }
+        // Announce that we are about to sleep before the final check for records; a producer appends its record
+        // before checking this flag, so either we see the record or the producer sees the flag and wakes us up.
+        m_drainThreadIdle = true;
+        if (!m_ringBuffers.empty()) {
+            m_drainThreadIdle = false;
+            continue;
+        }
+        m_wakeCondition.wait(lock, [this] { return !m_drainThreadIdle || m_stop; });
+    }
+
+    std::lock_guard<std::mutex> lock(m_drainMutex);
+    drainLocked();
+}
+
+bool AsyncLogger::drainLocked() {
+    bool forwarded = false;
+    Level level;
+    std::chrono::system_clock::time_point time;
+    for (auto& ringBuffer : m_ringBuffers.collect()) {
+        while (ringBuffer->pop(&level, &time, &m_threadMonikerScratch, &m_textScratch)) {
+            m_sink->emit(level, time, m_threadMonikerScratch.c_str(), m_textScratch.c_str());
+            forwarded = true;
+        }
+    }
+
+    auto dropped = getDroppedCount();
+    if (dropped > m_reportedDrops) {
+        LogEntry entry(TAG, "entriesDropped");
+        entry.d("count", dropped - m_reportedDrops).d("total", dropped);
+        m_sink->emit(
+            Level::WARN,
+            std::chrono::system_clock::now(),
+            ThreadMoniker::getThisThreadMoniker().c_str(),
+            entry.c_str());
+        m_reportedDrops = dropped;
+    }
+    return forwarded;
+}
+
+void AsyncLogger::wakeDrainThread() {
+    std::lock_guard<std::mutex> lock(m_wakeMutex);
+    m_wakeCondition.notify_one();
+}
+
+void AsyncLogger::installCrashHandler(std::shared_ptr<AsyncLogger> logger) {
+    installCrashHandler(std::move(logger), STDERR_FILENO);
+}
+
+void AsyncLogger::installCrashHandler(std::shared_ptr<AsyncLogger> logger, int fd) {
+    std::lock_guard<std::mutex> lock(crashLoggerMutex);
+    crashFd = fd;
+    crashLogger = logger.get();
+    crashLoggerReference = std::move(logger);
+    if (!crashLogger) {
+        return;
+    }
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = &AsyncLogger::onFatalSignal;
+    sigemptyset(&action.sa_mask);
+    // Restore the default disposition on entry, so that re-raising the signal terminates the process.
+    action.sa_flags = SA_RESETHAND;
+    for (auto signal : FATAL_SIGNALS) {
+        sigaction(signal, &action, nullptr);
+    }
+}
+
+void AsyncLogger::onFatalSignal(int signal) {
+    // Nothing here may block or allocate: the crashing thread may hold any lock, including the allocator's. The
+    // entries are written straight to the crash file descriptor, bypassing the sink and its locks.
+    auto logger = crashLogger.load();
+    if (logger && logger->m_drainMutex.try_lock()) {
+        auto fd = crashFd.load();
+        logger->m_ringBuffers.tryForEach([fd](RingBuffer& ringBuffer) { ringBuffer.writeTo(fd); });
+        logger->m_drainMutex.unlock();
+    }
+    raise(signal);
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,80 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Metrics/MetricNameRegistry.h"
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+
+const MetricNameId MetricNameRegistry::INVALID_ID = 0;
+
+/// The table of interned names.
+struct NameTable {
+    /// Serializes access to the table.
+    std::mutex mutex;
+
+    /// The interned names indexed by identifier; a @c std::deque does not move its elements when it grows.
+    std::deque<std::string> names{std::string()};
+
+    /// Map from names to their identifiers.
+    std::unordered_map<std::string, MetricNameId> ids;
+};
+
+/**
+ * Get the table of interned names.  It is created on first use so that names can be interned during static
+ * initialization, and never destroyed so that names can be looked up during static destruction.
+ *
+ * @return The table of interned names.
+ */
+static NameTable& getNameTable() {
+    static NameTable* table = new NameTable();
+    return *table;
+}
+
+MetricNameId MetricNameRegistry::intern(const std::string& name) {
+    if (name.empty()) {
+        return INVALID_ID;
+    }
+    auto& table = getNameTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto it = table.ids.find(name);
+    if (it != table.ids.end()) {
+        return it->second;
+    }
+    auto id = static_cast<MetricNameId>(table.names.size());
+    table.names.push_back(name);
+    table.ids.emplace(name, id);
+    return id;
+}
+
+const std::string& MetricNameRegistry::getName(MetricNameId id) {
+    auto& table = getNameTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    if (id >= table.names.size()) {
+        return table.names[INVALID_ID];
+    }
+    return table.names[id];
+}
+
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
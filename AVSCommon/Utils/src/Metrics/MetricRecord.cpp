@@ -0,0 +1,150 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Metrics/MetricRecord.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#include "AVSCommon/Utils/Metrics/MetricEventBuilder.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+
+const size_t MetricRecord::MAX_DATA_POINTS;
+const size_t MetricRecord::STRING_STORAGE_SIZE;
+
+/// Number of bits by which the offset of a string value is shifted in @c DataPointRecord::value.
+static const unsigned STRING_OFFSET_SHIFT = 32;
+
+/// Mask of the size of a string value in @c DataPointRecord::value.
+static const uint64_t STRING_SIZE_MASK = 0xffffffff;
+
+MetricRecord::MetricRecord() : MetricRecord(MetricNameRegistry::INVALID_ID, Priority::NORMAL, {}) {
+}
+
+MetricRecord::MetricRecord(
+    MetricNameId activityName,
+    Priority priority,
+    std::chrono::steady_clock::time_point timestamp) :
+        m_timestamp{timestamp},
+        m_activityName{activityName},
+        m_priority{static_cast<uint8_t>(priority)},
+        m_dataPointCount{0},
+        m_truncated{false},
+        m_stringSize{0} {
+}
+
+MetricRecord& MetricRecord::addCounter(MetricNameId name, uint64_t count) {
+    addDataPoint(name, DataType::COUNTER, count);
+    return *this;
+}
+
+MetricRecord& MetricRecord::addDuration(MetricNameId name, std::chrono::milliseconds duration) {
+    addDataPoint(name, DataType::DURATION, duration.count() > 0 ? static_cast<uint64_t>(duration.count()) : 0);
+    return *this;
+}
+
+MetricRecord& MetricRecord::addString(MetricNameId name, const std::string& value) {
+    if (m_dataPointCount == MAX_DATA_POINTS) {
+        m_truncated = true;
+        return *this;
+    }
+    auto size = std::min(value.size(), STRING_STORAGE_SIZE - m_stringSize);
+    if (size < value.size()) {
+        m_truncated = true;
+    }
+    std::memcpy(m_strings + m_stringSize, value.data(), size);
+    addDataPoint(name, DataType::STRING, (static_cast<uint64_t>(m_stringSize) << STRING_OFFSET_SHIFT) | size);
+    m_stringSize += static_cast<uint16_t>(size);
+    return *this;
+}
+
+MetricNameId MetricRecord::getActivityName() const {
+    return m_activityName;
+}
+
+Priority MetricRecord::getPriority() const {
+    return static_cast<Priority>(m_priority);
+}
+
+std::chrono::steady_clock::time_point MetricRecord::getSteadyTimestamp() const {
+    return m_timestamp;
+}
+
+size_t MetricRecord::getDataPointCount() const {
+    return m_dataPointCount;
+}
+
+MetricNameId MetricRecord::getDataPointName(size_t index) const {
+    return m_dataPoints[index].name;
+}
+
+DataType MetricRecord::getDataPointType(size_t index) const {
+    return static_cast<DataType>(m_dataPoints[index].type);
+}
+
+uint64_t MetricRecord::getNumericValue(size_t index) const {
+    return getDataPointType(index) == DataType::STRING ? 0 : m_dataPoints[index].value;
+}
+
+std::string MetricRecord::getStringValue(size_t index) const {
+    if (getDataPointType(index) != DataType::STRING) {
+        return std::string();
+    }
+    auto value = m_dataPoints[index].value;
+    return std::string(m_strings + (value >> STRING_OFFSET_SHIFT), value & STRING_SIZE_MASK);
+}
+
+bool MetricRecord::isTruncated() const {
+    return m_truncated;
+}
+
+std::shared_ptr<MetricEvent> MetricRecord::toMetricEvent() const {
+    if (m_activityName == MetricNameRegistry::INVALID_ID) {
+        return nullptr;
+    }
+    std::unordered_map<std::string, DataPoint> dataPoints;
+    for (size_t i = 0; i < m_dataPointCount; ++i) {
+        const auto& name = MetricNameRegistry::getName(m_dataPoints[i].name);
+        auto type = getDataPointType(i);
+        auto value = type == DataType::STRING ? getStringValue(i) : std::to_string(m_dataPoints[i].value);
+        auto key = MetricEventBuilder::generateKey(name, type);
+        // Like MetricEventBuilder, the last data point with a given name and type wins.
+        dataPoints.erase(key);
+        dataPoints.emplace(key, DataPoint{name, value, type});
+    }
+    return std::make_shared<MetricEvent>(
+        MetricNameRegistry::getName(m_activityName), getPriority(), dataPoints, m_timestamp);
+}
+
+void MetricRecord::addDataPoint(MetricNameId name, DataType type, uint64_t value) {
+    if (m_dataPointCount == MAX_DATA_POINTS) {
+        m_truncated = true;
+        return;
+    }
+    auto& dataPoint = m_dataPoints[m_dataPointCount++];
+    dataPoint.value = value;
+    dataPoint.name = name;
+    dataPoint.type = static_cast<uint8_t>(type);
+}
+
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -12,8 +12,6 @@
  * express or implied. See the License for the specific language governing
  * permissions and limitations under the License.
  */
-#include <algorithm>
-
 #include <AVSCommon/Utils/Timing/MultiTimer.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/Logger/ThreadMoniker.h>
@@ -68,8 +66,8 @@ MultiTimer::Token MultiTimer::submitTask(const std::chrono::milliseconds& delay,
 
     // Insert new task.
     TimePoint timePoint = std::chrono::steady_clock::now() + delay;
-    m_timers.insert({timePoint, token});
-    m_tasks.insert({token, {timePoint, task}});
+    auto timerIt = m_timers.insert({timePoint, token});
+    m_tasks.insert({token, {timerIt, std::move(task)}});
 
     // Kick-off task execution if needed.
     if (!m_isRunning) {
@@ -89,12 +87,11 @@ void MultiTimer::cancelTask(Token token) noexcept {
     std::unique_lock<std::mutex> lock{m_waitMutex};
     auto taskIt = m_tasks.find(token);
     if (taskIt != m_tasks.end()) {
-        auto& timePoint = taskIt->second.first;
-        bool isNext = m_timers.begin()->first == timePoint;
+        auto timerIt = taskIt->second.first;
+        bool isNext = m_timers.begin()->first == timerIt->first;
         // Remove task
-        auto timerIt = std::find(m_timers.begin(), m_timers.end(), decltype(m_timers)::value_type(timePoint, token));
         m_timers.erase(timerIt);
-        m_tasks.erase(token);
+        m_tasks.erase(taskIt);
 
         if (isNext) {
             // Wake up timer thread if the task that was removed was the next to expire.
@@ -0,0 +1,193 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifdef __linux__
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/SDS/InterProcessSDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/// String to identify log entries originating from this file.
+#define TAG "InterProcessSDS"
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Permissions of the shared memory objects created by @c SharedMemoryBuffer (owner read/write).
+static const mode_t SHARED_MEMORY_MODE = S_IRUSR | S_IWUSR;
+
+/**
+ * Check that @c name is a portable name for a POSIX shared memory object.
+ *
+ * @param name The name to check.
+ * @return Whether @c name is valid.
+ */
+static bool isValidName(const std::string& name) {
+    return name.size() > 1 && '/' == name.front() && std::string::npos == name.find('/', 1);
+}
+
+RobustMutex::RobustMutex() {
+    pthread_mutexattr_t attributes;
+    pthread_mutexattr_init(&attributes);
+    pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+    pthread_mutex_init(&m_mutex, &attributes);
+    pthread_mutexattr_destroy(&attributes);
+}
+
+RobustMutex::~RobustMutex() {
+    pthread_mutex_destroy(&m_mutex);
+}
+
+void RobustMutex::lock() {
+    auto result = pthread_mutex_lock(&m_mutex);
+    if (EOWNERDEAD == result) {
+        ACSDK_WARN(LX("lock").d("reason", "ownerDied").m("recovering mutex"));
+        pthread_mutex_consistent(&m_mutex);
+    } else if (result != 0) {
+        ACSDK_ERROR(LX("lockFailed").d("error", std::strerror(result)));
+    }
+}
+
+bool RobustMutex::try_lock() {
+    auto result = pthread_mutex_trylock(&m_mutex);
+    if (EOWNERDEAD == result) {
+        ACSDK_WARN(LX("tryLock").d("reason", "ownerDied").m("recovering mutex"));
+        pthread_mutex_consistent(&m_mutex);
+        return true;
+    }
+    return 0 == result;
+}
+
+void RobustMutex::unlock() {
+    pthread_mutex_unlock(&m_mutex);
+}
+
+std::shared_ptr<SharedMemoryBuffer> SharedMemoryBuffer::create(const std::string& name, size_t size) {
+    if (!isValidName(name)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "invalidName").d("name", name));
+        return nullptr;
+    }
+    if (0 == size) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "zeroSize").d("name", name));
+        return nullptr;
+    }
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, SHARED_MEMORY_MODE);
+    if (fd < 0) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "shmOpenFailed").d("name", name).d("error", std::strerror(errno)));
+        return nullptr;
+    }
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "ftruncateFailed").d("name", name).d("error", std::strerror(errno)));
+        close(fd);
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    auto data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == data) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "mmapFailed").d("name", name).d("error", std::strerror(errno)));
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+
+    return std::shared_ptr<SharedMemoryBuffer>(new SharedMemoryBuffer(name, static_cast<uint8_t*>(data), size, true));
+}
+
+std::shared_ptr<SharedMemoryBuffer> SharedMemoryBuffer::open(const std::string& name) {
+    if (!isValidName(name)) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "invalidName").d("name", name));
+        return nullptr;
+    }
+
+    int fd = shm_open(name.c_str(), O_RDWR, SHARED_MEMORY_MODE);
+    if (fd < 0) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "shmOpenFailed").d("name", name).d("error", std::strerror(errno)));
+        return nullptr;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0 || status.st_size <= 0) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "invalidSize").d("name", name));
+        close(fd);
+        return nullptr;
+    }
+    auto size = static_cast<size_t>(status.st_size);
+    auto data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == data) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "mmapFailed").d("name", name).d("error", std::strerror(errno)));
+        return nullptr;
+    }
+
+    return std::shared_ptr<SharedMemoryBuffer>(new SharedMemoryBuffer(name, static_cast<uint8_t*>(data), size, false));
+}
+
+bool SharedMemoryBuffer::unlink(const std::string& name) {
+    if (shm_unlink(name.c_str()) != 0) {
+        ACSDK_WARN(LX("unlinkFailed").d("name", name).d("error", std::strerror(errno)));
+        return false;
+    }
+    return true;
+}
+
+SharedMemoryBuffer::SharedMemoryBuffer(const std::string& name, uint8_t* data, size_t size, bool isOwner) :
+        m_name{name},
+        m_data{data},
+        m_size{size},
+        m_isOwner{isOwner} {
+}
+
+SharedMemoryBuffer::~SharedMemoryBuffer() {
+    munmap(m_data, m_size);
+    if (m_isOwner) {
+        unlink(m_name);
+    }
+}
+
+uint8_t* SharedMemoryBuffer::data() {
+    return m_data;
+}
+
+size_t SharedMemoryBuffer::size() const {
+    return m_size;
+}
+
+const std::string& SharedMemoryBuffer::getName() const {
+    return m_name;
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
@@ -38,6 +38,13 @@ Executor::Executor() noexcept : m_executor{std::make_shared<SharedExecutor>()} {
     }
 }
 
+Executor::Executor(std::shared_ptr<WorkStealingScheduler> scheduler) noexcept :
+        m_executor{std::make_shared<SharedExecutor>(std::move(scheduler))} {
+    if (!m_executor) {
+        ACSDK_ERROR(LX("initError"));
+    }
+}
+
 Executor::~Executor() noexcept {
     m_executor.reset();
 }
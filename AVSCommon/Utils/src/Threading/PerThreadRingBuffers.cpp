@@ -0,0 +1,176 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <utility>
+
+#include <AVSCommon/Utils/Threading/PerThreadRingBuffers.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/// Source of unique @c PerThreadRingBuffersBase identifiers.
+static std::atomic<uint64_t> nextRegistryId{1};
+
+size_t roundUpToPowerOfTwo(size_t size) {
+    size_t result = 1;
+    while (result < size) {
+        result <<= 1;
+    }
+    return result;
+}
+
+PerThreadRingBuffer::PerThreadRingBuffer(size_t capacity) :
+        m_capacity{capacity},
+        m_mask{capacity - 1},
+        m_head{0},
+        m_tail{0},
+        m_dropped{0},
+        m_abandoned{false} {
+}
+
+bool PerThreadRingBuffer::empty() const {
+    return m_head.load() == m_tail.load(std::memory_order_relaxed);
+}
+
+uint64_t PerThreadRingBuffer::getDroppedCount() const {
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+bool PerThreadRingBuffer::isAbandoned() const {
+    return m_abandoned;
+}
+
+bool PerThreadRingBuffer::beginPush(size_t size, uint64_t* position) {
+    auto head = m_head.load(std::memory_order_relaxed);
+    if (m_capacity - (head - m_tail.load(std::memory_order_acquire)) < size) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    *position = head;
+    return true;
+}
+
+void PerThreadRingBuffer::endPush(uint64_t position) {
+    // Sequentially consistent, so that a consumer which announces that it is going idle either sees the entry or is
+    // seen by the producer.
+    m_head.store(position);
+}
+
+bool PerThreadRingBuffer::beginPop(uint64_t* position) const {
+    auto tail = m_tail.load(std::memory_order_relaxed);
+    if (m_head.load(std::memory_order_acquire) == tail) {
+        return false;
+    }
+    *position = tail;
+    return true;
+}
+
+void PerThreadRingBuffer::endPop(uint64_t position) {
+    m_tail.store(position, std::memory_order_release);
+}
+
+size_t PerThreadRingBuffer::getCapacity() const {
+    return m_capacity;
+}
+
+size_t PerThreadRingBuffer::getOffset(uint64_t position) const {
+    return static_cast<size_t>(position & m_mask);
+}
+
+void PerThreadRingBuffer::abandon() {
+    m_abandoned = true;
+}
+
+PerThreadRingBuffersBase::PerThreadRingBuffersBase() : m_id{nextRegistryId++}, m_droppedByRemovedRingBuffers{0} {
+}
+
+bool PerThreadRingBuffersBase::empty() const {
+    std::lock_guard<std::mutex> lock(m_ringBuffersMutex);
+    for (const auto& ringBuffer : m_ringBuffers) {
+        if (!ringBuffer->empty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t PerThreadRingBuffersBase::getDroppedCount() const {
+    std::lock_guard<std::mutex> lock(m_ringBuffersMutex);
+    uint64_t dropped = m_droppedByRemovedRingBuffers;
+    for (const auto& ringBuffer : m_ringBuffers) {
+        dropped += ringBuffer->getDroppedCount();
+    }
+    return dropped;
+}
+
+PerThreadRingBuffer* PerThreadRingBuffersBase::getThreadRingBufferBase() {
+    /// The ring buffers of the current thread, one per registry it has used.
+    struct ThreadRingBuffers {
+        /// Destructor, which lets the registries know that the ring buffers may be released once they are drained.
+        ~ThreadRingBuffers() {
+            for (auto& entry : entries) {
+                entry.second->abandon();
+            }
+        }
+
+        /// Pairs of registry identifiers and the ring buffers of the current thread for those registries.
+        std::vector<std::pair<uint64_t, std::shared_ptr<PerThreadRingBuffer>>> entries;
+    };
+    static thread_local ThreadRingBuffers threadRingBuffers;
+
+    for (auto& entry : threadRingBuffers.entries) {
+        if (entry.first == m_id) {
+            return entry.second.get();
+        }
+    }
+    // Release the ring buffers of registries which have been destroyed before adding a new one.
+    auto& entries = threadRingBuffers.entries;
+    entries.erase(
+        std::remove_if(
+            entries.begin(),
+            entries.end(),
+            [](const std::pair<uint64_t, std::shared_ptr<PerThreadRingBuffer>>& entry) {
+                return entry.second.use_count() == 1;
+            }),
+        entries.end());
+    auto ringBuffer = createRingBuffer();
+    {
+        std::lock_guard<std::mutex> lock(m_ringBuffersMutex);
+        m_ringBuffers.push_back(ringBuffer);
+    }
+    entries.emplace_back(m_id, ringBuffer);
+    return ringBuffer.get();
+}
+
+std::vector<std::shared_ptr<PerThreadRingBuffer>> PerThreadRingBuffersBase::collectBase() {
+    std::lock_guard<std::mutex> lock(m_ringBuffersMutex);
+    for (auto it = m_ringBuffers.begin(); it != m_ringBuffers.end();) {
+        if ((*it)->isAbandoned() && (*it)->empty()) {
+            m_droppedByRemovedRingBuffers += (*it)->getDroppedCount();
+            it = m_ringBuffers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return m_ringBuffers;
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
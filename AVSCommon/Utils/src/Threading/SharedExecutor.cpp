@@ -48,6 +48,10 @@ template std::future<std::string> Executor::pushFunction(
     QueuePosition queuePosition,
     std::function<std::string()>&& function) noexcept;
 
+/// Maximum number of tasks run in one go before the executor yields its worker to other executors.
+/// @private
+static constexpr size_t MAX_TASKS_PER_TURN = 16;
+
 /// Prefix for power resource owned by @c Executor instance.
 /// @private
 static constexpr auto POWER_RESOURCE_PREFIX = "Executor:";
@@ -74,10 +78,11 @@ static std::string createPowerResourceName(const std::string& moniker) noexcept
     return result;
 }
 
-SharedExecutor::SharedExecutor() noexcept :
+SharedExecutor::SharedExecutor(std::shared_ptr<WorkStealingScheduler> scheduler) noexcept :
         m_executorMoniker{utils::logger::ThreadMoniker::generateMoniker(utils::logger::ThreadMoniker::PREFIX_EXECUTOR)},
         m_threadRunning{false},
-        m_shutdown{false} {
+        m_shutdown{false},
+        m_scheduler{std::move(scheduler)} {
     ACSDK_DEBUG5(LX("created").d("moniker", m_executorMoniker));
     m_powerResource =
         power::PowerMonitor::getInstance()->createLocalPowerResource(createPowerResourceName(m_executorMoniker));
@@ -85,6 +90,10 @@ SharedExecutor::SharedExecutor() noexcept :
 
 SharedExecutor::~SharedExecutor() noexcept {
     shutdown();
+    // The last job may still be on its way out of runNext(); wait until it no longer touches this object.
+    std::unique_lock<std::mutex> lock{m_queueMutex};
+    m_strandStopped.wait(lock, [this] { return !m_threadRunning; });
+    lock.unlock();
     ACSDK_DEBUG5(LX("destroyed").d("moniker", m_executorMoniker));
 }
 
@@ -133,8 +142,12 @@ std::error_condition SharedExecutor::execute(std::function<void()>&& function, Q
 
     if (!m_threadRunning) {
         m_threadRunning = true;
-        // Restart task thread.
-        m_taskThread.start(std::bind(&SharedExecutor::runNext, this), m_executorMoniker);
+        if (m_scheduler) {
+            m_scheduler->schedule([this] { runStrand(); });
+        } else {
+            // Restart task thread.
+            m_taskThread.start(std::bind(&SharedExecutor::runNext, this), m_executorMoniker);
+        }
     }
 
     return std::error_condition();
@@ -153,9 +166,24 @@ std::function<void()> SharedExecutor::pop() noexcept {
 bool SharedExecutor::hasNext() noexcept {
     std::unique_lock<std::mutex> lock{m_queueMutex};
     m_threadRunning = !m_queue.empty();
+    if (!m_threadRunning) {
+        m_strandStopped.notify_all();
+    }
     return m_threadRunning;
 }
 
+void SharedExecutor::runStrand() noexcept {
+    utils::logger::ThreadMoniker::setThisThreadMoniker(m_executorMoniker);
+    for (size_t i = 0; i < MAX_TASKS_PER_TURN; ++i) {
+        if (!runNext()) {
+            // The executor may be destroyed as soon as runNext() reports an empty queue.
+            return;
+        }
+    }
+    // Tasks remain: go to the back of the scheduler's queue so that other executors get a turn.
+    m_scheduler->schedule([this] { runStrand(); });
+}
+
 bool SharedExecutor::runNext() noexcept {
     auto task = pop();
     if (task) {
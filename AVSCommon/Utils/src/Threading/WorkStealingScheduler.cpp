@@ -0,0 +1,400 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <mutex>
+
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Memory/Memory.h>
+#include <AVSCommon/Utils/Threading/WorkStealingScheduler.h>
+
+/// String to identify log entries originating from this file.
+#define TAG "WorkStealingScheduler"
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param event The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+const size_t WorkStealingScheduler::MIN_DEFAULT_WORKERS = 2;
+
+const std::chrono::milliseconds WorkStealingScheduler::DEFAULT_STARVATION_TIMEOUT{50};
+
+/// Maximum number of spare workers which may exist at the same time.
+static const size_t MAX_SPARE_WORKERS = 8;
+
+/// Configuration key for the scheduler settings.
+static const std::string CONFIG_KEY_WORK_STEALING_SCHEDULER = "workStealingScheduler";
+
+/// Configuration key which enables the scheduler for executors whose tasks never block.
+static const std::string CONFIG_KEY_ENABLED = "enabled";
+
+/// How long a spare worker stays around without work before it exits.
+static const std::chrono::seconds SPARE_WORKER_IDLE_TIMEOUT{2};
+
+/// Queue index used by threads which do not own a queue.
+static const size_t NO_QUEUE = std::numeric_limits<size_t>::max();
+
+/// State shared between the @c WorkStealingScheduler and its worker threads.
+struct WorkStealingScheduler::Core : public std::enable_shared_from_this<WorkStealingScheduler::Core> {
+    /// A queue of jobs owned by one core worker.
+    struct Queue {
+        /// Protects @c jobs.
+        std::mutex mutex;
+
+        /// The queued jobs. The owner takes jobs from the front, other workers steal from the back.
+        std::deque<Job> jobs;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param numQueues The number of queues (one per core worker).
+     * @param starvationTimeout See @c WorkStealingScheduler::WorkStealingScheduler().
+     */
+    Core(size_t numQueues, std::chrono::milliseconds starvationTimeout);
+
+    /**
+     * Add a job to a queue and wake up a worker if one is sleeping.
+     *
+     * @param job The job to add.
+     */
+    void push(Job&& job);
+
+    /**
+     * Take a job, preferring the queue at @c queueIndex and stealing from the other queues otherwise.
+     *
+     * @param queueIndex The queue owned by the calling worker, or @c NO_QUEUE.
+     * @param[out] job The job which was taken.
+     * @return Whether a job was taken.
+     */
+    bool take(size_t queueIndex, Job* job);
+
+    /**
+     * Run a job, keeping track of the number of busy workers.
+     *
+     * @param job The job to run.
+     */
+    void run(Job& job);
+
+    /**
+     * The loop executed by every worker.
+     *
+     * @param queueIndex The queue owned by this worker, or @c NO_QUEUE for a spare worker.
+     */
+    void workerLoop(size_t queueIndex);
+
+    /// The loop executed by the monitor thread.
+    void monitorLoop();
+
+    /// The queues, one per core worker.
+    std::vector<std::unique_ptr<Queue>> queues;
+
+    /// Round robin counter used to spread jobs scheduled from outside of the workers.
+    std::atomic<size_t> nextQueue;
+
+    /// Number of jobs which have been pushed and not taken yet.  May briefly be negative.
+    std::atomic<int64_t> pending;
+
+    /// Number of workers which are (about to be) blocked on @c wakeCondition.
+    std::atomic<size_t> sleeping;
+
+    /// Number of workers which are running a job.
+    std::atomic<size_t> busy;
+
+    /// Number of core and spare workers which are alive.
+    std::atomic<size_t> liveWorkers;
+
+    /// Number of jobs which have been started.
+    std::atomic<uint64_t> jobsRun;
+
+    /// Number of jobs which were stolen from another worker's queue.
+    std::atomic<uint64_t> jobsStolen;
+
+    /// Number of spare workers which were created.
+    std::atomic<uint64_t> spareWorkersCreated;
+
+    /// Whether the scheduler is shutting down.
+    std::atomic<bool> stopping;
+
+    /// Mutex used by sleeping workers.
+    std::mutex wakeMutex;
+
+    /// Condition variable used to wake up sleeping workers.
+    std::condition_variable wakeCondition;
+
+    /// Mutex used by the monitor.
+    std::mutex monitorMutex;
+
+    /// Condition variable used to wake up the monitor when all workers become busy, or on shutdown.
+    std::condition_variable monitorCondition;
+
+    /// See @c WorkStealingScheduler::WorkStealingScheduler().
+    const std::chrono::milliseconds starvationTimeout;
+
+    /// The @c Core of the scheduler which the current thread is a worker of, if any.
+    static thread_local Core* currentCore;
+
+    /// The queue owned by the current thread, if it is a core worker.
+    static thread_local size_t currentQueueIndex;
+};
+
+thread_local WorkStealingScheduler::Core* WorkStealingScheduler::Core::currentCore = nullptr;
+
+thread_local size_t WorkStealingScheduler::Core::currentQueueIndex = NO_QUEUE;
+
+WorkStealingScheduler::Core::Core(size_t numQueues, std::chrono::milliseconds starvationTimeout) :
+        nextQueue{0},
+        pending{0},
+        sleeping{0},
+        busy{0},
+        liveWorkers{numQueues},
+        jobsRun{0},
+        jobsStolen{0},
+        spareWorkersCreated{0},
+        stopping{false},
+        starvationTimeout{starvationTimeout} {
+    for (size_t i = 0; i < numQueues; ++i) {
+        queues.push_back(memory::make_unique<Queue>());
+    }
+}
+
+void WorkStealingScheduler::Core::push(Job&& job) {
+    size_t index = (this == currentCore && currentQueueIndex != NO_QUEUE)
+                       ? currentQueueIndex
+                       : nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->jobs.push_back(std::move(job));
+    }
+    // A sleeping worker increments sleeping before checking pending, and we increment pending before checking
+    // sleeping, so at least one of us sees the other.
+    pending.fetch_add(1);
+    if (sleeping.load() > 0) {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wakeCondition.notify_one();
+    }
+}
+
+bool WorkStealingScheduler::Core::take(size_t queueIndex, Job* job) {
+    if (queueIndex != NO_QUEUE) {
+        auto& queue = *queues[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            *job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            pending.fetch_sub(1);
+            return true;
+        }
+    }
+    if (pending.load() <= 0) {
+        return false;
+    }
+    size_t start = queueIndex != NO_QUEUE ? queueIndex + 1 : nextQueue.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < queues.size(); ++i) {
+        auto index = (start + i) % queues.size();
+        if (index == queueIndex) {
+            continue;
+        }
+        auto& queue = *queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            *job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            pending.fetch_sub(1);
+            jobsStolen.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingScheduler::Core::run(Job& job) {
+    if (busy.fetch_add(1) + 1 >= liveWorkers.load()) {
+        std::lock_guard<std::mutex> lock(monitorMutex);
+        monitorCondition.notify_one();
+    }
+    jobsRun.fetch_add(1);
+#if __cpp_exceptions || defined(__EXCEPTIONS)
+    try {
+#endif
+        job();
+#if __cpp_exceptions || defined(__EXCEPTIONS)
+    } catch (const std::exception& ex) {
+        ACSDK_ERROR(LX("runFailed").d("jobException", ex.what()));
+    } catch (...) {
+        ACSDK_ERROR(LX("runFailed").d("jobException", "other"));
+    }
+#endif
+    // Release anything the job captured before the worker goes to sleep.
+    job = nullptr;
+    busy.fetch_sub(1);
+}
+
+void WorkStealingScheduler::Core::workerLoop(size_t queueIndex) {
+    currentCore = this;
+    currentQueueIndex = queueIndex;
+    bool isSpare = NO_QUEUE == queueIndex;
+
+    Job job;
+    while (true) {
+        if (take(queueIndex, &job)) {
+            run(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        sleeping.fetch_add(1);
+        bool idleTimeout = false;
+        while (pending.load() <= 0 && !stopping) {
+            if (!isSpare) {
+                wakeCondition.wait(lock);
+            } else if (std::cv_status::timeout == wakeCondition.wait_for(lock, SPARE_WORKER_IDLE_TIMEOUT)) {
+                idleTimeout = pending.load() <= 0;
+                break;
+            }
+        }
+        sleeping.fetch_sub(1);
+        if (pending.load() <= 0 && (stopping || idleTimeout)) {
+            break;
+        }
+    }
+
+    liveWorkers.fetch_sub(1);
+    currentCore = nullptr;
+    currentQueueIndex = NO_QUEUE;
+}
+
+void WorkStealingScheduler::Core::monitorLoop() {
+    std::unique_lock<std::mutex> lock(monitorMutex);
+    while (!stopping) {
+        if (busy.load() < liveWorkers.load()) {
+            monitorCondition.wait(lock);
+            continue;
+        }
+        auto jobsRunBefore = jobsRun.load();
+        monitorCondition.wait_for(lock, starvationTimeout);
+        if (stopping || pending.load() <= 0 || busy.load() < liveWorkers.load() || jobsRun.load() != jobsRunBefore) {
+            continue;
+        }
+        // Every worker is stuck in a job and queued jobs are not making progress; add a spare worker so that jobs
+        // which the busy workers may be waiting for get a chance to run.
+        if (liveWorkers.load() - queues.size() >= MAX_SPARE_WORKERS) {
+            ACSDK_WARN(LX("addSpareWorkerFailed").d("reason", "maxSpareWorkersReached").d("max", MAX_SPARE_WORKERS));
+            continue;
+        }
+        ACSDK_DEBUG5(LX("addSpareWorker").d("liveWorkers", liveWorkers.load()).d("pending", pending.load()));
+        liveWorkers.fetch_add(1);
+        spareWorkersCreated.fetch_add(1, std::memory_order_relaxed);
+        // The spare worker owns a reference to the core, so it may outlive the scheduler.
+        auto self = shared_from_this();
+        std::thread([self] { self->workerLoop(NO_QUEUE); }).detach();
+    }
+}
+
+WorkStealingScheduler::WorkStealingScheduler(size_t numWorkers, std::chrono::milliseconds starvationTimeout) {
+    if (0 == numWorkers) {
+        numWorkers = std::max<size_t>(std::thread::hardware_concurrency(), MIN_DEFAULT_WORKERS);
+    }
+    m_core = std::make_shared<Core>(numWorkers, starvationTimeout);
+    for (size_t i = 0; i < numWorkers; ++i) {
+        auto core = m_core;
+        m_workers.emplace_back([core, i] { core->workerLoop(i); });
+    }
+    auto core = m_core;
+    m_monitor = std::thread([core] { core->monitorLoop(); });
+    ACSDK_DEBUG5(LX("created").d("numWorkers", numWorkers));
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(m_core->wakeMutex);
+        m_core->stopping = true;
+        m_core->wakeCondition.notify_all();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_core->monitorMutex);
+        m_core->monitorCondition.notify_all();
+    }
+    m_monitor.join();
+    for (auto& worker : m_workers) {
+        if (worker.get_id() == std::this_thread::get_id()) {
+            // Destroyed from one of our own jobs; this worker exits on its own once the job returns.
+            worker.detach();
+        } else {
+            worker.join();
+        }
+    }
+}
+
+bool WorkStealingScheduler::schedule(Job job) {
+    if (!job) {
+        ACSDK_ERROR(LX("scheduleFailed").d("reason", "emptyJob"));
+        return false;
+    }
+    m_core->push(std::move(job));
+    return true;
+}
+
+size_t WorkStealingScheduler::getNumWorkers() const {
+    return m_core->queues.size();
+}
+
+void WorkStealingScheduler::getStats(uint64_t& jobsRun, uint64_t& jobsStolen, uint64_t& spareWorkersCreated) const {
+    jobsRun = m_core->jobsRun;
+    jobsStolen = m_core->jobsStolen;
+    spareWorkersCreated = m_core->spareWorkersCreated;
+}
+
+std::shared_ptr<WorkStealingScheduler> WorkStealingScheduler::getDefaultScheduler() {
+    static std::mutex singletonMutex;
+    static std::weak_ptr<WorkStealingScheduler> weakSchedulerRef;
+
+    std::lock_guard<std::mutex> lock(singletonMutex);
+    auto sharedSchedulerRef = weakSchedulerRef.lock();
+    if (!sharedSchedulerRef) {
+        sharedSchedulerRef = std::make_shared<WorkStealingScheduler>();
+        weakSchedulerRef = sharedSchedulerRef;
+    }
+    return sharedSchedulerRef;
+}
+
+std::shared_ptr<WorkStealingScheduler> WorkStealingScheduler::getConfiguredScheduler() {
+    bool enabled = false;
+    configuration::ConfigurationNode::getRoot()[CONFIG_KEY_WORK_STEALING_SCHEDULER].getBool(
+        CONFIG_KEY_ENABLED, &enabled, false);
+    if (!enabled) {
+        return nullptr;
+    }
+    return getDefaultScheduler();
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,335 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <limits>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Logger/ThreadMoniker.h>
+#include <AVSCommon/Utils/Timing/TimingWheel.h>
+
+/// String to identify log entries originating from this file.
+#define TAG "TimingWheel"
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+using utils::logger::ThreadMoniker;
+
+const std::chrono::milliseconds TimingWheel::DEFAULT_RESOLUTION{1};
+
+/// Value returned by @c nextTickLocked() when no task is pending.
+static const uint64_t NO_TICK = std::numeric_limits<uint64_t>::max();
+
+/**
+ * Get the index of the most significant bit set.
+ *
+ * @param value A non-zero value.
+ * @return The bit index.
+ */
+static unsigned int highestBit(uint64_t value) {
+    unsigned int bit = 0;
+    while (value >>= 1) {
+        ++bit;
+    }
+    return bit;
+}
+
+/**
+ * Get the index of the least significant bit set.
+ *
+ * @param value A non-zero value.
+ * @return The bit index.
+ */
+static unsigned int lowestBit(uint64_t value) {
+    unsigned int bit = 0;
+    while (!(value & 1)) {
+        value >>= 1;
+        ++bit;
+    }
+    return bit;
+}
+
+/**
+ * @brief Helper method to invoke task and catch exception.
+ *
+ * @param task The task to run.
+ */
+static void safeInvokeTask(const std::function<void()>& task) {
+#if __cpp_exceptions || defined(__EXCEPTIONS)
+    try {
+#endif
+        if (task) {
+            task();
+        }
+#if __cpp_exceptions || defined(__EXCEPTIONS)
+    } catch (const std::exception& ex) {
+        ACSDK_ERROR(LX(__func__).d("taskException", ex.what()));
+    } catch (...) {
+        ACSDK_ERROR(LX(__func__).d("taskException", "other"));
+    }
+#endif
+}
+
+std::shared_ptr<TimingWheel> TimingWheel::create(std::chrono::milliseconds resolution) {
+    if (resolution <= std::chrono::milliseconds::zero()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "invalidResolution").d("resolution", resolution.count()));
+        return nullptr;
+    }
+    return std::shared_ptr<TimingWheel>(new TimingWheel(resolution));
+}
+
+TimingWheel::TimingWheel(std::chrono::milliseconds resolution) :
+        m_resolution{resolution},
+        m_origin{std::chrono::steady_clock::now()},
+        m_moniker{ThreadMoniker::generateMoniker(ThreadMoniker::PREFIX_TIMER)},
+        m_occupied{},
+        m_currentTick{0},
+        m_wakeTick{NO_TICK},
+        m_nextToken{0},
+        m_isShuttingDown{false} {
+    ACSDK_DEBUG5(LX("init").d("moniker", m_moniker).d("resolution", resolution.count()));
+    m_thread = std::thread(&TimingWheel::run, this);
+}
+
+TimingWheel::~TimingWheel() {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_isShuttingDown = true;
+    }
+    m_wakeCondition.notify_all();
+    if (std::this_thread::get_id() == m_thread.get_id()) {
+        ACSDK_ERROR(LX("destructor").d("reason", "destroyedByOwnTask"));
+        m_thread.detach();
+    } else if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+TimingWheel::Token TimingWheel::submitTask(std::chrono::nanoseconds delay, std::function<void()> task) {
+    auto expiry = toTick(std::chrono::steady_clock::now() + std::max(delay, std::chrono::nanoseconds::zero()), true);
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+    auto token = m_nextToken++;
+    if (m_free.empty()) {
+        m_free.emplace_back();
+    }
+    auto it = m_free.begin();
+    it->token = token;
+    it->expiry = expiry;
+    it->task = std::move(task);
+    placeLocked(m_free, it);
+    m_index[token] = it;
+
+    // Wake up the timer thread if the new task is due before the thread would wake up.
+    if (it->level == EXPIRED_LEVEL || expiry < m_wakeTick) {
+        m_wakeTick = expiry;
+        lock.unlock();
+        m_wakeCondition.notify_one();
+    }
+    return token;
+}
+
+bool TimingWheel::cancelTask(Token token) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto indexIt = m_index.find(token);
+    if (indexIt == m_index.end()) {
+        return false;
+    }
+    releaseLocked(indexIt->second);
+    m_index.erase(indexIt);
+    return true;
+}
+
+size_t TimingWheel::size() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_index.size();
+}
+
+void TimingWheel::run() {
+    ThreadMoniker::setThisThreadMoniker(m_moniker);
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+    while (!m_isShuttingDown) {
+        advanceLocked(toTick(std::chrono::steady_clock::now(), false));
+
+        if (!m_expired.empty()) {
+            auto it = m_expired.begin();
+            auto task = std::move(it->task);
+            m_index.erase(it->token);
+            releaseLocked(it);
+            lock.unlock();
+            safeInvokeTask(task);
+            task = nullptr;
+            lock.lock();
+            continue;
+        }
+
+        m_wakeTick = nextTickLocked();
+        if (NO_TICK == m_wakeTick) {
+            m_wakeCondition.wait(lock, [this] { return m_isShuttingDown || NO_TICK != m_wakeTick; });
+        } else {
+            auto wakeTick = m_wakeTick;
+            auto wakeTime = m_origin + m_resolution * static_cast<std::chrono::nanoseconds::rep>(wakeTick);
+            m_wakeCondition.wait_until(lock, wakeTime, [this, wakeTick] {
+                return m_isShuttingDown || m_wakeTick < wakeTick;
+            });
+        }
+    }
+
+    for (auto& level : m_slots) {
+        for (auto& slot : level) {
+            slot.clear();
+        }
+    }
+    m_overflow.clear();
+    m_expired.clear();
+    m_free.clear();
+    m_index.clear();
+}
+
+uint64_t TimingWheel::toTick(std::chrono::steady_clock::time_point timePoint, bool roundUp) const {
+    if (timePoint <= m_origin) {
+        return 0;
+    }
+    auto elapsed = timePoint - m_origin;
+    auto ticks = static_cast<uint64_t>(elapsed / m_resolution);
+    if (roundUp && elapsed % m_resolution != std::chrono::nanoseconds::zero()) {
+        ++ticks;
+    }
+    return ticks;
+}
+
+TimingWheel::EntryList& TimingWheel::listLocked(unsigned int level, unsigned int slot) {
+    switch (level) {
+        case OVERFLOW_LEVEL:
+            return m_overflow;
+        case EXPIRED_LEVEL:
+            return m_expired;
+        default:
+            return m_slots[level][slot];
+    }
+}
+
+void TimingWheel::placeLocked(EntryList& from, EntryList::iterator it) {
+    unsigned int level = EXPIRED_LEVEL;
+    unsigned int slot = 0;
+    if (it->expiry > m_currentTick) {
+        // The level is the highest group of SLOT_BITS bits which differs from the current tick. This keeps the slot
+        // of the entry ahead of the current position of its level, so the slot start is always in the future.
+        level = highestBit(it->expiry ^ m_currentTick) / SLOT_BITS;
+        if (level >= LEVELS) {
+            level = OVERFLOW_LEVEL;
+        } else {
+            slot = (it->expiry >> (level * SLOT_BITS)) & (SLOTS - 1);
+            m_occupied[level] |= uint64_t{1} << slot;
+        }
+    }
+    it->level = level;
+    it->slot = slot;
+    auto& to = listLocked(level, slot);
+    to.splice(to.end(), from, it);
+}
+
+void TimingWheel::releaseLocked(EntryList::iterator it) {
+    auto& from = listLocked(it->level, it->slot);
+    it->task = nullptr;
+    m_free.splice(m_free.begin(), from, it);
+    if (it->level < LEVELS && from.empty()) {
+        m_occupied[it->level] &= ~(uint64_t{1} << it->slot);
+    }
+}
+
+uint64_t TimingWheel::nextTickLocked() const {
+    auto next = NO_TICK;
+    for (unsigned int level = 0; level < LEVELS; ++level) {
+        auto shift = level * SLOT_BITS;
+        auto position = (m_currentTick >> shift) & (SLOTS - 1);
+        // Only the slots after the current position of a level may be occupied.
+        auto ahead = position + 1 < SLOTS ? m_occupied[level] & (~uint64_t{0} << (position + 1)) : 0;
+        if (ahead) {
+            auto slotStart = ((m_currentTick >> (shift + SLOT_BITS)) << (shift + SLOT_BITS)) |
+                             (static_cast<uint64_t>(lowestBit(ahead)) << shift);
+            next = std::min(next, slotStart);
+        }
+    }
+    if (!m_overflow.empty()) {
+        auto shift = LEVELS * SLOT_BITS;
+        next = std::min(next, ((m_currentTick >> shift) + 1) << shift);
+    }
+    return next;
+}
+
+void TimingWheel::advanceLocked(uint64_t tick) {
+    // Jump from one occupied slot to the next. Slots in between are empty, so skipping them keeps the wheels valid.
+    for (auto next = nextTickLocked(); next <= tick; next = nextTickLocked()) {
+        m_currentTick = next;
+        processTickLocked();
+    }
+    if (tick > m_currentTick) {
+        m_currentTick = tick;
+    }
+}
+
+void TimingWheel::processTickLocked() {
+    // Cascade from the coarsest level, so entries moved down land in slots which are processed afterwards.
+    auto overflowMask = (uint64_t{1} << (LEVELS * SLOT_BITS)) - 1;
+    if (!m_overflow.empty() && 0 == (m_currentTick & overflowMask)) {
+        EntryList entries;
+        entries.swap(m_overflow);
+        while (!entries.empty()) {
+            placeLocked(entries, entries.begin());
+        }
+    }
+    for (unsigned int level = LEVELS - 1; level > 0; --level) {
+        auto shift = level * SLOT_BITS;
+        if (0 != (m_currentTick & ((uint64_t{1} << shift) - 1))) {
+            continue;
+        }
+        auto slot = (m_currentTick >> shift) & (SLOTS - 1);
+        if (!(m_occupied[level] & (uint64_t{1} << slot))) {
+            continue;
+        }
+        m_occupied[level] &= ~(uint64_t{1} << slot);
+        EntryList entries;
+        entries.swap(m_slots[level][slot]);
+        while (!entries.empty()) {
+            placeLocked(entries, entries.begin());
+        }
+    }
+    auto slot = m_currentTick & (SLOTS - 1);
+    if (m_occupied[0] & (uint64_t{1} << slot)) {
+        m_occupied[0] &= ~(uint64_t{1} << slot);
+        auto& entries = m_slots[0][slot];
+        for (auto& entry : entries) {
+            entry.level = EXPIRED_LEVEL;
+            entry.slot = 0;
+        }
+        m_expired.splice(m_expired.end(), entries);
+    }
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
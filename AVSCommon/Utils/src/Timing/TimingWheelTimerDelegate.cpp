@@ -0,0 +1,248 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Timing/TimingWheelTimerDelegate.h>
+
+/// String to identify log entries originating from this file.
+#define TAG "TimingWheelTimerDelegate"
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+struct TimingWheelTimerDelegate::State {
+    /// The mutex protecting the members below.
+    std::mutex mutex;
+
+    /// The condition variable used to wait for a task call or a schedule to complete.
+    std::condition_variable condition;
+
+    /// Flag which indicates that the timer is active.
+    std::atomic<bool> running{false};
+
+    /// Flag which indicates that a schedule started by @c start() has calls left.
+    bool scheduled = false;
+
+    /// Incremented by @c start() and @c stop() to invalidate the callbacks already on the wheel.
+    uint64_t generation = 0;
+
+    /// Whether @c token refers to a callback on the wheel.
+    bool hasToken = false;
+
+    /// The token of the next callback on the wheel.
+    TimingWheel::Token token = 0;
+
+    /// Whether a task call is in progress.
+    bool inTask = false;
+
+    /// The thread making the task call in progress.
+    std::thread::id taskThread;
+
+    /// The task.
+    std::function<void()> task;
+
+    /// The time between task calls.
+    std::chrono::nanoseconds period{0};
+
+    /// The type of period.
+    PeriodType periodType = PeriodType::ABSOLUTE;
+
+    /// The number of task calls requested.
+    size_t maxCount = 0;
+
+    /// The number of task calls made or skipped.
+    size_t count = 0;
+
+    /// The time the next task call is due.
+    std::chrono::steady_clock::time_point nextTime;
+
+    /// Whether the task runtime put an absolute schedule off track, which skips the next call.
+    bool offSchedule = false;
+};
+
+/**
+ * @brief Helper method to invoke task and catch exception.
+ *
+ * @param task The task to run.
+ */
+static void safeInvokeTask(const std::function<void()>& task) {
+#if __cpp_exceptions || defined(__EXCEPTIONS)
+    try {
+#endif
+        task();
+#if __cpp_exceptions || defined(__EXCEPTIONS)
+    } catch (const std::exception& ex) {
+        ACSDK_ERROR(LX(__func__).d("taskException", ex.what()));
+    } catch (...) {
+        ACSDK_ERROR(LX(__func__).d("taskException", "other"));
+    }
+#endif
+}
+
+TimingWheelTimerDelegate::TimingWheelTimerDelegate(std::shared_ptr<TimingWheel> wheel) :
+        m_wheel{std::move(wheel)},
+        m_state{std::make_shared<State>()} {
+    if (!m_wheel) {
+        ACSDK_ERROR(LX(__func__).d("reason", "nullTimingWheel"));
+    }
+}
+
+TimingWheelTimerDelegate::~TimingWheelTimerDelegate() {
+    stop();
+}
+
+void TimingWheelTimerDelegate::start(
+    std::chrono::nanoseconds delay,
+    std::chrono::nanoseconds period,
+    PeriodType periodType,
+    size_t maxCount,
+    std::function<void()> task) {
+    if (!m_wheel) {
+        ACSDK_ERROR(LX("startFailed").d("reason", "nullTimingWheel"));
+        // Undo the activate() which precedes a start(), since nothing will ever run.
+        m_state->running = false;
+        return;
+    }
+    if (!task) {
+        ACSDK_ERROR(LX(__func__).d("reason", "nullTask"));
+    }
+
+    std::unique_lock<std::mutex> lock{m_state->mutex};
+
+    // Like a restarted TimerDelegate, wait for the calls left from a previous start, unless called from its task.
+    auto isTaskThread = m_state->inTask && std::this_thread::get_id() == m_state->taskThread;
+    if (!isTaskThread) {
+        m_state->condition.wait(lock, [this] { return !m_state->scheduled && !m_state->inTask; });
+    }
+
+    ++m_state->generation;
+    if (m_state->hasToken) {
+        m_wheel->cancelTask(m_state->token);
+        m_state->hasToken = false;
+    }
+    m_state->running = true;
+    m_state->scheduled = true;
+    m_state->task = std::move(task);
+    m_state->period = period;
+    m_state->periodType = periodType;
+    m_state->maxCount = maxCount;
+    m_state->count = 0;
+    m_state->offSchedule = false;
+    m_state->nextTime = std::chrono::steady_clock::now() + delay;
+    scheduleLocked(m_wheel.get(), m_state, delay);
+}
+
+void TimingWheelTimerDelegate::stop() {
+    std::unique_lock<std::mutex> lock{m_state->mutex};
+    ++m_state->generation;
+    if (m_state->hasToken) {
+        m_wheel->cancelTask(m_state->token);
+        m_state->hasToken = false;
+    }
+
+    // Block until a task call in progress completes, unless called from the task itself.
+    if (std::this_thread::get_id() != m_state->taskThread) {
+        m_state->condition.wait(lock, [this] { return !m_state->inTask; });
+    }
+    if (!m_state->inTask) {
+        m_state->task = nullptr;
+    }
+    m_state->scheduled = false;
+    m_state->running = false;
+    lock.unlock();
+    m_state->condition.notify_all();
+}
+
+bool TimingWheelTimerDelegate::activate() {
+    return !m_state->running.exchange(true);
+}
+
+bool TimingWheelTimerDelegate::isActive() const {
+    return m_state->running;
+}
+
+void TimingWheelTimerDelegate::scheduleLocked(
+    TimingWheel* wheel,
+    const std::shared_ptr<State>& state,
+    std::chrono::nanoseconds delay) {
+    auto generation = state->generation;
+    state->token = wheel->submitTask(delay, [wheel, state, generation] { onTimeout(wheel, state, generation); });
+    state->hasToken = true;
+}
+
+void TimingWheelTimerDelegate::onTimeout(TimingWheel* wheel, const std::shared_ptr<State>& state, uint64_t generation) {
+    std::unique_lock<std::mutex> lock{state->mutex};
+    if (generation != state->generation) {
+        return;
+    }
+    state->hasToken = false;
+    ++state->count;
+
+    // An absolute schedule skips the call which is due while the previous call overran its period.
+    auto runTask = PeriodType::RELATIVE == state->periodType || !state->offSchedule;
+    if (runTask) {
+        state->inTask = true;
+        state->taskThread = std::this_thread::get_id();
+        // The task is moved out so that it stays valid if the timer is restarted from inside the task.
+        auto task = std::move(state->task);
+        lock.unlock();
+        if (task) {
+            safeInvokeTask(task);
+        }
+        lock.lock();
+        state->inTask = false;
+        state->taskThread = std::thread::id();
+        if (generation == state->generation) {
+            state->task = std::move(task);
+        }
+    }
+
+    if (generation == state->generation) {
+        auto now = std::chrono::steady_clock::now();
+        if (FOREVER != state->maxCount && state->count >= state->maxCount) {
+            state->task = nullptr;
+            state->scheduled = false;
+            state->running = false;
+        } else if (PeriodType::ABSOLUTE == state->periodType) {
+            state->offSchedule = state->nextTime + state->period < now;
+            state->nextTime += state->period;
+            scheduleLocked(wheel, state, state->nextTime - now);
+        } else {
+            state->nextTime = now + state->period;
+            scheduleLocked(wheel, state, state->period);
+        }
+    }
+    lock.unlock();
+    state->condition.notify_all();
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,40 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AVSCommon/Utils/Memory/Memory.h>
+#include <AVSCommon/Utils/Timing/TimingWheelTimerDelegate.h>
+#include <AVSCommon/Utils/Timing/TimingWheelTimerDelegateFactory.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+TimingWheelTimerDelegateFactory::TimingWheelTimerDelegateFactory(std::shared_ptr<TimingWheel> wheel) :
+        m_wheel{wheel ? std::move(wheel) : TimingWheel::create()} {
+}
+
+bool TimingWheelTimerDelegateFactory::supportsLowPowerMode() {
+    return false;
+}
+
+std::unique_ptr<sdkInterfaces::timing::TimerDelegateInterface> TimingWheelTimerDelegateFactory::getTimerDelegate() {
+    return memory::make_unique<TimingWheelTimerDelegate>(m_wheel);
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
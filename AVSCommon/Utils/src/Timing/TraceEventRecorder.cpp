@@ -0,0 +1,126 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <fstream>
+
+#include "AVSCommon/Utils/JSON/JSONGenerator.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Timing/TraceEventRecorder.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/// String to identify log entries originating from this file.
+#define TAG "TraceEventRecorder"
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Phase of an event with both a start and a duration.
+static const char* COMPLETE_EVENT_PHASE = "X";
+
+/// All events are reported as coming from a single process.
+static const int PROCESS_ID = 1;
+
+TraceEventRecorder::Scope::Scope(
+    std::shared_ptr<TraceEventRecorder> recorder,
+    const std::string& name,
+    const std::string& category) :
+        m_recorder{std::move(recorder)},
+        m_name{name},
+        m_category{category},
+        m_start{Clock::now()} {
+}
+
+TraceEventRecorder::Scope::~Scope() {
+    if (m_recorder) {
+        m_recorder->recordCompleteEvent(m_name, m_category, m_start, Clock::now());
+    }
+}
+
+TraceEventRecorder::TraceEventRecorder() : m_origin{Clock::now()} {
+}
+
+void TraceEventRecorder::recordCompleteEvent(
+    const std::string& name,
+    const std::string& category,
+    Clock::time_point start,
+    Clock::time_point end) {
+    Event event;
+    event.name = name;
+    event.category = category;
+    event.startUs = std::chrono::duration_cast<std::chrono::microseconds>(start - m_origin).count();
+    event.durationUs = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_threadIds.find(std::this_thread::get_id());
+    if (m_threadIds.end() == it) {
+        it = m_threadIds.insert({std::this_thread::get_id(), static_cast<int>(m_threadIds.size()) + 1}).first;
+    }
+    event.threadId = it->second;
+    m_events.push_back(std::move(event));
+}
+
+size_t TraceEventRecorder::getEventCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_events.size();
+}
+
+std::string TraceEventRecorder::toJson() const {
+    json::JsonGenerator generator;
+    generator.startArray("traceEvents");
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& event : m_events) {
+            generator.startArrayElement();
+            generator.addMember("name", event.name);
+            generator.addMember("cat", event.category);
+            generator.addMember("ph", COMPLETE_EVENT_PHASE);
+            generator.addMember("ts", event.startUs);
+            generator.addMember("dur", event.durationUs);
+            generator.addMember("pid", PROCESS_ID);
+            generator.addMember("tid", event.threadId);
+            generator.finishArrayElement();
+        }
+    }
+    generator.finishArray();
+    generator.addMember("displayTimeUnit", "ms");
+    return generator.toString();
+}
+
+bool TraceEventRecorder::writeToFile(const std::string& path) const {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        ACSDK_ERROR(LX("writeToFileFailed").d("reason", "openFailed").d("path", path));
+        return false;
+    }
+    file << toJson();
+    if (!file.good()) {
+        ACSDK_ERROR(LX("writeToFileFailed").d("reason", "writeFailed").d("path", path));
+        return false;
+    }
+    return true;
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
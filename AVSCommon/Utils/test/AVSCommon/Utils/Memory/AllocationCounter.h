@@ -0,0 +1,107 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_MEMORY_ALLOCATIONCOUNTER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_MEMORY_ALLOCATIONCOUNTER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace memory {
+namespace test {
+
+/**
+ * Counts the allocations made through the global @c operator new, for benchmarks which report the number of
+ * allocations per operation.
+ *
+ * Including this header replaces the global @c operator new and @c operator delete. Replacement allocation functions
+ * may not be inline, so the header must be included by only one translation unit of a test executable.
+ */
+class AllocationCounter {
+public:
+    /**
+     * Reset the count and start counting allocations.
+     */
+    static void start() {
+        count() = 0;
+        counting() = true;
+    }
+
+    /**
+     * Stop counting allocations.
+     *
+     * @return The number of allocations made since @c start().
+     */
+    static size_t stop() {
+        counting() = false;
+        return count();
+    }
+
+    /**
+     * Get the number of allocations counted since the last call to @c start().
+     *
+     * @return The number of allocations.
+     */
+    static size_t getCount() {
+        return count();
+    }
+
+    /**
+     * Record an allocation if allocations are being counted. Called by the replacement @c operator new.
+     */
+    static void onAllocation() {
+        if (counting().load(std::memory_order_relaxed)) {
+            count().fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    /// @return Whether allocations are currently being counted.
+    static std::atomic<bool>& counting() {
+        static std::atomic<bool> value{false};
+        return value;
+    }
+
+    /// @return The number of allocations made while counting.
+    static std::atomic<size_t>& count() {
+        static std::atomic<size_t> value{0};
+        return value;
+    }
+};
+
+}  // namespace test
+}  // namespace memory
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+void* operator new(std::size_t size) {
+    alexaClientSDK::avsCommon::utils::memory::test::AllocationCounter::onAllocation();
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_MEMORY_ALLOCATIONCOUNTER_H_
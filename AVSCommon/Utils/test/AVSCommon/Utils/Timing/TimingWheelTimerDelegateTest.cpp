@@ -0,0 +1,193 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Timing/Timer.h>
+#include <AVSCommon/Utils/Timing/TimingWheelTimerDelegate.h>
+#include <AVSCommon/Utils/Timing/TimingWheelTimerDelegateFactory.h>
+#include <AVSCommon/Utils/WaitEvent.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+namespace test {
+
+using namespace std;
+using namespace std::chrono;
+using namespace alexaClientSDK::avsCommon::sdkInterfaces::timing;
+using namespace ::testing;
+
+class TimingWheelTimerDelegateTest : public Test {
+public:
+    /// SetUp for the test.
+    void SetUp() override;
+
+    /// TearDown for the test.
+    void TearDown() override;
+
+protected:
+    /// The wheel shared by the timers under test.
+    shared_ptr<TimingWheel> m_wheel;
+
+    /// @c TimingWheelTimerDelegate under test.
+    unique_ptr<TimingWheelTimerDelegate> m_timerDelegate;
+
+    /// Counter to track number of invocations of the timer task.
+    atomic<size_t> m_taskCounter;
+};
+
+void TimingWheelTimerDelegateTest::SetUp() {
+    m_taskCounter = 0;
+    m_wheel = TimingWheel::create();
+    m_timerDelegate.reset(new TimingWheelTimerDelegate(m_wheel));
+}
+
+void TimingWheelTimerDelegateTest::TearDown() {
+    m_timerDelegate->stop();
+}
+
+/// Test that the timer makes the requested number of task calls and then becomes inactive.
+TEST_F(TimingWheelTimerDelegateTest, test_basicTimerDelegateAPI) {
+    auto delay = milliseconds(100);
+    auto period = milliseconds(200);
+    auto maxCount = 2u;
+    auto graceTime = milliseconds(50);
+
+    EXPECT_TRUE(m_timerDelegate->activate());
+    EXPECT_FALSE(m_timerDelegate->activate());
+    m_timerDelegate->start(
+        delay, period, TimerDelegateInterface::PeriodType::ABSOLUTE, maxCount, [this] { m_taskCounter++; });
+
+    this_thread::sleep_for(delay + graceTime);
+    ASSERT_EQ(m_taskCounter, 1u);
+    ASSERT_TRUE(m_timerDelegate->isActive());
+
+    this_thread::sleep_for(period);
+    ASSERT_EQ(m_taskCounter, maxCount);
+    ASSERT_FALSE(m_timerDelegate->isActive());
+}
+
+/// Test that stopping before the first call prevents it, and that the timer can be started again.
+TEST_F(TimingWheelTimerDelegateTest, test_stopAndStart) {
+    auto delay = milliseconds(100);
+    m_timerDelegate->start(delay, delay, TimerDelegateInterface::PeriodType::ABSOLUTE, 1, [this] { m_taskCounter++; });
+    m_timerDelegate->stop();
+    ASSERT_FALSE(m_timerDelegate->isActive());
+    EXPECT_EQ(m_wheel->size(), 0u);
+
+    m_timerDelegate->start(delay, delay, TimerDelegateInterface::PeriodType::ABSOLUTE, 1, [this] { m_taskCounter++; });
+    ASSERT_TRUE(m_timerDelegate->isActive());
+    this_thread::sleep_for(delay * 2);
+    ASSERT_EQ(m_taskCounter, 1u);
+    ASSERT_FALSE(m_timerDelegate->isActive());
+}
+
+/// Test that a task which stops its own timer prevents the remaining calls without blocking.
+TEST_F(TimingWheelTimerDelegateTest, test_taskWithStop) {
+    WaitEvent calledEvent;
+    m_timerDelegate->start(
+        milliseconds(10),
+        milliseconds(10),
+        TimerDelegateInterface::PeriodType::RELATIVE,
+        TimerDelegateInterface::FOREVER,
+        [this, &calledEvent] {
+            m_taskCounter++;
+            m_timerDelegate->stop();
+            calledEvent.wakeUp();
+        });
+
+    ASSERT_TRUE(calledEvent.wait(seconds(5)));
+    this_thread::sleep_for(milliseconds(100));
+    ASSERT_EQ(m_taskCounter, 1u);
+    ASSERT_FALSE(m_timerDelegate->isActive());
+}
+
+/// Test that stop() blocks until a task call in progress completes.
+TEST_F(TimingWheelTimerDelegateTest, test_stopWaitsForTaskInProgress) {
+    WaitEvent startedEvent;
+    atomic<bool> finished{false};
+    m_timerDelegate->start(milliseconds(10), milliseconds(10), TimerDelegateInterface::PeriodType::ABSOLUTE, 1, [&] {
+        startedEvent.wakeUp();
+        this_thread::sleep_for(milliseconds(100));
+        finished = true;
+    });
+
+    ASSERT_TRUE(startedEvent.wait(seconds(5)));
+    m_timerDelegate->stop();
+    EXPECT_TRUE(finished);
+}
+
+/// Test that an absolute period keeps its cadence and skips the call which overlaps a long task call.
+TEST_F(TimingWheelTimerDelegateTest, test_absolutePeriodSkipsOverrunCalls) {
+    auto period = milliseconds(100);
+    m_timerDelegate->start(period, period, TimerDelegateInterface::PeriodType::ABSOLUTE, 4, [this, period] {
+        if (0 == m_taskCounter++) {
+            this_thread::sleep_for(period + period / 2);
+        }
+    });
+
+    // Calls are due at 100, 200 (skipped), 300 and 400 ms.
+    this_thread::sleep_for(period * 4 + period / 2);
+    EXPECT_EQ(m_taskCounter, 3u);
+    EXPECT_FALSE(m_timerDelegate->isActive());
+}
+
+/// Test that many timers share the wheel, and that a @c Timer works with the factory.
+TEST_F(TimingWheelTimerDelegateTest, test_timersShareWheel) {
+    auto factory = make_shared<TimingWheelTimerDelegateFactory>(m_wheel);
+    EXPECT_FALSE(factory->supportsLowPowerMode());
+
+    vector<unique_ptr<Timer>> timers;
+    for (int i = 0; i < 100; ++i) {
+        timers.emplace_back(new Timer(factory));
+        timers.back()->start(milliseconds(10 + i), [this] { m_taskCounter++; });
+    }
+    Timer futureTimer(factory);
+    auto future = futureTimer.start(milliseconds(50), [] { return 42; });
+    ASSERT_EQ(future.wait_for(seconds(5)), future_status::ready);
+    EXPECT_EQ(future.get(), 42);
+
+    this_thread::sleep_for(milliseconds(200));
+    EXPECT_EQ(m_taskCounter, 100u);
+    for (auto& timer : timers) {
+        EXPECT_FALSE(timer->isActive());
+    }
+}
+
+/// Test that a delegate without a wheel does not stay active after the start which follows its activation.
+TEST_F(TimingWheelTimerDelegateTest, test_startWithoutWheelLeavesDelegateInactive) {
+    TimingWheelTimerDelegate delegate(nullptr);
+    EXPECT_TRUE(delegate.activate());
+    delegate.start(
+        milliseconds(10), milliseconds(10), TimerDelegateInterface::PeriodType::ABSOLUTE, 1, [this] {
+            m_taskCounter++;
+        });
+    EXPECT_FALSE(delegate.isActive());
+    EXPECT_TRUE(delegate.activate());
+    delegate.stop();
+    EXPECT_EQ(m_taskCounter, 0u);
+}
+
+}  // namespace test
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
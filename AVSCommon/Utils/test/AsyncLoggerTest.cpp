@@ -0,0 +1,395 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include "AVSCommon/Utils/Logger/AsyncLogger.h"
+#include "AVSCommon/Utils/Logger/LoggerSinkManager.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/// Gives the tests access to the lock of the ring buffers of a @c PerThreadRingBuffers.
+class PerThreadRingBuffersTestHelper {
+public:
+    /**
+     * Lock the list of ring buffers.
+     *
+     * @param ringBuffers The ring buffers.
+     * @return The lock.
+     */
+    static std::unique_lock<std::mutex> lock(PerThreadRingBuffersBase& ringBuffers) {
+        return std::unique_lock<std::mutex>(ringBuffers.m_ringBuffersMutex);
+    }
+};
+
+}  // namespace threading
+
+namespace logger {
+
+/// Gives the tests access to the locks of an @c AsyncLogger.
+class AsyncLoggerTestHelper {
+public:
+    /**
+     * Lock the list of ring buffers of a logger.
+     *
+     * @param logger The logger.
+     * @return The lock.
+     */
+    static std::unique_lock<std::mutex> lockRingBuffers(AsyncLogger& logger) {
+        return threading::PerThreadRingBuffersTestHelper::lock(logger.m_ringBuffers);
+    }
+
+    /**
+     * Keep the background thread of a logger from draining, without holding any of the locks used to drain.
+     *
+     * @param logger The logger.
+     * @return The lock which keeps the background thread waiting.
+     */
+    static std::unique_lock<std::mutex> pauseDrainThread(AsyncLogger& logger) {
+        while (true) {
+            std::unique_lock<std::mutex> lock(logger.m_wakeMutex);
+            if (logger.m_drainThreadIdle) {
+                // Producers only wake up the background thread when it is idle.
+                logger.m_drainThreadIdle = false;
+                return lock;
+            }
+            lock.unlock();
+            std::this_thread::yield();
+        }
+    }
+};
+
+namespace test {
+
+/// Small ring buffer size used to exercise wrapping and dropping.
+static const size_t SMALL_RING_BUFFER_SIZE = 1024;
+
+/// Number of entries logged by the tests.
+static const int NUM_ENTRIES = 1000;
+
+/// Number of logging threads used by the tests.
+static const int NUM_THREADS = 4;
+
+/// Timeout for waiting on entries which are expected to be forwarded.
+static const std::chrono::seconds TIMEOUT{5};
+
+/// Moniker passed with the test entries.
+static const std::string TEST_MONIKER = "test-moniker";
+
+/// Source of the entry reporting dropped entries.
+static const std::string DROPPED_ENTRY_PREFIX = "AsyncLogger:entriesDropped";
+
+/**
+ * A @c Logger which records everything passed to @c emit(), optionally blocking until released.
+ */
+class CapturingLogger : public Logger {
+public:
+    /// One captured entry.
+    struct Entry {
+        /// The level of the entry.
+        Level level;
+        /// The time of the entry.
+        std::chrono::system_clock::time_point time;
+        /// The thread moniker of the entry.
+        std::string threadMoniker;
+        /// The text of the entry.
+        std::string text;
+    };
+
+    /// Constructor.
+    CapturingLogger() : Logger(Level::DEBUG9), m_blocked{false} {
+    }
+
+    void emit(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
+        override {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_entries.push_back({level, time, threadMoniker, text});
+        m_wakeTrigger.notify_all();
+        m_wakeTrigger.wait(lock, [this] { return !m_blocked; });
+    }
+
+    /**
+     * Wait until at least @c count entries have been captured.
+     *
+     * @param count The number of entries to wait for.
+     * @return Whether that many entries were captured before the timeout.
+     */
+    bool waitForEntries(size_t count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_wakeTrigger.wait_for(lock, TIMEOUT, [this, count] { return m_entries.size() >= count; });
+    }
+
+    /**
+     * Make @c emit() block (or stop blocking).
+     *
+     * @param blocked Whether @c emit() should block.
+     */
+    void setBlocked(bool blocked) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_blocked = blocked;
+        m_wakeTrigger.notify_all();
+    }
+
+    /**
+     * Get a copy of the captured entries.
+     *
+     * @return The captured entries.
+     */
+    std::vector<Entry> getEntries() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_entries;
+    }
+
+private:
+    /// Protects the members below.
+    std::mutex m_mutex;
+
+    /// Notified when an entry is captured or the blocked state changes.
+    std::condition_variable m_wakeTrigger;
+
+    /// Whether @c emit() should block.
+    bool m_blocked;
+
+    /// The captured entries.
+    std::vector<Entry> m_entries;
+};
+
+/// Test fixture for @c AsyncLogger.
+class AsyncLoggerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_sink = std::make_shared<CapturingLogger>();
+    }
+
+    /// The sink the @c AsyncLogger under test forwards to.
+    std::shared_ptr<CapturingLogger> m_sink;
+};
+
+/// Verify that creating an @c AsyncLogger without a sink fails.
+TEST_F(AsyncLoggerTest, test_createWithNullSink) {
+    EXPECT_EQ(AsyncLogger::create(nullptr), nullptr);
+}
+
+/// Verify that all fields of an entry are forwarded unchanged, and that entries from one thread stay in order.
+TEST_F(AsyncLoggerTest, test_forwardsEntriesInOrder) {
+    auto logger = AsyncLogger::create(m_sink, SMALL_RING_BUFFER_SIZE);
+    ASSERT_TRUE(logger);
+    auto time = std::chrono::system_clock::now();
+    for (int i = 0; i < NUM_ENTRIES; ++i) {
+        logger->emit(Level::WARN, time, TEST_MONIKER.c_str(), std::to_string(i).c_str());
+        // Give the background thread a chance to catch up, as the small ring buffer holds only a few entries.
+        if (i % 10 == 0) {
+            ASSERT_TRUE(m_sink->waitForEntries(i + 1));
+        }
+    }
+    logger->flush();
+
+    auto entries = m_sink->getEntries();
+    ASSERT_EQ(entries.size(), static_cast<size_t>(NUM_ENTRIES));
+    for (int i = 0; i < NUM_ENTRIES; ++i) {
+        EXPECT_EQ(entries[i].level, Level::WARN);
+        EXPECT_EQ(entries[i].time, time);
+        EXPECT_EQ(entries[i].threadMoniker, TEST_MONIKER);
+        EXPECT_EQ(entries[i].text, std::to_string(i));
+    }
+    EXPECT_EQ(logger->getDroppedCount(), 0u);
+}
+
+/// Verify that entries logged from several threads are all forwarded, in order for each thread.
+TEST_F(AsyncLoggerTest, test_forwardsEntriesFromMultipleThreads) {
+    auto logger = AsyncLogger::create(m_sink);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&logger, t] {
+            auto moniker = std::to_string(t);
+            for (int i = 0; i < NUM_ENTRIES; ++i) {
+                logger->emit(Level::INFO, std::chrono::system_clock::now(), moniker.c_str(), std::to_string(i).c_str());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_TRUE(m_sink->waitForEntries(NUM_THREADS * NUM_ENTRIES));
+
+    std::map<std::string, int> nextIndex;
+    for (const auto& entry : m_sink->getEntries()) {
+        EXPECT_EQ(entry.text, std::to_string(nextIndex[entry.threadMoniker]++));
+    }
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        EXPECT_EQ(nextIndex[std::to_string(t)], NUM_ENTRIES);
+    }
+}
+
+/// Verify that entries are dropped rather than blocking when the sink cannot keep up, and that drops are reported.
+TEST_F(AsyncLoggerTest, test_dropsAndReportsEntriesWhenFull) {
+    auto logger = AsyncLogger::create(m_sink, SMALL_RING_BUFFER_SIZE);
+    m_sink->setBlocked(true);
+    logger->emit(Level::INFO, std::chrono::system_clock::now(), TEST_MONIKER.c_str(), "first");
+    ASSERT_TRUE(m_sink->waitForEntries(1));
+
+    // The background thread is now stuck in the sink, so the ring buffer fills up.
+    for (int i = 0; i < NUM_ENTRIES; ++i) {
+        logger->emit(Level::INFO, std::chrono::system_clock::now(), TEST_MONIKER.c_str(), "entry");
+    }
+    auto dropped = logger->getDroppedCount();
+    EXPECT_GT(dropped, 0u);
+    EXPECT_LT(dropped, static_cast<uint64_t>(NUM_ENTRIES));
+
+    m_sink->setBlocked(false);
+    logger->flush();
+    auto entries = m_sink->getEntries();
+    ASSERT_FALSE(entries.empty());
+    EXPECT_EQ(entries.size(), 1 + NUM_ENTRIES - dropped + 1);
+    EXPECT_EQ(entries.back().level, Level::WARN);
+    EXPECT_EQ(entries.back().text.find(DROPPED_ENTRY_PREFIX), 0u);
+    EXPECT_NE(entries.back().text.find("count=" + std::to_string(dropped)), std::string::npos);
+}
+
+/// Verify that entries which do not fit in half of the ring buffer are truncated rather than dropped.
+TEST_F(AsyncLoggerTest, test_truncatesOversizedEntries) {
+    auto logger = AsyncLogger::create(m_sink, SMALL_RING_BUFFER_SIZE);
+    std::string text(SMALL_RING_BUFFER_SIZE * 2, 'x');
+    logger->emit(Level::INFO, std::chrono::system_clock::now(), TEST_MONIKER.c_str(), text.c_str());
+    logger->flush();
+
+    auto entries = m_sink->getEntries();
+    ASSERT_EQ(entries.size(), 1u);
+    EXPECT_EQ(entries[0].threadMoniker, TEST_MONIKER);
+    EXPECT_FALSE(entries[0].text.empty());
+    EXPECT_LT(entries[0].text.size(), SMALL_RING_BUFFER_SIZE / 2);
+    EXPECT_EQ(entries[0].text, std::string(entries[0].text.size(), 'x'));
+    EXPECT_EQ(logger->getDroppedCount(), 0u);
+}
+
+/// Verify that entries from threads which have exited are still forwarded.
+TEST_F(AsyncLoggerTest, test_forwardsEntriesOfExitedThreads) {
+    auto logger = AsyncLogger::create(m_sink);
+    std::thread([&logger] {
+        for (int i = 0; i < NUM_ENTRIES; ++i) {
+            logger->emit(Level::INFO, std::chrono::system_clock::now(), TEST_MONIKER.c_str(), "entry");
+        }
+    }).join();
+    logger->flush();
+    EXPECT_EQ(m_sink->getEntries().size(), static_cast<size_t>(NUM_ENTRIES));
+}
+
+/// Verify that the destructor forwards buffered entries.
+TEST_F(AsyncLoggerTest, test_destructorForwardsBufferedEntries) {
+    {
+        auto logger = AsyncLogger::create(m_sink);
+        for (int i = 0; i < NUM_ENTRIES; ++i) {
+            logger->emit(Level::INFO, std::chrono::system_clock::now(), TEST_MONIKER.c_str(), "entry");
+        }
+    }
+    EXPECT_EQ(m_sink->getEntries().size(), static_cast<size_t>(NUM_ENTRIES));
+}
+
+/// Verify that an @c AsyncLogger can be installed as the sink of @c LoggerSinkManager.
+TEST_F(AsyncLoggerTest, test_installThroughLoggerSinkManager) {
+    auto logger = AsyncLogger::create(m_sink);
+    LoggerSinkManager::instance().initialize(logger);
+    ACSDK_ERROR(LogEntry("AsyncLoggerTest", "installedEvent"));
+    logger->flush();
+    LoggerSinkManager::instance().initialize(getConsoleLogger());
+
+    bool found = false;
+    for (const auto& entry : m_sink->getEntries()) {
+        if (entry.text.find("installedEvent") != std::string::npos) {
+            found = true;
+            EXPECT_EQ(entry.level, Level::ERROR);
+        }
+    }
+    EXPECT_TRUE(found);
+}
+
+/// Verify that the crash handler writes the buffered entries to its file descriptor.
+TEST_F(AsyncLoggerTest, test_crashHandlerWritesBufferedEntries) {
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    auto crash = [this] {
+        auto logger = AsyncLogger::create(m_sink);
+        AsyncLogger::installCrashHandler(logger, STDERR_FILENO);
+        logger->flush();
+        auto pause = AsyncLoggerTestHelper::pauseDrainThread(*logger);
+        logger->emit(Level::ERROR, std::chrono::system_clock::now(), TEST_MONIKER.c_str(), "crashMarker");
+        raise(SIGABRT);
+    };
+    EXPECT_EXIT(crash(), ::testing::KilledBySignal(SIGABRT), "\\[test-moniker\\] E crashMarker");
+}
+
+/// Verify that the crash handler does not deadlock when the crashing thread holds the lock of the ring buffers.
+TEST_F(AsyncLoggerTest, test_crashHandlerSkipsFlushWhileRingBuffersAreLocked) {
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    auto crash = [this] {
+        auto logger = AsyncLogger::create(m_sink);
+        AsyncLogger::installCrashHandler(logger, STDERR_FILENO);
+        logger->emit(Level::ERROR, std::chrono::system_clock::now(), TEST_MONIKER.c_str(), "crashMarker");
+        auto lock = AsyncLoggerTestHelper::lockRingBuffers(*logger);
+        raise(SIGABRT);
+    };
+    EXPECT_EXIT(crash(), ::testing::KilledBySignal(SIGABRT), "");
+}
+
+/// Compare the time spent on the logging thread with and without an @c AsyncLogger in front of a slow sink.
+TEST_F(AsyncLoggerTest, testSlow_emitLatency) {
+    class SlowLogger : public Logger {
+    public:
+        SlowLogger() : Logger(Level::DEBUG9) {
+        }
+        void emit(Level, std::chrono::system_clock::time_point, const char*, const char*) override {
+            std::this_thread::sleep_for(std::chrono::microseconds(20));
+        }
+    };
+    auto slowLogger = std::make_shared<SlowLogger>();
+    auto asyncLogger = AsyncLogger::create(slowLogger);
+    const std::string text(100, 'x');
+
+    auto measure = [&text](Logger& logger) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < NUM_ENTRIES; ++i) {
+            logger.emit(Level::INFO, std::chrono::system_clock::now(), TEST_MONIKER.c_str(), text.c_str());
+        }
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count() /
+               NUM_ENTRIES;
+    };
+    auto syncNs = measure(*slowLogger);
+    auto asyncNs = measure(*asyncLogger);
+    asyncLogger->flush();
+
+    std::cout << "emit latency: synchronous " << syncNs << " ns/entry, asynchronous " << asyncNs
+              << " ns/entry, dropped " << asyncLogger->getDroppedCount() << std::endl;
+    EXPECT_LT(asyncNs, syncNs);
+}
+
+}  // namespace test
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
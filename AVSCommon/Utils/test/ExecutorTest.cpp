@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
 #include <gtest/gtest.h>
@@ -20,9 +21,11 @@
 #include <mutex>
 #include <system_error>
 #include <thread>
+#include <vector>
 
 #include "ExecutorTestUtils.h"
 #include "AVSCommon/Utils/Threading/Executor.h"
+#include "AVSCommon/Utils/Threading/WorkStealingScheduler.h"
 #include "AVSCommon/Utils/WaitEvent.h"
 
 namespace alexaClientSDK {
@@ -213,6 +216,72 @@ TEST_F(ExecutorTest, testTimer_executionOrderEqualToSubmitOrder) {
     ASSERT_EQ(order, expectedOrder);
 }
 
+/// This test verifies that tasks on different executors may block on each other without deadlocking.
+TEST_F(ExecutorTest, testTimer_tasksBlockingOnOtherExecutors) {
+    // More executors than there are cores, each blocking on a task of the next one.
+    const size_t numExecutors = 4 * std::max(std::thread::hardware_concurrency(), 1u) + 1;
+    std::vector<std::unique_ptr<Executor>> executors;
+    for (size_t i = 0; i < numExecutors; ++i) {
+        executors.emplace_back(new Executor());
+    }
+    std::vector<std::shared_ptr<std::promise<void>>> promises;
+    std::vector<std::future<void>> results;
+    for (size_t i = 0; i < numExecutors; ++i) {
+        promises.push_back(std::make_shared<std::promise<void>>());
+    }
+    for (size_t i = 0; i + 1 < numExecutors; ++i) {
+        auto waitFor = promises[i + 1]->get_future().share();
+        auto fulfill = promises[i];
+        results.push_back(executors[i]->submit([waitFor, fulfill] {
+            waitFor.wait();
+            fulfill->set_value();
+        }));
+    }
+    auto fulfillLast = promises.back();
+    results.push_back(executors.back()->submit([fulfillLast] { fulfillLast->set_value(); }));
+
+    for (auto& result : results) {
+        ASSERT_EQ(result.wait_for(EXECUTOR_SIGNAL_WAIT_TIMEOUT), std::future_status::ready);
+    }
+}
+
+/// This test verifies that executors sharing a scheduler each run their tasks in submit order.
+TEST_F(ExecutorTest, testTimer_executorsOnSharedSchedulerKeepSubmitOrder) {
+    auto scheduler = std::make_shared<WorkStealingScheduler>(2);
+    Executor first{scheduler};
+    Executor second{scheduler};
+    std::vector<int> firstOrder;
+    std::vector<int> secondOrder;
+    std::vector<int> expectedOrder;
+    for (int i = 0; i < 100; ++i) {
+        expectedOrder.push_back(i);
+        first.execute([&firstOrder, i] { firstOrder.push_back(i); });
+        second.execute([&secondOrder, i] { secondOrder.push_back(i); });
+    }
+    first.waitForSubmittedTasks();
+    second.waitForSubmittedTasks();
+
+    ASSERT_EQ(firstOrder, expectedOrder);
+    ASSERT_EQ(secondOrder, expectedOrder);
+    uint64_t jobsRun = 0, jobsStolen = 0, spareWorkersCreated = 0;
+    scheduler->getStats(jobsRun, jobsStolen, spareWorkersCreated);
+    EXPECT_GT(jobsRun, 0u);
+}
+
+/// This test verifies that an executor which is not given a scheduler does not run its tasks on the default one.
+TEST_F(ExecutorTest, testTimer_defaultExecutorDoesNotUseSharedScheduler) {
+    auto scheduler = WorkStealingScheduler::getDefaultScheduler();
+    uint64_t jobsRunBefore = 0, jobsRunAfter = 0, jobsStolen = 0, spareWorkersCreated = 0;
+    scheduler->getStats(jobsRunBefore, jobsStolen, spareWorkersCreated);
+
+    auto result = executor.submit([] { return std::this_thread::get_id(); });
+    ASSERT_EQ(result.wait_for(EXECUTOR_SIGNAL_WAIT_TIMEOUT), std::future_status::ready);
+    EXPECT_NE(result.get(), std::this_thread::get_id());
+
+    scheduler->getStats(jobsRunAfter, jobsStolen, spareWorkersCreated);
+    EXPECT_EQ(jobsRunBefore, jobsRunAfter);
+}
+
 /// Used by @c futureWaitsForTaskCleanup delay and timestamp the time of lambda parameter destruction.
 struct SlowDestructor {
     /// Constructor.
@@ -0,0 +1,181 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file InterProcessSDSTest.cpp
+
+#ifdef __linux__
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/SDS/InterProcessSDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+namespace test {
+
+/// Size of a sample in bytes (16 bit PCM).
+static const size_t WORD_SIZE = sizeof(int16_t);
+
+/// Number of samples in a frame.
+static const size_t FRAME_WORDS = 160;
+
+/// Number of frames held by the stream under test.
+static const size_t BUFFER_FRAMES = 10;
+
+/// Number of frames streamed between the processes (more than the stream holds, so the writer has to wait).
+static const size_t NUM_FRAMES = 100;
+
+/// Maximum number of readers.
+static const size_t MAX_READERS = 2;
+
+/// Timeout used for blocking operations.
+static const std::chrono::seconds BLOCKING_TIMEOUT(5);
+
+/// Exit code of a child process which succeeded.
+static const int CHILD_SUCCESS = 0;
+
+/// Exit code of a child process which failed.
+static const int CHILD_FAILURE = 1;
+
+/**
+ * Wait for a child process to exit.
+ *
+ * @param pid The process id of the child.
+ * @return The exit code of the child, or @c -1 if it did not exit normally.
+ */
+static int waitForChild(pid_t pid) {
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status)) {
+        return -1;
+    }
+    return WEXITSTATUS(status);
+}
+
+/// Test fixture which provides a shared memory object name which is unique to this process.
+class InterProcessSDSTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_name = "/InterProcessSDSTest." + std::to_string(getpid());
+        SharedMemoryBuffer::unlink(m_name);
+    }
+
+    /// The name of the shared memory object used by the test.
+    std::string m_name;
+};
+
+/// Verify that invalid names are rejected.
+TEST_F(InterProcessSDSTest, test_createWithInvalidName) {
+    EXPECT_EQ(SharedMemoryBuffer::create("", 1), nullptr);
+    EXPECT_EQ(SharedMemoryBuffer::create("noLeadingSlash", 1), nullptr);
+    EXPECT_EQ(SharedMemoryBuffer::create("/nested/name", 1), nullptr);
+    EXPECT_EQ(SharedMemoryBuffer::create(m_name, 0), nullptr);
+}
+
+/// Verify that an object can only be created once, and is unlinked when its creator goes away.
+TEST_F(InterProcessSDSTest, test_createOpenAndUnlink) {
+    EXPECT_EQ(SharedMemoryBuffer::open(m_name), nullptr);
+
+    auto created = SharedMemoryBuffer::create(m_name, 4096);
+    ASSERT_NE(created, nullptr);
+    EXPECT_EQ(SharedMemoryBuffer::create(m_name, 4096), nullptr);
+
+    auto opened = SharedMemoryBuffer::open(m_name);
+    ASSERT_NE(opened, nullptr);
+    EXPECT_EQ(opened->size(), created->size());
+    created->data()[0] = 42;
+    EXPECT_EQ(opened->data()[0], 42);
+
+    created.reset();
+    EXPECT_EQ(SharedMemoryBuffer::open(m_name), nullptr);
+    EXPECT_EQ(opened->data()[0], 42);
+}
+
+/// Verify that a reader in this process receives every frame written by a writer in a child process.
+TEST_F(InterProcessSDSTest, test_writerInChildProcess) {
+    auto bufferSize = InterProcessSDS::calculateBufferSize(BUFFER_FRAMES * FRAME_WORDS, WORD_SIZE, MAX_READERS);
+    auto buffer = SharedMemoryBuffer::create(m_name, bufferSize);
+    ASSERT_NE(buffer, nullptr);
+    auto stream = InterProcessSDS::create(buffer, WORD_SIZE, MAX_READERS);
+    ASSERT_NE(stream, nullptr);
+    auto reader = stream->createReader(InterProcessSDS::Reader::Policy::BLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    auto pid = fork();
+    ASSERT_GE(pid, 0);
+    if (0 == pid) {
+        auto childStream = InterProcessSDS::open(SharedMemoryBuffer::open(m_name));
+        auto writer = childStream ? childStream->createWriter(InterProcessSDS::Writer::Policy::BLOCKING) : nullptr;
+        if (!writer) {
+            _exit(CHILD_FAILURE);
+        }
+        std::vector<int16_t> frame(FRAME_WORDS);
+        for (size_t i = 0; i < NUM_FRAMES; ++i) {
+            std::fill(frame.begin(), frame.end(), static_cast<int16_t>(i));
+            if (writer->write(frame.data(), FRAME_WORDS, BLOCKING_TIMEOUT) != static_cast<ssize_t>(FRAME_WORDS)) {
+                _exit(CHILD_FAILURE);
+            }
+        }
+        writer->close();
+        _exit(CHILD_SUCCESS);
+    }
+
+    std::vector<int16_t> frame(FRAME_WORDS);
+    for (size_t i = 0; i < NUM_FRAMES; ++i) {
+        ASSERT_EQ(reader->read(frame.data(), FRAME_WORDS, BLOCKING_TIMEOUT), static_cast<ssize_t>(FRAME_WORDS));
+        EXPECT_EQ(frame.front(), static_cast<int16_t>(i));
+        EXPECT_EQ(frame.back(), static_cast<int16_t>(i));
+    }
+    EXPECT_EQ(reader->read(frame.data(), FRAME_WORDS, BLOCKING_TIMEOUT), InterProcessSDS::Reader::Error::CLOSED);
+    EXPECT_EQ(waitForChild(pid), CHILD_SUCCESS);
+}
+
+/// Verify that a mutex held by a process which terminated can be locked again.
+TEST_F(InterProcessSDSTest, test_mutexRecoveredAfterOwnerDies) {
+    auto buffer = SharedMemoryBuffer::create(m_name, sizeof(RobustMutex));
+    ASSERT_NE(buffer, nullptr);
+    auto mutex = new (buffer->data()) RobustMutex;
+
+    auto pid = fork();
+    ASSERT_GE(pid, 0);
+    if (0 == pid) {
+        mutex->lock();
+        _exit(CHILD_SUCCESS);
+    }
+    ASSERT_EQ(waitForChild(pid), CHILD_SUCCESS);
+
+    EXPECT_TRUE(mutex->try_lock());
+    mutex->unlock();
+    mutex->lock();
+    mutex->unlock();
+    mutex->~RobustMutex();
+}
+
+}  // namespace test
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
@@ -30,6 +30,8 @@ class LibCurlHTTP2Connection_Test : public LibcurlHTTP2Connection {
 public:
     LibCurlHTTP2Connection_Test() = default;
     friend class GTEST_TEST_CLASS_NAME_(LibCurlHTTP2ConnectionTest, releaseStream_delete_ok);
+    friend class GTEST_TEST_CLASS_NAME_(LibCurlHTTP2ConnectionTest, getPollTimeout_intermittentStreamsOnly);
+    friend class GTEST_TEST_CLASS_NAME_(LibCurlHTTP2ConnectionTest, getPollTimeout_nonIntermittentStream);
 };
 /**
  * Test fixture class for LibCurlHTTP2Connection
@@ -62,6 +64,54 @@ TEST_F(LibCurlHTTP2ConnectionTest, releaseStream_delete_ok) {
     ASSERT_FALSE(m_libCurlHTTP2Connection->m_activeStreams.size());
 }
 
+TEST_F(LibCurlHTTP2ConnectionTest, getPollTimeout_intermittentStreamsOnly) {
+    m_libCurlHTTP2Connection->setIsStopping();
+    http2::HTTP2RequestConfig config{http2::HTTP2RequestType::GET, "www.foo.com", "xyz"};
+    config.setIntermittentTransferExpected();
+    auto req = std::make_shared<LibcurlHTTP2Request>(config, nullptr, config.getId());
+    m_libCurlHTTP2Connection->m_activeStreams[req->getCurlHandle()] = req;
+    auto idleTimeout = m_libCurlHTTP2Connection->getPollTimeout();
+
+    // A stream that may stall must be checked before its progress timeout elapses.
+    http2::HTTP2RequestConfig timeoutConfig{http2::HTTP2RequestType::GET, "www.foo.com", "abc"};
+    timeoutConfig.setIntermittentTransferExpected();
+    timeoutConfig.setActivityTimeout(std::chrono::milliseconds(5));
+    auto timeoutReq = std::make_shared<LibcurlHTTP2Request>(timeoutConfig, nullptr, timeoutConfig.getId());
+    m_libCurlHTTP2Connection->m_activeStreams[timeoutReq->getCurlHandle()] = timeoutReq;
+    ASSERT_LE(m_libCurlHTTP2Connection->getPollTimeout(), std::chrono::milliseconds(5));
+    ASSERT_LE(m_libCurlHTTP2Connection->getPollTimeout(), idleTimeout);
+    m_libCurlHTTP2Connection->m_activeStreams.clear();
+}
+
+TEST_F(LibCurlHTTP2ConnectionTest, getPollTimeout_nonIntermittentStream) {
+    m_libCurlHTTP2Connection->setIsStopping();
+    http2::HTTP2RequestConfig intermittentConfig{http2::HTTP2RequestType::GET, "www.foo.com", "abc"};
+    intermittentConfig.setIntermittentTransferExpected();
+    auto intermittentReq =
+        std::make_shared<LibcurlHTTP2Request>(intermittentConfig, nullptr, intermittentConfig.getId());
+    m_libCurlHTTP2Connection->m_activeStreams[intermittentReq->getCurlHandle()] = intermittentReq;
+
+    http2::HTTP2RequestConfig config{http2::HTTP2RequestType::GET, "www.foo.com", "xyz"};
+    auto req = std::make_shared<LibcurlHTTP2Request>(config, nullptr, config.getId());
+    m_libCurlHTTP2Connection->m_activeStreams[req->getCurlHandle()] = req;
+    ASSERT_EQ(m_libCurlHTTP2Connection->getPollTimeout(), LibcurlHTTP2Connection::WAIT_FOR_ACTIVITY_TIMEOUT);
+    m_libCurlHTTP2Connection->m_activeStreams.clear();
+}
+
+TEST_F(LibCurlHTTP2ConnectionTest, cancel_invokesWakeupCallback) {
+    http2::HTTP2RequestConfig config{http2::HTTP2RequestType::GET, "www.foo.com", "xyz"};
+    auto req = std::make_shared<LibcurlHTTP2Request>(config, nullptr, config.getId());
+    int wakeupCount = 0;
+    req->setWakeupCallback([&wakeupCount] { wakeupCount++; });
+    ASSERT_TRUE(req->cancel());
+    ASSERT_TRUE(req->isCancelled());
+    ASSERT_EQ(wakeupCount, 1);
+
+    req->setWakeupCallback(nullptr);
+    ASSERT_TRUE(req->cancel());
+    ASSERT_EQ(wakeupCount, 1);
+}
+
 }  // namespace libcurlUtils
 }  // namespace utils
 }  // namespace avsCommon
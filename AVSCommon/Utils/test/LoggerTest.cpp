@@ -13,6 +13,9 @@
  * permissions and limitations under the License.
  */
 
+#include <chrono>
+#include <functional>
+#include <iostream>
 #include <thread>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -230,6 +233,18 @@ void LoggerTest::TearDown() {
     g_log.reset();
 }
 
+/**
+ * Get the number of times a log line of the given level is expected to be emitted, taking into account log lines
+ * compiled out by @c ACSDK_LOG_MIN_LEVEL.
+ *
+ * @param level The level of the log line.
+ * @param count The number of times the log line is expected to be emitted if it is compiled in.
+ * @return The number of times the log line is expected to be emitted.
+ */
+static int compiledInCount(Level level, int count) {
+    return isLevelCompiledIn(level) ? count : 0;
+}
+
 void LoggerTest::setLevelExpectations(Level level) {
     getLoggerTestLogger()->setLevel(level);
 
@@ -282,33 +297,47 @@ void LoggerTest::setLevelExpectations(Level level) {
 
     switch (level) {
         case Level::DEBUG9:
-            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG9, _, _, _)).Times(DEBUG_COUNT);
+            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG9, _, _, _))
+                .Times(compiledInCount(Level::DEBUG9, DEBUG_COUNT));
         case Level::DEBUG8:
-            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG8, _, _, _)).Times(DEBUG_COUNT);
+            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG8, _, _, _))
+                .Times(compiledInCount(Level::DEBUG8, DEBUG_COUNT));
         case Level::DEBUG7:
-            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG7, _, _, _)).Times(DEBUG_COUNT);
+            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG7, _, _, _))
+                .Times(compiledInCount(Level::DEBUG7, DEBUG_COUNT));
         case Level::DEBUG6:
-            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG6, _, _, _)).Times(DEBUG_COUNT);
+            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG6, _, _, _))
+                .Times(compiledInCount(Level::DEBUG6, DEBUG_COUNT));
         case Level::DEBUG5:
-            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG5, _, _, _)).Times(DEBUG_COUNT);
+            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG5, _, _, _))
+                .Times(compiledInCount(Level::DEBUG5, DEBUG_COUNT));
         case Level::DEBUG4:
-            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG4, _, _, _)).Times(DEBUG_COUNT);
+            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG4, _, _, _))
+                .Times(compiledInCount(Level::DEBUG4, DEBUG_COUNT));
         case Level::DEBUG3:
-            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG3, _, _, _)).Times(DEBUG_COUNT);
+            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG3, _, _, _))
+                .Times(compiledInCount(Level::DEBUG3, DEBUG_COUNT));
         case Level::DEBUG2:
-            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG2, _, _, _)).Times(DEBUG_COUNT);
+            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG2, _, _, _))
+                .Times(compiledInCount(Level::DEBUG2, DEBUG_COUNT));
         case Level::DEBUG1:
-            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG1, _, _, _)).Times(DEBUG_COUNT);
+            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG1, _, _, _))
+                .Times(compiledInCount(Level::DEBUG1, DEBUG_COUNT));
         case Level::DEBUG0:
-            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG0, _, _, _)).Times(DEBUG_COUNT);
+            EXPECT_CALL(*(g_log.get()), emit(Level::DEBUG0, _, _, _))
+                .Times(compiledInCount(Level::DEBUG0, DEBUG_COUNT));
         case Level::INFO:
-            EXPECT_CALL(*(g_log.get()), emit(Level::INFO, _, _, _)).Times(LOG_COUNT);
+            EXPECT_CALL(*(g_log.get()), emit(Level::INFO, _, _, _))
+                .Times(compiledInCount(Level::INFO, LOG_COUNT));
         case Level::WARN:
-            EXPECT_CALL(*(g_log.get()), emit(Level::WARN, _, _, _)).Times(LOG_COUNT);
+            EXPECT_CALL(*(g_log.get()), emit(Level::WARN, _, _, _))
+                .Times(compiledInCount(Level::WARN, LOG_COUNT));
         case Level::ERROR:
-            EXPECT_CALL(*(g_log.get()), emit(Level::ERROR, _, _, _)).Times(LOG_COUNT);
+            EXPECT_CALL(*(g_log.get()), emit(Level::ERROR, _, _, _))
+                .Times(compiledInCount(Level::ERROR, LOG_COUNT));
         case Level::CRITICAL:
-            EXPECT_CALL(*(g_log.get()), emit(Level::CRITICAL, _, _, _)).Times(LOG_COUNT);
+            EXPECT_CALL(*(g_log.get()), emit(Level::CRITICAL, _, _, _))
+                .Times(compiledInCount(Level::CRITICAL, LOG_COUNT));
         case Level::NONE:
         case Level::UNKNOWN:
             break;
@@ -707,6 +736,60 @@ TEST_F(LoggerTest, test_changeSinkLogger) {
     // reset to the default sink to avoid messing up with subsequent tests
     LoggerSinkManager::instance().initialize(getLoggerTestLogger());
 }
+
+/**
+ * Test that the @c LogEntry passed to an ACSDK_<LEVEL> macro is not built if the log line is filtered out.
+ */
+TEST_F(LoggerTest, test_filteredLogLineDoesNotEvaluateEntry) {
+    ACSDK_GET_LOGGER_FUNCTION()->setLevel(Level::INFO);
+    int evaluations = 0;
+    auto evaluate = [&evaluations] {
+        ++evaluations;
+        return TEST_MESSAGE_STRING;
+    };
+
+    ACSDK_DEBUG9(LX("filtered").d(METADATA_KEY, evaluate()));
+    ASSERT_EQ(evaluations, 0);
+
+    ACSDK_ERROR(LX("emitted").d(METADATA_KEY, evaluate()));
+    ASSERT_EQ(evaluations, compiledInCount(Level::ERROR, 1));
+}
+
+/**
+ * Measure the cost of an ACSDK_<LEVEL> call for a filtered and an emitted log line, and compare the filtered cost
+ * with that of the previous implementation, which copied the module's @c std::shared_ptr<Logger> on every call.
+ */
+TEST_F(LoggerTest, testSlow_logCallCost) {
+    static const int ITERATIONS = 1000000;
+    // A sink which discards everything, so that emitted log lines measure the cost of building the entry.
+    auto nullSink = std::make_shared<Logger>(Level::DEBUG9);
+    LoggerSinkManager::instance().initialize(nullSink);
+    ACSDK_GET_LOGGER_FUNCTION()->setLevel(Level::INFO);
+
+    auto measure = [](const std::function<void(int)>& logLine) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            logLine(i);
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / ITERATIONS;
+    };
+
+    auto filteredNs = measure([](int i) { ACSDK_DEBUG5(LX("filtered").d("index", i).d("text", TEST_MESSAGE_STRING)); });
+    auto legacyFilteredNs = measure([](int i) {
+        auto loggerInstance = ACSDK_GET_LOGGER_FUNCTION();
+        if (loggerInstance->shouldLog(Level::DEBUG5)) {
+            loggerInstance->log(Level::DEBUG5, LX("filtered").d("index", i).d("text", TEST_MESSAGE_STRING));
+        }
+    });
+    auto emittedNs = measure([](int i) { ACSDK_INFO(LX("emitted").d("index", i).d("text", TEST_MESSAGE_STRING)); });
+
+    std::cout << "log call cost: filtered " << filteredNs << " ns (previously " << legacyFilteredNs
+              << " ns), emitted " << emittedNs << " ns" << std::endl;
+    EXPECT_LT(filteredNs, emittedNs);
+
+    LoggerSinkManager::instance().initialize(getLoggerTestLogger());
+}
 #endif  // ACSDK_LOG_ENABLED
 
 }  // namespace test
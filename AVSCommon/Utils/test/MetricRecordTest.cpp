@@ -0,0 +1,124 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Metrics/MetricNameRegistry.h"
+#include "AVSCommon/Utils/Metrics/MetricRecord.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+namespace test {
+
+using namespace ::testing;
+
+/**
+ * Tests that interning returns a stable identifier for each name.
+ */
+TEST(MetricRecordTest, test_internName) {
+    auto id = MetricNameRegistry::intern("MetricRecordTest-activity");
+    EXPECT_NE(id, MetricNameRegistry::INVALID_ID);
+    EXPECT_EQ(MetricNameRegistry::intern("MetricRecordTest-activity"), id);
+    EXPECT_NE(MetricNameRegistry::intern("MetricRecordTest-other"), id);
+    EXPECT_EQ(MetricNameRegistry::getName(id), "MetricRecordTest-activity");
+
+    EXPECT_EQ(MetricNameRegistry::intern(""), MetricNameRegistry::INVALID_ID);
+    EXPECT_EQ(MetricNameRegistry::getName(MetricNameRegistry::INVALID_ID), "");
+    EXPECT_EQ(MetricNameRegistry::getName(0xffffffff), "");
+}
+
+/**
+ * Tests that the data points of a record can be read back.
+ */
+TEST(MetricRecordTest, test_addDataPoints) {
+    auto activity = MetricNameRegistry::intern("activity");
+    auto counter = MetricNameRegistry::intern("counter");
+    auto duration = MetricNameRegistry::intern("duration");
+    auto string = MetricNameRegistry::intern("string");
+    auto timestamp = std::chrono::steady_clock::now();
+
+    MetricRecord record(activity, Priority::HIGH, timestamp);
+    record.addCounter(counter, 3)
+        .addDuration(duration, std::chrono::milliseconds(250))
+        .addString(string, "value")
+        .addDuration(duration, std::chrono::milliseconds(-5));
+
+    EXPECT_EQ(record.getActivityName(), activity);
+    EXPECT_EQ(record.getPriority(), Priority::HIGH);
+    EXPECT_EQ(record.getSteadyTimestamp(), timestamp);
+    ASSERT_EQ(record.getDataPointCount(), 4u);
+    EXPECT_EQ(record.getDataPointName(0), counter);
+    EXPECT_EQ(record.getDataPointType(0), DataType::COUNTER);
+    EXPECT_EQ(record.getNumericValue(0), 3u);
+    EXPECT_EQ(record.getDataPointType(1), DataType::DURATION);
+    EXPECT_EQ(record.getNumericValue(1), 250u);
+    EXPECT_EQ(record.getDataPointName(2), string);
+    EXPECT_EQ(record.getDataPointType(2), DataType::STRING);
+    EXPECT_EQ(record.getStringValue(2), "value");
+    EXPECT_EQ(record.getNumericValue(2), 0u);
+    EXPECT_EQ(record.getNumericValue(3), 0u);
+    EXPECT_EQ(record.getStringValue(0), "");
+    EXPECT_FALSE(record.isTruncated());
+}
+
+/**
+ * Tests that data points and string values which do not fit are dropped and the record is marked as truncated.
+ */
+TEST(MetricRecordTest, test_truncation) {
+    auto name = MetricNameRegistry::intern("name");
+    MetricRecord record(MetricNameRegistry::intern("activity"));
+    std::string longValue(MetricRecord::STRING_STORAGE_SIZE - 10, 'a');
+    record.addString(name, longValue).addString(name, "0123456789abcdef");
+    EXPECT_TRUE(record.isTruncated());
+    EXPECT_EQ(record.getStringValue(0), longValue);
+    EXPECT_EQ(record.getStringValue(1), "0123456789");
+
+    MetricRecord fullRecord(MetricNameRegistry::intern("activity"));
+    for (size_t i = 0; i < MetricRecord::MAX_DATA_POINTS + 2; ++i) {
+        fullRecord.addCounter(name, i);
+    }
+    EXPECT_EQ(fullRecord.getDataPointCount(), MetricRecord::MAX_DATA_POINTS);
+    EXPECT_TRUE(fullRecord.isTruncated());
+}
+
+/**
+ * Tests the conversion of a record to a @c MetricEvent.
+ */
+TEST(MetricRecordTest, test_toMetricEvent) {
+    EXPECT_EQ(MetricRecord().toMetricEvent(), nullptr);
+
+    auto timestamp = std::chrono::steady_clock::now();
+    auto metricEvent = MetricRecord(MetricNameRegistry::intern("activity"), Priority::NORMAL, timestamp)
+                           .addCounter(MetricNameRegistry::intern("counter"), 7)
+                           .addDuration(MetricNameRegistry::intern("duration"), std::chrono::milliseconds(12))
+                           .addString(MetricNameRegistry::intern("string"), "value")
+                           .toMetricEvent();
+    ASSERT_NE(metricEvent, nullptr);
+    EXPECT_EQ(metricEvent->getActivityName(), "activity");
+    EXPECT_EQ(metricEvent->getPriority(), Priority::NORMAL);
+    EXPECT_EQ(metricEvent->getSteadyTimestamp(), timestamp);
+    EXPECT_EQ(metricEvent->getDataPoints().size(), 3u);
+    EXPECT_EQ(metricEvent->getDataPoint("counter", DataType::COUNTER).value().getValue(), "7");
+    EXPECT_EQ(metricEvent->getDataPoint("duration", DataType::DURATION).value().getValue(), "12");
+    EXPECT_EQ(metricEvent->getDataPoint("string", DataType::STRING).value().getValue(), "value");
+}
+
+}  // namespace test
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
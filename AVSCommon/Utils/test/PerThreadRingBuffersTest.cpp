@@ -0,0 +1,193 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Threading/PerThreadRingBuffers.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/// Gives the tests access to the lock of the ring buffers of a @c PerThreadRingBuffers.
+class PerThreadRingBuffersTestHelper {
+public:
+    /**
+     * Lock the list of ring buffers.
+     *
+     * @param ringBuffers The ring buffers.
+     * @return The lock.
+     */
+    static std::unique_lock<std::mutex> lock(PerThreadRingBuffersBase& ringBuffers) {
+        return std::unique_lock<std::mutex>(ringBuffers.m_ringBuffersMutex);
+    }
+};
+
+namespace test {
+
+/// The capacity of the ring buffers used by the tests.
+static const size_t CAPACITY = 4;
+
+/// A ring buffer of integers, each of which takes one unit of the capacity.
+class IntRingBuffer : public PerThreadRingBuffer {
+public:
+    /**
+     * Constructor.
+     *
+     * @param capacity The number of integers the buffer can hold; must be a power of two.
+     */
+    explicit IntRingBuffer(size_t capacity) : PerThreadRingBuffer(capacity), m_values(capacity) {
+    }
+
+    /**
+     * Append an integer.
+     *
+     * @param value The integer to append.
+     * @return Whether the integer was appended.
+     */
+    bool push(int value) {
+        uint64_t head;
+        if (!beginPush(1, &head)) {
+            return false;
+        }
+        m_values[getOffset(head)] = value;
+        endPush(head + 1);
+        return true;
+    }
+
+    /**
+     * Remove the oldest integer.
+     *
+     * @param[out] value The integer removed.
+     * @return Whether an integer was removed.
+     */
+    bool pop(int* value) {
+        uint64_t tail;
+        if (!beginPop(&tail)) {
+            return false;
+        }
+        *value = m_values[getOffset(tail)];
+        endPop(tail + 1);
+        return true;
+    }
+
+private:
+    /// The storage of the ring buffer.
+    std::vector<int> m_values;
+};
+
+/// Verify that values are rounded up to the next power of two.
+TEST(PerThreadRingBuffersTest, test_roundUpToPowerOfTwo) {
+    EXPECT_EQ(roundUpToPowerOfTwo(0), 1u);
+    EXPECT_EQ(roundUpToPowerOfTwo(1), 1u);
+    EXPECT_EQ(roundUpToPowerOfTwo(3), 4u);
+    EXPECT_EQ(roundUpToPowerOfTwo(1024), 1024u);
+    EXPECT_EQ(roundUpToPowerOfTwo(1025), 2048u);
+}
+
+/// Verify that a ring buffer keeps its entries in order across its end, and drops entries when it is full.
+TEST(PerThreadRingBuffersTest, test_pushAndPopWrapAndDrop) {
+    IntRingBuffer ringBuffer(CAPACITY);
+    int value = 0;
+    for (int round = 0; round < 3; ++round) {
+        for (size_t i = 0; i < CAPACITY; ++i) {
+            EXPECT_TRUE(ringBuffer.push(static_cast<int>(i)));
+        }
+        EXPECT_FALSE(ringBuffer.push(-1));
+        for (size_t i = 0; i < CAPACITY; ++i) {
+            ASSERT_TRUE(ringBuffer.pop(&value));
+            EXPECT_EQ(value, static_cast<int>(i));
+        }
+        EXPECT_TRUE(ringBuffer.empty());
+        EXPECT_FALSE(ringBuffer.pop(&value));
+    }
+    EXPECT_EQ(ringBuffer.getDroppedCount(), 3u);
+}
+
+/// Verify that every thread gets its own ring buffer, and keeps getting the same one.
+TEST(PerThreadRingBuffersTest, test_eachThreadGetsItsOwnRingBuffer) {
+    PerThreadRingBuffers<IntRingBuffer> ringBuffers(CAPACITY);
+    auto mainRingBuffer = ringBuffers.getThreadRingBuffer();
+    EXPECT_EQ(ringBuffers.getThreadRingBuffer(), mainRingBuffer);
+
+    IntRingBuffer* otherRingBuffer = nullptr;
+    std::thread([&] { otherRingBuffer = ringBuffers.getThreadRingBuffer(); }).join();
+    EXPECT_NE(otherRingBuffer, mainRingBuffer);
+
+    PerThreadRingBuffers<IntRingBuffer> otherRingBuffers(CAPACITY);
+    EXPECT_NE(otherRingBuffers.getThreadRingBuffer(), mainRingBuffer);
+}
+
+/// Verify that the ring buffer of a thread which has exited is released once drained, keeping its dropped count.
+TEST(PerThreadRingBuffersTest, test_ringBufferOfExitedThreadIsReleasedOnceDrained) {
+    PerThreadRingBuffers<IntRingBuffer> ringBuffers(CAPACITY);
+    ringBuffers.getThreadRingBuffer()->push(0);
+    std::thread([&] {
+        auto ringBuffer = ringBuffers.getThreadRingBuffer();
+        for (size_t i = 0; i <= CAPACITY; ++i) {
+            ringBuffer->push(static_cast<int>(i));
+        }
+    }).join();
+    EXPECT_FALSE(ringBuffers.empty());
+    EXPECT_EQ(ringBuffers.getDroppedCount(), 1u);
+
+    auto collected = ringBuffers.collect();
+    ASSERT_EQ(collected.size(), 2u);
+    int value = 0;
+    for (auto& ringBuffer : collected) {
+        while (ringBuffer->pop(&value)) {
+        }
+    }
+    EXPECT_TRUE(ringBuffers.empty());
+    collected.clear();
+
+    collected = ringBuffers.collect();
+    ASSERT_EQ(collected.size(), 1u);
+    EXPECT_EQ(collected.front().get(), ringBuffers.getThreadRingBuffer());
+    EXPECT_EQ(ringBuffers.getDroppedCount(), 1u);
+}
+
+/// Verify that @c tryForEach() visits every ring buffer, unless the list of ring buffers is locked.
+TEST(PerThreadRingBuffersTest, test_tryForEachSkipsWhileLocked) {
+    PerThreadRingBuffers<IntRingBuffer> ringBuffers(CAPACITY);
+    ringBuffers.getThreadRingBuffer()->push(1);
+    std::thread([&] { ringBuffers.getThreadRingBuffer()->push(2); }).join();
+
+    int sum = 0;
+    auto addAll = [&sum](IntRingBuffer& ringBuffer) {
+        int value = 0;
+        while (ringBuffer.pop(&value)) {
+            sum += value;
+        }
+    };
+    {
+        auto lock = PerThreadRingBuffersTestHelper::lock(ringBuffers);
+        EXPECT_FALSE(ringBuffers.tryForEach(addAll));
+    }
+    EXPECT_EQ(sum, 0);
+    EXPECT_TRUE(ringBuffers.tryForEach(addAll));
+    EXPECT_EQ(sum, 3);
+}
+
+}  // namespace test
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,210 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file SharedDataStreamContentionTest.cpp
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/SDS/InProcessSDS.h"
+#include "AVSCommon/Utils/SDS/LowLatencyInProcessSDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+namespace test {
+
+/// Size of a sample in bytes (16 bit PCM).
+static const size_t WORD_SIZE = sizeof(int16_t);
+
+/// Number of samples in a 10 ms frame at 16 kHz.
+static const size_t FRAME_WORDS = 160;
+
+/// Number of frames held by the stream under test (two seconds of audio).
+static const size_t BUFFER_FRAMES = 200;
+
+/// Maximum number of readers used by these tests.
+static const size_t MAX_READERS = 3;
+
+/// Number of frames streamed by the functional tests.
+static const size_t TEST_FRAMES = 2000;
+
+/// Number of frames streamed by the benchmark (ten minutes of audio).
+static const size_t BENCHMARK_FRAMES = 60000;
+
+/// Timeout used for blocking operations which are expected to complete.
+static const std::chrono::seconds BLOCKING_TIMEOUT(5);
+
+/// Timeout used for blocking operations which are expected to time out.
+static const std::chrono::milliseconds SHORT_TIMEOUT(20);
+
+/**
+ * Create a stream for @c FRAME_WORDS sized frames.
+ *
+ * @tparam SDS The @c SharedDataStream type to create.
+ * @return The new stream.
+ */
+template <typename SDS>
+static std::shared_ptr<SDS> createStream() {
+    auto bufferSize = SDS::calculateBufferSize(BUFFER_FRAMES * FRAME_WORDS, WORD_SIZE, MAX_READERS);
+    auto buffer = std::make_shared<typename SDS::Buffer>(bufferSize);
+    return SDS::create(buffer, WORD_SIZE, MAX_READERS);
+}
+
+/**
+ * Stream @c numFrames frames from a blocking writer to @c numReaders blocking readers, each running on its own
+ * thread, and check that every reader received every frame in order.
+ *
+ * @tparam SDS The @c SharedDataStream type to use.
+ * @param numReaders The number of readers.
+ * @param numFrames The number of frames to stream.
+ * @return The time it took until all readers received all frames.
+ */
+template <typename SDS>
+static std::chrono::nanoseconds streamFrames(size_t numReaders, size_t numFrames) {
+    auto stream = createStream<SDS>();
+    auto writer = stream->createWriter(SDS::Writer::Policy::BLOCKING);
+    std::vector<std::shared_ptr<typename SDS::Reader>> readers;
+    for (size_t i = 0; i < numReaders; ++i) {
+        readers.push_back(stream->createReader(SDS::Reader::Policy::BLOCKING));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> readerThreads;
+    for (auto& reader : readers) {
+        readerThreads.emplace_back([reader, numFrames] {
+            std::vector<int16_t> frame(FRAME_WORDS);
+            for (size_t i = 0; i < numFrames; ++i) {
+                size_t wordsRead = 0;
+                while (wordsRead < FRAME_WORDS) {
+                    auto result = reader->read(frame.data() + wordsRead, FRAME_WORDS - wordsRead, BLOCKING_TIMEOUT);
+                    ASSERT_GT(result, 0);
+                    wordsRead += result;
+                }
+                ASSERT_EQ(frame.front(), static_cast<int16_t>(i));
+                ASSERT_EQ(frame.back(), static_cast<int16_t>(i));
+            }
+        });
+    }
+
+    std::vector<int16_t> frame(FRAME_WORDS);
+    for (size_t i = 0; i < numFrames; ++i) {
+        std::fill(frame.begin(), frame.end(), static_cast<int16_t>(i));
+        size_t wordsWritten = 0;
+        while (wordsWritten < FRAME_WORDS) {
+            auto result = writer->write(frame.data() + wordsWritten, FRAME_WORDS - wordsWritten, BLOCKING_TIMEOUT);
+            EXPECT_GT(result, 0);
+            if (result <= 0) {
+                break;
+            }
+            wordsWritten += result;
+        }
+    }
+
+    for (auto& thread : readerThreads) {
+        thread.join();
+    }
+    return std::chrono::steady_clock::now() - start;
+}
+
+/// Typed test fixture covering each in-process set of traits.
+template <typename SDS>
+class SharedDataStreamContentionTest : public ::testing::Test {};
+
+/// The stream types under test.
+using StreamTypes = ::testing::Types<InProcessSDS, LowLatencyInProcessSDS>;
+TYPED_TEST_CASE(SharedDataStreamContentionTest, StreamTypes);
+
+/// Verify that a blocking writer and several blocking readers exchange every frame in order.
+TYPED_TEST(SharedDataStreamContentionTest, test_blockingWriterAndReaders) {
+    streamFrames<TypeParam>(MAX_READERS, TEST_FRAMES);
+}
+
+/// Verify that a blocking read with no data available times out.
+TYPED_TEST(SharedDataStreamContentionTest, test_blockingReadTimesOut) {
+    auto stream = createStream<TypeParam>();
+    auto writer = stream->createWriter(TypeParam::Writer::Policy::BLOCKING);
+    auto reader = stream->createReader(TypeParam::Reader::Policy::BLOCKING);
+    std::vector<int16_t> frame(FRAME_WORDS);
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(reader->read(frame.data(), FRAME_WORDS, SHORT_TIMEOUT), TypeParam::Reader::Error::TIMEDOUT);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, SHORT_TIMEOUT);
+}
+
+/// Verify that a blocked reader is woken up when the writer closes.
+TYPED_TEST(SharedDataStreamContentionTest, test_blockedReaderWokenByWriterClose) {
+    auto stream = createStream<TypeParam>();
+    auto writer = stream->createWriter(TypeParam::Writer::Policy::BLOCKING);
+    auto reader = stream->createReader(TypeParam::Reader::Policy::BLOCKING);
+    std::vector<int16_t> frame(FRAME_WORDS);
+
+    std::thread closer([&writer] {
+        std::this_thread::sleep_for(SHORT_TIMEOUT);
+        writer->close();
+    });
+    EXPECT_EQ(reader->read(frame.data(), FRAME_WORDS, BLOCKING_TIMEOUT), TypeParam::Reader::Error::CLOSED);
+    closer.join();
+}
+
+/// Verify that a blocking writer waits for a slow reader to free up space.
+TYPED_TEST(SharedDataStreamContentionTest, test_blockedWriterWokenByReader) {
+    auto stream = createStream<TypeParam>();
+    auto writer = stream->createWriter(TypeParam::Writer::Policy::BLOCKING);
+    auto reader = stream->createReader(TypeParam::Reader::Policy::BLOCKING);
+    std::vector<int16_t> frame(FRAME_WORDS);
+
+    for (size_t i = 0; i < BUFFER_FRAMES; ++i) {
+        ASSERT_EQ(writer->write(frame.data(), FRAME_WORDS, BLOCKING_TIMEOUT), static_cast<ssize_t>(FRAME_WORDS));
+    }
+    EXPECT_EQ(writer->write(frame.data(), FRAME_WORDS, SHORT_TIMEOUT), TypeParam::Writer::Error::TIMEDOUT);
+
+    std::thread consumer([&reader] {
+        std::vector<int16_t> frame(FRAME_WORDS);
+        std::this_thread::sleep_for(SHORT_TIMEOUT);
+        reader->read(frame.data(), FRAME_WORDS, BLOCKING_TIMEOUT);
+    });
+    EXPECT_EQ(writer->write(frame.data(), FRAME_WORDS, BLOCKING_TIMEOUT), static_cast<ssize_t>(FRAME_WORDS));
+    consumer.join();
+}
+
+/**
+ * Contention benchmark: a single writer streams ten minutes of 16 kHz audio in 10 ms frames to three readers, which
+ * matches the microphone, wake word and AudioInputProcessor layout.  Reports the cost per frame for each set of
+ * traits.
+ */
+TEST(SharedDataStreamContentionBenchmark, testSlow_writerWithThreeReaders) {
+    auto inProcess = streamFrames<InProcessSDS>(MAX_READERS, BENCHMARK_FRAMES);
+    auto lowLatency = streamFrames<LowLatencyInProcessSDS>(MAX_READERS, BENCHMARK_FRAMES);
+
+    auto perFrame = [](std::chrono::nanoseconds elapsed) { return elapsed.count() / BENCHMARK_FRAMES; };
+    std::cout << "SharedDataStream contention benchmark (" << BENCHMARK_FRAMES << " frames, " << MAX_READERS
+              << " readers)" << std::endl
+              << "  InProcessSDS:           " << perFrame(inProcess) << " ns/frame" << std::endl
+              << "  LowLatencyInProcessSDS: " << perFrame(lowLatency) << " ns/frame" << std::endl;
+}
+
+}  // namespace test
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
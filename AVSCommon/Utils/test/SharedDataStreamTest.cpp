@@ -1317,6 +1317,29 @@ TEST_F(SharedDataStreamTest, test_firstReaderCanSeekSDSBeginning) {
     EXPECT_TRUE(reader->seek(0, Sds::Reader::Reference::ABSOLUTE));
 }
 
+/// This tests that a read reports an overrun when the writer overwrites the data while the reader uses it in place.
+TEST_F(SharedDataStreamTest, test_readerDetectsOverrunOfDataUsedInPlace) {
+    static const size_t WORDSIZE = 1;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    uint8_t writeBuf[WORDSIZE * WORDCOUNT] = {};
+    ASSERT_EQ(writer->write(writeBuf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+
+    // Writing one more word overwrites the first word being read, but not the words after the read.
+    auto overwritingFunction = [&writer, &writeBuf](void*, size_t) { return writer->write(writeBuf, 1) == 1; };
+    EXPECT_EQ(reader->read(overwritingFunction, WORDCOUNT / 2), Sds::Reader::Error::OVERRUN);
+}
+
 }  // namespace test
 }  // namespace sds
 }  // namespace utils
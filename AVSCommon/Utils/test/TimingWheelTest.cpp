@@ -0,0 +1,266 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "AVSCommon/Utils/Timing/MultiTimer.h"
+#include "AVSCommon/Utils/Timing/TimingWheel.h"
+#include "AVSCommon/Utils/WaitEvent.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+namespace test {
+
+using namespace std::chrono;
+
+/// Number of outstanding timers used by the benchmark.
+static const size_t BENCHMARK_TIMER_COUNT = 10000;
+
+/// Timeout used when waiting for tasks which are expected to run.
+static const seconds TIMEOUT{5};
+
+/// Test that a submitted task gets called, and not before its delay.
+TEST(TimingWheelTest, test_taskGetsCalled) {
+    WaitEvent calledEvent;
+    auto wheel = TimingWheel::create();
+    ASSERT_NE(wheel, nullptr);
+    auto start = steady_clock::now();
+    steady_clock::time_point calledAt;
+    wheel->submitTask(milliseconds(20), [&] {
+        calledAt = steady_clock::now();
+        calledEvent.wakeUp();
+    });
+
+    ASSERT_TRUE(calledEvent.wait(TIMEOUT));
+    EXPECT_GE(calledAt - start, milliseconds(20));
+    EXPECT_EQ(wheel->size(), 0u);
+}
+
+/// Test that an invalid resolution is rejected.
+TEST(TimingWheelTest, test_createWithInvalidResolution) {
+    EXPECT_EQ(TimingWheel::create(milliseconds::zero()), nullptr);
+}
+
+/// Test that a task with a non-positive delay runs right away.
+TEST(TimingWheelTest, test_zeroDelayRunsImmediately) {
+    WaitEvent calledEvent;
+    auto wheel = TimingWheel::create();
+    wheel->submitTask(milliseconds(-5), [&calledEvent] { calledEvent.wakeUp(); });
+    EXPECT_TRUE(calledEvent.wait(milliseconds(500)));
+}
+
+/// Test that a cancelled task does not run, and that cancelling reports whether the task was still pending.
+TEST(TimingWheelTest, testTimer_cancelledTaskShouldNotRun) {
+    WaitEvent calledEvent;
+    WaitEvent otherEvent;
+    auto wheel = TimingWheel::create();
+    auto token = wheel->submitTask(milliseconds(100), [&calledEvent] { calledEvent.wakeUp(); });
+    auto otherToken = wheel->submitTask(milliseconds(10), [&otherEvent] { otherEvent.wakeUp(); });
+
+    EXPECT_TRUE(wheel->cancelTask(token));
+    EXPECT_FALSE(wheel->cancelTask(token));
+    EXPECT_TRUE(otherEvent.wait(TIMEOUT));
+    EXPECT_FALSE(wheel->cancelTask(otherToken));
+    EXPECT_FALSE(calledEvent.wait(milliseconds(300)));
+}
+
+/// Test that tasks run in order of expiry, including tasks which cascade down from upper levels of the wheel.
+TEST(TimingWheelTest, testTimer_executionOrderFollowsExpiry) {
+    WaitEvent doneEvent;
+    auto wheel = TimingWheel::create();
+    std::mutex mutex;
+    std::vector<int> order;
+    std::vector<int> delays = {300, 5, 70, 60, 150, 1, 130, 90, 200};
+    for (auto delay : delays) {
+        wheel->submitTask(milliseconds(delay), [&, delay] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(delay);
+            if (order.size() == delays.size()) {
+                doneEvent.wakeUp();
+            }
+        });
+    }
+
+    ASSERT_TRUE(doneEvent.wait(TIMEOUT));
+    std::sort(delays.begin(), delays.end());
+    EXPECT_EQ(order, delays);
+}
+
+/// Test that a task beyond the reach of the first two levels cascades down and runs on time.
+TEST(TimingWheelTest, testSlow_taskFromUpperLevelRunsOnTime) {
+    WaitEvent calledEvent;
+    auto wheel = TimingWheel::create();
+    auto start = steady_clock::now();
+    steady_clock::time_point calledAt;
+    // 64 * 64 ticks is the first delay held by the third level.
+    wheel->submitTask(milliseconds(4200), [&] {
+        calledAt = steady_clock::now();
+        calledEvent.wakeUp();
+    });
+
+    ASSERT_TRUE(calledEvent.wait(seconds(10)));
+    EXPECT_GE(calledAt - start, milliseconds(4200));
+    EXPECT_LT(calledAt - start, milliseconds(4400));
+}
+
+/// Test that slots which expire while a long task runs are not skipped when other tasks are waiting to run.
+TEST(TimingWheelTest, test_slotsExpiringDuringLongTaskAreNotSkipped) {
+    WaitEvent startedEvent;
+    WaitEvent calledEvent;
+    std::mutex orderMutex;
+    std::vector<int> order;
+    auto wheel = TimingWheel::create();
+    wheel->submitTask(milliseconds::zero(), [&startedEvent] {
+        startedEvent.wakeUp();
+        std::this_thread::sleep_for(milliseconds(30));
+    });
+    wheel->submitTask(milliseconds::zero(), [] {});
+    ASSERT_TRUE(startedEvent.wait(TIMEOUT));
+
+    // A skipped slot would only be processed a full rotation of the first level later, after the second task.
+    wheel->submitTask(milliseconds(5), [&] {
+        std::lock_guard<std::mutex> lock(orderMutex);
+        order.push_back(1);
+    });
+    wheel->submitTask(milliseconds(45), [&] {
+        {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(2);
+        }
+        calledEvent.wakeUp();
+    });
+
+    ASSERT_TRUE(calledEvent.wait(TIMEOUT));
+    std::lock_guard<std::mutex> lock(orderMutex);
+    EXPECT_EQ(order, std::vector<int>({1, 2}));
+}
+
+/// Test that a task can submit another task, and that the wheel keeps running tasks submitted from tasks.
+TEST(TimingWheelTest, test_taskSubmitsTask) {
+    WaitEvent calledEvent;
+    auto wheel = TimingWheel::create();
+    wheel->submitTask(milliseconds(5), [&] {
+        wheel->submitTask(milliseconds(5), [&calledEvent] { calledEvent.wakeUp(); });
+    });
+    EXPECT_TRUE(calledEvent.wait(TIMEOUT));
+}
+
+/// Test that pending tasks are discarded when the wheel is destroyed.
+TEST(TimingWheelTest, test_destroyDiscardsPendingTasks) {
+    auto called = std::make_shared<std::atomic<bool>>(false);
+    {
+        auto wheel = TimingWheel::create();
+        wheel->submitTask(milliseconds(50), [called] { *called = true; });
+    }
+    std::this_thread::sleep_for(milliseconds(100));
+    EXPECT_FALSE(*called);
+    EXPECT_EQ(called.use_count(), 1);
+}
+
+/**
+ * Measure the cost of scheduling and cancelling @c BENCHMARK_TIMER_COUNT outstanding timers with @c MultiTimer and
+ * @c TimingWheel, and how late the wheel runs them when they all expire within one second.
+ */
+TEST(TimingWheelTest, testSlow_benchmarkOutstandingTimers) {
+    std::mt19937 random(12345);
+    std::vector<milliseconds> delays;
+    for (size_t i = 0; i < BENCHMARK_TIMER_COUNT; ++i) {
+        delays.push_back(milliseconds(60000 + random() % 60000));
+    }
+    std::vector<size_t> cancelOrder(BENCHMARK_TIMER_COUNT);
+    for (size_t i = 0; i < cancelOrder.size(); ++i) {
+        cancelOrder[i] = i;
+    }
+    std::shuffle(cancelOrder.begin(), cancelOrder.end(), random);
+
+    auto report = [](const std::string& name, duration<double> submit, duration<double> cancel) {
+        std::cout << "  " << std::left << std::setw(12) << name << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(10) << duration<double, std::micro>(submit).count() / BENCHMARK_TIMER_COUNT
+                  << " us/submit" << std::setw(10)
+                  << duration<double, std::micro>(cancel).count() / BENCHMARK_TIMER_COUNT << " us/cancel"
+                  << std::endl;
+    };
+
+    {
+        MultiTimer timer;
+        std::vector<MultiTimer::Token> tokens;
+        auto start = steady_clock::now();
+        for (auto delay : delays) {
+            tokens.push_back(timer.submitTask(delay, [] {}));
+        }
+        auto submitted = steady_clock::now();
+        for (auto index : cancelOrder) {
+            timer.cancelTask(tokens[index]);
+        }
+        report("MultiTimer", submitted - start, steady_clock::now() - submitted);
+    }
+
+    {
+        auto wheel = TimingWheel::create();
+        std::vector<TimingWheel::Token> tokens;
+        auto start = steady_clock::now();
+        for (auto delay : delays) {
+            tokens.push_back(wheel->submitTask(delay, [] {}));
+        }
+        auto submitted = steady_clock::now();
+        EXPECT_EQ(wheel->size(), BENCHMARK_TIMER_COUNT);
+        for (auto index : cancelOrder) {
+            EXPECT_TRUE(wheel->cancelTask(tokens[index]));
+        }
+        report("TimingWheel", submitted - start, steady_clock::now() - submitted);
+        EXPECT_EQ(wheel->size(), 0u);
+    }
+
+    auto wheel = TimingWheel::create();
+    WaitEvent doneEvent;
+    std::mutex mutex;
+    size_t count = 0;
+    nanoseconds totalLateness{0};
+    nanoseconds maxLateness{0};
+    for (size_t i = 0; i < BENCHMARK_TIMER_COUNT; ++i) {
+        auto due = steady_clock::now() + milliseconds(random() % 1000);
+        wheel->submitTask(due - steady_clock::now(), [&, due] {
+            auto lateness = steady_clock::now() - due;
+            std::lock_guard<std::mutex> lock(mutex);
+            EXPECT_GE(lateness, nanoseconds::zero());
+            totalLateness += lateness;
+            maxLateness = std::max(maxLateness, nanoseconds(lateness));
+            if (++count == BENCHMARK_TIMER_COUNT) {
+                doneEvent.wakeUp();
+            }
+        });
+    }
+    ASSERT_TRUE(doneEvent.wait(TIMEOUT));
+    std::cout << "  TimingWheel lateness: " << std::fixed << std::setprecision(3)
+              << duration<double, std::milli>(totalLateness).count() / BENCHMARK_TIMER_COUNT << " ms average, "
+              << duration<double, std::milli>(maxLateness).count() << " ms max" << std::endl;
+}
+
+}  // namespace test
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
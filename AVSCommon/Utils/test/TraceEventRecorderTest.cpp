@@ -0,0 +1,113 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include "AVSCommon/Utils/Timing/TraceEventRecorder.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+namespace test {
+
+using namespace rapidjson;
+
+/// Path of the file written by @c test_writeToFile.
+static const std::string TRACE_FILE_PATH = "/tmp/TraceEventRecorderTest.json";
+
+/// Test harness for @c TraceEventRecorder.
+class TraceEventRecorderTest : public ::testing::Test {
+protected:
+    /// The recorder under test.
+    std::shared_ptr<TraceEventRecorder> m_recorder = std::make_shared<TraceEventRecorder>();
+};
+
+/**
+ * Verify that an empty recorder still produces a valid trace.
+ */
+TEST_F(TraceEventRecorderTest, test_emptyTrace) {
+    Document document;
+    ASSERT_FALSE(document.Parse(m_recorder->toJson().c_str()).HasParseError());
+    ASSERT_TRUE(document["traceEvents"].IsArray());
+    EXPECT_EQ(document["traceEvents"].Size(), 0u);
+    EXPECT_EQ(m_recorder->getEventCount(), 0u);
+}
+
+/**
+ * Verify that a complete event is serialized with its name, category, start and duration.
+ */
+TEST_F(TraceEventRecorderTest, test_recordCompleteEvent) {
+    auto start = TraceEventRecorder::Clock::now() + std::chrono::milliseconds(5);
+    m_recorder->recordCompleteEvent("open", "storage", start, start + std::chrono::milliseconds(20));
+    ASSERT_EQ(m_recorder->getEventCount(), 1u);
+
+    Document document;
+    ASSERT_FALSE(document.Parse(m_recorder->toJson().c_str()).HasParseError());
+    ASSERT_EQ(document["traceEvents"].Size(), 1u);
+    const auto& event = document["traceEvents"][0];
+    EXPECT_STREQ(event["name"].GetString(), "open");
+    EXPECT_STREQ(event["cat"].GetString(), "storage");
+    EXPECT_STREQ(event["ph"].GetString(), "X");
+    EXPECT_GE(event["ts"].GetInt64(), 5000);
+    EXPECT_EQ(event["dur"].GetInt64(), 20000);
+    EXPECT_EQ(event["tid"].GetInt(), 1);
+}
+
+/**
+ * Verify that @c Scope records an event on destruction, on the thread that created it, and that a null recorder
+ * is tolerated.
+ */
+TEST_F(TraceEventRecorderTest, test_scopeRecordsPerThread) {
+    { TraceEventRecorder::Scope scope(m_recorder, "main", "test"); }
+    std::thread thread([this] { TraceEventRecorder::Scope scope(m_recorder, "worker", "test"); });
+    thread.join();
+    { TraceEventRecorder::Scope scope(nullptr, "ignored", "test"); }
+    ASSERT_EQ(m_recorder->getEventCount(), 2u);
+
+    Document document;
+    ASSERT_FALSE(document.Parse(m_recorder->toJson().c_str()).HasParseError());
+    EXPECT_STREQ(document["traceEvents"][0]["name"].GetString(), "main");
+    EXPECT_STREQ(document["traceEvents"][1]["name"].GetString(), "worker");
+    EXPECT_NE(document["traceEvents"][0]["tid"].GetInt(), document["traceEvents"][1]["tid"].GetInt());
+}
+
+/**
+ * Verify that the trace written to a file matches @c toJson().
+ */
+TEST_F(TraceEventRecorderTest, test_writeToFile) {
+    { TraceEventRecorder::Scope scope(m_recorder, "event", "test"); }
+    ASSERT_TRUE(m_recorder->writeToFile(TRACE_FILE_PATH));
+
+    std::ifstream file(TRACE_FILE_PATH);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    EXPECT_EQ(contents.str(), m_recorder->toJson());
+    std::remove(TRACE_FILE_PATH.c_str());
+
+    EXPECT_FALSE(m_recorder->writeToFile("/nonexistent/directory/trace.json"));
+}
+
+}  // namespace test
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
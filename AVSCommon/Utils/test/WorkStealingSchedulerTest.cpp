@@ -0,0 +1,173 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Configuration/ConfigurationNode.h"
+#include "AVSCommon/Utils/Threading/WorkStealingScheduler.h"
+#include "AVSCommon/Utils/WaitEvent.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+namespace test {
+
+/// Number of core workers used by the tests.
+static const size_t NUM_WORKERS = 2;
+
+/// Number of jobs scheduled by the tests.
+static const int NUM_JOBS = 1000;
+
+/// Timeout for waiting on jobs which are expected to run.
+static const std::chrono::seconds TIMEOUT{5};
+
+/// Starvation timeout used by the tests.
+static const std::chrono::milliseconds STARVATION_TIMEOUT{10};
+
+/// Verify that an empty job is rejected.
+TEST(WorkStealingSchedulerTest, test_scheduleEmptyJobFails) {
+    WorkStealingScheduler scheduler(NUM_WORKERS);
+    EXPECT_FALSE(scheduler.schedule(nullptr));
+    EXPECT_EQ(scheduler.getNumWorkers(), NUM_WORKERS);
+}
+
+/// Verify that every job scheduled from outside of the scheduler runs exactly once.
+TEST(WorkStealingSchedulerTest, test_runsJobsScheduledFromOutside) {
+    std::atomic<int> counter{0};
+    WaitEvent done;
+    WorkStealingScheduler scheduler(NUM_WORKERS);
+    for (int i = 0; i < NUM_JOBS; ++i) {
+        ASSERT_TRUE(scheduler.schedule([&counter, &done] {
+            if (NUM_JOBS == ++counter) {
+                done.wakeUp();
+            }
+        }));
+    }
+    ASSERT_TRUE(done.wait(TIMEOUT));
+
+    uint64_t jobsRun = 0, jobsStolen = 0, spareWorkersCreated = 0;
+    scheduler.getStats(jobsRun, jobsStolen, spareWorkersCreated);
+    EXPECT_EQ(jobsRun, static_cast<uint64_t>(NUM_JOBS));
+}
+
+/// Verify that jobs scheduled from a worker run, and that idle workers can steal them.
+TEST(WorkStealingSchedulerTest, test_runsJobsScheduledFromWorkers) {
+    std::atomic<int> counter{0};
+    WaitEvent done;
+    WorkStealingScheduler scheduler(NUM_WORKERS);
+    scheduler.schedule([&] {
+        for (int i = 0; i < NUM_JOBS; ++i) {
+            scheduler.schedule([&counter, &done] {
+                if (NUM_JOBS == ++counter) {
+                    done.wakeUp();
+                }
+            });
+        }
+    });
+    ASSERT_TRUE(done.wait(TIMEOUT));
+}
+
+/// Verify that jobs which block on queued jobs do not starve them, by having a spare worker added.
+TEST(WorkStealingSchedulerTest, testTimer_blockedWorkersGetSpareWorker) {
+    WorkStealingScheduler scheduler(NUM_WORKERS, STARVATION_TIMEOUT);
+    std::promise<void> unblock;
+    auto unblocked = unblock.get_future().share();
+    std::atomic<size_t> finished{0};
+    WaitEvent done;
+
+    for (size_t i = 0; i < NUM_WORKERS; ++i) {
+        scheduler.schedule([unblocked, &finished, &done] {
+            unblocked.wait();
+            if (NUM_WORKERS == ++finished) {
+                done.wakeUp();
+            }
+        });
+    }
+    scheduler.schedule([&unblock] { unblock.set_value(); });
+    ASSERT_TRUE(done.wait(TIMEOUT));
+
+    uint64_t jobsRun = 0, jobsStolen = 0, spareWorkersCreated = 0;
+    scheduler.getStats(jobsRun, jobsStolen, spareWorkersCreated);
+    EXPECT_GE(spareWorkersCreated, 1u);
+}
+
+/// Verify that already scheduled jobs run before the destructor returns.
+TEST(WorkStealingSchedulerTest, test_destructorRunsScheduledJobs) {
+    std::atomic<int> counter{0};
+    {
+        WorkStealingScheduler scheduler(NUM_WORKERS);
+        for (int i = 0; i < NUM_JOBS; ++i) {
+            scheduler.schedule([&counter] { ++counter; });
+        }
+    }
+    EXPECT_EQ(counter, NUM_JOBS);
+}
+
+/// Verify that the scheduler can be destroyed by one of its own jobs.
+TEST(WorkStealingSchedulerTest, test_destroyFromJob) {
+    auto scheduler = std::make_shared<WorkStealingScheduler>(NUM_WORKERS);
+    std::promise<void> destroyed;
+    auto destroyedFuture = destroyed.get_future();
+    auto rawScheduler = scheduler.get();
+    rawScheduler->schedule([&scheduler, &destroyed] {
+        scheduler.reset();
+        destroyed.set_value();
+    });
+    ASSERT_EQ(destroyedFuture.wait_for(TIMEOUT), std::future_status::ready);
+    EXPECT_EQ(scheduler, nullptr);
+}
+
+/**
+ * Initialize the global configuration with the given JSON document.
+ *
+ * @param jsonConfiguration The configuration.
+ * @return Whether the configuration was initialized.
+ */
+static bool initializeConfiguration(const std::string& jsonConfiguration) {
+    configuration::ConfigurationNode::uninitialize();
+    std::vector<std::shared_ptr<std::istream>> jsonStream;
+    jsonStream.push_back(std::make_shared<std::stringstream>(jsonConfiguration));
+    return configuration::ConfigurationNode::initialize(jsonStream);
+}
+
+/// Verify that executors only get the shared scheduler when the configuration enables it.
+TEST(WorkStealingSchedulerTest, test_configuredSchedulerIsOptIn) {
+    ASSERT_TRUE(initializeConfiguration("{}"));
+    EXPECT_EQ(WorkStealingScheduler::getConfiguredScheduler(), nullptr);
+
+    ASSERT_TRUE(initializeConfiguration(R"({"workStealingScheduler": {"enabled": false}})"));
+    EXPECT_EQ(WorkStealingScheduler::getConfiguredScheduler(), nullptr);
+
+    ASSERT_TRUE(initializeConfiguration(R"({"workStealingScheduler": {"enabled": true}})"));
+    auto scheduler = WorkStealingScheduler::getConfiguredScheduler();
+    ASSERT_NE(scheduler, nullptr);
+    EXPECT_EQ(scheduler, WorkStealingScheduler::getDefaultScheduler());
+
+    configuration::ConfigurationNode::uninitialize();
+}
+
+}  // namespace test
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
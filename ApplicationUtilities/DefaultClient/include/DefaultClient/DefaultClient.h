@@ -334,6 +334,10 @@ public:
      * Creates and initializes a default AVS SDK client. To connect the client to AVS, users should make a call to
      * connect() after creation.
      *
+     * Startup can be tuned through the optional "defaultClient" configuration node: "startupTraceFile" names a file
+     * to write a Chrome trace of the time spent constructing each component to, and "constructionThreads" (default
+     * 1) allows independent components to be constructed concurrently (see @c acsdkManufactory::ConstructionOptions).
+     *
      * @deprecated
      * @param deviceInfo DeviceInfo which reflects the device setup credentials.
      * @param customerDataManager CustomerDataManager instance to be used by RegistrationManager and instances of
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include <acsdkExternalMediaPlayerInterfaces/ExternalMediaAdapterConstants.h>
 #include <acsdkNotifications/NotificationRenderer.h>
 #include <acsdkSystemClockMonitorInterfaces/SystemClockMonitorObserverInterface.h>
@@ -25,9 +27,11 @@
 #include <AVSCommon/AVS/SpeakerConstants/SpeakerConstants.h>
 #include <AVSCommon/SDKInterfaces/InternetConnectionMonitorInterface.h>
 #include <AVSCommon/Utils/Bluetooth/BluetoothEventBus.h>
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/MediaPlayer/PooledMediaResourceProvider.h>
 #include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <AVSCommon/Utils/Network/InternetConnectionMonitor.h>
+#include <AVSCommon/Utils/Timing/TraceEventRecorder.h>
 #include <Audio/SystemSoundAudioFactory.h>
 #include <Endpoints/EndpointBuilder.h>
 #include <InterruptModel/InterruptModel.h>
@@ -57,6 +61,8 @@ using namespace alexaClientSDK::endpoints;
 using namespace alexaClientSDK::avsCommon::sdkInterfaces;
 using namespace alexaClientSDK::avsCommon::utils;
 
+using avsCommon::utils::timing::TraceEventRecorder;
+
 /// String to identify log entries originating from this file.
 #define TAG "DefaultClient"
 
@@ -67,6 +73,18 @@ using namespace alexaClientSDK::avsCommon::utils;
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// Key for the @c DefaultClient configuration node.
+static const std::string DEFAULT_CLIENT_CONFIG_KEY = "defaultClient";
+
+/// Key for the file to write a Chrome trace of startup to.  Startup is not traced unless this is set.
+static const std::string STARTUP_TRACE_FILE_KEY = "startupTraceFile";
+
+/// Key for the maximum number of threads the manufactory may construct components on (default 1, i.e. serially).
+static const std::string CONSTRUCTION_THREADS_KEY = "constructionThreads";
+
+/// Category of the startup phases in the startup trace.
+static const std::string STARTUP_PHASE_TRACE_CATEGORY = "startup";
+
 std::unique_ptr<DefaultClient> DefaultClient::create(
     const std::shared_ptr<DefaultClientSubsetManufactory>& manufactory,
     std::shared_ptr<avsCommon::utils::mediaPlayer::MediaPlayerInterface> ringtoneMediaPlayer,
@@ -305,7 +323,24 @@ std::unique_ptr<DefaultClient> DefaultClient::create(
         bluetoothConnectionRulesProvider,
         std::move(notificationsStorage),
         cryptoFactory);
-    auto manufactory = DefaultClientManufactory::create(component);
+    auto config = configuration::ConfigurationNode::getRoot()[DEFAULT_CLIENT_CONFIG_KEY];
+    std::string startupTraceFile;
+    config.getString(STARTUP_TRACE_FILE_KEY, &startupTraceFile);
+    int constructionThreads = 1;
+    config.getInt(CONSTRUCTION_THREADS_KEY, &constructionThreads, constructionThreads);
+    std::shared_ptr<TraceEventRecorder> traceRecorder;
+    if (!startupTraceFile.empty()) {
+        traceRecorder = std::make_shared<TraceEventRecorder>();
+    }
+
+    acsdkManufactory::ConstructionOptions constructionOptions(
+        static_cast<size_t>(std::max(1, constructionThreads)), traceRecorder);
+
+    std::unique_ptr<DefaultClientManufactory> manufactory;
+    {
+        TraceEventRecorder::Scope scope(traceRecorder, "createManufactory", STARTUP_PHASE_TRACE_CATEGORY);
+        manufactory = DefaultClientManufactory::create(component, constructionOptions);
+    }
 
     auto speakerManager = manufactory->get<std::shared_ptr<SpeakerManagerInterface>>();
     if (!speakerManager) {
@@ -321,37 +356,51 @@ std::unique_ptr<DefaultClient> DefaultClient::create(
         ACSDK_ERROR(LX("createFailed").d("reason", "nullStartupManager"));
         return nullptr;
     }
-    startupManager->startup();
+    {
+        TraceEventRecorder::Scope scope(traceRecorder, "startup", STARTUP_PHASE_TRACE_CATEGORY);
+        startupManager->startup();
+    }
 
-    return create(
-        std::move(manufactory),
-        ringtoneMediaPlayer,
-        ringtoneSpeaker,
-        additionalSpeakers,
+    std::unique_ptr<DefaultClient> defaultClient;
+    {
+        TraceEventRecorder::Scope scope(traceRecorder, "initialize", STARTUP_PHASE_TRACE_CATEGORY);
+        defaultClient = create(
+            std::move(manufactory),
+            ringtoneMediaPlayer,
+            ringtoneSpeaker,
+            additionalSpeakers,
 #ifdef ENABLE_PCC
-        phoneSpeaker,
-        phoneCaller,
+            phoneSpeaker,
+            phoneCaller,
 #endif
 #ifdef ENABLE_MCC
-        meetingSpeaker,
-        meetingClient,
-        calendarClient,
+            meetingSpeaker,
+            meetingClient,
+            calendarClient,
 #endif
 #ifdef ENABLE_COMMS_AUDIO_PROXY
-        commsMediaPlayer,
-        commsSpeaker,
-        sharedDataStream,
+            commsMediaPlayer,
+            commsSpeaker,
+            sharedDataStream,
 #endif
-        alexaDialogStateObservers,
-        connectionObservers,
-        isGuiSupported,
-        firmwareVersion,
-        sendSoftwareInfoOnConnected,
-        softwareInfoSenderObserver,
-        diagnostics,
-        externalCapabilitiesBuilder,
-        firstInteractionAudioProvider,
-        sdkClientRegistry);
+            alexaDialogStateObservers,
+            connectionObservers,
+            isGuiSupported,
+            firmwareVersion,
+            sendSoftwareInfoOnConnected,
+            softwareInfoSenderObserver,
+            diagnostics,
+            externalCapabilitiesBuilder,
+            firstInteractionAudioProvider,
+            sdkClientRegistry);
+    }
+
+    if (traceRecorder) {
+        ACSDK_INFO(LX("writingStartupTrace").d("path", startupTraceFile).d("events", traceRecorder->getEventCount()));
+        traceRecorder->writeToFile(startupTraceFile);
+    }
+
+    return defaultClient;
 }
 
 bool DefaultClient::initialize(
@@ -280,7 +280,7 @@ DefaultClientComponent getComponent(
         .addRetainedFactory(avsCommon::avs::ExceptionEncounteredSender::createExceptionEncounteredSenderInterface)
         .addRetainedFactory(AVSConnectionManager::createAVSConnectionManagerInterface)
         .addRetainedFactory(AVSConnectionManager::createMessageSenderInterface)
-        .addRetainedFactory(AttachmentManager::createInProcessAttachmentManagerInterface)
+        .addRetainedFactory(AttachmentManager::createAttachmentManagerInterfaceFromConfiguration)
         .addRetainedFactory(certifiedSender::CertifiedSender::create)
         .addRetainedFactory(createAlexaEventProcessedNotifierInterface)
         .addRetainedFactory(DefaultSetCurlOptionsCallbackFactory::createSetCurlOptionsCallbackFactoryInterface)
@@ -18,6 +18,7 @@
 #include <rapidjson/writer.h>
 
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
+#include <AVSCommon/AVS/ParsedPayload.h>
 #include <AVSCommon/Utils/JSON/JSONGenerator.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/Metrics.h>
@@ -620,8 +621,8 @@ void SpeechSynthesizer::executePreHandleAfterValidation(std::shared_ptr<SpeakDir
         return;
     }
 
-    Document payload;
-    if (payload.Parse(speakInfo->directive->getPayload()).HasParseError()) {
+    auto parsedPayload = speakInfo->directive->getParsedPayload();
+    if (!parsedPayload) {
         const std::string message("unableToParsePayload" + speakInfo->directive->getMessageId());
         ACSDK_ERROR(
             LX("executePreHandleFailed").d("reason", message).d("messageId", speakInfo->directive->getMessageId()));
@@ -629,6 +630,7 @@ void SpeechSynthesizer::executePreHandleAfterValidation(std::shared_ptr<SpeakDir
             speakInfo, avsCommon::avs::ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED, message);
         return;
     }
+    const Value& payload = parsedPayload->getDocument();
 
     Value::ConstMemberIterator it = payload.FindMember(KEY_TOKEN);
     if (payload.MemberEnd() == it) {
@@ -712,7 +714,7 @@ void SpeechSynthesizer::executePreHandleAfterValidation(std::shared_ptr<SpeakDir
         auto captionIterator = payload.FindMember(KEY_CAPTION);
         if (payload.MemberEnd() != captionIterator) {
             if (captionIterator->value.IsObject()) {
-                rapidjson::Value& captionsPayload = payload[KEY_CAPTION];
+                const rapidjson::Value& captionsPayload = payload[KEY_CAPTION];
 
                 auto captionFormat = captions::CaptionFormat::UNKNOWN;
                 captionIterator = captionsPayload.FindMember(KEY_CAPTION_TYPE);
@@ -18,6 +18,11 @@
 
 #include "CertifiedSender/MessageStorageInterface.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <SQLiteStorage/SQLiteDatabase.h>
 
@@ -25,12 +30,67 @@ namespace alexaClientSDK {
 namespace certifiedSender {
 
 /**
- * An implementation that allows us to store messages using SQLite.
+ * An implementation that allows us to store messages using SQLite.  Calls are serialized internally, but the class is
+ * not meant to be shared by several owners.
+ *
+ * By default every @c store() and @c erase() is its own transaction, which is durable when the call returns.
+ *
+ * In group commit mode, which is enabled with the @c groupCommit settings (see below), stores and erases are
+ * coalesced into one transaction which is committed once it holds @c maxOperations operations, or @c windowMs after
+ * its first operation, whichever comes first; a background thread performs the timed commits.  The database uses
+ * write-ahead logging with @c synchronous=NORMAL in this mode.  This trades durability for far fewer fsyncs:
  *
- * This class is not thread-safe.
+ * - The database file is never corrupted, and every transaction is applied completely or not at all.
+ * - A @c store() or @c erase() which returned @c true is lost if the process crashes, or the device loses power,
+ *   before its transaction is committed; that is, within @c windowMs.  A lost store means that the message is not
+ *   sent after a restart if it was not sent before the crash; a lost erase means that a message may be sent twice,
+ *   which the certified sender already allows.
+ * - Committed transactions survive a crash of the process.  On power loss, the most recent committed transactions may
+ *   be rolled back as well, since the write-ahead log is only synced at checkpoints.
+ * - @c close() (and the destructor) and @c flush() commit the pending operations.
+ *
+ * @code{.json}
+ * "certifiedSender": {
+ *     "databaseFilePath": "/path/to/certifiedSender.db",
+ *     "groupCommit": {
+ *         "maxOperations": 32,
+ *         "windowMs": 200
+ *     }
+ * }
+ * @endcode
  */
 class SQLiteMessageStorage : public MessageStorageInterface {
 public:
+    /// Settings of the group commit mode.
+    struct GroupCommitSettings {
+        /**
+         * Constructor.
+         *
+         * @param maxOperations The number of operations after which a transaction is committed; 0 disables group
+         *     commit.
+         * @param window The longest time an operation may wait for its transaction to be committed.
+         */
+        GroupCommitSettings(
+            size_t maxOperations = 0,
+            std::chrono::milliseconds window = std::chrono::milliseconds(DEFAULT_WINDOW_MS));
+
+        /**
+         * Whether the group commit mode is enabled.
+         *
+         * @return Whether the group commit mode is enabled.
+         */
+        bool isEnabled() const;
+
+        /// The default commit window in milliseconds.
+        static const int DEFAULT_WINDOW_MS = 200;
+
+        /// The number of operations after which a transaction is committed; 0 disables group commit.
+        size_t maxOperations;
+
+        /// The longest time an operation may wait for its transaction to be committed.
+        std::chrono::milliseconds window;
+    };
+
     /**
      * Factory method for creating a storage object for Messages based on an SQLite database.
      *
@@ -53,8 +113,11 @@ public:
      * Constructor.
      *
      * @param dbFilePath The location of the SQLite database file.
+     * @param groupCommit The group commit settings; disabled by default.
      */
-    SQLiteMessageStorage(const std::string& databaseFilePath);
+    SQLiteMessageStorage(
+        const std::string& databaseFilePath,
+        const GroupCommitSettings& groupCommit = GroupCommitSettings());
 
     ~SQLiteMessageStorage();
 
@@ -74,10 +137,86 @@ public:
 
     bool clearDatabase() override;
 
+    /**
+     * Commit the operations which are pending in group commit mode.  Does nothing otherwise.
+     *
+     * @return Whether the pending operations, if any, were committed.
+     */
+    bool flush();
+
 private:
+    /**
+     * Close the database.  Must be called with @c m_mutex held.
+     */
+    void closeLocked();
+
+    /**
+     * Configure the journal of the opened database for the group commit mode.  Must be called with @c m_mutex held.
+     *
+     * @return Whether the journal was configured.
+     */
+    bool configureJournalLocked();
+
+    /**
+     * Begin a group commit transaction if none is pending, and count an operation in it.  Must be called with
+     * @c m_mutex held, before performing the operation.
+     *
+     * @return Whether a transaction is now pending.
+     */
+    bool beginOperationLocked();
+
+    /**
+     * Commit the group commit transaction once it is full.  Must be called with @c m_mutex held, after performing
+     * an operation.
+     */
+    void endOperationLocked();
+
+    /**
+     * Commit the pending group commit transaction, if any.  Must be called with @c m_mutex held.
+     *
+     * @return Whether the transaction, if any, was committed.
+     */
+    bool commitLocked();
+
+    /// The loop of the thread which commits the transactions whose window has elapsed.
+    void commitLoop();
+
     /// The underlying database class.
     alexaClientSDK::storage::sqliteStorage::SQLiteDatabase m_database;
 
+    /// The group commit settings.
+    const GroupCommitSettings m_groupCommit;
+
+    /// Serializes access to the database between the callers and the commit thread.
+    std::mutex m_mutex;
+
+    /// The pending group commit transaction, or @c nullptr.
+    std::unique_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteDatabase::Transaction> m_transaction;
+
+    /// The number of operations in @c m_transaction.
+    size_t m_pendingOperations;
+
+    /// When @c m_transaction must be committed.
+    std::chrono::steady_clock::time_point m_commitDeadline;
+
+    /// Prepared statement used by @c store(), kept until the database is closed.
+    std::unique_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteStatement> m_insertStatement;
+
+    /// Prepared statement used by @c erase(), kept until the database is closed.
+    std::unique_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteStatement> m_eraseStatement;
+
+    /// The largest message id in the database, or -1 if it has to be queried.
+    int m_maxId;
+
+    /// Whether the commit thread should exit.
+    bool m_isShuttingDown;
+
+    /// Used to wake up the commit thread.
+    std::condition_variable m_wakeTrigger;
+
+    /// The thread which commits the transactions whose window has elapsed; only started in group commit mode.
+    std::thread m_commitThread;
+
     /**
      * Utility that checks if database is legacy.
      *
@@ -44,6 +44,12 @@ using namespace alexaClientSDK::storage::sqliteStorage;
 static const std::string CERTIFIED_SENDER_CONFIGURATION_ROOT_KEY = "certifiedSender";
 /// The key in our config file to find the database file path.
 static const std::string CERTIFIED_SENDER_DB_FILE_PATH_KEY = "databaseFilePath";
+/// The key in our config file to find the group commit settings.
+static const std::string GROUP_COMMIT_KEY = "groupCommit";
+/// The key in the group commit settings for the number of operations after which a transaction is committed.
+static const std::string GROUP_COMMIT_MAX_OPERATIONS_KEY = "maxOperations";
+/// The key in the group commit settings for the longest time an operation may wait to be committed.
+static const std::string GROUP_COMMIT_WINDOW_KEY = "windowMs";
 
 /// The name of the alerts table.
 static const std::string MESSAGES_TABLE_NAME = "messages_with_uri";
@@ -70,6 +76,30 @@ static const std::string CREATE_MESSAGES_TABLE_SQL_STRING = std::string("CREATE
 
 // clang-format on
 
+/// The SQL string to insert a message.
+static const std::string INSERT_MESSAGE_SQL_STRING = std::string("INSERT INTO ") + MESSAGES_TABLE_NAME + " (" +
+                                                     DATABASE_COLUMN_ID_NAME + ", " + DATABASE_COLUMN_URI + ", " +
+                                                     DATABASE_COLUMN_MESSAGE_TEXT_NAME + ") VALUES (?, ?, ?);";
+
+/// The SQL string to erase a message.
+static const std::string ERASE_MESSAGE_SQL_STRING = "DELETE FROM " + MESSAGES_TABLE_NAME + " WHERE id=?;";
+
+/// The SQL strings which set up the journal for the group commit mode.
+static const std::string GROUP_COMMIT_JOURNAL_SQL_STRING = "PRAGMA journal_mode=WAL; PRAGMA synchronous=NORMAL;";
+
+const int SQLiteMessageStorage::GroupCommitSettings::DEFAULT_WINDOW_MS;
+
+SQLiteMessageStorage::GroupCommitSettings::GroupCommitSettings(
+    size_t maxOperations,
+    std::chrono::milliseconds window) :
+        maxOperations{maxOperations},
+        window{window} {
+}
+
+bool SQLiteMessageStorage::GroupCommitSettings::isEnabled() const {
+    return maxOperations > 0;
+}
+
 std::shared_ptr<MessageStorageInterface> SQLiteMessageStorage::createMessageStorageInterface(
     const std::shared_ptr<avsCommon::utils::configuration::ConfigurationNode>& configurationRoot) {
     return create((*configurationRoot));
@@ -94,26 +124,65 @@ std::unique_ptr<SQLiteMessageStorage> SQLiteMessageStorage::create(
         return nullptr;
     }
 
-    return std::unique_ptr<SQLiteMessageStorage>(new SQLiteMessageStorage(certifiedSenderDatabaseFilePath));
+    auto groupCommitRoot = certifiedSenderConfigurationRoot[GROUP_COMMIT_KEY];
+    int maxOperations = 0;
+    groupCommitRoot.getInt(GROUP_COMMIT_MAX_OPERATIONS_KEY, &maxOperations, 0);
+    std::chrono::milliseconds window;
+    groupCommitRoot.getDuration<std::chrono::milliseconds>(
+        GROUP_COMMIT_WINDOW_KEY, &window, std::chrono::milliseconds(GroupCommitSettings::DEFAULT_WINDOW_MS));
+    if (maxOperations < 0 || window.count() <= 0) {
+        ACSDK_ERROR(LX("createFailed")
+                        .d("reason", "invalidGroupCommitSettings")
+                        .d("maxOperations", maxOperations)
+                        .d("windowMs", window.count()));
+        return nullptr;
+    }
+
+    return std::unique_ptr<SQLiteMessageStorage>(new SQLiteMessageStorage(
+        certifiedSenderDatabaseFilePath, GroupCommitSettings(static_cast<size_t>(maxOperations), window)));
 }
 
-SQLiteMessageStorage::SQLiteMessageStorage(const std::string& certifiedSenderDatabaseFilePath) :
-        m_database{certifiedSenderDatabaseFilePath} {
+SQLiteMessageStorage::SQLiteMessageStorage(
+    const std::string& certifiedSenderDatabaseFilePath,
+    const GroupCommitSettings& groupCommit) :
+        m_database{certifiedSenderDatabaseFilePath},
+        m_groupCommit{groupCommit},
+        m_pendingOperations{0},
+        m_maxId{-1},
+        m_isShuttingDown{false} {
+    if (m_groupCommit.isEnabled()) {
+        m_commitThread = std::thread(&SQLiteMessageStorage::commitLoop, this);
+    }
 }
 
 SQLiteMessageStorage::~SQLiteMessageStorage() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isShuttingDown = true;
+    }
+    m_wakeTrigger.notify_all();
+    if (m_commitThread.joinable()) {
+        m_commitThread.join();
+    }
     close();
 }
 
 bool SQLiteMessageStorage::createDatabase() {
+    std::lock_guard<std::mutex> lock(m_mutex);
     if (!m_database.initialize()) {
         ACSDK_ERROR(LX("createDatabaseFailed"));
         return false;
     }
 
+    if (!configureJournalLocked()) {
+        ACSDK_ERROR(LX("createDatabaseFailed").m("Journal could not be configured."));
+        closeLocked();
+        return false;
+    }
+
     if (!m_database.performQuery(CREATE_MESSAGES_TABLE_SQL_STRING)) {
         ACSDK_ERROR(LX("createDatabaseFailed").m("Table could not be created."));
-        close();
+        closeLocked();
         return false;
     }
 
@@ -121,18 +190,25 @@ bool SQLiteMessageStorage::createDatabase() {
 }
 
 bool SQLiteMessageStorage::open() {
+    std::lock_guard<std::mutex> lock(m_mutex);
     if (!m_database.open()) {
         ACSDK_ERROR(LX("openFailed").d("reason", "Cannot open Certified Sender database"));
         return false;
     }
 
+    if (!configureJournalLocked()) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "Cannot configure the journal"));
+        closeLocked();
+        return false;
+    }
+
     // We need to check if the opened database contains the correct table.
     // If the table does not exist and we can create a new table,
     // the table is not legacy and it is a new table with new schema
     if (!m_database.tableExists(MESSAGES_TABLE_NAME)) {
         if (!m_database.performQuery(CREATE_MESSAGES_TABLE_SQL_STRING)) {
             ACSDK_ERROR(LX("openFailed").d("sqlStatement", CREATE_MESSAGES_TABLE_SQL_STRING));
-            close();
+            closeLocked();
             return false;
         }
 
@@ -143,7 +219,7 @@ bool SQLiteMessageStorage::open() {
         int database_status = isDatabaseLegacy();
         if (database_status == 1) {
             if (!dropTable() || !m_database.performQuery(CREATE_MESSAGES_TABLE_SQL_STRING)) {
-                close();
+                closeLocked();
                 ACSDK_ERROR(LX("openFailed").d("database_status", "Cannot drop and create new database"));
                 return false;
             }
@@ -170,7 +246,8 @@ bool SQLiteMessageStorage::open() {
 }
 
 void SQLiteMessageStorage::close() {
-    m_database.close();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    closeLocked();
 }
 
 bool SQLiteMessageStorage::store(const std::string& message, int* id) {
@@ -183,37 +260,47 @@ bool SQLiteMessageStorage::store(const std::string& message, const std::string&
         return false;
     }
 
-    std::string sqlString = std::string("INSERT INTO " + MESSAGES_TABLE_NAME + " (") + DATABASE_COLUMN_ID_NAME + ", " +
-                            DATABASE_COLUMN_URI + ", " + DATABASE_COLUMN_MESSAGE_TEXT_NAME + ") VALUES (?, ?, ?);";
-
-    int nextId = 0;
-    if (!getTableMaxIntValue(&m_database, MESSAGES_TABLE_NAME, DATABASE_COLUMN_ID_NAME, &nextId)) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_maxId < 0 && !getTableMaxIntValue(&m_database, MESSAGES_TABLE_NAME, DATABASE_COLUMN_ID_NAME, &m_maxId)) {
         ACSDK_ERROR(LX("storeFailed").m("Cannot generate message id."));
+        m_maxId = -1;
         return false;
     }
-    nextId++;
+    int nextId = m_maxId + 1;
 
     if (nextId <= 0) {
         ACSDK_ERROR(LX("storeFailed").m("Invalid computed row id.  Possible numerical overflow.").d("id", nextId));
         return false;
     }
 
-    auto statement = m_database.createStatement(sqlString);
-
-    if (!statement) {
-        ACSDK_ERROR(LX("storeFailed").m("Could not create statement."));
-        return false;
+    if (!m_insertStatement) {
+        m_insertStatement = m_database.createStatement(INSERT_MESSAGE_SQL_STRING);
+        if (!m_insertStatement) {
+            ACSDK_ERROR(LX("storeFailed").m("Could not create statement."));
+            return false;
+        }
     }
 
     int boundParam = 1;
-    if (!statement->bindIntParameter(boundParam++, nextId) ||
-        !statement->bindStringParameter(boundParam++, uriPathExtension) ||
-        !statement->bindStringParameter(boundParam, message)) {
+    if (!m_insertStatement->bindIntParameter(boundParam++, nextId) ||
+        !m_insertStatement->bindStringParameter(boundParam++, uriPathExtension) ||
+        !m_insertStatement->bindStringParameter(boundParam, message)) {
         ACSDK_ERROR(LX("storeFailed").m("Could not bind parameter."));
         return false;
     }
 
-    if (!statement->step()) {
+    if (!beginOperationLocked()) {
+        ACSDK_ERROR(LX("storeFailed").m("Could not begin transaction."));
+        return false;
+    }
+    bool stepped = m_insertStatement->step();
+    m_insertStatement->reset();
+    if (stepped) {
+        m_maxId = nextId;
+    }
+    endOperationLocked();
+
+    if (!stepped) {
         ACSDK_ERROR(LX("storeFailed").m("Could not perform step."));
         return false;
     }
@@ -231,6 +318,7 @@ bool SQLiteMessageStorage::load(std::queue<StoredMessage>* messageContainer) {
 
     std::string sqlString = "SELECT * FROM " + MESSAGES_TABLE_NAME + " ORDER BY id;";
 
+    std::lock_guard<std::mutex> lock(m_mutex);
     auto statement = m_database.createStatement(sqlString);
 
     if (!statement) {
@@ -275,22 +363,30 @@ bool SQLiteMessageStorage::load(std::queue<StoredMessage>* messageContainer) {
 }
 
 bool SQLiteMessageStorage::erase(int messageId) {
-    std::string sqlString = "DELETE FROM " + MESSAGES_TABLE_NAME + " WHERE id=?;";
-
-    auto statement = m_database.createStatement(sqlString);
-
-    if (!statement) {
-        ACSDK_ERROR(LX("eraseFailed").m("Could not create statement."));
-        return false;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_eraseStatement) {
+        m_eraseStatement = m_database.createStatement(ERASE_MESSAGE_SQL_STRING);
+        if (!m_eraseStatement) {
+            ACSDK_ERROR(LX("eraseFailed").m("Could not create statement."));
+            return false;
+        }
     }
 
     int boundParam = 1;
-    if (!statement->bindIntParameter(boundParam, messageId)) {
+    if (!m_eraseStatement->bindIntParameter(boundParam, messageId)) {
         ACSDK_ERROR(LX("eraseFailed").m("Could not bind messageId."));
         return false;
     }
 
-    if (!statement->step()) {
+    if (!beginOperationLocked()) {
+        ACSDK_ERROR(LX("eraseFailed").m("Could not begin transaction."));
+        return false;
+    }
+    bool stepped = m_eraseStatement->step();
+    m_eraseStatement->reset();
+    endOperationLocked();
+
+    if (!stepped) {
         ACSDK_ERROR(LX("eraseFailed").m("Could not perform step."));
         return false;
     }
@@ -299,7 +395,16 @@ bool SQLiteMessageStorage::erase(int messageId) {
 }
 
 bool SQLiteMessageStorage::clearDatabase() {
-    if (!m_database.clearTable(MESSAGES_TABLE_NAME)) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!beginOperationLocked()) {
+        ACSDK_ERROR(LX("clearDatabaseFailed").m("Could not begin transaction."));
+        return false;
+    }
+    bool cleared = m_database.clearTable(MESSAGES_TABLE_NAME);
+    m_maxId = -1;
+    endOperationLocked();
+
+    if (!cleared) {
         ACSDK_ERROR(LX("clearDatabaseFailed").m("could not clear messages table."));
         return false;
     }
@@ -307,6 +412,76 @@ bool SQLiteMessageStorage::clearDatabase() {
     return true;
 }
 
+bool SQLiteMessageStorage::flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return commitLocked();
+}
+
+void SQLiteMessageStorage::closeLocked() {
+    commitLocked();
+    m_insertStatement.reset();
+    m_eraseStatement.reset();
+    m_maxId = -1;
+    m_database.close();
+}
+
+bool SQLiteMessageStorage::configureJournalLocked() {
+    if (!m_groupCommit.isEnabled()) {
+        return true;
+    }
+    return m_database.performQuery(GROUP_COMMIT_JOURNAL_SQL_STRING);
+}
+
+bool SQLiteMessageStorage::beginOperationLocked() {
+    if (!m_groupCommit.isEnabled() || m_transaction) {
+        ++m_pendingOperations;
+        return true;
+    }
+    m_transaction = m_database.beginTransaction();
+    if (!m_transaction) {
+        return false;
+    }
+    m_pendingOperations = 1;
+    m_commitDeadline = std::chrono::steady_clock::now() + m_groupCommit.window;
+    m_wakeTrigger.notify_all();
+    return true;
+}
+
+void SQLiteMessageStorage::endOperationLocked() {
+    if (m_pendingOperations >= m_groupCommit.maxOperations) {
+        commitLocked();
+    }
+}
+
+bool SQLiteMessageStorage::commitLocked() {
+    auto pendingOperations = m_pendingOperations;
+    m_pendingOperations = 0;
+    if (!m_transaction) {
+        return true;
+    }
+    auto transaction = std::move(m_transaction);
+    if (!transaction->commit()) {
+        // The database rolls the failed transaction back, so its operations are lost.
+        ACSDK_ERROR(LX("commitFailed").d("lostOperations", pendingOperations));
+        m_maxId = -1;
+        return false;
+    }
+    return true;
+}
+
+void SQLiteMessageStorage::commitLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_isShuttingDown) {
+        if (!m_transaction) {
+            m_wakeTrigger.wait(lock);
+        } else if (std::chrono::steady_clock::now() >= m_commitDeadline) {
+            commitLocked();
+        } else {
+            m_wakeTrigger.wait_until(lock, m_commitDeadline);
+        }
+    }
+}
+
 int SQLiteMessageStorage::isDatabaseLegacy() {
     auto sqlStatement = m_database.createStatement("PRAGMA table_info(" + MESSAGES_TABLE_NAME + ");");
 
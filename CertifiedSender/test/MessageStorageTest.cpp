@@ -20,9 +20,17 @@
 #include <SQLiteStorage/SQLiteStatement.h>
 #include <AVSCommon/Utils/File/FileUtils.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <list>
 #include <queue>
 #include <memory>
+#include <sstream>
+#include <thread>
 
 using namespace ::testing;
 
@@ -31,6 +39,7 @@ namespace certifiedSender {
 namespace test {
 
 using namespace avsCommon::utils::file;
+using namespace avsCommon::utils::configuration;
 
 /// The filename we will use for the test database file.
 static const std::string TEST_DATABASE_FILE_PATH = "messageStorageTestDatabase.db";
@@ -44,6 +53,10 @@ static const std::string TEST_MESSAGE_ONE = "test_message_one";
 static const std::string TEST_MESSAGE_TWO = "test_message_two";
 /// A test message text.
 static const std::string TEST_MESSAGE_THREE = "test_message_three";
+/// Suffixes of the files which SQLite creates next to the database in write-ahead logging mode.
+static const std::vector<std::string> WAL_FILE_SUFFIXES = {"-wal", "-shm"};
+/// Timeout for operations which are expected to happen.
+static const std::chrono::seconds TIMEOUT{2};
 /// A test message uri.
 static const std::string TEST_MESSAGE_URI = "/v20160207/events/SpeechRecognizer/Recognize";
 /// The name of the alerts table.
@@ -163,6 +176,11 @@ void MessageStorageTest::cleanupLocalDbFile() {
     if (fileExists(g_dbTestFilePath)) {
         removeFile(g_dbTestFilePath.c_str());
     }
+    for (const auto& suffix : WAL_FILE_SUFFIXES) {
+        if (fileExists(g_dbTestFilePath + suffix)) {
+            removeFile((g_dbTestFilePath + suffix).c_str());
+        }
+    }
 }
 
 int MessageStorageTest::isDatabaseLegacy() {
@@ -243,6 +261,27 @@ bool MessageStorageTest::createOldMessages() {
 
     return true;
 }
+/**
+ * Utility function to count the committed messages, through a separate connection to the database.
+ *
+ * @return The number of committed messages, or -1 on error.
+ */
+static int countCommittedMessages() {
+    alexaClientSDK::storage::sqliteStorage::SQLiteDatabase database(g_dbTestFilePath);
+    if (!database.open()) {
+        return -1;
+    }
+    int count = -1;
+    {
+        auto statement = database.createStatement("SELECT COUNT(*) FROM " + MESSAGES_TABLE_NAME + ";");
+        if (statement && statement->step() && SQLITE_ROW == statement->getStepResult()) {
+            count = statement->getColumnInt(0);
+        }
+    }
+    database.close();
+    return count;
+}
+
 /**
  * Test basic construction.  Database should not be open.
  */
@@ -433,6 +472,286 @@ TEST_F(MessageStorageTest, test_EraseMessageOverAgeAndSizeLimit) {
     EXPECT_EQ(static_cast<int>(dbMessagesAfter.size()), 0);
 }
 
+/**
+ * Test that in group commit mode messages can be stored, loaded and erased, including before they are committed.
+ */
+TEST_F(MessageStorageTest, test_groupCommitStoreLoadAndErase) {
+    m_storage = std::make_shared<SQLiteMessageStorage>(
+        g_dbTestFilePath, SQLiteMessageStorage::GroupCommitSettings(10, std::chrono::seconds(10)));
+    createDatabase();
+
+    int id1 = 0;
+    int id2 = 0;
+    int id3 = 0;
+    EXPECT_TRUE(m_storage->store(TEST_MESSAGE_ONE, &id1));
+    EXPECT_TRUE(m_storage->store(TEST_MESSAGE_TWO, TEST_MESSAGE_URI, &id2));
+    EXPECT_TRUE(m_storage->store(TEST_MESSAGE_THREE, &id3));
+    EXPECT_EQ(id1, 1);
+    EXPECT_EQ(id2, 2);
+    EXPECT_EQ(id3, 3);
+    EXPECT_TRUE(m_storage->erase(id2));
+
+    std::queue<MessageStorageInterface::StoredMessage> messages;
+    EXPECT_TRUE(m_storage->load(&messages));
+    ASSERT_EQ(static_cast<int>(messages.size()), 2);
+    EXPECT_EQ(messages.front().id, id1);
+    EXPECT_EQ(messages.front().message, TEST_MESSAGE_ONE);
+    messages.pop();
+    EXPECT_EQ(messages.front().id, id3);
+    EXPECT_EQ(messages.front().message, TEST_MESSAGE_THREE);
+}
+
+/**
+ * Test that in group commit mode a transaction is committed once it holds the maximum number of operations, and that
+ * @c flush() commits the pending operations.
+ */
+TEST_F(MessageStorageTest, test_groupCommitCommitsWhenFull) {
+    auto storage = std::make_shared<SQLiteMessageStorage>(
+        g_dbTestFilePath, SQLiteMessageStorage::GroupCommitSettings(3, std::chrono::seconds(10)));
+    m_storage = storage;
+    createDatabase();
+
+    int id = 0;
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(m_storage->store(TEST_MESSAGE_ONE, &id));
+    }
+    EXPECT_EQ(countCommittedMessages(), 3);
+
+    EXPECT_TRUE(m_storage->store(TEST_MESSAGE_TWO, &id));
+    EXPECT_EQ(countCommittedMessages(), 3);
+    EXPECT_TRUE(storage->flush());
+    EXPECT_EQ(countCommittedMessages(), 4);
+}
+
+/// Whether the writes of the files opened through the @c FailingWritesVfs fail.
+static std::atomic<bool> g_failWrites{false};
+
+/// The VFS which the @c FailingWritesVfs wraps.
+static sqlite3_vfs* g_wrappedVfs = nullptr;
+
+/// I/O methods of the wrapped VFS, with @c failingWrite() as their write method.
+struct FailingIoMethods {
+    /// The I/O methods used by the files, which must remain the first member.
+    sqlite3_io_methods methods;
+
+    /// The I/O methods which @c methods wrap.
+    const sqlite3_io_methods* wrapped;
+};
+
+/// The @c FailingIoMethods for each of the I/O methods of the wrapped VFS, which differ between file types.
+static std::list<FailingIoMethods> g_failingIoMethods;
+
+/**
+ * Write method of the files opened through the @c FailingWritesVfs, which fails while @c g_failWrites is set.
+ */
+static int failingWrite(sqlite3_file* file, const void* data, int amount, sqlite3_int64 offset) {
+    if (g_failWrites) {
+        return SQLITE_IOERR_WRITE;
+    }
+    auto wrapped = reinterpret_cast<const FailingIoMethods*>(file->pMethods)->wrapped;
+    return wrapped->xWrite(file, data, amount, offset);
+}
+
+/**
+ * Open method of the @c FailingWritesVfs, which opens the file through the wrapped VFS and substitutes
+ * @c failingWrite() for its write method.
+ */
+static int failingWritesOpen(sqlite3_vfs*, const char* name, sqlite3_file* file, int flags, int* outFlags) {
+    auto result = g_wrappedVfs->xOpen(g_wrappedVfs, name, file, flags, outFlags);
+    if (SQLITE_OK != result || !file->pMethods) {
+        return result;
+    }
+    auto it = std::find_if(
+        g_failingIoMethods.begin(), g_failingIoMethods.end(), [file](const FailingIoMethods& failingIoMethods) {
+            return failingIoMethods.wrapped == file->pMethods;
+        });
+    if (g_failingIoMethods.end() == it) {
+        FailingIoMethods failingIoMethods{*file->pMethods, file->pMethods};
+        failingIoMethods.methods.xWrite = failingWrite;
+        it = g_failingIoMethods.insert(g_failingIoMethods.end(), failingIoMethods);
+    }
+    file->pMethods = &it->methods;
+    return result;
+}
+
+/**
+ * A VFS whose writes can be made to fail, which is the default VFS for as long as it exists.
+ */
+class FailingWritesVfs {
+public:
+    /// Constructor.
+    FailingWritesVfs() {
+        g_wrappedVfs = sqlite3_vfs_find(nullptr);
+        m_vfs = *g_wrappedVfs;
+        m_vfs.zName = "failingWrites";
+        m_vfs.pNext = nullptr;
+        m_vfs.xOpen = failingWritesOpen;
+        sqlite3_vfs_register(&m_vfs, 1);
+    }
+
+    /// Destructor.
+    ~FailingWritesVfs() {
+        g_failWrites = false;
+        sqlite3_vfs_unregister(&m_vfs);
+    }
+
+private:
+    /// The VFS.
+    sqlite3_vfs m_vfs;
+};
+
+/**
+ * Test that in group commit mode a transaction which fails to commit is rolled back, and that the following operations
+ * succeed.
+ */
+TEST_F(MessageStorageTest, test_groupCommitRecoversFromCommitFailure) {
+    FailingWritesVfs vfs;
+    auto storage = std::make_shared<SQLiteMessageStorage>(
+        g_dbTestFilePath, SQLiteMessageStorage::GroupCommitSettings(100, std::chrono::seconds(10)));
+    m_storage = storage;
+    createDatabase();
+
+    int id = 0;
+    EXPECT_TRUE(m_storage->store(TEST_MESSAGE_ONE, &id));
+    g_failWrites = true;
+    EXPECT_FALSE(storage->flush());
+    g_failWrites = false;
+    EXPECT_EQ(countCommittedMessages(), 0);
+
+    EXPECT_TRUE(m_storage->store(TEST_MESSAGE_TWO, &id));
+    EXPECT_TRUE(m_storage->erase(id));
+    EXPECT_TRUE(m_storage->store(TEST_MESSAGE_THREE, &id));
+    EXPECT_TRUE(storage->flush());
+    EXPECT_EQ(countCommittedMessages(), 1);
+
+    std::queue<MessageStorageInterface::StoredMessage> messages;
+    EXPECT_TRUE(m_storage->load(&messages));
+    ASSERT_EQ(messages.size(), 1u);
+    EXPECT_EQ(messages.front().message, TEST_MESSAGE_THREE);
+    m_storage->close();
+}
+
+/**
+ * Test that in group commit mode a transaction is committed once its window has elapsed.
+ */
+TEST_F(MessageStorageTest, testTimer_groupCommitCommitsAfterWindow) {
+    m_storage = std::make_shared<SQLiteMessageStorage>(
+        g_dbTestFilePath, SQLiteMessageStorage::GroupCommitSettings(100, std::chrono::milliseconds(50)));
+    createDatabase();
+
+    int id = 0;
+    EXPECT_TRUE(m_storage->store(TEST_MESSAGE_ONE, &id));
+    auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+    while (countCommittedMessages() != 1 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(countCommittedMessages(), 1);
+}
+
+/**
+ * Test that in group commit mode closing the database commits the pending operations.
+ */
+TEST_F(MessageStorageTest, test_groupCommitCloseCommitsPendingOperations) {
+    m_storage = std::make_shared<SQLiteMessageStorage>(
+        g_dbTestFilePath, SQLiteMessageStorage::GroupCommitSettings(100, std::chrono::seconds(10)));
+    createDatabase();
+
+    int id = 0;
+    EXPECT_TRUE(m_storage->store(TEST_MESSAGE_ONE, &id));
+    EXPECT_TRUE(m_storage->store(TEST_MESSAGE_TWO, &id));
+    EXPECT_TRUE(m_storage->erase(id));
+    m_storage->close();
+
+    EXPECT_TRUE(m_storage->open());
+    std::queue<MessageStorageInterface::StoredMessage> messages;
+    EXPECT_TRUE(m_storage->load(&messages));
+    ASSERT_EQ(static_cast<int>(messages.size()), 1);
+    EXPECT_EQ(messages.front().message, TEST_MESSAGE_ONE);
+}
+
+/**
+ * Test that the group commit settings are read from the configuration, and that invalid settings are rejected.
+ */
+TEST_F(MessageStorageTest, test_createWithGroupCommitConfiguration) {
+    auto createFromJson = [](const std::string& json) {
+        auto stream = std::make_shared<std::stringstream>(json);
+        ConfigurationNode::initialize({stream});
+        auto storage = SQLiteMessageStorage::create(ConfigurationNode::getRoot());
+        ConfigurationNode::uninitialize();
+        return storage;
+    };
+
+    auto storage = createFromJson(
+        R"({"certifiedSender":{"databaseFilePath":")" + g_dbTestFilePath +
+        R"(","groupCommit":{"maxOperations":2,"windowMs":10000}}})");
+    ASSERT_NE(storage, nullptr);
+    ASSERT_TRUE(storage->createDatabase());
+    int id = 0;
+    EXPECT_TRUE(storage->store(TEST_MESSAGE_ONE, &id));
+    EXPECT_EQ(countCommittedMessages(), 0);
+    EXPECT_TRUE(storage->store(TEST_MESSAGE_TWO, &id));
+    EXPECT_EQ(countCommittedMessages(), 2);
+    storage.reset();
+
+    EXPECT_EQ(
+        createFromJson(
+            R"({"certifiedSender":{"databaseFilePath":")" + g_dbTestFilePath +
+            R"(","groupCommit":{"maxOperations":-1}}})"),
+        nullptr);
+}
+
+/**
+ * Measure the throughput of storing and then erasing a burst of messages, with and without group commit.
+ */
+TEST_F(MessageStorageTest, testSlow_storeAndEraseThroughput) {
+    const int messageCount = 100;
+    const std::string message(1024, 'm');
+
+    auto measure = [&](const SQLiteMessageStorage::GroupCommitSettings& settings,
+                       double* storeRate,
+                       double* eraseRate) {
+        cleanupLocalDbFile();
+        SQLiteMessageStorage storage(g_dbTestFilePath, settings);
+        ASSERT_TRUE(storage.createDatabase());
+        std::vector<int> ids(messageCount);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < messageCount; ++i) {
+            ASSERT_TRUE(storage.store(message, TEST_MESSAGE_URI, &ids[i]));
+        }
+        ASSERT_TRUE(storage.flush());
+        std::chrono::duration<double> storeTime = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        for (int id : ids) {
+            ASSERT_TRUE(storage.erase(id));
+        }
+        ASSERT_TRUE(storage.flush());
+        std::chrono::duration<double> eraseTime = std::chrono::steady_clock::now() - start;
+
+        *storeRate = messageCount / storeTime.count();
+        *eraseRate = messageCount / eraseTime.count();
+        storage.close();
+    };
+
+    double defaultStoreRate = 0;
+    double defaultEraseRate = 0;
+    measure(SQLiteMessageStorage::GroupCommitSettings(), &defaultStoreRate, &defaultEraseRate);
+    double batchedStoreRate = 0;
+    double batchedEraseRate = 0;
+    measure(
+        SQLiteMessageStorage::GroupCommitSettings(32, std::chrono::milliseconds(200)),
+        &batchedStoreRate,
+        &batchedEraseRate);
+
+    std::cout << std::fixed << std::setprecision(0) << "  " << messageCount << " messages of " << message.size()
+              << " bytes:" << std::endl
+              << "    default:      " << std::setw(8) << defaultStoreRate << " stores/s " << std::setw(8)
+              << defaultEraseRate << " erases/s" << std::endl
+              << "    group commit: " << std::setw(8) << batchedStoreRate << " stores/s " << std::setw(8)
+              << batchedEraseRate << " erases/s" << std::endl;
+}
+
 }  // namespace test
 }  // namespace certifiedSender
 }  // namespace alexaClientSDK
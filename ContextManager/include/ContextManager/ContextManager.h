@@ -23,7 +23,9 @@
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+#include <AVSCommon/AVS/AVSContext.h>
 #include <AVSCommon/AVS/CapabilityTag.h>
 #include <AVSCommon/AVS/StateRefreshPolicy.h>
 #include <AVSCommon/SDKInterfaces/ContextManagerInterface.h>
@@ -42,6 +44,23 @@ namespace contextManager {
 /**
  * Class manages the requests for getting context from @c ContextRequesters and updating the state from
  * @c StateProviders.
+ *
+ * The state of each capability is serialized when it is updated. The states which belong in a context are selected
+ * on every request, and the context is only assembled from the serialized states when the selection or one of the
+ * selected states has changed. Requests which do not need to query any provider are answered without starting a
+ * timer.
+ *
+ * By default, providers are queried on every request as described by @c StateProviderInterface. If the configuration
+ * sets @c contextManager.reuseReportedStates to true, providers which report their state changes (that is, all but
+ * legacy providers with @c StateRefreshPolicy::ALWAYS) are only queried while no state is known for them:
+ *
+ * @code{.json}
+ * {
+ *     "contextManager": {
+ *         "reuseReportedStates": true
+ *     }
+ * }
+ * @endcode
  */
 class ContextManager : public avsCommon::sdkInterfaces::ContextManagerInterface {
 public:
@@ -145,6 +164,9 @@ private:  // Private type declarations.
         /// The refresh policy which is only used for legacy capabilities.
         avsCommon::avs::StateRefreshPolicy refreshPolicy;
 
+        /// The state serialized by @c AVSContext::buildStateJson(); empty if there is no state.
+        std::shared_ptr<const std::string> stateJson;
+
         /**
          * Constructor.
          *
@@ -181,12 +203,33 @@ private:  // Private type declarations.
     /// Alias for endpoint id.
     using EndpointIdentifier = avsCommon::sdkInterfaces::endpoints::EndpointIdentifier;
 
+    /// The states of an endpoint selected for its context.
+    using SelectedStates = std::vector<const CapabilitiesState::value_type*>;
+
+    /// The capabilities whose providers have to be queried, and the providers.
+    using StatesToQuery = std::vector<
+        std::pair<avsCommon::avs::CapabilityTag, std::shared_ptr<avsCommon::sdkInterfaces::StateProviderInterface>>>;
+
+    /**
+     * The context of an endpoint assembled from a selection of its last known states.
+     */
+    struct CachedContext {
+        /// The states the context was assembled from, in the order @c selectStatesLocked() selected them.
+        SelectedStates states;
+
+        /// The context assembled from @c states.
+        avsCommon::avs::AVSContext context;
+    };
+
+    /// Map of endpoints to their cached context.
+    using ContextCache = std::unordered_map<EndpointIdentifier, CachedContext>;
+
     /**
      * Structure used to save information about a request.
      */
     struct RequestTracker {
-        /// The token returned by the @c MultiTimer.
-        const avsCommon::utils::timing::MultiTimer::Token timerToken;
+        /// The token returned by the @c MultiTimer; empty if no provider had to be queried.
+        const avsCommon::utils::Optional<avsCommon::utils::timing::MultiTimer::Token> timerToken;
         /// The context requester.
         const std::shared_ptr<avsCommon::sdkInterfaces::ContextRequesterInterface> contextRequester;
         /// If Reportable Properties should be skipped for this request.
@@ -194,13 +237,13 @@ private:  // Private type declarations.
 
         /**
          * Constructor.
-         * @param timerToken The token returned by the @c MultiTimer.
+         * @param timerToken The token returned by the @c MultiTimer, if a timer was started.
          * @param contextRequester The @c ContextRequesterInterface pointer.
          * @param skipReportableProperties The boolean indicating if the reportable properties should be skipped for
          * this request.
          */
         RequestTracker(
-            avsCommon::utils::timing::MultiTimer::Token timerToken,
+            avsCommon::utils::Optional<avsCommon::utils::timing::MultiTimer::Token> timerToken,
             std::shared_ptr<avsCommon::sdkInterfaces::ContextRequesterInterface> contextRequester,
             bool skipReportableProperties);
     };
@@ -212,11 +255,14 @@ private:  // Private method declarations.
      * @param defaultEndpointId The default endpoint used for legacy methods where no endpoint id is provided.
      * @param multiTimer Object used to schedule request timeout.
      * @param metricRecorder The metric recorder.
+     * @param reuseReportedStates Whether providers which report their state changes are only queried while their
+     * state is unknown.
      */
     ContextManager(
         const std::string& defaultEndpointId,
         std::shared_ptr<avsCommon::utils::timing::MultiTimer> multiTimer,
-        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder);
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder,
+        bool reuseReportedStates);
     ///
 
     /**
@@ -294,6 +340,47 @@ private:  // Private method declarations.
         avsCommon::sdkInterfaces::ContextRequestToken requestToken,
         avsCommon::sdkInterfaces::ContextRequestError error);
 
+    /**
+     * Select the states of an endpoint which are part of its context, and the providers which have to be queried for
+     * them. The provider flags are evaluated on every call, as providers may change them at any time.
+     *
+     * @note @c m_endpointsStateMutex must be held by the caller.
+     *
+     * @param endpointId The endpoint id.
+     * @param skipReportableStateProperties Whether reportable state properties are left out of the context.
+     * @param[out] statesToAdd If not @c nullptr, the states which are part of the context are appended to it.
+     * @param[out] statesToQuery If not @c nullptr, the capabilities whose providers have to be queried are appended to
+     * it.
+     */
+    void selectStatesLocked(
+        const EndpointIdentifier& endpointId,
+        bool skipReportableStateProperties,
+        SelectedStates* statesToAdd,
+        StatesToQuery* statesToQuery);
+
+    /**
+     * Get the context of an endpoint built from the last known states. The serialized context is reused as long as the
+     * same states are selected for it and none of them has changed.
+     *
+     * @note @c m_endpointsStateMutex must be held by the caller.
+     *
+     * @param endpointId The endpoint id.
+     * @param skipReportableStateProperties Whether reportable state properties are left out of the context.
+     * @return The context.
+     */
+    avsCommon::avs::AVSContext getContextLocked(
+        const EndpointIdentifier& endpointId,
+        bool skipReportableStateProperties);
+
+    /**
+     * Discard the cached contexts of an endpoint.
+     *
+     * @note @c m_endpointsStateMutex must be held by the caller.
+     *
+     * @param endpointId The endpoint id.
+     */
+    void invalidateCachedContextLocked(const EndpointIdentifier& endpointId);
+
     /**
      * Generate a request token.
      *
@@ -309,6 +396,14 @@ private:  // Member variable declarations
     /// before accessing the map.
     std::unordered_map<EndpointIdentifier, CapabilitiesState> m_endpointsState;
 
+    /// Contexts assembled from @c m_endpointsState, including reportable state properties. @c m_endpointsStateMutex
+    /// must be acquired before accessing the map.
+    ContextCache m_contextCache;
+
+    /// Contexts assembled from @c m_endpointsState, without reportable state properties. @c m_endpointsStateMutex
+    /// must be acquired before accessing the map.
+    ContextCache m_contextCacheWithoutReportableStateProperties;
+
     /// Mutex used to guard the pending state requests. This is only needed because of @c setState.
     std::mutex m_requestsMutex;
 
@@ -336,10 +431,14 @@ private:  // Member variable declarations
     /// Endpoint identifier used to keep backward compatibility with capabilities without endpoint information.
     const std::string m_defaultEndpointId;
 
+    /// Whether providers which report their state changes are only queried while their state is unknown.
+    const bool m_reuseReportedStates;
+
     /// Timer to handler timeouts.
     std::shared_ptr<avsCommon::utils::timing::MultiTimer> m_multiTimer;
 
-    /// Executor used to handle the context requests.
+    /// Executor used to handle the context requests. Its tasks never block, as state providers and context requesters
+    /// are required to return quickly, so it may run on the shared scheduler.
     avsCommon::utils::threading::Executor m_executor;
 };
 
@@ -15,8 +15,10 @@
 
 #include <algorithm>
 
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/Error/FinallyGuard.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Threading/WorkStealingScheduler.h>
 #include "AVSCommon/Utils/Metrics/MetricEventBuilder.h"
 #include "AVSCommon/Utils/Metrics/DataPointCounterBuilder.h"
 
@@ -30,6 +32,7 @@ using namespace avsCommon;
 using namespace avsCommon::avs;
 using namespace avsCommon::sdkInterfaces;
 using namespace avsCommon::utils;
+using namespace avsCommon::utils::configuration;
 using namespace avsCommon::utils::metrics;
 
 /// String to identify log entries originating from this file.
@@ -47,6 +50,12 @@ static const ContextRequestToken EMPTY_TOKEN = 0;
 
 static const std::string STATE_PROVIDER_TIMEOUT_METRIC_PREFIX = "ERROR.StateProviderTimeout.";
 
+/// Key for the @c ContextManager configuration.
+static const std::string CONTEXT_MANAGER_CONFIGURATION_ROOT_KEY = "contextManager";
+
+/// Key for whether providers which report their state changes are only queried while their state is unknown.
+static const std::string REUSE_REPORTED_STATES_KEY = "reuseReportedStates";
+
 std::shared_ptr<ContextManagerInterface> ContextManager::createContextManagerInterface(
     const std::shared_ptr<DeviceInfo>& deviceInfo,
     const std::shared_ptr<avsCommon::utils::timing::MultiTimer>& multiTimer,
@@ -67,8 +76,12 @@ std::shared_ptr<ContextManager> ContextManager::create(
         return nullptr;
     }
 
+    bool reuseReportedStates = false;
+    ConfigurationNode::getRoot()[CONTEXT_MANAGER_CONFIGURATION_ROOT_KEY].getBool(
+        REUSE_REPORTED_STATES_KEY, &reuseReportedStates, false);
+
     std::shared_ptr<ContextManager> contextManager(
-        new ContextManager(deviceInfo.getDefaultEndpointId(), multiTimer, metricRecorder));
+        new ContextManager(deviceInfo.getDefaultEndpointId(), multiTimer, metricRecorder, reuseReportedStates));
     return contextManager;
 }
 
@@ -88,7 +101,7 @@ static void NoopCallback() {
 }
 
 ContextManager::RequestTracker::RequestTracker(
-    avsCommon::utils::timing::MultiTimer::Token timerToken,
+    Optional<avsCommon::utils::timing::MultiTimer::Token> timerToken,
     std::shared_ptr<ContextRequesterInterface> contextRequester,
     bool skipReportableProperties) :
         timerToken{timerToken},
@@ -119,6 +132,7 @@ void ContextManager::addStateProvider(
     auto& endpointId = capabilityIdentifier.endpointId.empty() ? m_defaultEndpointId : capabilityIdentifier.endpointId;
     auto& capabilitiesState = m_endpointsState[endpointId];
     capabilitiesState[capabilityIdentifier] = StateInfo(std::move(stateProvider), Optional<CapabilityState>());
+    invalidateCachedContextLocked(endpointId);
 }
 
 void ContextManager::removeStateProvider(const avs::CapabilityTag& capabilityIdentifier) {
@@ -127,6 +141,7 @@ void ContextManager::removeStateProvider(const avs::CapabilityTag& capabilityIde
     auto& endpointId = capabilityIdentifier.endpointId.empty() ? m_defaultEndpointId : capabilityIdentifier.endpointId;
     auto& capabilitiesState = m_endpointsState[endpointId];
     capabilitiesState.erase(capabilityIdentifier);
+    invalidateCachedContextLocked(endpointId);
 }
 
 SetStateResult ContextManager::setState(
@@ -198,12 +213,15 @@ SetStateResult ContextManager::setState(
 ContextManager::ContextManager(
     const std::string& defaultEndpointId,
     std::shared_ptr<avsCommon::utils::timing::MultiTimer> multiTimer,
-    std::shared_ptr<MetricRecorderInterface> metricRecorder) :
+    std::shared_ptr<MetricRecorderInterface> metricRecorder,
+    bool reuseReportedStates) :
         m_metricRecorder{std::move(metricRecorder)},
         m_requestCounter{0},
         m_shutdown{false},
         m_defaultEndpointId{defaultEndpointId},
-        m_multiTimer{multiTimer} {
+        m_reuseReportedStates{reuseReportedStates},
+        m_multiTimer{multiTimer},
+        m_executor{threading::WorkStealingScheduler::getConfiguredScheduler()} {
 }
 
 void ContextManager::reportStateChange(
@@ -292,9 +310,15 @@ void ContextManager::provideStateUnavailableResponse(
             }
 
             if (!isEndpointUnreachable) {
-                auto& endpointState = m_endpointsState[capabilityIdentifier.endpointId];
-                auto cachedState = endpointState.find(capabilityIdentifier);
-                if ((cachedState != endpointState.end()) && cachedState->second.capabilityState.hasValue()) {
+                bool hasCachedState = false;
+                {
+                    std::lock_guard<std::mutex> statesLock{m_endpointsStateMutex};
+                    auto& endpointState = m_endpointsState[capabilityIdentifier.endpointId];
+                    auto cachedState = endpointState.find(capabilityIdentifier);
+                    hasCachedState =
+                        (cachedState != endpointState.end()) && cachedState->second.capabilityState.hasValue();
+                }
+                if (hasCachedState) {
                     if (requestIt != m_pendingStateRequest.end()) {
                         requestIt->second.erase(capabilityIdentifier);
                     }
@@ -360,68 +384,41 @@ ContextRequestToken ContextManager::getContextInternal(
                      .d("skipReportableStateProperties", bSkipReportableStateProperties)
                      .sensitive("endpointId", endpointId));
 
-    auto timerToken = m_multiTimer->submitTask(timeout, [this, token] {
-        // Cancel request after timeout.
-        m_executor.execute([this, token] {
-            std::function<void()> contextFailureCallback = NoopCallback;
-            {
-                std::lock_guard<std::mutex> lock{m_requestsMutex};
-                contextFailureCallback =
-                    getContextFailureCallbackLocked(token, ContextRequestError::STATE_PROVIDER_TIMEDOUT);
-            }
-            contextFailureCallback();
-        });
-    });
-
-    m_executor.execute([this, contextRequester, endpointId, token, timerToken, bSkipReportableStateProperties] {
+    m_executor.execute([this, contextRequester, endpointId, token, timeout, bSkipReportableStateProperties] {
         std::function<void()> contextAvailableCallback = NoopCallback;
         {
             std::lock_guard<std::mutex> requestsLock{m_requestsMutex};
             auto& requestEndpointId = endpointId.empty() ? m_defaultEndpointId : endpointId;
-            m_pendingRequests.emplace(
-                token, RequestTracker(timerToken, contextRequester, bSkipReportableStateProperties));
+            Optional<timing::MultiTimer::Token> timerToken;
 
             {
                 std::lock_guard<std::mutex> statesLock{m_endpointsStateMutex};
-
-                auto endpointsStateIt = m_endpointsState.find(requestEndpointId);
-                if (m_endpointsState.end() == endpointsStateIt) {
-                    ACSDK_WARN(LX(__func__)
-                                   .d("reason", "requestEndpointIdNotFound")
-                                   .d("token", token)
-                                   .sensitive("endpointId", requestEndpointId));
-                } else {
-                    for (auto& capability : endpointsStateIt->second) {
-                        auto stateInfo = capability.second;
-                        auto stateProvider = capability.second.stateProvider;
-
-                        if (stateProvider) {
-                            bool requestState = false;
-                            if (stateInfo.legacyCapability && stateInfo.refreshPolicy != StateRefreshPolicy::NEVER) {
-                                requestState = true;
-                            } else if (
-                                !stateInfo.legacyCapability && stateProvider->canStateBeRetrieved() &&
-                                stateProvider->shouldQueryState()) {
-                                if (stateProvider->hasReportableStateProperties()) {
-                                    /// Check if the reportable state properties should be skipped.
-                                    if (!bSkipReportableStateProperties) {
-                                        requestState = true;
-                                    }
-                                } else {
-                                    requestState = true;
-                                }
+                StatesToQuery statesToQuery;
+                selectStatesLocked(requestEndpointId, bSkipReportableStateProperties, nullptr, &statesToQuery);
+                if (!statesToQuery.empty()) {
+                    timerToken = m_multiTimer->submitTask(timeout, [this, token] {
+                        // Cancel request after timeout.
+                        m_executor.execute([this, token] {
+                            std::function<void()> contextFailureCallback = NoopCallback;
+                            {
+                                std::lock_guard<std::mutex> lock{m_requestsMutex};
+                                contextFailureCallback = getContextFailureCallbackLocked(
+                                    token, ContextRequestError::STATE_PROVIDER_TIMEDOUT);
                             }
-
-                            if (requestState) {
-                                m_pendingStateRequest[token].emplace(capability.first);
-                                stateProvider->provideState(capability.first, token);
-                            }
-                        }
-                    }
+                            contextFailureCallback();
+                        });
+                    });
                 }
+                m_pendingRequests.emplace(
+                    token, RequestTracker(timerToken, contextRequester, bSkipReportableStateProperties));
 
-                contextAvailableCallback = getContextAvailableCallbackIfReadyLocked(token, requestEndpointId);
+                for (auto& stateToQuery : statesToQuery) {
+                    m_pendingStateRequest[token].emplace(stateToQuery.first);
+                    stateToQuery.second->provideState(stateToQuery.first, token);
+                }
             }
+
+            contextAvailableCallback = getContextAvailableCallbackIfReadyLocked(token, requestEndpointId);
         }
         /// Callback method should be called outside the lock.
         contextAvailableCallback();
@@ -438,7 +435,9 @@ std::function<void()> ContextManager::getContextFailureCallbackLocked(
     error::FinallyGuard clearRequestGuard{[this, requestToken] {
         auto requestIt = m_pendingRequests.find(requestToken);
         if (requestIt != m_pendingRequests.end()) {
-            m_multiTimer->cancelTask(requestIt->second.timerToken);
+            if (requestIt->second.timerToken.hasValue()) {
+                m_multiTimer->cancelTask(requestIt->second.timerToken.value());
+            }
             m_pendingRequests.erase(requestIt);
         }
         m_pendingStateRequest.erase(requestToken);
@@ -499,7 +498,9 @@ std::function<void()> ContextManager::getContextAvailableCallbackIfReadyLocked(
     error::FinallyGuard clearRequestGuard{[this, requestToken] {
         auto requestIt = m_pendingRequests.find(requestToken);
         if (requestIt != m_pendingRequests.end()) {
-            m_multiTimer->cancelTask(requestIt->second.timerToken);
+            if (requestIt->second.timerToken.hasValue()) {
+                m_multiTimer->cancelTask(requestIt->second.timerToken.value());
+            }
             m_pendingRequests.erase(requestIt);
         }
         m_pendingStateRequest.erase(requestToken);
@@ -519,40 +520,10 @@ std::function<void()> ContextManager::getContextAvailableCallbackIfReadyLocked(
     }
 
     AVSContext context;
-    auto& requestEndpointId = endpointId.empty() ? m_defaultEndpointId : endpointId;
-    auto endpointStateIt = m_endpointsState.find(requestEndpointId);
-    if (endpointStateIt != m_endpointsState.end()) {
-        for (auto& capability : endpointStateIt->second) {
-            auto stateProvider = capability.second.stateProvider;
-            auto stateInfo = capability.second;
-            bool addState = false;
-
-            if (stateInfo.legacyCapability) {
-                // Ignore if the state is not available for legacy SOMETIMES refresh policy.
-                if ((stateInfo.refreshPolicy == StateRefreshPolicy::SOMETIMES) &&
-                    !stateInfo.capabilityState.hasValue()) {
-                    ACSDK_DEBUG5(LX(__func__).d("skipping state for legacy capabilityIdentifier", capability.first));
-                } else {
-                    addState = true;
-                }
-            } else {
-                if (stateProvider && stateProvider->canStateBeRetrieved()) {
-                    /// Check if the reportable state properties should be skipped.
-                    if (stateProvider->hasReportableStateProperties()) {
-                        if (!request.skipReportableStateProperties) {
-                            addState = true;
-                        }
-                    } else {
-                        addState = true;
-                    }
-                }
-            }
-
-            if (addState) {
-                ACSDK_DEBUG5(LX(__func__).sensitive("addState", capability.first));
-                context.addState(capability.first, stateInfo.capabilityState.value());
-            }
-        }
+    {
+        std::lock_guard<std::mutex> statesLock{m_endpointsStateMutex};
+        auto& requestEndpointId = endpointId.empty() ? m_defaultEndpointId : endpointId;
+        context = getContextLocked(requestEndpointId, request.skipReportableStateProperties);
     }
 
     return [contextRequester, context, endpointId, requestToken]() {
@@ -563,18 +534,102 @@ std::function<void()> ContextManager::getContextAvailableCallbackIfReadyLocked(
     };
 }
 
+void ContextManager::selectStatesLocked(
+    const EndpointIdentifier& endpointId,
+    bool skipReportableStateProperties,
+    SelectedStates* statesToAdd,
+    StatesToQuery* statesToQuery) {
+    auto endpointsStateIt = m_endpointsState.find(endpointId);
+    if (m_endpointsState.end() == endpointsStateIt) {
+        ACSDK_WARN(LX(__func__).d("reason", "requestEndpointIdNotFound").sensitive("endpointId", endpointId));
+        return;
+    }
+
+    for (auto& capability : endpointsStateIt->second) {
+        auto& stateInfo = capability.second;
+        auto& stateProvider = stateInfo.stateProvider;
+        bool requestState = false;
+        bool addState = false;
+
+        if (stateInfo.legacyCapability) {
+            requestState = stateProvider && stateInfo.refreshPolicy != StateRefreshPolicy::NEVER;
+            if (requestState && m_reuseReportedStates && stateInfo.refreshPolicy == StateRefreshPolicy::SOMETIMES &&
+                stateInfo.capabilityState.hasValue()) {
+                requestState = false;
+            }
+            // Ignore if the state is not available for legacy SOMETIMES refresh policy.
+            if ((stateInfo.refreshPolicy == StateRefreshPolicy::SOMETIMES) && !stateInfo.capabilityState.hasValue()) {
+                ACSDK_DEBUG5(LX(__func__).d("skipping state for legacy capabilityIdentifier", capability.first));
+            } else {
+                addState = true;
+            }
+        } else if (stateProvider && stateProvider->canStateBeRetrieved()) {
+            /// Check if the reportable state properties should be skipped.
+            addState = !stateProvider->hasReportableStateProperties() || !skipReportableStateProperties;
+            requestState = addState && statesToQuery && stateProvider->shouldQueryState() &&
+                           !(m_reuseReportedStates && stateInfo.capabilityState.hasValue());
+        }
+
+        if (requestState && statesToQuery) {
+            statesToQuery->emplace_back(capability.first, stateProvider);
+        }
+        if (addState && statesToAdd) {
+            statesToAdd->push_back(&capability);
+        }
+    }
+}
+
+AVSContext ContextManager::getContextLocked(const EndpointIdentifier& endpointId, bool skipReportableStateProperties) {
+    SelectedStates selectedStates;
+    selectStatesLocked(endpointId, skipReportableStateProperties, &selectedStates, nullptr);
+
+    auto& cache = skipReportableStateProperties ? m_contextCacheWithoutReportableStateProperties : m_contextCache;
+    auto& cachedContext = cache[endpointId];
+    if (cachedContext.states == selectedStates) {
+        return cachedContext.context;
+    }
+
+    // Context properties are ordered by capability, and the capabilities are stored in a hash map.
+    std::map<CapabilityTag, const StateInfo*> statesToAdd;
+    for (auto selectedState : selectedStates) {
+        statesToAdd.emplace(selectedState->first, &selectedState->second);
+    }
+
+    AVSContext::States states;
+    std::vector<const std::string*> stateJsons;
+    stateJsons.reserve(statesToAdd.size());
+    for (auto& stateToAdd : statesToAdd) {
+        ACSDK_DEBUG5(LX(__func__).sensitive("addState", stateToAdd.first));
+        states.emplace_hint(states.end(), stateToAdd.first, stateToAdd.second->capabilityState.value());
+        if (stateToAdd.second->stateJson) {
+            stateJsons.push_back(stateToAdd.second->stateJson.get());
+        }
+    }
+    cachedContext.states = std::move(selectedStates);
+    cachedContext.context = AVSContext(std::move(states), AVSContext::buildJson(stateJsons));
+    return cachedContext.context;
+}
+
+void ContextManager::invalidateCachedContextLocked(const EndpointIdentifier& endpointId) {
+    m_contextCache.erase(endpointId);
+    m_contextCacheWithoutReportableStateProperties.erase(endpointId);
+}
+
 void ContextManager::updateCapabilityState(
     const avsCommon::avs::CapabilityTag& capabilityIdentifier,
     const avsCommon::avs::CapabilityState& capabilityState) {
     std::lock_guard<std::mutex> statesLock{m_endpointsStateMutex};
     auto& endpointId = capabilityIdentifier.endpointId.empty() ? m_defaultEndpointId : capabilityIdentifier.endpointId;
     auto& capabilitiesState = m_endpointsState[endpointId];
-    auto& stateProvider = capabilitiesState[capabilityIdentifier].stateProvider;
+    auto& stateInfo = capabilitiesState[capabilityIdentifier];
     ACSDK_INFO(LX(__func__)
                    .sensitive("endpointId", endpointId)
                    .sensitive("identifier", capabilityIdentifier)
                    .sensitive("state", capabilityState.valuePayload));
-    capabilitiesState[capabilityIdentifier] = StateInfo(stateProvider, capabilityState);
+    stateInfo = StateInfo(stateInfo.stateProvider, capabilityState);
+    stateInfo.stateJson =
+        std::make_shared<const std::string>(AVSContext::buildStateJson(capabilityIdentifier, capabilityState));
+    invalidateCachedContextLocked(endpointId);
     for (const auto& provider : m_endpointsState[endpointId]) {
         (void)provider;  // To avoid compiler warning in RELEASE builds where DEBUG log is compiled out
         ACSDK_DEBUG5(LX("updateCapabilityStateDetailed")
@@ -594,12 +649,17 @@ void ContextManager::updateCapabilityState(
     std::lock_guard<std::mutex> statesLock{m_endpointsStateMutex};
     auto& endpointId = capabilityIdentifier.endpointId.empty() ? m_defaultEndpointId : capabilityIdentifier.endpointId;
     auto& capabilityInfo = m_endpointsState[endpointId];
-    auto& stateProvider = capabilityInfo[capabilityIdentifier].stateProvider;
+    auto& stateInfo = capabilityInfo[capabilityIdentifier];
     ACSDK_INFO(LX(__func__)
                    .sensitive("endpointId", endpointId)
                    .sensitive("identifier", capabilityIdentifier)
                    .sensitive("state", jsonState));
-    capabilityInfo[capabilityIdentifier] = StateInfo(stateProvider, jsonState, refreshPolicy);
+    stateInfo = StateInfo(stateInfo.stateProvider, jsonState, refreshPolicy);
+    if (stateInfo.capabilityState.hasValue()) {
+        stateInfo.stateJson = std::make_shared<const std::string>(
+            AVSContext::buildStateJson(capabilityIdentifier, stateInfo.capabilityState.value()));
+    }
+    invalidateCachedContextLocked(endpointId);
     for (const auto& provider : m_endpointsState[endpointId]) {
         (void)provider;  // To avoid compiler warning in RELEASE builds where DEBUG log is compiled out
         ACSDK_DEBUG5(LX("updateCapabilityStateDetailed")
@@ -16,6 +16,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <sstream>
+
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/WaitEvent.h>
 
@@ -30,6 +34,7 @@ namespace test {
 using namespace avsCommon;
 using namespace avsCommon::avs;
 using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::utils::configuration;
 
 /// String to identify log entries originating from this file.
 #define TAG "ContextManagerTest"
@@ -73,6 +78,34 @@ struct MockContextObserver : public ContextManagerObserverInterface {
         void(const avs::CapabilityTag& identifier, const avs::CapabilityState& state, AlexaStateChangeCauseType cause));
 };
 
+/// Configuration which enables reuse of reported states.
+static const std::string REUSE_REPORTED_STATES_CONFIG = R"({"contextManager":{"reuseReportedStates":true}})";
+
+/**
+ * Request the context of the given endpoint and wait for it.
+ *
+ * @param contextManager The @c ContextManager to query.
+ * @param endpointId The endpoint whose context should be requested.
+ * @param[out] context The context that was returned.
+ * @return Whether the context was returned within the timeout.
+ */
+static bool getContextAndWait(
+    std::shared_ptr<ContextManagerInterface> contextManager,
+    const std::string& endpointId,
+    AVSContext* context) {
+    auto requester = std::make_shared<MockContextRequester>();
+    std::promise<AVSContext> contextPromise;
+    EXPECT_CALL(*requester, onContextAvailable(_, _, _))
+        .WillOnce(WithArg<1>(Invoke([&contextPromise](const AVSContext& ctx) { contextPromise.set_value(ctx); })));
+    contextManager->getContext(requester, endpointId);
+    auto contextFuture = contextPromise.get_future();
+    if (contextFuture.wait_for(std::chrono::seconds(1)) != std::future_status::ready) {
+        return false;
+    }
+    *context = contextFuture.get();
+    return true;
+}
+
 /// Context Manager Test
 class ContextManagerTest : public ::testing::Test {
 protected:
@@ -668,6 +701,159 @@ TEST_F(ContextManagerTest, test_getContextShouldReturnCache) {
     EXPECT_EQ(statesFuture.get()[capability].valuePayload, state.valuePayload);
 }
 
+/**
+ * Test that consecutive requests for an unchanged endpoint return the same serialized context, and that a state change
+ * is reflected in the next request.
+ */
+TEST_F(ContextManagerTest, test_getContextReusesSerializedContextUntilStateChanges) {
+    auto provider = std::make_shared<MockStateProvider>();
+    auto capability = CapabilityTag("Namespace", "Name", "EndpointId");
+    EXPECT_CALL(*provider, shouldQueryState()).WillRepeatedly(Return(false));
+    EXPECT_CALL(*provider, provideState(_, _)).Times(0);
+    m_contextManager->setStateProvider(capability, provider);
+    m_contextManager->reportStateChange(
+        capability, CapabilityState{R"({"state":"first"})"}, AlexaStateChangeCauseType::APP_INTERACTION);
+
+    AVSContext firstContext;
+    AVSContext secondContext;
+    ASSERT_TRUE(getContextAndWait(m_contextManager, capability.endpointId, &firstContext));
+    ASSERT_TRUE(getContextAndWait(m_contextManager, capability.endpointId, &secondContext));
+    EXPECT_EQ(firstContext.toJson(), secondContext.toJson());
+    EXPECT_NE(firstContext.toJson().find(R"({"state":"first"})"), std::string::npos);
+
+    m_contextManager->reportStateChange(
+        capability, CapabilityState{R"({"state":"second"})"}, AlexaStateChangeCauseType::APP_INTERACTION);
+
+    AVSContext updatedContext;
+    ASSERT_TRUE(getContextAndWait(m_contextManager, capability.endpointId, &updatedContext));
+    EXPECT_EQ(updatedContext.getStates()[capability].valuePayload, R"({"state":"second"})");
+    EXPECT_NE(updatedContext.toJson().find(R"({"state":"second"})"), std::string::npos);
+    EXPECT_EQ(firstContext.getStates()[capability].valuePayload, R"({"state":"first"})");
+}
+
+/**
+ * Test that a provider which starts requiring a query is queried even though its state has not changed since the
+ * previous context was built.
+ */
+TEST_F(ContextManagerTest, test_getContextQueriesProviderAfterShouldQueryStateChanges) {
+    auto provider = std::make_shared<MockStateProvider>();
+    auto capability = CapabilityTag("Namespace", "Name", "EndpointId");
+    CapabilityState queriedState{R"({"state":"queried"})"};
+    std::atomic<bool> shouldQuery{false};
+    EXPECT_CALL(*provider, shouldQueryState()).WillRepeatedly(Invoke([&shouldQuery] { return shouldQuery.load(); }));
+    EXPECT_CALL(*provider, provideState(_, _))
+        .WillOnce(WithArg<1>(Invoke([&](const ContextRequestToken token) {
+            m_contextManager->provideStateResponse(capability, queriedState, token);
+        })));
+    m_contextManager->setStateProvider(capability, provider);
+    m_contextManager->reportStateChange(
+        capability, CapabilityState{R"({"state":"reported"})"}, AlexaStateChangeCauseType::APP_INTERACTION);
+
+    AVSContext context;
+    ASSERT_TRUE(getContextAndWait(m_contextManager, capability.endpointId, &context));
+    EXPECT_EQ(context.getStates()[capability].valuePayload, R"({"state":"reported"})");
+
+    shouldQuery = true;
+    ASSERT_TRUE(getContextAndWait(m_contextManager, capability.endpointId, &context));
+    EXPECT_EQ(context.getStates()[capability].valuePayload, queriedState.valuePayload);
+}
+
+/**
+ * Test that a provider which starts reporting reportable state properties is left out of the next context requested
+ * without them, even though its state has not changed.
+ */
+TEST_F(ContextManagerTest, test_getContextWithoutReportableStatePropertiesAfterProviderChanges) {
+    auto provider = std::make_shared<MockStateProvider>();
+    auto capability = CapabilityTag("Namespace", "Name", "EndpointId");
+    std::atomic<bool> hasReportableStateProperties{false};
+    EXPECT_CALL(*provider, shouldQueryState()).WillRepeatedly(Return(false));
+    EXPECT_CALL(*provider, hasReportableStateProperties())
+        .WillRepeatedly(Invoke([&hasReportableStateProperties] { return hasReportableStateProperties.load(); }));
+    m_contextManager->setStateProvider(capability, provider);
+    m_contextManager->reportStateChange(
+        capability, CapabilityState{R"({"state":"reported"})"}, AlexaStateChangeCauseType::APP_INTERACTION);
+
+    auto getContextWithoutReportableStateProperties = [this](AVSContext* context) {
+        auto requester = std::make_shared<MockContextRequester>();
+        std::promise<AVSContext> contextPromise;
+        EXPECT_CALL(*requester, onContextAvailable(_, _, _))
+            .WillOnce(WithArg<1>(Invoke([&contextPromise](const AVSContext& ctx) { contextPromise.set_value(ctx); })));
+        m_contextManager->getContextWithoutReportableStateProperties(requester, "EndpointId");
+        auto contextFuture = contextPromise.get_future();
+        if (contextFuture.wait_for(std::chrono::seconds(1)) != std::future_status::ready) {
+            return false;
+        }
+        *context = contextFuture.get();
+        return true;
+    };
+
+    AVSContext context;
+    ASSERT_TRUE(getContextWithoutReportableStateProperties(&context));
+    EXPECT_EQ(context.getStates().size(), 1u);
+
+    hasReportableStateProperties = true;
+    ASSERT_TRUE(getContextWithoutReportableStateProperties(&context));
+    EXPECT_TRUE(context.getStates().empty());
+}
+
+/**
+ * Test that removing a state provider removes its state from the next context.
+ */
+TEST_F(ContextManagerTest, test_removeStateProviderUpdatesCachedContext) {
+    auto provider = std::make_shared<MockStateProvider>();
+    auto capability = CapabilityTag("Namespace", "Name", "EndpointId");
+    EXPECT_CALL(*provider, shouldQueryState()).WillRepeatedly(Return(false));
+    m_contextManager->setStateProvider(capability, provider);
+    m_contextManager->reportStateChange(
+        capability, CapabilityState{R"({"state":"value"})"}, AlexaStateChangeCauseType::APP_INTERACTION);
+
+    AVSContext context;
+    ASSERT_TRUE(getContextAndWait(m_contextManager, capability.endpointId, &context));
+    EXPECT_EQ(context.getStates().size(), 1u);
+
+    m_contextManager->removeStateProvider(capability);
+    ASSERT_TRUE(getContextAndWait(m_contextManager, capability.endpointId, &context));
+    EXPECT_TRUE(context.getStates().empty());
+}
+
+/**
+ * Test that when @c reuseReportedStates is enabled, providers whose state has already been reported are not queried,
+ * while providers without a reported state still are.
+ */
+TEST_F(ContextManagerTest, test_reuseReportedStatesSkipsQueryForReportedState) {
+    auto json = std::make_shared<std::stringstream>(REUSE_REPORTED_STATES_CONFIG);
+    ASSERT_TRUE(ConfigurationNode::initialize({json}));
+    auto deviceInfo = avsCommon::utils::DeviceInfo::create(
+        "clientId", "productId", "1234", "manufacturer", "my device", "friendlyName", "deviceType");
+    auto contextManager = ContextManager::createContextManagerInterface(std::move(deviceInfo));
+    ConfigurationNode::uninitialize();
+    ASSERT_NE(contextManager, nullptr);
+
+    auto reportedProvider = std::make_shared<MockStateProvider>();
+    auto reportedCapability = CapabilityTag("Namespace", "Reported", "EndpointId");
+    CapabilityState reportedState{R"({"state":"reported"})"};
+    EXPECT_CALL(*reportedProvider, shouldQueryState()).WillRepeatedly(Return(true));
+    EXPECT_CALL(*reportedProvider, provideState(_, _)).Times(0);
+    contextManager->setStateProvider(reportedCapability, reportedProvider);
+    contextManager->reportStateChange(reportedCapability, reportedState, AlexaStateChangeCauseType::APP_INTERACTION);
+
+    auto queriedProvider = std::make_shared<MockStateProvider>();
+    auto queriedCapability = CapabilityTag("Namespace", "Queried", "EndpointId");
+    CapabilityState queriedState{R"({"state":"queried"})"};
+    EXPECT_CALL(*queriedProvider, shouldQueryState()).WillRepeatedly(Return(true));
+    EXPECT_CALL(*queriedProvider, provideState(_, _))
+        .WillOnce(WithArg<1>(Invoke([&](const ContextRequestToken token) {
+            contextManager->provideStateResponse(queriedCapability, queriedState, token);
+        })));
+    contextManager->setStateProvider(queriedCapability, queriedProvider);
+
+    AVSContext context;
+    ASSERT_TRUE(getContextAndWait(contextManager, reportedCapability.endpointId, &context));
+    auto states = context.getStates();
+    EXPECT_EQ(states[reportedCapability].valuePayload, reportedState.valuePayload);
+    EXPECT_EQ(states[queriedCapability].valuePayload, queriedState.valuePayload);
+}
+
 }  // namespace test
 }  // namespace contextManager
 }  // namespace alexaClientSDK
@@ -16,6 +16,7 @@
 #ifndef ALEXA_CLIENT_SDK_DIAGNOSTICS_INCLUDE_DIAGNOSTICS_AUDIOINJECTORMICROPHONE_H_
 #define ALEXA_CLIENT_SDK_DIAGNOSTICS_INCLUDE_DIAGNOSTICS_AUDIOINJECTORMICROPHONE_H_
 
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -33,6 +34,17 @@ namespace diagnostics {
 /// This represents a microphone which injects audio data into the shared data stream.
 class AudioInjectorMicrophone : public applicationUtilities::resources::audio::MicrophoneInterface {
 public:
+    /// The speed for @c setInjectionSpeed() at which injected audio is written as fast as the stream is read.
+    static constexpr double AS_FAST_AS_POSSIBLE = 0.0;
+
+    /**
+     * Observer of the progress of an audio injection, called after every write of injected audio with the number of
+     * samples of the injection written so far and the index of the stream which follows the last sample written.
+     * It is called with the lock of the microphone held, and must not call back into the microphone.
+     */
+    using InjectionObserver =
+        std::function<void(size_t samplesInjected, avsCommon::avs::AudioInputStream::Index nextIndex)>;
+
     /**
      * Creates a @c AudioInjectorMicrophone.
      *
@@ -59,6 +71,26 @@ public:
      */
     void injectAudio(const std::vector<uint16_t>& audioData);
 
+    /**
+     * Injects audio into the audio buffer at the next possible moment, and reports the progress of the injection.
+     *
+     * @param audioData The reference to the audioBuffer vector.
+     * @param observer The observer of the progress of this injection, which may be @c nullptr.
+     */
+    void injectAudio(const std::vector<uint16_t>& audioData, InjectionObserver observer);
+
+    /**
+     * Sets the speed at which audio is written to the stream, relative to real time, which takes effect the next
+     * time the microphone starts streaming. Speeds above one are only reached as long as the readers of the stream
+     * keep up, and are capped at fifty times real time. At @c AS_FAST_AS_POSSIBLE, injected audio is written as
+     * fast as the slowest reader consumes it, while silence is still written in real time so that the readers are
+     * not flooded while idle.
+     *
+     * @param speed The speed, one by default and no lower than a hundredth, or @c AS_FAST_AS_POSSIBLE.
+     * @return Whether the speed is valid.
+     */
+    bool setInjectionSpeed(double speed);
+
     /**
      * Destructor.
      */
@@ -95,10 +127,18 @@ private:
      */
     void write();
 
+    /**
+     * Writes the next part of the audio injection to the shared stream. The lock is released during the write.
+     *
+     * @param lock The lock of @c m_mutex, which must be held.
+     * @return Whether audio was written and some is left to inject.
+     */
+    bool writeInjectionData(std::unique_lock<std::mutex>& lock);
+
     /// The stream of audio data.
     const std::shared_ptr<avsCommon::avs::AudioInputStream> m_audioInputStream;
 
-    /// A lock to serialize access to the writer between different threads.
+    /// A lock to serialize access to the members between different threads. It is not held while writing.
     std::mutex m_mutex;
 
     /// The writer that will be used to write audio data into the sds.
@@ -113,6 +153,12 @@ private:
     /// Maximum of samples per timeout period.
     unsigned int m_maxSampleCountPerTimeout;
 
+    /// The speed at which audio is written to the stream, relative to real time.
+    double m_injectionSpeed;
+
+    /// The number of samples of silence written per period of @c m_timer.
+    unsigned int m_silenceSampleCountPerWrite;
+
     /// The audio buffer of silence (0's).
     alexaClientSDK::avsCommon::avs::AudioInputStream::Buffer m_silenceBuffer;
 
@@ -121,6 +167,15 @@ private:
 
     /// Counter for how much of current audio injection data has been injected so far.
     unsigned long m_injectionDataCounter;
+
+    /// Identifies the current audio injection, and changes whenever it is replaced or reset.
+    unsigned long m_injectionId;
+
+    /// The part of the audio injection being written, which is only accessed by the thread of @c m_timer.
+    std::vector<uint16_t> m_injectionWriteBuffer;
+
+    /// The observer of the progress of the current audio injection.
+    InjectionObserver m_injectionObserver;
 };
 
 }  // namespace diagnostics
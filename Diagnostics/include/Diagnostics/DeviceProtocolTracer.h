@@ -22,6 +22,8 @@
 
 #include <AVSCommon/SDKInterfaces/Diagnostics/ProtocolTracerInterface.h>
 
+#include "Diagnostics/ProtocolCaptureFile.h"
+
 namespace alexaClientSDK {
 namespace diagnostics {
 
@@ -33,9 +35,18 @@ public:
     /**
      * Creates a new instance of @c DeviceProtocolTracer.
      *
+     * @param captureFile Optional file to which every directive and event is also appended. Unlike the traced
+     * messages, the capture is not limited by the max number of messages nor by the protocol trace flag.
      * @return a new @c DeviceProtocolTracer.
      */
-    static std::shared_ptr<DeviceProtocolTracer> create();
+    static std::shared_ptr<DeviceProtocolTracer> create(std::shared_ptr<ProtocolCaptureFile> captureFile = nullptr);
+
+    /**
+     * Set the file to which every directive and event is also appended, replacing the one given to @c create().
+     *
+     * @param captureFile The capture file, or @c nullptr to stop capturing.
+     */
+    void setCaptureFile(std::shared_ptr<ProtocolCaptureFile> captureFile);
 
     /// @name ProtocolTracerInterface Functions
     /// @{
@@ -61,8 +72,9 @@ private:
      * Constructor.
      *
      * @param maxMessages Maximum number of messages.
+     * @param captureFile Optional file to which every directive and event is also appended.
      */
-    DeviceProtocolTracer(unsigned int maxMessages);
+    DeviceProtocolTracer(unsigned int maxMessages, std::shared_ptr<ProtocolCaptureFile> captureFile);
 
     /**
      * Clears the traced messages.
@@ -87,6 +99,9 @@ private:
 
     /// The traced messages.
     std::vector<std::string> m_tracedMessages;
+
+    /// The capture file, which is accessed atomically rather than under @c m_mutex.
+    std::shared_ptr<ProtocolCaptureFile> m_captureFile;
 };
 
 }  // namespace diagnostics
@@ -0,0 +1,148 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_DIAGNOSTICS_INCLUDE_DIAGNOSTICS_PROTOCOLCAPTUREFILE_H_
+#define ALEXA_CLIENT_SDK_DIAGNOSTICS_INCLUDE_DIAGNOSTICS_PROTOCOLCAPTUREFILE_H_
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace diagnostics {
+
+/**
+ * A fixed size ring of timestamped protocol records kept in a memory mapped file.
+ *
+ * Records are appended without locking: writers reserve space with an atomic compare and swap on the write offset
+ * stored in the file, and mark a record complete once its content and checksum are written. When the ring is full,
+ * the oldest records are overwritten. Since the file is mapped shared, everything appended before a crash of the
+ * process can still be read from the file afterwards; a record torn by the crash fails its checksum and is skipped.
+ */
+class ProtocolCaptureFile {
+public:
+    /// The kinds of records.
+    enum class RecordType : uint8_t {
+        /// A directive received from AVS.
+        DIRECTIVE = 1,
+        /// An event sent to AVS.
+        EVENT = 2
+    };
+
+    /// A record read back from a capture file.
+    struct Record {
+        /// The kind of record.
+        RecordType type;
+
+        /// The order in which the record was appended.
+        uint64_t sequence;
+
+        /// The time the record was appended, relative to the creation of the capture.
+        std::chrono::nanoseconds timestamp;
+
+        /// The context id of a directive.
+        std::string contextId;
+
+        /// The content of a directive or an event.
+        std::string content;
+    };
+
+    /// The content of a capture file.
+    struct Capture {
+        /// The wall clock time the capture was created.
+        std::chrono::system_clock::time_point startTime;
+
+        /// The number of records which were too large to be captured.
+        uint64_t droppedRecords;
+
+        /// The records still held in the ring, oldest first.
+        std::vector<Record> records;
+    };
+
+    /// The default size of the ring.
+    static const size_t DEFAULT_CAPACITY_BYTES;
+
+    /**
+     * Create a new capture file. An existing file at @c path is renamed with a ".1" suffix first, so the capture of
+     * a crashed run is not lost when the next run starts.
+     *
+     * @param path The path of the capture file.
+     * @param capacityBytes The size of the ring, which is rounded down to a multiple of 8 bytes.
+     * @return The capture file, or @c nullptr if it could not be created.
+     */
+    static std::shared_ptr<ProtocolCaptureFile> create(
+        const std::string& path,
+        size_t capacityBytes = DEFAULT_CAPACITY_BYTES);
+
+    /**
+     * Read a capture file.
+     *
+     * @param path The path of the capture file.
+     * @param[out] capture The content of the capture file.
+     * @return Whether the file is a valid capture file.
+     */
+    static bool read(const std::string& path, Capture* capture);
+
+    /**
+     * Destructor. Flushes and unmaps the file.
+     */
+    ~ProtocolCaptureFile();
+
+    /**
+     * Append a record. This is safe to call from multiple threads and does not block.
+     *
+     * @param type The kind of record.
+     * @param contextId The context id of a directive.
+     * @param content The content of a directive or an event.
+     * @return Whether the record was appended. Records larger than half the ring are dropped.
+     */
+    bool append(RecordType type, const std::string& contextId, const std::string& content);
+
+    /**
+     * Get the size of the ring.
+     *
+     * @return The size of the ring in bytes.
+     */
+    size_t getCapacity() const;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param fd The file descriptor of the capture file.
+     * @param mapping The mapping of the capture file.
+     * @param mappingSize The size of the mapping.
+     */
+    ProtocolCaptureFile(int fd, void* mapping, size_t mappingSize);
+
+    /// The file descriptor of the capture file.
+    const int m_fd;
+
+    /// The mapping of the capture file.
+    void* const m_mapping;
+
+    /// The size of the mapping.
+    const size_t m_mappingSize;
+
+    /// The steady clock time of the creation of the capture.
+    const std::chrono::steady_clock::time_point m_startTime;
+};
+
+}  // namespace diagnostics
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_DIAGNOSTICS_INCLUDE_DIAGNOSTICS_PROTOCOLCAPTUREFILE_H_
@@ -0,0 +1,93 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_DIAGNOSTICS_INCLUDE_DIAGNOSTICS_PROTOCOLCAPTUREREPLAYER_H_
+#define ALEXA_CLIENT_SDK_DIAGNOSTICS_INCLUDE_DIAGNOSTICS_PROTOCOLCAPTUREREPLAYER_H_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include <AVSCommon/SDKInterfaces/MessageObserverInterface.h>
+
+#include "Diagnostics/ProtocolCaptureFile.h"
+
+namespace alexaClientSDK {
+namespace diagnostics {
+
+/**
+ * Feeds the directives of a @c ProtocolCaptureFile back into a @c MessageObserverInterface, typically the
+ * @c MessageInterpreter, keeping the timing of the capture or a multiple of it. Attachments are not captured, so
+ * directives which read an attachment are replayed without its content.
+ */
+class ProtocolCaptureReplayer {
+public:
+    /// What a replay did.
+    struct Result {
+        /// The number of directives passed to the observer.
+        size_t directives = 0;
+
+        /// The number of events in the capture, which are not replayed.
+        size_t events = 0;
+
+        /// The longest time a directive was passed to the observer after it was due.
+        std::chrono::nanoseconds maxLateness{0};
+
+        /// Whether the replay was stopped before its end.
+        bool stopped = false;
+    };
+
+    /**
+     * Create a @c ProtocolCaptureReplayer.
+     *
+     * @param observer The observer to pass the directives to.
+     * @return The replayer, or @c nullptr if @c observer is @c nullptr.
+     */
+    static std::unique_ptr<ProtocolCaptureReplayer> create(
+        std::shared_ptr<avsCommon::sdkInterfaces::MessageObserverInterface> observer);
+
+    /**
+     * Replay a capture. This blocks until the last record is replayed or @c stop() is called.
+     *
+     * @param capture The capture to replay.
+     * @param speed How many times faster than recorded to replay. Zero replays as fast as possible.
+     * @return What the replay did.
+     */
+    Result replay(const ProtocolCaptureFile::Capture& capture, double speed = 1.0);
+
+    /**
+     * Stop a replay in progress. This may be called from any thread.
+     */
+    void stop();
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param observer The observer to pass the directives to.
+     */
+    ProtocolCaptureReplayer(std::shared_ptr<avsCommon::sdkInterfaces::MessageObserverInterface> observer);
+
+    /// The observer to pass the directives to.
+    std::shared_ptr<avsCommon::sdkInterfaces::MessageObserverInterface> m_observer;
+
+    /// Flag which indicates that @c stop() was called.
+    std::atomic<bool> m_stopRequested;
+};
+
+}  // namespace diagnostics
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_DIAGNOSTICS_INCLUDE_DIAGNOSTICS_PROTOCOLCAPTUREREPLAYER_H_
@@ -15,6 +15,8 @@
 
 #include "Diagnostics/AudioInjectorMicrophone.h"
 
+#include <algorithm>
+
 #include <AVSCommon/Utils/Logger/Logger.h>
 
 namespace alexaClientSDK {
@@ -29,6 +31,12 @@ using namespace avsCommon::utils::timing;
 /// The timeout to use for writing to the SharedDataStream.
 static const std::chrono::milliseconds TIMEOUT_FOR_WRITING{500};
 
+/// The shortest period at which the stream is written to.
+static const std::chrono::milliseconds MIN_WRITE_PERIOD{10};
+
+/// The slowest speed at which audio can be written, relative to real time.
+static constexpr double MIN_INJECTION_SPEED = 0.01;
+
 /// Milliseconds per second.
 static constexpr unsigned int MILLISECONDS_PER_SECOND = 1000;
 
@@ -49,6 +57,8 @@ static inline unsigned int calculateMaxSampleCountPerTimeout(unsigned int sample
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+constexpr double AudioInjectorMicrophone::AS_FAST_AS_POSSIBLE;
+
 std::unique_ptr<AudioInjectorMicrophone> AudioInjectorMicrophone::create(
     const std::shared_ptr<AudioInputStream>& stream,
     const alexaClientSDK::avsCommon::utils::AudioFormat& compatibleAudioFormat) {
@@ -71,8 +81,11 @@ AudioInjectorMicrophone::AudioInjectorMicrophone(
         m_audioInputStream{std::move(stream)},
         m_isStreaming{false},
         m_maxSampleCountPerTimeout{calculateMaxSampleCountPerTimeout(compatibleAudioFormat.sampleRateHz)},
+        m_injectionSpeed{1.0},
+        m_silenceSampleCountPerWrite{m_maxSampleCountPerTimeout},
         m_injectionData{std::vector<uint16_t>()},
-        m_injectionDataCounter{0} {
+        m_injectionDataCounter{0},
+        m_injectionId{0} {
     /// Fill silence buffer with 0's for writing to shared stream.
     m_silenceBuffer = alexaClientSDK::avsCommon::avs::AudioInputStream::Buffer(m_maxSampleCountPerTimeout);
     std::fill(m_silenceBuffer.begin(), m_silenceBuffer.end(), 0);
@@ -109,9 +122,21 @@ bool AudioInjectorMicrophone::startStreamingMicrophoneData() {
 void AudioInjectorMicrophone::startTimer() {
     ACSDK_DEBUG5(LX(__func__));
     if (!m_timer.isActive()) {
+        auto writePeriod = TIMEOUT_FOR_WRITING;
+        if (AS_FAST_AS_POSSIBLE == m_injectionSpeed) {
+            // Keep writing silence in real time, in smaller writes so that injections start without delay.
+            writePeriod = MIN_WRITE_PERIOD;
+            m_silenceSampleCountPerWrite = static_cast<unsigned int>(
+                m_maxSampleCountPerTimeout * MIN_WRITE_PERIOD.count() / TIMEOUT_FOR_WRITING.count());
+        } else {
+            writePeriod = std::max(
+                MIN_WRITE_PERIOD,
+                std::chrono::milliseconds(static_cast<long>(TIMEOUT_FOR_WRITING.count() / m_injectionSpeed)));
+            m_silenceSampleCountPerWrite = m_maxSampleCountPerTimeout;
+        }
         m_timer.start(
             std::chrono::milliseconds(0),
-            TIMEOUT_FOR_WRITING,
+            writePeriod,
             Timer::PeriodType::RELATIVE,
             Timer::getForever(),
             std::bind(&AudioInjectorMicrophone::write, this));
@@ -128,19 +153,39 @@ bool AudioInjectorMicrophone::stopStreamingMicrophoneData() {
 }
 
 void AudioInjectorMicrophone::injectAudio(const std::vector<uint16_t>& audioData) {
+    injectAudio(audioData, nullptr);
+}
+
+void AudioInjectorMicrophone::injectAudio(const std::vector<uint16_t>& audioData, InjectionObserver observer) {
     ACSDK_DEBUG5(LX(__func__));
     std::lock_guard<std::mutex> lock(m_mutex);
     m_injectionData = audioData;
     m_injectionDataCounter = 0;
+    m_injectionObserver = std::move(observer);
+    ++m_injectionId;
 }
 
-void AudioInjectorMicrophone::write() {
+bool AudioInjectorMicrophone::setInjectionSpeed(double speed) {
+    ACSDK_DEBUG5(LX(__func__).d("speed", speed));
+    if (AS_FAST_AS_POSSIBLE != speed && !(speed >= MIN_INJECTION_SPEED)) {
+        ACSDK_ERROR(LX("setInjectionSpeedFailed").d("reason", "invalidSpeed").d("speed", speed));
+        return false;
+    }
     std::lock_guard<std::mutex> lock(m_mutex);
+    m_injectionSpeed = speed;
+    return true;
+}
+
+void AudioInjectorMicrophone::write() {
+    std::unique_lock<std::mutex> lock(m_mutex);
     if (m_isStreaming) {
         // If there is no audio to inject, write silence to the shared data stream at the sample rate.
         if (m_injectionData.empty()) {
-            ssize_t writeResult = m_writer->write(
-                static_cast<void*>(m_silenceBuffer.data()), m_maxSampleCountPerTimeout, TIMEOUT_FOR_WRITING);
+            auto sampleCount = m_silenceSampleCountPerWrite;
+            // Like injected audio, silence is written without holding the lock, since the write may block.
+            lock.unlock();
+            ssize_t writeResult =
+                m_writer->write(static_cast<void*>(m_silenceBuffer.data()), sampleCount, TIMEOUT_FOR_WRITING);
             if (writeResult <= 0) {
                 switch (writeResult) {
                     case avsCommon::avs::AudioInputStream::Writer::Error::WOULDBLOCK:
@@ -158,57 +203,79 @@ void AudioInjectorMicrophone::write() {
                 ACSDK_DEBUG9(LX("writeSilence").d("wordsWritten", writeResult));
             }
         } else {
-            // Otherwise, write audio injection file to the shared stream.
-
-            // Sanity check.
-            if (m_injectionDataCounter >= m_injectionData.size()) {
-                ACSDK_ERROR(LX("injectAudioFailed")
-                                .d("reason", "bufferOverrun")
-                                .d("overrun", m_injectionDataCounter - m_injectionData.size()));
-                resetAudioInjection();
-                return;
+            // Otherwise, write audio injection file to the shared stream, all of it at once if there is no pacing.
+            while (writeInjectionData(lock) && AS_FAST_AS_POSSIBLE == m_injectionSpeed) {
             }
+        }
+    }
+}
 
-            // m_injectionData.size() is guaranteed to be greater than m_injectDataCounter
-            size_t injectionDataLeft = m_injectionData.size() - m_injectionDataCounter;
-            size_t amountToWrite =
-                (m_maxSampleCountPerTimeout > injectionDataLeft) ? injectionDataLeft : m_maxSampleCountPerTimeout;
+bool AudioInjectorMicrophone::writeInjectionData(std::unique_lock<std::mutex>& lock) {
+    // Sanity check.
+    if (m_injectionDataCounter >= m_injectionData.size()) {
+        ACSDK_ERROR(LX("injectAudioFailed")
+                        .d("reason", "bufferOverrun")
+                        .d("overrun", m_injectionDataCounter - m_injectionData.size()));
+        resetAudioInjection();
+        return false;
+    }
 
-            ssize_t writeResult = m_writer->write(
-                static_cast<void*>(m_injectionData.data() + m_injectionDataCounter),
-                amountToWrite,
-                TIMEOUT_FOR_WRITING);
+    // m_injectionData.size() is guaranteed to be greater than m_injectDataCounter
+    size_t injectionDataLeft = m_injectionData.size() - m_injectionDataCounter;
+    size_t amountToWrite =
+        (m_maxSampleCountPerTimeout > injectionDataLeft) ? injectionDataLeft : m_maxSampleCountPerTimeout;
 
-            if (writeResult <= 0) {
-                switch (writeResult) {
-                    case avsCommon::avs::AudioInputStream::Writer::Error::WOULDBLOCK:
-                    case avsCommon::avs::AudioInputStream::Writer::Error::INVALID:
-                    case avsCommon::avs::AudioInputStream::Writer::Error::CLOSED:
-                        ACSDK_ERROR(LX("injectAudioFailed").d("error", writeResult));
-                        resetAudioInjection();
-                        break;
-                    case avsCommon::avs::AudioInputStream::Writer::Error::TIMEDOUT:
-                        // No need to reset audio injection here; simply retry until a reader
-                        // frees space in the SDS for writing.
-                        ACSDK_DEBUG9(LX("injectAudioTimedOut"));
-                        break;
-                }
-            } else {
-                ACSDK_DEBUG9(LX("injectAudio").d("wordsWritten", writeResult));
-                m_injectionDataCounter += writeResult;
+    // The write blocks until the readers make room, which must not block injectAudio() or
+    // stopStreamingMicrophoneData(), so it is made without the lock, from a copy of the data which they cannot free.
+    m_injectionWriteBuffer.assign(
+        m_injectionData.begin() + m_injectionDataCounter,
+        m_injectionData.begin() + m_injectionDataCounter + amountToWrite);
+    auto injectionId = m_injectionId;
+    lock.unlock();
+    ssize_t writeResult =
+        m_writer->write(static_cast<void*>(m_injectionWriteBuffer.data()), amountToWrite, TIMEOUT_FOR_WRITING);
+    lock.lock();
+    if (injectionId != m_injectionId) {
+        // The injection was replaced or stopped during the write.
+        return false;
+    }
 
-                // All audio has been injected.
-                if (m_injectionDataCounter == m_injectionData.size()) {
-                    resetAudioInjection();
-                }
-            }
+    if (writeResult <= 0) {
+        switch (writeResult) {
+            case avsCommon::avs::AudioInputStream::Writer::Error::WOULDBLOCK:
+            case avsCommon::avs::AudioInputStream::Writer::Error::INVALID:
+            case avsCommon::avs::AudioInputStream::Writer::Error::CLOSED:
+                ACSDK_ERROR(LX("injectAudioFailed").d("error", writeResult));
+                resetAudioInjection();
+                break;
+            case avsCommon::avs::AudioInputStream::Writer::Error::TIMEDOUT:
+                // No need to reset audio injection here; simply retry until a reader
+                // frees space in the SDS for writing.
+                ACSDK_DEBUG9(LX("injectAudioTimedOut"));
+                break;
         }
+        return false;
     }
+
+    ACSDK_DEBUG9(LX("injectAudio").d("wordsWritten", writeResult));
+    m_injectionDataCounter += writeResult;
+    if (m_injectionObserver) {
+        m_injectionObserver(m_injectionDataCounter, m_writer->tell());
+    }
+
+    // All audio has been injected.
+    if (m_injectionDataCounter == m_injectionData.size()) {
+        resetAudioInjection();
+        return false;
+    }
+    return true;
 }
 
 void AudioInjectorMicrophone::resetAudioInjection() {
     m_injectionData.clear();
     m_injectionDataCounter = 0;
+    m_injectionObserver = nullptr;
+    ++m_injectionId;
 }
 
 }  // namespace diagnostics
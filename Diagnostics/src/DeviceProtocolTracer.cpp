@@ -42,13 +42,16 @@ static const unsigned int DEFAULT_MAX_MESSAGES = 1;
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-std::shared_ptr<DeviceProtocolTracer> DeviceProtocolTracer::create() {
-    return std::shared_ptr<DeviceProtocolTracer>(new DeviceProtocolTracer(DEFAULT_MAX_MESSAGES));
+std::shared_ptr<DeviceProtocolTracer> DeviceProtocolTracer::create(std::shared_ptr<ProtocolCaptureFile> captureFile) {
+    return std::shared_ptr<DeviceProtocolTracer>(new DeviceProtocolTracer(DEFAULT_MAX_MESSAGES, captureFile));
 }
 
-DeviceProtocolTracer::DeviceProtocolTracer(unsigned int maxMessages) :
+DeviceProtocolTracer::DeviceProtocolTracer(
+    unsigned int maxMessages,
+    std::shared_ptr<ProtocolCaptureFile> captureFile) :
         m_isProtocolTraceEnabled{false},
-        m_maxMessages(maxMessages) {
+        m_maxMessages(maxMessages),
+        m_captureFile{std::move(captureFile)} {
 }
 
 unsigned int DeviceProtocolTracer::getMaxMessages() {
@@ -92,16 +95,29 @@ void DeviceProtocolTracer::clearTracedMessagesLocked() {
 
 void DeviceProtocolTracer::receive(const std::string& contextId, const std::string& message) {
     ACSDK_DEBUG5(LX(__func__));
+    auto captureFile = std::atomic_load(&m_captureFile);
+    if (captureFile) {
+        captureFile->append(ProtocolCaptureFile::RecordType::DIRECTIVE, contextId, message);
+    }
     std::lock_guard<std::mutex> lock{m_mutex};
     traceMessageLocked(message);
 }
 
 void DeviceProtocolTracer::traceEvent(const std::string& message) {
     ACSDK_DEBUG5(LX(__func__));
+    auto captureFile = std::atomic_load(&m_captureFile);
+    if (captureFile) {
+        captureFile->append(ProtocolCaptureFile::RecordType::EVENT, "", message);
+    }
     std::lock_guard<std::mutex> lock{m_mutex};
     traceMessageLocked(message);
 }
 
+void DeviceProtocolTracer::setCaptureFile(std::shared_ptr<ProtocolCaptureFile> captureFile) {
+    ACSDK_DEBUG5(LX(__func__).d("capturing", captureFile != nullptr));
+    std::atomic_store(&m_captureFile, std::move(captureFile));
+}
+
 void DeviceProtocolTracer::traceMessageLocked(const std::string& messageContent) {
     if (m_isProtocolTraceEnabled) {
         if (m_tracedMessages.size() < m_maxMessages) {
@@ -0,0 +1,391 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "Diagnostics/ProtocolCaptureFile.h"
+
+namespace alexaClientSDK {
+namespace diagnostics {
+
+/// String to identify log entries originating from this file.
+#define TAG "ProtocolCaptureFile"
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "ProtocolCaptureFile requires lock free 64 bit atomics");
+
+/// The magic bytes at the start of a capture file.
+static const char FILE_MAGIC[8] = {'A', 'C', 'S', 'D', 'K', 'P', 'C', '1'};
+
+/// The version of the capture file format.
+static const uint32_t FILE_VERSION = 1;
+
+/// The value of @c RecordHeader::commit of a record which is completely written.
+static const uint32_t RECORD_COMMITTED = 0x52435044;
+
+/// The alignment of records in the ring.
+static const uint64_t RECORD_ALIGNMENT = 8;
+
+/// The smallest ring accepted by @c create().
+static const size_t MIN_CAPACITY_BYTES = 4096;
+
+/// The suffix added to the path of the previous capture file.
+static const std::string PREVIOUS_CAPTURE_SUFFIX = ".1";
+
+/// FNV-1a offset basis.
+static const uint32_t FNV_OFFSET_BASIS = 2166136261u;
+
+/// FNV-1a prime.
+static const uint32_t FNV_PRIME = 16777619u;
+
+const size_t ProtocolCaptureFile::DEFAULT_CAPACITY_BYTES = 4 * 1024 * 1024;
+
+/// The header at the start of a capture file, followed by the ring.
+struct FileHeader {
+    /// @c FILE_MAGIC.
+    char magic[8];
+
+    /// @c FILE_VERSION.
+    uint32_t version;
+
+    /// The size of this header.
+    uint32_t headerSize;
+
+    /// The size of the ring.
+    uint64_t capacity;
+
+    /// The total number of bytes reserved in the ring since the capture was created.
+    std::atomic<uint64_t> writeOffset;
+
+    /// The sequence number of the next record.
+    std::atomic<uint64_t> nextSequence;
+
+    /// The number of records which were too large to be captured.
+    std::atomic<uint64_t> droppedRecords;
+
+    /// The wall clock time the capture was created, in nanoseconds since the epoch.
+    int64_t startTime;
+
+    /// Reserved.
+    uint64_t reserved;
+};
+
+/// The header of a record. The record content follows, starting with the context id.
+struct RecordHeader {
+    /// @c RECORD_COMMITTED once the record is completely written.
+    std::atomic<uint32_t> commit;
+
+    /// The FNV-1a hash of the rest of the header and the record content.
+    uint32_t checksum;
+
+    /// The total number of bytes reserved in the ring before this record.
+    uint64_t offset;
+
+    /// The sequence number of the record.
+    uint64_t sequence;
+
+    /// The time the record was appended, in nanoseconds since the capture was created.
+    int64_t timestamp;
+
+    /// The size of the record including this header and the padding after the content.
+    uint32_t length;
+
+    /// The size of the message content.
+    uint32_t contentLength;
+
+    /// The size of the context id.
+    uint16_t contextIdLength;
+
+    /// The @c RecordType.
+    uint8_t type;
+
+    /// Padding.
+    uint8_t padding[5];
+};
+
+static_assert(sizeof(FileHeader) % RECORD_ALIGNMENT == 0, "FileHeader must keep records aligned");
+static_assert(sizeof(RecordHeader) % RECORD_ALIGNMENT == 0, "RecordHeader must keep records aligned");
+
+/**
+ * Update an FNV-1a hash.
+ *
+ * @param hash The hash so far.
+ * @param data The data to add.
+ * @param size The size of the data.
+ * @return The updated hash.
+ */
+static uint32_t fnv1a(uint32_t hash, const void* data, size_t size) {
+    auto bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * Compute the checksum of a record.
+ *
+ * @param header The header of the record.
+ * @param contextId The context id of the record.
+ * @param content The content of the record.
+ * @return The checksum.
+ */
+static uint32_t computeChecksum(const RecordHeader& header, const char* contextId, const char* content) {
+    auto fieldsStart = reinterpret_cast<const char*>(&header.offset);
+    auto fieldsEnd = reinterpret_cast<const char*>(&header) + sizeof(RecordHeader);
+    auto hash = fnv1a(FNV_OFFSET_BASIS, fieldsStart, fieldsEnd - fieldsStart);
+    hash = fnv1a(hash, contextId, header.contextIdLength);
+    return fnv1a(hash, content, header.contentLength);
+}
+
+/**
+ * Check whether a record type read from a file is known.
+ *
+ * @param type The record type.
+ * @return Whether the record type is known.
+ */
+static bool isValidType(uint8_t type) {
+    switch (static_cast<ProtocolCaptureFile::RecordType>(type)) {
+        case ProtocolCaptureFile::RecordType::DIRECTIVE:
+        case ProtocolCaptureFile::RecordType::EVENT:
+            return true;
+    }
+    return false;
+}
+
+std::shared_ptr<ProtocolCaptureFile> ProtocolCaptureFile::create(const std::string& path, size_t capacityBytes) {
+    capacityBytes -= capacityBytes % RECORD_ALIGNMENT;
+    if (capacityBytes < MIN_CAPACITY_BYTES) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "capacityTooSmall").d("capacity", capacityBytes));
+        return nullptr;
+    }
+
+#ifdef __linux__
+    auto previousPath = path + PREVIOUS_CAPTURE_SUFFIX;
+    if (std::rename(path.c_str(), previousPath.c_str()) != 0 && errno != ENOENT) {
+        ACSDK_WARN(LX(__func__).d("reason", "renameFailed").d("path", path).d("error", std::strerror(errno)));
+    }
+
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP);
+    if (fd < 0) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "openFailed").d("path", path).d("error", std::strerror(errno)));
+        return nullptr;
+    }
+
+    size_t mappingSize = sizeof(FileHeader) + capacityBytes;
+    if (ftruncate(fd, static_cast<off_t>(mappingSize)) != 0) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "ftruncateFailed").d("error", std::strerror(errno)));
+        close(fd);
+        return nullptr;
+    }
+
+    auto mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == mapping) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "mmapFailed").d("error", std::strerror(errno)));
+        close(fd);
+        return nullptr;
+    }
+
+    auto header = static_cast<FileHeader*>(mapping);
+    header->version = FILE_VERSION;
+    header->headerSize = sizeof(FileHeader);
+    header->capacity = capacityBytes;
+    header->writeOffset.store(0, std::memory_order_relaxed);
+    header->nextSequence.store(0, std::memory_order_relaxed);
+    header->droppedRecords.store(0, std::memory_order_relaxed);
+    header->startTime =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    // The magic goes in last, so a file is only recognized once its header is complete.
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(header->magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+
+    ACSDK_INFO(LX(__func__).d("path", path).d("capacity", capacityBytes));
+    return std::shared_ptr<ProtocolCaptureFile>(new ProtocolCaptureFile(fd, mapping, mappingSize));
+#else
+    ACSDK_ERROR(LX("createFailed").d("reason", "unsupportedPlatform"));
+    return nullptr;
+#endif
+}
+
+ProtocolCaptureFile::ProtocolCaptureFile(int fd, void* mapping, size_t mappingSize) :
+        m_fd{fd},
+        m_mapping{mapping},
+        m_mappingSize{mappingSize},
+        m_startTime{std::chrono::steady_clock::now()} {
+}
+
+ProtocolCaptureFile::~ProtocolCaptureFile() {
+#ifdef __linux__
+    msync(m_mapping, m_mappingSize, MS_SYNC);
+    munmap(m_mapping, m_mappingSize);
+    close(m_fd);
+#endif
+}
+
+size_t ProtocolCaptureFile::getCapacity() const {
+    return static_cast<const FileHeader*>(m_mapping)->capacity;
+}
+
+bool ProtocolCaptureFile::append(RecordType type, const std::string& contextId, const std::string& content) {
+    auto header = static_cast<FileHeader*>(m_mapping);
+    auto capacity = header->capacity;
+    auto payloadSize = contextId.size() + content.size();
+    auto length = (sizeof(RecordHeader) + payloadSize + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+    if (contextId.size() > std::numeric_limits<uint16_t>::max() || length > capacity / 2) {
+        header->droppedRecords.fetch_add(1, std::memory_order_relaxed);
+        ACSDK_WARN(LX("appendFailed").d("reason", "recordTooLarge").d("size", length));
+        return false;
+    }
+
+    // Reserve space, skipping the end of the ring when the record would not fit there.
+    uint64_t reserved = header->writeOffset.load(std::memory_order_relaxed);
+    uint64_t offset = 0;
+    do {
+        offset = reserved;
+        auto position = offset % capacity;
+        if (position + length > capacity) {
+            offset += capacity - position;
+        }
+    } while (!header->writeOffset.compare_exchange_weak(
+        reserved, offset + length, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    auto base = static_cast<char*>(m_mapping) + sizeof(FileHeader);
+    auto record = reinterpret_cast<RecordHeader*>(base + offset % capacity);
+    auto payload = reinterpret_cast<char*>(record + 1);
+
+    record->commit.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    record->offset = offset;
+    record->sequence = header->nextSequence.fetch_add(1, std::memory_order_relaxed);
+    record->timestamp =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_startTime).count();
+    record->length = static_cast<uint32_t>(length);
+    record->contentLength = static_cast<uint32_t>(content.size());
+    record->contextIdLength = static_cast<uint16_t>(contextId.size());
+    record->type = static_cast<uint8_t>(type);
+    std::memset(record->padding, 0, sizeof(record->padding));
+    std::memcpy(payload, contextId.data(), contextId.size());
+    std::memcpy(payload + contextId.size(), content.data(), content.size());
+    record->checksum = computeChecksum(*record, payload, payload + contextId.size());
+    record->commit.store(RECORD_COMMITTED, std::memory_order_release);
+    return true;
+}
+
+bool ProtocolCaptureFile::read(const std::string& path, Capture* capture) {
+    if (!capture) {
+        ACSDK_ERROR(LX("readFailed").d("reason", "nullCapture"));
+        return false;
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.good()) {
+        ACSDK_ERROR(LX("readFailed").d("reason", "openFailed").d("path", path));
+        return false;
+    }
+    std::string data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+    FileHeader header;
+    if (data.size() < sizeof(header)) {
+        ACSDK_ERROR(LX("readFailed").d("reason", "fileTooSmall").d("path", path));
+        return false;
+    }
+    std::memcpy(static_cast<void*>(&header), data.data(), sizeof(header));
+    if (std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 || header.version != FILE_VERSION ||
+        header.headerSize != sizeof(FileHeader) || header.capacity % RECORD_ALIGNMENT != 0 ||
+        data.size() < sizeof(FileHeader) + header.capacity) {
+        ACSDK_ERROR(LX("readFailed").d("reason", "invalidHeader").d("path", path));
+        return false;
+    }
+
+    capture->startTime = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(header.startTime)));
+    capture->droppedRecords = header.droppedRecords.load();
+    capture->records.clear();
+
+    auto capacity = header.capacity;
+    auto writeOffset = header.writeOffset.load();
+    auto base = data.data() + sizeof(FileHeader);
+
+    // Walk the last lap of the ring. The oldest record may have been partly overwritten, so until a valid record is
+    // found, and after any torn record, the walk moves on by one alignment step.
+    uint64_t offset = writeOffset > capacity ? writeOffset - capacity : 0;
+    size_t skippedBytes = 0;
+    while (offset + sizeof(RecordHeader) <= writeOffset) {
+        auto position = offset % capacity;
+        if (position + sizeof(RecordHeader) > capacity) {
+            offset += capacity - position;
+            continue;
+        }
+
+        RecordHeader record;
+        std::memcpy(static_cast<void*>(&record), base + position, sizeof(record));
+        auto payload = base + position + sizeof(RecordHeader);
+        bool valid = RECORD_COMMITTED == record.commit.load() && offset == record.offset &&
+                     record.length >= sizeof(RecordHeader) && 0 == record.length % RECORD_ALIGNMENT &&
+                     position + record.length <= capacity && offset + record.length <= writeOffset &&
+                     static_cast<uint64_t>(record.contextIdLength) + record.contentLength <=
+                         record.length - sizeof(RecordHeader) &&
+                     isValidType(record.type) &&
+                     record.checksum == computeChecksum(record, payload, payload + record.contextIdLength);
+        if (!valid) {
+            offset += RECORD_ALIGNMENT;
+            skippedBytes += RECORD_ALIGNMENT;
+            continue;
+        }
+
+        Record entry;
+        entry.type = static_cast<RecordType>(record.type);
+        entry.sequence = record.sequence;
+        entry.timestamp = std::chrono::nanoseconds(record.timestamp);
+        entry.contextId.assign(payload, record.contextIdLength);
+        entry.content.assign(payload + record.contextIdLength, record.contentLength);
+        capture->records.push_back(std::move(entry));
+        offset += record.length;
+    }
+
+    // Concurrent writers may complete their reservations out of sequence order.
+    std::sort(capture->records.begin(), capture->records.end(), [](const Record& lhs, const Record& rhs) {
+        return lhs.sequence < rhs.sequence;
+    });
+
+    ACSDK_DEBUG5(LX(__func__).d("records", capture->records.size()).d("skippedBytes", skippedBytes));
+    return true;
+}
+
+}  // namespace diagnostics
+}  // namespace alexaClientSDK
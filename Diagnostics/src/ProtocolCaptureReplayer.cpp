@@ -0,0 +1,112 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <thread>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "Diagnostics/ProtocolCaptureReplayer.h"
+
+namespace alexaClientSDK {
+namespace diagnostics {
+
+using namespace avsCommon::sdkInterfaces;
+
+/// String to identify log entries originating from this file.
+#define TAG "ProtocolCaptureReplayer"
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The longest time to sleep at once while waiting for the next record, so that @c stop() is noticed.
+static const std::chrono::milliseconds MAX_SLEEP{100};
+
+std::unique_ptr<ProtocolCaptureReplayer> ProtocolCaptureReplayer::create(
+    std::shared_ptr<MessageObserverInterface> observer) {
+    if (!observer) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullObserver"));
+        return nullptr;
+    }
+    return std::unique_ptr<ProtocolCaptureReplayer>(new ProtocolCaptureReplayer(std::move(observer)));
+}
+
+ProtocolCaptureReplayer::ProtocolCaptureReplayer(std::shared_ptr<MessageObserverInterface> observer) :
+        m_observer{std::move(observer)},
+        m_stopRequested{false} {
+}
+
+ProtocolCaptureReplayer::Result ProtocolCaptureReplayer::replay(
+    const ProtocolCaptureFile::Capture& capture,
+    double speed) {
+    ACSDK_DEBUG5(LX(__func__).d("records", capture.records.size()).d("speed", speed));
+    Result result;
+    if (speed < 0) {
+        ACSDK_ERROR(LX("replayFailed").d("reason", "negativeSpeed").d("speed", speed));
+        return result;
+    }
+
+    m_stopRequested = false;
+    auto start = std::chrono::steady_clock::now();
+    auto firstTimestamp =
+        capture.records.empty() ? std::chrono::nanoseconds::zero() : capture.records.front().timestamp;
+
+    for (const auto& record : capture.records) {
+        auto due = start;
+        if (speed > 0) {
+            due += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double, std::nano>((record.timestamp - firstTimestamp).count() / speed));
+            auto now = std::chrono::steady_clock::now();
+            while (now < due && !m_stopRequested) {
+                std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(due - now, MAX_SLEEP));
+                now = std::chrono::steady_clock::now();
+            }
+        }
+        if (m_stopRequested) {
+            result.stopped = true;
+            break;
+        }
+
+        switch (record.type) {
+            case ProtocolCaptureFile::RecordType::DIRECTIVE:
+                if (speed > 0) {
+                    result.maxLateness = std::max(result.maxLateness, std::chrono::steady_clock::now() - due);
+                }
+                m_observer->receive(record.contextId, record.content);
+                ++result.directives;
+                break;
+            case ProtocolCaptureFile::RecordType::EVENT:
+                ++result.events;
+                break;
+        }
+    }
+
+    ACSDK_DEBUG5(LX("replayFinished")
+                     .d("directives", result.directives)
+                     .d("events", result.events)
+                     .d("stopped", result.stopped));
+    return result;
+}
+
+void ProtocolCaptureReplayer::stop() {
+    m_stopRequested = true;
+}
+
+}  // namespace diagnostics
+}  // namespace alexaClientSDK
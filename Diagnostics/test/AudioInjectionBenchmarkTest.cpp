@@ -0,0 +1,1025 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+// @file AudioInjectionBenchmarkTest.cpp
+//
+// End-to-end benchmark of the capture-to-upload pipeline: utterances are injected into the audio input stream by an
+// @c AudioInjectorMicrophone at a configurable speed, a scripted keyword detector starts a recognition through a
+// real @c AudioInputProcessor when the wake word has been written, and a stub AVS server reads the uploaded audio
+// and sends StopCapture once it has received the end of the speech. Run the test binary directly to configure it:
+//
+//     AudioInjectionBenchmarkTest [--speed=<times real time, 0 for as fast as possible>] [--corpus=<file>]
+//
+// Each line of a corpus file describes an utterance, as the path of a WAV file in the format accepted by
+// @c readWavFileToBuffer() followed by the end of the silence before the wake word, the end of the wake word and the
+// end of the speech, in milliseconds from the start of the file. Lines starting with '#' are ignored.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <rapidjson/document.h>
+
+#include <AIP/AudioInputProcessor.h>
+#include <AVSCommon/AVS/AVSDirective.h>
+#include <AVSCommon/AVS/AVSMessageHeader.h>
+#include <AVSCommon/AVS/Attachment/AttachmentManager.h>
+#include <AVSCommon/AVS/CapabilityChangeNotifier.h>
+#include <AVSCommon/AVS/DialogUXStateAggregator.h>
+#include <AVSCommon/SDKInterfaces/MockContextManager.h>
+#include <AVSCommon/SDKInterfaces/MockDirectiveSequencer.h>
+#include <AVSCommon/SDKInterfaces/MockExceptionEncounteredSender.h>
+#include <AVSCommon/SDKInterfaces/MockFocusManager.h>
+#include <AVSCommon/SDKInterfaces/MockLocaleAssetsManager.h>
+#include <AVSCommon/SDKInterfaces/MockSystemSoundPlayer.h>
+#include <AVSCommon/SDKInterfaces/MockUserInactivityMonitor.h>
+#include <AVSCommon/Utils/Logger/ConsoleLogger.h>
+#include <AVSCommon/Utils/Memory/Memory.h>
+#include <AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h>
+#include <Settings/MockSetting.h>
+
+#include "Diagnostics/AudioInjectorMicrophone.h"
+#include "Diagnostics/DiagnosticsUtils.h"
+
+namespace alexaClientSDK {
+namespace diagnostics {
+namespace test {
+
+using namespace ::testing;
+using namespace avsCommon::avs;
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::sdkInterfaces::test;
+using namespace avsCommon::utils;
+using namespace avsCommon::utils::logger;
+using namespace capabilityAgents::aip;
+
+/// Clock used to timestamp the stages of an utterance.
+using Clock = std::chrono::steady_clock;
+
+/// The sample rate of the injected audio.
+static const unsigned int SAMPLE_RATE_HZ = 16000;
+
+/// The number of samples per millisecond of injected audio.
+static const size_t SAMPLES_PER_MS = SAMPLE_RATE_HZ / 1000;
+
+/// The size of a sample of the injected audio, in bits.
+static const unsigned int SAMPLE_SIZE_IN_BITS = 16;
+
+/// The size of a sample of the injected audio, in bytes.
+static const size_t SDS_WORDSIZE = SAMPLE_SIZE_IN_BITS / 8;
+
+/// The number of readers of the stream: the keyword detector and the uploaded attachment.
+static const size_t SDS_MAXREADERS = 4;
+
+/// The number of samples the stream holds, which must hold the preroll, the longest utterance and its upload lag.
+static const size_t SDS_WORDS = SAMPLE_RATE_HZ * 30;
+
+/// The keyword the scripted keyword detector detects.
+static const std::string KEYWORD = "ALEXA";
+
+/// The keywords supported by the @c AudioInputProcessor.
+static const std::set<std::string> SUPPORTED_WAKE_WORDS = {KEYWORD};
+
+/// The number of samples the scripted keyword detector reads at a time, like a keyword detector reading 10 ms frames.
+static const size_t DETECTOR_READ_SAMPLES = 10 * SAMPLES_PER_MS;
+
+/// How long the scripted keyword detector waits for audio before checking whether the wake word was read.
+static const std::chrono::milliseconds DETECTOR_READ_TIMEOUT{10};
+
+/// The number of bytes the stub server reads from the upload at a time.
+static const size_t UPLOAD_READ_BYTES = 4096;
+
+/**
+ * How long the stub server waits for a signal of injected audio before reading more of an upload which has no data
+ * available. Silence and the close of the upload are not signalled, and are only read after this timeout.
+ */
+static const std::chrono::milliseconds UPLOAD_WAIT_TIMEOUT{10};
+
+/// How long to wait for an utterance to be captured and uploaded, at any speed.
+static const std::chrono::seconds UTTERANCE_TIMEOUT{60};
+
+/// The token returned by the context manager for context requests.
+static const ContextRequestToken CONTEXT_REQUEST_TOKEN = 1;
+
+/// The HTTP/2 stream the directives of the stub server are received on.
+static const std::string ATTACHMENT_CONTEXT_ID = "benchmarkContextId";
+
+/// The context sent with the Recognize events.
+static const std::string CONTEXT_JSON = "{\"context\":[]}";
+
+/// The number of utterances in the synthetic corpus.
+static const size_t SYNTHETIC_UTTERANCE_COUNT = 10;
+
+/// The ratio of the circumference of a circle to its diameter.
+static const double PI = 3.14159265358979323846;
+
+/// The durations of the parts of a synthetic utterance, in milliseconds.
+static const size_t SYNTHETIC_LEADING_SILENCE_MS = 600;
+static const size_t SYNTHETIC_WAKE_WORD_MS = 700;
+static const size_t SYNTHETIC_SPEECH_MS = 1500;
+static const size_t SYNTHETIC_TRAILING_SILENCE_MS = 500;
+
+/// The speed at which the utterances are injected, relative to real time; set from the command line.
+static double g_injectionSpeed = AudioInjectorMicrophone::AS_FAST_AS_POSSIBLE;
+
+/// The corpus file describing the injected utterances, or empty to inject the synthetic corpus; set from the command
+/// line.
+static std::string g_corpusPath;
+
+/// An utterance of the corpus, with the positions of its parts in samples from its start.
+struct Utterance {
+    /// Where the utterance comes from.
+    std::string name;
+
+    /// The samples of the utterance.
+    std::vector<uint16_t> samples;
+
+    /// The start of the wake word.
+    size_t wakeWordBegin;
+
+    /// The end of the wake word.
+    size_t wakeWordEnd;
+
+    /// The end of the speech following the wake word.
+    size_t speechEnd;
+};
+
+/// The stages of an utterance timed by the benchmark.
+enum class Stage {
+    /// The end of the wake word was written to the stream.
+    WAKE_WORD_INJECTED,
+    /// The keyword detector detected the wake word.
+    KEYWORD_DETECTED,
+    /// The Recognize event was sent.
+    RECOGNIZE_SENT,
+    /// The first byte of audio was uploaded.
+    FIRST_UPLOAD_BYTE,
+    /// The end of the speech was written to the stream.
+    SPEECH_END_INJECTED,
+    /// The @c AudioInputProcessor stopped capturing after the StopCapture directive.
+    CAPTURE_STOPPED,
+    /// The @c AudioInputProcessor returned to idle after the upload completed.
+    IDLE
+};
+
+/// The number of @c Stage values.
+static const size_t STAGE_COUNT = static_cast<size_t>(Stage::IDLE) + 1;
+
+/**
+ * Create a synthetic utterance, made of silence followed by a tone standing for the wake word, a tone standing for
+ * the speech and silence again.
+ *
+ * @param index The index of the utterance, which varies its tones.
+ * @return The utterance.
+ */
+static Utterance createSyntheticUtterance(size_t index) {
+    Utterance utterance;
+    utterance.name = "synthetic-" + std::to_string(index);
+    utterance.wakeWordBegin = SYNTHETIC_LEADING_SILENCE_MS * SAMPLES_PER_MS;
+    utterance.wakeWordEnd = utterance.wakeWordBegin + SYNTHETIC_WAKE_WORD_MS * SAMPLES_PER_MS;
+    utterance.speechEnd = utterance.wakeWordEnd + SYNTHETIC_SPEECH_MS * SAMPLES_PER_MS;
+    utterance.samples.resize(utterance.speechEnd + SYNTHETIC_TRAILING_SILENCE_MS * SAMPLES_PER_MS, 0);
+    for (size_t i = utterance.wakeWordBegin; i < utterance.speechEnd; ++i) {
+        auto frequency = (i < utterance.wakeWordEnd ? 440.0 : 220.0) * (1.0 + 0.1 * index);
+        auto sample = 8000.0 * std::sin(2 * PI * frequency * i / SAMPLE_RATE_HZ);
+        utterance.samples[i] = static_cast<uint16_t>(static_cast<int16_t>(sample));
+    }
+    return utterance;
+}
+
+/**
+ * Load the utterances described by a corpus file.
+ *
+ * @param path The path of the corpus file.
+ * @param[out] utterances The utterances.
+ * @return Whether all the utterances were loaded.
+ */
+static bool loadCorpus(const std::string& path, std::vector<Utterance>* utterances) {
+    std::ifstream corpus(path);
+    if (!corpus) {
+        std::cerr << "Cannot open corpus " << path << std::endl;
+        return false;
+    }
+    std::string line;
+    while (std::getline(corpus, line)) {
+        if (line.empty() || '#' == line[0]) {
+            continue;
+        }
+        std::istringstream fields(line);
+        Utterance utterance;
+        size_t wakeWordBeginMs, wakeWordEndMs, speechEndMs;
+        if (!(fields >> utterance.name >> wakeWordBeginMs >> wakeWordEndMs >> speechEndMs) ||
+            !utils::readWavFileToBuffer(utterance.name, &utterance.samples)) {
+            std::cerr << "Invalid corpus line: " << line << std::endl;
+            return false;
+        }
+        utterance.wakeWordBegin = wakeWordBeginMs * SAMPLES_PER_MS;
+        utterance.wakeWordEnd = wakeWordEndMs * SAMPLES_PER_MS;
+        utterance.speechEnd = speechEndMs * SAMPLES_PER_MS;
+        if (utterance.wakeWordBegin >= utterance.wakeWordEnd || utterance.wakeWordEnd > utterance.speechEnd ||
+            utterance.speechEnd > utterance.samples.size()) {
+            std::cerr << "Invalid boundaries: " << line << std::endl;
+            return false;
+        }
+        utterances->push_back(std::move(utterance));
+    }
+    return !utterances->empty();
+}
+
+/// The times at which the stages of the current utterance were reached.
+class UtteranceTimeline {
+public:
+    /**
+     * Forget the stages reached, before the next utterance.
+     */
+    void reset() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& reached : m_reached) {
+            reached = false;
+        }
+    }
+
+    /**
+     * Note that a stage was reached now, unless it was already reached.
+     *
+     * @param stage The stage.
+     */
+    void mark(Stage stage) {
+        auto now = Clock::now();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto index = static_cast<size_t>(stage);
+        if (!m_reached[index]) {
+            m_reached[index] = true;
+            m_times[index] = now;
+            m_wakeTrigger.notify_all();
+        }
+    }
+
+    /**
+     * Wait for a stage to be reached.
+     *
+     * @param stage The stage.
+     * @param timeout How long to wait.
+     * @return Whether the stage was reached.
+     */
+    bool waitFor(Stage stage, std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto index = static_cast<size_t>(stage);
+        return m_wakeTrigger.wait_for(lock, timeout, [this, index] { return m_reached[index]; });
+    }
+
+    /**
+     * Get the time between two stages.
+     *
+     * @param from The earlier stage.
+     * @param to The later stage.
+     * @param[out] duration The time between the stages.
+     * @return Whether both stages were reached.
+     */
+    bool getDuration(Stage from, Stage to, std::chrono::microseconds* duration) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto fromIndex = static_cast<size_t>(from);
+        auto toIndex = static_cast<size_t>(to);
+        if (!m_reached[fromIndex] || !m_reached[toIndex]) {
+            return false;
+        }
+        *duration = std::chrono::duration_cast<std::chrono::microseconds>(m_times[toIndex] - m_times[fromIndex]);
+        return true;
+    }
+
+private:
+    /// Serializes access to the members.
+    std::mutex m_mutex;
+
+    /// Notified when a stage is reached.
+    std::condition_variable m_wakeTrigger;
+
+    /// Whether each stage was reached.
+    bool m_reached[STAGE_COUNT] = {};
+
+    /// The time each stage was reached.
+    Clock::time_point m_times[STAGE_COUNT];
+};
+
+/**
+ * A keyword detector which reads the stream like a real one, and detects the wake word it is told about once it has
+ * read the end of it.
+ */
+class ScriptedKeywordDetector {
+public:
+    /// Called when a wake word is detected, with its begin and end indices in the stream.
+    using DetectionCallback = std::function<void(AudioInputStream::Index begin, AudioInputStream::Index end)>;
+
+    /**
+     * Constructor.
+     *
+     * @param stream The stream to read.
+     * @param callback The callback to call when a wake word is detected.
+     */
+    ScriptedKeywordDetector(const std::shared_ptr<AudioInputStream>& stream, DetectionCallback callback) :
+            m_callback{std::move(callback)},
+            m_isShuttingDown{false},
+            m_isExpecting{false},
+            m_keywordBegin{0},
+            m_keywordEnd{0} {
+        m_reader = stream->createReader(AudioInputStream::Reader::Policy::BLOCKING);
+        m_thread = std::thread(&ScriptedKeywordDetector::detectionLoop, this);
+    }
+
+    /**
+     * Destructor.
+     */
+    ~ScriptedKeywordDetector() {
+        m_isShuttingDown = true;
+        m_thread.join();
+    }
+
+    /**
+     * Detect a wake word once the end of it has been read.
+     *
+     * @param begin The index of the start of the wake word in the stream.
+     * @param end The index of the end of the wake word in the stream.
+     */
+    void expectKeyword(AudioInputStream::Index begin, AudioInputStream::Index end) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_keywordBegin = begin;
+        m_keywordEnd = end;
+        m_isExpecting = true;
+    }
+
+private:
+    /**
+     * Read the stream until shutdown, detecting the expected wake word.
+     */
+    void detectionLoop() {
+        std::vector<int16_t> frame(DETECTOR_READ_SAMPLES);
+        while (!m_isShuttingDown) {
+            auto result = m_reader->read(frame.data(), frame.size(), DETECTOR_READ_TIMEOUT);
+            if (result < 0 && AudioInputStream::Reader::Error::TIMEDOUT != result) {
+                ADD_FAILURE() << "Keyword detector read failed: " << result;
+                return;
+            }
+            auto position = m_reader->tell();
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (m_isExpecting && position >= m_keywordEnd) {
+                m_isExpecting = false;
+                auto begin = m_keywordBegin;
+                auto end = m_keywordEnd;
+                lock.unlock();
+                m_callback(begin, end);
+            }
+        }
+    }
+
+    /// The callback to call when a wake word is detected.
+    const DetectionCallback m_callback;
+
+    /// The reader of the stream.
+    std::shared_ptr<AudioInputStream::Reader> m_reader;
+
+    /// Whether the detector is shutting down.
+    std::atomic<bool> m_isShuttingDown;
+
+    /// Serializes access to the expected wake word.
+    std::mutex m_mutex;
+
+    /// Whether a wake word is expected.
+    bool m_isExpecting;
+
+    /// The index of the start of the expected wake word in the stream.
+    AudioInputStream::Index m_keywordBegin;
+
+    /// The index of the end of the expected wake word in the stream.
+    AudioInputStream::Index m_keywordEnd;
+
+    /// The thread reading the stream.
+    std::thread m_thread;
+};
+
+/**
+ * A stand-in for AVS, which receives the Recognize events instead of an HTTP/2 connection. It reads the uploaded
+ * audio as the transport would, at the pace it becomes available, sends StopCapture once it has received the end of
+ * the speech, and completes the request once the upload ends.
+ */
+class StubAvsServer : public MessageSenderInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param timeline The timeline of the current utterance.
+     */
+    explicit StubAvsServer(std::shared_ptr<UtteranceTimeline> timeline) :
+            m_timeline{std::move(timeline)},
+            m_isShuttingDown{false},
+            m_audioWriteCount{0},
+            m_keywordBegin{0},
+            m_speechEnd{0},
+            m_thread{&StubAvsServer::serverLoop, this} {
+    }
+
+    /**
+     * Set the @c AudioInputProcessor to send directives to.
+     *
+     * @param audioInputProcessor The @c AudioInputProcessor.
+     */
+    void setAudioInputProcessor(std::shared_ptr<AudioInputProcessor> audioInputProcessor) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_audioInputProcessor = std::move(audioInputProcessor);
+    }
+
+    /**
+     * Describe the next utterance to be uploaded.
+     *
+     * @param keywordBegin The index of the start of the wake word in the stream.
+     * @param speechEnd The index of the end of the speech in the stream.
+     */
+    void expectUtterance(AudioInputStream::Index keywordBegin, AudioInputStream::Index speechEnd) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_keywordBegin = keywordBegin;
+        m_speechEnd = speechEnd;
+    }
+
+    /**
+     * Signal that injected audio was written to the stream, so that an upload waiting for it reads it at once.
+     */
+    void onAudioWritten() {
+        {
+            std::lock_guard<std::mutex> lock(m_audioMutex);
+            ++m_audioWriteCount;
+        }
+        m_audioWritten.notify_all();
+    }
+
+    /**
+     * Stop serving, failing the requests in progress.
+     */
+    void shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_isShuttingDown = true;
+            m_audioInputProcessor.reset();
+        }
+        m_wakeTrigger.notify_all();
+        {
+            // Taking the lock ensures an upload cannot miss the notification between its check and its wait.
+            std::lock_guard<std::mutex> lock(m_audioMutex);
+        }
+        m_audioWritten.notify_all();
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+        for (auto& request : m_requests) {
+            request->sendCompleted(MessageRequestObserverInterface::Status::CANCELED);
+        }
+        m_requests.clear();
+    }
+
+    /// @name MessageSenderInterface methods
+    /// @{
+    void sendMessage(std::shared_ptr<MessageRequest> request) override {
+        if (!request->isResolved()) {
+            request->sendCompleted(MessageRequestObserverInterface::Status::BAD_REQUEST);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_requests.push_back(std::move(request));
+        }
+        m_wakeTrigger.notify_all();
+    }
+    /// @}
+
+private:
+    /**
+     * Serve the requests until shutdown.
+     */
+    void serverLoop() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_wakeTrigger.wait(lock, [this] { return m_isShuttingDown || !m_requests.empty(); });
+            if (m_isShuttingDown) {
+                return;
+            }
+            auto request = m_requests.front();
+            m_requests.pop_front();
+            lock.unlock();
+            serve(request);
+            lock.lock();
+        }
+    }
+
+    /**
+     * Serve a request.
+     *
+     * @param request The request.
+     */
+    void serve(const std::shared_ptr<MessageRequest>& request) {
+        rapidjson::Document document;
+        document.Parse(request->getJsonContent().c_str());
+        if (document.HasParseError() || !document.HasMember("event")) {
+            request->sendCompleted(MessageRequestObserverInterface::Status::BAD_REQUEST);
+            return;
+        }
+        auto& event = document["event"];
+        auto& header = event["header"];
+        if (std::string(header["name"].GetString()) != "Recognize") {
+            request->sendCompleted(MessageRequestObserverInterface::Status::SUCCESS_NO_CONTENT);
+            return;
+        }
+        m_timeline->mark(Stage::RECOGNIZE_SENT);
+        std::string dialogRequestId =
+            header.HasMember("dialogRequestId") ? header["dialogRequestId"].GetString() : std::string();
+
+        // The upload starts before the wake word by the preroll the Recognize event reports.
+        AudioInputStream::Index prerollSamples = 0;
+        auto& initiatorPayload = event["payload"]["initiator"]["payload"];
+        if (initiatorPayload.HasMember("wakeWordIndices")) {
+            prerollSamples = initiatorPayload["wakeWordIndices"]["startIndexInSamples"].GetUint64();
+        }
+        size_t speechEndOffset;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            speechEndOffset = (m_speechEnd - (m_keywordBegin - prerollSamples)) * SDS_WORDSIZE;
+        }
+
+        auto status = upload(request, dialogRequestId, speechEndOffset);
+        request->sendCompleted(status);
+    }
+
+    /**
+     * Read the audio uploaded with a Recognize event until the @c AudioInputProcessor closes it.
+     *
+     * @param request The request of the Recognize event.
+     * @param dialogRequestId The dialog request id of the Recognize event.
+     * @param speechEndOffset The offset in the upload of the end of the speech, in bytes.
+     * @return The status to complete the request with.
+     */
+    MessageRequestObserverInterface::Status upload(
+        const std::shared_ptr<MessageRequest>& request,
+        const std::string& dialogRequestId,
+        size_t speechEndOffset) {
+        if (request->attachmentReadersCount() < 1) {
+            return MessageRequestObserverInterface::Status::BAD_REQUEST;
+        }
+        auto reader = request->getAttachmentReader(request->attachmentReadersCount() - 1)->reader;
+        std::vector<char> buffer(UPLOAD_READ_BYTES);
+        size_t uploaded = 0;
+        bool sentStopCapture = false;
+        while (true) {
+            // Note the writes made before the read, so that one made after it wakes the wait below.
+            unsigned long audioWriteCount;
+            {
+                std::lock_guard<std::mutex> lock(m_audioMutex);
+                audioWriteCount = m_audioWriteCount;
+            }
+            auto readStatus = AttachmentReader::ReadStatus::OK;
+            auto bytesRead = reader->read(buffer.data(), buffer.size(), &readStatus);
+            if (bytesRead > 0) {
+                if (0 == uploaded) {
+                    m_timeline->mark(Stage::FIRST_UPLOAD_BYTE);
+                }
+                uploaded += bytesRead;
+                if (!sentStopCapture && uploaded >= speechEndOffset) {
+                    sentStopCapture = sendStopCapture(dialogRequestId);
+                }
+            }
+            switch (readStatus) {
+                case AttachmentReader::ReadStatus::OK:
+                    break;
+                case AttachmentReader::ReadStatus::OK_WOULDBLOCK:
+                case AttachmentReader::ReadStatus::OK_TIMEDOUT:
+                    if (m_isShuttingDown) {
+                        return MessageRequestObserverInterface::Status::CANCELED;
+                    }
+                    waitForAudio(audioWriteCount);
+                    break;
+                case AttachmentReader::ReadStatus::CLOSED:
+                    return MessageRequestObserverInterface::Status::SUCCESS;
+                default:
+                    ADD_FAILURE() << "Upload read failed";
+                    return MessageRequestObserverInterface::Status::INTERNAL_ERROR;
+            }
+        }
+    }
+
+    /**
+     * Wait until injected audio is written after the given count of writes, the server shuts down, or
+     * @c UPLOAD_WAIT_TIMEOUT elapses.
+     *
+     * @param audioWriteCount The count of writes which were already read.
+     */
+    void waitForAudio(unsigned long audioWriteCount) {
+        std::unique_lock<std::mutex> lock(m_audioMutex);
+        m_audioWritten.wait_for(lock, UPLOAD_WAIT_TIMEOUT, [this, audioWriteCount] {
+            return m_isShuttingDown || m_audioWriteCount != audioWriteCount;
+        });
+    }
+
+    /**
+     * Send a StopCapture directive to the @c AudioInputProcessor.
+     *
+     * @param dialogRequestId The dialog request id of the directive.
+     * @return Whether the directive was sent.
+     */
+    bool sendStopCapture(const std::string& dialogRequestId) {
+        std::shared_ptr<AudioInputProcessor> audioInputProcessor;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            audioInputProcessor = m_audioInputProcessor;
+        }
+        if (!audioInputProcessor) {
+            return false;
+        }
+        auto messageId = uuidGeneration::generateUUID();
+        auto header = std::make_shared<AVSMessageHeader>("SpeechRecognizer", "StopCapture", messageId, dialogRequestId);
+        auto unparsedDirective =
+            "{\"directive\":{\"header\":{\"namespace\":\"SpeechRecognizer\",\"name\":\"StopCapture\",\"messageId\":\"" +
+            messageId + "\",\"dialogRequestId\":\"" + dialogRequestId + "\"},\"payload\":{}}}";
+        auto directive =
+            AVSDirective::create(unparsedDirective, header, "{}", m_attachmentManager, ATTACHMENT_CONTEXT_ID);
+        audioInputProcessor->handleDirectiveImmediately(std::move(directive));
+        return true;
+    }
+
+    /// The timeline of the current utterance.
+    const std::shared_ptr<UtteranceTimeline> m_timeline;
+
+    /// The attachment manager of the directives.
+    const std::shared_ptr<AttachmentManager> m_attachmentManager =
+        std::make_shared<AttachmentManager>(AttachmentManager::AttachmentType::IN_PROCESS);
+
+    /// Serializes access to the members.
+    std::mutex m_mutex;
+
+    /// Notified when a request is sent or the server shuts down.
+    std::condition_variable m_wakeTrigger;
+
+    /// Whether the server is shutting down.
+    std::atomic<bool> m_isShuttingDown;
+
+    /// Serializes access to @c m_audioWriteCount.
+    std::mutex m_audioMutex;
+
+    /// Notified when injected audio is written or the server shuts down.
+    std::condition_variable m_audioWritten;
+
+    /// The number of writes of injected audio so far.
+    unsigned long m_audioWriteCount;
+
+    /// The @c AudioInputProcessor to send directives to.
+    std::shared_ptr<AudioInputProcessor> m_audioInputProcessor;
+
+    /// The requests waiting to be served.
+    std::deque<std::shared_ptr<MessageRequest>> m_requests;
+
+    /// The index of the start of the wake word of the current utterance in the stream.
+    AudioInputStream::Index m_keywordBegin;
+
+    /// The index of the end of the speech of the current utterance in the stream.
+    AudioInputStream::Index m_speechEnd;
+
+    /// The thread serving the requests.
+    std::thread m_thread;
+};
+
+/// Observer marking the stages of the current utterance reached by the @c AudioInputProcessor.
+class TimelineObserver : public AudioInputProcessorObserverInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param timeline The timeline of the current utterance.
+     */
+    explicit TimelineObserver(std::shared_ptr<UtteranceTimeline> timeline) : m_timeline{std::move(timeline)} {
+    }
+
+    /// @name AudioInputProcessorObserverInterface methods
+    /// @{
+    void onStateChanged(State state) override {
+        if (State::BUSY == state) {
+            m_timeline->mark(Stage::CAPTURE_STOPPED);
+        } else if (State::IDLE == state) {
+            m_timeline->mark(Stage::IDLE);
+        }
+    }
+    /// @}
+
+private:
+    /// The timeline of the current utterance.
+    const std::shared_ptr<UtteranceTimeline> m_timeline;
+};
+
+/// Test harness for the capture-to-upload benchmark.
+class AudioInjectionBenchmarkTest : public Test {
+protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    /**
+     * Inject an utterance, wait for it to be uploaded, and record the time each stage took.
+     *
+     * @param utterance The utterance.
+     */
+    void runUtterance(const Utterance& utterance);
+
+    /**
+     * Print the measurements of the benchmark.
+     *
+     * @param audioDuration The duration of the injected audio.
+     * @param duration How long the benchmark took.
+     */
+    void report(std::chrono::milliseconds audioDuration, Clock::duration duration);
+
+    /// The timeline of the current utterance.
+    std::shared_ptr<UtteranceTimeline> m_timeline;
+
+    /// The time each reported stage took, for each utterance, in the order of @c REPORTED_STAGES.
+    std::vector<std::vector<std::chrono::microseconds>> m_stageDurations;
+
+    /// The stream the utterances are injected to.
+    std::shared_ptr<AudioInputStream> m_stream;
+
+    /// The provider of the stream to the @c AudioInputProcessor.
+    std::unique_ptr<AudioProvider> m_audioProvider;
+
+    /// The microphone injecting the utterances.
+    std::unique_ptr<AudioInjectorMicrophone> m_microphone;
+
+    /// The stand-in for AVS.
+    std::shared_ptr<StubAvsServer> m_server;
+
+    /// The @c AudioInputProcessor under benchmark.
+    std::shared_ptr<AudioInputProcessor> m_audioInputProcessor;
+
+    /// The observer of the @c AudioInputProcessor.
+    std::shared_ptr<TimelineObserver> m_observer;
+
+    /// The keyword detector reading the stream.
+    std::unique_ptr<ScriptedKeywordDetector> m_detector;
+
+    /// @name The collaborators of the @c AudioInputProcessor.
+    /// @{
+    std::shared_ptr<NiceMock<MockDirectiveSequencer>> m_mockDirectiveSequencer;
+    std::shared_ptr<NiceMock<MockContextManager>> m_mockContextManager;
+    std::shared_ptr<NiceMock<MockFocusManager>> m_mockFocusManager;
+    std::shared_ptr<DialogUXStateAggregator> m_dialogUXStateAggregator;
+    std::shared_ptr<NiceMock<MockExceptionEncounteredSender>> m_mockExceptionEncounteredSender;
+    std::shared_ptr<NiceMock<MockUserInactivityMonitor>> m_mockUserInactivityMonitor;
+    std::shared_ptr<NiceMock<MockSystemSoundPlayer>> m_mockSystemSoundPlayer;
+    std::shared_ptr<NiceMock<MockLocaleAssetsManager>> m_mockAssetsManager;
+    std::shared_ptr<settings::test::MockSetting<settings::WakeWordConfirmationSettingType>> m_mockWakeWordConfirmation;
+    std::shared_ptr<settings::test::MockSetting<settings::SpeechConfirmationSettingType>> m_mockSpeechConfirmation;
+    std::shared_ptr<settings::test::MockSetting<settings::WakeWords>> m_mockWakeWordSetting;
+    /// @}
+};
+
+/// The reported stages, as the stage each one starts at, the stage it ends at and its description.
+static const std::vector<std::tuple<Stage, Stage, std::string>> REPORTED_STAGES = {
+    std::make_tuple(Stage::WAKE_WORD_INJECTED, Stage::KEYWORD_DETECTED, "wake word end to keyword detection"),
+    std::make_tuple(Stage::WAKE_WORD_INJECTED, Stage::RECOGNIZE_SENT, "wake word end to Recognize event start"),
+    std::make_tuple(Stage::WAKE_WORD_INJECTED, Stage::FIRST_UPLOAD_BYTE, "wake word end to first upload byte"),
+    std::make_tuple(Stage::SPEECH_END_INJECTED, Stage::CAPTURE_STOPPED, "speech end to StopCapture handled")};
+
+void AudioInjectionBenchmarkTest::SetUp() {
+    // Debug logging would dominate the measurements, and the metrics nobody records here warn for every utterance.
+    getConsoleLogger()->setLevel(Level::ERROR);
+    m_timeline = std::make_shared<UtteranceTimeline>();
+    m_stageDurations.resize(REPORTED_STAGES.size());
+
+    auto bufferSize = AudioInputStream::calculateBufferSize(SDS_WORDS, SDS_WORDSIZE, SDS_MAXREADERS);
+    auto buffer = std::make_shared<AudioInputStream::Buffer>(bufferSize);
+    m_stream = AudioInputStream::create(buffer, SDS_WORDSIZE, SDS_MAXREADERS);
+    ASSERT_TRUE(m_stream);
+    AudioFormat format = {AudioFormat::Encoding::LPCM,
+                          AudioFormat::Endianness::LITTLE,
+                          SAMPLE_RATE_HZ,
+                          SAMPLE_SIZE_IN_BITS,
+                          1,
+                          false,
+                          AudioFormat::Layout::NON_INTERLEAVED};
+    m_audioProvider = memory::make_unique<AudioProvider>(m_stream, format, ASRProfile::NEAR_FIELD, true, true, true);
+
+    m_mockDirectiveSequencer = std::make_shared<NiceMock<MockDirectiveSequencer>>();
+    m_mockContextManager = std::make_shared<NiceMock<MockContextManager>>();
+    m_mockFocusManager = std::make_shared<NiceMock<MockFocusManager>>();
+    m_dialogUXStateAggregator = std::make_shared<DialogUXStateAggregator>();
+    m_mockExceptionEncounteredSender = std::make_shared<NiceMock<MockExceptionEncounteredSender>>();
+    m_mockUserInactivityMonitor = std::make_shared<NiceMock<MockUserInactivityMonitor>>();
+    m_mockSystemSoundPlayer = std::make_shared<NiceMock<MockSystemSoundPlayer>>();
+    m_mockAssetsManager = std::make_shared<NiceMock<MockLocaleAssetsManager>>();
+    m_mockWakeWordConfirmation =
+        std::make_shared<settings::test::MockSetting<settings::WakeWordConfirmationSettingType>>(
+            settings::getWakeWordConfirmationDefault());
+    m_mockSpeechConfirmation = std::make_shared<settings::test::MockSetting<settings::SpeechConfirmationSettingType>>(
+        settings::getSpeechConfirmationDefault());
+    m_mockWakeWordSetting = std::make_shared<settings::test::MockSetting<settings::WakeWords>>(SUPPORTED_WAKE_WORDS);
+    ON_CALL(*m_mockAssetsManager, getSupportedWakeWords(_))
+        .WillByDefault(Return(LocaleAssetsManagerInterface::WakeWordsSets{SUPPORTED_WAKE_WORDS}));
+    ON_CALL(*m_mockAssetsManager, getDefaultSupportedWakeWords())
+        .WillByDefault(Return(LocaleAssetsManagerInterface::WakeWordsSets{SUPPORTED_WAKE_WORDS}));
+
+    m_server = std::make_shared<StubAvsServer>(m_timeline);
+    m_audioInputProcessor = AudioInputProcessor::create(
+        m_mockDirectiveSequencer,
+        m_server,
+        m_mockContextManager,
+        m_mockFocusManager,
+        m_dialogUXStateAggregator,
+        m_mockExceptionEncounteredSender,
+        m_mockUserInactivityMonitor,
+        m_mockSystemSoundPlayer,
+        m_mockAssetsManager,
+        m_mockWakeWordConfirmation,
+        m_mockSpeechConfirmation,
+        std::make_shared<CapabilityChangeNotifier>(),
+        m_mockWakeWordSetting,
+        nullptr,
+        *m_audioProvider);
+    ASSERT_TRUE(m_audioInputProcessor);
+    m_server->setAudioInputProcessor(m_audioInputProcessor);
+    m_observer = std::make_shared<TimelineObserver>(m_timeline);
+    m_audioInputProcessor->addObserver(m_observer);
+
+    // The context and the focus are granted right away, as the ContextManager and the FocusManager would when idle.
+    std::weak_ptr<AudioInputProcessor> weakAudioInputProcessor = m_audioInputProcessor;
+    ON_CALL(*m_mockContextManager, getContextWithoutReportableStateProperties(_, _, _))
+        .WillByDefault(InvokeWithoutArgs([weakAudioInputProcessor] {
+            if (auto audioInputProcessor = weakAudioInputProcessor.lock()) {
+                audioInputProcessor->onContextAvailable(CONTEXT_JSON);
+            }
+            return CONTEXT_REQUEST_TOKEN;
+        }));
+    ON_CALL(*m_mockFocusManager, acquireChannel(_, A<std::shared_ptr<FocusManagerInterface::Activity>>()))
+        .WillByDefault(InvokeWithoutArgs([weakAudioInputProcessor] {
+            if (auto audioInputProcessor = weakAudioInputProcessor.lock()) {
+                audioInputProcessor->onFocusChanged(FocusState::FOREGROUND, MixingBehavior::PRIMARY);
+            }
+            return true;
+        }));
+
+    auto audioProvider = *m_audioProvider;
+    auto timeline = m_timeline;
+    m_detector = memory::make_unique<ScriptedKeywordDetector>(
+        m_stream,
+        [weakAudioInputProcessor, audioProvider, timeline](AudioInputStream::Index begin, AudioInputStream::Index end) {
+            timeline->mark(Stage::KEYWORD_DETECTED);
+            if (auto audioInputProcessor = weakAudioInputProcessor.lock()) {
+                audioInputProcessor->recognize(audioProvider, Initiator::WAKEWORD, Clock::now(), begin, end, KEYWORD);
+            }
+        });
+
+    m_microphone = AudioInjectorMicrophone::create(m_stream, format);
+    ASSERT_TRUE(m_microphone);
+    ASSERT_TRUE(m_microphone->setInjectionSpeed(g_injectionSpeed));
+    ASSERT_TRUE(m_microphone->startStreamingMicrophoneData());
+}
+
+void AudioInjectionBenchmarkTest::TearDown() {
+    if (m_microphone) {
+        m_microphone->stopStreamingMicrophoneData();
+    }
+    m_detector.reset();
+    if (m_audioInputProcessor) {
+        m_audioInputProcessor->removeObserver(m_observer);
+        m_audioInputProcessor->shutdown();
+    }
+    if (m_mockDirectiveSequencer) {
+        m_mockDirectiveSequencer->shutdown();
+    }
+    if (m_server) {
+        m_server->shutdown();
+    }
+}
+
+void AudioInjectionBenchmarkTest::runUtterance(const Utterance& utterance) {
+    m_timeline->reset();
+    auto server = m_server;
+    auto detector = m_detector.get();
+    auto timeline = m_timeline;
+    bool isStarted = false;
+    m_microphone->injectAudio(
+        utterance.samples,
+        [&utterance, server, detector, timeline, isStarted](
+            size_t samplesInjected, AudioInputStream::Index nextIndex) mutable {
+            if (!isStarted) {
+                isStarted = true;
+                auto start = nextIndex - samplesInjected;
+                server->expectUtterance(start + utterance.wakeWordBegin, start + utterance.speechEnd);
+                detector->expectKeyword(start + utterance.wakeWordBegin, start + utterance.wakeWordEnd);
+            }
+            server->onAudioWritten();
+            if (samplesInjected >= utterance.wakeWordEnd) {
+                timeline->mark(Stage::WAKE_WORD_INJECTED);
+            }
+            if (samplesInjected >= utterance.speechEnd) {
+                timeline->mark(Stage::SPEECH_END_INJECTED);
+            }
+        });
+    ASSERT_TRUE(m_timeline->waitFor(Stage::IDLE, UTTERANCE_TIMEOUT)) << utterance.name;
+
+    for (size_t i = 0; i < REPORTED_STAGES.size(); ++i) {
+        std::chrono::microseconds duration;
+        ASSERT_TRUE(
+            m_timeline->getDuration(std::get<0>(REPORTED_STAGES[i]), std::get<1>(REPORTED_STAGES[i]), &duration))
+            << utterance.name << ": " << std::get<2>(REPORTED_STAGES[i]);
+        m_stageDurations[i].push_back(duration);
+    }
+}
+
+void AudioInjectionBenchmarkTest::report(std::chrono::milliseconds audioDuration, Clock::duration duration) {
+    auto seconds = std::chrono::duration_cast<std::chrono::duration<double>>(duration).count();
+    std::cout << "Injected " << m_stageDurations[0].size() << " utterances, " << audioDuration.count() / 1000.0
+              << " s of audio, in " << seconds << " s (" << audioDuration.count() / 1000.0 / seconds
+              << " times real time):" << std::endl;
+    for (size_t i = 0; i < REPORTED_STAGES.size(); ++i) {
+        auto latencies = m_stageDurations[i];
+        std::sort(latencies.begin(), latencies.end());
+        auto percentile = [&latencies](size_t percent) {
+            return latencies[std::min(latencies.size() - 1, latencies.size() * percent / 100)].count();
+        };
+        std::cout << "  " << std::get<2>(REPORTED_STAGES[i]) << ": p50 " << percentile(50) << " us, p90 "
+                  << percentile(90) << " us, max " << latencies.back().count() << " us" << std::endl;
+    }
+}
+
+/**
+ * Inject the corpus one utterance at a time, and report the time from the end of the wake word being written to the
+ * keyword detection, the start of the Recognize event and the first byte of audio being uploaded, and the time from
+ * the end of the speech being written to the StopCapture directive sent by the server being handled.
+ */
+TEST_F(AudioInjectionBenchmarkTest, testSlow_captureToUploadLatency) {
+    std::vector<Utterance> corpus;
+    if (g_corpusPath.empty()) {
+        for (size_t i = 0; i < SYNTHETIC_UTTERANCE_COUNT; ++i) {
+            corpus.push_back(createSyntheticUtterance(i));
+        }
+    } else {
+        ASSERT_TRUE(loadCorpus(g_corpusPath, &corpus));
+    }
+
+    size_t sampleCount = 0;
+    auto startTime = Clock::now();
+    for (const auto& utterance : corpus) {
+        runUtterance(utterance);
+        if (HasFatalFailure()) {
+            return;
+        }
+        sampleCount += utterance.samples.size();
+    }
+    auto duration = Clock::now() - startTime;
+
+    report(std::chrono::milliseconds(sampleCount / SAMPLES_PER_MS), duration);
+}
+
+}  // namespace test
+}  // namespace diagnostics
+}  // namespace alexaClientSDK
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    static const std::string SPEED_OPTION = "--speed=";
+    static const std::string CORPUS_OPTION = "--corpus=";
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (0 == argument.compare(0, SPEED_OPTION.size(), SPEED_OPTION)) {
+            alexaClientSDK::diagnostics::test::g_injectionSpeed = std::atof(argument.c_str() + SPEED_OPTION.size());
+        } else if (0 == argument.compare(0, CORPUS_OPTION.size(), CORPUS_OPTION)) {
+            alexaClientSDK::diagnostics::test::g_corpusPath = argument.substr(CORPUS_OPTION.size());
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--speed=<times real time, 0 for as fast as possible>]"
+                      << " [--corpus=<corpus file>]" << std::endl;
+            return 1;
+        }
+    }
+    return RUN_ALL_TESTS();
+}
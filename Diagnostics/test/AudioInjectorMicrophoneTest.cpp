@@ -0,0 +1,177 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Diagnostics/AudioInjectorMicrophone.h"
+
+namespace alexaClientSDK {
+namespace diagnostics {
+namespace test {
+
+using namespace ::testing;
+using namespace avsCommon::avs;
+using namespace avsCommon::utils;
+
+/// The sample rate of the injected audio.
+static const unsigned int SAMPLE_RATE_HZ = 16000;
+
+/// The size of a sample of the injected audio, in bytes.
+static const size_t SDS_WORDSIZE = 2;
+
+/// The maximum number of readers of the stream.
+static const size_t SDS_MAXREADERS = 2;
+
+/// The number of samples the stream holds.
+static const size_t SDS_WORDS = SAMPLE_RATE_HZ * 10;
+
+/// The number of samples injected, five seconds of audio.
+static const size_t INJECTED_SAMPLES = SAMPLE_RATE_HZ * 5;
+
+/// How long an injection of @c INJECTED_SAMPLES takes at most when injected as fast as possible.
+static const std::chrono::seconds AS_FAST_AS_POSSIBLE_TIMEOUT{2};
+
+/// How long an injection takes at least per second of audio when injected in real time, leaving room for the first
+/// write being immediate.
+static const std::chrono::milliseconds REAL_TIME_MIN_DURATION_PER_SECOND{400};
+
+/// How long to wait for an injection of one second of audio to complete in real time.
+static const std::chrono::seconds REAL_TIME_TIMEOUT{5};
+
+/// Test harness for @c AudioInjectorMicrophone.
+class AudioInjectorMicrophoneTest : public Test {
+protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    /**
+     * Inject audio and wait for it to be written to the stream.
+     *
+     * @param samples The audio to inject.
+     * @param timeout How long to wait.
+     * @return Whether all the audio was written.
+     */
+    bool injectAndWait(const std::vector<uint16_t>& samples, std::chrono::milliseconds timeout);
+
+    /// The stream written to.
+    std::shared_ptr<AudioInputStream> m_stream;
+
+    /// The microphone under test.
+    std::unique_ptr<AudioInjectorMicrophone> m_microphone;
+
+    /// Serializes access to the progress of the injection.
+    std::mutex m_mutex;
+
+    /// Notified when the injection progresses.
+    std::condition_variable m_wakeTrigger;
+
+    /// The number of samples injected so far.
+    size_t m_samplesInjected;
+
+    /// The index of the stream following the last sample injected.
+    AudioInputStream::Index m_nextIndex;
+};
+
+void AudioInjectorMicrophoneTest::SetUp() {
+    auto bufferSize = AudioInputStream::calculateBufferSize(SDS_WORDS, SDS_WORDSIZE, SDS_MAXREADERS);
+    auto buffer = std::make_shared<AudioInputStream::Buffer>(bufferSize);
+    m_stream = AudioInputStream::create(buffer, SDS_WORDSIZE, SDS_MAXREADERS);
+    ASSERT_TRUE(m_stream);
+    AudioFormat format = {AudioFormat::Encoding::LPCM,
+                          AudioFormat::Endianness::LITTLE,
+                          SAMPLE_RATE_HZ,
+                          SDS_WORDSIZE * 8,
+                          1,
+                          false,
+                          AudioFormat::Layout::NON_INTERLEAVED};
+    m_microphone = AudioInjectorMicrophone::create(m_stream, format);
+    ASSERT_TRUE(m_microphone);
+    m_samplesInjected = 0;
+    m_nextIndex = 0;
+}
+
+void AudioInjectorMicrophoneTest::TearDown() {
+    if (m_microphone) {
+        m_microphone->stopStreamingMicrophoneData();
+    }
+}
+
+bool AudioInjectorMicrophoneTest::injectAndWait(
+    const std::vector<uint16_t>& samples,
+    std::chrono::milliseconds timeout) {
+    m_microphone->injectAudio(samples, [this](size_t samplesInjected, AudioInputStream::Index nextIndex) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_samplesInjected = samplesInjected;
+        m_nextIndex = nextIndex;
+        m_wakeTrigger.notify_all();
+    });
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_wakeTrigger.wait_for(lock, timeout, [this, &samples] { return m_samplesInjected == samples.size(); });
+}
+
+/**
+ * Verify that speeds which are negative, not a number or too slow to be meaningful are rejected.
+ */
+TEST_F(AudioInjectorMicrophoneTest, test_setInjectionSpeedRejectsInvalidSpeeds) {
+    EXPECT_FALSE(m_microphone->setInjectionSpeed(-1));
+    EXPECT_FALSE(m_microphone->setInjectionSpeed(0.001));
+    EXPECT_FALSE(m_microphone->setInjectionSpeed(std::numeric_limits<double>::quiet_NaN()));
+    EXPECT_TRUE(m_microphone->setInjectionSpeed(AudioInjectorMicrophone::AS_FAST_AS_POSSIBLE));
+    EXPECT_TRUE(m_microphone->setInjectionSpeed(0.5));
+    EXPECT_TRUE(m_microphone->setInjectionSpeed(4));
+}
+
+/**
+ * Verify that audio injected as fast as possible is written well ahead of real time, and that the progress reported
+ * locates it in the stream.
+ */
+TEST_F(AudioInjectorMicrophoneTest, test_injectAsFastAsPossible) {
+    ASSERT_TRUE(m_microphone->setInjectionSpeed(AudioInjectorMicrophone::AS_FAST_AS_POSSIBLE));
+    ASSERT_TRUE(m_microphone->startStreamingMicrophoneData());
+    std::vector<uint16_t> samples(INJECTED_SAMPLES);
+    std::iota(samples.begin(), samples.end(), 1);
+
+    ASSERT_TRUE(injectAndWait(samples, AS_FAST_AS_POSSIBLE_TIMEOUT));
+
+    auto reader = m_stream->createReader(AudioInputStream::Reader::Policy::NONBLOCKING);
+    ASSERT_TRUE(reader);
+    ASSERT_TRUE(reader->seek(m_nextIndex - samples.size(), AudioInputStream::Reader::Reference::ABSOLUTE));
+    std::vector<uint16_t> written(samples.size());
+    ASSERT_EQ(reader->read(written.data(), written.size()), static_cast<ssize_t>(written.size()));
+    EXPECT_EQ(written, samples);
+}
+
+/**
+ * Verify that audio is injected in real time by default.
+ */
+TEST_F(AudioInjectorMicrophoneTest, test_injectInRealTimeByDefault) {
+    ASSERT_TRUE(m_microphone->startStreamingMicrophoneData());
+    std::vector<uint16_t> samples(SAMPLE_RATE_HZ, 1);
+
+    auto startTime = std::chrono::steady_clock::now();
+    ASSERT_TRUE(injectAndWait(samples, REAL_TIME_TIMEOUT));
+    EXPECT_GE(std::chrono::steady_clock::now() - startTime, REAL_TIME_MIN_DURATION_PER_SECOND);
+}
+
+}  // namespace test
+}  // namespace diagnostics
+}  // namespace alexaClientSDK
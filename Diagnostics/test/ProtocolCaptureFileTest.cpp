@@ -0,0 +1,363 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <Diagnostics/DeviceProtocolTracer.h>
+#include <Diagnostics/ProtocolCaptureFile.h>
+#include <Diagnostics/ProtocolCaptureReplayer.h>
+
+namespace alexaClientSDK {
+namespace diagnostics {
+namespace test {
+
+using namespace ::testing;
+using namespace avsCommon::sdkInterfaces;
+
+/// The template of the directory holding the capture files of a test.
+static const std::string CAPTURE_DIRECTORY_TEMPLATE = "/tmp/ProtocolCaptureFileTest.XXXXXX";
+
+/// The smallest capacity accepted for a capture file.
+static const size_t SMALL_CAPACITY = 4096;
+
+/// The size of the file header, which precedes the ring.
+static const size_t FILE_HEADER_SIZE = 64;
+
+/// The size of a record header, which precedes the record content.
+static const size_t RECORD_HEADER_SIZE = 48;
+
+/// A mock @c MessageObserverInterface.
+class MockMessageObserver : public MessageObserverInterface {
+public:
+    MOCK_METHOD2(receive, void(const std::string& contextId, const std::string& message));
+};
+
+class ProtocolCaptureFileTest : public ::testing::Test {
+public:
+    void SetUp() override;
+    void TearDown() override;
+
+protected:
+    /// The directory holding the capture files of the test, which is unique to the test.
+    std::string m_captureDirectory;
+
+    /// The path of the capture file used by the test.
+    std::string m_captureFilePath;
+
+    /// The path the previous capture file is moved to.
+    std::string m_previousCaptureFilePath;
+};
+
+void ProtocolCaptureFileTest::SetUp() {
+    std::vector<char> directory(CAPTURE_DIRECTORY_TEMPLATE.begin(), CAPTURE_DIRECTORY_TEMPLATE.end());
+    directory.push_back('\0');
+    ASSERT_NE(mkdtemp(directory.data()), nullptr);
+    m_captureDirectory = directory.data();
+    m_captureFilePath = m_captureDirectory + "/capture.bin";
+    m_previousCaptureFilePath = m_captureFilePath + ".1";
+}
+
+void ProtocolCaptureFileTest::TearDown() {
+    if (m_captureDirectory.empty()) {
+        return;
+    }
+    std::remove(m_captureFilePath.c_str());
+    std::remove(m_previousCaptureFilePath.c_str());
+    rmdir(m_captureDirectory.c_str());
+}
+
+/**
+ * Test that appended records are read back with their content, in order.
+ */
+TEST_F(ProtocolCaptureFileTest, test_appendedRecordsAreReadBack) {
+    auto captureFile = ProtocolCaptureFile::create(m_captureFilePath, SMALL_CAPACITY);
+    ASSERT_NE(captureFile, nullptr);
+    EXPECT_EQ(captureFile->getCapacity(), SMALL_CAPACITY);
+
+    EXPECT_TRUE(captureFile->append(ProtocolCaptureFile::RecordType::DIRECTIVE, "contextId1", "Directive1"));
+    EXPECT_TRUE(captureFile->append(ProtocolCaptureFile::RecordType::DIRECTIVE, "contextId2", "Directive2"));
+    EXPECT_TRUE(captureFile->append(ProtocolCaptureFile::RecordType::EVENT, "", "Event1"));
+
+    ProtocolCaptureFile::Capture capture;
+    ASSERT_TRUE(ProtocolCaptureFile::read(m_captureFilePath, &capture));
+    ASSERT_EQ(capture.records.size(), 3u);
+    EXPECT_EQ(capture.droppedRecords, 0u);
+    EXPECT_EQ(capture.records[0].type, ProtocolCaptureFile::RecordType::DIRECTIVE);
+    EXPECT_EQ(capture.records[0].contextId, "contextId1");
+    EXPECT_EQ(capture.records[0].content, "Directive1");
+    EXPECT_EQ(capture.records[1].type, ProtocolCaptureFile::RecordType::DIRECTIVE);
+    EXPECT_EQ(capture.records[1].contextId, "contextId2");
+    EXPECT_EQ(capture.records[1].content, "Directive2");
+    EXPECT_EQ(capture.records[2].type, ProtocolCaptureFile::RecordType::EVENT);
+    EXPECT_EQ(capture.records[2].content, "Event1");
+    for (size_t i = 0; i < capture.records.size(); ++i) {
+        EXPECT_EQ(capture.records[i].sequence, i);
+        if (i > 0) {
+            EXPECT_GE(capture.records[i].timestamp, capture.records[i - 1].timestamp);
+        }
+    }
+}
+
+/**
+ * Test that the records are readable while the capture is still open, as they would be after a crash.
+ */
+TEST_F(ProtocolCaptureFileTest, test_recordsAreReadableWhileCaptureIsOpen) {
+    auto captureFile = ProtocolCaptureFile::create(m_captureFilePath, SMALL_CAPACITY);
+    ASSERT_NE(captureFile, nullptr);
+    captureFile->append(ProtocolCaptureFile::RecordType::DIRECTIVE, "contextId1", "Directive1");
+
+    ProtocolCaptureFile::Capture capture;
+    ASSERT_TRUE(ProtocolCaptureFile::read(m_captureFilePath, &capture));
+    ASSERT_EQ(capture.records.size(), 1u);
+    EXPECT_EQ(capture.records[0].content, "Directive1");
+}
+
+/**
+ * Test that a full ring keeps the newest records, without gaps.
+ */
+TEST_F(ProtocolCaptureFileTest, test_wrapAroundKeepsNewestRecords) {
+    const size_t recordCount = 500;
+    auto captureFile = ProtocolCaptureFile::create(m_captureFilePath, SMALL_CAPACITY);
+    ASSERT_NE(captureFile, nullptr);
+    for (size_t i = 0; i < recordCount; ++i) {
+        // Varying sizes make records straddle the end of the ring.
+        std::string content = "Directive" + std::to_string(i) + std::string(i % 37, 'x');
+        ASSERT_TRUE(captureFile->append(ProtocolCaptureFile::RecordType::DIRECTIVE, std::to_string(i), content));
+    }
+
+    ProtocolCaptureFile::Capture capture;
+    ASSERT_TRUE(ProtocolCaptureFile::read(m_captureFilePath, &capture));
+    ASSERT_GT(capture.records.size(), 10u);
+    ASSERT_LT(capture.records.size(), recordCount);
+    EXPECT_EQ(capture.records.back().sequence, recordCount - 1);
+    for (size_t i = 1; i < capture.records.size(); ++i) {
+        EXPECT_EQ(capture.records[i].sequence, capture.records[i - 1].sequence + 1);
+    }
+    for (const auto& record : capture.records) {
+        EXPECT_EQ(record.contextId, std::to_string(record.sequence));
+        EXPECT_EQ(record.content, "Directive" + record.contextId + std::string(record.sequence % 37, 'x'));
+    }
+}
+
+/**
+ * Test that a torn record is skipped, and the records after it are still read.
+ */
+TEST_F(ProtocolCaptureFileTest, test_tornRecordIsSkipped) {
+    {
+        auto captureFile = ProtocolCaptureFile::create(m_captureFilePath, SMALL_CAPACITY);
+        ASSERT_NE(captureFile, nullptr);
+        // Each record is 48 bytes of header plus 13 bytes of content, padded to 64 bytes.
+        captureFile->append(ProtocolCaptureFile::RecordType::DIRECTIVE, "c0", "directive-0");
+        captureFile->append(ProtocolCaptureFile::RecordType::DIRECTIVE, "c1", "directive-1");
+        captureFile->append(ProtocolCaptureFile::RecordType::DIRECTIVE, "c2", "directive-2");
+    }
+
+    {
+        std::fstream file(m_captureFilePath, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(FILE_HEADER_SIZE + 64 + RECORD_HEADER_SIZE);
+        file.put('X');
+    }
+
+    ProtocolCaptureFile::Capture capture;
+    ASSERT_TRUE(ProtocolCaptureFile::read(m_captureFilePath, &capture));
+    ASSERT_EQ(capture.records.size(), 2u);
+    EXPECT_EQ(capture.records[0].contextId, "c0");
+    EXPECT_EQ(capture.records[1].contextId, "c2");
+}
+
+/**
+ * Test that records too large for the ring are dropped and counted.
+ */
+TEST_F(ProtocolCaptureFileTest, test_tooLargeRecordIsDropped) {
+    auto captureFile = ProtocolCaptureFile::create(m_captureFilePath, SMALL_CAPACITY);
+    ASSERT_NE(captureFile, nullptr);
+    EXPECT_FALSE(captureFile->append(ProtocolCaptureFile::RecordType::EVENT, "", std::string(SMALL_CAPACITY, 'x')));
+    EXPECT_TRUE(captureFile->append(ProtocolCaptureFile::RecordType::EVENT, "", "Event1"));
+
+    ProtocolCaptureFile::Capture capture;
+    ASSERT_TRUE(ProtocolCaptureFile::read(m_captureFilePath, &capture));
+    EXPECT_EQ(capture.droppedRecords, 1u);
+    ASSERT_EQ(capture.records.size(), 1u);
+    EXPECT_EQ(capture.records[0].content, "Event1");
+}
+
+/**
+ * Test that records appended from several threads at once are all captured.
+ */
+TEST_F(ProtocolCaptureFileTest, test_concurrentAppends) {
+    const size_t threadCount = 4;
+    const size_t recordsPerThread = 1000;
+    auto captureFile = ProtocolCaptureFile::create(m_captureFilePath, 1024 * 1024);
+    ASSERT_NE(captureFile, nullptr);
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&captureFile, t, recordsPerThread] {
+            for (size_t i = 0; i < recordsPerThread; ++i) {
+                captureFile->append(
+                    ProtocolCaptureFile::RecordType::EVENT, std::to_string(t), "Event" + std::to_string(i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ProtocolCaptureFile::Capture capture;
+    ASSERT_TRUE(ProtocolCaptureFile::read(m_captureFilePath, &capture));
+    ASSERT_EQ(capture.records.size(), threadCount * recordsPerThread);
+    std::set<std::string> seen;
+    for (size_t i = 0; i < capture.records.size(); ++i) {
+        EXPECT_EQ(capture.records[i].sequence, i);
+        seen.insert(capture.records[i].contextId + "/" + capture.records[i].content);
+    }
+    EXPECT_EQ(seen.size(), threadCount * recordsPerThread);
+}
+
+/**
+ * Test that creating a capture keeps the previous capture, and that invalid files and capacities are rejected.
+ */
+TEST_F(ProtocolCaptureFileTest, test_createKeepsPreviousCapture) {
+    EXPECT_EQ(ProtocolCaptureFile::create(m_captureFilePath, 100), nullptr);
+
+    auto captureFile = ProtocolCaptureFile::create(m_captureFilePath, SMALL_CAPACITY);
+    ASSERT_NE(captureFile, nullptr);
+    captureFile->append(ProtocolCaptureFile::RecordType::DIRECTIVE, "contextId1", "Directive1");
+    captureFile = ProtocolCaptureFile::create(m_captureFilePath, SMALL_CAPACITY);
+    ASSERT_NE(captureFile, nullptr);
+
+    ProtocolCaptureFile::Capture capture;
+    ASSERT_TRUE(ProtocolCaptureFile::read(m_previousCaptureFilePath, &capture));
+    ASSERT_EQ(capture.records.size(), 1u);
+    ASSERT_TRUE(ProtocolCaptureFile::read(m_captureFilePath, &capture));
+    EXPECT_TRUE(capture.records.empty());
+
+    {
+        std::ofstream file(m_previousCaptureFilePath, std::ios::binary | std::ios::trunc);
+        file << "not a capture file";
+    }
+    EXPECT_FALSE(ProtocolCaptureFile::read(m_previousCaptureFilePath, &capture));
+}
+
+/**
+ * Test that the @c DeviceProtocolTracer captures directives and events even when the protocol trace is disabled, and
+ * that its capture file can be replaced.
+ */
+TEST_F(ProtocolCaptureFileTest, test_deviceProtocolTracerAppendsToCapture) {
+    auto captureFile = ProtocolCaptureFile::create(m_captureFilePath, SMALL_CAPACITY);
+    auto tracer = DeviceProtocolTracer::create(captureFile);
+    tracer->receive("contextId1", "Directive1");
+    tracer->traceEvent("Event1");
+    EXPECT_EQ(tracer->getProtocolTrace(), "[]");
+
+    ProtocolCaptureFile::Capture capture;
+    ASSERT_TRUE(ProtocolCaptureFile::read(m_captureFilePath, &capture));
+    ASSERT_EQ(capture.records.size(), 2u);
+    EXPECT_EQ(capture.records[0].type, ProtocolCaptureFile::RecordType::DIRECTIVE);
+    EXPECT_EQ(capture.records[0].contextId, "contextId1");
+    EXPECT_EQ(capture.records[1].type, ProtocolCaptureFile::RecordType::EVENT);
+
+    tracer->setCaptureFile(ProtocolCaptureFile::create(m_captureFilePath, SMALL_CAPACITY));
+    tracer->receive("contextId2", "Directive2");
+    tracer->setCaptureFile(nullptr);
+    tracer->traceEvent("Event2");
+    ASSERT_TRUE(ProtocolCaptureFile::read(m_captureFilePath, &capture));
+    ASSERT_EQ(capture.records.size(), 1u);
+    EXPECT_EQ(capture.records[0].content, "Directive2");
+}
+
+/**
+ * Test that the replayer passes the directives in order at the requested speed.
+ */
+TEST_F(ProtocolCaptureFileTest, test_replayerKeepsScaledTiming) {
+    ProtocolCaptureFile::Capture capture;
+    auto addRecord = [&capture](ProtocolCaptureFile::RecordType type, int milliseconds, const std::string& id) {
+        ProtocolCaptureFile::Record record;
+        record.type = type;
+        record.sequence = capture.records.size();
+        record.timestamp = std::chrono::milliseconds(milliseconds);
+        record.contextId = id;
+        record.content = "Directive" + id;
+        capture.records.push_back(record);
+    };
+    addRecord(ProtocolCaptureFile::RecordType::DIRECTIVE, 1000, "1");
+    addRecord(ProtocolCaptureFile::RecordType::EVENT, 1100, "");
+    addRecord(ProtocolCaptureFile::RecordType::DIRECTIVE, 1200, "2");
+    addRecord(ProtocolCaptureFile::RecordType::DIRECTIVE, 1400, "3");
+
+    auto observer = std::make_shared<StrictMock<MockMessageObserver>>();
+    auto replayer = ProtocolCaptureReplayer::create(observer);
+    ASSERT_NE(replayer, nullptr);
+    EXPECT_EQ(ProtocolCaptureReplayer::create(nullptr), nullptr);
+
+    {
+        InSequence sequence;
+        EXPECT_CALL(*observer, receive("1", "Directive1"));
+        EXPECT_CALL(*observer, receive("2", "Directive2"));
+        EXPECT_CALL(*observer, receive("3", "Directive3"));
+    }
+    auto start = std::chrono::steady_clock::now();
+    auto result = replayer->replay(capture, 2.0);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_GE(elapsed, std::chrono::milliseconds(200));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(380));
+    EXPECT_EQ(result.directives, 3u);
+    EXPECT_EQ(result.events, 1u);
+    EXPECT_FALSE(result.stopped);
+
+    EXPECT_CALL(*observer, receive(_, _)).Times(3);
+    start = std::chrono::steady_clock::now();
+    replayer->replay(capture, 0);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+}
+
+/**
+ * Test that a replay in progress can be stopped.
+ */
+TEST_F(ProtocolCaptureFileTest, test_replayerStop) {
+    ProtocolCaptureFile::Capture capture;
+    for (int i = 0; i < 2; ++i) {
+        ProtocolCaptureFile::Record record;
+        record.type = ProtocolCaptureFile::RecordType::DIRECTIVE;
+        record.sequence = i;
+        record.timestamp = std::chrono::seconds(10 * i);
+        capture.records.push_back(record);
+    }
+
+    auto observer = std::make_shared<NiceMock<MockMessageObserver>>();
+    auto replayer = ProtocolCaptureReplayer::create(observer);
+    std::thread stopThread([&replayer] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        replayer->stop();
+    });
+    auto result = replayer->replay(capture);
+    stopThread.join();
+    EXPECT_TRUE(result.stopped);
+    EXPECT_EQ(result.directives, 1u);
+}
+
+}  // namespace test
+}  // namespace diagnostics
+}  // namespace alexaClientSDK
@@ -0,0 +1,105 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <ADSL/DirectiveSequencer.h>
+#include <ADSL/MessageInterpreter.h>
+#include <AVSCommon/AVS/Attachment/AttachmentManager.h>
+#include <AVSCommon/SDKInterfaces/ExceptionEncounteredSenderInterface.h>
+#include <Diagnostics/ProtocolCaptureFile.h>
+#include <Diagnostics/ProtocolCaptureReplayer.h>
+
+using namespace alexaClientSDK;
+using namespace alexaClientSDK::avsCommon;
+using namespace alexaClientSDK::diagnostics;
+
+/**
+ * An @c ExceptionEncounteredSenderInterface which prints the exceptions instead of sending them to AVS. Without
+ * directive handlers, this reports every directive the @c DirectiveSequencer receives.
+ */
+class PrintingExceptionSender : public sdkInterfaces::ExceptionEncounteredSenderInterface {
+public:
+    void sendExceptionEncountered(
+        const std::string& unparsedDirective,
+        avs::ExceptionErrorType error,
+        const std::string& errorDescription) override {
+        std::cout << "exception: " << error << " " << errorDescription << std::endl;
+    }
+};
+
+/**
+ * Print how to run this program.
+ *
+ * @param program The name of this program.
+ */
+static void printUsage(const std::string& program) {
+    std::cerr << "USAGE: " << program << " <captureFile> [speed]" << std::endl
+              << "  speed: how many times faster than recorded to replay, 0 for as fast as possible (default 1)"
+              << std::endl;
+}
+
+/**
+ * Replay a protocol capture file into a @c MessageInterpreter, then print what the replay did.
+ *
+ * @param argc The number of elements in the @c argv array.
+ * @param argv The program name, the path of the capture file and optionally the replay speed.
+ * @return @c EXIT_FAILURE if the capture file could not be read, else @c EXIT_SUCCESS.
+ */
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 3) {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    double speed = 1.0;
+    if (3 == argc) {
+        char* end = nullptr;
+        speed = std::strtod(argv[2], &end);
+        if (end == argv[2] || *end != '\0' || speed < 0) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    ProtocolCaptureFile::Capture capture;
+    if (!ProtocolCaptureFile::read(argv[1], &capture)) {
+        std::cerr << "Unable to read " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "records: " << capture.records.size() << ", dropped while capturing: " << capture.droppedRecords
+              << std::endl;
+
+    auto exceptionSender = std::make_shared<PrintingExceptionSender>();
+    std::shared_ptr<sdkInterfaces::DirectiveSequencerInterface> directiveSequencer =
+        adsl::DirectiveSequencer::create(exceptionSender);
+    auto attachmentManager = avs::attachment::AttachmentManager::createInProcessAttachmentManagerInterface();
+    auto messageInterpreter =
+        std::make_shared<adsl::MessageInterpreter>(exceptionSender, directiveSequencer, attachmentManager);
+
+    auto replayer = ProtocolCaptureReplayer::create(messageInterpreter);
+    auto start = std::chrono::steady_clock::now();
+    auto result = replayer->replay(capture, speed);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    directiveSequencer->shutdown();
+
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+    auto maxLatenessUs = std::chrono::duration_cast<std::chrono::microseconds>(result.maxLateness).count();
+    std::cout << "directives: " << result.directives << ", events: " << result.events << std::endl
+              << "elapsed: " << elapsedMs << " ms, max lateness: " << maxLatenessUs << " us" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -21,6 +21,7 @@
 #include <gst/gst.h>
 #include <gst/app/gstappsrc.h>
 
+#include <AVSCommon/AVS/Attachment/ChunkedAttachmentReader.h>
 #include <AVSCommon/Utils/MediaPlayer/MediaPlayerInterface.h>
 
 #include "MediaPlayer/BaseStreamSource.h"
@@ -78,10 +79,32 @@ private:
     void doShutdown() override{};
     /// @}
 
+    /**
+     * Read data from @c m_reader into a newly allocated @c GstBuffer.
+     *
+     * @param[out] size The number of bytes read.
+     * @param[out] status The status of the read.
+     * @return The buffer holding the data read, or @c nullptr if a buffer could not be allocated.
+     */
+    GstBuffer* readCopiedBuffer(size_t* size, avsCommon::avs::attachment::AttachmentReader::ReadStatus* status);
+
+    /**
+     * Read a chunk from @c m_chunkedReader and wrap it in a @c GstBuffer without copying it.  The buffer keeps the
+     * chunk alive until GStreamer releases it.
+     *
+     * @param[out] size The number of bytes read.
+     * @param[out] status The status of the read.
+     * @return The buffer holding the data read, or @c nullptr if a buffer could not be allocated.
+     */
+    GstBuffer* readChunkedBuffer(size_t* size, avsCommon::avs::attachment::AttachmentReader::ReadStatus* status);
+
 private:
     /// The @c AttachmentReader to read audioData from.
     std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> m_reader;
 
+    /// @c m_reader if it reads from a @c ChunkedAttachment, which allows reading without copying, or @c nullptr.
+    avsCommon::avs::attachment::ChunkedAttachmentReader* m_chunkedReader;
+
     /// Indicates whether to play from the audio source in a loop.
     const bool m_repeat;
 };
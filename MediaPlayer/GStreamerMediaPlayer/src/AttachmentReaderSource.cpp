@@ -14,6 +14,7 @@
  */
 
 #include <cstring>
+#include <limits>
 
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/AVS/Attachment/AttachmentReader.h>
@@ -40,6 +41,21 @@ using namespace avsCommon::avs::attachment;
 /// The number of bytes read from the attachment with each read in the read loop.
 static const unsigned int CHUNK_SIZE(4096);
 
+/**
+ * The maximum number of bytes taken from a @c ChunkedAttachmentReader with each read in the read loop.  Chunks are not
+ * copied, so they are passed on whole.
+ */
+static const size_t MAX_CHUNKED_READ_SIZE = std::numeric_limits<size_t>::max();
+
+/**
+ * @c GDestroyNotify releasing the reference to a chunk held by a @c GstBuffer.
+ *
+ * @param chunkData The @c std::shared_ptr to the chunk's data allocated by @c readChunkedBuffer().
+ */
+static void releaseChunk(gpointer chunkData) {
+    delete static_cast<std::shared_ptr<const std::vector<uint8_t>>*>(chunkData);
+}
+
 std::unique_ptr<AttachmentReaderSource> AttachmentReaderSource::create(
     PipelineInterface* pipeline,
     std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> attachmentReader,
@@ -62,6 +78,7 @@ AttachmentReaderSource::AttachmentReaderSource(
     bool repeat) :
         BaseStreamSource{pipeline, "AttachmentReaderSource"},
         m_reader{reader},
+        m_chunkedReader{dynamic_cast<ChunkedAttachmentReader*>(reader.get())},
         m_repeat{repeat} {};
 
 bool AttachmentReaderSource::isPlaybackRemote() const {
@@ -76,6 +93,7 @@ void AttachmentReaderSource::close() {
     if (m_reader) {
         m_reader->close();
     }
+    m_chunkedReader = nullptr;
     m_reader.reset();
 }
 
@@ -85,35 +103,14 @@ gboolean AttachmentReaderSource::handleReadData() {
         return false;
     }
 
-    auto buffer = gst_buffer_new_allocate(nullptr, CHUNK_SIZE, nullptr);
-
+    auto status = AttachmentReader::ReadStatus::OK;
+    size_t size = 0;
+    auto buffer = m_chunkedReader ? readChunkedBuffer(&size, &status) : readCopiedBuffer(&size, &status);
     if (!buffer) {
-        ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "gstBufferNewAllocateFailed"));
         signalEndOfData();
         return false;
     }
 
-    GstMapInfo info;
-    if (!gst_buffer_map(buffer, &info, GST_MAP_WRITE)) {
-        ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "gstBufferMapFailed"));
-        gst_buffer_unref(buffer);
-        signalEndOfData();
-        return false;
-    }
-
-    ACSDK_DEBUG9(LX("beforeRead").d("size", info.size));
-
-    auto status = AttachmentReader::ReadStatus::OK;
-    auto size = m_reader->read(info.data, info.size, &status, std::chrono::milliseconds(1));
-
-    ACSDK_DEBUG9(LX("read").d("size", size).d("status", static_cast<int>(status)));
-
-    gst_buffer_unmap(buffer, &info);
-
-    if (size > 0 && size < info.size) {
-        gst_buffer_resize(buffer, 0, size);
-    }
-
     switch (status) {
         case AttachmentReader::ReadStatus::CLOSED:
             if (0 == size) {
@@ -156,12 +153,78 @@ gboolean AttachmentReaderSource::handleReadData() {
         return false;
     }
 
-    m_reader->seek(0);
     gst_buffer_unref(buffer);
+    if (!m_reader->seek(0)) {
+        // A chunked reader cannot seek back to data it has already released; stop rather than retrying forever.
+        ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "seekToStartFailed"));
+        signalEndOfData();
+        return false;
+    }
     updateOnReadDataHandler();
     return true;
 }
 
+GstBuffer* AttachmentReaderSource::readCopiedBuffer(size_t* size, AttachmentReader::ReadStatus* status) {
+    auto buffer = gst_buffer_new_allocate(nullptr, CHUNK_SIZE, nullptr);
+
+    if (!buffer) {
+        ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "gstBufferNewAllocateFailed"));
+        return nullptr;
+    }
+
+    GstMapInfo info;
+    if (!gst_buffer_map(buffer, &info, GST_MAP_WRITE)) {
+        ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "gstBufferMapFailed"));
+        gst_buffer_unref(buffer);
+        return nullptr;
+    }
+
+    ACSDK_DEBUG9(LX("beforeRead").d("size", info.size));
+
+    *size = m_reader->read(info.data, info.size, status, std::chrono::milliseconds(1));
+
+    ACSDK_DEBUG9(LX("read").d("size", *size).d("status", static_cast<int>(*status)));
+
+    gst_buffer_unmap(buffer, &info);
+
+    if (*size > 0 && *size < info.size) {
+        gst_buffer_resize(buffer, 0, *size);
+    }
+
+    return buffer;
+}
+
+GstBuffer* AttachmentReaderSource::readChunkedBuffer(size_t* size, AttachmentReader::ReadStatus* status) {
+    auto chunk = m_chunkedReader->readChunk(MAX_CHUNKED_READ_SIZE, status, std::chrono::milliseconds(1));
+    *size = chunk.size;
+
+    ACSDK_DEBUG9(LX("readChunk").d("size", chunk.size).d("status", static_cast<int>(*status)));
+
+    if (!chunk.data) {
+        // Nothing was read; an empty buffer lets handleReadData() treat this like an empty copying read.
+        auto buffer = gst_buffer_new();
+        if (!buffer) {
+            ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "gstBufferNewFailed"));
+        }
+        return buffer;
+    }
+
+    auto chunkData = new std::shared_ptr<const std::vector<uint8_t>>(chunk.data);
+    auto buffer = gst_buffer_new_wrapped_full(
+        GST_MEMORY_FLAG_READONLY,
+        const_cast<uint8_t*>(chunk.data->data()),
+        chunk.data->size(),
+        chunk.offset,
+        chunk.size,
+        chunkData,
+        releaseChunk);
+    if (!buffer) {
+        ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "gstBufferNewWrappedFullFailed"));
+        delete chunkData;
+    }
+    return buffer;
+}
+
 gboolean AttachmentReaderSource::handleSeekData(guint64 offset) {
     ACSDK_DEBUG9(LX("handleSeekData").d("offset", offset));
     if (m_reader) {
@@ -17,6 +17,7 @@
 #include <chrono>
 #include <condition_variable>
 #include <fstream>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -26,6 +27,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <AVSCommon/AVS/Attachment/ChunkedAttachment.h>
 #include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
 #include <AVSCommon/AVS/SpeakerConstants/SpeakerConstants.h>
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
@@ -1164,6 +1166,32 @@ TEST_P(MediaPlayerTest, testSlow_repeatAttachment) {
     }
 }
 
+/**
+ * Test that a @c ChunkedAttachment, whose chunks are passed to GStreamer without copying, plays to the end.
+ */
+TEST_P(MediaPlayerTest, testSlow_playChunkedAttachment) {
+    std::ifstream file(inputsDirPath + MP3_FILE_PATH, std::ifstream::binary);
+    ASSERT_TRUE(file.good());
+    std::vector<char> content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    ASSERT_FALSE(content.empty());
+
+    auto attachment = std::make_shared<ChunkedAttachment>("chunked");
+    auto writer = attachment->createWriter();
+    ASSERT_TRUE(writer);
+    AttachmentWriter::WriteStatus writeStatus;
+    ASSERT_EQ(writer->write(content.data(), content.size(), &writeStatus), content.size());
+    writer->close();
+    std::shared_ptr<AttachmentReader> reader =
+        attachment->createReader(avsCommon::utils::sds::ReaderPolicy::NONBLOCKING);
+    ASSERT_TRUE(reader);
+
+    auto sourceId = m_mediaPlayer->setSource(reader);
+    ASSERT_NE(ERROR_SOURCE_ID, sourceId);
+    ASSERT_TRUE(m_mediaPlayer->play(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackFinished(sourceId));
+}
+
 /**
  * Test that the media plays after a volume change.
  */
@@ -15,11 +15,19 @@
 #ifndef ALEXA_CLIENT_SDK_METRICS_METRICRECORDER_INCLUDE_METRICS_METRICRECORDER_H_
 #define ALEXA_CLIENT_SDK_METRICS_METRICRECORDER_INCLUDE_METRICS_METRICRECORDER_H_
 
-#include <unordered_set>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
+#include <AVSCommon/Utils/Metrics/BinaryMetricSinkInterface.h>
+#include <AVSCommon/Utils/Metrics/MetricRecord.h>
 #include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <AVSCommon/Utils/Metrics/MetricSinkInterface.h>
-#include <AVSCommon/Utils/Threading/Executor.h>
+#include <AVSCommon/Utils/Threading/PerThreadRingBuffers.h>
 
 namespace alexaClientSDK {
 namespace metrics {
@@ -27,9 +35,27 @@ namespace implementations {
 
 /**
  * This class implements the interface for recording metrics to sinks.
+ *
+ * Recording a metric does not take any lock: the metric is appended to a single producer / single consumer ring
+ * buffer owned by the calling thread, and a background thread drains the ring buffers and delivers the metrics to all
+ * sinks in batches of up to @c MAX_BATCH_SIZE.  Metrics recorded as @c MetricRecord are copied into the ring buffer
+ * without any allocation.
+ *
+ * @c MetricSinkInterface sinks receive every metric as a @c MetricEvent, through @c consumeMetrics().
+ * @c BinaryMetricSinkInterface sinks receive the metrics recorded as @c MetricRecord only.
+ *
+ * Every ring buffer holds up to a fixed number of metrics, and allocates its storage in small segments as it first
+ * fills up, so that threads which record few metrics use little memory.  When it is full, metrics are dropped rather
+ * than blocking the recording thread; dropped metrics are counted (see @c getDroppedCount()) and reported in the log.
  */
 class MetricRecorder : public avsCommon::utils::metrics::MetricRecorderInterface {
 public:
+    /// Default number of metrics each per-thread ring buffer can hold.
+    static const size_t DEFAULT_RING_BUFFER_CAPACITY;
+
+    /// Maximum number of metrics delivered to a sink in one call.
+    static const size_t MAX_BATCH_SIZE;
+
     /**
      * Create a MetricRecorder.
      *
@@ -40,9 +66,17 @@ public:
         std::unique_ptr<alexaClientSDK::avsCommon::utils::metrics::MetricSinkInterface> sink);
 
     /**
-     * Destructor
+     * Constructor.
+     *
+     * @param ringBufferCapacity The number of metrics each per-thread ring buffer can hold.  Rounded up to a power of
+     *     two.
      */
-    virtual ~MetricRecorder() = default;
+    explicit MetricRecorder(size_t ringBufferCapacity = DEFAULT_RING_BUFFER_CAPACITY);
+
+    /**
+     * Destructor.  Delivers all buffered metrics before returning.
+     */
+    virtual ~MetricRecorder();
 
     /**
      * Function adds sinks to the metric recorder
@@ -53,17 +87,98 @@ public:
      */
     bool addSink(std::unique_ptr<alexaClientSDK::avsCommon::utils::metrics::MetricSinkInterface> sink);
 
+    /**
+     * Adds a sink which consumes metrics in their binary form.
+     *
+     * @param sink The sink being added to the metric recorder.
+     * @return Whether the sink was added.
+     */
+    bool addBinarySink(std::unique_ptr<alexaClientSDK::avsCommon::utils::metrics::BinaryMetricSinkInterface> sink);
+
     /// @name Overridden MetricRecorderInterface method.
     /// @{
     void recordMetric(std::shared_ptr<alexaClientSDK::avsCommon::utils::metrics::MetricEvent> metricEvent) override;
+    void recordBinaryMetric(const alexaClientSDK::avsCommon::utils::metrics::MetricRecord& record) override;
     /// @}
 
+    /**
+     * Synchronously deliver all metrics which have been recorded so far.
+     */
+    void flush();
+
+    /**
+     * Get the number of metrics which were dropped because a ring buffer was full.
+     *
+     * @return The number of dropped metrics.
+     */
+    uint64_t getDroppedCount() const;
+
 private:
-    // Unordered set of sinks
-    std::unordered_set<std::unique_ptr<alexaClientSDK::avsCommon::utils::metrics::MetricSinkInterface>> m_sinks;
+    /// Forward declaration of the per-thread ring buffer.
+    class RingBuffer;
+
+    /**
+     * Notify the background thread after a metric has been appended to a ring buffer.
+     *
+     * @param appended Whether the metric was appended.
+     */
+    void onMetricPushed(bool appended);
+
+    /// The loop of the background thread.
+    void drainLoop();
+
+    /**
+     * Deliver the metrics of all ring buffers to the sinks.  Must be called with @c m_drainMutex held.
+     */
+    void drainLocked();
+
+    /**
+     * Deliver the batched metrics to the sinks and clear the batches.  Must be called with @c m_drainMutex held.
+     */
+    void deliverBatchesLocked();
+
+    /// Protects the sinks.
+    std::mutex m_sinksMutex;
+
+    /// The sinks which consume @c MetricEvents.
+    std::vector<std::unique_ptr<alexaClientSDK::avsCommon::utils::metrics::MetricSinkInterface>> m_sinks;
+
+    /// The sinks which consume @c MetricRecords.
+    std::vector<std::unique_ptr<alexaClientSDK::avsCommon::utils::metrics::BinaryMetricSinkInterface>>
+        m_binarySinks;
+
+    /// Whether any sink has been added.
+    std::atomic<bool> m_hasSinks;
+
+    /// The ring buffers of all threads which have recorded metrics through this recorder.
+    avsCommon::utils::threading::PerThreadRingBuffers<RingBuffer> m_ringBuffers;
+
+    /// Serializes draining between the background thread and @c flush().
+    std::mutex m_drainMutex;
+
+    /// Number of dropped metrics which have already been reported.
+    uint64_t m_reportedDrops;
+
+    /// The batch of @c MetricEvents being assembled for the @c MetricSinkInterface sinks.
+    std::vector<std::shared_ptr<alexaClientSDK::avsCommon::utils::metrics::MetricEvent>> m_eventBatch;
+
+    /// The batch of @c MetricRecords being assembled for the @c BinaryMetricSinkInterface sinks.
+    std::vector<alexaClientSDK::avsCommon::utils::metrics::MetricRecord> m_recordBatch;
+
+    /// Whether the background thread is waiting for metrics.
+    std::atomic<bool> m_drainThreadIdle;
+
+    /// Whether the background thread should exit.
+    bool m_stop;
+
+    /// Protects @c m_stop and is used with @c m_wakeCondition.
+    std::mutex m_wakeMutex;
+
+    /// Condition variable used to wake up the background thread.
+    std::condition_variable m_wakeCondition;
 
-    // Executor to perform asynchronous operation for recording metric
-    avsCommon::utils::threading::Executor m_executor;
+    /// The background thread.
+    std::thread m_drainThread;
 };
 
 }  // namespace implementations
@@ -12,8 +12,11 @@
  * express or implied. See the License for the specific language governing
  * permissions and limitations under the License.
  */
+
 #include "Metrics/MetricRecorder.h"
 
+#include <algorithm>
+
 #include <AVSCommon/Utils/Logger/LogEntry.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 
@@ -21,6 +24,8 @@ namespace alexaClientSDK {
 namespace metrics {
 namespace implementations {
 
+using namespace avsCommon::utils::metrics;
+
 /// String to identify log entries originating from this file.
 #define TAG "MetricRecorder"
 
@@ -31,6 +36,98 @@ namespace implementations {
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+const size_t MetricRecorder::DEFAULT_RING_BUFFER_CAPACITY = 256;
+
+const size_t MetricRecorder::MAX_BATCH_SIZE = 256;
+
+/// Number of slots a ring buffer allocates at a time, as it fills up.
+static const size_t SLOTS_PER_SEGMENT = 16;
+
+/// Smallest supported ring buffer capacity.
+static const size_t MIN_RING_BUFFER_CAPACITY = SLOTS_PER_SEGMENT;
+
+/**
+ * A single producer / single consumer ring buffer of metrics.  The producer is the thread which owns it, the consumer
+ * is whichever thread holds @c MetricRecorder::m_drainMutex.  The slots are allocated by the producer in segments of
+ * @c SLOTS_PER_SEGMENT as the buffer first fills up, so a thread which records few metrics only uses one segment.
+ */
+class MetricRecorder::RingBuffer : public avsCommon::utils::threading::PerThreadRingBuffer {
+public:
+    /**
+     * Constructor.
+     *
+     * @param capacity The number of metrics the buffer can hold; must be a power of two, and at least
+     *     @c SLOTS_PER_SEGMENT.
+     */
+    explicit RingBuffer(size_t capacity) : PerThreadRingBuffer(capacity), m_segments(capacity / SLOTS_PER_SEGMENT) {
+    }
+
+    /**
+     * Append a metric.  Called by the owning thread only.
+     *
+     * @param record The metric to append, if @c event is @c nullptr.
+     * @param event The metric to append, if not @c nullptr.
+     * @return Whether the metric was appended (@c false if it was dropped).
+     */
+    bool push(const MetricRecord& record, std::shared_ptr<MetricEvent> event) {
+        uint64_t head;
+        if (!beginPush(1, &head)) {
+            return false;
+        }
+        auto index = getOffset(head);
+        auto& segment = m_segments[index / SLOTS_PER_SEGMENT];
+        if (!segment) {
+            // Published to the consumer by the store to m_head below.
+            segment.reset(new Slot[SLOTS_PER_SEGMENT]);
+        }
+        auto& slot = segment[index % SLOTS_PER_SEGMENT];
+        if (event) {
+            slot.event = std::move(event);
+        } else {
+            slot.record = record;
+        }
+        endPush(head + 1);
+        return true;
+    }
+
+    /**
+     * Remove the oldest metric.  Called by the consumer only.
+     *
+     * @param[out] record Receives the metric, if it was recorded as a @c MetricRecord.
+     * @param[out] event Receives the metric if it was recorded as a @c MetricEvent, or @c nullptr otherwise.
+     * @return Whether a metric was removed.
+     */
+    bool pop(MetricRecord* record, std::shared_ptr<MetricEvent>* event) {
+        uint64_t tail;
+        if (!beginPop(&tail)) {
+            return false;
+        }
+        auto index = getOffset(tail);
+        auto& slot = m_segments[index / SLOTS_PER_SEGMENT][index % SLOTS_PER_SEGMENT];
+        if (slot.event) {
+            *event = std::move(slot.event);
+            slot.event.reset();
+        } else {
+            event->reset();
+            *record = slot.record;
+        }
+        endPop(tail + 1);
+        return true;
+    }
+
+private:
+    /// A slot of the ring buffer.
+    struct Slot {
+        /// The metric, if it was recorded as a @c MetricRecord.
+        MetricRecord record;
+        /// The metric if it was recorded as a @c MetricEvent, or @c nullptr.
+        std::shared_ptr<MetricEvent> event;
+    };
+
+    /// The storage of the ring buffer, in segments of @c SLOTS_PER_SEGMENT slots which are allocated on first use.
+    std::vector<std::unique_ptr<Slot[]>> m_segments;
+};
+
 std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> MetricRecorder::createMetricRecorderInterface(
     std::unique_ptr<alexaClientSDK::avsCommon::utils::metrics::MetricSinkInterface> sink) {
     if (!sink) {
@@ -41,13 +138,51 @@ std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> MetricRecord
     return recorder;
 }
 
+MetricRecorder::MetricRecorder(size_t ringBufferCapacity) :
+        m_hasSinks{false},
+        m_ringBuffers{avsCommon::utils::threading::roundUpToPowerOfTwo(
+            std::max(ringBufferCapacity, MIN_RING_BUFFER_CAPACITY))},
+        m_reportedDrops{0},
+        m_drainThreadIdle{false},
+        m_stop{false} {
+    m_eventBatch.reserve(MAX_BATCH_SIZE);
+    m_recordBatch.reserve(MAX_BATCH_SIZE);
+    m_drainThread = std::thread(&MetricRecorder::drainLoop, this);
+}
+
+MetricRecorder::~MetricRecorder() {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_stop = true;
+        m_wakeCondition.notify_one();
+    }
+    if (m_drainThread.joinable()) {
+        m_drainThread.join();
+    }
+}
+
 bool MetricRecorder::addSink(std::unique_ptr<alexaClientSDK::avsCommon::utils::metrics::MetricSinkInterface> sink) {
     if (!sink) {
         ACSDK_WARN(LX("addSinkFailed").d("reason", "nullSink"));
         return false;
     }
 
-    m_sinks.insert(std::move(sink));
+    std::lock_guard<std::mutex> lock(m_sinksMutex);
+    m_sinks.push_back(std::move(sink));
+    m_hasSinks = true;
+    return true;
+}
+
+bool MetricRecorder::addBinarySink(
+    std::unique_ptr<alexaClientSDK::avsCommon::utils::metrics::BinaryMetricSinkInterface> sink) {
+    if (!sink) {
+        ACSDK_WARN(LX("addBinarySinkFailed").d("reason", "nullSink"));
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_sinksMutex);
+    m_binarySinks.push_back(std::move(sink));
+    m_hasSinks = true;
     return true;
 }
 
@@ -57,18 +192,129 @@ void MetricRecorder::recordMetric(std::shared_ptr<alexaClientSDK::avsCommon::uti
         return;
     }
 
-    if (m_sinks.empty()) {
+    if (!m_hasSinks) {
         ACSDK_WARN(LX("emptySinks"));
         return;
     }
 
-    m_executor.execute([this, metricEvent]() {
-        for (const auto& sink : m_sinks) {
-            sink->consumeMetric(metricEvent);
+    onMetricPushed(m_ringBuffers.getThreadRingBuffer()->push(MetricRecord(), std::move(metricEvent)));
+}
+
+void MetricRecorder::recordBinaryMetric(const alexaClientSDK::avsCommon::utils::metrics::MetricRecord& record) {
+    if (record.getActivityName() == MetricNameRegistry::INVALID_ID) {
+        ACSDK_ERROR(LX("recordBinaryMetricFailed").d("reason", "noActivityName"));
+        return;
+    }
+
+    if (!m_hasSinks) {
+        ACSDK_WARN(LX("emptySinks"));
+        return;
+    }
+
+    onMetricPushed(m_ringBuffers.getThreadRingBuffer()->push(record, nullptr));
+}
+
+void MetricRecorder::flush() {
+    std::lock_guard<std::mutex> lock(m_drainMutex);
+    drainLocked();
+}
+
+uint64_t MetricRecorder::getDroppedCount() const {
+    return m_ringBuffers.getDroppedCount();
+}
+
+void MetricRecorder::onMetricPushed(bool appended) {
+    if (appended && m_drainThreadIdle.load() && m_drainThreadIdle.exchange(false)) {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_wakeCondition.notify_one();
+    }
+}
+
+void MetricRecorder::drainLoop() {
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(m_drainMutex);
+            drainLocked();
+        }
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        if (m_stop) {
+            break;
+        }
+        // Announce that we are about to sleep before the final check for metrics; a producer appends its metric
+        // before checking this flag, so either we see the metric or the producer sees the flag and wakes us up.
+        m_drainThreadIdle = true;
+        if (!m_ringBuffers.empty()) {
+            m_drainThreadIdle = false;
+            continue;
         }
-    });
+        m_wakeCondition.wait(lock, [this] { return !m_drainThreadIdle || m_stop; });
+    }
+
+    std::lock_guard<std::mutex> lock(m_drainMutex);
+    drainLocked();
+}
+
+void MetricRecorder::drainLocked() {
+    auto ringBuffers = m_ringBuffers.collect();
+
+    bool hasEventSinks;
+    bool hasBinarySinks;
+    {
+        std::lock_guard<std::mutex> lock(m_sinksMutex);
+        hasEventSinks = !m_sinks.empty();
+        hasBinarySinks = !m_binarySinks.empty();
+    }
+
+    MetricRecord record;
+    std::shared_ptr<MetricEvent> event;
+    for (auto& ringBuffer : ringBuffers) {
+        while (ringBuffer->pop(&record, &event)) {
+            if (!event) {
+                if (hasBinarySinks) {
+                    m_recordBatch.push_back(record);
+                }
+                if (hasEventSinks) {
+                    event = record.toMetricEvent();
+                }
+            }
+            if (event && hasEventSinks) {
+                m_eventBatch.push_back(std::move(event));
+            }
+            if (m_recordBatch.size() == MAX_BATCH_SIZE || m_eventBatch.size() == MAX_BATCH_SIZE) {
+                deliverBatchesLocked();
+            }
+        }
+    }
+    deliverBatchesLocked();
+
+    auto dropped = getDroppedCount();
+    if (dropped > m_reportedDrops) {
+        ACSDK_WARN(LX("metricsDropped").d("count", dropped - m_reportedDrops).d("total", dropped));
+        m_reportedDrops = dropped;
+    }
+}
+
+void MetricRecorder::deliverBatchesLocked() {
+    if (m_eventBatch.empty() && m_recordBatch.empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_sinksMutex);
+        if (!m_eventBatch.empty()) {
+            for (const auto& sink : m_sinks) {
+                sink->consumeMetrics(m_eventBatch);
+            }
+        }
+        if (!m_recordBatch.empty()) {
+            for (const auto& sink : m_binarySinks) {
+                sink->consumeMetrics(m_recordBatch.data(), m_recordBatch.size());
+            }
+        }
+    }
+    m_eventBatch.clear();
+    m_recordBatch.clear();
 }
 
 }  // namespace implementations
 }  // namespace metrics
-}  // namespace alexaClientSDK
\ No newline at end of file
+}  // namespace alexaClientSDK
@@ -0,0 +1,387 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Metrics/DataPointCounterBuilder.h>
+#include <AVSCommon/Utils/Metrics/DataPointStringBuilder.h>
+#include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
+#include <AVSCommon/Utils/Threading/Executor.h>
+#include <AVSCommon/Utils/WaitEvent.h>
+
+#include "Metrics/MetricRecorder.h"
+
+namespace alexaClientSDK {
+namespace metrics {
+namespace implementations {
+namespace test {
+
+using namespace ::testing;
+using namespace avsCommon::utils;
+using namespace avsCommon::utils::metrics;
+
+/// Timeout for events which are expected to happen.
+static const std::chrono::seconds TIMEOUT{2};
+
+/// Activity name used by the tests.
+static const std::string ACTIVITY_NAME = "MetricRecorderTest-ACTIVITY";
+
+/// Interned @c ACTIVITY_NAME.
+static const MetricNameId ACTIVITY_ID = MetricNameRegistry::intern(ACTIVITY_NAME);
+
+/// Name of the counter data point used by the tests.
+static const std::string SEQUENCE_NAME = "SEQUENCE";
+
+/// Interned @c SEQUENCE_NAME.
+static const MetricNameId SEQUENCE_ID = MetricNameRegistry::intern(SEQUENCE_NAME);
+
+/// Name of the data point which identifies the recording thread.
+static const MetricNameId THREAD_ID = MetricNameRegistry::intern("THREAD");
+
+/**
+ * A sink which stores the @c MetricEvents it receives.  The first delivery can be held back, to let metrics pile up
+ * in the recorder.
+ */
+class TestSink : public MetricSinkInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param holdFirstDelivery Whether the first delivery should wait for @c release().
+     */
+    explicit TestSink(bool holdFirstDelivery = false) : m_holdFirstDelivery{holdFirstDelivery}, m_batches{0} {
+    }
+
+    void consumeMetric(std::shared_ptr<MetricEvent> metricEvent) override {
+        consumeMetrics({metricEvent});
+    }
+
+    void consumeMetrics(const std::vector<std::shared_ptr<MetricEvent>>& metricEvents) override {
+        if (m_holdFirstDelivery) {
+            m_holdFirstDelivery = false;
+            m_deliveryStarted.wakeUp();
+            m_released.wait(TIMEOUT);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_batches;
+        m_maxBatchSize = std::max(m_maxBatchSize, metricEvents.size());
+        m_events.insert(m_events.end(), metricEvents.begin(), metricEvents.end());
+    }
+
+    /// Let the held back delivery proceed.
+    void release() {
+        m_released.wakeUp();
+    }
+
+    /// Whether the first delivery should be held back.
+    bool m_holdFirstDelivery;
+
+    /// Set when the held back delivery has started.
+    WaitEvent m_deliveryStarted;
+
+    /// Set to let the held back delivery proceed.
+    WaitEvent m_released;
+
+    /// Protects the members below.
+    std::mutex m_mutex;
+
+    /// Number of calls to @c consumeMetrics().
+    size_t m_batches;
+
+    /// Size of the largest batch.
+    size_t m_maxBatchSize = 0;
+
+    /// The events received.
+    std::vector<std::shared_ptr<MetricEvent>> m_events;
+};
+
+/// A sink which stores the @c MetricRecords it receives.
+class TestBinarySink : public BinaryMetricSinkInterface {
+public:
+    void consumeMetrics(const MetricRecord* records, size_t count) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_records.insert(m_records.end(), records, records + count);
+    }
+
+    /// Protects @c m_records.
+    std::mutex m_mutex;
+
+    /// The records received.
+    std::vector<MetricRecord> m_records;
+};
+
+/**
+ * Get the value of the @c SEQUENCE data point of an event.
+ *
+ * @param metricEvent The event.
+ * @return The value of the data point.
+ */
+static std::string getSequence(const std::shared_ptr<MetricEvent>& metricEvent) {
+    return metricEvent->getDataPoint(SEQUENCE_NAME, DataType::COUNTER).value().getValue();
+}
+
+/**
+ * Tests that no recorder is created without a sink.
+ */
+TEST(MetricRecorderTest, test_createWithNullSink) {
+    EXPECT_EQ(MetricRecorder::createMetricRecorderInterface(nullptr), nullptr);
+    MetricRecorder recorder;
+    EXPECT_FALSE(recorder.addSink(nullptr));
+    EXPECT_FALSE(recorder.addBinarySink(nullptr));
+}
+
+/**
+ * Tests that @c MetricEvents are delivered in order.
+ */
+TEST(MetricRecorderTest, test_recordMetricDeliversEvents) {
+    auto sink = new TestSink();
+    MetricRecorder recorder;
+    ASSERT_TRUE(recorder.addSink(std::unique_ptr<MetricSinkInterface>(sink)));
+
+    for (int i = 0; i < 3; ++i) {
+        recorder.recordMetric(
+            MetricEventBuilder{}
+                .setActivityName(ACTIVITY_NAME)
+                .addDataPoint(DataPointCounterBuilder{}.setName(SEQUENCE_NAME).increment(i).build())
+                .build());
+    }
+    recorder.flush();
+
+    ASSERT_EQ(sink->m_events.size(), 3u);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(getSequence(sink->m_events[i]), std::to_string(i));
+    }
+}
+
+/**
+ * Tests that @c MetricRecords are delivered as is to binary sinks and as @c MetricEvents to the other sinks, and
+ * that @c MetricEvents are not delivered to binary sinks.
+ */
+TEST(MetricRecorderTest, test_recordBinaryMetricDeliversToAllSinks) {
+    auto sink = new TestSink();
+    auto binarySink = new TestBinarySink();
+    MetricRecorder recorder;
+    ASSERT_TRUE(recorder.addSink(std::unique_ptr<MetricSinkInterface>(sink)));
+    ASSERT_TRUE(recorder.addBinarySink(std::unique_ptr<BinaryMetricSinkInterface>(binarySink)));
+
+    recorder.recordBinaryMetric(MetricRecord(ACTIVITY_ID).addCounter(SEQUENCE_ID, 0));
+    recorder.recordMetric(
+        MetricEventBuilder{}
+            .setActivityName(ACTIVITY_NAME)
+            .addDataPoint(DataPointCounterBuilder{}.setName(SEQUENCE_NAME).increment(1).build())
+            .build());
+    recorder.recordBinaryMetric(MetricRecord());
+    recorder.flush();
+
+    ASSERT_EQ(binarySink->m_records.size(), 1u);
+    EXPECT_EQ(binarySink->m_records[0].getActivityName(), ACTIVITY_ID);
+    EXPECT_EQ(binarySink->m_records[0].getNumericValue(0), 0u);
+
+    ASSERT_EQ(sink->m_events.size(), 2u);
+    EXPECT_EQ(sink->m_events[0]->getActivityName(), ACTIVITY_NAME);
+    EXPECT_EQ(getSequence(sink->m_events[0]), "0");
+    EXPECT_EQ(getSequence(sink->m_events[1]), "1");
+}
+
+/**
+ * Tests that metrics recorded while a delivery is in progress are delivered together in one batch.
+ */
+TEST(MetricRecorderTest, test_metricsAreDeliveredInBatches) {
+    auto sink = new TestSink(true);
+    MetricRecorder recorder;
+    ASSERT_TRUE(recorder.addSink(std::unique_ptr<MetricSinkInterface>(sink)));
+
+    recorder.recordBinaryMetric(MetricRecord(ACTIVITY_ID).addCounter(SEQUENCE_ID, 0));
+    ASSERT_TRUE(sink->m_deliveryStarted.wait(TIMEOUT));
+    for (int i = 1; i <= 100; ++i) {
+        recorder.recordBinaryMetric(MetricRecord(ACTIVITY_ID).addCounter(SEQUENCE_ID, i));
+    }
+    sink->release();
+    recorder.flush();
+
+    EXPECT_EQ(sink->m_batches, 2u);
+    ASSERT_EQ(sink->m_events.size(), 101u);
+    for (int i = 0; i <= 100; ++i) {
+        EXPECT_EQ(getSequence(sink->m_events[i]), std::to_string(i));
+    }
+    EXPECT_EQ(recorder.getDroppedCount(), 0u);
+}
+
+/**
+ * Tests that metrics are dropped and counted, rather than blocking, when the ring buffer of a thread is full.
+ */
+TEST(MetricRecorderTest, test_metricsAreDroppedWhenRingBufferIsFull) {
+    const size_t capacity = 16;
+    const size_t extraMetrics = 24;
+    auto sink = new TestSink(true);
+    MetricRecorder recorder(capacity);
+    ASSERT_TRUE(recorder.addSink(std::unique_ptr<MetricSinkInterface>(sink)));
+
+    recorder.recordBinaryMetric(MetricRecord(ACTIVITY_ID));
+    ASSERT_TRUE(sink->m_deliveryStarted.wait(TIMEOUT));
+    for (size_t i = 0; i < capacity + extraMetrics; ++i) {
+        recorder.recordBinaryMetric(MetricRecord(ACTIVITY_ID));
+    }
+    EXPECT_EQ(recorder.getDroppedCount(), extraMetrics);
+    sink->release();
+    recorder.flush();
+
+    EXPECT_EQ(sink->m_events.size(), 1 + capacity);
+}
+
+/**
+ * Tests that metrics are delivered in order as the ring buffer wraps around several times across its segments.
+ */
+TEST(MetricRecorderTest, test_ringBufferWrapsAcrossSegments) {
+    const size_t capacity = 64;
+    const size_t metricsPerRound = 40;
+    const size_t rounds = 5;
+    auto binarySink = new TestBinarySink();
+    MetricRecorder recorder(capacity);
+    ASSERT_TRUE(recorder.addBinarySink(std::unique_ptr<BinaryMetricSinkInterface>(binarySink)));
+
+    for (size_t i = 0; i < metricsPerRound * rounds; ++i) {
+        recorder.recordBinaryMetric(MetricRecord(ACTIVITY_ID).addCounter(SEQUENCE_ID, i));
+        if ((i + 1) % metricsPerRound == 0) {
+            recorder.flush();
+        }
+    }
+
+    EXPECT_EQ(recorder.getDroppedCount(), 0u);
+    ASSERT_EQ(binarySink->m_records.size(), metricsPerRound * rounds);
+    for (size_t i = 0; i < binarySink->m_records.size(); ++i) {
+        EXPECT_EQ(binarySink->m_records[i].getNumericValue(0), i);
+    }
+}
+
+/**
+ * Tests that metrics recorded concurrently by several threads are all delivered, in order for each thread.
+ */
+TEST(MetricRecorderTest, test_recordFromMultipleThreads) {
+    const int threadCount = 4;
+    const int metricsPerThread = 500;
+    auto binarySink = new TestBinarySink();
+    MetricRecorder recorder;
+    ASSERT_TRUE(recorder.addBinarySink(std::unique_ptr<BinaryMetricSinkInterface>(binarySink)));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&recorder, t] {
+            for (int i = 0; i < metricsPerThread; ++i) {
+                recorder.recordBinaryMetric(
+                    MetricRecord(ACTIVITY_ID).addCounter(THREAD_ID, t).addCounter(SEQUENCE_ID, i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    recorder.flush();
+
+    ASSERT_EQ(
+        binarySink->m_records.size() + recorder.getDroppedCount(),
+        static_cast<size_t>(threadCount * metricsPerThread));
+    std::vector<int64_t> lastSequence(threadCount, -1);
+    for (const auto& record : binarySink->m_records) {
+        auto thread = record.getNumericValue(0);
+        auto sequence = static_cast<int64_t>(record.getNumericValue(1));
+        EXPECT_GT(sequence, lastSequence[thread]);
+        lastSequence[thread] = sequence;
+    }
+}
+
+/**
+ * Measures the cost for the recording thread of recording the metric of a received directive, as done by
+ * @c MessageInterpreter::receive(), with the previous design (one task per metric posted to an @c Executor), with a
+ * @c MetricEvent, and with a @c MetricRecord.
+ */
+TEST(MetricRecorderTest, testSlow_recordMetricCost) {
+    const int iterations = 100000;
+    const std::string stream = "AVSEvent-12";
+    const std::string messageId = "5a7e5f4c-35d4-4a9a-9b1e-3f0c6a4b2d11";
+    const MetricNameId parseCompleteId = MetricNameRegistry::intern("PARSE_COMPLETE");
+    const MetricNameId streamId = MetricNameRegistry::intern("HTTP2_STREAM");
+    const MetricNameId messageIdId = MetricNameRegistry::intern("DIRECTIVE_MESSAGE_ID");
+
+    auto buildEvent = [&stream, &messageId] {
+        return MetricEventBuilder{}
+            .setActivityName(ACTIVITY_NAME)
+            .addDataPoint(DataPointCounterBuilder{}.setName("PARSE_COMPLETE").increment(1).build())
+            .addDataPoint(DataPointStringBuilder{}.setName("HTTP2_STREAM").setValue(stream).build())
+            .addDataPoint(DataPointStringBuilder{}.setName("DIRECTIVE_MESSAGE_ID").setValue(messageId).build())
+            .build();
+    };
+    auto measure = [iterations](const std::function<void()>& record) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            record();
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / iterations;
+    };
+
+    double executorCost;
+    {
+        TestSink sink;
+        threading::Executor executor;
+        executorCost = measure([&] {
+            auto metricEvent = buildEvent();
+            executor.execute([&sink, metricEvent] { sink.consumeMetric(metricEvent); });
+        });
+        executor.waitForSubmittedTasks();
+    }
+
+    MetricRecorder recorder(iterations);
+    recorder.addSink(std::unique_ptr<MetricSinkInterface>(new TestSink()));
+    auto eventCost = measure([&] { recorder.recordMetric(buildEvent()); });
+    recorder.flush();
+
+    MetricRecorder binaryRecorder(iterations);
+    auto binarySink = new TestBinarySink();
+    binaryRecorder.addBinarySink(std::unique_ptr<BinaryMetricSinkInterface>(binarySink));
+    auto recordCost = measure([&] {
+        binaryRecorder.recordBinaryMetric(MetricRecord(ACTIVITY_ID)
+                                              .addCounter(parseCompleteId, 1)
+                                              .addString(streamId, stream)
+                                              .addString(messageIdId, messageId));
+    });
+    binaryRecorder.flush();
+
+    std::cout << std::fixed << std::setprecision(0) << "  Cost per recorded directive metric (" << iterations
+              << " metrics):" << std::endl
+              << "    " << std::left << std::setw(36) << "MetricEvent + Executor task" << std::right << std::setw(8)
+              << executorCost << " ns" << std::endl
+              << "    " << std::left << std::setw(36) << "MetricEvent + ring buffer" << std::right << std::setw(8)
+              << eventCost << " ns" << std::endl
+              << "    " << std::left << std::setw(36) << "MetricRecord + ring buffer" << std::right << std::setw(8)
+              << recordCost << " ns" << std::endl
+              << "    dropped: " << recorder.getDroppedCount() + binaryRecorder.getDroppedCount() << std::endl;
+    EXPECT_EQ(binarySink->m_records.size() + binaryRecorder.getDroppedCount(), static_cast<size_t>(iterations));
+}
+
+}  // namespace test
+}  // namespace implementations
+}  // namespace metrics
+}  // namespace alexaClientSDK
@@ -0,0 +1,162 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+#ifndef ALEXA_CLIENT_SDK_METRICS_UPLCALCULATOR_INCLUDE_METRICS_LATENCYHISTOGRAM_H_
+#define ALEXA_CLIENT_SDK_METRICS_UPLCALCULATOR_INCLUDE_METRICS_LATENCYHISTOGRAM_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace alexaClientSDK {
+namespace metrics {
+namespace implementations {
+
+/**
+ * A histogram of latencies in a fixed amount of memory, with buckets laid out like an HDR histogram: latencies below
+ * 64 us each have a bucket of their own, and every power of two above is split into 32 buckets of equal width. A
+ * latency is therefore reported with an error of at most 1/32 (about 3%), up to @c MAX_TRACKABLE_VALUE.
+ *
+ * Recording and taking a snapshot are lock free and may happen concurrently from any thread.
+ */
+class LatencyHistogram {
+public:
+    /// Statistics of the recorded latencies. All values are zero when nothing was recorded.
+    struct Snapshot {
+        /// The number of latencies recorded.
+        uint64_t count = 0;
+
+        /// The lowest latency recorded.
+        std::chrono::microseconds min{0};
+
+        /// The highest latency recorded.
+        std::chrono::microseconds max{0};
+
+        /// The average latency.
+        std::chrono::microseconds mean{0};
+
+        /// The median latency.
+        std::chrono::microseconds p50{0};
+
+        /// The 90th percentile latency.
+        std::chrono::microseconds p90{0};
+
+        /// The 99th percentile latency.
+        std::chrono::microseconds p99{0};
+    };
+
+    /// The highest latency which can be told apart. Higher latencies are recorded as this value.
+    static const std::chrono::microseconds MAX_TRACKABLE_VALUE;
+
+    /**
+     * Constructor.
+     */
+    LatencyHistogram();
+
+    /**
+     * Record a latency. Negative latencies are recorded as zero.
+     *
+     * @param latency The latency.
+     */
+    void record(std::chrono::microseconds latency);
+
+    /**
+     * Get the statistics of the latencies recorded so far.
+     *
+     * @return The statistics.
+     */
+    Snapshot getSnapshot() const;
+
+    /**
+     * Get the latency below which a percentage of the recorded latencies fall.
+     *
+     * @param percentile The percentage, from 0 to 100.
+     * @return The latency, or zero when nothing was recorded.
+     */
+    std::chrono::microseconds getValueAtPercentile(double percentile) const;
+
+    /**
+     * Forget all recorded latencies. Latencies recorded concurrently may be partially forgotten.
+     */
+    void reset();
+
+private:
+    /// The number of bits of precision kept within each power of two.
+    static const unsigned int SUB_BUCKET_BITS = 5;
+
+    /// The number of bits of the highest trackable value.
+    static const unsigned int VALUE_BITS = 36;
+
+    /// The number of buckets.
+    static const size_t BUCKET_COUNT =
+        (2u << SUB_BUCKET_BITS) + (VALUE_BITS - SUB_BUCKET_BITS - 1) * (1u << SUB_BUCKET_BITS);
+
+    /**
+     * Get the bucket of a value.
+     *
+     * @param value The value, in microseconds, no higher than @c MAX_TRACKABLE_VALUE.
+     * @return The index of the bucket.
+     */
+    static size_t bucketIndex(uint64_t value);
+
+    /**
+     * Get the highest value which falls in a bucket.
+     *
+     * @param index The index of the bucket.
+     * @return The highest value of the bucket, in microseconds.
+     */
+    static uint64_t bucketHighestValue(size_t index);
+
+    /**
+     * Get the latency at a percentile from a copy of the bucket counts.
+     *
+     * @param counts The bucket counts.
+     * @param total The sum of @c counts.
+     * @param max The highest latency recorded, in microseconds.
+     * @param percentile The percentage, from 0 to 100.
+     * @return The latency, in microseconds.
+     */
+    static uint64_t valueAtPercentile(
+        const std::array<uint64_t, BUCKET_COUNT>& counts,
+        uint64_t total,
+        uint64_t max,
+        double percentile);
+
+    /**
+     * Copy the bucket counts.
+     *
+     * @param[out] counts The bucket counts.
+     * @return The sum of the bucket counts.
+     */
+    uint64_t copyCounts(std::array<uint64_t, BUCKET_COUNT>* counts) const;
+
+    /// The number of latencies recorded in each bucket.
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> m_counts;
+
+    /// The sum of the recorded latencies, in microseconds.
+    std::atomic<uint64_t> m_sum;
+
+    /// The lowest latency recorded, in microseconds.
+    std::atomic<uint64_t> m_min;
+
+    /// The highest latency recorded, in microseconds.
+    std::atomic<uint64_t> m_max;
+};
+
+}  // namespace implementations
+}  // namespace metrics
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_METRICS_UPLCALCULATOR_INCLUDE_METRICS_LATENCYHISTOGRAM_H_
@@ -0,0 +1,186 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+#ifndef ALEXA_CLIENT_SDK_METRICS_UPLCALCULATOR_INCLUDE_METRICS_UPLLATENCYTRACKER_H_
+#define ALEXA_CLIENT_SDK_METRICS_UPLCALCULATOR_INCLUDE_METRICS_UPLLATENCYTRACKER_H_
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <AVSCommon/Utils/Metrics/MetricEvent.h>
+
+#include "Metrics/LatencyHistogram.h"
+
+namespace alexaClientSDK {
+namespace metrics {
+namespace implementations {
+
+/**
+ * The phases of an interaction which @c UplLatencyTracker measures. Each phase starts at the end of the wake word, or
+ * at the start of the utterance when the interaction was not started by a wake word.
+ */
+enum class UplPhase {
+    /// Until the Recognize event is built.
+    RECOGNIZE_EVENT_BUILT,
+    /// Until the first directive of the dialog is parsed.
+    FIRST_DIRECTIVE,
+    /// Until the speech of the dialog starts playing.
+    TTS_STARTED,
+    /// Until the media requested by the dialog starts playing.
+    MEDIA_STARTED
+};
+
+/**
+ * Write a @c UplPhase value to an @c ostream.
+ *
+ * @param stream The stream to write the value to.
+ * @param phase The value to write.
+ * @return The stream that was passed in and written to.
+ */
+std::ostream& operator<<(std::ostream& stream, UplPhase phase);
+
+/**
+ * Aggregates the user perceived latency of every interaction into a @c LatencyHistogram per @c UplPhase.
+ *
+ * Unlike the UPL calculators, which follow one utterance at a time, the tracker follows several dialogs at once,
+ * keyed by their dialog request id, and keeps its memory bounded: the oldest dialog is forgotten when too many are in
+ * progress, and a dialog is forgotten once all its phases are measured or it times out.
+ *
+ * @c inspectMetric() is expected to be called from one thread at a time; @c getSnapshot() may be called from any
+ * thread.
+ */
+class UplLatencyTracker {
+public:
+    /// The number of @c UplPhase values.
+    static const size_t PHASE_COUNT = 4;
+
+    /// The default number of dialogs followed at once.
+    static const size_t DEFAULT_MAX_DIALOGS;
+
+    /// The default time after which a dialog is forgotten.
+    static const std::chrono::seconds DEFAULT_DIALOG_TIMEOUT;
+
+    /**
+     * Constructor.
+     *
+     * @param maxDialogs The number of dialogs followed at once.
+     * @param dialogTimeout The time after the start of a dialog after which it is forgotten.
+     */
+    explicit UplLatencyTracker(
+        size_t maxDialogs = DEFAULT_MAX_DIALOGS,
+        std::chrono::seconds dialogTimeout = DEFAULT_DIALOG_TIMEOUT);
+
+    /**
+     * Inspect a metric for the timepoints of the dialogs in progress.
+     *
+     * @param metricName The name of the metric, which is the activity name without its source prefix.
+     * @param metricEvent The metric.
+     */
+    void inspectMetric(
+        const std::string& metricName,
+        const std::shared_ptr<avsCommon::utils::metrics::MetricEvent>& metricEvent);
+
+    /**
+     * Get the latency statistics of a phase.
+     *
+     * @param phase The phase.
+     * @return The latency statistics of every interaction since creation or the last @c reset().
+     */
+    LatencyHistogram::Snapshot getSnapshot(UplPhase phase) const;
+
+    /**
+     * Forget the latencies recorded so far. Dialogs in progress are still followed.
+     */
+    void reset();
+
+private:
+    /// A dialog in progress.
+    struct Dialog {
+        /// The dialog request id.
+        std::string dialogRequestId;
+
+        /// The time the dialog started.
+        std::chrono::steady_clock::time_point startTime;
+
+        /// The time at which the phases start.
+        std::chrono::steady_clock::time_point referenceTime;
+
+        /// The message ids of the directives of the dialog, for metrics which only carry those.
+        std::vector<std::string> directiveIds;
+
+        /// Which phases have been measured.
+        std::array<bool, PHASE_COUNT> measured;
+    };
+
+    /**
+     * Find a dialog in progress.
+     *
+     * @param dialogRequestId The dialog request id.
+     * @return The dialog, or @c nullptr if it is not in progress.
+     */
+    Dialog* findDialogLocked(const std::string& dialogRequestId);
+
+    /**
+     * Find the dialog of a directive.
+     *
+     * @param directiveId The message id of the directive.
+     * @return The dialog, or @c nullptr if the directive does not belong to a dialog in progress.
+     */
+    Dialog* findDialogByDirectiveLocked(const std::string& directiveId);
+
+    /**
+     * Start following a dialog, forgetting the dialogs which timed out and, if still needed, the oldest one.
+     *
+     * @param dialogRequestId The dialog request id.
+     * @param startTime The time the dialog started.
+     * @return The new dialog.
+     */
+    Dialog* startDialogLocked(const std::string& dialogRequestId, std::chrono::steady_clock::time_point startTime);
+
+    /**
+     * Measure a phase of a dialog, unless it was already measured. The dialog is forgotten once all its phases are
+     * measured, so @c dialog is no longer valid after this call.
+     *
+     * @param dialog The dialog.
+     * @param phase The phase.
+     * @param endTime The time the phase ended.
+     */
+    void measureLocked(Dialog* dialog, UplPhase phase, std::chrono::steady_clock::time_point endTime);
+
+    /// The number of dialogs followed at once.
+    const size_t m_maxDialogs;
+
+    /// The time after the start of a dialog after which it is forgotten.
+    const std::chrono::seconds m_dialogTimeout;
+
+    /// Serializes access to @c m_dialogs.
+    std::mutex m_mutex;
+
+    /// The dialogs in progress, oldest first.
+    std::vector<Dialog> m_dialogs;
+
+    /// The latencies of each phase.
+    std::array<LatencyHistogram, PHASE_COUNT> m_histograms;
+};
+
+}  // namespace implementations
+}  // namespace metrics
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_METRICS_UPLCALCULATOR_INCLUDE_METRICS_UPLLATENCYTRACKER_H_
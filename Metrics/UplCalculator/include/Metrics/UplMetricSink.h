@@ -23,12 +23,17 @@
 #include <AVSCommon/Utils/Metrics/MetricSinkInterface.h>
 #include <AVSCommon/Utils/Metrics/UplCalculatorInterface.h>
 
+#include "Metrics/UplLatencyTracker.h"
+
 namespace alexaClientSDK {
 namespace metrics {
 namespace implementations {
 
 /**
  * This class implements a metric sink that inspects each incoming metric with SampleUplCalculator.
+ *
+ * Besides publishing the UPL of the latest utterance, the sink aggregates the UPL of every interaction, including
+ * overlapping ones, into latency histograms which can be read with @c getLatencySnapshot().
  */
 class UplMetricSink : public avsCommon::utils::metrics::MetricSinkInterface {
 public:
@@ -41,6 +46,23 @@ public:
     static std::unique_ptr<avsCommon::utils::metrics::MetricSinkInterface> createMetricSinkInterface(
         std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder);
 
+    /**
+     * Create a @c UplMetricSink, for callers which read its latency histograms.
+     *
+     * @param metricRecorder is the MetricRecorder object to publish UPL metrics to.
+     * @return A @c UplMetricSink, or @c nullptr if @c metricRecorder is null.
+     */
+    static std::unique_ptr<UplMetricSink> createUplMetricSink(
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder);
+
+    /**
+     * Get the latency statistics of a phase of every interaction seen so far.
+     *
+     * @param phase The phase.
+     * @return The latency statistics.
+     */
+    LatencyHistogram::Snapshot getLatencySnapshot(UplPhase phase) const;
+
     /**
      * Destructor
      */
@@ -65,6 +87,9 @@ private:
 
     /// MetricRecorder to publish UPL metrics.
     std::weak_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
+
+    /// Aggregates the UPL of every interaction.
+    UplLatencyTracker m_latencyTracker;
 };
 
 }  // namespace implementations
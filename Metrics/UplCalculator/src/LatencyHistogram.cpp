@@ -0,0 +1,156 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Metrics/LatencyHistogram.h"
+
+namespace alexaClientSDK {
+namespace metrics {
+namespace implementations {
+
+const std::chrono::microseconds LatencyHistogram::MAX_TRACKABLE_VALUE{(uint64_t{1} << VALUE_BITS) - 1};
+
+/**
+ * Get the position of the highest bit set in a value.
+ *
+ * @param value The value, which must not be zero.
+ * @return The position of the highest bit set, counting from zero.
+ */
+static unsigned int highestBit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#else
+    unsigned int bit = 0;
+    while (value >>= 1) {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+LatencyHistogram::LatencyHistogram() {
+    reset();
+}
+
+size_t LatencyHistogram::bucketIndex(uint64_t value) {
+    const uint64_t linearLimit = 2u << SUB_BUCKET_BITS;
+    if (value < linearLimit) {
+        return static_cast<size_t>(value);
+    }
+    // Keep the SUB_BUCKET_BITS bits below the highest bit set.
+    auto bit = highestBit(value);
+    auto shift = bit - SUB_BUCKET_BITS;
+    auto subBucket = (value >> shift) - (uint64_t{1} << SUB_BUCKET_BITS);
+    auto group = bit - SUB_BUCKET_BITS - 1;
+    return static_cast<size_t>(linearLimit + (uint64_t{group} << SUB_BUCKET_BITS) + subBucket);
+}
+
+uint64_t LatencyHistogram::bucketHighestValue(size_t index) {
+    const uint64_t linearLimit = 2u << SUB_BUCKET_BITS;
+    if (index < linearLimit) {
+        return index;
+    }
+    auto group = (index - linearLimit) >> SUB_BUCKET_BITS;
+    auto subBucket = (index - linearLimit) & ((uint64_t{1} << SUB_BUCKET_BITS) - 1);
+    auto shift = group + 1;
+    return (((uint64_t{1} << SUB_BUCKET_BITS) + subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(std::chrono::microseconds latency) {
+    uint64_t value = latency.count() < 0 ? 0 : static_cast<uint64_t>(latency.count());
+    value = std::min(value, static_cast<uint64_t>(MAX_TRACKABLE_VALUE.count()));
+
+    m_counts[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+    auto min = m_min.load(std::memory_order_relaxed);
+    while (value < min && !m_min.compare_exchange_weak(min, value, std::memory_order_relaxed)) {
+    }
+    auto max = m_max.load(std::memory_order_relaxed);
+    while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t LatencyHistogram::copyCounts(std::array<uint64_t, BUCKET_COUNT>* counts) const {
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        (*counts)[i] = m_counts[i].load(std::memory_order_relaxed);
+        total += (*counts)[i];
+    }
+    return total;
+}
+
+uint64_t LatencyHistogram::valueAtPercentile(
+    const std::array<uint64_t, BUCKET_COUNT>& counts,
+    uint64_t total,
+    uint64_t max,
+    double percentile) {
+    if (0 == total) {
+        return 0;
+    }
+    percentile = std::max(0.0, std::min(100.0, percentile));
+    auto target = static_cast<uint64_t>(std::ceil(percentile / 100.0 * total));
+    target = std::max<uint64_t>(target, 1);
+
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        cumulative += counts[i];
+        if (cumulative >= target) {
+            return std::min(bucketHighestValue(i), max);
+        }
+    }
+    return max;
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::getSnapshot() const {
+    std::array<uint64_t, BUCKET_COUNT> counts;
+    auto total = copyCounts(&counts);
+
+    Snapshot snapshot;
+    if (0 == total) {
+        return snapshot;
+    }
+    auto max = m_max.load(std::memory_order_relaxed);
+    snapshot.count = total;
+    snapshot.min = std::chrono::microseconds(m_min.load(std::memory_order_relaxed));
+    snapshot.max = std::chrono::microseconds(max);
+    snapshot.mean = std::chrono::microseconds(m_sum.load(std::memory_order_relaxed) / total);
+    snapshot.p50 = std::chrono::microseconds(valueAtPercentile(counts, total, max, 50));
+    snapshot.p90 = std::chrono::microseconds(valueAtPercentile(counts, total, max, 90));
+    snapshot.p99 = std::chrono::microseconds(valueAtPercentile(counts, total, max, 99));
+    return snapshot;
+}
+
+std::chrono::microseconds LatencyHistogram::getValueAtPercentile(double percentile) const {
+    std::array<uint64_t, BUCKET_COUNT> counts;
+    auto total = copyCounts(&counts);
+    return std::chrono::microseconds(
+        valueAtPercentile(counts, total, m_max.load(std::memory_order_relaxed), percentile));
+}
+
+void LatencyHistogram::reset() {
+    for (auto& count : m_counts) {
+        count.store(0, std::memory_order_relaxed);
+    }
+    m_sum.store(0, std::memory_order_relaxed);
+    m_min.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace implementations
+}  // namespace metrics
+}  // namespace alexaClientSDK
@@ -0,0 +1,209 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Metrics/DataType.h>
+#include <Metrics/BaseUplCalculator.h>
+
+#include "Metrics/UplLatencyTracker.h"
+
+namespace alexaClientSDK {
+namespace metrics {
+namespace implementations {
+
+using namespace avsCommon::utils::metrics;
+
+/// String to identify log entries originating from this file.
+#define TAG "UplLatencyTracker"
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Names of the monitored metrics which are not monitored by @c BaseUplCalculator.
+static const std::string TTS_STARTED_METRIC = "TTS_STARTED";
+static const std::string PLAYBACK_STARTED_METRIC = "PLAYBACK_STARTED";
+
+/// The number of directive message ids remembered per dialog.
+static const size_t MAX_DIRECTIVES_PER_DIALOG = 16;
+
+const size_t UplLatencyTracker::DEFAULT_MAX_DIALOGS = 8;
+
+const std::chrono::seconds UplLatencyTracker::DEFAULT_DIALOG_TIMEOUT{60};
+
+std::ostream& operator<<(std::ostream& stream, UplPhase phase) {
+    switch (phase) {
+        case UplPhase::RECOGNIZE_EVENT_BUILT:
+            return stream << "RECOGNIZE_EVENT_BUILT";
+        case UplPhase::FIRST_DIRECTIVE:
+            return stream << "FIRST_DIRECTIVE";
+        case UplPhase::TTS_STARTED:
+            return stream << "TTS_STARTED";
+        case UplPhase::MEDIA_STARTED:
+            return stream << "MEDIA_STARTED";
+    }
+    return stream << "UNKNOWN";
+}
+
+/**
+ * Get the value of a string data point of a metric. Unlike @c BaseUplCalculator::getMetricTag(), a missing data point
+ * is not an error, since not every emitter of a monitored metric knows the dialog it belongs to.
+ *
+ * @param metricEvent The metric.
+ * @param name The name of the data point.
+ * @return The value of the data point, or the empty string if it is missing.
+ */
+static std::string getTag(const std::shared_ptr<MetricEvent>& metricEvent, const std::string& name) {
+    auto dataPoint = metricEvent->getDataPoint(name, DataType::STRING);
+    return dataPoint.hasValue() ? dataPoint.value().getValue() : std::string();
+}
+
+UplLatencyTracker::UplLatencyTracker(size_t maxDialogs, std::chrono::seconds dialogTimeout) :
+        m_maxDialogs{std::max<size_t>(maxDialogs, 1)},
+        m_dialogTimeout{dialogTimeout} {
+    m_dialogs.reserve(m_maxDialogs);
+}
+
+void UplLatencyTracker::inspectMetric(const std::string& metricName, const std::shared_ptr<MetricEvent>& metricEvent) {
+    if (!metricEvent) {
+        ACSDK_ERROR(LX("inspectMetricFailed").d("reason", "nullMetricEvent"));
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (START_OF_UTTERANCE == metricName) {
+        auto dialogRequestId = getTag(metricEvent, DIALOG_REQUEST_ID_TAG);
+        if (!dialogRequestId.empty() && !findDialogLocked(dialogRequestId)) {
+            startDialogLocked(dialogRequestId, metricEvent->getSteadyTimestamp());
+        }
+    } else if (WW_DURATION == metricName) {
+        auto dialog = findDialogLocked(getTag(metricEvent, DIALOG_REQUEST_ID_TAG));
+        std::chrono::milliseconds startOfStream;
+        std::chrono::milliseconds wakeWordDuration;
+        if (dialog && BaseUplCalculator::getDuration(START_OF_STREAM_TIMESTAMP, metricEvent, startOfStream) &&
+            BaseUplCalculator::getDuration(WW_DURATION, metricEvent, wakeWordDuration)) {
+            dialog->referenceTime = std::chrono::steady_clock::time_point(startOfStream + wakeWordDuration);
+        }
+    } else if (RECOGNIZE_EVENT_IS_BUILT == metricName) {
+        auto dialog = findDialogLocked(getTag(metricEvent, DIALOG_REQUEST_ID_TAG));
+        if (dialog) {
+            measureLocked(dialog, UplPhase::RECOGNIZE_EVENT_BUILT, metricEvent->getSteadyTimestamp());
+        }
+    } else if (PARSE_COMPLETE == metricName) {
+        auto dialog = findDialogLocked(getTag(metricEvent, DIALOG_REQUEST_ID_TAG));
+        if (dialog) {
+            auto directiveId = getTag(metricEvent, DIRECTIVE_MESSAGE_ID_TAG);
+            if (!directiveId.empty() && dialog->directiveIds.size() < MAX_DIRECTIVES_PER_DIALOG) {
+                dialog->directiveIds.push_back(directiveId);
+            }
+            measureLocked(dialog, UplPhase::FIRST_DIRECTIVE, metricEvent->getSteadyTimestamp());
+        }
+    } else if (TTS_STARTED_METRIC == metricName) {
+        auto dialog = findDialogLocked(getTag(metricEvent, DIALOG_REQUEST_ID_TAG));
+        if (dialog) {
+            measureLocked(dialog, UplPhase::TTS_STARTED, metricEvent->getSteadyTimestamp());
+        }
+    } else if (PLAYBACK_STARTED_METRIC == metricName) {
+        auto dialog = findDialogByDirectiveLocked(getTag(metricEvent, DIRECTIVE_MESSAGE_ID_TAG));
+        if (dialog) {
+            measureLocked(dialog, UplPhase::MEDIA_STARTED, metricEvent->getSteadyTimestamp());
+        }
+    }  // else, metricName doesn't match any monitored metric names, do nothing
+}
+
+LatencyHistogram::Snapshot UplLatencyTracker::getSnapshot(UplPhase phase) const {
+    return m_histograms[static_cast<size_t>(phase)].getSnapshot();
+}
+
+void UplLatencyTracker::reset() {
+    for (auto& histogram : m_histograms) {
+        histogram.reset();
+    }
+}
+
+UplLatencyTracker::Dialog* UplLatencyTracker::findDialogLocked(const std::string& dialogRequestId) {
+    if (dialogRequestId.empty()) {
+        return nullptr;
+    }
+    for (auto& dialog : m_dialogs) {
+        if (dialog.dialogRequestId == dialogRequestId) {
+            return &dialog;
+        }
+    }
+    return nullptr;
+}
+
+UplLatencyTracker::Dialog* UplLatencyTracker::findDialogByDirectiveLocked(const std::string& directiveId) {
+    if (directiveId.empty()) {
+        return nullptr;
+    }
+    for (auto& dialog : m_dialogs) {
+        if (std::find(dialog.directiveIds.begin(), dialog.directiveIds.end(), directiveId) !=
+            dialog.directiveIds.end()) {
+            return &dialog;
+        }
+    }
+    return nullptr;
+}
+
+UplLatencyTracker::Dialog* UplLatencyTracker::startDialogLocked(
+    const std::string& dialogRequestId,
+    std::chrono::steady_clock::time_point startTime) {
+    auto timeout = m_dialogTimeout;
+    m_dialogs.erase(
+        std::remove_if(
+            m_dialogs.begin(),
+            m_dialogs.end(),
+            [startTime, timeout](const Dialog& dialog) { return startTime - dialog.startTime > timeout; }),
+        m_dialogs.end());
+    if (m_dialogs.size() >= m_maxDialogs) {
+        ACSDK_DEBUG5(LX(__func__).d("reason", "tooManyDialogs").d("forgotten", m_dialogs.front().dialogRequestId));
+        m_dialogs.erase(m_dialogs.begin());
+    }
+
+    Dialog dialog;
+    dialog.dialogRequestId = dialogRequestId;
+    dialog.startTime = startTime;
+    dialog.referenceTime = startTime;
+    dialog.measured.fill(false);
+    m_dialogs.push_back(std::move(dialog));
+    return &m_dialogs.back();
+}
+
+void UplLatencyTracker::measureLocked(
+    Dialog* dialog,
+    UplPhase phase,
+    std::chrono::steady_clock::time_point endTime) {
+    auto index = static_cast<size_t>(phase);
+    if (dialog->measured[index]) {
+        return;
+    }
+    dialog->measured[index] = true;
+    m_histograms[index].record(std::chrono::duration_cast<std::chrono::microseconds>(endTime - dialog->referenceTime));
+
+    if (std::all_of(dialog->measured.begin(), dialog->measured.end(), [](bool measured) { return measured; })) {
+        auto it = m_dialogs.begin() + (dialog - m_dialogs.data());
+        m_dialogs.erase(it);
+    }
+}
+
+}  // namespace implementations
+}  // namespace metrics
+}  // namespace alexaClientSDK
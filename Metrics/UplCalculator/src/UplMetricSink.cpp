@@ -40,12 +40,21 @@ static const std::string TTS_UPL_NAME = "tts";
 static const std::string MEDIA_UPL_NAME = "media";
 
 std::unique_ptr<avsCommon::utils::metrics::MetricSinkInterface> UplMetricSink::createMetricSinkInterface(
+    std::shared_ptr<alexaClientSDK::avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder) {
+    return createUplMetricSink(std::move(metricRecorder));
+}
+
+std::unique_ptr<UplMetricSink> UplMetricSink::createUplMetricSink(
     std::shared_ptr<alexaClientSDK::avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder) {
     if (!metricRecorder) {
-        ACSDK_ERROR(LX("createMetricSinkInterfaceFailed").d("reason", "nullMetricRecorder"));
+        ACSDK_ERROR(LX("createUplMetricSinkFailed").d("reason", "nullMetricRecorder"));
         return nullptr;
     }
-    return std::unique_ptr<avsCommon::utils::metrics::MetricSinkInterface>(new UplMetricSink(metricRecorder));
+    return std::unique_ptr<UplMetricSink>(new UplMetricSink(metricRecorder));
+}
+
+LatencyHistogram::Snapshot UplMetricSink::getLatencySnapshot(UplPhase phase) const {
+    return m_latencyTracker.getSnapshot(phase);
 }
 
 UplMetricSink::UplMetricSink(
@@ -65,6 +74,8 @@ void UplMetricSink::consumeMetric(std::shared_ptr<alexaClientSDK::avsCommon::uti
     std::string metricName;
     std::getline(ss, metricName);
 
+    m_latencyTracker.inspectMetric(metricName, metricEvent);
+
     // Reset UPL data on the start of a new utterance
     if (metricName == START_OF_UTTERANCE) {
         uplCalculators[BASE_UPL_NAME] = BaseUplCalculator::createBaseUplCalculator();
@@ -0,0 +1,134 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Metrics/LatencyHistogram.h"
+
+namespace alexaClientSDK {
+namespace metrics {
+namespace implementations {
+namespace test {
+
+using namespace ::testing;
+
+/// Relative error allowed by the bucket layout.
+static const double MAX_RELATIVE_ERROR = 1.0 / 32;
+
+/**
+ * Check that a reported latency is within the precision of the histogram.
+ *
+ * @param expected The exact latency.
+ * @param actual The reported latency.
+ */
+static void expectWithinPrecision(std::chrono::microseconds expected, std::chrono::microseconds actual) {
+    EXPECT_GE(actual.count(), expected.count());
+    EXPECT_LE(actual.count(), expected.count() + static_cast<int64_t>(expected.count() * MAX_RELATIVE_ERROR));
+}
+
+/// Verify that an empty histogram reports zeros.
+TEST(LatencyHistogramTest, test_emptySnapshot) {
+    LatencyHistogram histogram;
+    auto snapshot = histogram.getSnapshot();
+    EXPECT_EQ(snapshot.count, 0u);
+    EXPECT_EQ(snapshot.min.count(), 0);
+    EXPECT_EQ(snapshot.max.count(), 0);
+    EXPECT_EQ(snapshot.p99.count(), 0);
+    EXPECT_EQ(histogram.getValueAtPercentile(50).count(), 0);
+}
+
+/// Verify that small latencies are reported exactly.
+TEST(LatencyHistogramTest, test_smallValuesAreExact) {
+    LatencyHistogram histogram;
+    for (int i = 1; i <= 50; ++i) {
+        histogram.record(std::chrono::microseconds(i));
+    }
+    auto snapshot = histogram.getSnapshot();
+    EXPECT_EQ(snapshot.count, 50u);
+    EXPECT_EQ(snapshot.min.count(), 1);
+    EXPECT_EQ(snapshot.max.count(), 50);
+    EXPECT_EQ(snapshot.p50.count(), 25);
+    EXPECT_EQ(snapshot.p90.count(), 45);
+    EXPECT_EQ(snapshot.mean.count(), 25);
+}
+
+/// Verify that the percentiles of latencies spread over several orders of magnitude are within precision.
+TEST(LatencyHistogramTest, test_percentilesWithinPrecision) {
+    LatencyHistogram histogram;
+    for (int i = 1; i <= 1000; ++i) {
+        histogram.record(std::chrono::milliseconds(i));
+    }
+    auto snapshot = histogram.getSnapshot();
+    EXPECT_EQ(snapshot.count, 1000u);
+    EXPECT_EQ(snapshot.min, std::chrono::milliseconds(1));
+    EXPECT_EQ(snapshot.max, std::chrono::milliseconds(1000));
+    expectWithinPrecision(std::chrono::milliseconds(500), snapshot.p50);
+    expectWithinPrecision(std::chrono::milliseconds(900), snapshot.p90);
+    expectWithinPrecision(std::chrono::milliseconds(990), snapshot.p99);
+    EXPECT_EQ(histogram.getValueAtPercentile(100), snapshot.max);
+}
+
+/// Verify that out of range latencies are clamped.
+TEST(LatencyHistogramTest, test_outOfRangeValuesAreClamped) {
+    LatencyHistogram histogram;
+    histogram.record(std::chrono::microseconds(-5));
+    histogram.record(std::chrono::hours(24 * 365));
+    auto snapshot = histogram.getSnapshot();
+    EXPECT_EQ(snapshot.count, 2u);
+    EXPECT_EQ(snapshot.min.count(), 0);
+    EXPECT_EQ(snapshot.max, LatencyHistogram::MAX_TRACKABLE_VALUE);
+    EXPECT_EQ(histogram.getValueAtPercentile(100), LatencyHistogram::MAX_TRACKABLE_VALUE);
+}
+
+/// Verify that @c reset() forgets the recorded latencies.
+TEST(LatencyHistogramTest, test_reset) {
+    LatencyHistogram histogram;
+    histogram.record(std::chrono::milliseconds(10));
+    histogram.reset();
+    EXPECT_EQ(histogram.getSnapshot().count, 0u);
+    histogram.record(std::chrono::milliseconds(3));
+    EXPECT_EQ(histogram.getSnapshot().min, std::chrono::milliseconds(3));
+}
+
+/// Verify that latencies recorded from several threads are all counted.
+TEST(LatencyHistogramTest, test_concurrentRecording) {
+    static const int THREADS = 4;
+    static const int RECORDS_PER_THREAD = 10000;
+    LatencyHistogram histogram;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&histogram, t] {
+            for (int i = 0; i < RECORDS_PER_THREAD; ++i) {
+                histogram.record(std::chrono::microseconds(t * RECORDS_PER_THREAD + i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto snapshot = histogram.getSnapshot();
+    EXPECT_EQ(snapshot.count, static_cast<uint64_t>(THREADS * RECORDS_PER_THREAD));
+    EXPECT_EQ(snapshot.min.count(), 0);
+    EXPECT_EQ(snapshot.max.count(), THREADS * RECORDS_PER_THREAD - 1);
+}
+
+}  // namespace test
+}  // namespace implementations
+}  // namespace metrics
+}  // namespace alexaClientSDK
@@ -0,0 +1,181 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Metrics/DataPointDurationBuilder.h>
+#include <AVSCommon/Utils/Metrics/DataPointStringBuilder.h>
+#include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
+
+#include "Metrics/UplLatencyTracker.h"
+
+namespace alexaClientSDK {
+namespace metrics {
+namespace implementations {
+namespace test {
+
+using namespace ::testing;
+using namespace avsCommon::utils::metrics;
+
+/// Time between the end of the wake word and the metrics which follow, in the tests which use a wake word.
+static const std::chrono::milliseconds WAKE_WORD_LEAD{500};
+
+/**
+ * Build a metric with a string data point.
+ *
+ * @param metricName The name of the metric.
+ * @param tagName The name of the string data point.
+ * @param tagValue The value of the string data point.
+ * @return The metric.
+ */
+static std::shared_ptr<MetricEvent> buildMetric(
+    const std::string& metricName,
+    const std::string& tagName,
+    const std::string& tagValue) {
+    return MetricEventBuilder{}
+        .setActivityName("TEST-" + metricName)
+        .addDataPoint(DataPointStringBuilder{}.setName(tagName).setValue(tagValue).build())
+        .build();
+}
+
+/**
+ * Build a PARSE_COMPLETE metric.
+ *
+ * @param dialogRequestId The dialog request id of the directive.
+ * @param directiveId The message id of the directive.
+ * @return The metric.
+ */
+static std::shared_ptr<MetricEvent> buildParseComplete(
+    const std::string& dialogRequestId,
+    const std::string& directiveId) {
+    return MetricEventBuilder{}
+        .setActivityName("TEST-PARSE_COMPLETE")
+        .addDataPoint(DataPointStringBuilder{}.setName("DIALOG_REQUEST_ID").setValue(dialogRequestId).build())
+        .addDataPoint(DataPointStringBuilder{}.setName("DIRECTIVE_MESSAGE_ID").setValue(directiveId).build())
+        .build();
+}
+
+/**
+ * Build a WW_DURATION metric for a wake word which ended @c WAKE_WORD_LEAD ago.
+ *
+ * @param dialogRequestId The dialog request id.
+ * @return The metric.
+ */
+static std::shared_ptr<MetricEvent> buildWakeWordDuration(const std::string& dialogRequestId) {
+    auto wakeWordEnd = std::chrono::duration_cast<std::chrono::milliseconds>(
+        (std::chrono::steady_clock::now() - WAKE_WORD_LEAD).time_since_epoch());
+    std::chrono::milliseconds wakeWordDuration{300};
+    return MetricEventBuilder{}
+        .setActivityName("TEST-WW_DURATION")
+        .addDataPoint(DataPointStringBuilder{}.setName("DIALOG_REQUEST_ID").setValue(dialogRequestId).build())
+        .addDataPoint(
+            DataPointDurationBuilder{wakeWordEnd - wakeWordDuration}.setName("START_OF_STREAM_TIMESTAMP").build())
+        .addDataPoint(DataPointDurationBuilder{wakeWordDuration}.setName("WW_DURATION").build())
+        .build();
+}
+
+/**
+ * Feed a metric to a tracker the way @c UplMetricSink does.
+ *
+ * @param tracker The tracker.
+ * @param metricEvent The metric.
+ */
+static void inspect(UplLatencyTracker& tracker, const std::shared_ptr<MetricEvent>& metricEvent) {
+    auto activityName = metricEvent->getActivityName();
+    tracker.inspectMetric(activityName.substr(activityName.find('-') + 1), metricEvent);
+}
+
+/// Verify that every phase of a wake word interaction is measured from the end of the wake word.
+TEST(UplLatencyTrackerTest, test_wakeWordInteraction) {
+    UplLatencyTracker tracker;
+    inspect(tracker, buildMetric("START_OF_UTTERANCE", "DIALOG_REQUEST_ID", "dialog1"));
+    inspect(tracker, buildWakeWordDuration("dialog1"));
+    inspect(tracker, buildMetric("RECOGNIZE_EVENT_IS_BUILT", "DIALOG_REQUEST_ID", "dialog1"));
+    inspect(tracker, buildParseComplete("dialog1", "directive1"));
+    inspect(tracker, buildParseComplete("dialog1", "directive2"));
+    inspect(tracker, buildMetric("TTS_STARTED", "DIALOG_REQUEST_ID", "dialog1"));
+    inspect(tracker, buildMetric("PLAYBACK_STARTED", "DIRECTIVE_MESSAGE_ID", "directive2"));
+
+    for (auto phase : {UplPhase::RECOGNIZE_EVENT_BUILT,
+                       UplPhase::FIRST_DIRECTIVE,
+                       UplPhase::TTS_STARTED,
+                       UplPhase::MEDIA_STARTED}) {
+        auto snapshot = tracker.getSnapshot(phase);
+        EXPECT_EQ(snapshot.count, 1u) << phase;
+        EXPECT_GE(snapshot.min, WAKE_WORD_LEAD) << phase;
+    }
+}
+
+/// Verify that overlapping dialogs are measured separately and that unrelated metrics are ignored.
+TEST(UplLatencyTrackerTest, test_overlappingDialogs) {
+    UplLatencyTracker tracker;
+    inspect(tracker, buildMetric("START_OF_UTTERANCE", "DIALOG_REQUEST_ID", "dialog1"));
+    inspect(tracker, buildMetric("START_OF_UTTERANCE", "DIALOG_REQUEST_ID", "dialog2"));
+    inspect(tracker, buildWakeWordDuration("dialog1"));
+    inspect(tracker, buildParseComplete("dialog2", "directive2"));
+    inspect(tracker, buildParseComplete("dialog1", "directive1"));
+    inspect(tracker, buildParseComplete("unknown", "directive3"));
+    inspect(tracker, buildMetric("PLAYBACK_STARTED", "DIRECTIVE_MESSAGE_ID", "directive3"));
+    inspect(tracker, buildMetric("TTS_STARTED", "DIALOG_REQUEST_ID", ""));
+
+    auto firstDirective = tracker.getSnapshot(UplPhase::FIRST_DIRECTIVE);
+    EXPECT_EQ(firstDirective.count, 2u);
+    EXPECT_LT(firstDirective.min, WAKE_WORD_LEAD);
+    EXPECT_GE(firstDirective.max, WAKE_WORD_LEAD);
+    EXPECT_EQ(tracker.getSnapshot(UplPhase::MEDIA_STARTED).count, 0u);
+    EXPECT_EQ(tracker.getSnapshot(UplPhase::TTS_STARTED).count, 0u);
+}
+
+/// Verify that only the first occurrence of a phase is measured.
+TEST(UplLatencyTrackerTest, test_phaseMeasuredOnce) {
+    UplLatencyTracker tracker;
+    inspect(tracker, buildMetric("START_OF_UTTERANCE", "DIALOG_REQUEST_ID", "dialog1"));
+    inspect(tracker, buildParseComplete("dialog1", "directive1"));
+    inspect(tracker, buildParseComplete("dialog1", "directive2"));
+    EXPECT_EQ(tracker.getSnapshot(UplPhase::FIRST_DIRECTIVE).count, 1u);
+}
+
+/// Verify that the oldest dialog is forgotten when too many are in progress.
+TEST(UplLatencyTrackerTest, test_oldestDialogForgotten) {
+    UplLatencyTracker tracker{2};
+    inspect(tracker, buildMetric("START_OF_UTTERANCE", "DIALOG_REQUEST_ID", "dialog1"));
+    inspect(tracker, buildMetric("START_OF_UTTERANCE", "DIALOG_REQUEST_ID", "dialog2"));
+    inspect(tracker, buildMetric("START_OF_UTTERANCE", "DIALOG_REQUEST_ID", "dialog3"));
+    inspect(tracker, buildMetric("TTS_STARTED", "DIALOG_REQUEST_ID", "dialog1"));
+    EXPECT_EQ(tracker.getSnapshot(UplPhase::TTS_STARTED).count, 0u);
+    inspect(tracker, buildMetric("TTS_STARTED", "DIALOG_REQUEST_ID", "dialog2"));
+    inspect(tracker, buildMetric("TTS_STARTED", "DIALOG_REQUEST_ID", "dialog3"));
+    EXPECT_EQ(tracker.getSnapshot(UplPhase::TTS_STARTED).count, 2u);
+}
+
+/// Verify that @c reset() forgets the latencies but not the dialogs in progress.
+TEST(UplLatencyTrackerTest, test_reset) {
+    UplLatencyTracker tracker;
+    inspect(tracker, buildMetric("START_OF_UTTERANCE", "DIALOG_REQUEST_ID", "dialog1"));
+    inspect(tracker, buildMetric("RECOGNIZE_EVENT_IS_BUILT", "DIALOG_REQUEST_ID", "dialog1"));
+    tracker.reset();
+    EXPECT_EQ(tracker.getSnapshot(UplPhase::RECOGNIZE_EVENT_BUILT).count, 0u);
+    inspect(tracker, buildMetric("TTS_STARTED", "DIALOG_REQUEST_ID", "dialog1"));
+    EXPECT_EQ(tracker.getSnapshot(UplPhase::TTS_STARTED).count, 1u);
+}
+
+}  // namespace test
+}  // namespace implementations
+}  // namespace metrics
+}  // namespace alexaClientSDK
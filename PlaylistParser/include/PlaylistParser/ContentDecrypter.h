@@ -22,6 +22,8 @@
 #include <string>
 #include <vector>
 
+#include <openssl/evp.h>
+
 #include <AVSCommon/AVS/Attachment/AttachmentWriter.h>
 #include <AVSCommon/Utils/RequiresShutdown.h>
 
@@ -34,6 +36,63 @@ namespace playlistParser {
 /// Alias for bytes.
 typedef std::vector<unsigned char> ByteVector;
 
+/**
+ * Helper class to decrypt AES-128 CBC encrypted content in place as it arrives, so that content can be decrypted while
+ * it is being downloaded without keeping a second copy of it.
+ */
+class AESStreamDecrypter {
+public:
+    /**
+     * Constructor.
+     */
+    AESStreamDecrypter();
+
+    /**
+     * Starts the decryption of new content.
+     *
+     * @param key The encryption key.
+     * @param iv The initialization vector of the encrypted content.
+     * @param usePadding Whether the content ends with PKCS#7 padding, which is removed by @c finish().
+     * @return @c true if the decryption could be started or @c false otherwise.
+     */
+    bool init(const ByteVector& key, const ByteVector& iv, bool usePadding = true);
+
+    /**
+     * Decrypts whole blocks of content in place.
+     *
+     * @param data The blocks to decrypt.
+     * @param size The size of the blocks in bytes, which must be a multiple of the AES block size.
+     * @return @c true if the blocks were decrypted or @c false otherwise.
+     */
+    bool decryptBlocks(unsigned char* data, size_t size);
+
+    /**
+     * Decrypts in place the whole blocks appended to the content since it was last passed to this method.
+     *
+     * @param content The content received so far, whose beginning has already been decrypted by previous calls.
+     * @return @c true if the new blocks were decrypted or @c false otherwise.
+     */
+    bool update(ByteVector* content);
+
+    /**
+     * Decrypts the rest of the content and removes its padding.
+     *
+     * @param content The whole content.
+     * @return @c true if the content was decrypted and its padding is valid or @c false otherwise.
+     */
+    bool finish(ByteVector* content);
+
+private:
+    /// The decryption context, which carries the chaining state from one block to the next.
+    std::unique_ptr<EVP_CIPHER_CTX, void (*)(EVP_CIPHER_CTX*)> m_context;
+
+    /// Whether the content ends with PKCS#7 padding.
+    bool m_usePadding;
+
+    /// The number of bytes of the content decrypted so far.
+    size_t m_decryptedSize;
+};
+
 /**
  * Helper class to decrypt downloaded media content.
  */
@@ -70,6 +129,34 @@ public:
         const std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter>& streamWriter,
         const std::shared_ptr<Id3TagsRemover>& id3TagRemover);
 
+    /**
+     * Decrypts contents in place and writes them to stream.
+     *
+     * @param[in,out] content The content that needs to be decrypted, which is decrypted in place.
+     * @param key The encryption key.
+     * @param encryptionInfo The @c EncryptionInfo of the encrypted content.
+     * @param streamWriter The writer to write decrypted content.
+     * @param id3TagRemover A component to remove ID3 tags from content.
+     * @return @c true if decryption and write to stream is successful or @c false otherwise.
+     */
+    bool decryptAndWrite(
+        ByteVector* content,
+        const ByteVector& key,
+        const avsCommon::utils::playlistParser::EncryptionInfo& encryptionInfo,
+        const std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter>& streamWriter,
+        const std::shared_ptr<Id3TagsRemover>& id3TagRemover);
+
+    /**
+     * Writes content that is already decrypted to stream.
+     *
+     * @param content The content to be written to stream.
+     * @param streamWriter The writer to write content.
+     * @return @c true if conversion is successful or @c false if failed.
+     */
+    bool writeToStream(
+        const ByteVector& content,
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter> streamWriter);
+
     /**
      * Converts initialization vector from hex to byte array.
      *
@@ -86,28 +173,14 @@ public:
 
 private:
     /**
-     * Prepends media initialization section to content.
+     * Decrypts AES-128 encrypted content in place.
      *
-     * @param bytes The bytes that needs to be added after media initialization section.
-     */
-    ByteVector prependMediaInitSection(const ByteVector& bytes) const;
-
-    /**
-     * Decrypts AES-128 encrypted content.
-     *
-     * @param encryptedContent The content that needs to be decrypted.
+     * @param[in,out] content The content that needs to be decrypted, which is replaced by the decrypted content.
      * @param key The encryption key.
      * @param iv The initialization vector of the encryption content.
-     * @param[out] decryptedContent The result of decryption is written to this pointer if successful.
-     * @param usePadding Flag to set if padding is required, default is @c true.
-     * @return number of decrypted bytes if successful or 0 otherwise.
+     * @return @c true if successful or @c false otherwise.
      */
-    int decryptAES(
-        const ByteVector& encryptedContent,
-        const ByteVector& key,
-        const ByteVector& iv,
-        ByteVector* decryptedContent,
-        bool usePadding = true);
+    bool decryptAES(ByteVector* content, const ByteVector& key, const ByteVector& iv);
 
     /**
      * Decrypted SAMPLE-AES encrypted content.
@@ -137,17 +210,6 @@ private:
         const unsigned char* buffer,
         size_t size);
 
-    /**
-     * Writes result to stream.
-     *
-     * @param content The content to be written to stream.
-     * @param streamWriter The writer to write content.
-     * @return @c true if conversion is successful or @c false if failed.
-     */
-    bool writeToStream(
-        const ByteVector& content,
-        std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter> streamWriter);
-
     /**
      *  Helper function to get more descriptive lib av errors
      *
@@ -35,6 +35,19 @@ public:
      */
     FFMpegInputBuffer(const std::vector<unsigned char>& inputBytes);
 
+    /**
+     * Constructor for input made of a header followed by a body, such as a media segment preceded by its media
+     * initialization section. Neither is copied, so both must outlive this object.
+     *
+     * @param header The bytes read first.
+     * @param body The bytes read after @c header.
+     */
+    FFMpegInputBuffer(const std::vector<unsigned char>& header, const std::vector<unsigned char>& body);
+
+    /// The input may point to the buffer owned by this object, which must therefore not be copied.
+    FFMpegInputBuffer(const FFMpegInputBuffer&) = delete;
+    FFMpegInputBuffer& operator=(const FFMpegInputBuffer&) = delete;
+
     /**
      * Copy content from input buffer to FFMpeg buffer.
      *
@@ -67,9 +80,21 @@ public:
     int64_t getSize() const;
 
 private:
-    /// Input Buffer.
+    /// Input bytes copied on construction, if any.
     std::vector<unsigned char> m_inputBytes;
 
+    /// The bytes read first.
+    const unsigned char* m_header;
+
+    /// The size of @c m_header.
+    size_t m_headerSize;
+
+    /// The bytes read after @c m_header.
+    const unsigned char* m_body;
+
+    /// The size of @c m_body.
+    size_t m_bodySize;
+
     /// Current offset.
     int64_t m_offset;
 };
@@ -84,9 +84,15 @@ private:
     /// traversal state.
     std::deque<PlayItem> m_playQueue;
 
-    /// A string to the last url parsed.
+    /// A string to the last url parsed, for live playlists without a media sequence number.
     std::string m_lastUrl;
 
+    /// The media sequence number of the last segment parsed from the live playlist at @c m_lastMediaSequenceURL.
+    long m_lastMediaSequence;
+
+    /// The URL of the last live playlist parsed which has a media sequence number.
+    std::string m_lastMediaSequenceURL;
+
     /// A flag used to abort an ongoing playlist parsing.
     std::atomic<bool> m_abort;
 };
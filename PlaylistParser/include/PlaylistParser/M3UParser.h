@@ -70,7 +70,7 @@ struct M3UContent {
      *
      * @param variantURLs The variant URLs pointing to media playlists.
      */
-    M3UContent(const std::vector<std::string>& variantURLs);
+    M3UContent(std::vector<std::string> variantURLs);
 
     /**
      * Constructor for parsed content of media playlist.
@@ -80,7 +80,7 @@ struct M3UContent {
      * @param mediaSequence The value of the EXT-X-MEDIA-SEQUENCE tag
      */
     M3UContent(
-        const std::vector<avsCommon::utils::playlistParser::PlaylistEntry>& entries,
+        std::vector<avsCommon::utils::playlistParser::PlaylistEntry> entries,
         bool isLive,
         long mediaSequence = INVALID_MEDIA_SEQUENCE);
 
@@ -119,6 +119,141 @@ struct M3UContent {
     const long mediaSequence;
 };
 
+/**
+ * A parser of M3U playlists which is fed the playlist in chunks, as they are received, rather than as a whole. The
+ * chunks may split the playlist anywhere; complete lines are scanned where they lie in the chunk, and only the lines
+ * straddling two chunks are buffered. Apart from the URLs of the entries, nothing is copied per line.
+ *
+ * When refreshing a live playlist, the parser may be given the media sequence number of the last segment already
+ * seen, in which case the segments up to that one are skipped without building their entries. Playlists without the
+ * EXT-X-MEDIA-SEQUENCE tag are parsed entirely. If the media sequence restarted below the last segment seen, every
+ * segment is skipped, which @c getLastMediaSequence() being lower than that segment reveals; the playlist must then be
+ * parsed again without skipping.
+ *
+ * This class is not thread safe.
+ */
+class M3UStreamParser {
+public:
+    /**
+     * Constructor.
+     *
+     * @param playlistURL The URL of the playlist, against which relative URLs are resolved.
+     * @param lastSeenMediaSequence The media sequence number of the last segment already seen, or
+     * @c INVALID_MEDIA_SEQUENCE to parse every segment.
+     */
+    explicit M3UStreamParser(std::string playlistURL, long lastSeenMediaSequence = INVALID_MEDIA_SEQUENCE);
+
+    /**
+     * Parse the next chunk of the playlist.
+     *
+     * @param data The chunk.
+     * @param size The size of the chunk in bytes.
+     */
+    void feed(const char* data, size_t size);
+
+    /**
+     * Parse what is left of the playlist and return its content. This must be called once, after the last chunk.
+     *
+     * @return @c M3UContent which contains the variant URLs (for a master playlist) OR the entries which were not
+     * skipped (for a media playlist).
+     */
+    M3UContent finish();
+
+    /**
+     * Whether the first line of the playlist is the Extended M3U header, as with @c isPlaylistExtendedM3U().
+     *
+     * @return @c true if the playlist is extended M3U or @c false otherwise.
+     */
+    bool isExtendedM3U() const;
+
+    /**
+     * Get the number of segments skipped because they were already seen.
+     *
+     * @return The number of segments skipped.
+     */
+    size_t getSkippedSegmentCount() const;
+
+    /**
+     * Get the media sequence number of the last segment of the playlist, to be passed to the parser of the next
+     * refresh of the playlist.
+     *
+     * @return The media sequence number of the last segment, or @c INVALID_MEDIA_SEQUENCE if the playlist has no
+     * EXT-X-MEDIA-SEQUENCE tag.
+     */
+    long getLastMediaSequence() const;
+
+private:
+    /**
+     * Parse a line of the playlist.
+     *
+     * @param begin The first character of the line.
+     * @param end Past the last character of the line, excluding the line feed.
+     */
+    void parseLine(const char* begin, const char* end);
+
+    /**
+     * Parse a line of the playlist which is a URL.
+     *
+     * @param begin The first character of the line.
+     * @param end Past the last character of the line.
+     */
+    void parseURLLine(const char* begin, const char* end);
+
+    /// The URL of the playlist.
+    const std::string m_playlistURL;
+
+    /// The media sequence number of the last segment already seen.
+    const long m_lastSeenMediaSequence;
+
+    /// The beginning of a line split across chunks.
+    std::string m_partialLine;
+
+    /// The number of lines parsed so far.
+    size_t m_lineCount;
+
+    /// Whether the first line is the Extended M3U header.
+    bool m_isFirstLineHeader;
+
+    /// Whether any line is the Extended M3U header.
+    bool m_hasHeader;
+
+    /// Whether the EXT-X-ENDLIST tag was found, after which the rest of the playlist is ignored.
+    bool m_isEndListFound;
+
+    /// Whether the playlist is a master playlist.
+    bool m_isMasterPlaylist;
+
+    /// The value of the EXT-X-MEDIA-SEQUENCE tag.
+    long m_playlistMediaSequence;
+
+    /// The number of segments found, skipped or not.
+    size_t m_segmentCount;
+
+    /// The number of segments skipped.
+    size_t m_skippedSegmentCount;
+
+    /// The duration of the next segment.
+    std::chrono::milliseconds m_duration;
+
+    /// The duration of all the segments.
+    std::chrono::milliseconds m_totalDuration;
+
+    /// The encryption of the next segment.
+    avsCommon::utils::playlistParser::EncryptionInfo m_encryptionInfo;
+
+    /// The byte range of the next segment.
+    avsCommon::utils::playlistParser::ByteRange m_byteRange;
+
+    /// The index in @c m_entries of the media initialization entry, or -1 if there is none.
+    ssize_t m_indexToMapEntry;
+
+    /// The variant URLs of a master playlist.
+    std::vector<std::string> m_variantURLs;
+
+    /// The entries of a media playlist.
+    std::vector<avsCommon::utils::playlistParser::PlaylistEntry> m_entries;
+};
+
 /**
  * Determines the playlist type of an M3U playlist.
  *
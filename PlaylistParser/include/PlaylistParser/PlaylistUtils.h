@@ -17,6 +17,7 @@
 #define ALEXA_CLIENT_SDK_PLAYLISTPARSER_INCLUDE_PLAYLISTPARSER_PLAYLISTUTILS_H_
 
 #include <chrono>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -59,6 +60,25 @@ bool readFromContentFetcher(
     std::atomic<bool>* shouldShutDown,
     std::string* playlistURL);
 
+/**
+ * Retrieves playlist content and passes it to a consumer in chunks, as it is read, rather than storing it into a
+ * string. The playlist URL is updated before the first chunk is passed.
+ *
+ * @param contentFetcher Object used to retrieve url content.
+ * @param consumer The function called with each chunk of the playlist content.
+ * @param shouldShutDown A pointer to allow for the caller to cancel the content retrieval asynchronously
+ * @param [out] playlistURL A pointer to the playlist url. This will be updated in case the last used URL to fetch
+ * the content is different.
+ * @return @c true if some content was read and no error occured or @c false otherwise.
+ * @note This function should be used to retrieve content specifically from playlist URLs. Attempting to use this
+ * on a media URL could be blocking forever as the URL might point to a live stream.
+ */
+bool readFromContentFetcher(
+    std::unique_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> contentFetcher,
+    const std::function<void(const char* data, size_t size)>& consumer,
+    std::atomic<bool>* shouldShutDown,
+    std::string* playlistURL);
+
 /**
  * Determines whether the provided url is an absolute url as opposed to a relative url. This is done by simply
  * checking to see if the string contains the substring "://".
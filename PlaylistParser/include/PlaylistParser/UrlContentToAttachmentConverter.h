@@ -17,7 +17,13 @@
 #define ALEXA_CLIENT_SDK_PLAYLISTPARSER_INCLUDE_PLAYLISTPARSER_URLCONTENTTOATTACHMENTCONVERTER_H_
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <AVSCommon/AVS/Attachment/InProcessAttachment.h>
 #include <AVSCommon/AVS/Attachment/InProcessAttachmentReader.h>
@@ -68,6 +74,9 @@ public:
         virtual void onWriteComplete() = 0;
     };
 
+    /// The default number of encrypted segments fetched and decrypted ahead of the one being written.
+    static const size_t DEFAULT_PREFETCH_SEGMENT_COUNT;
+
     /**
      * Creates a converter object. Note that calling this function will commence the parsing and streaming of the URL
      * into the internal attachment. If a desired start time is specified, this function will attempt to start streaming
@@ -84,6 +93,9 @@ public:
      * @param writeCompleteObserver An observer to be notified when data written to the attachment is complete.
      * Optional.
      * @param numOfReaders Maximum number of readers to this contentFetcher.
+     * @param prefetchSegmentCount The maximum number of AES-128 encrypted segments fetched and decrypted concurrently,
+     * by a thread of their own, ahead of the segment being written to the attachment, or 0 to fetch every segment only
+     * once the previous one has been written. Up to this number plus one decrypted segments are held in memory.
      * @return A @c std::shared_ptr to the new @c UrlContentToAttachmentConverter object or @c nullptr on failure.
      *
      * @note This object is intended to be used once. Subsequent calls to @c convertPlaylistToAttachment() will fail.
@@ -94,7 +106,8 @@ public:
         std::shared_ptr<ErrorObserverInterface> observer,
         std::chrono::milliseconds startTime = std::chrono::milliseconds::zero(),
         std::shared_ptr<WriteCompleteObserverInterface> writeCompleteObserver = nullptr,
-        size_t numOfReaders = 1);
+        size_t numOfReaders = 1,
+        size_t prefetchSegmentCount = DEFAULT_PREFETCH_SEGMENT_COUNT);
 
     /**
      * Returns the attachment into which the URL content was streamed into.
@@ -117,9 +130,64 @@ public:
      */
     std::chrono::milliseconds getDesiredStreamingPoint();
 
+    /**
+     * Destructor.
+     */
+    ~UrlContentToAttachmentConverter();
+
     void doShutdown() override;
 
 private:
+    /// An AES-128 encrypted segment which @c m_prefetchThread fetches and decrypts ahead of it being written.
+    struct PrefetchSegment {
+        /**
+         * Constructor.
+         *
+         * @param url The URL of the segment.
+         * @param headers HTTP headers to pass to server.
+         * @param encryptionInfo The Encryption info of the segment.
+         * @param contentFetcher The content fetcher to use to retrieve the segment. Can be a null pointer.
+         */
+        PrefetchSegment(
+            std::string url,
+            std::vector<std::string> headers,
+            avsCommon::utils::playlistParser::EncryptionInfo encryptionInfo,
+            std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> contentFetcher);
+
+        /// The URL of the segment.
+        const std::string url;
+
+        /// HTTP headers to pass to server.
+        const std::vector<std::string> headers;
+
+        /// The Encryption info of the segment.
+        const avsCommon::utils::playlistParser::EncryptionInfo encryptionInfo;
+
+        /// The content fetcher retrieving the segment, which is created when the fetch starts if none was given.
+        std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> contentFetcher;
+
+        /// The promise of the decrypted content of the segment, which is @c nullptr on failure.
+        std::promise<std::shared_ptr<ByteVector>> promise;
+
+        /// The writer into which @c contentFetcher downloads the segment.
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter> writer;
+
+        /// The non-blocking reader of what was downloaded so far.
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> reader;
+
+        /// Whether @c writer was closed because the download is over.
+        bool isWriterClosed;
+
+        /// The content read so far, decrypted in place as whole blocks arrive.
+        std::shared_ptr<ByteVector> content;
+
+        /// The decrypter of the segment.
+        AESStreamDecrypter decrypter;
+
+        /// Whether the content read so far could be decrypted.
+        bool isDecrypted;
+    };
+
     /**
      * Constructor.
      *
@@ -132,6 +200,7 @@ private:
      * @param writeCompleteObserver An observer to be notified when data written to the attachment is complete.
      * Optional.
      * @param numOfReaders Maximum number of readers to this contentFetcher.
+     * @param prefetchSegmentCount The maximum number of encrypted segments fetched ahead of the one being written.
      */
     UrlContentToAttachmentConverter(
         std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
@@ -139,7 +208,8 @@ private:
         std::shared_ptr<ErrorObserverInterface> observer,
         std::chrono::milliseconds startTime,
         std::shared_ptr<WriteCompleteObserverInterface> writeCompleteObserver,
-        size_t numOfReaders);
+        size_t numOfReaders,
+        size_t prefetchSegmentCount);
 
     void onPlaylistEntryParsed(int requestId, avsCommon::utils::playlistParser::PlaylistEntry playlistEntry) override;
 
@@ -153,6 +223,63 @@ private:
      **/
     void notifyWriteComplete();
 
+    /**
+     * Helper to decide if a segment should be fetched and decrypted ahead of being written.
+     *
+     * @param encryptionInfo EncryptionInfo of the Media URL.
+     * @return @c true if the segment should be prefetched or @c false otherwise.
+     */
+    bool shouldPrefetch(const avsCommon::utils::playlistParser::EncryptionInfo& encryptionInfo) const;
+
+    /**
+     * Queues the fetch and decryption of an AES-128 encrypted segment on @c m_prefetchThread.
+     *
+     * @param url The URL to download.
+     * @param headers HTTP headers to pass to server.
+     * @param encryptionInfo The Encryption info for the URL to download.
+     * @param contentFetcher The content fetcher to use to retrieve content. Can be a null pointer.
+     * @return A future for the decrypted content of the segment, which is @c nullptr on failure.
+     */
+    std::shared_future<std::shared_ptr<ByteVector>> prefetchSegment(
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        const avsCommon::utils::playlistParser::EncryptionInfo& encryptionInfo,
+        std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> contentFetcher);
+
+    /**
+     * The loop of @c m_prefetchThread. It starts fetching the queued segments in order, as long as they are at most
+     * @c m_prefetchSegmentCount segments ahead of the one being written, and reads and decrypts all the segments being
+     * fetched as their bodies arrive, without waiting for any of them. It fails the segments left on shutdown.
+     */
+    void prefetchLoop();
+
+    /**
+     * Starts fetching a segment, once its key is known. Called by @c m_prefetchThread.
+     *
+     * @param segment The segment.
+     * @return @c true if the fetch started or @c false otherwise.
+     */
+    bool startPrefetch(PrefetchSegment* segment);
+
+    /**
+     * Reads and decrypts what has arrived of a segment being fetched, without blocking, and fulfills the promise of
+     * the segment once its download is over. Called by @c m_prefetchThread.
+     *
+     * @param segment The segment.
+     * @param[out] hasProgressed Set to @c true if any content was read.
+     * @return @c true if the segment is still being fetched or @c false once its promise is fulfilled.
+     */
+    bool continuePrefetch(PrefetchSegment* segment, bool* hasProgressed);
+
+    /**
+     * Gets an encryption key, downloading it only if it differs from the key of the previous segment.
+     *
+     * @param keyURL The URL of the key.
+     * @param[out] key The key.
+     * @return @c true if the key was found or @c false otherwise.
+     */
+    bool getKey(const std::string& keyURL, ByteVector* key);
+
     /**
      * @name Executor Thread Functions
      *
@@ -177,6 +304,30 @@ private:
         avsCommon::utils::playlistParser::EncryptionInfo encryptionInfo,
         std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> contentFetcher);
 
+    /**
+     * Writes a prefetched segment into the internal stream once it has been fetched, and lets the next segment be
+     * prefetched.
+     *
+     * @param segment The future for the decrypted content of the segment.
+     * @return @c true if the content was successfully fetched and written or @c false otherwise.
+     */
+    bool writePrefetchedSegmentIntoStream(std::shared_future<std::shared_ptr<ByteVector>> segment);
+
+    /**
+     * Starts downloading the content from the url into the stream, without waiting for the body to be downloaded.
+     *
+     * @param url The URL to download.
+     * @param headers HTTP headers to pass to server.
+     * @param streamWriter The attachment writer to write downloaded content.
+     * @param contentFetcher The content fetcher to use to retrieve content. Can be a null pointer.
+     * @return The content fetcher downloading the body or @c nullptr on failure.
+     */
+    std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> startDownload(
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter> streamWriter,
+        std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> contentFetcher);
+
     /**
      * Downloads the content from the url and writes to the stream.
      *
@@ -212,9 +363,13 @@ private:
      *
      * @param reader The AttachmentReder to read content from.
      * @param[out] content Sets the content of the pointer if read is successful.
+     * @param decrypter If not null, decrypts the content in place as it is read.
      * @return @c true if the content was successfully read or @c false otherwise.
      */
-    bool readContent(std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> reader, ByteVector* content);
+    bool readContent(
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> reader,
+        ByteVector* content,
+        AESStreamDecrypter* decrypter = nullptr);
 
     /**
      * Helper to decide if decryption is required.
@@ -264,6 +419,30 @@ private:
     /// Helper to remove ID3 tags from content.
     std::shared_ptr<Id3TagsRemover> m_id3TagsRemover;
 
+    /// The maximum number of encrypted segments fetched ahead of the one being written.
+    const size_t m_prefetchSegmentCount;
+
+    /// Serializes access to @c m_segmentsToPrefetch and @c m_segmentsWritten.
+    std::mutex m_prefetchMutex;
+
+    /// Notified when a segment is queued to be prefetched, a prefetched segment has been written, or on shutdown.
+    std::condition_variable m_prefetchTrigger;
+
+    /// The segments queued to be prefetched, which @c m_prefetchThread has not started fetching.
+    std::deque<std::unique_ptr<PrefetchSegment>> m_segmentsToPrefetch;
+
+    /// The number of prefetched segments written, or skipped because the stream writer is closed.
+    size_t m_segmentsWritten;
+
+    /// Serializes access to @c m_keyURL and @c m_key, and the download of keys so that each is downloaded once.
+    std::mutex m_keyMutex;
+
+    /// The URL of the last key downloaded.
+    std::string m_keyURL;
+
+    /// The last key downloaded, which is usually the key of the next segment too.
+    ByteVector m_key;
+
     /**
      * @name @c onPlaylistEntryParsed Callback Variables
      *
@@ -303,6 +482,13 @@ private:
      *     before the Executor Thread Variables are destroyed.
      */
     avsCommon::utils::threading::Executor m_executor;
+
+    /**
+     * The thread which fetches and decrypts encrypted segments ahead of @c m_executor writing them, if
+     * @c m_prefetchSegmentCount is not zero. Since content fetchers download bodies asynchronously, it fetches several
+     * segments at once, only waiting for the key and the header of each segment as it starts fetching it.
+     */
+    std::thread m_prefetchThread;
 };
 
 }  // namespace playlistParser
@@ -15,8 +15,9 @@
 
 #include "PlaylistParser/ContentDecrypter.h"
 
+#include <algorithm>
+#include <climits>
 #include <iomanip>
-#include <openssl/evp.h>
 
 #ifdef ENABLE_SAMPLE_AES
 extern "C" {
@@ -38,14 +39,6 @@ namespace playlistParser {
 using namespace avsCommon::utils::playlistParser;
 using namespace avsCommon::avs::attachment;
 
-/// Unique ptr to auto release EVP_CIPHER_CTX.
-struct EVP_CIPHER_CTX_Deleter {
-    void operator()(EVP_CIPHER_CTX* ctx) {
-        EVP_CIPHER_CTX_free(ctx);
-    }
-};
-using EVP_CIPHER_CTX_free_ptr = std::unique_ptr<EVP_CIPHER_CTX, EVP_CIPHER_CTX_Deleter>;
-
 /// String to identify log entries originating from this file.
 #define TAG "ContentDecrypter"
 
@@ -199,6 +192,103 @@ std::string ffmpegErrToStr(int err) {
 }
 #endif  // ENABLE_SAMPLE_AES
 
+AESStreamDecrypter::AESStreamDecrypter() :
+        m_context{EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free},
+        m_usePadding{true},
+        m_decryptedSize{0} {
+}
+
+bool AESStreamDecrypter::init(const ByteVector& key, const ByteVector& iv, bool usePadding) {
+    auto logFailure = [](const std::string& reason) { ACSDK_ERROR(LX("initDecryptionFailed").d("reason", reason)); };
+
+    if (!m_context) {
+        logFailure("EVPContextIsNULL");
+        return false;
+    }
+    if (key.size() != static_cast<ByteVector::size_type>(EVP_CIPHER_key_length(EVP_aes_128_cbc()))) {
+        logFailure("InvalidKeyLength");
+        return false;
+    }
+    if (iv.size() != static_cast<ByteVector::size_type>(EVP_CIPHER_iv_length(EVP_aes_128_cbc()))) {
+        logFailure("InvalidIVLength");
+        return false;
+    }
+    if (!EVP_DecryptInit_ex(m_context.get(), EVP_aes_128_cbc(), NULL, key.data(), iv.data())) {
+        logFailure("UnableToInitializeDecryption");
+        return false;
+    }
+
+    // Padding is removed by finish() instead of EVP, which would hold back the last block of every update and so
+    // prevent decrypting in place.
+    EVP_CIPHER_CTX_set_padding(m_context.get(), 0);
+    m_usePadding = usePadding;
+    m_decryptedSize = 0;
+    return true;
+}
+
+bool AESStreamDecrypter::decryptBlocks(unsigned char* data, size_t size) {
+    if (!m_context || !data || size % AES_BLOCK_SIZE != 0 || size > INT_MAX) {
+        ACSDK_ERROR(LX("decryptBlocksFailed").d("reason", "invalidBlocks").d("size", size));
+        return false;
+    }
+
+    int len = 0;
+    if (!EVP_DecryptUpdate(m_context.get(), data, &len, data, static_cast<int>(size)) ||
+        static_cast<size_t>(len) != size) {
+        ACSDK_ERROR(LX("decryptBlocksFailed").d("reason", "UnableToDecryptUpdate").d("size", size));
+        return false;
+    }
+    return true;
+}
+
+bool AESStreamDecrypter::update(ByteVector* content) {
+    if (!content || content->size() < m_decryptedSize) {
+        ACSDK_ERROR(LX("updateDecryptionFailed").d("reason", "invalidContent"));
+        return false;
+    }
+
+    auto size = (content->size() - m_decryptedSize) / AES_BLOCK_SIZE * AES_BLOCK_SIZE;
+    if (size > 0) {
+        if (!decryptBlocks(content->data() + m_decryptedSize, size)) {
+            return false;
+        }
+        m_decryptedSize += size;
+    }
+    return true;
+}
+
+bool AESStreamDecrypter::finish(ByteVector* content) {
+    auto logFailure = [](const std::string& reason) {
+        ACSDK_ERROR(LX("finishDecryptionFailed").d("reason", reason));
+    };
+
+    if (!update(content)) {
+        return false;
+    }
+    if (m_decryptedSize != content->size()) {
+        logFailure("partialBlock");
+        return false;
+    }
+    if (!m_usePadding) {
+        return true;
+    }
+
+    if (content->empty()) {
+        logFailure("missingPadding");
+        return false;
+    }
+    auto paddingSize = content->back();
+    if (0 == paddingSize || paddingSize > AES_BLOCK_SIZE ||
+        std::any_of(content->end() - paddingSize, content->end(), [paddingSize](unsigned char byte) {
+            return byte != paddingSize;
+        })) {
+        logFailure("invalidPadding");
+        return false;
+    }
+    content->resize(content->size() - paddingSize);
+    return true;
+}
+
 ContentDecrypter::ContentDecrypter() :
         RequiresShutdown{"ContentDecrypter"},
         m_needWavHeader{false},
@@ -237,6 +327,20 @@ bool ContentDecrypter::decryptAndWrite(
     const EncryptionInfo& encryptionInfo,
     const std::shared_ptr<AttachmentWriter>& streamWriter,
     const std::shared_ptr<Id3TagsRemover>& id3TagRemover) {
+    auto content = encryptedContent;
+    return decryptAndWrite(&content, key, encryptionInfo, streamWriter, id3TagRemover);
+}
+
+bool ContentDecrypter::decryptAndWrite(
+    ByteVector* content,
+    const ByteVector& key,
+    const EncryptionInfo& encryptionInfo,
+    const std::shared_ptr<AttachmentWriter>& streamWriter,
+    const std::shared_ptr<Id3TagsRemover>& id3TagRemover) {
+    if (!content) {
+        ACSDK_ERROR(LX("decryptAndWriteFailed").d("reason", "nullContent"));
+        return false;
+    }
     if (!id3TagRemover) {
         ACSDK_WARN(LX("decryptAndWriteFailed").d("reason", "nullId3TagRemover"));
         // fallback to not remove ID3 tags
@@ -248,17 +352,16 @@ bool ContentDecrypter::decryptAndWrite(
         return false;
     }
 
-    ByteVector decryptedContent;
     switch (encryptionInfo.method) {
         case EncryptionInfo::Method::AES_128:
-            if (!decryptAES(encryptedContent, key, ivByteArray, &decryptedContent)) {
+            if (!decryptAES(content, key, ivByteArray)) {
                 ACSDK_ERROR(LX("decryptAndWriteFailed").d("reason", "aes128DecryptionFailed"));
                 return false;
             }
             break;
         case EncryptionInfo::Method::SAMPLE_AES:
 #ifdef ENABLE_SAMPLE_AES
-            if (!decryptSampleAES(encryptedContent, key, ivByteArray, streamWriter)) {
+            if (!decryptSampleAES(*content, key, ivByteArray, streamWriter)) {
                 ACSDK_ERROR(LX("decryptAndWriteFailed").d("reason", "sampleAESDecryptionFailed"));
                 return false;
             }
@@ -277,9 +380,9 @@ bool ContentDecrypter::decryptAndWrite(
     }
 
     if (id3TagRemover) {
-        id3TagRemover->stripID3Tags(decryptedContent);
+        id3TagRemover->stripID3Tags(*content);
     }
-    if (!writeToStream(decryptedContent, streamWriter)) {
+    if (!writeToStream(*content, streamWriter)) {
         ACSDK_ERROR(LX("decryptAndWriteFailed").d("reason", "writeFailed"));
         return false;
     }
@@ -321,72 +424,17 @@ bool ContentDecrypter::convertIVToByteArray(const std::string& hexIV, ByteVector
     return true;
 }
 
-int ContentDecrypter::decryptAES(
-    const ByteVector& encryptedContent,
-    const ByteVector& key,
-    const ByteVector& iv,
-    ByteVector* decryptedContent,
-    bool usePadding) {
-    auto logFailure = [](const std::string& reason) { ACSDK_ERROR(LX("decryptAESFailed").d("reason", reason)); };
-
-    if (!decryptedContent) {
-        logFailure("nullDecryptedContent");
-        return 0;
-    }
-
-    auto inputSize = encryptedContent.size();
-    ByteVector output(inputSize);
-
-    int outputSize = 0;
-    int len = 0;
-    EVP_CIPHER_CTX_free_ptr ctx(EVP_CIPHER_CTX_new());
-    if (!ctx.get()) {
-        logFailure("EVPContextIsNULL");
-        return 0;
-    }
-    if (key.size() != static_cast<ByteVector::size_type>(EVP_CIPHER_key_length(EVP_aes_128_cbc()))) {
-        logFailure("InvalidKeyLength");
-        return 0;
-    }
-    if (iv.size() != static_cast<ByteVector::size_type>(EVP_CIPHER_iv_length(EVP_aes_128_cbc()))) {
-        logFailure("InvalidIVLength");
-        return 0;
-    }
-    if (!EVP_DecryptInit_ex(ctx.get(), EVP_aes_128_cbc(), NULL, key.data(), iv.data())) {
-        logFailure("UnableToInitializeDecryption");
-        return 0;
-    }
-
-    EVP_CIPHER_CTX_set_padding(ctx.get(), usePadding);
-
-    if (!EVP_DecryptUpdate(ctx.get(), output.data(), &len, encryptedContent.data(), static_cast<int>(inputSize))) {
-        logFailure("UnableToDecryptUpdate");
-        return 0;
-    }
-    outputSize = len;
-
-    if (!EVP_DecryptFinal_ex(ctx.get(), output.data() + len, &len)) {
-        logFailure("UnableToDecryptFinalize");
-        return 0;
+bool ContentDecrypter::decryptAES(ByteVector* content, const ByteVector& key, const ByteVector& iv) {
+    if (!content) {
+        ACSDK_ERROR(LX("decryptAESFailed").d("reason", "nullContent"));
+        return false;
     }
-    outputSize += len;
 
-    output.resize(outputSize);
-    *decryptedContent = output;
-    return outputSize;
+    AESStreamDecrypter decrypter;
+    return decrypter.init(key, iv) && decrypter.finish(content);
 }
 
 #ifdef ENABLE_SAMPLE_AES
-ByteVector ContentDecrypter::prependMediaInitSection(const ByteVector& bytes) const {
-    ByteVector result;
-    result.reserve(m_mediaInitSection.size() + bytes.size());
-    if (m_mediaInitSection.size() > 0) {
-        result.insert(result.end(), m_mediaInitSection.begin(), m_mediaInitSection.end());
-    }
-    result.insert(result.end(), bytes.begin(), bytes.end());
-    return result;
-}
-
 static size_t findMDATLocation(const ByteVector& bytes) {
     auto size = bytes.size();
     if (size < 4) {
@@ -438,7 +486,7 @@ bool ContentDecrypter::decryptSampleAES(
     int mdatLocation = findMDATLocation(encryptedContent);
 
     // Tag on the media initialization section to the input.
-    FFMpegInputBuffer input(prependMediaInitSection(encryptedContent));
+    FFMpegInputBuffer input(m_mediaInitSection, encryptedContent);
     auto avBuffer = static_cast<unsigned char*>(av_malloc(AV_BUFFER_SIZE));
     if (!avBuffer) {
         ACSDK_ERROR(LX("decryptSampleAESFailed").d("reason", "avBufferMallocFailed"));
@@ -500,6 +548,7 @@ bool ContentDecrypter::decryptSampleAES(
         return false;
     }
 
+    AESStreamDecrypter decrypter;
     AVPacket packet;
     while ((averror = av_read_frame(formatContext.get(), &packet)) >= 0) {
         AVPacketPtr packetPtr(&packet);
@@ -529,18 +578,13 @@ bool ContentDecrypter::decryptSampleAES(
             int numBlocks = remaining / AES_BLOCK_SIZE;
             int encryptedSize = AES_BLOCK_SIZE * numBlocks;
 
-            ByteVector decryptedBytes;
-            auto decryptSize = decryptAES(ByteVector(pFrame, pFrame + encryptedSize), key, iv, &decryptedBytes, false);
-            // Confirm encryptedSize == decryptSize
-            if (encryptedSize != decryptSize) {
+            // Each sample is encrypted on its own, starting from the initialization vector.
+            if (!decrypter.init(key, iv, false) || !decrypter.decryptBlocks(pFrame, encryptedSize)) {
                 ACSDK_ERROR(LX("decryptSampleAESFailed")
-                                .d("reason", "encryptedSizeNotEqualDecryptedSize")
-                                .d("encryptedSize", encryptedSize)
-                                .d("decryptSize", decryptSize));
+                                .d("reason", "decryptSampleFailed")
+                                .d("encryptedSize", encryptedSize));
                 return false;
             }
-
-            memcpy(pFrame, decryptedBytes.data(), decryptSize);
         }
 
         // If mdatLocation is invalid, content is not fragmented mp4 and does not need to be decoded.
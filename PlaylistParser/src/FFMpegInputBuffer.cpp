@@ -14,11 +14,25 @@
  */
 #include "PlaylistParser/FFMpegInputBuffer.h"
 
+#include <algorithm>
+
 namespace alexaClientSDK {
 namespace playlistParser {
 
 FFMpegInputBuffer::FFMpegInputBuffer(const std::vector<unsigned char>& inputBytes) :
         m_inputBytes(inputBytes),
+        m_header(nullptr),
+        m_headerSize(0),
+        m_body(m_inputBytes.data()),
+        m_bodySize(m_inputBytes.size()),
+        m_offset(0) {
+}
+
+FFMpegInputBuffer::FFMpegInputBuffer(const std::vector<unsigned char>& header, const std::vector<unsigned char>& body) :
+        m_header(header.data()),
+        m_headerSize(header.size()),
+        m_body(body.data()),
+        m_bodySize(body.size()),
         m_offset(0) {
 }
 
@@ -29,9 +43,15 @@ int FFMpegInputBuffer::read(int size, uint8_t* data) {
 
     auto remainingSize = getSize() - m_offset;
     auto readSize = (remainingSize < size) ? remainingSize : size;
-    if (readSize > 0) {
-        std::memcpy(data, m_inputBytes.data() + m_offset, readSize);
-        m_offset += readSize;
+    int64_t bytesCopied = 0;
+    while (bytesCopied < readSize) {
+        auto headerSize = static_cast<int64_t>(m_headerSize);
+        auto source = (m_offset < headerSize) ? m_header + m_offset : m_body + (m_offset - headerSize);
+        auto available = (m_offset < headerSize) ? headerSize - m_offset : getSize() - m_offset;
+        auto copySize = std::min(available, readSize - bytesCopied);
+        std::memcpy(data + bytesCopied, source, copySize);
+        bytesCopied += copySize;
+        m_offset += copySize;
     }
     return static_cast<int>(readSize);
 }
@@ -49,7 +69,7 @@ int64_t FFMpegInputBuffer::getOffset() const {
 }
 
 int64_t FFMpegInputBuffer::getSize() const {
-    return static_cast<int64_t>(m_inputBytes.size());
+    return static_cast<int64_t>(m_headerSize + m_bodySize);
 }
 
 }  // namespace playlistParser
@@ -66,6 +66,8 @@ bool IterativePlaylistParser::initializeParsing(std::string url) {
 
     m_abort = false;
     m_lastUrl.clear();
+    m_lastMediaSequence = INVALID_MEDIA_SEQUENCE;
+    m_lastMediaSequenceURL.clear();
     m_playQueue.clear();
     m_playQueue.push_back(PlayItem(url));
     return true;
@@ -74,6 +76,7 @@ bool IterativePlaylistParser::initializeParsing(std::string url) {
 IterativePlaylistParser::IterativePlaylistParser(
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory) :
         m_contentFetcherFactory{contentFetcherFactory},
+        m_lastMediaSequence{INVALID_MEDIA_SEQUENCE},
         m_abort{false} {
 }
 
@@ -112,27 +115,39 @@ PlaylistEntry IterativePlaylistParser::next() {
         std::string lowerCaseContentType = stringToLowerCase(header.contentType);
         // Checking the HTML content type to see if the URL is a playlist.
         if (lowerCaseContentType.find(M3U_CONTENT_TYPE) != std::string::npos) {
-            std::string playlistContent;
+            // The playlist is parsed as it is read, once its effective URL is known. When refreshing a live playlist,
+            // the segments already seen are skipped.
+            std::unique_ptr<M3UStreamParser> m3uParser;
+            auto parseChunk = [this, &m3uParser, &playlistURL](const char* data, size_t size) {
+                if (!m3uParser) {
+                    auto lastMediaSequence =
+                        (playlistURL == m_lastMediaSequenceURL) ? m_lastMediaSequence : INVALID_MEDIA_SEQUENCE;
+                    m3uParser.reset(new M3UStreamParser(playlistURL, lastMediaSequence));
+                }
+                m3uParser->feed(data, size);
+            };
             auto contentFetcher = m_contentFetcherFactory->create(playlistURL);
             contentFetcher->getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
-            if (!readFromContentFetcher(std::move(contentFetcher), &playlistContent, &m_abort, &playlistURL)) {
+            if (!readFromContentFetcher(std::move(contentFetcher), parseChunk, &m_abort, &playlistURL)) {
                 ACSDK_ERROR(LX("nextFailed").d("reason", "failedToRetrieveContent").sensitive("url", playlistURL));
                 return PlaylistEntry::createErrorEntry(playlistURL);
             }
+            auto m3uContent = m3uParser->finish();
             // This playlist may either be M3U or EXT_M3U so some additional parsing is required.
-            bool isExtendedM3U = isPlaylistExtendedM3U(playlistContent);
+            bool isExtendedM3U = m3uParser->isExtendedM3U();
             if (isExtendedM3U) {
                 ACSDK_DEBUG9(LX("isExtendedM3U").sensitive("url", playlistURL));
             } else {
                 ACSDK_DEBUG9(LX("isPlainM3UPlaylist").sensitive("url", playlistURL));
             }
-            auto m3uContent = parseM3UContent(playlistURL, playlistContent);
-            if (m3uContent.empty()) {
+            // A refreshed live playlist may have no new segments.
+            if (m3uContent.empty() && 0 == m3uParser->getSkippedSegmentCount()) {
                 ACSDK_ERROR(LX("nextFailed").d("reason", "noChildrenURLs"));
                 return PlaylistEntry::createErrorEntry(playlistURL);
             }
-            ACSDK_DEBUG9((
-                LX("foundChildrenURLsInPlaylist").d("num", m3uContent.entries.size() + m3uContent.variantURLs.size())));
+            ACSDK_DEBUG9(LX("foundChildrenURLsInPlaylist")
+                             .d("num", m3uContent.entries.size() + m3uContent.variantURLs.size())
+                             .d("skipped", m3uParser->getSkippedSegmentCount()));
             if (isExtendedM3U) {
                 if (m3uContent.isMasterPlaylist()) {
                     // Indicates that we found a Variant Stream and that only one URL should be chosen from here
@@ -141,10 +156,30 @@ PlaylistEntry IterativePlaylistParser::next() {
                     // URL as a default.
                     m_playQueue.push_front(PlayItem(m3uContent.variantURLs.front()));
                 } else {
-                    auto entries = m3uContent.entries;
-                    // m_lastUrl is set when we actually parse some urls from the playlist - here, it is our
-                    // first pass at this playlist
-                    if (m_lastUrl.empty()) {
+                    const auto& entries = m3uContent.entries;
+                    auto lastMediaSequence = m3uParser->getLastMediaSequence();
+                    if (m3uContent.hasMediaSequence() && playlistURL == m_lastMediaSequenceURL &&
+                        lastMediaSequence < m_lastMediaSequence) {
+                        // The sequence restarted, so every segment of this refresh was skipped although none was
+                        // seen. The playlist is fetched again and parsed without skipping any segment.
+                        ACSDK_WARN(LX("mediaSequenceRestarted")
+                                       .d("lastSeen", m_lastMediaSequence)
+                                       .d("last", lastMediaSequence));
+                        m_lastMediaSequence = INVALID_MEDIA_SEQUENCE;
+                        m_lastMediaSequenceURL.clear();
+                        m_playQueue.push_front(PlayItem(playlistURL));
+                        continue;
+                    }
+                    if (m3uContent.hasMediaSequence()) {
+                        // The segments up to the last one seen were skipped by the parser, so every entry is new.
+                        for (auto reverseIt = entries.rbegin(); reverseIt != entries.rend(); ++reverseIt) {
+                            m_playQueue.push_front(*reverseIt);
+                        }
+                        m_lastMediaSequence = lastMediaSequence;
+                        m_lastMediaSequenceURL = playlistURL;
+                    } else if (m_lastUrl.empty()) {
+                        // m_lastUrl is set when we actually parse some urls from the playlist - here, it is our
+                        // first pass at this playlist
                         for (auto reverseIt = entries.rbegin(); reverseIt != entries.rend(); ++reverseIt) {
                             m_playQueue.push_front(*reverseIt);
                         }
@@ -163,8 +198,7 @@ PlaylistEntry IterativePlaylistParser::next() {
                         }
                         for (int i = static_cast<int>(entries.size() - 1); i >= startPointForNewURLsAdded; --i) {
                             ACSDK_DEBUG9(LX("foundNewURLInLivePlaylist"));
-                            auto entry = entries.at(i);
-                            m_playQueue.push_front(entry);
+                            m_playQueue.push_front(entries.at(i));
                         }
                         m_lastUrl = entries.back().url;
                     }
@@ -183,7 +217,7 @@ PlaylistEntry IterativePlaylistParser::next() {
             } else {
                 // This is a plain M3U playlist. Plain M3U playlist can contain either media URLs or playlist URLs.
                 // URLs found in plain M3U playlist are added to the playQueue for further processing.
-                auto entries = m3uContent.entries;
+                const auto& entries = m3uContent.entries;
                 for (auto reverseIt = entries.rbegin(); reverseIt != entries.rend(); ++reverseIt) {
                     m_playQueue.push_front(reverseIt->url);
                 }
@@ -14,7 +14,9 @@
  */
 
 #include <cctype>
-#include <iomanip>
+#include <cstdio>
+#include <cstring>
+#include <limits>
 #include <sstream>
 
 #include <AVSCommon/Utils/Logger/Logger.h>
@@ -98,10 +100,11 @@ static const int IV_HEX_STRING_LENGTH = 32;
 /**
  * Helper method to parse runtime from #EXTINF tag.
  *
- * @param line The #EXTINF line in HLS playlist.
+ * @param begin The first character of the #EXTINF line in HLS playlist.
+ * @param end Past the last character of the line.
  * @return parsed runtime in milliseconds from line.
  */
-std::chrono::milliseconds parseRuntime(const std::string& line);
+static std::chrono::milliseconds parseRuntime(const char* begin, const char* end);
 
 /**
  * Helper method to convert a line in HLS playlist to absolute URL.
@@ -114,14 +117,16 @@ std::chrono::milliseconds parseRuntime(const std::string& line);
 bool getAbsoluteURL(const std::string& baseURL, const std::string& url, std::string* absoluteURL);
 
 /**
- * Helper method to check if line starts with prefix.
+ * Helper method to check if a line starts with prefix.
  *
- * @param line A HLS line.
+ * @param begin The first character of a HLS line.
+ * @param end Past the last character of the line.
  * @param prefix The prefix to check.
- * @return @c true if @c line starts with @c prefix, @c false otherwise.
+ * @return @c true if the line starts with @c prefix, @c false otherwise.
  */
-inline bool hasPrefix(const std::string& line, const std::string& prefix) {
-    return line.compare(0, prefix.length(), prefix) == 0;
+static inline bool hasPrefix(const char* begin, const char* end, const std::string& prefix) {
+    return static_cast<size_t>(end - begin) >= prefix.length() &&
+           std::memcmp(begin, prefix.data(), prefix.length()) == 0;
 }
 
 PlayItem::PlayItem(std::string playlistURL) : type(Type::PLAYLIST_URL), playlistURL(playlistURL) {
@@ -130,14 +135,14 @@ PlayItem::PlayItem(std::string playlistURL) : type(Type::PLAYLIST_URL), playlist
 PlayItem::PlayItem(PlaylistEntry playlistEntry) : type(Type::MEDIA_INFO), playlistEntry(playlistEntry) {
 }
 
-M3UContent::M3UContent(const std::vector<std::string>& variantURLs) :
-        variantURLs(variantURLs),
+M3UContent::M3UContent(std::vector<std::string> variantURLs) :
+        variantURLs(std::move(variantURLs)),
         isLive(false),
         mediaSequence(INVALID_MEDIA_SEQUENCE) {
 }
 
-M3UContent::M3UContent(const std::vector<PlaylistEntry>& entries, bool isLive, long mediaSequence) :
-        entries(entries),
+M3UContent::M3UContent(std::vector<PlaylistEntry> entries, bool isLive, long mediaSequence) :
+        entries(std::move(entries)),
         isLive(isLive),
         mediaSequence(mediaSequence) {
 }
@@ -155,106 +160,185 @@ bool M3UContent::empty() const {
 }
 
 static std::string to16ByteHexString(int number) {
-    std::stringstream ss;
-    ss << "0x" << std::setfill('0') << std::setw(IV_HEX_STRING_LENGTH) << std::hex << number;
-    return ss.str();
+    char hex[IV_HEX_STRING_LENGTH + 3];
+    std::snprintf(hex, sizeof(hex), "0x%0*x", IV_HEX_STRING_LENGTH, static_cast<unsigned int>(number));
+    return hex;
 }
 
-M3UContent parseM3UContent(const std::string& playlistURL, const std::string& content) {
+M3UStreamParser::M3UStreamParser(std::string playlistURL, long lastSeenMediaSequence) :
+        m_playlistURL{std::move(playlistURL)},
+        m_lastSeenMediaSequence{lastSeenMediaSequence},
+        m_lineCount{0},
+        m_isFirstLineHeader{false},
+        m_hasHeader{false},
+        m_isEndListFound{false},
+        m_isMasterPlaylist{false},
+        m_playlistMediaSequence{INVALID_MEDIA_SEQUENCE},
+        m_segmentCount{0},
+        m_skippedSegmentCount{0},
+        m_duration{INVALID_DURATION},
+        m_totalDuration{std::chrono::milliseconds::zero()},
+        m_byteRange{std::make_tuple(0, 0)},
+        m_indexToMapEntry{-1} {
+}
+
+void M3UStreamParser::feed(const char* data, size_t size) {
+    if (!data) {
+        return;
+    }
+    auto end = data + size;
+    while (data < end && !m_isEndListFound) {
+        auto lineEnd = static_cast<const char*>(std::memchr(data, '\n', end - data));
+        if (!lineEnd) {
+            m_partialLine.append(data, end);
+            return;
+        }
+        if (m_partialLine.empty()) {
+            parseLine(data, lineEnd);
+        } else {
+            m_partialLine.append(data, lineEnd);
+            parseLine(m_partialLine.data(), m_partialLine.data() + m_partialLine.size());
+            m_partialLine.clear();
+        }
+        data = lineEnd + 1;
+    }
+}
+
+M3UContent M3UStreamParser::finish() {
+    if (!m_partialLine.empty() && !m_isEndListFound) {
+        parseLine(m_partialLine.data(), m_partialLine.data() + m_partialLine.size());
+    }
+    m_partialLine.clear();
+
+    if (!m_hasHeader && !m_entries.empty()) {
+        m_entries.back().parseResult = PlaylistParseResult::FINISHED;
+    }
+
+    if (m_isMasterPlaylist) {
+        return M3UContent(std::move(m_variantURLs));
+    }
+    if (m_indexToMapEntry >= 0) {
+        m_entries[m_indexToMapEntry].encryptionInfo.totalDuration = m_totalDuration;
+    }
+    return M3UContent(std::move(m_entries), !m_isEndListFound, m_playlistMediaSequence);
+}
+
+bool M3UStreamParser::isExtendedM3U() const {
+    return m_isFirstLineHeader;
+}
+
+size_t M3UStreamParser::getSkippedSegmentCount() const {
+    return m_skippedSegmentCount;
+}
+
+long M3UStreamParser::getLastMediaSequence() const {
+    if (INVALID_MEDIA_SEQUENCE == m_playlistMediaSequence) {
+        return INVALID_MEDIA_SEQUENCE;
+    }
+    return m_playlistMediaSequence + static_cast<long>(m_segmentCount) - 1;
+}
+
+void M3UStreamParser::parseLine(const char* begin, const char* end) {
     /*
      * An M3U playlist is formatted such that all metadata information is prepended with a '#' and everything else is a
      * URL to play.
      */
-    std::istringstream iss(content);
-    std::string line;
-
-    auto isPlaylistExtendedM3U = false;
-    auto playlistMediaSequence = INVALID_MEDIA_SEQUENCE;
-    auto isLive = true;
-    auto isMasterPlaylist = false;
-    auto duration = INVALID_DURATION;
-    auto totalDuration = std::chrono::milliseconds::zero();
-    auto encryptionInfo = EncryptionInfo();
-    int mediaSequenceNumber = 1;
-    ssize_t indexToMapEntry = -1;
-    ByteRange byteRange = std::make_tuple(0, 0);
-    std::vector<std::string> variantURLs;
-    std::vector<PlaylistEntry> entries;
-
-    while (std::getline(iss, line)) {
-        removeCarriageReturnFromLine(&line);
-        std::istringstream linestream(line);
-        char firstChar;
-        linestream >> firstChar;
-        if (!linestream) {
-            continue;
-        }
-        if (firstChar == '#') {
-            if (hasPrefix(line, EXT_M3U_PLAYLIST_HEADER)) {
-                isPlaylistExtendedM3U = true;
-            } else if (hasPrefix(line, EXTXMEDIASEQUENCE)) {
-                playlistMediaSequence = parsePlaylistMediaSequence(line);
-            } else if (hasPrefix(line, EXTINF)) {
-                duration = parseRuntime(line);
-            } else if (hasPrefix(line, EXTSTREAMINF)) {
-                isMasterPlaylist = true;
-            } else if (hasPrefix(line, ENDLIST)) {
-                isLive = false;
-                if (!entries.empty()) {
-                    entries.back().parseResult = PlaylistParseResult::FINISHED;
-                }
-                break;
-            } else if (hasPrefix(line, EXT_KEY)) {
-                encryptionInfo = parseHLSEncryptionLine(line, playlistURL);
-            } else if (hasPrefix(line, EXT_BYTERANGE)) {
-                byteRange = parseHLSByteRangeLine(line);
-            } else if (hasPrefix(line, EXT_MAP)) {
-                auto mediaInitInfo = parseHLSMapLine(line, playlistURL);
-                mediaInitInfo.encryptionInfo = encryptionInfo;
-                entries.push_back(mediaInitInfo);
-                indexToMapEntry = entries.size() - 1;
-            }
-            continue;
-        }
+    if (begin < end && ('\r' == *(end - 1))) {
+        --end;
+    }
+    if (0 == m_lineCount++) {
+        m_isFirstLineHeader = hasPrefix(begin, end, EXT_M3U_PLAYLIST_HEADER);
+    }
+    auto firstChar = begin;
+    while (firstChar < end && std::isspace(static_cast<unsigned char>(*firstChar))) {
+        ++firstChar;
+    }
+    if (firstChar == end) {
+        return;
+    }
+    if ('#' != *firstChar) {
+        parseURLLine(begin, end);
+        return;
+    }
 
-        // at this point, "line" is a url
-        std::string absoluteURL;
-        if (!getAbsoluteURL(playlistURL, line, &absoluteURL)) {
-            // Failed to retrieve URL from line, bail
-            continue;
+    if (hasPrefix(begin, end, EXT_M3U_PLAYLIST_HEADER)) {
+        m_hasHeader = true;
+    } else if (hasPrefix(begin, end, EXTXMEDIASEQUENCE)) {
+        m_playlistMediaSequence = parsePlaylistMediaSequence(std::string(begin, end));
+    } else if (hasPrefix(begin, end, EXTINF)) {
+        m_duration = parseRuntime(begin, end);
+    } else if (hasPrefix(begin, end, EXTSTREAMINF)) {
+        m_isMasterPlaylist = true;
+    } else if (hasPrefix(begin, end, ENDLIST)) {
+        m_isEndListFound = true;
+        if (!m_entries.empty()) {
+            m_entries.back().parseResult = PlaylistParseResult::FINISHED;
         }
+    } else if (hasPrefix(begin, end, EXT_KEY)) {
+        m_encryptionInfo = parseHLSEncryptionLine(std::string(begin, end), m_playlistURL);
+    } else if (hasPrefix(begin, end, EXT_BYTERANGE)) {
+        m_byteRange = parseHLSByteRangeLine(std::string(begin, end));
+    } else if (hasPrefix(begin, end, EXT_MAP)) {
+        auto mediaInitInfo = parseHLSMapLine(std::string(begin, end), m_playlistURL);
+        mediaInitInfo.encryptionInfo = m_encryptionInfo;
+        m_entries.push_back(std::move(mediaInitInfo));
+        m_indexToMapEntry = m_entries.size() - 1;
+    }
+}
 
-        if (isMasterPlaylist) {
-            variantURLs.push_back(absoluteURL);
-        } else {
-            auto entryEncryptionInfo(encryptionInfo);
-            if (entryEncryptionInfo.initVector.empty()) {
-                entryEncryptionInfo.initVector = to16ByteHexString(mediaSequenceNumber);
-            }
-            auto parseResult = PlaylistParseResult::STILL_ONGOING;
-            if (INVALID_DURATION != duration) {
-                totalDuration += duration;
-            }
-            entries.push_back(PlaylistEntry(
-                absoluteURL, duration, parseResult, PlaylistEntry::Type::MEDIA_INFO, byteRange, entryEncryptionInfo));
-            ++mediaSequenceNumber;
+void M3UStreamParser::parseURLLine(const char* begin, const char* end) {
+    if (!m_isMasterPlaylist && INVALID_MEDIA_SEQUENCE != m_lastSeenMediaSequence &&
+        INVALID_MEDIA_SEQUENCE != m_playlistMediaSequence &&
+        m_playlistMediaSequence + static_cast<long>(m_segmentCount) <= m_lastSeenMediaSequence) {
+        // Only what follows the last segment already seen is new, including any media initialization entry.
+        ++m_segmentCount;
+        ++m_skippedSegmentCount;
+        if (INVALID_DURATION != m_duration) {
+            m_totalDuration += m_duration;
         }
-
-        byteRange = std::make_tuple(0, 0);
+        m_entries.clear();
+        m_indexToMapEntry = -1;
+        m_byteRange = std::make_tuple(0, 0);
+        return;
     }
 
-    if (!isPlaylistExtendedM3U && !entries.empty()) {
-        entries.back().parseResult = PlaylistParseResult::FINISHED;
+    std::string url(begin, end);
+    std::string absoluteURL;
+    if (isURLAbsolute(url)) {
+        absoluteURL = std::move(url);
+    } else if (!getAbsoluteURLFromRelativePathToURL(m_playlistURL, url, &absoluteURL)) {
+        // Failed to retrieve URL from line, bail
+        return;
     }
 
-    if (isMasterPlaylist) {
-        return M3UContent(variantURLs);
+    if (m_isMasterPlaylist) {
+        m_variantURLs.push_back(std::move(absoluteURL));
     } else {
-        if (indexToMapEntry >= 0) {
-            entries[indexToMapEntry].encryptionInfo.totalDuration = totalDuration;
+        auto entryEncryptionInfo(m_encryptionInfo);
+        if (entryEncryptionInfo.initVector.empty()) {
+            // The sequence number used for the IV counts the segments of this playlist from 1.
+            entryEncryptionInfo.initVector = to16ByteHexString(static_cast<int>(m_segmentCount) + 1);
+        }
+        if (INVALID_DURATION != m_duration) {
+            m_totalDuration += m_duration;
         }
-        return M3UContent(entries, isLive, playlistMediaSequence);
+        m_entries.push_back(PlaylistEntry(
+            std::move(absoluteURL),
+            m_duration,
+            PlaylistParseResult::STILL_ONGOING,
+            PlaylistEntry::Type::MEDIA_INFO,
+            m_byteRange,
+            std::move(entryEncryptionInfo)));
+        ++m_segmentCount;
     }
+
+    m_byteRange = std::make_tuple(0, 0);
+}
+
+M3UContent parseM3UContent(const std::string& playlistURL, const std::string& content) {
+    M3UStreamParser parser(playlistURL);
+    parser.feed(content.data(), content.size());
+    return parser.finish();
 }
 
 long parsePlaylistMediaSequence(const std::string& line) {
@@ -280,71 +364,70 @@ bool getAbsoluteURL(const std::string& baseURL, const std::string& url, std::str
 }
 
 bool isPlaylistExtendedM3U(const std::string& playlistContent) {
-    std::istringstream iss(playlistContent);
-    std::string line;
-    if (std::getline(iss, line)) {
-        if (line.compare(0, EXT_M3U_PLAYLIST_HEADER.length(), EXT_M3U_PLAYLIST_HEADER) == 0) {
-            return true;
-        } else {
-            return false;
-        }
-    } else {
-        return false;
-    }
+    return playlistContent.compare(0, EXT_M3U_PLAYLIST_HEADER.length(), EXT_M3U_PLAYLIST_HEADER) == 0;
 }
 
-std::chrono::milliseconds parseRuntime(const std::string& line) {
+static std::chrono::milliseconds parseRuntime(const char* begin, const char* end) {
     // #EXTINF:1234.00, blah blah blah have you ever heard the tragedy of darth plagueis the wise?
-    auto runner = EXTINF.length();
+    auto runner = begin + EXTINF.length();
+    auto skipWhitespace = [&runner, end] {
+        while (runner < end && std::isspace(static_cast<unsigned char>(*runner))) {
+            ++runner;
+        }
+    };
 
-    // skip whitespace
-    while (runner < line.length() && std::isspace(line.at(runner))) {
-        ++runner;
-    }
-    if (runner == line.length()) {
+    skipWhitespace();
+    if (runner == end) {
         return INVALID_DURATION;
     }
 
     // find colon
-    if (line.at(runner) != ':') {
+    if (*runner != ':') {
         return INVALID_DURATION;
     }
     ++runner;
 
-    // skip whitespace
-    while (runner < line.length() && std::isspace(line.at(runner))) {
-        ++runner;
-    }
-    if (runner == line.length()) {
+    skipWhitespace();
+    if (runner == end) {
         return INVALID_DURATION;
     }
     // from here, we should be reading numbers or a '.' only, so the fractional part of the seconds
-    auto stringFromHereOnwards = line.substr(runner);
-    std::istringstream iss(stringFromHereOnwards);
-    int seconds;
-    char nextChar;
-    iss >> seconds;
-    if (!iss) {
+    bool isNegative = false;
+    if (*runner == '+' || *runner == '-') {
+        isNegative = *runner == '-';
+        ++runner;
+    }
+    if (runner == end || !std::isdigit(static_cast<unsigned char>(*runner))) {
         return INVALID_DURATION;
     }
-    if (seconds < 0) {
+    long seconds = 0;
+    while (runner < end && std::isdigit(static_cast<unsigned char>(*runner))) {
+        seconds = seconds * 10 + (*runner - '0');
+        if (seconds > std::numeric_limits<int>::max()) {
+            return INVALID_DURATION;
+        }
+        ++runner;
+    }
+    if (isNegative && seconds != 0) {
         return INVALID_DURATION;
     }
     std::chrono::milliseconds duration = std::chrono::seconds(seconds);
-    iss >> nextChar;
-    if (!iss) {
+    skipWhitespace();
+    if (runner == end) {
         return duration;
     }
+    char nextChar = *runner++;
     if (nextChar == '.') {
         int digitsSoFar = 0;
         unsigned int fractionalSeconds = 0;
         // we only care about the first 3 (sig figs = millisecond limit)
         while (digitsSoFar < 3) {
-            iss >> nextChar;
-            if (!iss) {
+            skipWhitespace();
+            if (runner == end) {
                 break;
             }
-            if (!isdigit(nextChar)) {
+            nextChar = *runner++;
+            if (!std::isdigit(static_cast<unsigned char>(nextChar))) {
                 break;
             }
             fractionalSeconds *= 10;
@@ -358,17 +441,16 @@ std::chrono::milliseconds parseRuntime(const std::string& line) {
         }
         duration += std::chrono::milliseconds(fractionalSeconds);
     }
-    do {
-        if (isdigit(nextChar)) {
-            continue;
-        } else {
-            if (nextChar == ',') {
-                break;
-            } else {
-                return INVALID_DURATION;
-            }
+    while (nextChar != ',') {
+        if (!std::isdigit(static_cast<unsigned char>(nextChar))) {
+            return INVALID_DURATION;
         }
-    } while (iss >> nextChar);
+        skipWhitespace();
+        if (runner == end) {
+            break;
+        }
+        nextChar = *runner++;
+    }
     return duration;
 }
 
@@ -64,14 +64,28 @@ bool readFromContentFetcher(
     std::string* content,
     std::atomic<bool>* shouldShutDown,
     std::string* playlistURL) {
+    if (!content) {
+        ACSDK_ERROR(LX("readFromContentFetcherFailed").d("reason", "nullContent"));
+        return false;
+    }
+
+    auto appendToContent = [content](const char* data, size_t size) { content->append(data, size); };
+    return readFromContentFetcher(std::move(contentFetcher), appendToContent, shouldShutDown, playlistURL);
+}
+
+bool readFromContentFetcher(
+    std::unique_ptr<HTTPContentFetcherInterface> contentFetcher,
+    const std::function<void(const char* data, size_t size)>& consumer,
+    std::atomic<bool>* shouldShutDown,
+    std::string* playlistURL) {
     ACSDK_DEBUG9(LX(__func__));
     if (!contentFetcher) {
         ACSDK_ERROR(LX("readFromContentFetcherFailed").d("reason", "nullContentFetcher"));
         return false;
     }
 
-    if (!content) {
-        ACSDK_ERROR(LX("readFromContentFetcherFailed").d("reason", "nullContent"));
+    if (!consumer) {
+        ACSDK_ERROR(LX("readFromContentFetcherFailed").d("reason", "nullConsumer"));
         return false;
     }
 
@@ -145,6 +159,7 @@ bool readFromContentFetcher(
     bool streamClosed = false;
     AttachmentReader::ReadStatus previousStatus = AttachmentReader::ReadStatus::OK_TIMEDOUT;
     std::size_t bytesRead = static_cast<std::size_t>(-1);
+    std::size_t totalBytesRead = 0;
     while (!streamClosed && bytesRead != 0) {
         bytesRead = reader->read(buffer.data(), buffer.size(), &readStatus);
         if (previousStatus != readStatus) {
@@ -161,7 +176,8 @@ bool readFromContentFetcher(
             case AttachmentReader::ReadStatus::OK:
             case AttachmentReader::ReadStatus::OK_WOULDBLOCK:
             case AttachmentReader::ReadStatus::OK_TIMEDOUT:
-                content->append(buffer.data(), bytesRead);
+                consumer(buffer.data(), bytesRead);
+                totalBytesRead += bytesRead;
                 break;
             case AttachmentReader::ReadStatus::OK_OVERRUN_RESET:
                 // Current AttachmentReader policy renders this outcome impossible.
@@ -178,8 +194,8 @@ bool readFromContentFetcher(
         }
     }
 
-    ACSDK_DEBUG9(LX("readFromContentFetcherDone").d("URL", contentFetcher->getUrl()).d("content", *content));
-    return !(*content).empty();
+    ACSDK_DEBUG9(LX("readFromContentFetcherDone").d("URL", contentFetcher->getUrl()).d("bytesRead", totalBytesRead));
+    return totalBytesRead > 0;
 }
 
 std::vector<std::string> parsePLSContent(const std::string& playlistURL, const std::string& content) {
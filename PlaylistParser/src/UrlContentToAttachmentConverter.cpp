@@ -15,6 +15,8 @@
 
 #include "PlaylistParser/UrlContentToAttachmentConverter.h"
 
+#include <functional>
+
 #include <AVSCommon/Utils/Logger/Logger.h>
 
 namespace alexaClientSDK {
@@ -44,18 +46,24 @@ static const size_t CHUNK_SIZE(1024);
 /// Timeout for polling loops that check activities running on separate threads.
 static const std::chrono::milliseconds WAIT_FOR_ACTIVITY_TIMEOUT{100};
 
+/// How long the prefetch thread waits before reading again the segments being fetched, when none had new content.
+static const std::chrono::milliseconds PREFETCH_POLL_INTERVAL{10};
+
+const size_t UrlContentToAttachmentConverter::DEFAULT_PREFETCH_SEGMENT_COUNT = 3;
+
 std::shared_ptr<UrlContentToAttachmentConverter> UrlContentToAttachmentConverter::create(
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
     const std::string& url,
     std::shared_ptr<ErrorObserverInterface> observer,
     std::chrono::milliseconds startTime,
     std::shared_ptr<WriteCompleteObserverInterface> writeCompleteObserver,
-    size_t numOfReaders) {
+    size_t numOfReaders,
+    size_t prefetchSegmentCount) {
     if (!contentFetcherFactory) {
         return nullptr;
     }
     auto thisSharedPointer = std::shared_ptr<UrlContentToAttachmentConverter>(new UrlContentToAttachmentConverter(
-        contentFetcherFactory, url, observer, startTime, writeCompleteObserver, numOfReaders));
+        contentFetcherFactory, url, observer, startTime, writeCompleteObserver, numOfReaders, prefetchSegmentCount));
     auto retVal = thisSharedPointer->m_playlistParser->parsePlaylist(url, thisSharedPointer);
     if (0 == retVal) {
         thisSharedPointer->shutdown();
@@ -74,13 +82,16 @@ UrlContentToAttachmentConverter::UrlContentToAttachmentConverter(
     std::shared_ptr<ErrorObserverInterface> observer,
     std::chrono::milliseconds startTime,
     std::shared_ptr<WriteCompleteObserverInterface> writeCompleteObserver,
-    size_t numOfReaders) :
+    size_t numOfReaders,
+    size_t prefetchSegmentCount) :
         RequiresShutdown{"UrlContentToAttachmentConverter"},
         m_desiredStreamPoint{startTime},
         m_contentFetcherFactory{contentFetcherFactory},
         m_observer{observer},
         m_writeCompleteObserver{writeCompleteObserver},
         m_shuttingDown{false},
+        m_prefetchSegmentCount{prefetchSegmentCount},
+        m_segmentsWritten{0},
         m_runningTotal{0},
         m_startedStreaming{false},
         m_streamWriterClosed{false} {
@@ -90,6 +101,34 @@ UrlContentToAttachmentConverter::UrlContentToAttachmentConverter(
     m_streamWriter = m_stream->createWriter(avsCommon::utils::sds::WriterPolicy::BLOCKING);
     m_contentDecrypter = std::make_shared<ContentDecrypter>();
     m_id3TagsRemover = std::make_shared<Id3TagsRemover>();
+    if (m_prefetchSegmentCount > 0) {
+        m_prefetchThread = std::thread(&UrlContentToAttachmentConverter::prefetchLoop, this);
+    }
+}
+
+UrlContentToAttachmentConverter::PrefetchSegment::PrefetchSegment(
+    std::string url,
+    std::vector<std::string> headers,
+    EncryptionInfo encryptionInfo,
+    std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> contentFetcher) :
+        url{std::move(url)},
+        headers{std::move(headers)},
+        encryptionInfo{std::move(encryptionInfo)},
+        contentFetcher{std::move(contentFetcher)},
+        isWriterClosed{false},
+        isDecrypted{true} {
+}
+
+UrlContentToAttachmentConverter::~UrlContentToAttachmentConverter() {
+    if (m_prefetchThread.joinable()) {
+        // The converter was not shut down, so the prefetch thread is stopped here rather than left running.
+        {
+            std::lock_guard<std::mutex> lock{m_prefetchMutex};
+            m_shuttingDown = true;
+        }
+        m_prefetchTrigger.notify_all();
+        m_prefetchThread.join();
+    }
 }
 
 std::chrono::milliseconds UrlContentToAttachmentConverter::getStartStreamingPoint() {
@@ -156,6 +195,17 @@ void UrlContentToAttachmentConverter::onPlaylistEntryParsed(int requestId, Playl
     m_startedStreaming = true;
     ACSDK_DEBUG3(LX("onPlaylistEntryParsed").d("status", parseResult));
     auto contentFetcher = playlistEntry.contentFetcher;
+    // Encrypted segments are fetched and decrypted ahead, and only written here in order.
+    std::function<bool()> writeContent;
+    if (PlaylistParseResult::ERROR != parseResult && PlaylistParseResult::SHUTDOWN != parseResult &&
+        shouldPrefetch(encryptionInfo)) {
+        auto segment = prefetchSegment(url, headers, encryptionInfo, contentFetcher);
+        writeContent = [this, segment]() { return writePrefetchedSegmentIntoStream(segment); };
+    } else {
+        writeContent = [this, url, headers, encryptionInfo, contentFetcher]() {
+            return writeDecryptedUrlContentIntoStream(url, headers, encryptionInfo, contentFetcher);
+        };
+    }
     switch (parseResult) {
         case avsCommon::utils::playlistParser::PlaylistParseResult::ERROR:
             m_executor.execute([this]() {
@@ -165,10 +215,9 @@ void UrlContentToAttachmentConverter::onPlaylistEntryParsed(int requestId, Playl
             });
             break;
         case avsCommon::utils::playlistParser::PlaylistParseResult::FINISHED:
-            m_executor.execute([this, url, headers, encryptionInfo, contentFetcher]() {
+            m_executor.execute([this, writeContent]() {
                 ACSDK_DEBUG9(LX("calling writeDecryptedUrlContentIntoStream"));
-                if (!m_streamWriterClosed &&
-                    !writeDecryptedUrlContentIntoStream(url, headers, encryptionInfo, contentFetcher)) {
+                if (!writeContent()) {
                     ACSDK_ERROR(LX("writeUrlContentToStreamFailed"));
                     notifyError();
                 }
@@ -178,9 +227,8 @@ void UrlContentToAttachmentConverter::onPlaylistEntryParsed(int requestId, Playl
             });
             break;
         case avsCommon::utils::playlistParser::PlaylistParseResult::STILL_ONGOING:
-            m_executor.execute([this, url, headers, encryptionInfo, contentFetcher]() {
-                if (!m_streamWriterClosed &&
-                    !writeDecryptedUrlContentIntoStream(url, headers, encryptionInfo, contentFetcher)) {
+            m_executor.execute([this, writeContent]() {
+                if (!writeContent()) {
                     ACSDK_ERROR(LX("writeUrlContentToStreamFailed").d("info", "closingWriter"));
                     closeStreamWriter();
                     notifyError();
@@ -222,11 +270,196 @@ void UrlContentToAttachmentConverter::notifyWriteComplete() {
     }
 }
 
+bool UrlContentToAttachmentConverter::shouldPrefetch(const EncryptionInfo& encryptionInfo) const {
+    return m_prefetchSegmentCount > 0 && shouldDecrypt(encryptionInfo) &&
+           EncryptionInfo::Method::AES_128 == encryptionInfo.method;
+}
+
+std::shared_future<std::shared_ptr<ByteVector>> UrlContentToAttachmentConverter::prefetchSegment(
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    const EncryptionInfo& encryptionInfo,
+    std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> contentFetcher) {
+    std::unique_ptr<PrefetchSegment> segment(new PrefetchSegment(url, headers, encryptionInfo, contentFetcher));
+    auto future = segment->promise.get_future().share();
+    {
+        std::lock_guard<std::mutex> lock{m_prefetchMutex};
+        if (m_shuttingDown) {
+            // The prefetch thread has failed the segments left, or is about to, and does not take new ones.
+            segment->promise.set_value(nullptr);
+            return future;
+        }
+        m_segmentsToPrefetch.push_back(std::move(segment));
+    }
+    m_prefetchTrigger.notify_all();
+    return future;
+}
+
+void UrlContentToAttachmentConverter::prefetchLoop() {
+    // The segments being fetched, in order.
+    std::deque<std::unique_ptr<PrefetchSegment>> segmentsFetched;
+    // The number of segments whose fetch was started.
+    size_t segmentsStarted = 0;
+    // Bound the number of segments held in memory ahead of the one being written.
+    auto canStartSegment = [this, &segmentsStarted]() {
+        return !m_segmentsToPrefetch.empty() && segmentsStarted <= m_segmentsWritten + m_prefetchSegmentCount;
+    };
+
+    std::unique_lock<std::mutex> lock{m_prefetchMutex};
+    while (true) {
+        if (segmentsFetched.empty()) {
+            m_prefetchTrigger.wait(lock, [this, &canStartSegment]() { return m_shuttingDown || canStartSegment(); });
+        }
+        if (m_shuttingDown) {
+            break;
+        }
+        std::deque<std::unique_ptr<PrefetchSegment>> segmentsToStart;
+        while (canStartSegment()) {
+            segmentsToStart.push_back(std::move(m_segmentsToPrefetch.front()));
+            m_segmentsToPrefetch.pop_front();
+            ++segmentsStarted;
+        }
+        lock.unlock();
+
+        for (auto& segment : segmentsToStart) {
+            if (startPrefetch(segment.get())) {
+                segmentsFetched.push_back(std::move(segment));
+            } else {
+                segment->promise.set_value(nullptr);
+            }
+        }
+        bool hasProgressed = false;
+        for (auto it = segmentsFetched.begin(); it != segmentsFetched.end() && !m_shuttingDown;) {
+            if (continuePrefetch(it->get(), &hasProgressed)) {
+                ++it;
+            } else {
+                it = segmentsFetched.erase(it);
+            }
+        }
+
+        lock.lock();
+        if (!hasProgressed && !segmentsFetched.empty()) {
+            m_prefetchTrigger.wait_for(lock, PREFETCH_POLL_INTERVAL, [this, &canStartSegment]() {
+                return m_shuttingDown || canStartSegment();
+            });
+        }
+    }
+
+    // Fail the segments left, so that m_executor does not wait for them.
+    for (auto& segment : m_segmentsToPrefetch) {
+        segment->promise.set_value(nullptr);
+    }
+    m_segmentsToPrefetch.clear();
+    lock.unlock();
+    for (auto& segment : segmentsFetched) {
+        segment->writer->close();
+        segment->promise.set_value(nullptr);
+    }
+}
+
+bool UrlContentToAttachmentConverter::startPrefetch(PrefetchSegment* segment) {
+    ACSDK_DEBUG9(LX("startPrefetch").sensitive("url", segment->url));
+
+    ByteVector key;
+    if (!getKey(segment->encryptionInfo.keyURL, &key)) {
+        ACSDK_ERROR(LX("startPrefetchFailed").d("reason", "downloadEncryptionKeyFailed"));
+        return false;
+    }
+
+    ByteVector iv;
+    if (!ContentDecrypter::convertIVToByteArray(segment->encryptionInfo.initVector, &iv) ||
+        !segment->decrypter.init(key, iv)) {
+        ACSDK_ERROR(LX("startPrefetchFailed").d("reason", "initDecryptionFailed"));
+        return false;
+    }
+
+    auto attachment = std::make_shared<InProcessAttachment>("download:" + segment->url);
+    segment->writer = attachment->createWriter(WriterPolicy::BLOCKING);
+    segment->reader = attachment->createReader(ReaderPolicy::NONBLOCKING);
+    segment->content = std::make_shared<ByteVector>();
+    segment->contentFetcher = startDownload(segment->url, segment->headers, segment->writer, segment->contentFetcher);
+    if (!segment->contentFetcher) {
+        ACSDK_ERROR(LX("startPrefetchFailed").d("reason", "startDownloadFailed"));
+        return false;
+    }
+    return true;
+}
+
+bool UrlContentToAttachmentConverter::continuePrefetch(PrefetchSegment* segment, bool* hasProgressed) {
+    auto& content = *segment->content;
+    while (true) {
+        auto readStatus = AttachmentReader::ReadStatus::OK;
+        auto size = content.size();
+        content.resize(size + CHUNK_SIZE);
+        auto bytesRead = segment->reader->read(content.data() + size, CHUNK_SIZE, &readStatus);
+        content.resize(size + bytesRead);
+        if (bytesRead > 0) {
+            *hasProgressed = true;
+            // Keep reading after a decryption failure, so that the download is not blocked by a full attachment.
+            if (segment->isDecrypted && !segment->decrypter.update(&content)) {
+                segment->isDecrypted = false;
+            }
+        }
+        switch (readStatus) {
+            case AttachmentReader::ReadStatus::OK:
+                break;
+            case AttachmentReader::ReadStatus::OK_WOULDBLOCK:
+            case AttachmentReader::ReadStatus::OK_TIMEDOUT:
+                if (segment->isWriterClosed ||
+                    HTTPContentFetcherInterface::State::FETCHING_BODY == segment->contentFetcher->getState()) {
+                    return true;
+                }
+                // The download is over, so the content left in the attachment is read up to its close.
+                segment->writer->close();
+                segment->isWriterClosed = true;
+                break;
+            case AttachmentReader::ReadStatus::CLOSED:
+                if (HTTPContentFetcherInterface::State::ERROR == segment->contentFetcher->getState()) {
+                    ACSDK_ERROR(LX("continuePrefetchFailed").d("reason", "downloadContentFailed"));
+                    segment->promise.set_value(nullptr);
+                } else if (!segment->isDecrypted || !segment->decrypter.finish(&content)) {
+                    ACSDK_ERROR(LX("continuePrefetchFailed").d("reason", "aes128DecryptionFailed"));
+                    segment->promise.set_value(nullptr);
+                } else {
+                    m_id3TagsRemover->stripID3Tags(content);
+                    segment->promise.set_value(segment->content);
+                }
+                return false;
+            case AttachmentReader::ReadStatus::OK_OVERRUN_RESET:
+            case AttachmentReader::ReadStatus::ERROR_OVERRUN:
+            case AttachmentReader::ReadStatus::ERROR_BYTES_LESS_THAN_WORD_SIZE:
+            case AttachmentReader::ReadStatus::ERROR_INTERNAL:
+                ACSDK_ERROR(LX("continuePrefetchFailed").d("reason", "readError"));
+                segment->promise.set_value(nullptr);
+                return false;
+        }
+    }
+}
+
+bool UrlContentToAttachmentConverter::getKey(const std::string& keyURL, ByteVector* key) {
+    std::lock_guard<std::mutex> lock{m_keyMutex};
+    if (!m_keyURL.empty() && keyURL == m_keyURL) {
+        *key = m_key;
+        return true;
+    }
+
+    // The content fetcher of a segment, if any, is for the segment itself, so the key gets a fetcher of its own.
+    if (!download(keyURL, std::vector<std::string>(), key, nullptr)) {
+        return false;
+    }
+    m_keyURL = keyURL;
+    m_key = *key;
+    return true;
+}
+
 bool UrlContentToAttachmentConverter::writeDecryptedUrlContentIntoStream(
     std::string url,
     std::vector<std::string> headers,
     EncryptionInfo encryptionInfo,
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> contentFetcher) {
+    if (m_streamWriterClosed) {
+        return true;
+    }
     ACSDK_DEBUG9(LX("writeDecryptedUrlContentIntoStream").d("info", "beginning"));
 
     auto hasValidEncryption = shouldDecrypt(encryptionInfo);
@@ -238,13 +471,13 @@ bool UrlContentToAttachmentConverter::writeDecryptedUrlContentIntoStream(
         }
 
         ByteVector key;
-        if (!download(encryptionInfo.keyURL, std::vector<std::string>(), &key, contentFetcher)) {
+        if (!getKey(encryptionInfo.keyURL, &key)) {
             ACSDK_ERROR(LX("writeDecryptedUrlContentIntoStreamFailed").d("reason", "downloadEncryptionKeyFailed"));
             return false;
         }
 
         if (!m_shuttingDown &&
-            !m_contentDecrypter->decryptAndWrite(content, key, encryptionInfo, m_streamWriter, m_id3TagsRemover)) {
+            !m_contentDecrypter->decryptAndWrite(&content, key, encryptionInfo, m_streamWriter, m_id3TagsRemover)) {
             ACSDK_ERROR(LX("writeDecryptedUrlContentIntoStreamFailed").d("reason", "decryptAndWriteFailed"));
             return false;
         }
@@ -278,6 +511,28 @@ bool UrlContentToAttachmentConverter::writeDecryptedUrlContentIntoStream(
     return true;
 }
 
+bool UrlContentToAttachmentConverter::writePrefetchedSegmentIntoStream(
+    std::shared_future<std::shared_ptr<ByteVector>> segment) {
+    bool returnValue = true;
+    if (!m_streamWriterClosed) {
+        auto content = segment.get();
+        if (!content) {
+            ACSDK_ERROR(LX("writePrefetchedSegmentIntoStreamFailed").d("reason", "prefetchSegmentFailed"));
+            returnValue = false;
+        } else if (!m_shuttingDown && !m_contentDecrypter->writeToStream(*content, m_streamWriter)) {
+            ACSDK_ERROR(LX("writePrefetchedSegmentIntoStreamFailed").d("reason", "writeFailed"));
+            returnValue = false;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{m_prefetchMutex};
+        ++m_segmentsWritten;
+    }
+    m_prefetchTrigger.notify_all();
+    return returnValue;
+}
+
 bool UrlContentToAttachmentConverter::shouldDecrypt(const EncryptionInfo& encryptionInfo) const {
     return encryptionInfo.isValid() && encryptionInfo.method != EncryptionInfo::Method::NONE;
 }
@@ -303,7 +558,10 @@ bool UrlContentToAttachmentConverter::download(
     return true;
 }
 
-bool UrlContentToAttachmentConverter::readContent(std::shared_ptr<AttachmentReader> reader, ByteVector* content) {
+bool UrlContentToAttachmentConverter::readContent(
+    std::shared_ptr<AttachmentReader> reader,
+    ByteVector* content,
+    AESStreamDecrypter* decrypter) {
     if (!content) {
         ACSDK_ERROR(LX("readContentFailed").d("reason", "nullContent"));
         return false;
@@ -314,12 +572,16 @@ bool UrlContentToAttachmentConverter::readContent(std::shared_ptr<AttachmentRead
         return false;
     }
 
+    // Read straight into the content rather than through an intermediate buffer.
     auto readStatus = AttachmentReader::ReadStatus::OK;
     ByteVector contentRead;
-    ByteVector buffer(CHUNK_SIZE, 0);
     bool streamClosed = false;
+    bool decrypted = true;
     while (!streamClosed && !m_shuttingDown) {
-        auto bytesRead = reader->read(buffer.data(), buffer.size(), &readStatus);
+        auto size = contentRead.size();
+        contentRead.resize(size + CHUNK_SIZE);
+        auto bytesRead = reader->read(contentRead.data() + size, CHUNK_SIZE, &readStatus);
+        contentRead.resize(size + bytesRead);
         switch (readStatus) {
             case AttachmentReader::ReadStatus::CLOSED:
                 streamClosed = true;
@@ -330,7 +592,10 @@ bool UrlContentToAttachmentConverter::readContent(std::shared_ptr<AttachmentRead
             case AttachmentReader::ReadStatus::OK:
             case AttachmentReader::ReadStatus::OK_WOULDBLOCK:
             case AttachmentReader::ReadStatus::OK_TIMEDOUT:
-                contentRead.insert(std::end(contentRead), std::begin(buffer), std::begin(buffer) + bytesRead);
+                // Keep reading after a decryption failure, so that the download is not blocked by a full attachment.
+                if (decrypter && decrypted && !decrypter->update(&contentRead)) {
+                    decrypted = false;
+                }
                 break;
             case AttachmentReader::ReadStatus::OK_OVERRUN_RESET:
                 // Current AttachmentReader policy renders this outcome impossible.
@@ -343,18 +608,22 @@ bool UrlContentToAttachmentConverter::readContent(std::shared_ptr<AttachmentRead
                 return false;
         }
     }
-    *content = contentRead;
+    if (!decrypted) {
+        ACSDK_ERROR(LX("readContentFailed").d("reason", "decryptionFailed"));
+        return false;
+    }
+    content->swap(contentRead);
     return true;
 }
 
-bool UrlContentToAttachmentConverter::download(
+std::shared_ptr<HTTPContentFetcherInterface> UrlContentToAttachmentConverter::startDownload(
     const std::string& url,
     const std::vector<std::string>& headers,
     std::shared_ptr<AttachmentWriter> streamWriter,
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> contentFetcher) {
     if (!streamWriter) {
         ACSDK_ERROR(LX("downloadFailed").d("reason", "nullStreamWriter"));
-        return false;
+        return nullptr;
     }
 
     std::shared_ptr<HTTPContentFetcherInterface> localContentFetcher;
@@ -372,12 +641,24 @@ bool UrlContentToAttachmentConverter::download(
         HTTPContentFetcherInterface::Header header = localContentFetcher->getHeader(&m_shuttingDown);
 
         if (!header.successful) {
-            return false;
+            return nullptr;
         }
     }
 
     if (!localContentFetcher->getBody(streamWriter)) {
         ACSDK_ERROR(LX("downloadFailed").d("reason", "getBodyFailed"));
+        return nullptr;
+    }
+    return localContentFetcher;
+}
+
+bool UrlContentToAttachmentConverter::download(
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    std::shared_ptr<AttachmentWriter> streamWriter,
+    std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> contentFetcher) {
+    auto localContentFetcher = startDownload(url, headers, streamWriter, contentFetcher);
+    if (!localContentFetcher) {
         return false;
     }
 
@@ -399,9 +680,19 @@ void UrlContentToAttachmentConverter::doShutdown() {
         m_observer.reset();
         m_writeCompleteObserver.reset();
     }
-    m_shuttingDown = true;
+    {
+        // Setting the flag under the lock ensures that the prefetch thread does not miss it between its check and its
+        // wait, and that no segment is queued after the prefetch thread fails those left.
+        std::lock_guard<std::mutex> lock{m_prefetchMutex};
+        m_shuttingDown = true;
+    }
+    m_prefetchTrigger.notify_all();
     m_contentDecrypter->shutdown();
     m_id3TagsRemover->shutdown();
+    // Join the prefetch thread first, since m_executor may be waiting for a segment which it fetches.
+    if (m_prefetchThread.joinable()) {
+        m_prefetchThread.join();
+    }
     m_executor.shutdown();
     m_contentDecrypter.reset();
     m_id3TagsRemover.reset();
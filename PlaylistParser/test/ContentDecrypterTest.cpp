@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -35,6 +36,16 @@ static const std::string DECRYPTED_STRING = "HelloWorld!\n";
 static const ByteVector AES_ENCRYPTED_CONTENT =
     {0xe8, 0xc2, 0x17, 0xa0, 0xa6, 0x95, 0x88, 0x39, 0xa3, 0x05, 0xa4, 0xfa, 0x42, 0x91, 0x52, 0x19};
 
+/// Excepted decrypted content spanning several blocks, followed by a whole block of padding.
+static const std::string MULTI_BLOCK_DECRYPTED_STRING = "HelloWorld! HelloWorld! HelloWorld! HelloWorld!\n";
+
+/// The above string encrypted with below key and iv.
+static const ByteVector MULTI_BLOCK_AES_ENCRYPTED_CONTENT = {
+    0x98, 0x9d, 0xd1, 0x32, 0x34, 0x3d, 0x9d, 0xc3, 0x45, 0xf8, 0xec, 0x6e, 0xdd, 0x85, 0x96, 0x6c,
+    0x10, 0x6a, 0x44, 0x3c, 0xe3, 0xc2, 0x98, 0x0b, 0x78, 0x2b, 0x72, 0xaf, 0x2d, 0xf9, 0x71, 0x35,
+    0x6b, 0x1e, 0x6d, 0xf2, 0xde, 0xbb, 0x98, 0x85, 0x42, 0xad, 0x5c, 0xdb, 0x09, 0x15, 0x05, 0x60,
+    0x6f, 0x86, 0xea, 0x94, 0x98, 0xf9, 0x38, 0x20, 0xe8, 0x47, 0xcb, 0xe5, 0x03, 0xf2, 0x10, 0xf0};
+
 /// Test key: aaaaaaaaaaaaaaaa.
 static const ByteVector KEY(16, 0x61);
 
@@ -149,6 +160,62 @@ TEST_F(ContentDecrypterTest, test_aESDecryption) {
     EXPECT_EQ(DECRYPTED_STRING, decryptedString);
 }
 
+TEST_F(ContentDecrypterTest, test_aESDecryptionInPlace) {
+    auto content = MULTI_BLOCK_AES_ENCRYPTED_CONTENT;
+
+    auto result = m_decrypter->decryptAndWrite(&content, KEY, AES_ENCRYPTION_INFO, m_writer, m_id3TagsRemover);
+
+    auto decryptedString = readDecryptedContent(MULTI_BLOCK_DECRYPTED_STRING.size());
+    EXPECT_TRUE(result);
+    EXPECT_EQ(MULTI_BLOCK_DECRYPTED_STRING, decryptedString);
+    EXPECT_EQ(MULTI_BLOCK_DECRYPTED_STRING, std::string(content.begin(), content.end()));
+}
+
+TEST_F(ContentDecrypterTest, test_streamDecryptionInChunks) {
+    ByteVector iv;
+    ASSERT_TRUE(ContentDecrypter::convertIVToByteArray(HEX_IV, &iv));
+
+    // Decrypt the content as it would arrive from the network, in chunks which do not align with the blocks.
+    for (size_t chunkSize = 1; chunkSize <= MULTI_BLOCK_AES_ENCRYPTED_CONTENT.size(); ++chunkSize) {
+        AESStreamDecrypter decrypter;
+        ASSERT_TRUE(decrypter.init(KEY, iv));
+        ByteVector content;
+        for (size_t offset = 0; offset < MULTI_BLOCK_AES_ENCRYPTED_CONTENT.size(); offset += chunkSize) {
+            auto end = std::min(offset + chunkSize, MULTI_BLOCK_AES_ENCRYPTED_CONTENT.size());
+            content.insert(
+                content.end(),
+                MULTI_BLOCK_AES_ENCRYPTED_CONTENT.begin() + offset,
+                MULTI_BLOCK_AES_ENCRYPTED_CONTENT.begin() + end);
+            ASSERT_TRUE(decrypter.update(&content));
+        }
+        ASSERT_TRUE(decrypter.finish(&content));
+        EXPECT_EQ(MULTI_BLOCK_DECRYPTED_STRING, std::string(content.begin(), content.end()));
+    }
+}
+
+TEST_F(ContentDecrypterTest, test_streamDecryptionPartialBlock) {
+    ByteVector iv;
+    ASSERT_TRUE(ContentDecrypter::convertIVToByteArray(HEX_IV, &iv));
+    AESStreamDecrypter decrypter;
+    ASSERT_TRUE(decrypter.init(KEY, iv));
+    ByteVector content(MULTI_BLOCK_AES_ENCRYPTED_CONTENT.begin(), MULTI_BLOCK_AES_ENCRYPTED_CONTENT.end() - 1);
+
+    EXPECT_FALSE(decrypter.finish(&content));
+}
+
+TEST_F(ContentDecrypterTest, test_streamDecryptionInvalidPadding) {
+    /// Test key: bbbbbbbbbbbbbbbb, which does not decrypt the content into valid padding.
+    static const ByteVector WRONG_KEY(16, 0x62);
+
+    ByteVector iv;
+    ASSERT_TRUE(ContentDecrypter::convertIVToByteArray(HEX_IV, &iv));
+    AESStreamDecrypter decrypter;
+    ASSERT_TRUE(decrypter.init(WRONG_KEY, iv));
+    auto content = MULTI_BLOCK_AES_ENCRYPTED_CONTENT;
+
+    EXPECT_FALSE(decrypter.finish(&content));
+}
+
 TEST_F(ContentDecrypterTest, test_convertIVNullByteArray) {
     auto result = ContentDecrypter::convertIVToByteArray(HEX_IV, nullptr);
 
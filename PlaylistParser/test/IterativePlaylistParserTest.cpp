@@ -15,6 +15,7 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -46,6 +47,80 @@ public:
         std::unique_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface>(const std::string& url));
 };  // namespace test
 
+/// The URL of a live playlist which is served from a list of refreshes.
+static const std::string TEST_REFRESHED_PLAYLIST_URL{"http://sanjayisthecoolest.com/refreshedLive.m3u8"};
+
+/// A content fetcher serving the next refresh of a live playlist, or the last refresh once they have all been served.
+class RefreshedPlaylistContentFetcher : public HTTPContentFetcherInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param url The URL of the playlist.
+     * @param refreshes The contents of the successive refreshes of the playlist.
+     */
+    RefreshedPlaylistContentFetcher(const std::string& url, std::deque<std::string>* refreshes) :
+            m_url{url},
+            m_refreshes{refreshes},
+            m_state{HTTPContentFetcherInterface::State::INITIALIZED} {
+    }
+
+    std::string getUrl() const override {
+        return m_url;
+    }
+
+    std::string getEffectiveUrl() const override {
+        return m_url;
+    }
+
+    HTTPContentFetcherInterface::Header getHeader(std::atomic<bool>* shouldShutdown) override {
+        HTTPContentFetcherInterface::Header header;
+        header.successful = true;
+        header.responseCode = avsCommon::utils::http::HTTPResponseCode::SUCCESS_OK;
+        header.contentType = "application/vnd.apple.mpegurl";
+        m_state = HTTPContentFetcherInterface::State::HEADER_DONE;
+        return header;
+    }
+
+    HTTPContentFetcherInterface::State getState() override {
+        return m_state;
+    }
+
+    bool getBody(std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter> writer) override {
+        if (m_refreshes->empty()) {
+            return false;
+        }
+        auto content = m_refreshes->front();
+        if (m_refreshes->size() > 1) {
+            m_refreshes->pop_front();
+        }
+        avsCommon::avs::attachment::AttachmentWriter::WriteStatus writeStatus;
+        writer->write(content.data(), content.size(), &writeStatus);
+        m_state = HTTPContentFetcherInterface::State::BODY_DONE;
+        return true;
+    }
+
+    void shutdown() override {
+    }
+
+    std::unique_ptr<avsCommon::utils::HTTPContent> getContent(
+        FetchOptions fetchOption,
+        std::unique_ptr<avsCommon::avs::attachment::AttachmentWriter> writer,
+        const std::vector<std::string>& customHeaders = std::vector<std::string>()) override {
+        return nullptr;
+    }
+
+private:
+    /// The URL of the playlist.
+    std::string m_url;
+
+    /// The contents of the refreshes not served yet.
+    std::deque<std::string>* m_refreshes;
+
+    /// The state of the fetcher.
+    HTTPContentFetcherInterface::State m_state;
+};
+
 class IterativePlaylistParserTest : public ::testing::Test {
 protected:
     /// Configure test instance.
@@ -63,14 +138,23 @@ protected:
     /// A mock factory to create mock content fetchers
     std::shared_ptr<MockContentFetcherFactory> m_mockFactory;
 
+    /// The contents of the refreshes of the playlist at @c TEST_REFRESHED_PLAYLIST_URL.
+    std::deque<std::string> m_refreshes;
+
     /// Instance of the @c IterativePlaylistParser.
     std::shared_ptr<IterativePlaylistParser> m_parser;
 };
 
 void IterativePlaylistParserTest::SetUp() {
     m_mockFactory = std::make_shared<MockContentFetcherFactory>();
-    EXPECT_CALL(*m_mockFactory, create(_)).WillRepeatedly(Invoke([](const std::string& url) {
-        return avsCommon::utils::memory::make_unique<MockContentFetcher>(url);
+    EXPECT_CALL(*m_mockFactory, create(_)).WillRepeatedly(Invoke([this](const std::string& url) {
+        std::unique_ptr<HTTPContentFetcherInterface> fetcher;
+        if (TEST_REFRESHED_PLAYLIST_URL == url) {
+            fetcher.reset(new RefreshedPlaylistContentFetcher(url, &m_refreshes));
+        } else {
+            fetcher = avsCommon::utils::memory::make_unique<MockContentFetcher>(url);
+        }
+        return fetcher;
     }));
     m_parser = IterativePlaylistParser::create(m_mockFactory);
 }
@@ -160,6 +244,63 @@ TEST_F(IterativePlaylistParserTest, test_parsingLiveStreamPlaylist) {
     testPlaylist(TEST_HLS_LIVE_STREAM_PLAYLIST_URL, TEST_HLS_LIVE_STREAM_PLAYLIST_URLS, TEST_HLS_LIVE_STREAM_DURATIONS);
 }
 
+/**
+ * Tests that the refresh of a live playlist with a media sequence only adds the segments following those seen.
+ */
+TEST_F(IterativePlaylistParserTest, test_refreshingLivePlaylistSkipsSeenSegments) {
+    m_refreshes = {"#EXTM3U\n"
+                   "#EXT-X-MEDIA-SEQUENCE:5\n"
+                   "#EXTINF:10,\nhttp://sanjay.com/segment5.aac\n"
+                   "#EXTINF:10,\nhttp://sanjay.com/segment6.aac\n"
+                   "#EXTINF:10,\nhttp://sanjay.com/segment7.aac\n",
+                   "#EXTM3U\n"
+                   "#EXT-X-MEDIA-SEQUENCE:6\n"
+                   "#EXTINF:10,\nhttp://sanjay.com/segment6.aac\n"
+                   "#EXTINF:10,\nhttp://sanjay.com/segment7.aac\n"
+                   "#EXTINF:10,\nhttp://sanjay.com/segment8.aac\n"
+                   "#EXTINF:10,\nhttp://sanjay.com/segment9.aac\n"
+                   "#EXT-X-ENDLIST\n"};
+    testPlaylist(
+        TEST_REFRESHED_PLAYLIST_URL,
+        {"http://sanjay.com/segment5.aac",
+         "http://sanjay.com/segment6.aac",
+         "http://sanjay.com/segment7.aac",
+         "http://sanjay.com/segment8.aac",
+         "http://sanjay.com/segment9.aac"});
+}
+
+/**
+ * Tests that no segment is lost when the media sequence of a live playlist restarts below the segments seen.
+ */
+TEST_F(IterativePlaylistParserTest, test_refreshingLivePlaylistAfterMediaSequenceRestart) {
+    const std::string restartedContent =
+        "#EXTM3U\n"
+        "#EXT-X-MEDIA-SEQUENCE:0\n"
+        "#EXTINF:10,\nhttp://sanjay.com/restarted0.aac\n"
+        "#EXTINF:10,\nhttp://sanjay.com/restarted1.aac\n";
+    m_refreshes = {"#EXTM3U\n"
+                   "#EXT-X-MEDIA-SEQUENCE:5\n"
+                   "#EXTINF:10,\nhttp://sanjay.com/segment5.aac\n"
+                   "#EXTINF:10,\nhttp://sanjay.com/segment6.aac\n"
+                   "#EXTINF:10,\nhttp://sanjay.com/segment7.aac\n",
+                   restartedContent,
+                   restartedContent,
+                   "#EXTM3U\n"
+                   "#EXT-X-MEDIA-SEQUENCE:1\n"
+                   "#EXTINF:10,\nhttp://sanjay.com/restarted1.aac\n"
+                   "#EXTINF:10,\nhttp://sanjay.com/restarted2.aac\n"
+                   "#EXT-X-ENDLIST\n"};
+    testPlaylist(
+        TEST_REFRESHED_PLAYLIST_URL,
+        {"http://sanjay.com/segment5.aac",
+         "http://sanjay.com/segment6.aac",
+         "http://sanjay.com/segment7.aac",
+         "http://sanjay.com/restarted0.aac",
+         "http://sanjay.com/restarted1.aac",
+         "http://sanjay.com/restarted2.aac"});
+    EXPECT_EQ(m_refreshes.size(), 1u);
+}
+
 /**
  * Test parsing a media url. We expect the media to be the unique url.
  */
@@ -0,0 +1,172 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+// @file M3UParserBenchmarkTest.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Logger/ConsoleLogger.h>
+#include <AVSCommon/Utils/Memory/AllocationCounter.h>
+
+#include "PlaylistParser/M3UParser.h"
+
+namespace alexaClientSDK {
+namespace playlistParser {
+namespace test {
+
+using namespace ::testing;
+using namespace avsCommon::utils::logger;
+using namespace avsCommon::utils::memory::test;
+
+/// Clock used to time the parses.
+using Clock = std::chrono::steady_clock;
+
+/// The number of segments of the playlists parsed, as in a live radio stream keeping several hours of segments.
+static const size_t SEGMENT_COUNT = 5000;
+
+/// The number of segments added to the live playlist between refreshes.
+static const size_t NEW_SEGMENTS_PER_REFRESH = 3;
+
+/// The number of times each parse is repeated.
+static const size_t REPETITIONS = 20;
+
+/// The size of the chunks the playlist is fed in, matching the size of the reads from the content fetcher.
+static const size_t CHUNK_SIZE = 1024;
+
+/// The media sequence number of the first segment of the live playlist.
+static const long FIRST_MEDIA_SEQUENCE = 9684358;
+
+/// The URL of the playlists parsed.
+static const std::string PLAYLIST_URL = "https://radio.example.com/live/stream/playlist.m3u8";
+
+/**
+ * Create a live HLS playlist, with relative segment URLs and encryption as served by radio streams.
+ *
+ * @param mediaSequence The media sequence number of the first segment.
+ * @param segmentCount The number of segments.
+ * @return The playlist.
+ */
+static std::string createPlaylist(long mediaSequence, size_t segmentCount) {
+    std::ostringstream playlist;
+    playlist << "#EXTM3U\n"
+             << "#EXT-X-VERSION:3\n"
+             << "#EXT-X-TARGETDURATION:10\n"
+             << "#EXT-X-MEDIA-SEQUENCE:" << mediaSequence << "\n"
+             << "#EXT-X-KEY:METHOD=AES-128,URI=\"https://radio.example.com/keys/current.key\"\n";
+    for (size_t segment = 0; segment < segmentCount; ++segment) {
+        playlist << "#EXTINF:10.005,title=\"Station\",url=\"\"\n"
+                 << "segments/stream_" << (mediaSequence + static_cast<long>(segment)) << ".aac\n";
+    }
+    return playlist.str();
+}
+
+/// Test harness for benchmarking @c M3UStreamParser.
+class M3UParserBenchmarkTest : public Test {
+protected:
+    void SetUp() override;
+
+    /**
+     * Parse a playlist in chunks.
+     *
+     * @param playlist The playlist.
+     * @param lastSeenMediaSequence The media sequence number of the last segment already seen.
+     * @return The number of entries parsed.
+     */
+    size_t parse(const std::string& playlist, long lastSeenMediaSequence);
+
+    /**
+     * Parse a playlist @c REPETITIONS times, and report the time and allocations per parse and per segment parsed.
+     *
+     * @param description The description of the parse.
+     * @param playlist The playlist.
+     * @param lastSeenMediaSequence The media sequence number of the last segment already seen.
+     * @return The number of allocations per parse.
+     */
+    size_t measure(const std::string& description, const std::string& playlist, long lastSeenMediaSequence);
+};
+
+void M3UParserBenchmarkTest::SetUp() {
+    // Debug logging would dominate the measurements.
+    getConsoleLogger()->setLevel(Level::WARN);
+    AllocationCounter::stop();
+}
+
+size_t M3UParserBenchmarkTest::parse(const std::string& playlist, long lastSeenMediaSequence) {
+    M3UStreamParser parser(PLAYLIST_URL, lastSeenMediaSequence);
+    for (size_t offset = 0; offset < playlist.size(); offset += CHUNK_SIZE) {
+        parser.feed(playlist.data() + offset, std::min(CHUNK_SIZE, playlist.size() - offset));
+    }
+    return parser.finish().entries.size();
+}
+
+size_t M3UParserBenchmarkTest::measure(
+    const std::string& description,
+    const std::string& playlist,
+    long lastSeenMediaSequence) {
+    // Warm up.
+    auto entryCount = parse(playlist, lastSeenMediaSequence);
+
+    AllocationCounter::start();
+    auto startTime = Clock::now();
+    for (size_t repetition = 0; repetition < REPETITIONS; ++repetition) {
+        parse(playlist, lastSeenMediaSequence);
+    }
+    auto duration = Clock::now() - startTime;
+    AllocationCounter::stop();
+
+    auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count() / REPETITIONS;
+    auto allocations = AllocationCounter::getCount() / REPETITIONS;
+    std::cout << description << ", " << playlist.size() << " bytes, " << entryCount << " entries:" << std::endl
+              << "  parse time: " << microseconds << " us" << std::endl
+              << "  allocations: " << allocations << " per parse, "
+              << static_cast<double>(allocations) / std::max<size_t>(entryCount, 1) << " per entry" << std::endl;
+    return allocations;
+}
+
+/**
+ * Parse a large playlist in the chunks it is received in, and report the parse time and the allocations made per
+ * entry.
+ */
+TEST_F(M3UParserBenchmarkTest, testSlow_parseLargePlaylist) {
+    auto playlist = createPlaylist(FIRST_MEDIA_SEQUENCE, SEGMENT_COUNT);
+    ASSERT_EQ(SEGMENT_COUNT, parse(playlist, INVALID_MEDIA_SEQUENCE));
+
+    measure("First parse", playlist, INVALID_MEDIA_SEQUENCE);
+}
+
+/**
+ * Parse a refresh of a large live playlist which slid by a few segments, as a whole and skipping the segments already
+ * seen, and verify that skipping them makes the refresh cost the new segments only.
+ */
+TEST_F(M3UParserBenchmarkTest, testSlow_refreshLargeLivePlaylist) {
+    auto lastSeenMediaSequence = FIRST_MEDIA_SEQUENCE + static_cast<long>(SEGMENT_COUNT) - 1;
+    auto refreshedPlaylist =
+        createPlaylist(FIRST_MEDIA_SEQUENCE + static_cast<long>(NEW_SEGMENTS_PER_REFRESH), SEGMENT_COUNT);
+    ASSERT_EQ(NEW_SEGMENTS_PER_REFRESH, parse(refreshedPlaylist, lastSeenMediaSequence));
+
+    auto fullAllocations = measure("Refresh parsed whole", refreshedPlaylist, INVALID_MEDIA_SEQUENCE);
+    auto deltaAllocations = measure("Refresh skipping seen segments", refreshedPlaylist, lastSeenMediaSequence);
+    EXPECT_LT(deltaAllocations * 100, fullAllocations);
+}
+
+}  // namespace test
+}  // namespace playlistParser
+}  // namespace alexaClientSDK
@@ -45,6 +45,19 @@ static const std::string PLAYLIST_URL = "https://www.amazon.com/playlist.m3u8";
 /// Test master playlist URL.
 static const std::string MASTER_PLAYLIST_URL = "https://www.amazon.com/master-playlist.m3u8";
 
+/// Test live HLS playlist with Windows style line breaks and relative segment URLs.
+static const std::string LIVE_PLAYLIST =
+    "#EXTM3U\r\n"
+    "#EXT-X-TARGETDURATION:10\r\n"
+    "#EXT-X-MEDIA-SEQUENCE:100\r\n"
+    "#EXT-X-MAP:URI=\"init.mp4\"\r\n"
+    "#EXTINF:10.5,RADIO\r\n"
+    "segment100.aac\r\n"
+    "#EXTINF:9.25,\r\n"
+    "segment101.aac\r\n"
+    "#EXTINF:10,\r\n"
+    "segment102.aac\r\n";
+
 /**
  * Helper method to assert that encryption info match.
  *
@@ -254,6 +267,98 @@ TEST(M3UParserTest, test_masterPlaylist) {
     EXPECT_TRUE(m3uContent.isMasterPlaylist());
 }
 
+TEST(M3UParserTest, test_parseRuntime) {
+    std::string playlist = EXT_M3U_HEADER + "#EXTINF:10.5,title\n" + MEDIA_URL + "\n#EXTINF: 3 ,\n" + MEDIA_URL +
+                           "\n#EXTINF:-1,\n" + MEDIA_URL + "\n#EXTINF:1.2345\n" + MEDIA_URL + "\n#EXTINF:1x\n" +
+                           MEDIA_URL;
+
+    auto m3uContent = parseM3UContent(PLAYLIST_URL, playlist);
+
+    ASSERT_EQ(5u, m3uContent.entries.size());
+    EXPECT_EQ(std::chrono::milliseconds(10500), m3uContent.entries[0].duration);
+    EXPECT_EQ(std::chrono::milliseconds(3000), m3uContent.entries[1].duration);
+    EXPECT_EQ(std::chrono::milliseconds(-1), m3uContent.entries[2].duration);
+    EXPECT_EQ(std::chrono::milliseconds(1234), m3uContent.entries[3].duration);
+    EXPECT_EQ(std::chrono::milliseconds(-1), m3uContent.entries[4].duration);
+}
+
+/**
+ * Verify that a playlist fed in chunks split at any position is parsed as if it were parsed whole.
+ */
+TEST(M3UParserTest, test_streamParserChunksSplitAnywhere) {
+    auto expected = parseM3UContent(PLAYLIST_URL, LIVE_PLAYLIST);
+    ASSERT_EQ(4u, expected.entries.size());
+    EXPECT_EQ("https://www.amazon.com/init.mp4", expected.entries[0].url);
+    EXPECT_EQ("https://www.amazon.com/segment100.aac", expected.entries[1].url);
+    EXPECT_EQ(std::chrono::milliseconds(10500), expected.entries[1].duration);
+    EXPECT_EQ(std::chrono::milliseconds(29750), expected.entries[0].encryptionInfo.totalDuration);
+
+    for (size_t split = 1; split < LIVE_PLAYLIST.size(); ++split) {
+        M3UStreamParser parser(PLAYLIST_URL);
+        parser.feed(LIVE_PLAYLIST.data(), split);
+        parser.feed(LIVE_PLAYLIST.data() + split, LIVE_PLAYLIST.size() - split);
+        auto m3uContent = parser.finish();
+
+        EXPECT_TRUE(parser.isExtendedM3U());
+        EXPECT_TRUE(m3uContent.isLive);
+        EXPECT_EQ(100, m3uContent.mediaSequence);
+        ASSERT_EQ(expected.entries.size(), m3uContent.entries.size()) << "split=" << split;
+        for (size_t i = 0; i < expected.entries.size(); ++i) {
+            EXPECT_EQ(expected.entries[i].url, m3uContent.entries[i].url) << "split=" << split;
+            EXPECT_EQ(expected.entries[i].duration, m3uContent.entries[i].duration) << "split=" << split;
+            EXPECT_EQ(expected.entries[i].type, m3uContent.entries[i].type) << "split=" << split;
+        }
+    }
+}
+
+/**
+ * Verify that the segments up to the last one seen are skipped, along with what precedes them.
+ */
+TEST(M3UParserTest, test_streamParserSkipsSeenSegments) {
+    M3UStreamParser parser(PLAYLIST_URL, 101);
+    parser.feed(LIVE_PLAYLIST.data(), LIVE_PLAYLIST.size());
+    auto m3uContent = parser.finish();
+
+    ASSERT_EQ(1u, m3uContent.entries.size());
+    EXPECT_EQ("https://www.amazon.com/segment102.aac", m3uContent.entries[0].url);
+    EXPECT_EQ(std::chrono::milliseconds(10000), m3uContent.entries[0].duration);
+    EXPECT_EQ("0x00000000000000000000000000000003", m3uContent.entries[0].encryptionInfo.initVector);
+    EXPECT_EQ(2u, parser.getSkippedSegmentCount());
+    EXPECT_EQ(102, parser.getLastMediaSequence());
+}
+
+/**
+ * Verify that a refresh without new segments yields no entries, and that segments are not skipped without a media
+ * sequence number.
+ */
+TEST(M3UParserTest, test_streamParserWithoutNewSegments) {
+    M3UStreamParser parser(PLAYLIST_URL, 102);
+    parser.feed(LIVE_PLAYLIST.data(), LIVE_PLAYLIST.size());
+    auto m3uContent = parser.finish();
+    EXPECT_TRUE(m3uContent.empty());
+    EXPECT_EQ(3u, parser.getSkippedSegmentCount());
+
+    std::string playlist = EXT_M3U_HEADER + MEDIA_URL + "\n" + MEDIA_URL + "\n";
+    M3UStreamParser noSequenceParser(PLAYLIST_URL, 102);
+    noSequenceParser.feed(playlist.data(), playlist.size());
+    EXPECT_EQ(2u, noSequenceParser.finish().entries.size());
+    EXPECT_EQ(INVALID_MEDIA_SEQUENCE, noSequenceParser.getLastMediaSequence());
+}
+
+/**
+ * Verify that everything after the EXT-X-ENDLIST tag is ignored, and that the last entry finishes the playlist.
+ */
+TEST(M3UParserTest, test_streamParserEndList) {
+    std::string playlist = EXT_M3U_HEADER + MEDIA_URL + "\n#EXT-X-ENDLIST\n" + PLAYLIST_URL + "\n";
+    M3UStreamParser parser(PLAYLIST_URL);
+    parser.feed(playlist.data(), playlist.size());
+    auto m3uContent = parser.finish();
+
+    EXPECT_FALSE(m3uContent.isLive);
+    ASSERT_EQ(1u, m3uContent.entries.size());
+    EXPECT_EQ(PlaylistParseResult::FINISHED, m3uContent.entries[0].parseResult);
+}
+
 }  // namespace test
 }  // namespace playlistParser
 }  // namespace alexaClientSDK
\ No newline at end of file
@@ -0,0 +1,363 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/WaitEvent.h>
+
+#include "PlaylistParser/UrlContentToAttachmentConverter.h"
+
+namespace alexaClientSDK {
+namespace playlistParser {
+namespace test {
+
+using namespace ::testing;
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::utils;
+
+/// The URL of the test playlist.
+static const std::string PLAYLIST_URL = "http://test.com/playlist.m3u8";
+
+/// The URL of the encryption key.
+static const std::string KEY_URL = "http://test.com/key";
+
+/// The URL of the n-th segment of the test playlist.
+static std::string segmentURL(int index) {
+    return "http://test.com/segment" + std::to_string(index) + ".ts";
+}
+
+/// The encryption key: aaaaaaaaaaaaaaaa.
+static const std::string KEY(16, 'a');
+
+/// The EXT-X-KEY tag of the segments, with the IV of the encrypted contents below.
+static const std::string KEY_TAG =
+    "#EXT-X-KEY:METHOD=AES-128,URI=\"" + KEY_URL + "\",IV=0x41414141414141414141414141414141\n";
+
+/// Decrypted content of a single block segment.
+static const std::string DECRYPTED_STRING = "HelloWorld!\n";
+
+/// The above string encrypted with the key and IV above.
+static const std::string AES_ENCRYPTED_CONTENT =
+    "\xe8\xc2\x17\xa0\xa6\x95\x88\x39\xa3\x05\xa4\xfa\x42\x91\x52\x19";
+
+/// Decrypted content of a segment spanning several blocks.
+static const std::string MULTI_BLOCK_DECRYPTED_STRING = "HelloWorld! HelloWorld! HelloWorld! HelloWorld!\n";
+
+/// The above string encrypted with the key and IV above.
+static const std::string MULTI_BLOCK_AES_ENCRYPTED_CONTENT =
+    "\x98\x9d\xd1\x32\x34\x3d\x9d\xc3\x45\xf8\xec\x6e\xdd\x85\x96\x6c"
+    "\x10\x6a\x44\x3c\xe3\xc2\x98\x0b\x78\x2b\x72\xaf\x2d\xf9\x71\x35"
+    "\x6b\x1e\x6d\xf2\xde\xbb\x98\x85\x42\xad\x5c\xdb\x09\x15\x05\x60"
+    "\x6f\x86\xea\x94\x98\xf9\x38\x20\xe8\x47\xcb\xe5\x03\xf2\x10\xf0";
+
+/// The delay of a body whose download never finishes.
+static const std::chrono::milliseconds ENDLESS_DELAY = std::chrono::hours(1);
+
+/// How long to wait for the converter.
+static const std::chrono::seconds TIMEOUT{5};
+
+/// The content served at a URL.
+struct Resource {
+    /// The content type of the resource, or empty to fail the request.
+    std::string contentType;
+
+    /// The body of the resource.
+    std::string body;
+
+    /// How long after the body is requested its download finishes.
+    std::chrono::milliseconds delay;
+};
+
+/// The resources served to the content fetchers, and what they were asked.
+struct TestServer {
+    /// Serializes access to the members.
+    std::mutex mutex;
+
+    /// The resources by URL.
+    std::unordered_map<std::string, Resource> resources;
+
+    /// The number of fetchers created for each URL.
+    std::unordered_map<std::string, int> fetchCounts;
+
+    /// Woken up when the body of a resource whose download never finishes is requested.
+    WaitEvent endlessBodyRequested;
+};
+
+/// A content fetcher of the resources of a @c TestServer, which writes the body at once but only finishes its
+/// download after the delay of the resource.
+class TestContentFetcher : public HTTPContentFetcherInterface {
+public:
+    TestContentFetcher(const std::string& url, std::shared_ptr<TestServer> server) :
+            m_url{url},
+            m_server{std::move(server)},
+            m_state{HTTPContentFetcherInterface::State::INITIALIZED} {
+        std::lock_guard<std::mutex> lock(m_server->mutex);
+        m_server->fetchCounts[m_url]++;
+        auto it = m_server->resources.find(m_url);
+        if (it != m_server->resources.end()) {
+            m_resource = it->second;
+        }
+    }
+
+    std::string getUrl() const override {
+        return m_url;
+    }
+
+    std::string getEffectiveUrl() const override {
+        return m_url;
+    }
+
+    HTTPContentFetcherInterface::Header getHeader(std::atomic<bool>* shouldShutdown) override {
+        HTTPContentFetcherInterface::Header header;
+        if (m_resource.contentType.empty()) {
+            header.successful = false;
+            header.responseCode = http::HTTPResponseCode::CLIENT_ERROR_FORBIDDEN;
+            m_state = HTTPContentFetcherInterface::State::ERROR;
+        } else {
+            header.successful = true;
+            header.responseCode = http::HTTPResponseCode::SUCCESS_OK;
+            header.contentType = m_resource.contentType;
+            m_state = HTTPContentFetcherInterface::State::HEADER_DONE;
+        }
+        return header;
+    }
+
+    HTTPContentFetcherInterface::State getState() override {
+        if (HTTPContentFetcherInterface::State::FETCHING_BODY == m_state &&
+            std::chrono::steady_clock::now() >= m_bodyDone) {
+            m_state = HTTPContentFetcherInterface::State::BODY_DONE;
+        }
+        return m_state;
+    }
+
+    bool getBody(std::shared_ptr<AttachmentWriter> writer) override {
+        if (!writer || m_resource.contentType.empty()) {
+            return false;
+        }
+        auto writeStatus = AttachmentWriter::WriteStatus::OK;
+        writer->write(m_resource.body.data(), m_resource.body.size(), &writeStatus);
+        m_bodyDone = std::chrono::steady_clock::now() + m_resource.delay;
+        m_state = HTTPContentFetcherInterface::State::FETCHING_BODY;
+        if (ENDLESS_DELAY == m_resource.delay) {
+            m_server->endlessBodyRequested.wakeUp();
+        }
+        return true;
+    }
+
+    void shutdown() override {
+    }
+
+    std::unique_ptr<HTTPContent> getContent(
+        FetchOptions fetchOption,
+        std::unique_ptr<AttachmentWriter> writer,
+        const std::vector<std::string>& customHeaders = std::vector<std::string>()) override {
+        return nullptr;
+    }
+
+private:
+    /// The URL fetched.
+    const std::string m_url;
+
+    /// The server of the resource.
+    const std::shared_ptr<TestServer> m_server;
+
+    /// The resource fetched, which has no content type if it is not found.
+    Resource m_resource;
+
+    /// The state of the fetch.
+    HTTPContentFetcherInterface::State m_state;
+
+    /// When the download of the body finishes.
+    std::chrono::steady_clock::time_point m_bodyDone;
+};
+
+/// A mock factory that creates test content fetchers.
+class MockContentFetcherFactory : public HTTPContentFetcherInterfaceFactoryInterface {
+public:
+    MOCK_METHOD1(create, std::unique_ptr<HTTPContentFetcherInterface>(const std::string& url));
+};
+
+/// An observer of the errors and the completion of the converter.
+class TestObserver
+        : public UrlContentToAttachmentConverter::ErrorObserverInterface
+        , public UrlContentToAttachmentConverter::WriteCompleteObserverInterface {
+public:
+    void onError() override {
+        errorEvent.wakeUp();
+    }
+
+    void onWriteComplete() override {
+        writeCompleteEvent.wakeUp();
+    }
+
+    /// Woken up on error.
+    WaitEvent errorEvent;
+
+    /// Woken up when the writing is complete.
+    WaitEvent writeCompleteEvent;
+};
+
+class UrlContentToAttachmentConverterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_server = std::make_shared<TestServer>();
+        m_observer = std::make_shared<TestObserver>();
+        m_factory = std::make_shared<MockContentFetcherFactory>();
+        auto server = m_server;
+        EXPECT_CALL(*m_factory, create(_)).WillRepeatedly(Invoke([server](const std::string& url) {
+            return std::unique_ptr<HTTPContentFetcherInterface>(new TestContentFetcher(url, server));
+        }));
+        m_server->resources[KEY_URL] = {"application/octet-stream", KEY, std::chrono::milliseconds::zero()};
+    }
+
+    void TearDown() override {
+        if (m_converter && !m_converter->isShutdown()) {
+            m_converter->shutdown();
+        }
+    }
+
+    /**
+     * Serves an encrypted playlist of segments.
+     *
+     * @param segments The encrypted bodies of the segments, with the delay after which each download finishes.
+     */
+    void servePlaylist(const std::vector<std::pair<std::string, std::chrono::milliseconds>>& segments) {
+        std::string playlist = "#EXTM3U\n#EXT-X-TARGETDURATION:10\n#EXT-X-MEDIA-SEQUENCE:0\n" + KEY_TAG;
+        for (size_t i = 0; i < segments.size(); ++i) {
+            playlist += "#EXTINF:10,\n" + segmentURL(i) + "\n";
+            m_server->resources[segmentURL(i)] = {"video/mp2t", segments[i].first, segments[i].second};
+        }
+        playlist += "#EXT-X-ENDLIST\n";
+        m_server->resources[PLAYLIST_URL] = {
+            "application/vnd.apple.mpegurl", playlist, std::chrono::milliseconds::zero()};
+    }
+
+    /// Creates the converter of the playlist.
+    void createConverter() {
+        m_converter = UrlContentToAttachmentConverter::create(
+            m_factory, PLAYLIST_URL, m_observer, std::chrono::milliseconds::zero(), m_observer);
+        ASSERT_NE(m_converter, nullptr);
+        m_reader = m_converter->getAttachment()->createReader(avsCommon::utils::sds::ReaderPolicy::BLOCKING);
+        ASSERT_NE(m_reader, nullptr);
+    }
+
+    /**
+     * Reads the attachment until it is closed.
+     *
+     * @param[out] content The content of the attachment.
+     * @return Whether the attachment was closed before the timeout.
+     */
+    bool readAttachment(std::string* content) {
+        auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+        char buffer[256];
+        while (std::chrono::steady_clock::now() < deadline) {
+            auto readStatus = AttachmentReader::ReadStatus::OK;
+            auto bytesRead = m_reader->read(buffer, sizeof(buffer), &readStatus, std::chrono::milliseconds(100));
+            content->append(buffer, bytesRead);
+            if (AttachmentReader::ReadStatus::CLOSED == readStatus) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// The resources served.
+    std::shared_ptr<TestServer> m_server;
+
+    /// The observer of the converter.
+    std::shared_ptr<TestObserver> m_observer;
+
+    /// The factory of the content fetchers.
+    std::shared_ptr<MockContentFetcherFactory> m_factory;
+
+    /// The converter under test.
+    std::shared_ptr<UrlContentToAttachmentConverter> m_converter;
+
+    /// The reader of the attachment of the converter.
+    std::unique_ptr<AttachmentReader> m_reader;
+};
+
+/**
+ * Tests that prefetched segments are written in order although their downloads finish in reverse order, and that
+ * their shared key is fetched once.
+ */
+TEST_F(UrlContentToAttachmentConverterTest, test_prefetchedSegmentsAreWrittenInOrder) {
+    servePlaylist({{AES_ENCRYPTED_CONTENT, std::chrono::milliseconds(300)},
+                   {MULTI_BLOCK_AES_ENCRYPTED_CONTENT, std::chrono::milliseconds(200)},
+                   {AES_ENCRYPTED_CONTENT, std::chrono::milliseconds(100)},
+                   {MULTI_BLOCK_AES_ENCRYPTED_CONTENT, std::chrono::milliseconds::zero()}});
+    createConverter();
+
+    std::string content;
+    ASSERT_TRUE(readAttachment(&content));
+    EXPECT_EQ(
+        content, DECRYPTED_STRING + MULTI_BLOCK_DECRYPTED_STRING + DECRYPTED_STRING + MULTI_BLOCK_DECRYPTED_STRING);
+    EXPECT_TRUE(m_observer->writeCompleteEvent.wait(TIMEOUT));
+    EXPECT_FALSE(m_observer->errorEvent.wait(std::chrono::milliseconds::zero()));
+    std::lock_guard<std::mutex> lock(m_server->mutex);
+    EXPECT_EQ(m_server->fetchCounts[KEY_URL], 1);
+}
+
+/**
+ * Tests that shutting down the converter while a segment is prefetched stops the prefetch and closes the attachment.
+ */
+TEST_F(UrlContentToAttachmentConverterTest, test_shutdownDuringPrefetch) {
+    servePlaylist({{AES_ENCRYPTED_CONTENT, std::chrono::milliseconds::zero()},
+                   {MULTI_BLOCK_AES_ENCRYPTED_CONTENT, ENDLESS_DELAY},
+                   {AES_ENCRYPTED_CONTENT, std::chrono::milliseconds::zero()}});
+    createConverter();
+    ASSERT_TRUE(m_server->endlessBodyRequested.wait(TIMEOUT));
+    std::string firstSegment(DECRYPTED_STRING.size(), '\0');
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    ASSERT_EQ(m_reader->read(&firstSegment[0], firstSegment.size(), &readStatus, TIMEOUT), firstSegment.size());
+    EXPECT_EQ(firstSegment, DECRYPTED_STRING);
+
+    auto converter = m_converter;
+    auto shutdown = std::async(std::launch::async, [converter]() { converter->shutdown(); });
+    ASSERT_EQ(shutdown.wait_for(TIMEOUT), std::future_status::ready);
+
+    std::string content;
+    ASSERT_TRUE(readAttachment(&content));
+    EXPECT_TRUE(content.empty());
+    EXPECT_FALSE(m_observer->writeCompleteEvent.wait(std::chrono::milliseconds::zero()));
+}
+
+/**
+ * Tests that a segment whose key cannot be fetched fails the conversion.
+ */
+TEST_F(UrlContentToAttachmentConverterTest, test_keyFetchFailure) {
+    servePlaylist({{AES_ENCRYPTED_CONTENT, std::chrono::milliseconds::zero()},
+                   {AES_ENCRYPTED_CONTENT, std::chrono::milliseconds::zero()}});
+    m_server->resources.erase(KEY_URL);
+    createConverter();
+
+    EXPECT_TRUE(m_observer->errorEvent.wait(TIMEOUT));
+    std::string content;
+    ASSERT_TRUE(readAttachment(&content));
+    EXPECT_TRUE(content.empty());
+}
+
+}  // namespace test
+}  // namespace playlistParser
+}  // namespace alexaClientSDK
@@ -16,6 +16,7 @@
 #define SAMPLEAPP_SDKDIAGNOSTICS_H_
 
 #include <memory>
+#include <mutex>
 
 #include <AVSCommon/SDKInterfaces/Diagnostics/AudioInjectorInterface.h>
 #include <AVSCommon/SDKInterfaces/Diagnostics/DiagnosticsInterface.h>
@@ -29,6 +30,16 @@ namespace sampleApp {
 /**
  * An SDK implementation which implements the @c DiagnosticsInterface APIs.
  * This class depends on the underlying Diagnostic API objects for thread-safety.
+ *
+ * When the protocol trace is built in, the directives and events are also appended to a @c ProtocolCaptureFile,
+ * which survives a crash, if the configuration sets its path:
+ *
+ * @code{.json}
+ * "diagnostics": {
+ *     "protocolCaptureFilePath": "<path of the capture file>",
+ *     "protocolCaptureSizeBytes": <size of the capture ring, optional>
+ * }
+ * @endcode
  */
 class SDKDiagnostics : public avsCommon::sdkInterfaces::diagnostics::DiagnosticsInterface {
 public:
@@ -65,12 +76,21 @@ private:
         std::shared_ptr<diagnostics::DeviceProtocolTracer> protocolTrace,
         std::shared_ptr<avsCommon::sdkInterfaces::diagnostics::AudioInjectorInterface> audioInjector);
 
+    /**
+     * Starts appending the traced directives and events to the protocol capture file set by the configuration, if
+     * any.
+     */
+    void startProtocolCapture();
+
     /// The object for obtaining device properties.
     std::shared_ptr<diagnostics::DevicePropertyAggregator> m_deviceProperties;
 
     /// The object for capturing directives and events.
     std::shared_ptr<diagnostics::DeviceProtocolTracer> m_protocolTrace;
 
+    /// The flag to start the protocol capture only once.
+    std::once_flag m_protocolCaptureOnceFlag;
+
     /// The object for injecting audio.
     std::shared_ptr<avsCommon::sdkInterfaces::diagnostics::AudioInjectorInterface> m_audioInjector;
 };
@@ -12,6 +12,7 @@
  * express or implied. See the License for the specific language governing
  * permissions and limitations under the License.
  */
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 
 #include "SampleApp/SDKDiagnostics.h"
@@ -23,6 +24,7 @@ using namespace alexaClientSDK::diagnostics;
 using namespace avsCommon::avs::attachment;
 using namespace avsCommon::sdkInterfaces;
 using namespace avsCommon::sdkInterfaces::diagnostics;
+using namespace avsCommon::utils::configuration;
 
 /// String to identify log entries originating from this file.
 #define TAG "SDKDiagnostics"
@@ -34,6 +36,15 @@ using namespace avsCommon::sdkInterfaces::diagnostics;
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// The key in our config file to find the root of diagnostics configuration.
+static const std::string DIAGNOSTICS_CONFIGURATION_ROOT_KEY = "diagnostics";
+
+/// The key in our config file to find the path of the protocol capture file. Nothing is captured if it is not set.
+static const std::string PROTOCOL_CAPTURE_FILE_PATH_KEY = "protocolCaptureFilePath";
+
+/// The key in our config file to find the size in bytes of the protocol capture file.
+static const std::string PROTOCOL_CAPTURE_SIZE_KEY = "protocolCaptureSizeBytes";
+
 std::unique_ptr<SDKDiagnostics> SDKDiagnostics::create() {
     ACSDK_DEBUG5(LX(__func__));
 
@@ -94,6 +105,35 @@ void SDKDiagnostics::setDiagnosticDependencies(
     std::shared_ptr<AttachmentManagerInterface> attachmentManager,
     std::shared_ptr<AVSConnectionManagerInterface> connectionManager) {
     ACSDK_DEBUG5(LX(__func__));
+
+    // This is the first call made once the configuration is loaded. The capture is started only once, so that a
+    // restart of the client does not move the capture of this run aside.
+    if (m_protocolTrace) {
+        std::call_once(m_protocolCaptureOnceFlag, [this] { startProtocolCapture(); });
+    }
+}
+
+void SDKDiagnostics::startProtocolCapture() {
+    auto diagnosticsConfig = ConfigurationNode::getRoot()[DIAGNOSTICS_CONFIGURATION_ROOT_KEY];
+    std::string path;
+    if (!diagnosticsConfig.getString(PROTOCOL_CAPTURE_FILE_PATH_KEY, &path) || path.empty()) {
+        return;
+    }
+
+    int sizeBytes = static_cast<int>(ProtocolCaptureFile::DEFAULT_CAPACITY_BYTES);
+    diagnosticsConfig.getInt(PROTOCOL_CAPTURE_SIZE_KEY, &sizeBytes, sizeBytes);
+    if (sizeBytes <= 0) {
+        ACSDK_ERROR(LX("startProtocolCaptureFailed").d("reason", "invalidSize").d("sizeBytes", sizeBytes));
+        return;
+    }
+
+    auto captureFile = ProtocolCaptureFile::create(path, static_cast<size_t>(sizeBytes));
+    if (!captureFile) {
+        ACSDK_ERROR(LX("startProtocolCaptureFailed").d("reason", "createFailed").d("path", path));
+        return;
+    }
+    ACSDK_INFO(LX("protocolCaptureStarted").d("path", path).d("sizeBytes", sizeBytes));
+    m_protocolTrace->setCaptureFile(captureFile);
 }
 
 std::shared_ptr<AudioInjectorInterface> SDKDiagnostics::getAudioInjector() {
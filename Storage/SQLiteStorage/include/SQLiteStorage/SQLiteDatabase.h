@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <sqlite3.h>
@@ -49,7 +50,7 @@ public:
         ~Transaction();
 
         /**
-         * Commits the current transaction.
+         * Commits the current transaction.  If the commit fails, the transaction is rolled back.
          *
          * @return true if commit was successful, false otherwise
          */
@@ -150,7 +151,7 @@ public:
     bool dropTable(const std::string& tableName);
 
     /**
-     * If open, close the internal SQLite DB.  Do nothing if there is no DB open.
+     * If open, close the internal SQLite DB.  Do nothing if there is no DB open.  All cached statements are finalized.
      */
     void close();
 
@@ -162,6 +163,25 @@ public:
      */
     std::unique_ptr<SQLiteStatement> createStatement(const std::string& sqlString);
 
+    /**
+     * Get a prepared statement from the statement cache of a table, preparing and caching it on first use.  The
+     * statement is owned by the database and is reset, with its bindings cleared, before it is returned.  Callers
+     * should @c reset() the statement once done with it so that no read cursor is left open on the table.
+     *
+     * @param tableName The name of the table the statement operates on.
+     * @param sqlString The SQL command to execute.
+     * @return The cached statement, or @c nullptr if it could not be prepared.  The statement remains valid until the
+     * statements of the table are evicted or the database is closed.
+     */
+    SQLiteStatement* getCachedStatement(const std::string& tableName, const std::string& sqlString);
+
+    /**
+     * Finalize and remove all the cached statements of a table.  This is done automatically by @c dropTable().
+     *
+     * @param tableName The name of the table whose statements are evicted.
+     */
+    void evictCachedStatements(const std::string& tableName);
+
     /**
      * Checks if the database is ready to be acted upon.
      *
@@ -178,7 +198,7 @@ public:
 
 private:
     /**
-     * Commits the transaction started with @c beginTransaction.
+     * Commits the transaction started with @c beginTransaction, or rolls it back if the commit fails.
      *
      * @return true if transaction has been successfully committed, false otherwise.
      */
@@ -199,6 +219,10 @@ private:
     /// The sqlite database handle.
     sqlite3* m_dbHandle;
 
+    /// The prepared statements cached by @c getCachedStatement(), keyed by table name and then by SQL string.
+    std::unordered_map<std::string, std::unordered_map<std::string, std::unique_ptr<SQLiteStatement>>>
+        m_statementCache;
+
     /**
      * A shared_ptr to this that is used to manage viability of weak_ptrs to this.  This shared_ptr has a no-op deleter,
      * and does not manage the lifecycle of this instance.  Instead, ~SQLiteDatabase() resets this shared_ptr to signal
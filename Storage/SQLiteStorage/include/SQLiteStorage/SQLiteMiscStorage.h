@@ -17,6 +17,8 @@
 #define ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITEMISCSTORAGE_H_
 
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include <AVSCommon/SDKInterfaces/Storage/MiscStorageInterface.h>
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
@@ -108,6 +110,15 @@ public:
         const std::string& componentName,
         const std::string& tableName,
         std::unordered_map<std::string, std::string>* valueContainer) override;
+    bool getMany(
+        const std::string& componentName,
+        const std::string& tableName,
+        const std::vector<std::string>& keys,
+        std::unordered_map<std::string, std::string>* values) override;
+    bool putMany(
+        const std::string& componentName,
+        const std::string& tableName,
+        const std::unordered_map<std::string, std::string>& entries) override;
     /// @}
 
     /**
@@ -117,6 +128,9 @@ public:
      * database is not serialized against parallel access and should be used only when it is guaranteed there are no
      * other consumers of the objects.
      *
+     * @note The column types of the tables are cached, so tables managed through this object must not be dropped or
+     * altered through the returned database.
+     *
      * @return Reference to database.
      */
     SQLiteDatabase& getDatabase();
@@ -129,6 +143,27 @@ private:
      */
     SQLiteMiscStorage(const std::string& dbFilePath);
 
+    /**
+     * The column types of a table, cached to avoid querying the table schema on every operation.
+     */
+    struct TableMetadata {
+        /// The key column type.
+        KeyType keyType;
+        /// The value column type.
+        ValueType valueType;
+    };
+
+    /**
+     * Helper method that will check basic things about the DB, and whether the table exists.  Tables with cached
+     * metadata are known to exist without querying the DB.
+     *
+     * @param componentName The component name.
+     * @param tableName The table name to check.
+     * @param tableShouldExist If true, checks if the table should exist. If false, it checks the opposite.
+     * @return an error message if the checks fail, else a blank string
+     */
+    std::string checkTableLocked(const std::string& componentName, const std::string& tableName, bool tableShouldExist);
+
     /**
      * Method that will get the key column type and value column type.
      *
@@ -390,9 +425,44 @@ private:
         const std::string& tableName,
         std::unordered_map<std::string, std::string>* valueContainer);
 
+    /**
+     * Gets the values associated with several keys in the table, in a single transaction.
+     *
+     * @note Must be run with @c mutex locked.
+     *
+     * @param componentName The component name.
+     * @param tableName The table name.
+     * @param keys The keys for the table entries.
+     * @param [out] values The container which receives the key/value pairs that were found.
+     * @return @c true If the values were found out ok, @c false if not.
+     */
+    bool getManyLocked(
+        const std::string& componentName,
+        const std::string& tableName,
+        const std::vector<std::string>& keys,
+        std::unordered_map<std::string, std::string>* values);
+
+    /**
+     * Puts several values in the table, in a single transaction.  Either all or none of the entries are stored.
+     *
+     * @note Must be run with @c mutex locked.
+     *
+     * @param componentName The component name.
+     * @param tableName The table name.
+     * @param entries The key/value pairs of the table entries.
+     * @return @c true If all the values were put ok, @c false if not.
+     */
+    bool putManyLocked(
+        const std::string& componentName,
+        const std::string& tableName,
+        const std::unordered_map<std::string, std::string>& entries);
+
     /// The underlying database class.
     alexaClientSDK::storage::sqliteStorage::SQLiteDatabase m_db;
 
+    /// The column types of the tables used so far, keyed by DB table name.  Cleared when the database is closed.
+    std::unordered_map<std::string, TableMetadata> m_tableMetadata;
+
     /// This is the mutex to serialize access to @c m_db.
     std::mutex m_mutex;
 };
@@ -65,7 +65,8 @@ public:
     bool step();
 
     /**
-     * Resets a statement object to be re-executed with different bound parameters.
+     * Resets a statement object to be re-executed with different bound parameters.  All previously bound parameters
+     * are cleared, so the statement may be reused any number of times without accumulating bound values.
      *
      * @return Whether the reset was successful.
      */
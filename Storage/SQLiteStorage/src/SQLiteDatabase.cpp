@@ -121,6 +121,9 @@ bool SQLiteDatabase::clearTable(const std::string& tableName) {
 }
 
 bool SQLiteDatabase::dropTable(const std::string& tableName) {
+    // A statement which is still prepared against the table would make the drop fail.
+    evictCachedStatements(tableName);
+
     if (!alexaClientSDK::storage::sqliteStorage::dropTable(m_dbHandle, tableName)) {
         ACSDK_ERROR(LX("dropTableFailed").d("could not drop table", tableName));
         return false;
@@ -136,6 +139,8 @@ void SQLiteDatabase::close() {
             rollbackTransaction();
         }
 
+        // SQLite refuses to close a database which still has prepared statements.
+        m_statementCache.clear();
         closeSQLiteDatabase(m_dbHandle);
         m_dbHandle = nullptr;
     }
@@ -153,6 +158,29 @@ std::unique_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteStatement> SQLiteD
     return statement;
 }
 
+SQLiteStatement* SQLiteDatabase::getCachedStatement(const std::string& tableName, const std::string& sqlString) {
+    auto& tableStatements = m_statementCache[tableName];
+    auto it = tableStatements.find(sqlString);
+    if (it != tableStatements.end()) {
+        it->second->reset();
+        return it->second.get();
+    }
+
+    auto statement = createStatement(sqlString);
+    if (!statement) {
+        ACSDK_ERROR(LX("getCachedStatementFailed").d("table", tableName));
+        return nullptr;
+    }
+
+    auto result = statement.get();
+    tableStatements.emplace(sqlString, std::move(statement));
+    return result;
+}
+
+void SQLiteDatabase::evictCachedStatements(const std::string& tableName) {
+    m_statementCache.erase(tableName);
+}
+
 std::unique_ptr<SQLiteDatabase::Transaction> SQLiteDatabase::beginTransaction() {
     if (m_transactionIsInProgress) {
         ACSDK_ERROR(LX("beginTransactionFailed").d("reason", "Only one transaction at a time is allowed"));
@@ -177,6 +205,11 @@ bool SQLiteDatabase::commitTransaction() {
     const std::string sqlString = "COMMIT TRANSACTION;";
     if (!performQuery(sqlString)) {
         ACSDK_ERROR(LX("commitTransactionFailed").d("reason", "Query failed"));
+        // The transaction is over either way: roll it back, unless SQLite already did, so that the next one can begin.
+        if (!sqlite3_get_autocommit(m_dbHandle) && !performQuery("ROLLBACK TRANSACTION;")) {
+            ACSDK_ERROR(LX("commitTransactionFailed").d("reason", "Rollback failed"));
+        }
+        m_transactionIsInProgress = false;
         return false;
     }
 
@@ -76,21 +76,6 @@ static std::string basicDBChecksLocked(
     const std::string& componentName,
     const std::string& tableName);
 
-/**
- * Helper method that will check basic things about the DB.
- *
- * @param db The SQLiteDatabase handle for MiscDB
- * @param componentName The component name.
- * @param tableName The table name to check.
- * @param tableShouldExist If true, checks if the table should exist. If false, it checks the opposite.
- * @return an error message if the checks fail, else a blank string
- */
-static std::string basicDBChecksLocked(
-    SQLiteDatabase& db,
-    const std::string& componentName,
-    const std::string& tableName,
-    bool tableShouldExist);
-
 /**
  * Helper method that will get the table name as it is in the DB.
  * @param componentName The component name.
@@ -100,6 +85,14 @@ static std::string basicDBChecksLocked(
  */
 static std::string getDBTableName(const std::string& componentName, const std::string& tableName);
 
+/**
+ * Helper method that will build the SQL string which adds an entry to a table, or replaces the entry with the same key.
+ *
+ * @param dbTableName The table name as it is in the DB.
+ * @return The SQL string, which takes the key as its first parameter and the value as its second.
+ */
+static std::string getUpsertSqlString(const std::string& dbTableName);
+
 /**
  * Gets the key type as a string
  *
@@ -170,6 +163,7 @@ bool SQLiteMiscStorage::open() {
 }
 
 bool SQLiteMiscStorage::openLocked() {
+    m_tableMetadata.clear();
     if (!m_db.open()) {
         ACSDK_DEBUG0(LX("openDatabaseFailed"));
         return false;
@@ -183,6 +177,7 @@ void SQLiteMiscStorage::close() {
 }
 
 void SQLiteMiscStorage::closeLocked() {
+    m_tableMetadata.clear();
     m_db.close();
 }
 
@@ -192,6 +187,7 @@ bool SQLiteMiscStorage::createDatabase() {
 }
 
 bool SQLiteMiscStorage::createDatabaseLocked() {
+    m_tableMetadata.clear();
     if (!m_db.initialize()) {
         ACSDK_ERROR(LX("createDatabaseFailed"));
         return false;
@@ -234,18 +230,17 @@ std::string basicDBChecksLocked(SQLiteDatabase& db, const std::string& component
     return "";
 }
 
-std::string basicDBChecksLocked(
-    SQLiteDatabase& db,
+std::string SQLiteMiscStorage::checkTableLocked(
     const std::string& componentName,
     const std::string& tableName,
     bool tableShouldExist) {
-    const std::string errorReason = basicDBChecksLocked(db, componentName, tableName);
+    const std::string errorReason = basicDBChecksLocked(m_db, componentName, tableName);
     if (!errorReason.empty()) {
         return errorReason;
     }
 
     std::string dbTableName = getDBTableName(componentName, tableName);
-    bool tableExists = db.tableExists(dbTableName);
+    bool tableExists = m_tableMetadata.count(dbTableName) > 0 || m_db.tableExists(dbTableName);
     if (tableShouldExist && !tableExists) {
         return "Table does not exist";
     }
@@ -256,6 +251,11 @@ std::string basicDBChecksLocked(
     return "";
 }
 
+std::string getUpsertSqlString(const std::string& dbTableName) {
+    return "INSERT OR REPLACE INTO " + dbTableName + " (" + KEY_COLUMN_NAME + ", " + VALUE_COLUMN_NAME +
+           ") VALUES (?, ?);";
+}
+
 std::string getKeyTypeString(SQLiteMiscStorage::KeyType keyType) {
     switch (keyType) {
         case SQLiteMiscStorage::KeyType::STRING_KEY:
@@ -292,7 +292,7 @@ bool SQLiteMiscStorage::getKeyValueTypesLocked(
     KeyType* keyType,
     ValueType* valueType) {
     const std::string errorEvent = "getKeyValueTypesFailed";
-    const std::string errorReason = basicDBChecksLocked(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    const std::string errorReason = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
 
     if (!errorReason.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
@@ -306,6 +306,13 @@ bool SQLiteMiscStorage::getKeyValueTypesLocked(
 
     std::string dbTableName = getDBTableName(componentName, tableName);
 
+    auto metadata = m_tableMetadata.find(dbTableName);
+    if (metadata != m_tableMetadata.end()) {
+        *keyType = metadata->second.keyType;
+        *valueType = metadata->second.valueType;
+        return true;
+    }
+
     const std::string sqlString = "PRAGMA table_info(" + dbTableName + ");";
 
     auto sqlStatement = m_db.createStatement(sqlString);
@@ -319,6 +326,8 @@ bool SQLiteMiscStorage::getKeyValueTypesLocked(
     const std::string tableInfoColumnType = "type";
 
     std::string columnName, columnType;
+    *keyType = KeyType::UNKNOWN_KEY;
+    *valueType = ValueType::UNKNOWN_VALUE;
 
     while (SQLITE_ROW == sqlStatement->getStepResult()) {
         int numberColumns = sqlStatement->getColumnCount();
@@ -358,6 +367,7 @@ bool SQLiteMiscStorage::getKeyValueTypesLocked(
         sqlStatement->step();
     }
 
+    m_tableMetadata[dbTableName] = TableMetadata{*keyType, *valueType};
     return true;
 }
 
@@ -369,7 +379,7 @@ std::string SQLiteMiscStorage::checkKeyTypeLocked(
         return "Cannot check for unknown key column type";
     }
 
-    const std::string basicDBChecksError = basicDBChecksLocked(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    const std::string basicDBChecksError = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
     if (!basicDBChecksError.empty()) {
         return basicDBChecksError;
     }
@@ -400,7 +410,7 @@ std::string SQLiteMiscStorage::checkValueTypeLocked(
         return "Cannot check for unknown value column type";
     }
 
-    const std::string basicDBChecksError = basicDBChecksLocked(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    const std::string basicDBChecksError = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
     if (!basicDBChecksError.empty()) {
         return basicDBChecksError;
     }
@@ -435,7 +445,7 @@ std::string SQLiteMiscStorage::checkKeyValueTypeLocked(
         return "Cannot check for unknown value column type";
     }
 
-    const std::string basicDBChecksError = basicDBChecksLocked(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    const std::string basicDBChecksError = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
     if (!basicDBChecksError.empty()) {
         return basicDBChecksError;
     }
@@ -479,7 +489,7 @@ bool SQLiteMiscStorage::createTableLocked(
     KeyType keyType,
     ValueType valueType) {
     const std::string errorEvent = "createTableFailed";
-    const std::string errorReason = basicDBChecksLocked(m_db, componentName, tableName, CHECK_TABLE_NOT_EXISTS);
+    const std::string errorReason = checkTableLocked(componentName, tableName, CHECK_TABLE_NOT_EXISTS);
 
     if (!errorReason.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
@@ -508,6 +518,7 @@ bool SQLiteMiscStorage::createTableLocked(
         return false;
     }
 
+    m_tableMetadata[dbTableName] = TableMetadata{keyType, valueType};
     return true;
 }
 
@@ -518,7 +529,7 @@ bool SQLiteMiscStorage::clearTable(const std::string& componentName, const std::
 
 bool SQLiteMiscStorage::clearTableLocked(const std::string& componentName, const std::string& tableName) {
     const std::string errorEvent = "clearTableFailed";
-    const std::string errorReason = basicDBChecksLocked(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    const std::string errorReason = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
 
     if (!errorReason.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
@@ -542,7 +553,7 @@ bool SQLiteMiscStorage::deleteTable(const std::string& componentName, const std:
 
 bool SQLiteMiscStorage::deleteTableLocked(const std::string& componentName, const std::string& tableName) {
     const std::string errorEvent = "deleteTableFailed";
-    const std::string errorReason = basicDBChecksLocked(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    const std::string errorReason = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
 
     if (!errorReason.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
@@ -562,6 +573,7 @@ bool SQLiteMiscStorage::deleteTableLocked(const std::string& componentName, cons
         return false;
     }
 
+    m_tableMetadata.erase(dbTableName);
     if (!m_db.dropTable(dbTableName)) {
         ACSDK_ERROR(LX(errorEvent).d("Could not delete table", tableName));
         return false;
@@ -591,7 +603,7 @@ bool SQLiteMiscStorage::getLocked(
         return false;
     }
 
-    const std::string errorReason = basicDBChecksLocked(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    const std::string errorReason = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
     if (!errorReason.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
         return false;
@@ -608,7 +620,7 @@ bool SQLiteMiscStorage::getLocked(
     const std::string sqlString = "SELECT value FROM " + dbTableName + " WHERE " + KEY_COLUMN_NAME + "=?;";
     const int keyIndex = 1;
 
-    auto sqliteStatement = m_db.createStatement(sqlString);
+    auto sqliteStatement = m_db.getCachedStatement(dbTableName, sqlString);
     if (!sqliteStatement) {
         ACSDK_ERROR(LX(errorEvent).d("reason", "Create statement failed."));
         return false;
@@ -616,11 +628,13 @@ bool SQLiteMiscStorage::getLocked(
 
     if (!sqliteStatement->bindStringParameter(keyIndex, key)) {
         ACSDK_ERROR(LX(errorEvent).d("reason", "Bind parameter failed."));
+        sqliteStatement->reset();
         return false;
     }
 
     if (!sqliteStatement->step()) {
         ACSDK_ERROR(LX(errorEvent).d("reason", "Step failed."));
+        sqliteStatement->reset();
         return false;
     }
 
@@ -629,6 +643,7 @@ bool SQLiteMiscStorage::getLocked(
         *value = sqliteStatement->getColumnText(RESULT_COLUMN_POSITION);
     }
 
+    sqliteStatement->reset();
     return true;
 }
 
@@ -653,7 +668,7 @@ bool SQLiteMiscStorage::tableEntryExistsLocked(
         return false;
     }
 
-    const std::string errorReason = basicDBChecksLocked(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    const std::string errorReason = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
     if (!errorReason.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
         return false;
@@ -708,7 +723,7 @@ bool SQLiteMiscStorage::tableExistsLocked(
     }
 
     std::string dbTableName = getDBTableName(componentName, tableName);
-    *tableExistsValue = m_db.tableExists(dbTableName);
+    *tableExistsValue = m_tableMetadata.count(dbTableName) > 0 || m_db.tableExists(dbTableName);
     return true;
 }
 
@@ -727,7 +742,7 @@ bool SQLiteMiscStorage::addLocked(
     const std::string& key,
     const std::string& value) {
     const std::string errorEvent = "addToTableFailed";
-    const std::string errorReason = basicDBChecksLocked(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    const std::string errorReason = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
 
     if (!errorReason.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
@@ -759,19 +774,17 @@ bool SQLiteMiscStorage::addLocked(
     const int keyIndex = 1;
     const int valueIndex = 2;
 
-    auto statement = m_db.createStatement(sqlString);
+    auto statement = m_db.getCachedStatement(dbTableName, sqlString);
     if (!statement) {
         ACSDK_ERROR(LX(errorEvent).d("reason", "Create statement failed."));
         return false;
     }
 
-    if (!statement->bindStringParameter(keyIndex, key) || !statement->bindStringParameter(valueIndex, value)) {
-        ACSDK_ERROR(LX(errorEvent).d("reason", "Bind parameter failed."));
-        return false;
-    }
-
-    if (!statement->step()) {
-        ACSDK_ERROR(LX(errorEvent).d("reason", "Step failed."));
+    bool stepped = statement->bindStringParameter(keyIndex, key) &&
+                   statement->bindStringParameter(valueIndex, value) && statement->step();
+    statement->reset();
+    if (!stepped) {
+        ACSDK_ERROR(LX(errorEvent).d("reason", "Bind parameter or step failed."));
         return false;
     }
 
@@ -793,7 +806,7 @@ bool SQLiteMiscStorage::updateLocked(
     const std::string& key,
     const std::string& value) {
     const std::string errorEvent = "updateTableEntryFailed";
-    const std::string errorReason = basicDBChecksLocked(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    const std::string errorReason = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
 
     if (!errorReason.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
@@ -825,19 +838,17 @@ bool SQLiteMiscStorage::updateLocked(
     const int valueIndex = 1;
     const int keyIndex = 2;
 
-    auto statement = m_db.createStatement(sqlString);
+    auto statement = m_db.getCachedStatement(dbTableName, sqlString);
     if (!statement) {
         ACSDK_ERROR(LX(errorEvent).d("reason", "Create statement failed."));
         return false;
     }
 
-    if (!statement->bindStringParameter(keyIndex, key) || !statement->bindStringParameter(valueIndex, value)) {
-        ACSDK_ERROR(LX(errorEvent).d("reason", "Bind parameter failed."));
-        return false;
-    }
-
-    if (!statement->step()) {
-        ACSDK_ERROR(LX(errorEvent).d("reason", "Step failed."));
+    bool stepped = statement->bindStringParameter(keyIndex, key) &&
+                   statement->bindStringParameter(valueIndex, value) && statement->step();
+    statement->reset();
+    if (!stepped) {
+        ACSDK_ERROR(LX(errorEvent).d("reason", "Bind parameter or step failed."));
         return false;
     }
 
@@ -859,7 +870,7 @@ bool SQLiteMiscStorage::putLocked(
     const std::string& key,
     const std::string& value) {
     const std::string errorEvent = "putToTableFailed";
-    const std::string errorReason = basicDBChecksLocked(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    const std::string errorReason = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
 
     if (!errorReason.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
@@ -873,42 +884,25 @@ bool SQLiteMiscStorage::putLocked(
         return false;
     }
 
-    bool tableEntryExistsValue;
-    if (!tableEntryExistsLocked(componentName, tableName, key, &tableEntryExistsValue)) {
-        ACSDK_ERROR(LX(errorEvent).d("Unable to get table entry information for " + key + " in table", tableName));
-        return false;
-    }
-
     std::string dbTableName = getDBTableName(componentName, tableName);
 
-    std::string sqlString;
-    std::string errorValue;
-
-    if (!tableEntryExistsValue) {
-        sqlString =
-            "INSERT INTO " + dbTableName + " (" + VALUE_COLUMN_NAME + ", " + KEY_COLUMN_NAME + ") VALUES (?, ?);";
-        errorValue = "Could not add entry (" + key + ", " + value + ") to table";
-    } else {
-        sqlString = "UPDATE " + dbTableName + " SET " + VALUE_COLUMN_NAME + "=? WHERE " + KEY_COLUMN_NAME + "=?;";
-        errorValue = "Could not update entry for " + key + " in table";
-    }
+    // A single upsert replaces the lookup of the entry followed by an INSERT or an UPDATE.
+    const std::string sqlString = getUpsertSqlString(dbTableName);
 
-    const int valueIndex = 1;
-    const int keyIndex = 2;
+    const int keyIndex = 1;
+    const int valueIndex = 2;
 
-    auto statement = m_db.createStatement(sqlString);
+    auto statement = m_db.getCachedStatement(dbTableName, sqlString);
     if (!statement) {
         ACSDK_ERROR(LX(errorEvent).d("reason", "Create statement failed."));
         return false;
     }
 
-    if (!statement->bindStringParameter(keyIndex, key) || !statement->bindStringParameter(valueIndex, value)) {
-        ACSDK_ERROR(LX(errorEvent).d("reason", "Bind parameter failed."));
-        return false;
-    }
-
-    if (!statement->step()) {
-        ACSDK_ERROR(LX(errorEvent).d("reason", "Step failed (" + errorValue + ")."));
+    bool stepped = statement->bindStringParameter(keyIndex, key) &&
+                   statement->bindStringParameter(valueIndex, value) && statement->step();
+    statement->reset();
+    if (!stepped) {
+        ACSDK_ERROR(LX(errorEvent).d("reason", "Bind parameter or step failed.").d("key", key));
         return false;
     }
 
@@ -925,7 +919,7 @@ bool SQLiteMiscStorage::removeLocked(
     const std::string& tableName,
     const std::string& key) {
     const std::string errorEvent = "removeTableEntryFailed";
-    const std::string errorReason = basicDBChecksLocked(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    const std::string errorReason = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
 
     if (!errorReason.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
@@ -954,19 +948,16 @@ bool SQLiteMiscStorage::removeLocked(
 
     const int keyIndex = 1;
 
-    auto statement = m_db.createStatement(sqlString);
+    auto statement = m_db.getCachedStatement(dbTableName, sqlString);
     if (!statement) {
         ACSDK_ERROR(LX(errorEvent).d("reason", "Create statement failed."));
         return false;
     }
 
-    if (!statement->bindStringParameter(keyIndex, key)) {
-        ACSDK_ERROR(LX(errorEvent).d("reason", "Bind parameter failed."));
-        return false;
-    }
-
-    if (!statement->step()) {
-        ACSDK_ERROR(LX(errorEvent).d("reason", "Step failed."));
+    bool stepped = statement->bindStringParameter(keyIndex, key) && statement->step();
+    statement->reset();
+    if (!stepped) {
+        ACSDK_ERROR(LX(errorEvent).d("reason", "Bind parameter or step failed."));
         return false;
     }
 
@@ -986,7 +977,7 @@ bool SQLiteMiscStorage::loadLocked(
     const std::string& tableName,
     std::unordered_map<std::string, std::string>* valueContainer) {
     const std::string errorEvent = "loadFromTableFailed";
-    const std::string errorReason = basicDBChecksLocked(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    const std::string errorReason = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
 
     if (!errorReason.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
@@ -1009,10 +1000,13 @@ bool SQLiteMiscStorage::loadLocked(
 
     const std::string sqlString = "SELECT * FROM " + dbTableName + ";";
 
-    auto sqlStatement = m_db.createStatement(sqlString);
+    auto sqlStatement = m_db.getCachedStatement(dbTableName, sqlString);
 
     if ((!sqlStatement) || (!sqlStatement->step())) {
         ACSDK_ERROR(LX(errorEvent).d("Could not load entries from table", tableName));
+        if (sqlStatement) {
+            sqlStatement->reset();
+        }
         return false;
     }
 
@@ -1042,6 +1036,150 @@ bool SQLiteMiscStorage::loadLocked(
         sqlStatement->step();
     }
 
+    sqlStatement->reset();
+    return true;
+}
+
+bool SQLiteMiscStorage::getMany(
+    const std::string& componentName,
+    const std::string& tableName,
+    const std::vector<std::string>& keys,
+    std::unordered_map<std::string, std::string>* values) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return getManyLocked(componentName, tableName, keys, values);
+}
+
+bool SQLiteMiscStorage::getManyLocked(
+    const std::string& componentName,
+    const std::string& tableName,
+    const std::vector<std::string>& keys,
+    std::unordered_map<std::string, std::string>* values) {
+    const std::string errorEvent = "getManyFromTableFailed";
+
+    if (!values) {
+        ACSDK_ERROR(LX(errorEvent).m("Values container is nullptr."));
+        return false;
+    }
+
+    const std::string errorReason = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
+    if (!errorReason.empty()) {
+        ACSDK_ERROR(LX(errorEvent).m(errorReason));
+        return false;
+    }
+
+    const std::string keyValueTypeError =
+        checkKeyValueTypeLocked(componentName, tableName, KeyType::STRING_KEY, ValueType::STRING_VALUE);
+    if (!keyValueTypeError.empty()) {
+        ACSDK_ERROR(LX(errorEvent).m(keyValueTypeError));
+        return false;
+    }
+
+    std::string dbTableName = getDBTableName(componentName, tableName);
+
+    const std::string sqlString = "SELECT value FROM " + dbTableName + " WHERE " + KEY_COLUMN_NAME + "=?;";
+    const int keyIndex = 1;
+    const int resultColumnPosition = 0;
+
+    auto statement = m_db.getCachedStatement(dbTableName, sqlString);
+    if (!statement) {
+        ACSDK_ERROR(LX(errorEvent).d("reason", "Create statement failed."));
+        return false;
+    }
+
+    // Reading every key within one transaction takes the database lock once, and gives a consistent snapshot.
+    auto transaction = m_db.beginTransaction();
+    if (!transaction) {
+        ACSDK_ERROR(LX(errorEvent).d("reason", "Begin transaction failed."));
+        return false;
+    }
+
+    for (const auto& key : keys) {
+        if (!statement->bindStringParameter(keyIndex, key) || !statement->step()) {
+            ACSDK_ERROR(LX(errorEvent).d("reason", "Bind parameter or step failed.").d("key", key));
+            statement->reset();
+            transaction->rollback();
+            return false;
+        }
+
+        if (SQLITE_ROW == statement->getStepResult()) {
+            std::string value = statement->getColumnText(resultColumnPosition);
+            if (!value.empty()) {
+                (*values)[key] = std::move(value);
+            }
+        }
+        statement->reset();
+    }
+
+    if (!transaction->commit()) {
+        ACSDK_ERROR(LX(errorEvent).d("reason", "Commit transaction failed."));
+        return false;
+    }
+
+    return true;
+}
+
+bool SQLiteMiscStorage::putMany(
+    const std::string& componentName,
+    const std::string& tableName,
+    const std::unordered_map<std::string, std::string>& entries) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return putManyLocked(componentName, tableName, entries);
+}
+
+bool SQLiteMiscStorage::putManyLocked(
+    const std::string& componentName,
+    const std::string& tableName,
+    const std::unordered_map<std::string, std::string>& entries) {
+    const std::string errorEvent = "putManyToTableFailed";
+    const std::string errorReason = checkTableLocked(componentName, tableName, CHECK_TABLE_EXISTS);
+
+    if (!errorReason.empty()) {
+        ACSDK_ERROR(LX(errorEvent).m(errorReason));
+        return false;
+    }
+
+    const std::string keyValueTypeError =
+        checkKeyValueTypeLocked(componentName, tableName, KeyType::STRING_KEY, ValueType::STRING_VALUE);
+    if (!keyValueTypeError.empty()) {
+        ACSDK_ERROR(LX(errorEvent).m(keyValueTypeError));
+        return false;
+    }
+
+    std::string dbTableName = getDBTableName(componentName, tableName);
+
+    const std::string sqlString = getUpsertSqlString(dbTableName);
+    const int keyIndex = 1;
+    const int valueIndex = 2;
+
+    auto statement = m_db.getCachedStatement(dbTableName, sqlString);
+    if (!statement) {
+        ACSDK_ERROR(LX(errorEvent).d("reason", "Create statement failed."));
+        return false;
+    }
+
+    // One transaction makes the entries atomic, and syncs the database to disk once rather than once per entry.
+    auto transaction = m_db.beginTransaction();
+    if (!transaction) {
+        ACSDK_ERROR(LX(errorEvent).d("reason", "Begin transaction failed."));
+        return false;
+    }
+
+    for (const auto& entry : entries) {
+        bool stepped = statement->bindStringParameter(keyIndex, entry.first) &&
+                       statement->bindStringParameter(valueIndex, entry.second) && statement->step();
+        statement->reset();
+        if (!stepped) {
+            ACSDK_ERROR(LX(errorEvent).d("reason", "Bind parameter or step failed.").d("key", entry.first));
+            transaction->rollback();
+            return false;
+        }
+    }
+
+    if (!transaction->commit()) {
+        ACSDK_ERROR(LX(errorEvent).d("reason", "Commit transaction failed."));
+        return false;
+    }
+
     return true;
 }
 
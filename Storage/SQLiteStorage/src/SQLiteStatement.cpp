@@ -77,6 +77,10 @@ bool SQLiteStatement::step() {
 
 bool SQLiteStatement::reset() {
     int rcode = sqlite3_reset(m_handle);
+    // SQLite keeps raw pointers to the bound strings, so the bindings must be dropped before the strings are.
+    sqlite3_clear_bindings(m_handle);
+    m_boundValues.clear();
+    m_stepResult = SQLITE_OK;
     if (rcode != SQLITE_OK) {
         ACSDK_ERROR(LX("SQLiteStatement::stepFailed").m("Could not reset the prepared statement.").d("rcode", rcode));
         return false;
@@ -239,6 +239,60 @@ TEST(SQLiteDatabaseTest, test_createDeleteTable) {
     db1.close();
 }
 
+/// Test that a cached statement is prepared once, and that it can be reused with new bindings.
+TEST(SQLiteDatabaseTest, test_cachedStatementIsReused) {
+    auto dbFilePath = generateDbFilePath();
+    SQLiteDatabase db(dbFilePath);
+    ASSERT_TRUE(db.initialize());
+    ASSERT_TRUE(db.performQuery("CREATE TABLE " + TEST_TABLE_NAME + " (key TEXT PRIMARY KEY NOT NULL);"));
+
+    const std::string insertSql = "INSERT INTO " + TEST_TABLE_NAME + " (key) VALUES (?);";
+    auto statement = db.getCachedStatement(TEST_TABLE_NAME, insertSql);
+    ASSERT_NE(statement, nullptr);
+    ASSERT_TRUE(statement->bindStringParameter(1, "first"));
+    ASSERT_TRUE(statement->step());
+
+    ASSERT_EQ(db.getCachedStatement(TEST_TABLE_NAME, insertSql), statement);
+    ASSERT_TRUE(statement->bindStringParameter(1, "second"));
+    ASSERT_TRUE(statement->step());
+    ASSERT_TRUE(statement->reset());
+
+    const std::string countSql = "SELECT COUNT(*) FROM " + TEST_TABLE_NAME + ";";
+    auto countStatement = db.getCachedStatement(TEST_TABLE_NAME, countSql);
+    ASSERT_NE(countStatement, nullptr);
+    ASSERT_NE(countStatement, statement);
+    ASSERT_TRUE(countStatement->step());
+    ASSERT_EQ(countStatement->getColumnInt(0), 2);
+
+    // Dropping the table must succeed even though statements on it are cached.
+    ASSERT_TRUE(db.clearTable(TEST_TABLE_NAME));
+    ASSERT_TRUE(db.dropTable(TEST_TABLE_NAME));
+    ASSERT_FALSE(db.tableExists(TEST_TABLE_NAME));
+    ASSERT_EQ(db.getCachedStatement(TEST_TABLE_NAME, insertSql), nullptr);
+
+    db.close();
+}
+
+/// Test that the database can be closed and reopened while statements are cached.
+TEST(SQLiteDatabaseTest, test_closeWithCachedStatements) {
+    auto dbFilePath = generateDbFilePath();
+    SQLiteDatabase db(dbFilePath);
+    ASSERT_TRUE(db.initialize());
+    ASSERT_TRUE(db.performQuery("CREATE TABLE " + TEST_TABLE_NAME + " (key TEXT PRIMARY KEY NOT NULL);"));
+
+    const std::string selectSql = "SELECT key FROM " + TEST_TABLE_NAME + ";";
+    ASSERT_NE(db.getCachedStatement(TEST_TABLE_NAME, selectSql), nullptr);
+
+    db.close();
+    ASSERT_TRUE(db.open());
+    auto statement = db.getCachedStatement(TEST_TABLE_NAME, selectSql);
+    ASSERT_NE(statement, nullptr);
+    ASSERT_TRUE(statement->step());
+    ASSERT_EQ(statement->getStepResult(), SQLITE_DONE);
+
+    db.close();
+}
+
 }  // namespace test
 }  // namespace sqliteStorage
 }  // namespace storage
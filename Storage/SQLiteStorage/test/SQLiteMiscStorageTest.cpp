@@ -12,6 +12,8 @@
  * express or implied. See the License for the specific language governing
  * permissions and limitations under the License.
  */
+#include <chrono>
+#include <iostream>
 #include <thread>
 
 #include <SQLiteStorage/SQLiteMiscStorage.h>
@@ -503,6 +505,117 @@ TEST_F(SQLiteMiscStorageTest, test_tableEntryTestsMultiThread) {
     }
 }
 
+/// Tests that getMany returns the entries which exist, and putMany both adds and updates entries.
+TEST_F(SQLiteMiscStorageTest, test_getManyAndPutMany) {
+    const std::string tableName = "SQLiteMiscStorageBulkTest";
+    deleteTestTable(tableName);
+
+    createTestTable(tableName, SQLiteMiscStorage::KeyType::STRING_KEY, SQLiteMiscStorage::ValueType::STRING_VALUE);
+
+    ASSERT_TRUE(m_miscStorage->add(COMPONENT_NAME, tableName, "key1", "oldValue1"));
+    ASSERT_TRUE(m_miscStorage->putMany(
+        COMPONENT_NAME, tableName, {{"key1", "value1"}, {"key2", "value2"}, {"key'3", "value'3"}}));
+
+    std::unordered_map<std::string, std::string> values;
+    ASSERT_TRUE(m_miscStorage->getMany(COMPONENT_NAME, tableName, {"key1", "key2", "key'3", "missingKey"}, &values));
+    ASSERT_EQ(values.size(), 3u);
+    ASSERT_EQ(values["key1"], "value1");
+    ASSERT_EQ(values["key2"], "value2");
+    ASSERT_EQ(values["key'3"], "value'3");
+
+    /// The bulk operations fail on a table which doesn't exist, or without a values container.
+    ASSERT_FALSE(m_miscStorage->putMany(COMPONENT_NAME, "SQLiteMiscStorageMissingTable", {{"key", "value"}}));
+    ASSERT_FALSE(m_miscStorage->getMany(COMPONENT_NAME, tableName, {"key1"}, nullptr));
+
+    /// Single entry operations still work after the bulk operations.
+    ASSERT_TRUE(m_miscStorage->update(COMPONENT_NAME, tableName, "key2", "updatedValue2"));
+    std::string value;
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, "key2", &value));
+    ASSERT_EQ(value, "updatedValue2");
+
+    deleteTestTable(tableName);
+}
+
+/// Tests that the cached column types of a table are dropped with the table.
+TEST_F(SQLiteMiscStorageTest, test_recreateTableAfterDelete) {
+    const std::string tableName = "SQLiteMiscStorageRecreateTest";
+    deleteTestTable(tableName);
+
+    createTestTable(tableName, SQLiteMiscStorage::KeyType::STRING_KEY, SQLiteMiscStorage::ValueType::STRING_VALUE);
+    ASSERT_TRUE(m_miscStorage->put(COMPONENT_NAME, tableName, "key", "value"));
+    deleteTestTable(tableName);
+
+    bool tableExists = true;
+    ASSERT_TRUE(m_miscStorage->tableExists(COMPONENT_NAME, tableName, &tableExists));
+    ASSERT_FALSE(tableExists);
+    ASSERT_FALSE(m_miscStorage->put(COMPONENT_NAME, tableName, "key", "value"));
+
+    createTestTable(tableName, SQLiteMiscStorage::KeyType::STRING_KEY, SQLiteMiscStorage::ValueType::STRING_VALUE);
+    ASSERT_TRUE(m_miscStorage->put(COMPONENT_NAME, tableName, "key", "newValue"));
+    std::string value;
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, "key", &value));
+    ASSERT_EQ(value, "newValue");
+
+    /// Reopening the database reads the column types again.
+    m_miscStorage->close();
+    ASSERT_TRUE(m_miscStorage->open());
+    value.clear();
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, "key", &value));
+    ASSERT_EQ(value, "newValue");
+
+    deleteTestTable(tableName);
+}
+
+/// Measures single entry puts and gets against the bulk operations, and prints the results.
+TEST_F(SQLiteMiscStorageTest, testSlow_putAndGetThroughput) {
+    const std::string tableName = "SQLiteMiscStorageThroughputTest";
+    const int numberOfEntries = 100;
+    deleteTestTable(tableName);
+
+    createTestTable(tableName, SQLiteMiscStorage::KeyType::STRING_KEY, SQLiteMiscStorage::ValueType::STRING_VALUE);
+
+    std::unordered_map<std::string, std::string> entries;
+    std::vector<std::string> keys;
+    for (int i = 0; i < numberOfEntries; ++i) {
+        keys.push_back("setting" + std::to_string(i));
+        entries[keys.back()] = "value" + std::to_string(i);
+    }
+
+    auto elapsedUs = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)
+            .count();
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& entry : entries) {
+        ASSERT_TRUE(m_miscStorage->put(COMPONENT_NAME, tableName, entry.first, entry.second));
+    }
+    auto putUs = elapsedUs(start);
+
+    start = std::chrono::steady_clock::now();
+    for (const auto& key : keys) {
+        std::string value;
+        ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, key, &value));
+    }
+    auto getUs = elapsedUs(start);
+
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(m_miscStorage->putMany(COMPONENT_NAME, tableName, entries));
+    auto putManyUs = elapsedUs(start);
+
+    std::unordered_map<std::string, std::string> values;
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(m_miscStorage->getMany(COMPONENT_NAME, tableName, keys, &values));
+    auto getManyUs = elapsedUs(start);
+    ASSERT_EQ(values, entries);
+
+    std::cout << numberOfEntries << " entries: put " << putUs << "us, get " << getUs << "us, putMany " << putManyUs
+              << "us, getMany " << getManyUs << "us" << std::endl;
+
+    ASSERT_TRUE(m_miscStorage->clearTable(COMPONENT_NAME, tableName));
+    deleteTestTable(tableName);
+}
+
 /// Test misc storage provide non-null reference to database object.
 TEST_F(SQLiteMiscStorageTest, test_getDatabaseReference) {
     ASSERT_NE(nullptr, &m_miscStorage->getDatabase());
@@ -381,7 +381,7 @@ private:
      */
     bool handleSetAlert(
         const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-        const rapidjson::Document& payload,
+        const rapidjson::Value& payload,
         std::string* alertToken);
 
     /**
@@ -395,7 +395,7 @@ private:
      */
     bool handleDeleteAlert(
         const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-        const rapidjson::Document& payload,
+        const rapidjson::Value& payload,
         std::string* alertToken);
 
     /**
@@ -407,7 +407,7 @@ private:
      */
     bool handleDeleteAlerts(
         const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-        const rapidjson::Document& payload);
+        const rapidjson::Value& payload);
 
     /**
      * A helper function to handle the SetVolume directive.
@@ -418,7 +418,7 @@ private:
      */
     bool handleSetVolume(
         const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-        const rapidjson::Document& payload);
+        const rapidjson::Value& payload);
 
     /**
      * A helper function to handle the AdjustVolume directive.
@@ -429,7 +429,7 @@ private:
      */
     bool handleAdjustVolume(
         const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-        const rapidjson::Document& payload);
+        const rapidjson::Value& payload);
 
     /**
      * A helper function to handle the SetAlarmVolumeRamp directive.
@@ -440,7 +440,7 @@ private:
      */
     bool handleSetAlarmVolumeRamp(
         const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-        const rapidjson::Document& payload);
+        const rapidjson::Value& payload);
 
     /**
      * Utility function to send a single alert related Event to AVS. If isCertified is set to true, then the Event
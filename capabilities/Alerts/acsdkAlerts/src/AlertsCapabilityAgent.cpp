@@ -15,6 +15,7 @@
 
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
 #include <AVSCommon/AVS/MessageRequest.h>
+#include <AVSCommon/AVS/ParsedPayload.h>
 #include <AVSCommon/AVS/SpeakerConstants/SpeakerConstants.h>
 #include <AVSCommon/Utils/File/FileUtils.h>
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
@@ -750,7 +751,7 @@ int AlertsCapabilityAgent::getAlertVolume() {
 
 bool AlertsCapabilityAgent::handleSetAlert(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload,
+    const rapidjson::Value& payload,
     std::string* alertToken) {
     ACSDK_DEBUG9(LX("handleSetAlert"));
     std::string alertType;
@@ -833,7 +834,7 @@ bool AlertsCapabilityAgent::handleSetAlert(
 
 bool AlertsCapabilityAgent::handleDeleteAlert(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload,
+    const rapidjson::Value& payload,
     std::string* alertToken) {
     ACSDK_DEBUG5(LX(__func__));
     if (!retrieveValue(payload, DIRECTIVE_PAYLOAD_TOKEN_KEY, alertToken)) {
@@ -854,7 +855,7 @@ bool AlertsCapabilityAgent::handleDeleteAlert(
 
 bool AlertsCapabilityAgent::handleDeleteAlerts(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload) {
+    const rapidjson::Value& payload) {
     ACSDK_DEBUG5(LX(__func__));
 
     std::list<std::string> alertTokens;
@@ -895,7 +896,7 @@ bool AlertsCapabilityAgent::handleDeleteAlerts(
 
 bool AlertsCapabilityAgent::handleSetVolume(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload) {
+    const rapidjson::Value& payload) {
     ACSDK_DEBUG5(LX(__func__));
     int64_t volumeValue = 0;
     if (!retrieveValue(payload, DIRECTIVE_PAYLOAD_VOLUME, &volumeValue)) {
@@ -912,7 +913,7 @@ bool AlertsCapabilityAgent::handleSetVolume(
 
 bool AlertsCapabilityAgent::handleAdjustVolume(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload) {
+    const rapidjson::Value& payload) {
     ACSDK_DEBUG5(LX(__func__));
     int64_t adjustValue = 0;
     if (!retrieveValue(payload, DIRECTIVE_PAYLOAD_VOLUME, &adjustValue)) {
@@ -937,7 +938,7 @@ bool AlertsCapabilityAgent::handleAdjustVolume(
 
 bool AlertsCapabilityAgent::handleSetAlarmVolumeRamp(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload) {
+    const rapidjson::Value& payload) {
     std::string jsonValue;
     if (!retrieveValue(payload, DIRECTIVE_PAYLOAD_ALARM_VOLUME_RAMP, &jsonValue)) {
         std::string errorMessage =
@@ -1098,15 +1099,14 @@ void AlertsCapabilityAgent::executeHandleDirectiveImmediately(std::shared_ptr<Di
     ACSDK_DEBUG1(LX("executeHandleDirectiveImmediately"));
     auto& directive = info->directive;
 
-    rapidjson::Document payload;
-    payload.Parse(directive->getPayload());
-
-    if (payload.HasParseError()) {
+    auto parsedPayload = directive->getParsedPayload();
+    if (!parsedPayload) {
         std::string errorMessage = "Unable to parse payload";
         ACSDK_ERROR(LX("executeHandleDirectiveImmediatelyFailed").m(errorMessage));
         sendProcessingDirectiveException(directive, errorMessage);
         return;
     }
+    const rapidjson::Value& payload = parsedPayload->getDocument();
 
     auto directiveName = directive->getName();
     std::string alertToken;
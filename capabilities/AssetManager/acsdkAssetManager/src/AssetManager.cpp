@@ -251,26 +251,43 @@ bool AssetManager::freeUpSpace(size_t requestedAmount) {
     lock_guard<mutex> lock(m_requestersMutex);
 
     // delete all nullptrs in m_requester set
-    for (const auto& requester : m_requesters) {
-        if (requester == nullptr) {
+    for (auto it = m_requesters.begin(); it != m_requesters.end();) {
+        if (*it == nullptr) {
             ACSDK_ERROR(LX("freeUpSpace").m("Nullptr found in m_requesters"));
             s_metrics().addCounter("nullptrFoundInRequesters");
-            m_requesters.erase(requester);
+            it = m_requesters.erase(it);
+        } else {
+            ++it;
         }
     }
 
-    vector<shared_ptr<Requester>> sortedRequesters(m_requesters.begin(), m_requesters.end());
-    sort(sortedRequesters.begin(),
-         sortedRequesters.end(),
-         [](const shared_ptr<Requester>& lhs, const shared_ptr<Requester>& rhs) {
-             if (lhs->getPriority() > rhs->getPriority()) {
-                 return true;
-             }
-             return lhs->getPriority() == rhs->getPriority() && lhs->getLastUsed() < rhs->getLastUsed();
-         });
+    // the requesters are kept in a heap ordered by lowest priority first, then least recently used, rather than fully
+    // sorted, so only the requesters that actually get evicted pay for the ordering. Usage timestamps have millisecond
+    // resolution, so ties fall back to the iteration order of m_requesters to keep the eviction order deterministic.
+    using Candidate = pair<shared_ptr<Requester>, size_t>;
+    auto evictedAfter = [](const Candidate& lhs, const Candidate& rhs) {
+        if (lhs.first->getPriority() != rhs.first->getPriority()) {
+            return lhs.first->getPriority() < rhs.first->getPriority();
+        }
+        if (lhs.first->getLastUsed() != rhs.first->getLastUsed()) {
+            return lhs.first->getLastUsed() > rhs.first->getLastUsed();
+        }
+        return lhs.second > rhs.second;
+    };
+    vector<Candidate> candidates;
+    candidates.reserve(m_requesters.size());
+    for (const auto& requester : m_requesters) {
+        candidates.emplace_back(requester, candidates.size());
+    }
+    make_heap(candidates.begin(), candidates.end(), evictedAfter);
 
     size_t deletedAmount = 0;
-    for (auto& requester : sortedRequesters) {
+    int evictedCount = 0;
+    while (!candidates.empty()) {
+        pop_heap(candidates.begin(), candidates.end(), evictedAfter);
+        auto requester = move(candidates.back().first);
+        candidates.pop_back();
+
         if (!requester->isDownloaded()) {
             ACSDK_DEBUG(
                     LX("freeUpSpace").m("Skipping over since it's not downloaded").d("requester", requester->name()));
@@ -287,6 +304,7 @@ bool AssetManager::freeUpSpace(size_t requestedAmount) {
         auto name = requester->name();
         m_requesters.erase(requester);
         deletedAmount += size;
+        evictedCount++;
         ACSDK_INFO(LX("freeUpSpace")
                            .m("Deleted request and cleared up of space")
                            .d("name", name)
@@ -296,10 +314,16 @@ bool AssetManager::freeUpSpace(size_t requestedAmount) {
                                .m("Successfully cleared")
                                .d("cleared bytes", deletedAmount)
                                .d("requested bytes", requestedAmount));
+            s_metrics()
+                    .addCounter("requesterEvicted", evictedCount)
+                    .addString("evictedBytes", to_string(deletedAmount));
             return true;
         }
     }
 
+    if (evictedCount > 0) {
+        s_metrics().addCounter("requesterEvicted", evictedCount).addString("evictedBytes", to_string(deletedAmount));
+    }
     auto remainingAmount = requestedAmount - deletedAmount;
     ACSDK_ERROR(LX("freeUpSpace").m("Could not free up enough space").d("bytes remaining", remainingAmount));
     s_metrics().addCounter(METRIC_PREFIX_ERROR("freeUpSpaceFailed")).addString("remaining", to_string(remainingAmount));
@@ -128,12 +128,12 @@ bool DavsRequester::checkIfOkToDownload(shared_ptr<VendableArtifact> availableAr
     }
 
     // if the current available artifact is the same as the one stored, then there's nothing to change
-    if (newUUID == m_metadata->getResourceId()) {
+    if (newUUID == m_metadata->getResourceId() || (m_resource != nullptr && m_resource->isKnownAs(newUUID))) {
         ACSDK_INFO(LX("checkIfOkToDownload").m("Artifact is already downloaded").d("requester", name()));
         return false;
     }
 
-    if (m_pendingUpdate != nullptr && newUUID == m_pendingUpdate->getId()) {
+    if (m_pendingUpdate != nullptr && m_pendingUpdate->isKnownAs(newUUID)) {
         ACSDK_INFO(LX("checkIfOkToDownload").m("Artifact is already pending update").d("requester", name()));
         return false;
     }
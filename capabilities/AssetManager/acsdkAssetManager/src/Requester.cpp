@@ -174,6 +174,15 @@ size_t Requester::deleteAndCleanupLocked(unique_lock<mutex>& lock) {
 }
 
 bool Requester::handleAcquiredResourceLocked(unique_lock<mutex>& lock, const shared_ptr<Resource>& newResource) {
+    // an update whose content is identical to the current artifact was deduplicated into the resource we already hold
+    if (getState() == State::LOADED && newResource == m_resource) {
+        ACSDK_INFO(LX("handleAcquiredResourceLocked")
+                           .m("Update has identical content, ignoring")
+                           .d("artifact", name()));
+        m_storageManager->releaseResource(newResource);
+        return false;
+    }
+
     // if we already have a downloaded artifact, then announce of a pending upgrade
     if (getState() == State::LOADED) {
         ACSDK_INFO(
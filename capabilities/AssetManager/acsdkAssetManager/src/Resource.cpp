@@ -22,9 +22,13 @@
 #include <rapidjson/istreamwrapper.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
+#include <openssl/evp.h>
+#include <sys/stat.h>
 
 #include <algorithm>
 #include <fstream>
+#include <iomanip>
+#include <sstream>
 
 namespace alexaClientSDK {
 namespace acsdkAssets {
@@ -38,6 +42,13 @@ static const char* METADATA_FILE_NAME = "metadata.json";
 static const char* RESOURCE_NAME = "name";
 static const char* RESOURCE_ID = "id";
 static const char* RESOURCE_SIZE = "size";
+static const char* RESOURCE_CONTENT_HASH = "contentHash";
+static const char* RESOURCE_ALIASES = "aliases";
+
+// size of the buffer used to read the content of a resource while digesting it
+static constexpr size_t DIGEST_BUFFER_SIZE = 64 * 1024;
+
+using digest_ctx_ptr = unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)>;
 
 /// String to identify log entries originating from this file.
 static const std::string TAG{"Resource"};
@@ -90,8 +101,36 @@ std::shared_ptr<Resource> Resource::createFromConfigFile(const std::string& reso
         return nullptr;
     }
 
-    return shared_ptr<Resource>(
-            new Resource(resourceDirectory, move(name), move(id), static_cast<size_t>(sizeMember.GetUint64())));
+    vector<string> aliases;
+    if (document.HasMember(RESOURCE_ALIASES) && document[RESOURCE_ALIASES].IsArray()) {
+        for (const auto& alias : document[RESOURCE_ALIASES].GetArray()) {
+            if (alias.IsString()) {
+                aliases.emplace_back(alias.GetString());
+            }
+        }
+    }
+
+    // metadata files written before content hashes were recorded are upgraded by digesting the stored content once
+    string contentHash;
+    if (document.HasMember(RESOURCE_CONTENT_HASH) && document[RESOURCE_CONTENT_HASH].IsString()) {
+        contentHash = document[RESOURCE_CONTENT_HASH].GetString();
+    }
+    auto upgrade = contentHash.empty();
+    if (upgrade) {
+        contentHash = computeContentHash(resourceDirectory + "/" + name);
+    }
+
+    auto resource = shared_ptr<Resource>(new Resource(
+            resourceDirectory,
+            move(name),
+            move(id),
+            static_cast<size_t>(sizeMember.GetUint64()),
+            contentHash,
+            move(aliases)));
+    if (upgrade && !contentHash.empty()) {
+        resource->saveMetadata();
+    }
+    return resource;
 }
 
 std::shared_ptr<Resource> Resource::createFromStorage(const std::string& resourceDirectory) {
@@ -138,7 +177,8 @@ std::shared_ptr<Resource> Resource::createFromStorage(const std::string& resourc
     ACSDK_DEBUG(LX("createFromStorage")
                         .m("Loaded and generated resource info, caching in metadata file")
                         .d("loadedFile", resourceDirectory));
-    resource = shared_ptr<Resource>(new Resource(resourceDirectory, name, id, size));
+    auto contentHash = computeContentHash(resourceDirectory + "/" + name);
+    resource = shared_ptr<Resource>(new Resource(resourceDirectory, name, id, size, contentHash));
     resource->saveMetadata();
     return resource;
 }
@@ -146,7 +186,8 @@ std::shared_ptr<Resource> Resource::createFromStorage(const std::string& resourc
 std::shared_ptr<Resource> Resource::create(
         const std::string& parentDirectory,
         const std::string& id,
-        const std::string& source) {
+        const std::string& source,
+        const std::string& contentHash) {
     if (!filesystem::makeDirectory(parentDirectory)) {
         ACSDK_ERROR(LX("create").m("Could not create parent directory").d("directory", parentDirectory));
         return nullptr;
@@ -174,7 +215,7 @@ std::shared_ptr<Resource> Resource::create(
     }
 
     auto size = filesystem::sizeOf(resourceHome);
-    auto resource = shared_ptr<Resource>(new Resource(resourceHome, filename, id, size));
+    auto resource = shared_ptr<Resource>(new Resource(resourceHome, filename, id, size, contentHash));
     if (!resource->saveMetadata()) {
         ACSDK_ERROR(
                 LX("create").m("Could not save metadata information, will try to generate this dynamically on next "
@@ -185,13 +226,123 @@ std::shared_ptr<Resource> Resource::create(
     return resource;
 }
 
-Resource::Resource(const string& resourceDirectory, const string& resourceName, const string& id, size_t sizeBytes) :
+/**
+ * Feeds the content of a file into the digest.
+ *
+ * @param path the file to digest.
+ * @param ctx the digest to update.
+ * @return true if the whole file was read, false otherwise.
+ */
+static bool digestFile(const string& path, EVP_MD_CTX* ctx) {
+    ifstream file(path, ios::in | ios::binary);
+    if (!file.good()) {
+        ACSDK_ERROR(LX("digestFile").m("Failed to open file").d("file", path));
+        return false;
+    }
+
+    vector<char> buffer(DIGEST_BUFFER_SIZE);
+    while (file) {
+        file.read(buffer.data(), buffer.size());
+        auto count = static_cast<size_t>(file.gcount());
+        if (count > 0 && EVP_DigestUpdate(ctx, buffer.data(), count) != 1) {
+            return false;
+        }
+    }
+    return file.eof();
+}
+
+/**
+ * Feeds a file or a directory into the digest. Each entry contributes its name and type before its content, and the
+ * entries of a directory are visited in name order, so that the digest only depends on the content and layout.
+ *
+ * @param path the file or directory to digest.
+ * @param name the name of the entry, which is the last component of @c path.
+ * @param ctx the digest to update.
+ * @return true if all the content was read, false otherwise.
+ */
+static bool digestPath(const string& path, const string& name, EVP_MD_CTX* ctx) {
+    struct stat status {};
+    if (stat(path.c_str(), &status) != 0) {
+        ACSDK_ERROR(LX("digestPath").m("Failed to stat path").d("path", path));
+        return false;
+    }
+    auto isDirectory = S_ISDIR(status.st_mode);
+
+    // the terminating null separates the name from the type and content that follow it
+    if (EVP_DigestUpdate(ctx, name.c_str(), name.size() + 1) != 1 ||
+        EVP_DigestUpdate(ctx, isDirectory ? "d" : "f", 1) != 1) {
+        return false;
+    }
+    if (!isDirectory) {
+        // the size delimits the content from the name of the next entry
+        auto size = to_string(status.st_size);
+        return EVP_DigestUpdate(ctx, size.c_str(), size.size() + 1) == 1 && digestFile(path, ctx);
+    }
+
+    auto entries = filesystem::list(path);
+    sort(entries.begin(), entries.end());
+    for (const auto& entry : entries) {
+        if (!digestPath(path + "/" + entry, entry, ctx)) {
+            return false;
+        }
+    }
+    // close the directory so that its last entry is not confused with an entry of its parent
+    return EVP_DigestUpdate(ctx, "", 1) == 1;
+}
+
+std::string Resource::computeContentHash(const std::string& path) {
+    digest_ctx_ptr ctx(EVP_MD_CTX_new(), EVP_MD_CTX_free);
+    if (ctx == nullptr || EVP_DigestInit_ex(ctx.get(), EVP_sha256(), nullptr) != 1) {
+        ACSDK_ERROR(LX("computeContentHash").m("Failed to initialize digest"));
+        return "";
+    }
+    if (!digestPath(path, filesystem::basenameOf(path), ctx.get())) {
+        ACSDK_ERROR(LX("computeContentHash").m("Failed to digest content").d("path", path));
+        return "";
+    }
+
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digestLength = 0;
+    if (EVP_DigestFinal_ex(ctx.get(), digest, &digestLength) != 1) {
+        ACSDK_ERROR(LX("computeContentHash").m("Failed to finalize digest"));
+        return "";
+    }
+
+    ostringstream hex;
+    hex << std::hex << setfill('0');
+    for (unsigned int i = 0; i < digestLength; ++i) {
+        hex << setw(2) << static_cast<int>(digest[i]);
+    }
+    return hex.str();
+}
+
+Resource::Resource(
+        const string& resourceDirectory,
+        const string& resourceName,
+        const string& id,
+        size_t sizeBytes,
+        const string& contentHash,
+        vector<string> aliases) :
         m_resourceDirectory(resourceDirectory),
         m_resourceName(resourceName),
         m_id(id),
         m_sizeBytes(sizeBytes),
         m_fullResourcePath(this->m_resourceDirectory + "/" + this->m_resourceName),
-        m_refCount(0) {
+        m_refCount(0),
+        m_contentHash(contentHash),
+        m_aliases(move(aliases)) {
+}
+
+bool Resource::isKnownAs(const std::string& id) const {
+    return id == m_id || find(m_aliases.begin(), m_aliases.end(), id) != m_aliases.end();
+}
+
+bool Resource::addAlias(const std::string& id) {
+    if (isKnownAs(id)) {
+        return true;
+    }
+    m_aliases.push_back(id);
+    return saveMetadata();
 }
 
 bool Resource::saveMetadata() {
@@ -202,6 +353,16 @@ bool Resource::saveMetadata() {
     document.AddMember(StringRef(RESOURCE_ID), StringRef(m_id), allocator);
     document.AddMember(StringRef(RESOURCE_SIZE), static_cast<uint64_t>(m_sizeBytes), allocator);
     document.AddMember(StringRef(RESOURCE_NAME), StringRef(m_resourceName), allocator);
+    if (!m_contentHash.empty()) {
+        document.AddMember(StringRef(RESOURCE_CONTENT_HASH), StringRef(m_contentHash), allocator);
+    }
+    if (!m_aliases.empty()) {
+        Value aliases(kArrayType);
+        for (const auto& alias : m_aliases) {
+            aliases.PushBack(StringRef(alias), allocator);
+        }
+        document.AddMember(StringRef(RESOURCE_ALIASES), aliases, allocator);
+    }
 
     StringBuffer buffer;
     Writer<StringBuffer> writer(buffer);
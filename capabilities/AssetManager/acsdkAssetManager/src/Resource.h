@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace alexaClientSDK {
 namespace acsdkAssets {
@@ -61,6 +62,20 @@ public:
         return m_sizeBytes > 0;
     }
 
+    /**
+     * @return the hex encoded SHA-256 digest of the content of this resource, empty if it could not be computed.
+     */
+    inline const std::string& getContentHash() const {
+        return m_contentHash;
+    }
+
+    /**
+     * @param id an identifier a resource was registered or requested with.
+     * @return whether this resource is registered under the given id, either as its own id or as an alias that was
+     * deduplicated into it because its content was identical.
+     */
+    bool isKnownAs(const std::string& id) const;
+
 private:
     /**
      * Creates a resource given a source file or directory that will be represented by this resource and moves it to the
@@ -70,12 +85,24 @@ private:
      * @param parentDirectory REQUIRED, directory that is used to store this resource.
      * @param id REQUIRED, id that will be used to keep track of this resource.
      * @param source REQUIRED, actual content (file or directory) that will be represented by this resource.
+     * @param contentHash OPTIONAL, the digest of the source as returned by @c computeContentHash.
      * @return NULLABLE, a smart pointer to the newly created resource upon success, null otherwise.
      */
     static std::shared_ptr<Resource> create(
             const std::string& parentDirectory,
             const std::string& id,
-            const std::string& source);
+            const std::string& source,
+            const std::string& contentHash = "");
+
+    /**
+     * Computes the SHA-256 digest of a file or directory. The digest covers the name of @c path, and for a directory
+     * the names and contents of its entries in name order, so that identical artifacts produce identical digests
+     * wherever they are stored.
+     *
+     * @param path REQUIRED, the file or directory to digest.
+     * @return the hex encoded digest, empty if the content could not be read.
+     */
+    static std::string computeContentHash(const std::string& path);
 
     /**
      * Creates a resource, given a directory, by analyzing the content of the directory. ie if /path/to/resource_id
@@ -105,7 +132,9 @@ private:
             const std::string& resourceDirectory,
             const std::string& resourceName,
             const std::string& id,
-            size_t sizeBytes);
+            size_t sizeBytes,
+            const std::string& contentHash,
+            std::vector<std::string> aliases = {});
 
     /**
      * Cache the resource information to a metadata file inside resourceDirectory.
@@ -114,6 +143,14 @@ private:
      */
     bool saveMetadata();
 
+    /**
+     * Registers another id under which this resource is known, and caches it in the metadata file.
+     *
+     * @param id REQUIRED, the id of a resource whose content is identical to this one.
+     * @return true if the metadata was saved, false otherwise.
+     */
+    bool addAlias(const std::string& id);
+
     /**
      * Erases the entire resourceDirectory and resets the resource content.
      */
@@ -139,6 +176,10 @@ private:
     std::string m_fullResourcePath;
     // Count of how many requesters reference this resource.
     int m_refCount;
+    // SHA-256 digest of the resource content, like "9f86d0...", used to deduplicate identical artifacts
+    std::string m_contentHash;
+    // Other ids registered with the same content, which share this resource instead of storing another copy
+    std::vector<std::string> m_aliases;
 
     // it's important that the creation, ref counting, and deletion of resource happens only by the Storage Manager.
     friend StorageManager;
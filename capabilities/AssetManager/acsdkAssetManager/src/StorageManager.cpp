@@ -27,6 +27,7 @@ namespace acsdkAssets {
 namespace manager {
 
 using namespace std;
+using namespace std::chrono;
 using namespace alexaClientSDK::avsCommon::utils;
 using namespace common;
 
@@ -41,6 +42,9 @@ static const string BUDGET_FILE_SUFFIX = "/budget.config";
 // when looking at how much space is available on the system, be sure to leave out a few MBs
 static constexpr size_t SYSTEM_STORAGE_BUFFER = 5 * BYTES_IN_MB;
 
+// how long the space reported by the file system is trusted before querying it again
+static constexpr auto AVAILABLE_STORAGE_REFRESH_INTERVAL = seconds(5);
+
 static const auto s_metrics = AmdMetricsWrapper::creator("StorageManager");
 
 /// String to identify log entries originating from this file.
@@ -93,7 +97,10 @@ StorageManager::StorageManager(
         m_workingDirectory(workingDirectory),
         m_assetManager(assetManager),
         m_budget(budget),
-        m_allocatedSize(0) {
+        m_allocatedSize(0),
+        m_cachedAvailableStorage(0),
+        m_allocatedSizeAtSample(0),
+        m_availableStorageValid(false) {
 }
 
 bool StorageManager::init() {
@@ -111,7 +118,8 @@ bool StorageManager::init() {
         if (resource != nullptr) {
             ACSDK_INFO(LX("init").m("Loaded stored resource").d("resource", resource->getPath()));
             m_allocatedSize += resource->getSizeBytes();
-            m_bank[resource->getId()] = resource;
+            indexResourceLocked(resource);
+            markUnreferencedLocked(resource);
         } else {
             ACSDK_ERROR(LX("init").m("Failed to load stored resource, cleaning it up!"));
             filesystem::removeAll(resourceDirectory);
@@ -122,19 +130,83 @@ bool StorageManager::init() {
 
 void StorageManager::purgeUnreferenced() {
     unique_lock<mutex> lock(m_allocationMutex);
-    for (auto resource = m_bank.begin(); resource != m_bank.end();) {
-        if (resource->second == nullptr) {
-            resource = m_bank.erase(resource);
-        } else if (resource->second->m_refCount <= 0) {
-            m_allocatedSize -= resource->second->getSizeBytes();
-            resource->second->erase();
-            resource = m_bank.erase(resource);
-        } else {
-            ++resource;
-        }
+    size_t purgedCount = 0;
+    size_t purgedSize = 0;
+    while (!m_unreferenced.empty()) {
+        auto resource = m_unreferenced.front();
+        ACSDK_INFO(LX("purgeUnreferenced").m("Erasing unreferenced resource").d("resource", resource->getId()));
+        purgedSize += eraseResourceLocked(resource);
+        purgedCount++;
+    }
+
+    if (purgedCount > 0) {
+        s_metrics()
+                .addCounter("resourceEvicted", static_cast<int>(purgedCount))
+                .addString("evictedBytes", to_string(purgedSize));
+    }
+}
+
+void StorageManager::markUnreferencedLocked(const shared_ptr<Resource>& resource) {
+    if (m_unreferencedIndex.find(resource->getId()) != m_unreferencedIndex.end()) {
+        return;
+    }
+    m_unreferencedIndex[resource->getId()] = m_unreferenced.insert(m_unreferenced.end(), resource);
+}
+
+void StorageManager::markReferencedLocked(const shared_ptr<Resource>& resource) {
+    auto it = m_unreferencedIndex.find(resource->getId());
+    if (it == m_unreferencedIndex.end()) {
+        return;
+    }
+    m_unreferenced.erase(it->second);
+    m_unreferencedIndex.erase(it);
+}
+
+void StorageManager::indexResourceLocked(const shared_ptr<Resource>& resource) {
+    m_bank[resource->getId()] = resource;
+    for (const auto& alias : resource->m_aliases) {
+        m_bank[alias] = resource;
+    }
+    if (!resource->getContentHash().empty()) {
+        m_contentIndex.emplace(resource->getContentHash(), resource);
     }
 }
 
+size_t StorageManager::eraseResourceLocked(const shared_ptr<Resource>& resource) {
+    auto size = resource->getSizeBytes();
+    markReferencedLocked(resource);
+    m_bank.erase(resource->getId());
+    for (const auto& alias : resource->m_aliases) {
+        m_bank.erase(alias);
+    }
+    auto content = m_contentIndex.find(resource->getContentHash());
+    if (content != m_contentIndex.end() && content->second == resource) {
+        m_contentIndex.erase(content);
+    }
+    resource->erase();
+
+    m_allocatedSize = subtractSize(m_allocatedSize, size);
+    invalidateAvailableStorageLocked();
+    return size;
+}
+
+size_t StorageManager::availableStorageLocked() {
+    auto now = steady_clock::now();
+    if (!m_availableStorageValid || now - m_availableStorageSampleTime >= AVAILABLE_STORAGE_REFRESH_INTERVAL) {
+        m_cachedAvailableStorage = filesystem::availableSpace(m_workingDirectory);
+        m_availableStorageSampleTime = now;
+        m_allocatedSizeAtSample = m_allocatedSize;
+        m_availableStorageValid = true;
+    }
+
+    // anything allocated since the sample was taken is assumed to have consumed space on the device
+    return subtractSize(m_cachedAvailableStorage, subtractSize(m_allocatedSize, m_allocatedSizeAtSample));
+}
+
+void StorageManager::invalidateAvailableStorageLocked() {
+    m_availableStorageValid = false;
+}
+
 bool StorageManager::requestSpace(const size_t requestedAmount) {
     auto assetManagerPtr = m_assetManager.lock();
     if (assetManagerPtr == nullptr) {
@@ -155,7 +227,7 @@ bool StorageManager::requestSpace(const size_t requestedAmount) {
 
 size_t StorageManager::availableBudget() {
     lock_guard<mutex> lock(m_allocationMutex);
-    auto availableStorage = subtractSize(filesystem::availableSpace(m_workingDirectory), SYSTEM_STORAGE_BUFFER);
+    auto availableStorage = subtractSize(availableStorageLocked(), SYSTEM_STORAGE_BUFFER);
     auto budgetSize = m_budget * BYTES_IN_MB;
 
     // if we are over our budget, then return 0
@@ -194,23 +266,52 @@ shared_ptr<Resource> StorageManager::registerAndAcquireResource(
     // when we destroy the token, it's destructor will callback to free up the reserved space (by design)
     reservationToken.reset();
 
+    // the source is private to the caller until it is registered, so it is digested without holding the lock.
+    auto contentHash = Resource::computeContentHash(sourcePath);
+
     unique_lock<mutex> lock(m_allocationMutex);
-    auto& resource = m_bank[id];
-    if (resource != nullptr) {
+    auto existing = m_bank.find(id);
+    if (existing != m_bank.end()) {
+        // the same id is trusted to name the same content: DAVS ids are artifact identifiers, and URL requesters
+        // register under their request summary
         ACSDK_WARN(LX("registerAndAcquireResource")
                            .m("Attempting to register path, which already exists, ignoring...")
                            .d("path", sourcePath));
         filesystem::removeAll(sourcePath);
+        s_metrics().addCounter("resourceAlreadyRegistered");
+        auto& resource = existing->second;
+        markReferencedLocked(resource);
         resource->incrementRefCount();
         return resource;
     }
 
-    resource = Resource::create(m_workingDirectory, id, sourcePath);
+    auto duplicate = contentHash.empty() ? m_contentIndex.end() : m_contentIndex.find(contentHash);
+    if (duplicate != m_contentIndex.end()) {
+        auto resource = duplicate->second;
+        ACSDK_INFO(LX("registerAndAcquireResource")
+                           .m("Content is identical to an existing resource, sharing it")
+                           .d("id", id)
+                           .d("resource", resource->getId()));
+        if (!resource->addAlias(id)) {
+            ACSDK_WARN(LX("registerAndAcquireResource")
+                               .m("Could not save the alias, it will be forgotten on restart")
+                               .d("id", id));
+        }
+        m_bank[id] = resource;
+        filesystem::removeAll(sourcePath);
+        s_metrics().addCounter("resourceDeduplicated");
+        markReferencedLocked(resource);
+        resource->incrementRefCount();
+        return resource;
+    }
+
+    auto resource = Resource::create(m_workingDirectory, id, sourcePath, contentHash);
     if (resource == nullptr) {
         ACSDK_ERROR(LX("registerAndAcquireResource").m("Failed to register resource").d("resource", id));
         return nullptr;
     }
 
+    indexResourceLocked(resource);
     resource->incrementRefCount();
     m_allocatedSize += resource->getSizeBytes();
     auto budgetSize = m_budget * BYTES_IN_MB;
@@ -223,10 +324,16 @@ shared_ptr<Resource> StorageManager::registerAndAcquireResource(
 
 shared_ptr<Resource> StorageManager::acquireResource(const string& id) {
     unique_lock<mutex> lock(m_allocationMutex);
-    auto& resource = m_bank[id];
-    if (resource != nullptr) {
-        resource->incrementRefCount();
+    auto it = m_bank.find(id);
+    if (it == m_bank.end()) {
+        s_metrics().addCounter("resourceCacheMiss");
+        return nullptr;
     }
+
+    s_metrics().addCounter("resourceCacheHit");
+    auto& resource = it->second;
+    markReferencedLocked(resource);
+    resource->incrementRefCount();
     return resource;
 }
 
@@ -242,11 +349,8 @@ size_t StorageManager::releaseResource(const shared_ptr<Resource>& resource) {
     }
 
     ACSDK_INFO(LX("releaseResource").m("There is no usage for resource, deleting").d("resource", resource->m_id));
-    auto size = resource->getSizeBytes();
-    m_bank.erase(resource->m_id);
-    resource->erase();
-
-    m_allocatedSize = subtractSize(m_allocatedSize, size);
+    auto size = eraseResourceLocked(resource);
+    s_metrics().addCounter("resourceEvicted").addString("evictedBytes", to_string(size));
     return size;
 }
 
@@ -17,6 +17,8 @@
 #define ACSDKASSETMANAGER_SRC_STORAGEMANAGER_H_
 
 #include <AVSCommon/Utils/FileSystem/FileSystemUtils.h>
+#include <chrono>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -92,15 +94,17 @@ public:
     ~StorageManager() = default;
 
     /**
-     * Post initialization step that goes through the map of resources and erases any that are unreferenced.
+     * Post initialization step that erases any resources that are unreferenced. Only the unreferenced resources are
+     * visited, so the cost of this call is proportional to the number of resources erased rather than the size of the
+     * bank.
      */
     void purgeUnreferenced();
 
     /**
      * Registers a resource given a path to its content. If the operation succeeds, then it will be acquired as well.
-     * If another resource is found with the same id, then this will delete the provided path and use the existing
-     * resource. If there is no other resource with this id, then this will move the source path to the resources
-     * directory.
+     * If another resource is found with the same id, or with the same SHA-256 content digest, then this will delete
+     * the provided path and use the existing resource, which then also becomes known under this id. Otherwise this
+     * will move the source path to the resources directory.
      *
      * @param reservationToken REQUIRED, a unique token that was used to reserve space ahead of download
      * @param id REQUIRED, a unique identifier for this resource, preferably the sha2 checksum.
@@ -193,13 +197,68 @@ protected:
     void freeReservedSpace(size_t size);
 
 private:
+    /**
+     * Adds a resource that is no longer referenced by anyone to the unreferenced index.
+     * @note m_allocationMutex must be held by the caller.
+     */
+    void markUnreferencedLocked(const std::shared_ptr<Resource>& resource);
+
+    /**
+     * Removes a resource from the unreferenced index if it is there.
+     * @note m_allocationMutex must be held by the caller.
+     */
+    void markReferencedLocked(const std::shared_ptr<Resource>& resource);
+
+    /**
+     * Adds a resource and every id it is known under to the bank and to the content index.
+     * @note m_allocationMutex must be held by the caller.
+     */
+    void indexResourceLocked(const std::shared_ptr<Resource>& resource);
+
+    /**
+     * Erases the resource from disk, from the bank under every id it is known as and from the content index, and
+     * updates the size index accordingly.
+     * @note m_allocationMutex must be held by the caller.
+     *
+     * @return the number of bytes freed.
+     */
+    size_t eraseResourceLocked(const std::shared_ptr<Resource>& resource);
+
+    /**
+     * @return the space available on the device for the working directory. The value queried from the file system is
+     * cached for a short period and adjusted by the allocations made since, so that budget queries do not hit the file
+     * system every time.
+     * @note m_allocationMutex must be held by the caller.
+     */
+    size_t availableStorageLocked();
+
+    /**
+     * Forces the next call to @c availableStorageLocked to query the file system, used after space is freed.
+     * @note m_allocationMutex must be held by the caller.
+     */
+    void invalidateAvailableStorageLocked();
+
     const std::string m_workingDirectory;
     const std::weak_ptr<AssetManager> m_assetManager;
     size_t m_budget;
     std::mutex m_allocationMutex;
+    // resources by id, a resource that deduplicated other registrations is found under each of their ids as well.
     std::unordered_map<std::string, std::shared_ptr<Resource>> m_bank;
 
+    // resources by the SHA-256 digest of their content.
+    std::unordered_map<std::string, std::shared_ptr<Resource>> m_contentIndex;
+
+    // resources with no references in the order they became unreferenced, along with an index into this list by id.
+    std::list<std::shared_ptr<Resource>> m_unreferenced;
+    std::unordered_map<std::string, std::list<std::shared_ptr<Resource>>::iterator> m_unreferencedIndex;
+
     size_t m_allocatedSize;
+
+    // the last space reported by the file system, the time it was queried and the allocated size at the time.
+    size_t m_cachedAvailableStorage;
+    std::chrono::steady_clock::time_point m_availableStorageSampleTime;
+    size_t m_allocatedSizeAtSample;
+    bool m_availableStorageValid;
 };
 
 }  // namespace manager
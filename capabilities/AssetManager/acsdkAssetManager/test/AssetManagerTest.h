@@ -98,11 +98,23 @@ public:
         assetManager.reset();
     }
 
-    void uploadArtifactFromRequest(
+    // uploads are given distinct content, as identical content is shared between artifacts by the storage manager
+    char uploadArtifactFromRequest(
             const shared_ptr<ArtifactRequest>& request,
             size_t size = 1,
             const string& id = "",
             milliseconds ttlDelta = minutes(60)) {
+        auto content = nextContent++;
+        uploadArtifactWithContent(request, content, size, id, ttlDelta);
+        return content;
+    }
+
+    void uploadArtifactWithContent(
+            const shared_ptr<ArtifactRequest>& request,
+            char content,
+            size_t size = 1,
+            const string& id = "",
+            milliseconds ttlDelta = minutes(60)) {
         filesystem::makeDirectory(TESTING_DIRECTORY);
         auto metadata = RequesterMetadata::create(request);
         auto type = metadata->getRequest()->getRequestType();
@@ -113,7 +125,7 @@ public:
                         davsRequest->getType(),
                         davsRequest->getKey(),
                         davsRequest->getFilters(),
-                        createTarFile(TESTING_DIRECTORY, "target", size),
+                        createTarFile(TESTING_DIRECTORY, "target", size, content),
                         ttlDelta,
                         id);
             }
@@ -125,12 +137,14 @@ public:
         }
     }
 
-    static string createTarFile(const string& dir, const string& filename, size_t size = 1) {
+    static string createTarFile(const string& dir, const string& filename, size_t size = 1, char content = 'a') {
         auto tarPath = dir + "/" + filename + ".tar.gz";
-        auto data = string(size, 'a');
+        auto data = string(size, content);
 
         auto a = archive_write_new();
         archive_write_add_filter_gzip(a);
+        // omit the gzip timestamp so that archives of identical content are byte for byte identical
+        archive_write_set_filter_option(a, "gzip", "timestamp", nullptr);
         archive_write_set_format_pax_restricted(a);
         archive_write_open_filename(a, tarPath.c_str());
 
@@ -156,6 +170,7 @@ public:
     string DAVS_REQUESTS_DIR;
     string URL_RESOURCES_DIR;
     string URL_WORKING_DIR;
+    char nextContent = 'a';
 
     DavsServiceMock service;
     shared_ptr<DavsClient> davsClient;
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <fstream>
+
 #include "AssetManagerTest.h"
 
 // Two valid artifact json will be tested by Integ Test
@@ -29,7 +31,7 @@ public:
 
         artifact->commsHandler = commsHandler;
 
-        uploadArtifactFromRequest(artifact->request, artifactSize, origId, ttl);
+        origContent = uploadArtifactFromRequest(artifact->request, artifactSize, origId, ttl);
         ASSERT_TRUE(assetManager->downloadArtifact(artifact->request));
         ASSERT_TRUE(artifact->waitUntilStateEquals(State::LOADED));
         ASSERT_TRUE(artifact->hasAllProps());
@@ -79,6 +81,7 @@ public:
     size_t artifactSize = 10;
     string origId = "original";
     string updatedId = "updated_id";
+    char origContent{};
 
     bool updateAccepted{};
     bool updateRejected{};
@@ -112,6 +115,28 @@ TEST_P(UpdateTest, UpdatingArtifactsDeletesTheOldResourceAndAcquiresTheNew) {  /
     artifact->resetCounts();
 }
 
+TEST_P(UpdateTest, UpdateWithIdenticalContentKeepsTheCurrentResource) {  // NOLINT
+    uploadArtifactWithContent(artifact->request, origContent, artifactSize, updatedId);
+
+    artifact->subscribeToChangeEvents();
+    artifact->setPriorityProp(Priority::ACTIVE);
+
+    // the update is registered as another id of the resource already in use, rather than stored again
+    auto metadataPath = filesystem::parentDirNameOf(oldPath) + "/metadata.json";
+    auto isAlias = [&] {
+        ifstream metadata(metadataPath);
+        string content((istreambuf_iterator<char>(metadata)), istreambuf_iterator<char>());
+        return content.find(updatedId) != string::npos;
+    };
+    ASSERT_TRUE(waitUntil(isAlias, ttl * 10));
+
+    assetManager->handleUpdate(artifact->request->getSummary(), updateAccepted);
+    ASSERT_FALSE(filesystem::exists(newPath));
+    ASSERT_TRUE(filesystem::exists(oldPath));
+    ASSERT_EQ(oldPath, artifact->getPathProp());
+    ASSERT_EQ(artifact->updateEventCount, 0);
+}
+
 TEST_P(UpdateTest, UpdatingArtifactsWillKeepRetryingUntilItTimesOutAndDeletesTheNew) {  // NOLINT
     uploadArtifactFromRequest(artifact->request, artifactSize, updatedId);
 
@@ -0,0 +1,175 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <fstream>
+
+#include "AssetManagerTest.h"
+#include "StorageManager.h"
+
+static constexpr size_t RESOURCE_SIZE = 10;
+
+class StorageManagerTest : public AssetManagerTest {
+public:
+    void SetUp() override {
+        AssetManagerTest::SetUp();
+        STORAGE_DIR = TMP_DIR + "/storage";
+        SOURCE_DIR = TMP_DIR + "/sources";
+        filesystem::makeDirectory(SOURCE_DIR);
+        storageManager = StorageManager::create(STORAGE_DIR, assetManager);
+        ASSERT_NE(storageManager, nullptr);
+    }
+
+    void TearDown() override {
+        storageManager.reset();
+        AssetManagerTest::TearDown();
+    }
+
+    // every source has the same name, so that only the content tells them apart
+    string createSource(char content) {
+        auto directory = SOURCE_DIR + "/source" + to_string(sourceCount++);
+        filesystem::makeDirectory(directory);
+        auto path = directory + "/artifact";
+        ofstream(path) << string(RESOURCE_SIZE, content);
+        return path;
+    }
+
+    string createSource() {
+        return createSource(static_cast<char>('a' + sourceCount));
+    }
+
+    shared_ptr<Resource> registerResource(const string& id, const string& sourcePath) {
+        return storageManager->registerAndAcquireResource(
+                storageManager->reserveSpace(RESOURCE_SIZE), id, sourcePath);
+    }
+
+    string STORAGE_DIR;
+    string SOURCE_DIR;
+    int sourceCount = 0;
+    shared_ptr<StorageManager> storageManager;
+};
+
+TEST_F(StorageManagerTest, RegisteringAnExistingIdReusesTheResource) {  // NOLINT
+    auto first = registerResource("id", createSource());
+    ASSERT_NE(first, nullptr);
+    auto path = first->getPath();
+
+    auto duplicatePath = createSource();
+    auto second = registerResource("id", duplicatePath);
+    ASSERT_EQ(first, second);
+    ASSERT_FALSE(filesystem::exists(duplicatePath));
+    ASSERT_TRUE(filesystem::exists(path));
+
+    // both registrations hold a reference
+    ASSERT_EQ(storageManager->releaseResource(second), 0u);
+    ASSERT_TRUE(filesystem::exists(path));
+    ASSERT_GT(storageManager->releaseResource(first), 0u);
+    ASSERT_FALSE(filesystem::exists(path));
+    ASSERT_EQ(storageManager->acquireResource("id"), nullptr);
+}
+
+TEST_F(StorageManagerTest, PurgeUnreferencedOnlyErasesResourcesNobodyAcquired) {  // NOLINT
+    ASSERT_NE(registerResource("kept", createSource()), nullptr);
+    ASSERT_NE(registerResource("unreferenced", createSource()), nullptr);
+
+    // a new storage manager loads both resources from disk, without any reference
+    storageManager = StorageManager::create(STORAGE_DIR, assetManager);
+    ASSERT_NE(storageManager, nullptr);
+    auto kept = storageManager->acquireResource("kept");
+    ASSERT_NE(kept, nullptr);
+    auto unreferencedPath = STORAGE_DIR + "/unreferenced";
+    ASSERT_TRUE(filesystem::exists(unreferencedPath));
+
+    storageManager->purgeUnreferenced();
+
+    ASSERT_FALSE(filesystem::exists(unreferencedPath));
+    ASSERT_EQ(storageManager->acquireResource("unreferenced"), nullptr);
+    ASSERT_EQ(storageManager->acquireResource("kept"), kept);
+    ASSERT_TRUE(filesystem::exists(kept->getPath()));
+}
+
+TEST_F(StorageManagerTest, ErasingAResourceRefreshesTheAvailableSpace) {  // NOLINT
+    static constexpr size_t RESERVED_SIZE = 64 * 1024 * 1024;
+
+    // make the space available on the device, rather than the budget, the limit
+    storageManager->setBudget(static_cast<size_t>(1) << 30);
+    auto resource = registerResource("id", createSource());
+    ASSERT_NE(resource, nullptr);
+    auto before = storageManager->availableBudget();
+    ASSERT_GT(before, 2 * RESERVED_SIZE);
+
+    // the reservation is taken off the cached space, without querying the file system again
+    auto token = storageManager->reserveSpace(RESERVED_SIZE);
+    ASSERT_NE(token, nullptr);
+    ASSERT_EQ(storageManager->availableBudget(), before - RESERVED_SIZE);
+
+    // erasing a resource invalidates the cache, and the file system does not see the reservation
+    ASSERT_GT(storageManager->releaseResource(resource), 0u);
+    ASSERT_GT(storageManager->availableBudget(), before - RESERVED_SIZE / 2);
+}
+
+TEST_F(StorageManagerTest, RegisteringIdenticalContentSharesTheResource) {  // NOLINT
+    auto first = registerResource("first", createSource('x'));
+    ASSERT_NE(first, nullptr);
+    auto path = first->getPath();
+    ASSERT_FALSE(first->getContentHash().empty());
+
+    auto duplicatePath = createSource('x');
+    auto second = registerResource("second", duplicatePath);
+    ASSERT_EQ(first, second);
+    ASSERT_FALSE(filesystem::exists(duplicatePath));
+    ASSERT_TRUE(first->isKnownAs("second"));
+
+    auto acquired = storageManager->acquireResource("second");
+    ASSERT_EQ(acquired, first);
+    ASSERT_EQ(storageManager->releaseResource(acquired), 0u);
+
+    // the shared resource stays until both registrations release it, then neither id finds it
+    ASSERT_EQ(storageManager->releaseResource(second), 0u);
+    ASSERT_TRUE(filesystem::exists(path));
+    ASSERT_GT(storageManager->releaseResource(first), 0u);
+    ASSERT_FALSE(filesystem::exists(path));
+    ASSERT_EQ(storageManager->acquireResource("first"), nullptr);
+    ASSERT_EQ(storageManager->acquireResource("second"), nullptr);
+
+    // once erased, the content is stored again by the next registration
+    auto third = registerResource("third", createSource('x'));
+    ASSERT_NE(third, nullptr);
+    ASSERT_NE(third, first);
+    ASSERT_TRUE(filesystem::exists(third->getPath()));
+}
+
+TEST_F(StorageManagerTest, RegisteringDifferentContentStoresSeparateResources) {  // NOLINT
+    auto first = registerResource("first", createSource('x'));
+    auto second = registerResource("second", createSource('y'));
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    ASSERT_NE(first, second);
+    ASSERT_NE(first->getContentHash(), second->getContentHash());
+    ASSERT_NE(first->getPath(), second->getPath());
+}
+
+TEST_F(StorageManagerTest, SharedContentIsRestoredAfterRestart) {  // NOLINT
+    ASSERT_NE(registerResource("first", createSource('x')), nullptr);
+    ASSERT_NE(registerResource("second", createSource('x')), nullptr);
+
+    storageManager = StorageManager::create(STORAGE_DIR, assetManager);
+    ASSERT_NE(storageManager, nullptr);
+    auto first = storageManager->acquireResource("first");
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(storageManager->acquireResource("second"), first);
+
+    // the content index is restored as well, so a third copy is shared too
+    ASSERT_EQ(registerResource("third", createSource('x')), first);
+}
@@ -426,13 +426,15 @@ private:
         std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder = nullptr);
 
     /**
-     * This function deserializes a @c Directive's payload into a @c rapidjson::Document.
+     * This function retrieves the parsed payload of a @c Directive.
      *
-     * @param info The @c DirectiveInfo to read the payload string from.
-     * @param[out] document The @c rapidjson::Document to parse the payload into.
-     * @return @c true if parsing was successful, else @c false.
+     * @param info The @c DirectiveInfo to read the payload from.
+     * @param[out] payload The shared, already parsed payload of the directive.
+     * @return @c true if the payload is available, else @c false.
      */
-    bool parseDirectivePayload(std::shared_ptr<DirectiveInfo> info, rapidjson::Document* document);
+    bool parseDirectivePayload(
+        std::shared_ptr<DirectiveInfo> info,
+        std::shared_ptr<const avsCommon::avs::ParsedPayload>* payload);
 
     /**
      * This function pre-handles a @c PLAY directive.
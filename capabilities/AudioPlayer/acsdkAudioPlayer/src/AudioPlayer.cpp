@@ -23,9 +23,9 @@
 #include "acsdkAudioPlayer/Util.h"
 
 #include <rapidjson/stringbuffer.h>
-#include <rapidjson/error/en.h>
 
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
+#include <AVSCommon/AVS/ParsedPayload.h>
 #include <AVSCommon/SDKInterfaces/Audio/MixingBehavior.h>
 #include <AVSCommon/Utils/JSON/JSONGenerator.h>
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
@@ -1105,15 +1105,16 @@ void AudioPlayer::doShutdown() {
     m_captionManager.reset();
 }
 
-bool AudioPlayer::parseDirectivePayload(std::shared_ptr<DirectiveInfo> info, rapidjson::Document* document) {
-    rapidjson::ParseResult result = document->Parse(info->directive->getPayload());
-    if (result) {
+bool AudioPlayer::parseDirectivePayload(
+    std::shared_ptr<DirectiveInfo> info,
+    std::shared_ptr<const ParsedPayload>* payload) {
+    *payload = info->directive->getParsedPayload();
+    if (*payload) {
         return true;
     }
 
     ACSDK_ERROR(LX("parseDirectivePayloadFailed")
-                    .d("reason", rapidjson::GetParseError_En(result.Code()))
-                    .d("offset", result.Offset())
+                    .d("reason", "invalidPayload")
                     .d("messageId", info->directive->getMessageId()));
     sendExceptionEncounteredAndReportFailed(
         info, "Unable to parse payload", ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED);
@@ -1182,10 +1183,11 @@ void AudioPlayer::preHandlePlayDirective(std::shared_ptr<DirectiveInfo> info) {
     if (info) {
         ACSDK_DEBUG9(LX("prePLAY").d("payload", info->directive->getPayload()));
     }
-    rapidjson::Document payload;
-    if (!info || !parseDirectivePayload(info, &payload)) {
+    std::shared_ptr<const ParsedPayload> parsedPayload;
+    if (!info || !parseDirectivePayload(info, &parsedPayload)) {
         return;
     }
+    const rapidjson::Value& payload = parsedPayload->getDocument();
     std::shared_ptr<PlayDirectiveInfo> playItem = std::make_shared<PlayDirectiveInfo>(
         info->directive->getMessageId(),
         info->directive->getDialogRequestId().empty() ? m_lastDialogRequestId : info->directive->getDialogRequestId());
@@ -1427,10 +1429,11 @@ void AudioPlayer::handlePlayDirective(std::shared_ptr<DirectiveInfo> info) {
         ACSDK_DEBUG9(LX("PLAY").d("payload", info->directive->getPayload()));
     }
 
-    rapidjson::Document payload;
-    if (!info || !parseDirectivePayload(info, &payload)) {
+    std::shared_ptr<const ParsedPayload> parsedPayload;
+    if (!info || !parseDirectivePayload(info, &parsedPayload)) {
         return;
     }
+    const rapidjson::Value& payload = parsedPayload->getDocument();
 
     rapidjson::Value::ConstMemberIterator audioItemJson;
     if (!jsonUtils::findNode(payload, "audioItem", &audioItemJson)) {
@@ -1523,10 +1526,11 @@ void AudioPlayer::handleStopDirective(std::shared_ptr<DirectiveInfo> info) {
 
 void AudioPlayer::handleClearQueueDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG1(LX("handleClearQueue"));
-    rapidjson::Document payload;
-    if (!info || !parseDirectivePayload(info, &payload)) {
+    std::shared_ptr<const ParsedPayload> parsedPayload;
+    if (!info || !parseDirectivePayload(info, &parsedPayload)) {
         return;
     }
+    const rapidjson::Value& payload = parsedPayload->getDocument();
 
     ClearBehavior clearBehavior;
     if (!jsonUtils::retrieveValue(payload, "clearBehavior", &clearBehavior)) {
@@ -1539,10 +1543,11 @@ void AudioPlayer::handleClearQueueDirective(std::shared_ptr<DirectiveInfo> info)
 
 void AudioPlayer::handleUpdateProgressReportIntervalDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG1(LX("handleUpdateProgressReportIntervalDirective"));
-    rapidjson::Document payload;
-    if (!info || !parseDirectivePayload(info, &payload)) {
+    std::shared_ptr<const ParsedPayload> parsedPayload;
+    if (!info || !parseDirectivePayload(info, &parsedPayload)) {
         return;
     }
+    const rapidjson::Value& payload = parsedPayload->getDocument();
 
     int64_t milliseconds;
     if (!jsonUtils::retrieveValue(payload, "progressReportIntervalInMilliseconds", &milliseconds)) {
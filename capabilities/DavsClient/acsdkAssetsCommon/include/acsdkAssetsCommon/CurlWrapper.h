@@ -28,6 +28,7 @@
 
 #include "DownloadChunkQueue.h"
 #include "DownloadStream.h"
+#include "RangedDownload.h"
 #include "ResponseSink.h"
 #include "acsdkAssetsCommon/CurlProgressCallbackInterface.h"
 #include "acsdkAssetsInterfaces/ResultCode.h"
@@ -86,6 +87,30 @@ public:
             bool unpack = false,
             size_t size = 0);
 
+    /// Default number of concurrent connections used by @c downloadRanged.
+    static constexpr size_t DEFAULT_RANGED_CONNECTIONS = 4;
+
+    /**
+     * Synchronously download a remote URL to a local file using concurrent HTTP range requests. The progress is kept
+     * in files starting with @c statePrefix, so a download that fails, or is interrupted by a restart, resumes where
+     * it stopped the next time it is called with the same prefix. Every range is verified before the file is moved to
+     * @c path. Falls back to @c download if the server does not support range requests.
+     * @param url the URL to download from
+     * @param path the absolute path of the file to write to
+     * @param statePrefix path prefix of the partial file and its state, it should be stable across restarts
+     * @param callbackObj object that implements CurlProgressCallbackInterface
+     * @param size size of the file to be downloaded, must not be 0
+     * @param maxConnections maximum number of concurrent connections, throttled downloads use a single connection
+     * @return SUCCESS if successfully downloaded
+     */
+    commonInterfaces::ResultCode downloadRanged(
+            const std::string& url,
+            const std::string& path,
+            const std::string& statePrefix,
+            const std::weak_ptr<CurlProgressCallbackInterface>& callbackObj,
+            size_t size,
+            size_t maxConnections = DEFAULT_RANGED_CONNECTIONS);
+
     /// Return status for header APIs
     using HeaderResults = avsCommon::utils::error::Result<commonInterfaces::ResultCode, std::string>;
 
@@ -130,6 +155,34 @@ private:
     // Initializes the object, returns true if successful.
     bool init();
 
+    /**
+     * Applies the connection options shared by every handle of this object.
+     * @param handle the handle to configure
+     * @param errorBuffer buffer of CURL_ERROR_SIZE bytes that receives error messages for this handle
+     * @return CURLE_OK if successful
+     */
+    CURLcode configureHandle(CURL* handle, char* errorBuffer) const;
+
+    /**
+     * Fetches a single byte range on its own curl handle, used by @c downloadRanged.
+     * @param url the URL to download from
+     * @param offset offset of the first byte of the range
+     * @param length number of bytes in the range
+     * @param totalSize size of the whole file
+     * @param onData receives the data of the range
+     * @param rangedDownload the download this range belongs to, used to report the overall progress
+     * @param callbackObj object that implements CurlProgressCallbackInterface
+     * @return the result of the transfer
+     */
+    RangedDownload::FetchResult fetchRange(
+            const std::string& url,
+            size_t offset,
+            size_t length,
+            size_t totalSize,
+            const RangedDownload::DataCallback& onData,
+            const RangedDownload& rangedDownload,
+            const std::weak_ptr<CurlProgressCallbackInterface>& callbackObj) const;
+
     /**
      * Gets MAP Authentication header.
      * @param header the string to populate
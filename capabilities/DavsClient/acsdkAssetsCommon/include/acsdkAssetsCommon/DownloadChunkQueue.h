@@ -42,8 +42,10 @@ public:
      * Constructing a new queue to hold downloaded data chunks
      * @param expectedSize expected download size. Pushing more or less data before completion signals error
      *                     unless the user has signaled no size check with the expected size of 0.
+     * @param maxChunks maximum number of chunks held by the queue, a push on a full queue waits for the consumer to
+     *                  catch up. 0 means the queue is not bounded.
      */
-    explicit DownloadChunkQueue(size_t expectedSize);
+    explicit DownloadChunkQueue(size_t expectedSize, size_t maxChunks = 0);
 
     virtual ~DownloadChunkQueue();
 
@@ -54,10 +56,12 @@ public:
     size_t size();
 
     /**
-     * Producer pushes new data chunk into download queue
+     * Producer pushes new data chunk into download queue. If the queue is bounded and full, this blocks until the
+     * consumer pops a chunk, which slows the download down to the pace of the consumer.
      * @param data pointer for data chunk
      * @param size number of bytes in the data chunk
-     * @return true when successful, false for invalid argument or if accumulated size exceeds expectedSize
+     * @return true when successful, false for invalid argument, if accumulated size exceeds expectedSize, or if the
+     * consumer stopped or did not make room in time
      */
     bool push(char* data, size_t size);
 
@@ -95,6 +99,9 @@ private:
     /// condition variable to signal blocking pop function new chunks available
     std::condition_variable m_cond;
 
+    /// condition variable to signal blocking push function that room is available in a bounded queue
+    std::condition_variable m_spaceCond;
+
     /// mutex to protect the member variables including m_queue
     std::mutex m_mutex;
 
@@ -104,6 +111,9 @@ private:
     /// expected file size for the artifact to be downloaded
     size_t m_expectedSize;
 
+    /// maximum number of chunks in the queue, 0 if unbounded
+    const size_t m_maxChunks;
+
     /// size downloaded so far (pushed into queue)
     size_t m_downloadedSize;
 
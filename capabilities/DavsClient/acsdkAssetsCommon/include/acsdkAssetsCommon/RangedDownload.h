@@ -0,0 +1,208 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ACSDKASSETSCOMMON_RANGEDDOWNLOAD_H_
+#define ACSDKASSETSCOMMON_RANGEDDOWNLOAD_H_
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "acsdkAssetsInterfaces/ResultCode.h"
+
+namespace alexaClientSDK {
+namespace acsdkAssets {
+namespace common {
+
+/**
+ * Downloads a file of a known size as several byte ranges that can be fetched concurrently. The progress of every range
+ * is persisted next to the partially downloaded file, so a download that is interrupted, even by a restart, resumes
+ * from where it stopped instead of starting over. The data is synced to the device before the state records it, so a
+ * resume after a power loss only trusts data that reached the device. Each range is hashed as it is received and the
+ * hashes are checked against the data on disk before the file is moved to its final location.
+ *
+ * The transport is supplied by the caller as a @c RangeFetcher, which keeps this class independent of libcurl.
+ */
+class RangedDownload {
+public:
+    /// Default lower limit on the size of a single range, smaller downloads use fewer ranges.
+    static constexpr size_t DEFAULT_MIN_SEGMENT_SIZE = 1024 * 1024;
+
+    /// Result of fetching a single range.
+    enum class FetchResult {
+        /// The requested range was received completely.
+        SUCCESS,
+        /// The server answered with the whole resource instead of the requested range.
+        RANGES_UNSUPPORTED,
+        /// The transfer failed, it may succeed if retried.
+        FAILED,
+        /// The transfer was cancelled by the user and should not be retried.
+        CANCELLED
+    };
+
+    /**
+     * Consumes data received for a range.
+     * @param data pointer to the received bytes.
+     * @param size number of bytes received.
+     * @return true to continue the transfer, false to abort it.
+     */
+    using DataCallback = std::function<bool(const char* data, size_t size)>;
+
+    /**
+     * Fetches the bytes [offset, offset + length) of the remote resource and passes them, in order, to the callback.
+     * It is called concurrently from several threads.
+     */
+    using RangeFetcher = std::function<FetchResult(size_t offset, size_t length, const DataCallback& onData)>;
+
+    /**
+     * Creates a ranged download, picking up any state persisted by a previous attempt for the same @c statePrefix.
+     *
+     * @param statePrefix REQUIRED, path prefix of the partial file (statePrefix.partial) and its state
+     * (statePrefix.segments); its directory must exist.
+     * @param path REQUIRED, final location of the downloaded file.
+     * @param size REQUIRED, size of the file in bytes.
+     * @param maxConnections number of ranges that may be fetched concurrently, at least 1.
+     * @param minSegmentSize lower limit on the size of a single range.
+     * @return NULLABLE, the new object, or null if the parameters are invalid or the partial file cannot be created.
+     */
+    static std::unique_ptr<RangedDownload> create(
+            const std::string& statePrefix,
+            const std::string& path,
+            size_t size,
+            size_t maxConnections,
+            size_t minSegmentSize = DEFAULT_MIN_SEGMENT_SIZE);
+
+    /**
+     * Fetches all of the missing ranges, verifies them and moves the file to its final location. On failure the state
+     * is persisted so a later call, or a later object created with the same @c statePrefix, resumes the download.
+     *
+     * @param fetcher REQUIRED, the function used to fetch each range.
+     * @return SUCCESS if the file was downloaded and verified, CONNECTION_FAILED if a range could not be fetched,
+     * CHECKSUM_MISMATCH if the data on disk did not match what was received, CATASTROPHIC_FAILURE if cancelled or if
+     * the file could not be moved.
+     */
+    commonInterfaces::ResultCode run(const RangeFetcher& fetcher);
+
+    /**
+     * @return true if the last @c run failed because the server does not support range requests, in which case the
+     * caller should fall back to a regular download.
+     */
+    bool rangesUnsupported() const;
+
+    /**
+     * @return the number of bytes downloaded so far, including those from previous attempts.
+     */
+    size_t getDownloadedBytes() const;
+
+    /**
+     * @return the number of ranges the download is split into.
+     */
+    size_t getSegmentCount() const;
+
+    /**
+     * Removes any partial download and state stored with the given prefix.
+     * @param statePrefix the prefix given to @c create.
+     */
+    static void discard(const std::string& statePrefix);
+
+private:
+    /// A single byte range of the file.
+    struct Segment {
+        /// Offset of the range in the file.
+        size_t offset;
+        /// Length of the range.
+        size_t length;
+        /// Number of bytes of the range already written to the partial file.
+        size_t downloaded;
+        /// Hex encoded SHA-256 of the range, empty until the range is complete.
+        std::string digest;
+    };
+
+    RangedDownload(
+            const std::string& statePrefix,
+            const std::string& path,
+            size_t size,
+            size_t maxConnections,
+            size_t minSegmentSize);
+
+    /**
+     * Loads the persisted state if it is consistent with this download, otherwise plans new segments and creates an
+     * empty partial file.
+     * @return true if successful.
+     */
+    bool init();
+
+    /**
+     * Loads the persisted state.
+     * @return true if the state was found and is consistent with this download.
+     */
+    bool loadState();
+
+    /**
+     * Writes the current state to disk, atomically replacing the previous one.
+     * @note m_mutex must be held by the caller.
+     * @return true if successful.
+     */
+    bool saveStateLocked();
+
+    /**
+     * Fetches the missing part of a segment.
+     * @return the result of the fetch.
+     */
+    FetchResult fetchSegment(size_t index, const RangeFetcher& fetcher);
+
+    /**
+     * Computes the SHA-256 of a part of the partial file.
+     * @param offset offset of the first byte to hash.
+     * @param length number of bytes to hash.
+     * @param[out] digest the hex encoded digest.
+     * @return true if successful.
+     */
+    bool hashFileRange(size_t offset, size_t length, std::string& digest) const;
+
+    /// Path of the partial file.
+    const std::string m_partialPath;
+    /// Path of the persisted state.
+    const std::string m_statePath;
+    /// Final path of the file.
+    const std::string m_path;
+    /// Size of the file.
+    const size_t m_size;
+    /// Number of ranges fetched concurrently.
+    const size_t m_maxConnections;
+    /// Lower limit on the size of a range.
+    const size_t m_minSegmentSize;
+
+    /// Protects m_segments and the state file.
+    mutable std::mutex m_mutex;
+    /// The ranges of the file.
+    std::vector<Segment> m_segments;
+    /// Number of bytes written to the partial file, updated as data arrives.
+    std::atomic<size_t> m_downloadedBytes;
+    /// Set when the remaining fetches should stop early.
+    std::atomic_bool m_stop;
+    /// Whether the server ignored a range request.
+    std::atomic_bool m_rangesUnsupported;
+};
+
+}  // namespace common
+}  // namespace acsdkAssets
+}  // namespace alexaClientSDK
+
+#endif  // ACSDKASSETSCOMMON_RANGEDDOWNLOAD_H_
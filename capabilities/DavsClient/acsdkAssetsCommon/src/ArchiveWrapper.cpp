@@ -158,7 +158,23 @@ static bool unpackLocked(
             break;
         }
 
-        copyData(reader, writer);
+        // an entry that is truncated, fails to decompress or exceeds the size limit must not be left half written,
+        // warnings are accepted as they always were
+        archiveStatus = copyData(reader, writer);
+        if (archiveStatus == ARCHIVE_WARN) {
+            ACSDK_WARN(LX("unpackLocked")
+                               .m("Warning while extracting file data")
+                               .d("path", fullOutputPath)
+                               .d("warning", archive_error_string(reader)));
+        } else if (archiveStatus != ARCHIVE_OK) {
+            ACSDK_ERROR(LX("unpackLocked")
+                                .m("Failed to extract file data")
+                                .d("path", fullOutputPath)
+                                .d("error", archive_error_string(reader)));
+            allFilesWrittenSuccessfully = false;
+            break;
+        }
+
         archiveStatus = archive_write_finish_entry(writer);
         struct stat fileStat {};
         auto rc = stat(fullOutputPath.data(), &fileStat);
@@ -47,10 +47,12 @@ static const auto s_metrics = AmdMetricsWrapper::creator("curlWrapper");
 
 static const long HTTP_SERVER_ERROR = 500;
 
+static const long HTTP_PARTIAL_CONTENT = 206;
+
 static const curl_off_t THROTTLED_SPEED_KB = 256 * 1024 / 8;  // 256 Kbits;
 
-/// Number of data chunks in download (buffering) queue before we attempt to slow down download
-static const size_t DOWNLOAD_QUEUE_SIZE_THRESHOLD = 50;
+/// Maximum number of data chunks (each up to 16k) buffered between the download and its consumer
+static const size_t DOWNLOAD_QUEUE_MAX_CHUNKS = 50;
 
 /// String to identify log entries originating from this file.
 static const std::string TAG{"CurlWrapper"};
@@ -67,6 +69,11 @@ static void curlSlistFreeAllDelegate(struct curl_slist* curSlist) {
     curl_slist_free_all(curSlist);
 }
 
+/// This is needed to get around some compiler errors in MinGW around using curl functions statically
+static void curlEasyCleanupDelegate(CURL* handle) {
+    curl_easy_cleanup(handle);
+}
+
 string CurlWrapper::getValueFromHeaders(const std::string& headers, const std::string& key) {
     auto keyLower = stringToLowerCase(key);
     istringstream headerStream(headers);
@@ -107,39 +114,45 @@ bool CurlWrapper::init() {
     m_handle = curl_easy_init();
     if (!m_handle) return false;
 
+    m_code = configureHandle(m_handle, m_errorBuffer);
+    return m_code == CURLE_OK;
+}
+
+CURLcode CurlWrapper::configureHandle(CURL* handle, char* errorBuffer) const {
+    CURLcode code;
     if (m_isThrottled) {
-        if ((m_code = curl_easy_setopt(m_handle, CURLOPT_MAX_SEND_SPEED_LARGE, THROTTLED_SPEED_KB))) return false;
-        if ((m_code = curl_easy_setopt(m_handle, CURLOPT_MAX_RECV_SPEED_LARGE, THROTTLED_SPEED_KB))) return false;
+        if ((code = curl_easy_setopt(handle, CURLOPT_MAX_SEND_SPEED_LARGE, THROTTLED_SPEED_KB))) return code;
+        if ((code = curl_easy_setopt(handle, CURLOPT_MAX_RECV_SPEED_LARGE, THROTTLED_SPEED_KB))) return code;
     }
 
     // allow up to 10 redirects
-    if ((m_code = curl_easy_setopt(m_handle, CURLOPT_MAXREDIRS, 10L))) return false;
+    if ((code = curl_easy_setopt(handle, CURLOPT_MAXREDIRS, 10L))) return code;
     // set a speed timeout to close connections if no data is transferred within 20 seconds
-    if ((m_code = curl_easy_setopt(m_handle, CURLOPT_LOW_SPEED_LIMIT, 1))) return false;
-    if ((m_code = curl_easy_setopt(m_handle, CURLOPT_LOW_SPEED_TIME, 20))) return false;
+    if ((code = curl_easy_setopt(handle, CURLOPT_LOW_SPEED_LIMIT, 1))) return code;
+    if ((code = curl_easy_setopt(handle, CURLOPT_LOW_SPEED_TIME, 20))) return code;
     // Setting the connection timeout to 30 seconds
-    if ((m_code = curl_easy_setopt(m_handle, CURLOPT_CONNECTTIMEOUT, 30))) return false;
+    if ((code = curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT, 30))) return code;
     // follow "Location:" headers
-    if ((m_code = curl_easy_setopt(m_handle, CURLOPT_FOLLOWLOCATION, 1))) return false;
+    if ((code = curl_easy_setopt(handle, CURLOPT_FOLLOWLOCATION, 1))) return code;
     // setup an error buffer
-    if ((m_code = curl_easy_setopt(m_handle, CURLOPT_ERRORBUFFER, m_errorBuffer))) return false;
+    if ((code = curl_easy_setopt(handle, CURLOPT_ERRORBUFFER, errorBuffer))) return code;
     // verify host
-    if ((m_code = curl_easy_setopt(m_handle, CURLOPT_SSL_VERIFYHOST, 2L))) return false;
+    if ((code = curl_easy_setopt(handle, CURLOPT_SSL_VERIFYHOST, 2L))) return code;
     // verify peer
-    if ((m_code = curl_easy_setopt(m_handle, CURLOPT_SSL_VERIFYPEER, 1L))) return false;
+    if ((code = curl_easy_setopt(handle, CURLOPT_SSL_VERIFYPEER, 1L))) return code;
     // Enable communication using TLS1.0 or later.  CURL_SSLVERSION_TLSv1_3 is available but seems new; Anvil risk
     // opened for confirmation.
-    if ((m_code = curl_easy_setopt(m_handle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1_2))) return false;
+    if ((code = curl_easy_setopt(handle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1_2))) return code;
 
     if (!m_certPath.empty()) {
         ACSDK_DEBUG(LX("init").m("Using custom cert and to not verify host or peers").d("cert Path", m_certPath));
-        if ((m_code = curl_easy_setopt(m_handle, CURLOPT_CAINFO, m_certPath.c_str()))) return false;
+        if ((code = curl_easy_setopt(handle, CURLOPT_CAINFO, m_certPath.c_str()))) return code;
         // our cert is self-signed and is based on no known CA-Author
-        if ((m_code = curl_easy_setopt(m_handle, CURLOPT_SSL_VERIFYPEER, 0L))) return false;
-        if ((m_code = curl_easy_setopt(m_handle, CURLOPT_SSL_VERIFYHOST, 0L))) return false;
+        if ((code = curl_easy_setopt(handle, CURLOPT_SSL_VERIFYPEER, 0L))) return code;
+        if ((code = curl_easy_setopt(handle, CURLOPT_SSL_VERIFYHOST, 0L))) return code;
     }
 
-    return true;
+    return CURLE_OK;
 }
 
 unique_ptr<CurlWrapper> CurlWrapper::create(
@@ -414,24 +427,9 @@ ResultCode CurlWrapper::streamToQueue(
         if (queuePtr == nullptr) {
             return 0;
         }
-        auto numBytes = size * nmemb;
-        if (queuePtr->push(ptr, numBytes)) {
-            auto queueSize = queuePtr->size();
-            if (queueSize > DOWNLOAD_QUEUE_SIZE_THRESHOLD * 2) {
-                ACSDK_ERROR(LX("curlWriteCallback").m("QueueSize too big, abort download.").d("QueueSize", queueSize));
-                s_metrics().addCounter("UnpackingStalled");
-                return 0;
-            } else if (queueSize > DOWNLOAD_QUEUE_SIZE_THRESHOLD) {
-                // usually download speed is slower than unpack speed, when this is no longer the case,
-                // we slow down the download so as not to increase RAM consumption unnecessarily.
-                // Each dataChunk is up to 16k.
-                ACSDK_INFO(LX("curlWriteCallback").m("Slowing down download").d("queue size", queueSize));
-                this_thread::sleep_for(milliseconds(10) * queueSize);
-            }
-            return nmemb;
-        } else {
-            return 0;
-        }
+        // the queue is bounded, so a push blocks while the consumer catches up, which holds the transfer back at the
+        // pace of extraction without buffering more than DOWNLOAD_QUEUE_MAX_CHUNKS chunks
+        return queuePtr->push(ptr, size * nmemb) ? nmemb : 0;
     };
 
     if ((m_code = curl_easy_setopt(m_handle, CURLOPT_WRITEDATA, downloadChunkQueue.get()))) {
@@ -536,7 +534,7 @@ ResultCode CurlWrapper::getAndDownloadMultipart(
         ACSDK_ERROR(LX("getAndDownloadMultipart").m("Unable to set HTTPHEADER"));
         return ResultCode::CONNECTION_FAILED;
     }
-    auto downloadChunkQueue = make_shared<DownloadChunkQueue>(0);
+    auto downloadChunkQueue = make_shared<DownloadChunkQueue>(0, DOWNLOAD_QUEUE_MAX_CHUNKS);
 
     auto curlHeadersCallback = [](char* ptr, size_t size, size_t nmemb, void* userdata) -> size_t {
         auto sink = static_cast<ResponseSink*>(userdata);
@@ -628,7 +626,7 @@ ResultCode CurlWrapper::download(
     static mutex s_downloadUnpackMutex;
     lock_guard<mutex> lock(s_downloadUnpackMutex);
 
-    auto downloadChunkQueue = make_shared<DownloadChunkQueue>(size);
+    auto downloadChunkQueue = make_shared<DownloadChunkQueue>(size, DOWNLOAD_QUEUE_MAX_CHUNKS);
 
     // Download to queue in separate thread (producer)
     // Before streamToQueue exit, it must call downloadChunkQueue->pushComplete to indicate success or failure
@@ -646,6 +644,151 @@ ResultCode CurlWrapper::download(
     ACSDK_INFO(LX("download").d("resultCode", resultCode).d("path", path));
     return resultCode;
 }
+
+ResultCode CurlWrapper::downloadRanged(
+        const std::string& url,
+        const std::string& path,
+        const std::string& statePrefix,
+        const weak_ptr<CurlProgressCallbackInterface>& callbackObj,
+        size_t size,
+        size_t maxConnections) {
+    // the throttling speed applies to each connection, so throttled downloads fetch one range at a time
+    auto connections = m_isThrottled ? 1 : max<size_t>(1, maxConnections);
+    auto ranged = RangedDownload::create(statePrefix, path, size, connections);
+    if (ranged == nullptr) {
+        ACSDK_WARN(LX("downloadRanged").m("Falling back to a single stream download").d("path", path.c_str()));
+        return download(url, path, callbackObj, false, size);
+    }
+
+    ACSDK_INFO(LX("downloadRanged")
+                       .sensitive("URL for download", url.c_str())
+                       .d("Local path to download", path.c_str())
+                       .d("segments", ranged->getSegmentCount())
+                       .d("resumeFrom", ranged->getDownloadedBytes()));
+
+    auto resultCode = ranged->run(
+            [this, &url, &ranged, &callbackObj, size](
+                    size_t offset, size_t length, const RangedDownload::DataCallback& onData) {
+                return fetchRange(url, offset, length, size, onData, *ranged, callbackObj);
+            });
+
+    if (ranged->rangesUnsupported()) {
+        s_metrics().addCounter("rangesUnsupported");
+        RangedDownload::discard(statePrefix);
+        return download(url, path, callbackObj, false, size);
+    }
+    if (resultCode == ResultCode::SUCCESS && !changePermissions(path, DEFAULT_FILE_PERMISSIONS)) {
+        ACSDK_ERROR(LX("downloadRanged").m("Failed to set DEFAULT_FILE_PERMISSIONS").d("path", path.c_str()));
+        return ResultCode::CATASTROPHIC_FAILURE;
+    }
+
+    ACSDK_INFO(LX("downloadRanged").d("resultCode", resultCode).d("path", path));
+    return resultCode;
+}
+
+RangedDownload::FetchResult CurlWrapper::fetchRange(
+        const std::string& url,
+        size_t offset,
+        size_t length,
+        size_t totalSize,
+        const RangedDownload::DataCallback& onData,
+        const RangedDownload& rangedDownload,
+        const weak_ptr<CurlProgressCallbackInterface>& callbackObj) const {
+    // every range gets its own handle so that the ranges can be transferred concurrently
+    auto handle = unique_ptr<CURL, void (*)(CURL*)>(curl_easy_init(), curlEasyCleanupDelegate);
+    char errorBuffer[CURL_ERROR_SIZE]{};
+    if (handle == nullptr || configureHandle(handle.get(), errorBuffer) != CURLE_OK) {
+        ACSDK_ERROR(LX("fetchRange").m("Failed to create curl handle"));
+        return RangedDownload::FetchResult::FAILED;
+    }
+    if (m_headers != nullptr && curl_easy_setopt(handle.get(), CURLOPT_HTTPHEADER, m_headers.get()) != CURLE_OK) {
+        return RangedDownload::FetchResult::FAILED;
+    }
+
+    struct RangeContext {
+        CURL* handle;
+        const RangedDownload::DataCallback* onData;
+        const RangedDownload* rangedDownload;
+        const weak_ptr<CurlProgressCallbackInterface>* callbackObj;
+        size_t totalSize;
+        bool wholeFile;
+        bool statusChecked;
+        bool rangeIgnored;
+    } context{handle.get(), &onData, &rangedDownload, &callbackObj, totalSize, offset == 0 && length == totalSize};
+    context.statusChecked = false;
+    context.rangeIgnored = false;
+
+    // Curl callback function to write the received part of the range
+    auto writeFunction = [](char* ptr, size_t size, size_t nmemb, void* userdata) -> size_t {
+        auto context = static_cast<RangeContext*>(userdata);
+        if (!context->statusChecked) {
+            context->statusChecked = true;
+            long httpStatusCode = 0;
+            curl_easy_getinfo(context->handle, CURLINFO_RESPONSE_CODE, &httpStatusCode);
+            if (httpStatusCode == static_cast<long>(ResultCode::SUCCESS) && !context->wholeFile) {
+                // the server sent the whole resource, writing it at this range's offset would corrupt the file
+                context->rangeIgnored = true;
+                return 0;
+            }
+            if (httpStatusCode != HTTP_PARTIAL_CONTENT && httpStatusCode != static_cast<long>(ResultCode::SUCCESS)) {
+                return 0;
+            }
+        }
+        return (*context->onData)(ptr, size * nmemb) ? nmemb : 0;
+    };
+
+    // Curl callback function to report the progress of the whole download and check for cancellation
+    auto progressFunction = [](void* userdata, curl_off_t, curl_off_t, curl_off_t, curl_off_t) -> int {
+        auto context = static_cast<RangeContext*>(userdata);
+        auto callbackPtr = context->callbackObj->lock();
+        if (callbackPtr == nullptr) {
+            return 1;
+        }
+        auto toContinue = callbackPtr->onProgressUpdate(
+                static_cast<long>(context->totalSize),
+                static_cast<long>(context->rangedDownload->getDownloadedBytes()),
+                0,
+                0);
+        return toContinue ? 0 : 1;
+    };
+
+    auto range = to_string(offset) + "-" + to_string(offset + length - 1);
+    if (curl_easy_setopt(handle.get(), CURLOPT_URL, url.c_str()) ||
+        curl_easy_setopt(handle.get(), CURLOPT_RANGE, range.c_str()) ||
+        curl_easy_setopt(handle.get(), CURLOPT_WRITEFUNCTION, static_cast<CURL_WRITE_CALLBACK>(writeFunction)) ||
+        curl_easy_setopt(handle.get(), CURLOPT_WRITEDATA, &context) ||
+        curl_easy_setopt(
+                handle.get(),
+                CURLOPT_XFERINFOFUNCTION,
+                static_cast<CURL_XFERINFOFUNCTION_CALLBACK>(progressFunction)) ||
+        curl_easy_setopt(handle.get(), CURLOPT_XFERINFODATA, &context) ||
+        curl_easy_setopt(handle.get(), CURLOPT_NOPROGRESS, 0)) {
+        return RangedDownload::FetchResult::FAILED;
+    }
+
+    auto code = curl_easy_perform(handle.get());
+    if (context.rangeIgnored) {
+        return RangedDownload::FetchResult::RANGES_UNSUPPORTED;
+    }
+    if (code == CURLE_ABORTED_BY_CALLBACK) {
+        // cancelled by user, do not retry
+        return RangedDownload::FetchResult::CANCELLED;
+    }
+
+    long httpStatusCode = 0;
+    curl_easy_getinfo(handle.get(), CURLINFO_RESPONSE_CODE, &httpStatusCode);
+    if (code != CURLE_OK || (httpStatusCode != HTTP_PARTIAL_CONTENT && !context.wholeFile)) {
+        ACSDK_WARN(LX("fetchRange")
+                           .m("Range transfer failed")
+                           .d("range", range)
+                           .d("code", code)
+                           .d("HTTP returned code", httpStatusCode)
+                           .d("error", errorBuffer));
+        s_metrics().addCounter("rangeFailed");
+        return RangedDownload::FetchResult::FAILED;
+    }
+    return RangedDownload::FetchResult::SUCCESS;
+}
 }  // namespace common
 }  // namespace acsdkAssets
 }  // namespace alexaClientSDK
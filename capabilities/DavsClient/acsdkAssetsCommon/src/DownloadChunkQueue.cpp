@@ -42,8 +42,9 @@ static const std::string TAG{"DownloadChunkQueue"};
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-DownloadChunkQueue::DownloadChunkQueue(size_t expectedSize) :
+DownloadChunkQueue::DownloadChunkQueue(size_t expectedSize, size_t maxChunks) :
         m_expectedSize(expectedSize),
+        m_maxChunks(maxChunks),
         m_downloadedSize(0),
         m_downloadStatus(StreamingStatus::INPROGRESS),
         m_unpackStatus(StreamingStatus::INPROGRESS),
@@ -52,7 +53,10 @@ DownloadChunkQueue::DownloadChunkQueue(size_t expectedSize) :
         m_reportIncrement(
                 m_expectedSize ? max<size_t>(DOWNLOAD_REPORT_MINIMAL_BYTES, m_expectedSize / 8)
                                : DOWNLOAD_REPORT_MINIMAL_BYTES) {
-    ACSDK_INFO(LX("DownloadChunkQueue").m("Created DownloadChunkQueue").d("expectedSize", expectedSize));
+    ACSDK_INFO(LX("DownloadChunkQueue")
+                       .m("Created DownloadChunkQueue")
+                       .d("expectedSize", expectedSize)
+                       .d("maxChunks", maxChunks));
 }
 
 DownloadChunkQueue::~DownloadChunkQueue() {
@@ -68,6 +72,19 @@ bool DownloadChunkQueue::push(char* data, size_t size) {
     {
         unique_lock<mutex> lock(m_mutex);
 
+        // apply back pressure on the producer rather than buffering an unbounded amount of the download
+        if (m_maxChunks > 0 && m_queue.size() >= m_maxChunks && m_unpackStatus == StreamingStatus::INPROGRESS &&
+            !m_spaceCond.wait_for(lock, DOWNLOAD_CHUNK_MAX_WAIT_TIME, [this] {
+                return m_queue.size() < m_maxChunks || m_unpackStatus != StreamingStatus::INPROGRESS;
+            })) {
+            ACSDK_ERROR(LX("push").m("push failed, unpacking stalled").d("queue size", m_queue.size()));
+            s_metrics().addCounter("UnpackingStalled");
+            m_downloadStatus = StreamingStatus::ABORTED;
+            lock.unlock();
+            m_cond.notify_all();
+            return false;
+        }
+
         if (m_unpackStatus != StreamingStatus::INPROGRESS) {
             ACSDK_ERROR(LX("push").m("push failed, unpack no longer in progress").d("Number of bytes", size));
             return false;
@@ -211,6 +228,10 @@ shared_ptr<DataChunk> DownloadChunkQueue::waitAndPop() {
     // the data is still valid. When pop is called again, the previous dataChunk has already finished processing
     // by unpack function
     m_activeChunk = dataChunk;
+    lock.unlock();
+    if (dataChunk != nullptr) {
+        m_spaceCond.notify_all();
+    }
     return dataChunk;
 }
 
@@ -263,7 +284,11 @@ bool DownloadChunkQueue::popComplete(bool succeeded) {
             }
             break;  // case StreamingStatus::INPROGRESS:
     }               // switch (m_unpackStatus)
-    return (m_unpackStatus == StreamingStatus::COMPLETED);
+    auto retValue = (m_unpackStatus == StreamingStatus::COMPLETED);
+    lock.unlock();
+    // a producer waiting for room has to find out the consumer is gone
+    m_spaceCond.notify_all();
+    return retValue;
 }
 
 size_t DownloadChunkQueue::size() {
@@ -0,0 +1,550 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "acsdkAssetsCommon/RangedDownload.h"
+
+#include <AVSCommon/Utils/FileSystem/FileSystemUtils.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <fcntl.h>
+#include <openssl/evp.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#include "acsdkAssetsCommon/AmdMetricWrapper.h"
+
+namespace alexaClientSDK {
+namespace acsdkAssets {
+namespace common {
+
+using namespace std;
+using namespace commonInterfaces;
+using namespace alexaClientSDK::avsCommon::utils;
+
+static const auto s_metrics = AmdMetricsWrapper::creator("rangedDownload");
+
+/// Suffix of the file that holds the data while it is downloaded.
+static const string PARTIAL_SUFFIX = ".partial";
+
+/// Suffix of the file that holds the progress of each range.
+static const string STATE_SUFFIX = ".segments";
+
+/// Placeholder stored for the digest of a range that is not complete.
+static const string NO_DIGEST = "-";
+
+/// Number of bytes received on a range between two saves of the state.
+static constexpr size_t CHECKPOINT_BYTES = 1024 * 1024;
+
+/// Size of the buffer used to read back the partial file.
+static constexpr size_t READ_BUFFER_SIZE = 64 * 1024;
+
+/// Upper limit on the number of ranges, to reject corrupted state files.
+static constexpr size_t MAX_SEGMENTS = 64;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG{"RangedDownload"};
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+using digest_ctx_ptr = unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)>;
+
+/// Owns a file descriptor and closes it when destroyed.
+class FileDescriptor {
+public:
+    explicit FileDescriptor(int fd) : m_fd(fd) {
+    }
+    ~FileDescriptor() {
+        if (m_fd >= 0) {
+            ::close(m_fd);
+        }
+    }
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+    int get() const {
+        return m_fd;
+    }
+
+private:
+    int m_fd;
+};
+
+/**
+ * Writes a buffer at an offset of a file.
+ * @return true if the whole buffer was written.
+ */
+static bool writeAt(int fd, const char* data, size_t size, size_t offset) {
+    while (size > 0) {
+        auto written = ::pwrite(fd, data, size, static_cast<off_t>(offset));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+        offset += static_cast<size_t>(written);
+    }
+    return true;
+}
+
+/**
+ * Flushes a file, or the entries of a directory, to the storage device.
+ * @return true if successful.
+ */
+static bool syncPath(const string& path) {
+    FileDescriptor fd(::open(path.c_str(), O_RDONLY));
+    return fd.get() >= 0 && ::fsync(fd.get()) == 0;
+}
+
+/**
+ * Feeds part of a file to a digest.
+ * @return true if the whole range could be read.
+ */
+static bool digestFileRange(const string& path, size_t offset, size_t length, EVP_MD_CTX* ctx) {
+    ifstream file(path, ios::in | ios::binary);
+    if (!file.good() || !file.seekg(offset)) {
+        return false;
+    }
+    vector<char> buffer(min(length, READ_BUFFER_SIZE));
+    while (length > 0) {
+        auto toRead = min(length, buffer.size());
+        if (!file.read(buffer.data(), toRead) || EVP_DigestUpdate(ctx, buffer.data(), toRead) != 1) {
+            return false;
+        }
+        length -= toRead;
+    }
+    return true;
+}
+
+/**
+ * Finalizes a digest.
+ * @return the hex encoded digest, or an empty string on failure.
+ */
+static string finalizeDigest(EVP_MD_CTX* ctx) {
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digestLength = 0;
+    if (EVP_DigestFinal_ex(ctx, digest, &digestLength) != 1) {
+        return "";
+    }
+    ostringstream hex;
+    for (unsigned int i = 0; i < digestLength; ++i) {
+        hex << setw(2) << setfill('0') << std::hex << static_cast<int>(digest[i]);
+    }
+    return hex.str();
+}
+
+static digest_ctx_ptr newDigest() {
+    digest_ctx_ptr ctx(EVP_MD_CTX_new(), EVP_MD_CTX_free);
+    if (ctx != nullptr && EVP_DigestInit_ex(ctx.get(), EVP_sha256(), nullptr) != 1) {
+        ctx.reset();
+    }
+    return ctx;
+}
+
+unique_ptr<RangedDownload> RangedDownload::create(
+        const string& statePrefix,
+        const string& path,
+        size_t size,
+        size_t maxConnections,
+        size_t minSegmentSize) {
+    if (statePrefix.empty() || path.empty()) {
+        ACSDK_ERROR(LX("create").m("Empty path"));
+        return nullptr;
+    }
+    if (size == 0 || maxConnections == 0 || minSegmentSize == 0) {
+        ACSDK_ERROR(LX("create")
+                            .m("Invalid size")
+                            .d("size", size)
+                            .d("maxConnections", maxConnections)
+                            .d("minSegmentSize", minSegmentSize));
+        return nullptr;
+    }
+
+    auto download =
+            unique_ptr<RangedDownload>(new RangedDownload(statePrefix, path, size, maxConnections, minSegmentSize));
+    if (!download->init()) {
+        ACSDK_ERROR(LX("create").m("Failed to initialize").d("path", path));
+        return nullptr;
+    }
+    return download;
+}
+
+void RangedDownload::discard(const string& statePrefix) {
+    filesystem::removeAll(statePrefix + PARTIAL_SUFFIX);
+    filesystem::removeAll(statePrefix + STATE_SUFFIX);
+}
+
+RangedDownload::RangedDownload(
+        const string& statePrefix,
+        const string& path,
+        size_t size,
+        size_t maxConnections,
+        size_t minSegmentSize) :
+        m_partialPath(statePrefix + PARTIAL_SUFFIX),
+        m_statePath(statePrefix + STATE_SUFFIX),
+        m_path(path),
+        m_size(size),
+        m_maxConnections(maxConnections),
+        m_minSegmentSize(minSegmentSize),
+        m_downloadedBytes(0),
+        m_stop(false),
+        m_rangesUnsupported(false) {
+}
+
+bool RangedDownload::init() {
+    lock_guard<mutex> lock(m_mutex);
+    if (loadState()) {
+        ACSDK_INFO(LX("init")
+                           .m("Resuming download")
+                           .d("path", m_path)
+                           .d("downloaded", m_downloadedBytes.load())
+                           .d("size", m_size));
+        s_metrics().addCounter("resumed");
+        return true;
+    }
+
+    filesystem::removeAll(m_partialPath);
+    filesystem::removeAll(m_statePath);
+
+    auto count = max<size_t>(1, min(m_maxConnections, (m_size + m_minSegmentSize - 1) / m_minSegmentSize));
+    count = min(count, MAX_SEGMENTS);
+    auto segmentLength = m_size / count;
+    m_segments.clear();
+    for (size_t i = 0; i < count; ++i) {
+        auto offset = i * segmentLength;
+        auto length = (i == count - 1) ? m_size - offset : segmentLength;
+        m_segments.push_back({offset, length, 0, ""});
+    }
+    m_downloadedBytes = 0;
+
+    // create the partial file with its final size so that every range can be written in place
+    ofstream partial(m_partialPath, ios::out | ios::binary | ios::trunc);
+    if (!partial.good() || !partial.seekp(m_size - 1) || !partial.put('\0')) {
+        ACSDK_ERROR(LX("init").m("Failed to create partial file").d("path", m_partialPath));
+        return false;
+    }
+    partial.close();
+    if (!syncPath(m_partialPath)) {
+        ACSDK_ERROR(LX("init").m("Failed to sync partial file").d("path", m_partialPath));
+        return false;
+    }
+
+    return saveStateLocked();
+}
+
+bool RangedDownload::loadState() {
+    ifstream state(m_statePath);
+    if (!state.good()) {
+        return false;
+    }
+
+    size_t size = 0;
+    size_t count = 0;
+    if (!(state >> size >> count) || size != m_size || count == 0 || count > MAX_SEGMENTS) {
+        ACSDK_WARN(LX("loadState").m("Discarding state for a different download").d("path", m_statePath));
+        return false;
+    }
+    if (filesystem::sizeOf(m_partialPath) != m_size) {
+        ACSDK_WARN(LX("loadState").m("Partial file is missing or has the wrong size").d("path", m_partialPath));
+        return false;
+    }
+
+    vector<Segment> segments;
+    size_t expectedOffset = 0;
+    size_t downloadedBytes = 0;
+    for (size_t i = 0; i < count; ++i) {
+        Segment segment{0, 0, 0, ""};
+        if (!(state >> segment.offset >> segment.length >> segment.downloaded >> segment.digest) ||
+            segment.offset != expectedOffset || segment.length == 0 || segment.downloaded > segment.length) {
+            ACSDK_WARN(LX("loadState").m("Corrupted state").d("path", m_statePath));
+            return false;
+        }
+        if (segment.digest == NO_DIGEST) {
+            segment.digest.clear();
+        }
+        if (segment.downloaded == segment.length && segment.digest.empty()) {
+            // the range was written but never verified, fetch it again
+            segment.downloaded = 0;
+        }
+        expectedOffset += segment.length;
+        downloadedBytes += segment.downloaded;
+        segments.push_back(move(segment));
+    }
+    if (expectedOffset != m_size) {
+        ACSDK_WARN(LX("loadState").m("State does not cover the whole file").d("path", m_statePath));
+        return false;
+    }
+
+    m_segments = move(segments);
+    m_downloadedBytes = downloadedBytes;
+    return true;
+}
+
+bool RangedDownload::saveStateLocked() {
+    auto tmpPath = m_statePath + ".tmp";
+    {
+        ofstream state(tmpPath, ios::out | ios::trunc);
+        state << m_size << " " << m_segments.size() << "\n";
+        for (const auto& segment : m_segments) {
+            state << segment.offset << " " << segment.length << " " << segment.downloaded << " "
+                  << (segment.digest.empty() ? NO_DIGEST : segment.digest) << "\n";
+        }
+        state.close();
+        if (state.fail()) {
+            ACSDK_ERROR(LX("saveStateLocked").m("Failed to write state").d("path", tmpPath));
+            return false;
+        }
+    }
+    // sync the new state before it replaces the old one, then its directory so that the rename survives a power loss
+    if (!syncPath(tmpPath) || !filesystem::move(tmpPath, m_statePath) ||
+        !syncPath(filesystem::parentDirNameOf(m_statePath))) {
+        ACSDK_ERROR(LX("saveStateLocked").m("Failed to persist state").d("path", m_statePath));
+        return false;
+    }
+    return true;
+}
+
+RangedDownload::FetchResult RangedDownload::fetchSegment(size_t index, const RangeFetcher& fetcher) {
+    size_t offset;
+    size_t length;
+    size_t downloaded;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        const auto& segment = m_segments[index];
+        if (!segment.digest.empty()) {
+            return FetchResult::SUCCESS;
+        }
+        offset = segment.offset;
+        length = segment.length;
+        downloaded = segment.downloaded;
+    }
+
+    auto ctx = newDigest();
+    if (ctx == nullptr) {
+        ACSDK_ERROR(LX("fetchSegment").m("Failed to create digest"));
+        return FetchResult::FAILED;
+    }
+    // the digest of a resumed range has to cover what an earlier attempt already wrote
+    if (downloaded > 0 && !digestFileRange(m_partialPath, offset, downloaded, ctx.get())) {
+        ACSDK_WARN(LX("fetchSegment").m("Failed to read back the range, fetching it again").d("offset", offset));
+        m_downloadedBytes -= downloaded;
+        downloaded = 0;
+        ctx = newDigest();
+        if (ctx == nullptr) {
+            return FetchResult::FAILED;
+        }
+    }
+
+    FileDescriptor file(::open(m_partialPath.c_str(), O_WRONLY));
+    if (file.get() < 0) {
+        ACSDK_ERROR(LX("fetchSegment").m("Failed to open partial file").d("path", m_partialPath));
+        return FetchResult::FAILED;
+    }
+
+    size_t sinceCheckpoint = 0;
+    auto onData = [&](const char* data, size_t size) -> bool {
+        if (m_stop) {
+            return false;
+        }
+        if (size > length - downloaded) {
+            ACSDK_ERROR(LX("fetchSegment").m("Received more data than requested").d("offset", offset));
+            return false;
+        }
+        if (!writeAt(file.get(), data, size, offset + downloaded) || EVP_DigestUpdate(ctx.get(), data, size) != 1) {
+            return false;
+        }
+        downloaded += size;
+        m_downloadedBytes += size;
+        sinceCheckpoint += size;
+        if (sinceCheckpoint >= CHECKPOINT_BYTES) {
+            // the data has to reach the device before the state claims it has been downloaded, otherwise a resume
+            // after a power loss would trust whatever the file holds there
+            if (::fsync(file.get()) != 0) {
+                return false;
+            }
+            lock_guard<mutex> lock(m_mutex);
+            m_segments[index].downloaded = downloaded;
+            saveStateLocked();
+            sinceCheckpoint = 0;
+        }
+        return true;
+    };
+
+    auto result = fetcher(offset + downloaded, length - downloaded, onData);
+    auto fileGood = ::fsync(file.get()) == 0;
+
+    lock_guard<mutex> lock(m_mutex);
+    auto& segment = m_segments[index];
+    if (fileGood) {
+        segment.downloaded = downloaded;
+    }
+    if (result == FetchResult::SUCCESS) {
+        if (!fileGood || downloaded != length) {
+            ACSDK_ERROR(LX("fetchSegment")
+                                .m("Range is incomplete")
+                                .d("offset", offset)
+                                .d("downloaded", downloaded)
+                                .d("length", length));
+            result = FetchResult::FAILED;
+        } else {
+            segment.digest = finalizeDigest(ctx.get());
+            if (segment.digest.empty()) {
+                result = FetchResult::FAILED;
+            }
+        }
+    }
+    saveStateLocked();
+    return result;
+}
+
+bool RangedDownload::hashFileRange(size_t offset, size_t length, string& digest) const {
+    auto ctx = newDigest();
+    if (ctx == nullptr || !digestFileRange(m_partialPath, offset, length, ctx.get())) {
+        return false;
+    }
+    digest = finalizeDigest(ctx.get());
+    return !digest.empty();
+}
+
+ResultCode RangedDownload::run(const RangeFetcher& fetcher) {
+    if (!fetcher) {
+        ACSDK_ERROR(LX("run").m("Null fetcher"));
+        return ResultCode::CATASTROPHIC_FAILURE;
+    }
+    m_stop = false;
+    m_rangesUnsupported = false;
+
+    vector<size_t> pending;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        for (size_t i = 0; i < m_segments.size(); ++i) {
+            if (m_segments[i].digest.empty()) {
+                pending.push_back(i);
+            }
+        }
+    }
+
+    atomic<size_t> next{0};
+    mutex resultMutex;
+    auto overall = FetchResult::SUCCESS;
+    auto worker = [&] {
+        while (!m_stop) {
+            auto position = next++;
+            if (position >= pending.size()) {
+                return;
+            }
+            auto result = fetchSegment(pending[position], fetcher);
+            if (result == FetchResult::SUCCESS) {
+                continue;
+            }
+            lock_guard<mutex> lock(resultMutex);
+            if (overall == FetchResult::SUCCESS || overall == FetchResult::FAILED) {
+                overall = result;
+            }
+            // a dropped connection only affects its own range, the others keep going so less is left to resume
+            if (result != FetchResult::FAILED) {
+                m_stop = true;
+            }
+        }
+    };
+
+    // the calling thread fetches ranges as well
+    vector<thread> workers;
+    auto connections = min(m_maxConnections, pending.size());
+    for (size_t i = 1; i < connections; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    switch (overall) {
+        case FetchResult::SUCCESS:
+            break;
+        case FetchResult::RANGES_UNSUPPORTED:
+            ACSDK_WARN(LX("run").m("Server does not support range requests").d("path", m_path));
+            m_rangesUnsupported = true;
+            return ResultCode::CONNECTION_FAILED;
+        case FetchResult::FAILED:
+            ACSDK_WARN(LX("run")
+                               .m("Download interrupted, it can be resumed")
+                               .d("path", m_path)
+                               .d("downloaded", m_downloadedBytes.load())
+                               .d("size", m_size));
+            s_metrics().addCounter("interrupted");
+            return ResultCode::CONNECTION_FAILED;
+        case FetchResult::CANCELLED:
+            ACSDK_INFO(LX("run").m("Download cancelled").d("path", m_path));
+            return ResultCode::CATASTROPHIC_FAILURE;
+    }
+
+    // make sure what is on disk is what was received before handing out the file, every range that does not match
+    // is fetched again by the next run
+    lock_guard<mutex> lock(m_mutex);
+    size_t failedSegments = 0;
+    for (auto& segment : m_segments) {
+        string digest;
+        if (!hashFileRange(segment.offset, segment.length, digest) || digest != segment.digest) {
+            ACSDK_ERROR(LX("run").m("Range failed verification").d("path", m_path).d("offset", segment.offset));
+            m_downloadedBytes -= segment.downloaded;
+            segment.downloaded = 0;
+            segment.digest.clear();
+            failedSegments++;
+        }
+    }
+    if (failedSegments > 0) {
+        s_metrics().addCounter(METRIC_PREFIX_ERROR("segmentVerificationFailed"), static_cast<int>(failedSegments));
+        saveStateLocked();
+        return ResultCode::CHECKSUM_MISMATCH;
+    }
+
+    if (!filesystem::move(m_partialPath, m_path)) {
+        ACSDK_ERROR(LX("run").m("Failed to move downloaded file").d("path", m_path));
+        return ResultCode::CATASTROPHIC_FAILURE;
+    }
+    filesystem::removeAll(m_statePath);
+    s_metrics().addCounter("segments", static_cast<int>(m_segments.size()));
+    return ResultCode::SUCCESS;
+}
+
+bool RangedDownload::rangesUnsupported() const {
+    return m_rangesUnsupported;
+}
+
+size_t RangedDownload::getDownloadedBytes() const {
+    return m_downloadedBytes;
+}
+
+size_t RangedDownload::getSegmentCount() const {
+    lock_guard<mutex> lock(m_mutex);
+    return m_segments.size();
+}
+
+}  // namespace common
+}  // namespace acsdkAssets
+}  // namespace alexaClientSDK
@@ -152,6 +152,8 @@ bool ResponseSink::parser(std::shared_ptr<DownloadChunkQueue>& downloadChunkQueu
         parser.feed(dataChunk->data(), dataChunk->size());
         if (parser.hasError()) {
             ACSDK_ERROR(LX("parser").m("Multipart Parser Error").d("error message", parser.getErrorMessage()));
+            // release the download, which may be waiting for room in the queue
+            downloadChunkQueue->popComplete(false);
             return false;
         }
         dataChunk = downloadChunkQueue->waitAndPop();
@@ -15,11 +15,15 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <future>
 #include <memory>
+#include <thread>
 
 #include "acsdkAssetsCommon/DownloadChunkQueue.h"
 
 using namespace std;
+using namespace std::chrono;
 using namespace alexaClientSDK::acsdkAssets::common;
 
 class DownloadChunkQueueTest : public ::testing::Test {
@@ -143,4 +147,44 @@ TEST_F(DownloadChunkQueueTest, pushAfterPopAbort) {
     ASSERT_FALSE(queue->popComplete(false));
     ASSERT_FALSE(queue->push(data, 1));
     ASSERT_EQ(1u, queue->size());
-}
\ No newline at end of file
+}
+
+TEST_F(DownloadChunkQueueTest, boundedPushWaitsForPop) {
+    char data[16] = {0};
+    shared_ptr<DownloadChunkQueue> queue(new DownloadChunkQueue(3, 2));
+    ASSERT_TRUE(queue->push(data, 1));
+    ASSERT_TRUE(queue->push(data, 1));
+
+    promise<bool> pushed;
+    auto pushedFuture = pushed.get_future();
+    thread producer([&] { pushed.set_value(queue->push(data, 1)); });
+
+    // the producer thread must be joined, so nothing may return early until then
+    EXPECT_EQ(future_status::timeout, pushedFuture.wait_for(milliseconds(100)));
+    EXPECT_EQ(2u, queue->size());
+    EXPECT_TRUE(nullptr != queue->waitAndPop());
+    EXPECT_EQ(future_status::ready, pushedFuture.wait_for(seconds(5)));
+    producer.join();
+    ASSERT_TRUE(pushedFuture.get());
+
+    ASSERT_EQ(2u, queue->size());
+    ASSERT_TRUE(queue->pushComplete(true));
+}
+
+TEST_F(DownloadChunkQueueTest, boundedPushFailsOnPopAbort) {
+    char data[16] = {0};
+    shared_ptr<DownloadChunkQueue> queue(new DownloadChunkQueue(0, 1));
+    ASSERT_TRUE(queue->push(data, 1));
+
+    promise<bool> pushed;
+    auto pushedFuture = pushed.get_future();
+    thread producer([&] { pushed.set_value(queue->push(data, 1)); });
+
+    // the producer thread must be joined, so nothing may return early until then
+    EXPECT_EQ(future_status::timeout, pushedFuture.wait_for(milliseconds(100)));
+    EXPECT_FALSE(queue->popComplete(false));
+    EXPECT_EQ(future_status::ready, pushedFuture.wait_for(seconds(5)));
+    producer.join();
+    ASSERT_FALSE(pushedFuture.get());
+    ASSERT_EQ(1u, queue->size());
+}
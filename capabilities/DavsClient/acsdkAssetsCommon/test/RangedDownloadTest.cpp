@@ -0,0 +1,222 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AVSCommon/Utils/FileSystem/FileSystemUtils.h>
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <sstream>
+
+#include "TestUtil.h"
+#include "acsdkAssetsCommon/RangedDownload.h"
+
+using namespace std;
+using namespace alexaClientSDK::acsdkAssets::common;
+using namespace alexaClientSDK::acsdkAssets::commonInterfaces;
+using namespace alexaClientSDK::avsCommon::utils;
+
+using FetchResult = RangedDownload::FetchResult;
+
+static constexpr size_t CONTENT_SIZE = 10000;
+static constexpr size_t SEGMENT_SIZE = 1000;
+static constexpr size_t CHUNK_SIZE = 300;
+
+class RangedDownloadTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        testDir = createTmpDir("ranged");
+        statePrefix = testDir + "/artifact";
+        path = testDir + "/artifact.bin";
+        for (size_t i = 0; i < CONTENT_SIZE; ++i) {
+            content.push_back(static_cast<char>('a' + i % 26));
+        }
+    }
+
+    void TearDown() override {
+        filesystem::removeAll(testDir);
+    }
+
+    /// Serves ranges of the content in chunks and records the requested offsets.
+    RangedDownload::RangeFetcher serve() {
+        return [this](size_t offset, size_t length, const RangedDownload::DataCallback& onData) {
+            {
+                lock_guard<mutex> lock(requestsMutex);
+                requestedOffsets.insert(offset);
+            }
+            return sendRange(offset, length, length, onData);
+        };
+    }
+
+    FetchResult sendRange(size_t offset, size_t length, size_t toSend, const RangedDownload::DataCallback& onData) {
+        for (size_t sent = 0; sent < toSend;) {
+            auto size = min(CHUNK_SIZE, toSend - sent);
+            if (!onData(content.data() + offset + sent, size)) {
+                return FetchResult::FAILED;
+            }
+            sent += size;
+        }
+        return toSend == length ? FetchResult::SUCCESS : FetchResult::FAILED;
+    }
+
+    string readFile(const string& file) {
+        ifstream stream(file, ios::binary);
+        stringstream data;
+        data << stream.rdbuf();
+        return data.str();
+    }
+
+    string testDir;
+    string statePrefix;
+    string path;
+    string content;
+    mutex requestsMutex;
+    set<size_t> requestedOffsets;
+};
+
+TEST_F(RangedDownloadTest, createWithInvalidParameters) {
+    ASSERT_EQ(RangedDownload::create("", path, CONTENT_SIZE, 4), nullptr);
+    ASSERT_EQ(RangedDownload::create(statePrefix, "", CONTENT_SIZE, 4), nullptr);
+    ASSERT_EQ(RangedDownload::create(statePrefix, path, 0, 4), nullptr);
+    ASSERT_EQ(RangedDownload::create(statePrefix, path, CONTENT_SIZE, 0), nullptr);
+}
+
+TEST_F(RangedDownloadTest, downloadsRangesConcurrently) {
+    auto download = RangedDownload::create(statePrefix, path, CONTENT_SIZE, 4, SEGMENT_SIZE);
+    ASSERT_NE(download, nullptr);
+    ASSERT_EQ(download->getSegmentCount(), 4u);
+
+    ASSERT_EQ(download->run(serve()), ResultCode::SUCCESS);
+    ASSERT_EQ(readFile(path), content);
+    ASSERT_EQ(requestedOffsets, (set<size_t>{0, 2500, 5000, 7500}));
+    ASSERT_EQ(download->getDownloadedBytes(), CONTENT_SIZE);
+    ASSERT_FALSE(filesystem::exists(statePrefix + ".partial"));
+    ASSERT_FALSE(filesystem::exists(statePrefix + ".segments"));
+}
+
+TEST_F(RangedDownloadTest, smallDownloadUsesSingleRange) {
+    auto download = RangedDownload::create(statePrefix, path, CONTENT_SIZE, 4, CONTENT_SIZE);
+    ASSERT_NE(download, nullptr);
+    ASSERT_EQ(download->getSegmentCount(), 1u);
+    ASSERT_EQ(download->run(serve()), ResultCode::SUCCESS);
+    ASSERT_EQ(readFile(path), content);
+}
+
+TEST_F(RangedDownloadTest, resumesAfterRestart) {
+    {
+        auto download = RangedDownload::create(statePrefix, path, CONTENT_SIZE, 4, SEGMENT_SIZE);
+        ASSERT_NE(download, nullptr);
+        // the connection for the second range drops after 1000 bytes
+        auto dropping = [this](size_t offset, size_t length, const RangedDownload::DataCallback& onData) {
+            return sendRange(offset, length, offset == 2500 ? 1000 : length, onData);
+        };
+        ASSERT_EQ(download->run(dropping), ResultCode::CONNECTION_FAILED);
+        ASSERT_FALSE(filesystem::exists(path));
+    }
+
+    // a new object stands in for the process after a restart
+    auto download = RangedDownload::create(statePrefix, path, CONTENT_SIZE, 4, SEGMENT_SIZE);
+    ASSERT_NE(download, nullptr);
+    ASSERT_EQ(download->getSegmentCount(), 4u);
+    ASSERT_GT(download->getDownloadedBytes(), 7500u);
+
+    ASSERT_EQ(download->run(serve()), ResultCode::SUCCESS);
+    ASSERT_EQ(readFile(path), content);
+    // only the missing part of the interrupted range is fetched again
+    ASSERT_EQ(requestedOffsets.size(), 1u);
+    ASSERT_GT(*requestedOffsets.begin(), 2500u);
+}
+
+TEST_F(RangedDownloadTest, corruptedRangeIsFetchedAgain) {
+    auto download = RangedDownload::create(statePrefix, path, CONTENT_SIZE, 4, SEGMENT_SIZE);
+    ASSERT_NE(download, nullptr);
+    auto failing = [this](size_t offset, size_t length, const RangedDownload::DataCallback& onData) {
+        return offset == 7500 ? FetchResult::FAILED : sendRange(offset, length, length, onData);
+    };
+    ASSERT_EQ(download->run(failing), ResultCode::CONNECTION_FAILED);
+
+    // damage a range that was already completed
+    {
+        fstream partial(statePrefix + ".partial", ios::in | ios::out | ios::binary);
+        partial.seekp(10);
+        partial.write("XYZ", 3);
+    }
+
+    ASSERT_EQ(download->run(serve()), ResultCode::CHECKSUM_MISMATCH);
+    requestedOffsets.clear();
+    ASSERT_EQ(download->run(serve()), ResultCode::SUCCESS);
+    ASSERT_EQ(requestedOffsets, (set<size_t>{0}));
+    ASSERT_EQ(readFile(path), content);
+}
+
+TEST_F(RangedDownloadTest, everyCorruptedRangeIsFetchedAgain) {
+    auto download = RangedDownload::create(statePrefix, path, CONTENT_SIZE, 4, SEGMENT_SIZE);
+    ASSERT_NE(download, nullptr);
+    auto failing = [this](size_t offset, size_t length, const RangedDownload::DataCallback& onData) {
+        return offset == 7500 ? FetchResult::FAILED : sendRange(offset, length, length, onData);
+    };
+    ASSERT_EQ(download->run(failing), ResultCode::CONNECTION_FAILED);
+
+    // damage two ranges that were already completed
+    {
+        fstream partial(statePrefix + ".partial", ios::in | ios::out | ios::binary);
+        partial.seekp(10);
+        partial.write("XYZ", 3);
+        partial.seekp(5010);
+        partial.write("XYZ", 3);
+    }
+
+    ASSERT_EQ(download->run(serve()), ResultCode::CHECKSUM_MISMATCH);
+    requestedOffsets.clear();
+    ASSERT_EQ(download->run(serve()), ResultCode::SUCCESS);
+    ASSERT_EQ(requestedOffsets, (set<size_t>{0, 5000}));
+    ASSERT_EQ(readFile(path), content);
+}
+
+TEST_F(RangedDownloadTest, rangesUnsupported) {
+    auto download = RangedDownload::create(statePrefix, path, CONTENT_SIZE, 4, SEGMENT_SIZE);
+    ASSERT_NE(download, nullptr);
+    auto unsupported = [](size_t, size_t, const RangedDownload::DataCallback&) {
+        return FetchResult::RANGES_UNSUPPORTED;
+    };
+    ASSERT_EQ(download->run(unsupported), ResultCode::CONNECTION_FAILED);
+    ASSERT_TRUE(download->rangesUnsupported());
+    ASSERT_FALSE(filesystem::exists(path));
+}
+
+TEST_F(RangedDownloadTest, cancelled) {
+    auto download = RangedDownload::create(statePrefix, path, CONTENT_SIZE, 4, SEGMENT_SIZE);
+    ASSERT_NE(download, nullptr);
+    auto cancelling = [](size_t, size_t, const RangedDownload::DataCallback&) { return FetchResult::CANCELLED; };
+    ASSERT_EQ(download->run(cancelling), ResultCode::CATASTROPHIC_FAILURE);
+    ASSERT_FALSE(download->rangesUnsupported());
+    ASSERT_FALSE(filesystem::exists(path));
+}
+
+TEST_F(RangedDownloadTest, stateOfDifferentDownloadIsDiscarded) {
+    {
+        auto download = RangedDownload::create(statePrefix, path, CONTENT_SIZE / 2, 2, SEGMENT_SIZE);
+        ASSERT_NE(download, nullptr);
+        auto failing = [](size_t, size_t, const RangedDownload::DataCallback&) { return FetchResult::FAILED; };
+        ASSERT_EQ(download->run(failing), ResultCode::CONNECTION_FAILED);
+    }
+
+    auto download = RangedDownload::create(statePrefix, path, CONTENT_SIZE, 4, SEGMENT_SIZE);
+    ASSERT_NE(download, nullptr);
+    ASSERT_EQ(download->getDownloadedBytes(), 0u);
+    ASSERT_EQ(download->run(serve()), ResultCode::SUCCESS);
+    ASSERT_EQ(readFile(path), content);
+}
@@ -138,6 +138,9 @@ public:
      */
     static std::string parseFileFromLink(const std::string& url, const std::string& defaultValue);
 
+    /// Name of the directory, inside the working directory, that keeps partial downloads across restarts.
+    static const std::string PARTIAL_DOWNLOADS_DIRECTORY;
+
     bool isThrottled() const;
 
     void setThrottled(bool throttle);
@@ -229,6 +232,13 @@ private:
         return m_workingDirectory + "/" + m_artifactRequest->getSummary();
     }
 
+    /**
+     * @return the directory keeping the partial downloads of this request, which survives a restart
+     */
+    inline std::string getPartialDownloadDirectory() const {
+        return m_workingDirectory + "/" + PARTIAL_DOWNLOADS_DIRECTORY + "/" + m_artifactRequest->getSummary();
+    }
+
     inline std::shared_ptr<davsInterfaces::DavsCheckCallbackInterface> getChecker() {
         auto checker = m_checkRequester.lock();
         if (checker == nullptr) {
@@ -84,7 +84,12 @@ shared_ptr<DavsClient> DavsClient::create(
         return nullptr;
     }
 
-    filesystem::removeAll(workingDirectory);
+    // everything but the partial downloads is stale, those are kept so that interrupted downloads can resume
+    for (const auto& entry : filesystem::list(workingDirectory)) {
+        if (entry != DavsHandler::PARTIAL_DOWNLOADS_DIRECTORY) {
+            filesystem::removeAll(workingDirectory + "/" + entry);
+        }
+    }
     if (!filesystem::makeDirectory(workingDirectory)) {
         ACSDK_CRITICAL(LX("create").m("Failed to create working directory"));
         return nullptr;
@@ -45,6 +45,9 @@ using namespace alexaClientSDK::avsCommon::sdkInterfaces;
 
 static const float JITTER_FACTOR = 0.3;
 
+/// Artifacts of at least this size are downloaded as concurrent ranges that can be resumed.
+static constexpr size_t RANGED_DOWNLOAD_MIN_SIZE = 1024 * 1024;
+
 #if UNIT_TEST == 1
 // For tests, because we don't want to wait hours for it to finish...
 static constexpr auto MIN_UPDATE_INTERVAL = milliseconds(10);
@@ -144,6 +147,8 @@ shared_ptr<DavsHandler> DavsHandler::create(
             max(seconds::zero(), forcedUpdateInterval)));
 }
 
+const string DavsHandler::PARTIAL_DOWNLOADS_DIRECTORY = "partialDownloads";
+
 DavsHandler::DavsHandler(
         shared_ptr<DavsRequest> artifactRequest,
         const shared_ptr<DavsDownloadCallbackInterface>& downloadRequester,
@@ -273,7 +278,7 @@ void DavsHandler::runner(bool isUserInitiated) {
     auto artifactSize = artifact->getArtifactSizeBytes();
     if (m_unpack) {
         // Attempt to free up 1.5x the compressed file to ensure that we have enough space for the data.
-        artifactSize *= 3 / 2;
+        artifactSize = artifactSize * 3 / 2;
     }
     auto spaceNeeded = availableSpace > artifactSize ? 0 : artifactSize - availableSpace;
 
@@ -529,11 +534,34 @@ ResultCode DavsHandler::downloadArtifact(
         return ResultCode::ILLEGAL_ARGUMENT;
     }
 
+    ResultCode downloadResult;
     if (m_unpack) {
         filesystem::makeDirectory(path);
+        downloadResult = wrapper->download(
+                artifact->getS3Url(), path, shared_from_this(), m_unpack, artifact->getArtifactSizeBytes());
+    } else if (artifact->getArtifactSizeBytes() >= RANGED_DOWNLOAD_MIN_SIZE) {
+        auto partialDirectory = getPartialDownloadDirectory();
+        auto partialName = artifact->getUniqueIdentifier();
+        filesystem::makeDirectory(partialDirectory);
+        // only the latest artifact of a request is worth resuming
+        for (const auto& entry : filesystem::list(partialDirectory)) {
+            if (entry.compare(0, partialName.size() + 1, partialName + ".") != 0) {
+                filesystem::removeAll(partialDirectory + "/" + entry);
+            }
+        }
+        downloadResult = wrapper->downloadRanged(
+                artifact->getS3Url(),
+                path,
+                partialDirectory + "/" + partialName,
+                shared_from_this(),
+                artifact->getArtifactSizeBytes());
+        if (downloadResult == ResultCode::SUCCESS) {
+            filesystem::removeAll(partialDirectory);
+        }
+    } else {
+        downloadResult = wrapper->download(
+                artifact->getS3Url(), path, shared_from_this(), m_unpack, artifact->getArtifactSizeBytes());
     }
-    auto downloadResult = wrapper->download(
-            artifact->getS3Url(), path, shared_from_this(), m_unpack, artifact->getArtifactSizeBytes());
 
     if (downloadResult != ResultCode::SUCCESS) {
         s_metrics().addCounter(METRIC_PREFIX_ERROR("downloadArtifactFailed"));
@@ -9,6 +9,11 @@
 #     -DACSDK_DEBUG_LOG=ON
 # Note: This is enabled by default for DEBUG build types
 #
+# To compile out log lines below a minimum severity, include the following option on the cmake command line:
+#     -DACSDK_LOG_MIN_LEVEL=<DEBUG9|DEBUG8|...|DEBUG0|INFO|WARN|ERROR|CRITICAL|NONE>
+# Note: This defaults to DEBUG9, which keeps all log lines.  Log lines below this level generate no code, regardless
+# of the log level configured at runtime.
+#
 # To enable logging of sensitive data, include the following option on the cmake command line:
 #     -DACSDK_EMIT_SENSITIVE_LOGS=ON
 # Note that this option is only honored in DEBUG builds.
@@ -23,6 +28,16 @@ option(ACSDK_LOG "Enabled logging within the SDK" OFF)
 option(ACSDK_DEBUG_LOG "Enables logging of DEBUG level logs" OFF)
 option(ACSDK_EMIT_SENSITIVE_LOGS "Enable Logging of sensitive information." OFF)
 option(ACSDK_LOGS_KEEP_FUNC_MACRO "Keep __func__ macro if defined." OFF)
+set(ACSDK_LOG_MIN_LEVEL "DEBUG9" CACHE STRING "Lowest severity of log lines compiled into the SDK.")
+
+# Must be in the same order as the logger::Level enum.
+set(ACSDK_LOG_LEVELS DEBUG9 DEBUG8 DEBUG7 DEBUG6 DEBUG5 DEBUG4 DEBUG3 DEBUG2 DEBUG1 DEBUG0 INFO WARN ERROR CRITICAL NONE)
+set_property(CACHE ACSDK_LOG_MIN_LEVEL PROPERTY STRINGS ${ACSDK_LOG_LEVELS})
+list(FIND ACSDK_LOG_LEVELS "${ACSDK_LOG_MIN_LEVEL}" ACSDK_LOG_MIN_LEVEL_VALUE)
+if (ACSDK_LOG_MIN_LEVEL_VALUE EQUAL -1)
+    message(FATAL_ERROR "FATAL_ERROR: Invalid ACSDK_LOG_MIN_LEVEL=${ACSDK_LOG_MIN_LEVEL}, expected one of ${ACSDK_LOG_LEVELS}.")
+endif()
+# ACSDK_LOG_MIN_LEVEL_VALUE is written to the installed SDKConfig.h, so that clients compile out the same log lines.
 
 if (ACSDK_EMIT_SENSITIVE_LOGS)
     string(TOUPPER ${CMAKE_BUILD_TYPE} BUILD_TYPE_UPPER)
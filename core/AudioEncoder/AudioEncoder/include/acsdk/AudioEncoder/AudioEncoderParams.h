@@ -66,6 +66,18 @@ struct AudioEncoderParams {
      */
     std::size_t maxOutputStreamBufferedPackets;
 
+    /**
+     * @brief The maximum number of frames encoded per read from the input stream.
+     *
+     * When the input stream has more than one frame available, for example when encoding starts from audio which was
+     * captured before the wake word, audio encoder encodes up to this many frames directly from the input stream and
+     * writes them to the output stream at once. Zero selects @c DEFAULT_MAX_FRAMES_PER_BATCH.
+     */
+    std::size_t maxFramesPerBatch;
+
+    /// Default value for @c maxFramesPerBatch.
+    static constexpr std::size_t DEFAULT_MAX_FRAMES_PER_BATCH = 5;
+
 // GCC 4.x and 5.x reached end of support before some of c++11 amendments were made. In particular, these compilers
 // do not have default constructors for list initialization from aggregates. This issue has been addressed in GCC 6.x.
 // http://www.open-std.org/jtc1/sc22/wg21/docs/cwg_defects.html#1467
@@ -91,6 +103,7 @@ struct AudioEncoderParams {
      * @param[in] stopTimeoutMs                  Timeout for graceful stop operation.
      * @param[in] maxOutputStreamReaders         The maximum number of readers of the output stream.
      * @param[in] maxOutputStreamBufferedPackets The maximum number of packets to be buffered to the output stream.
+     * @param[in] maxFramesPerBatch              The maximum number of frames encoded per read from the input stream.
      *
      * @see http://www.open-std.org/jtc1/sc22/wg21/docs/cwg_defects.html#1467
      */
@@ -99,7 +112,8 @@ struct AudioEncoderParams {
         std::chrono::milliseconds writeTimeoutMs,
         std::chrono::milliseconds stopTimeoutMs,
         std::size_t maxOutputStreamReaders,
-        std::size_t maxOutputStreamBufferedPackets);
+        std::size_t maxOutputStreamBufferedPackets,
+        std::size_t maxFramesPerBatch = DEFAULT_MAX_FRAMES_PER_BATCH);
 #endif
 };
 
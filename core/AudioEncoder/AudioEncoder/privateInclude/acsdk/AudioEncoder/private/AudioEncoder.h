@@ -80,6 +80,11 @@ private:
      */
     using Bytes = audioEncoderInterfaces::BlockAudioEncoderInterface::Bytes;
 
+    /**
+     * @brief Byte data type.
+     */
+    using Byte = audioEncoderInterfaces::BlockAudioEncoderInterface::Byte;
+
     /**
      * Thread loop
      */
@@ -123,42 +128,42 @@ private:
     bool mayFinishEncoding();
 
     /**
-     * @brief Check if encoder needs to read more data from input stream.
+     * @brief Read audio data from input stream and encode it.
      *
-     * If @a m_encoder requires full frame for processing, this method checks if the amount of data accumulated in
-     * @a m_inputBuffer equal to frame size. If @a m_encoder doesn't require full frame, this method checks if @a
-     * m_inputBuffer has at least one word.
+     * This method reads up to a batch of frames from input stream and encodes every complete frame directly out of the
+     * input stream buffer into @a m_outputBuffer. Incomplete frames are kept in @a m_inputBuffer until the rest of the
+     * frame is read. The method retries until some data has been read, or until there is no more data, or an error
+     * occurred.
      *
-     * @return True if there is not enough data to invoke audio encoder. False if there is enough data for audio
-     *         encoding.
+     * @return True if data has been read, False if end of stream has been reached, encoding has been terminated, or
+     *         error occurred.
+     *
+     * @see #writeEncodedWordsFromOutput()
      */
-    bool needReadMoreWordsFromInput();
+    bool readAndEncodeFromInput();
 
     /**
-     * @brief Read audio data from input stream.
+     * @brief Encode a contiguous region of the input stream.
      *
-     * This method reads audio data from input stream until there is enough data for audio encoding, or until there is
-     * no more data, or an error occurred.
+     * This method is called by the input stream reader with a region of its buffer. It completes the frame buffered in
+     * @a m_inputBuffer first, then encodes the complete frames of the region in place, and buffers what is left.
      *
-     * @return True if there is enough data for audio encoding, False if end of stream has been reached, or error
-     *         occurred.
+     * @param[in] data   The region of the input stream buffer.
+     * @param[in] nWords The number of words in the region.
      *
-     * @see #encodeWordsIntoOutput()
+     * @return True if the region has been consumed, False if encoding failed.
      */
-    bool readWordsFromInput();
+    bool encodeFromInput(const Byte* data, std::size_t nWords);
 
     /**
-     * @brief Encode buffered data.
+     * @brief Encode one frame.
      *
-     * This method encodes data from @a m_inputBuffer into @a m_outputBuffer. The method appends encoded data into
-     * m_outputBuffer, as it may have incomplete word left from a previous write operation.
+     * @param[in] begin Pointer to the first byte of the frame.
+     * @param[in] end   Pointer past the last byte of the frame.
      *
-     * @return True if data has been encoded, false if operation has been terminated or there is an error.
-     *
-     * @see #readWordsFromInput()
-     * @see #writeEncodedWordsFromOutput()
+     * @return True if the frame has been encoded into @a m_outputBuffer.
      */
-    bool encodeWordsIntoOutput();
+    bool encodeFrame(const Byte* begin, const Byte* end);
 
     /**
      * @brief Write encoded data into output stream.
@@ -208,6 +213,9 @@ private:
     /// Maximum single encoded frame size (words) initialized from EncoderContext
     size_t m_maxInputFrameSizeWords;
 
+    /// Maximum number of words read from the input stream at once.
+    size_t m_maxBatchSizeWords;
+
     /// Maximum output frame size (bytes) initialized from EncoderContext
     size_t m_maxOutputFrameSizeBytes;
 
@@ -239,9 +247,15 @@ private:
     /// Input word size in bytes initialized from input stream.
     std::size_t m_inputWordSizeBytes;
 
-    /// @brief Buffer for reading data from input stream.
+    /// Reads from @a #m_inputStreamReader into @a #encodeFromInput(), created once to keep reads allocation free.
+    avsCommon::avs::AudioInputStream::Reader::OutputFunction m_encodeFunction;
+
+    /// Whether @a #encodeFromInput() failed during the last read.
+    bool m_encodeFailed;
+
+    /// @brief Buffer for an incomplete frame read from input stream.
     ///
-    /// This buffer must be sufficient to hold
+    /// Complete frames are encoded directly from the input stream buffer, so this buffer holds at most one frame.
     Bytes m_inputBuffer;
 
     /// @brief Number of words in @a m_inputBuffer.
@@ -13,9 +13,11 @@
  * permissions and limitations under the License.
  */
 
-#include <iostream>
+#include <algorithm>
 #include <climits>
+#include <cstring>
 #include <fstream>
+#include <iostream>
 
 #include <acsdk/AudioEncoder/private/AudioEncoder.h>
 #include <AVSCommon/Utils/Error/FinallyGuard.h>
@@ -47,8 +49,12 @@ AudioEncoder::AudioEncoder(
         m_params{params},
         m_executor{},
         m_state{AudioEncoderState::IDLE},
+        m_encodeFailed{false},
         m_wordsInInputBuffer{0} {
     m_timeoutTimePoint = Clock::time_point();
+    m_encodeFunction = [this](void* buf, size_t nWords) {
+        return encodeFromInput(static_cast<const Byte*>(buf), nWords);
+    };
 }
 
 AudioEncoder::~AudioEncoder() {
@@ -91,6 +97,9 @@ std::shared_ptr<AudioInputStream> AudioEncoder::startEncoding(
 
     m_requireFullFrameSize = m_encoder->requiresFullyRead();
     m_maxInputFrameSizeWords = m_encoder->getInputFrameSize();
+    const auto framesPerBatch =
+        m_params.maxFramesPerBatch ? m_params.maxFramesPerBatch : AudioEncoderParams::DEFAULT_MAX_FRAMES_PER_BATCH;
+    m_maxBatchSizeWords = m_maxInputFrameSizeWords * framesPerBatch;
     m_maxOutputFrameSizeBytes = m_encoder->getOutputFrameSize();
     m_outputWordSizeBytes = m_encoder->getAudioFormat().sampleSizeInBits / CHAR_BIT;
     m_outputBufferSizeBytes = AudioInputStream::calculateBufferSize(
@@ -104,7 +113,8 @@ std::shared_ptr<AudioInputStream> AudioEncoder::startEncoding(
     m_wordsInInputBuffer = 0;
     m_inputBuffer.resize(m_maxInputFrameSizeWords * m_inputWordSizeBytes);
     m_outputBuffer.clear();
-    m_outputBuffer.reserve(m_maxOutputFrameSizeBytes + m_outputWordSizeBytes);
+    // A batch which wraps around the input stream buffer may be split into one more frame than the batch size.
+    m_outputBuffer.reserve(m_maxOutputFrameSizeBytes * (framesPerBatch + 1) + m_outputWordSizeBytes);
 
     auto buffer = std::make_shared<AudioInputStream::Buffer>(m_outputBufferSizeBytes);
     m_outputStream = AudioInputStream::create(buffer, m_outputWordSizeBytes, m_params.maxOutputStreamReaders);
@@ -197,7 +207,7 @@ void AudioEncoder::encodeLoop(AudioInputStream::Index begin, AudioInputStream::R
         return;
     }
 
-    while (readWordsFromInput() && encodeWordsIntoOutput() && writeEncodedWordsFromOutput())
+    while (readAndEncodeFromInput() && writeEncodedWordsFromOutput())
         ;
 
     if (mayFinishEncoding()) {
@@ -229,14 +239,6 @@ void AudioEncoder::setErrorState() {
     m_state = AudioEncoderState::ENCODING_ERROR;
 }
 
-bool AudioEncoder::needReadMoreWordsFromInput() {
-    if (m_requireFullFrameSize) {
-        return m_wordsInInputBuffer < m_maxInputFrameSizeWords;
-    } else {
-        return !m_wordsInInputBuffer;
-    }
-}
-
 bool AudioEncoder::mayProcessNextFrame() {
     std::lock_guard<std::mutex> lock{m_mutex};
     switch (m_state.load()) {
@@ -291,8 +293,8 @@ bool AudioEncoder::mayFinishEncoding() {
     }
 }
 
-bool AudioEncoder::readWordsFromInput() {
-    while (needReadMoreWordsFromInput()) {
+bool AudioEncoder::readAndEncodeFromInput() {
+    while (true) {
         bool mayContinue;
         if (m_wordsInInputBuffer) {
             mayContinue = mayContinueEncoding();
@@ -303,52 +305,86 @@ bool AudioEncoder::readWordsFromInput() {
             return false;
         }
 
+        // Never read more than completes a batch, so the encoded batch fits in the output buffer.
+        m_encodeFailed = false;
         auto readResult = m_inputStreamReader->read(
-            m_inputBuffer.data() + m_wordsInInputBuffer * m_inputWordSizeBytes,
-            m_maxInputFrameSizeWords - m_wordsInInputBuffer,
-            m_params.readTimeoutMs);
-        if (readResult <= 0) {
-            switch (readResult) {
-                case AudioInputStream::Reader::Error::WOULDBLOCK:
-                case AudioInputStream::Reader::Error::TIMEDOUT:
-                    // Ignore and retry
-                    continue;
-                case AudioInputStream::Reader::Error::CLOSED:
-                    // End of input stream
-                    ACSDK_DEBUG7(LX("readWordsFromInput").m("endOfStream"));
-                    return false;
-                case AudioInputStream::Reader::Error::OVERRUN:
-                case AudioInputStream::Reader::Error::INVALID:
-                default:
-                    ACSDK_ERROR(LX("encodeLoopFailed").d("error", readResult));
+            m_encodeFunction, m_maxBatchSizeWords - m_wordsInInputBuffer, m_params.readTimeoutMs);
+        if (readResult > 0) {
+            return true;
+        }
+        switch (readResult) {
+            case AudioInputStream::Reader::Error::WOULDBLOCK:
+            case AudioInputStream::Reader::Error::TIMEDOUT:
+                // Ignore and retry
+                continue;
+            case AudioInputStream::Reader::Error::CLOSED:
+                // End of input stream
+                ACSDK_DEBUG7(LX("readAndEncodeFromInput").m("endOfStream"));
+                return false;
+            case AudioInputStream::Reader::Error::OVERRUN:
+                // The batch was encoded from input which the writer overwrote meanwhile, so it must not be written.
+                m_outputBuffer.clear();
+                m_wordsInInputBuffer = 0;
+                ACSDK_ERROR(LX("encodeLoopFailed").d("error", readResult));
+                return false;
+            case AudioInputStream::Reader::Error::INVALID:
+                if (m_encodeFailed) {
+                    ACSDK_ERROR(LX("encodeLoopFailed").d("reason", "processSamplesFailed"));
+                    setErrorState();
                     return false;
-            }
-        } else {
-            m_wordsInInputBuffer += readResult;
+                }
+                // fall through
+            default:
+                ACSDK_ERROR(LX("encodeLoopFailed").d("error", readResult));
+                return false;
         }
     }
-
-    return true;
 }
 
-bool AudioEncoder::encodeWordsIntoOutput() {
-    if (!mayContinueEncoding()) {
-        return false;
+bool AudioEncoder::encodeFromInput(const Byte* data, std::size_t nWords) {
+    const auto frameSizeBytes = m_maxInputFrameSizeWords * m_inputWordSizeBytes;
+    auto bytesLeft = nWords * m_inputWordSizeBytes;
+
+    // Complete the frame left over from the previous read.
+    if (m_wordsInInputBuffer) {
+        const auto bufferedBytes = m_wordsInInputBuffer * m_inputWordSizeBytes;
+        const auto bytesToCopy = std::min(frameSizeBytes - bufferedBytes, bytesLeft);
+        std::memcpy(m_inputBuffer.data() + bufferedBytes, data, bytesToCopy);
+        m_wordsInInputBuffer += bytesToCopy / m_inputWordSizeBytes;
+        data += bytesToCopy;
+        bytesLeft -= bytesToCopy;
+        if (m_wordsInInputBuffer < m_maxInputFrameSizeWords) {
+            return true;
+        }
+        if (!encodeFrame(m_inputBuffer.data(), m_inputBuffer.data() + frameSizeBytes)) {
+            return false;
+        }
+        m_wordsInInputBuffer = 0;
     }
 
-    if (!m_wordsInInputBuffer) {
-        return true;
+    // Encode complete frames in place. Encoders which accept partial frames also take the remainder.
+    while (bytesLeft >= frameSizeBytes || (bytesLeft && !m_requireFullFrameSize)) {
+        const auto bytesToEncode = std::min(frameSizeBytes, bytesLeft);
+        if (!encodeFrame(data, data + bytesToEncode)) {
+            return false;
+        }
+        data += bytesToEncode;
+        bytesLeft -= bytesToEncode;
     }
 
-    auto offset = m_wordsInInputBuffer * m_inputWordSizeBytes;
-    if (!m_encoder->processSamples(m_inputBuffer.begin(), m_inputBuffer.begin() + offset, m_outputBuffer)) {
-        ACSDK_ERROR(LX("encodeLoopFailed").d("reason", "processSamplesFailed"));
-        setErrorState();
+    if (bytesLeft) {
+        std::memcpy(m_inputBuffer.data(), data, bytesLeft);
+        m_wordsInInputBuffer = bytesLeft / m_inputWordSizeBytes;
+    }
+    return true;
+}
+
+bool AudioEncoder::encodeFrame(const Byte* begin, const Byte* end) {
+    if (!m_encoder->processSampleBuffer(begin, end, m_outputBuffer)) {
+        m_encodeFailed = true;
         return false;
-    } else {
-        m_wordsInInputBuffer = 0;
-        return true;
     }
+    return true;
 }
 
 bool AudioEncoder::writeEncodedWordsFromOutput() {
@@ -43,7 +43,8 @@ std::unique_ptr<AudioEncoderInterface> createAudioEncoder(
                            DEFAULT_WRITE_TIMEOUT_MS,
                            DEFAULT_STOP_TIMEOUT_MS,
                            DEFAULT_MAX_OUTPUT_STREAM_READERS,
-                           DEFAULT_MAX_OUTPUT_STREAM_BUFFERED_PACKETS});
+                           DEFAULT_MAX_OUTPUT_STREAM_BUFFERED_PACKETS,
+                           AudioEncoderParams::DEFAULT_MAX_FRAMES_PER_BATCH});
 }
 
 std::unique_ptr<AudioEncoderInterface> createAudioEncoderWithParams(
@@ -18,6 +18,8 @@
 namespace alexaClientSDK {
 namespace audioEncoder {
 
+constexpr std::size_t AudioEncoderParams::DEFAULT_MAX_FRAMES_PER_BATCH;
+
 // GCC 4.x and 5.x reached end of support before some of c++11 amendments were made. In particular, these compilers
 // do not have default constructors for list initialization from aggregates. This issue has been addressed in GCC 6.x.
 // http://www.open-std.org/jtc1/sc22/wg21/docs/cwg_defects.html#1467
@@ -28,12 +30,14 @@ AudioEncoderParams::AudioEncoderParams(
     std::chrono::milliseconds writeTimeoutMs,
     std::chrono::milliseconds stopTimeoutMs,
     std::size_t maxOutputStreamReaders,
-    std::size_t maxOutputStreamBufferedPackets) :
+    std::size_t maxOutputStreamBufferedPackets,
+    std::size_t maxFramesPerBatch) :
         readTimeoutMs{readTimeoutMs},
         writeTimeoutMs{writeTimeoutMs},
         stopTimeoutMs{stopTimeoutMs},
         maxOutputStreamReaders{maxOutputStreamReaders},
-        maxOutputStreamBufferedPackets{maxOutputStreamBufferedPackets} {
+        maxOutputStreamBufferedPackets{maxOutputStreamBufferedPackets},
+        maxFramesPerBatch{maxFramesPerBatch} {
 }
 
 AudioEncoderParams::AudioEncoderParams(const AudioEncoderParams& params) :
@@ -41,7 +45,8 @@ AudioEncoderParams::AudioEncoderParams(const AudioEncoderParams& params) :
         writeTimeoutMs{params.writeTimeoutMs},
         stopTimeoutMs{params.stopTimeoutMs},
         maxOutputStreamReaders{params.maxOutputStreamReaders},
-        maxOutputStreamBufferedPackets{params.maxOutputStreamBufferedPackets} {
+        maxOutputStreamBufferedPackets{params.maxOutputStreamBufferedPackets},
+        maxFramesPerBatch{params.maxFramesPerBatch} {
 }
 
 #endif
@@ -0,0 +1,207 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+// @file AudioEncoderBenchmarkTest.cpp
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <acsdk/AudioEncoder/AudioEncoderFactory.h>
+#include <AVSCommon/AVS/AudioInputStream.h>
+#include <AVSCommon/Utils/AudioFormat.h>
+#include <AVSCommon/Utils/Logger/ConsoleLogger.h>
+#include <AVSCommon/Utils/Memory/AllocationCounter.h>
+
+namespace alexaClientSDK {
+namespace audioEncoder {
+namespace test {
+
+using namespace avsCommon::avs;
+using namespace avsCommon::utils;
+using namespace avsCommon::utils::logger;
+using namespace avsCommon::utils::memory::test;
+using namespace audioEncoderInterfaces;
+
+/// Sample rate of the benchmark audio.
+static constexpr size_t SAMPLE_RATE = 16000;
+
+/// Word size of the benchmark audio: 16 bit samples.
+static constexpr size_t WORD_SIZE = 2;
+
+/// Frame size of the pass-through encoder: 20 ms.
+static constexpr size_t FRAME_SIZE_WORDS = SAMPLE_RATE / 50;
+
+/// Seconds of audio encoded by the benchmark.
+static constexpr size_t AUDIO_SECONDS = 10;
+
+/// Words of audio written to the input stream at once: 10 ms, as a microphone would.
+static constexpr size_t WRITE_SIZE_WORDS = SAMPLE_RATE / 100;
+
+/// How long to wait for the encoding thread to start reading.
+static const std::chrono::milliseconds SETUP_DELAY{100};
+
+/// Format of the benchmark audio.
+static const AudioFormat PCM_FORMAT = {
+    AudioFormat::Encoding::LPCM,
+    AudioFormat::Endianness::LITTLE,
+    SAMPLE_RATE,
+    WORD_SIZE * CHAR_BIT,
+    1,
+    false,
+    AudioFormat::Layout::INTERLEAVED,
+};
+
+/**
+ * A block encoder which outputs its input unchanged, so that the benchmark measures the cost of the @c AudioEncoder
+ * pipeline itself. It does not allocate once started.
+ */
+class PassThroughEncoder : public BlockAudioEncoderInterface {
+public:
+    bool init(AudioFormat inputFormat) override {
+        return true;
+    }
+
+    size_t getInputFrameSize() override {
+        return FRAME_SIZE_WORDS;
+    }
+
+    size_t getOutputFrameSize() override {
+        return FRAME_SIZE_WORDS * WORD_SIZE;
+    }
+
+    bool requiresFullyRead() override {
+        return true;
+    }
+
+    AudioFormat getAudioFormat() override {
+        return PCM_FORMAT;
+    }
+
+    std::string getAVSFormatName() override {
+        return "L16";
+    }
+
+    bool start(Bytes&) override {
+        return true;
+    }
+
+    bool processSamples(Bytes::const_iterator begin, Bytes::const_iterator end, Bytes& buffer) override {
+        buffer.insert(buffer.end(), begin, end);
+        return true;
+    }
+
+    bool processSampleBuffer(const Byte* begin, const Byte* end, Bytes& buffer) override {
+        buffer.insert(buffer.end(), begin, end);
+        return true;
+    }
+
+    bool flush(Bytes&) override {
+        return true;
+    }
+
+    void close() override {
+    }
+};
+
+/**
+ * Get the CPU time used by the process so far, on all threads.
+ *
+ * @return The CPU time.
+ */
+static std::chrono::microseconds processCpuTime() {
+    return std::chrono::microseconds(static_cast<long long>(std::clock()) * 1000000 / CLOCKS_PER_SEC);
+}
+
+/**
+ * Verify that @c AudioEncoder passes every sample through in batches without allocating, and report the CPU time it
+ * takes per second of 16 kHz audio.
+ */
+TEST(AudioEncoderBenchmarkTest, test_encodePassThroughAudio) {
+    // Debug logging would dominate the measurements.
+    getConsoleLogger()->setLevel(Level::WARN);
+
+    const size_t totalWords = AUDIO_SECONDS * SAMPLE_RATE;
+    auto inputBuffer =
+        std::make_shared<AudioInputStream::Buffer>(AudioInputStream::calculateBufferSize(totalWords, WORD_SIZE, 1));
+    std::shared_ptr<AudioInputStream> inputStream = AudioInputStream::create(inputBuffer, WORD_SIZE, 1);
+    ASSERT_TRUE(inputStream);
+    auto writer = inputStream->createWriter(AudioInputStream::Writer::Policy::NONBLOCKABLE);
+    ASSERT_TRUE(writer);
+
+    auto encoder = createAudioEncoder(std::make_shared<PassThroughEncoder>());
+    auto outputStream =
+        encoder->startEncoding(inputStream, PCM_FORMAT, 0, AudioInputStream::Reader::Reference::ABSOLUTE);
+    ASSERT_TRUE(outputStream);
+    auto reader = outputStream->createReader(AudioInputStream::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(reader);
+
+    std::atomic<size_t> wordsEncoded{0};
+    bool outputMatches = true;
+    std::thread drain([&reader, &wordsEncoded, &outputMatches] {
+        std::vector<int16_t> words(FRAME_SIZE_WORDS * 8);
+        while (true) {
+            auto readResult = reader->read(words.data(), words.size(), std::chrono::milliseconds(100));
+            if (AudioInputStream::Reader::Error::TIMEDOUT == readResult) {
+                continue;
+            }
+            if (readResult <= 0) {
+                return;
+            }
+            for (ssize_t i = 0; i < readResult; ++i) {
+                outputMatches = outputMatches && words[i] == static_cast<int16_t>(wordsEncoded + i);
+            }
+            wordsEncoded += readResult;
+        }
+    });
+    std::this_thread::sleep_for(SETUP_DELAY);
+
+    std::vector<int16_t> samples(WRITE_SIZE_WORDS);
+    AllocationCounter::start();
+    auto cpuStart = processCpuTime();
+    for (size_t written = 0; written < totalWords; written += WRITE_SIZE_WORDS) {
+        for (size_t i = 0; i < WRITE_SIZE_WORDS; ++i) {
+            samples[i] = static_cast<int16_t>(written + i);
+        }
+        ASSERT_EQ(writer->write(samples.data(), WRITE_SIZE_WORDS), static_cast<ssize_t>(WRITE_SIZE_WORDS));
+    }
+    // Stop measuring once all the audio is through, since ending the encoding thread is not part of the steady state.
+    auto drainDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (wordsEncoded < totalWords && std::chrono::steady_clock::now() < drainDeadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    auto cpuTime = processCpuTime() - cpuStart;
+    AllocationCounter::stop();
+    writer->close();
+    drain.join();
+    encoder->stopEncoding(true);
+
+    EXPECT_EQ(wordsEncoded.load(), totalWords);
+    EXPECT_TRUE(outputMatches);
+    EXPECT_EQ(AllocationCounter::getCount(), 0u);
+    std::cout << "[ BENCHMARK ] pass-through pipeline: " << cpuTime.count() / AUDIO_SECONDS
+              << " us CPU per second of audio (" << cpuTime.count() / (AUDIO_SECONDS * 1e4) << "% of one core), "
+              << AllocationCounter::getCount() << " allocations" << std::endl;
+}
+
+}  // namespace test
+}  // namespace audioEncoder
+}  // namespace alexaClientSDK
@@ -172,6 +172,30 @@ public:
      */
     virtual bool processSamples(Bytes::const_iterator begin, Bytes::const_iterator end, Bytes& buffer) = 0;
 
+    /**
+     * @brief Encode a block of audio from raw memory.
+     *
+     * This method is equivalent to #processSamples(), except that the samples may be located anywhere in memory, for
+     * example directly in the buffer of the input stream. Encoders should override this method to encode without
+     * copying the input; the default implementation copies the samples into a per-thread scratch buffer, which is only
+     * allocated the first time it is used, and calls #processSamples().
+     *
+     * @param[in]   begin           Pointer to the first byte of samples. This parameter must be less then @a end, or
+     *                              the method will fail with an error.
+     * @param[in]   end             Pointer past the last byte of samples.
+     * @param[out]  buffer          Output buffer for encoded data.
+     *
+     * @return true when success.
+     */
+    virtual bool processSampleBuffer(const Byte* begin, const Byte* end, Bytes& buffer) {
+        if (!begin || end <= begin) {
+            return false;
+        }
+        static thread_local Bytes scratch;
+        scratch.assign(begin, end);
+        return processSamples(scratch.cbegin(), scratch.cend(), buffer);
+    }
+
     /**
      * @brief Flush buffered data if any.
      *
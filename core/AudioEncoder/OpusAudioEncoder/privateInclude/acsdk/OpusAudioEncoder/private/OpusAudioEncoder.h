@@ -17,6 +17,8 @@
 #define ACSDK_OPUSAUDIOENCODER_PRIVATE_OPUSAUDIOENCODER_H_
 
 #include <memory>
+#include <vector>
+
 #include <opus.h>
 
 #include <acsdk/AudioEncoderInterfaces/BlockAudioEncoderInterface.h>
@@ -57,6 +59,7 @@ public:
     std::string getAVSFormatName() override;
     bool start(Bytes& preamble) override;
     bool processSamples(Bytes::const_iterator begin, Bytes::const_iterator end, Bytes& buffer) override;
+    bool processSampleBuffer(const Byte* begin, const Byte* end, Bytes& buffer) override;
     bool flush(Bytes& buffer) override;
     void close() override;
     /// @}
@@ -71,6 +74,12 @@ private:
      */
     bool configureEncoder();
 
+    /// Input samples converted to machine byte order, when they can not be encoded in place.
+    std::vector<opus_int16> m_pcmBuffer;
+
+    /// Encoded packet, before it is appended to the output buffer.
+    Bytes m_packetBuffer;
+
     /// OPUS encoder handle
     OpusEncoder* m_encoder;
 
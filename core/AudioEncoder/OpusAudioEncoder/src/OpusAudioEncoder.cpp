@@ -15,6 +15,7 @@
 
 #include <iostream>
 #include <climits>
+#include <cstdint>
 #include <cstring>
 
 #include <acsdk/OpusAudioEncoder/private/OpusAudioEncoder.h>
@@ -63,6 +64,23 @@ inline uint16_t Reverse16(uint16_t value) {
     return (((value & 0x00FF) << 8) | ((value & 0xFF00) >> 8));
 }
 
+/**
+ * Copy samples while reversing their byte order. The loop has no dependencies between iterations, so compilers turn it
+ * into vector byte shuffles (SSSE3/AVX2 on x86, NEON on ARM).
+ *
+ * @param source The samples, which need not be aligned.
+ * @param count The number of samples.
+ * @param destination The buffer receiving at least @c count samples.
+ */
+static void copyReversed16(const unsigned char* source, size_t count, opus_int16* destination) {
+    for (size_t i = 0; i < count; i++) {
+        uint16_t word;
+        std::memcpy(&word, source + i * sizeof(word), sizeof(word));
+        word = Reverse16(word);
+        std::memcpy(destination + i, &word, sizeof(word));
+    }
+}
+
 std::unique_ptr<BlockAudioEncoderInterface> OpusAudioEncoder::createEncoder() {
     return std::unique_ptr<OpusAudioEncoder>(new OpusAudioEncoder);
 }
@@ -169,14 +187,21 @@ bool OpusAudioEncoder::start(Bytes&) {
 }
 
 bool OpusAudioEncoder::processSamples(Bytes::const_iterator begin, Bytes::const_iterator end, Bytes& buffer) {
-    opus_int16 pcm[FRAME_SIZE];
-
     if (end <= begin) {
         ACSDK_ERROR(LX("processSamplesError").d("reason", "InputRangeNegative"));
         return false;
     }
     const auto byteCount = static_cast<std::size_t>(std::distance(begin, end));
-    if (byteCount > sizeof(pcm)) {
+    return processSampleBuffer(&*begin, &*begin + byteCount, buffer);
+}
+
+bool OpusAudioEncoder::processSampleBuffer(const Byte* begin, const Byte* end, Bytes& buffer) {
+    if (!begin || end <= begin) {
+        ACSDK_ERROR(LX("processSamplesError").d("reason", "InputRangeNegative"));
+        return false;
+    }
+    const auto byteCount = static_cast<std::size_t>(end - begin);
+    if (byteCount > m_pcmBuffer.size() * sizeof(opus_int16)) {
         ACSDK_ERROR(LX("processSamplesError").d("reason", "InputTooLarge"));
         return false;
     }
@@ -185,38 +210,43 @@ bool OpusAudioEncoder::processSamples(Bytes::const_iterator begin, Bytes::const_
         return false;
     }
 
-    std::memcpy(pcm, &*begin, byteCount);
     const bool littleEndianInput = m_inputFormat.endianness == AudioFormat::Endianness::LITTLE;
     const size_t numberOfWords = byteCount / sizeof(opus_int16);
 
+    // Samples in machine byte order are encoded in place unless they are misaligned.
+    const opus_int16* pcm;
     if (littleEndianInput != littleEndianMachine()) {
-        for (size_t i = 0; i < numberOfWords; i++) {
-            pcm[i] = Reverse16(pcm[i]);
-        }
+        copyReversed16(begin, numberOfWords, m_pcmBuffer.data());
+        pcm = m_pcmBuffer.data();
+    } else if (reinterpret_cast<std::uintptr_t>(begin) % alignof(opus_int16)) {
+        std::memcpy(m_pcmBuffer.data(), begin, byteCount);
+        pcm = m_pcmBuffer.data();
+    } else {
+        pcm = reinterpret_cast<const opus_int16*>(begin);
+    }
+
+    opus_int32 res = opus_encode(
+        m_encoder,
+        pcm,
+        static_cast<int>(numberOfWords),
+        m_packetBuffer.data(),
+        static_cast<opus_int32>(m_packetBuffer.size()));
+    if (res < 0) {
+        ACSDK_ERROR(LX("processSamplesError").d("code", res));
+        return false;
     }
 
-    const auto bufferOffset = buffer.size();
 #if __cpp_exceptions || defined(__EXCEPTIONS)
     try {
 #endif
-        buffer.resize(bufferOffset + MAX_PACKET_SIZE);
+        buffer.insert(buffer.end(), m_packetBuffer.begin(), m_packetBuffer.begin() + res);
 #if __cpp_exceptions || defined(__EXCEPTIONS)
     } catch (const std::bad_alloc& e) {
         ACSDK_ERROR(LX("processSamplesError").d("bufferResizeFailed", e.what()));
         return false;
     }
 #endif
-
-    opus_int32 res =
-        opus_encode(m_encoder, pcm, static_cast<int>(numberOfWords), buffer.data() + bufferOffset, MAX_PACKET_SIZE);
-    if (res >= 0) {
-        buffer.resize(bufferOffset + static_cast<size_t>(res));
-        return true;
-    } else {
-        ACSDK_ERROR(LX("processSamplesError").d("code", res));
-        buffer.resize(bufferOffset);
-        return false;
-    }
+    return true;
 }
 
 bool OpusAudioEncoder::flush(Bytes&) {
@@ -231,6 +261,8 @@ void OpusAudioEncoder::close() {
 }
 
 OpusAudioEncoder::OpusAudioEncoder() :
+        m_pcmBuffer(FRAME_SIZE),
+        m_packetBuffer(MAX_PACKET_SIZE),
         m_encoder{nullptr},
         m_outputFormat{
             AudioFormat::Encoding::OPUS,
@@ -0,0 +1,204 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+// @file OpusAudioEncoderBenchmarkTest.cpp
+
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <acsdk/OpusAudioEncoder/private/OpusAudioEncoder.h>
+#include <AVSCommon/Utils/AudioFormat.h>
+#include <AVSCommon/Utils/Logger/ConsoleLogger.h>
+#include <AVSCommon/Utils/Memory/AllocationCounter.h>
+
+namespace alexaClientSDK {
+namespace opusAudioEncoder {
+namespace test {
+
+using namespace avsCommon::utils;
+using namespace avsCommon::utils::logger;
+using namespace avsCommon::utils::memory::test;
+using namespace audioEncoderInterfaces;
+
+using Byte = BlockAudioEncoderInterface::Byte;
+using Bytes = BlockAudioEncoderInterface::Bytes;
+
+/// Sample rate of the benchmark audio.
+static constexpr size_t SAMPLE_RATE = 16000;
+
+/// Seconds of audio encoded by the benchmark.
+static constexpr size_t AUDIO_SECONDS = 10;
+
+/// Frequency of the tone encoded by the benchmark.
+static constexpr double TONE_HZ = 440.0;
+
+/**
+ * Create an input format.
+ *
+ * @param endianness The byte order of the samples.
+ * @return The format.
+ */
+static AudioFormat createInputFormat(AudioFormat::Endianness endianness) {
+    return {AudioFormat::Encoding::LPCM,
+            endianness,
+            SAMPLE_RATE,
+            16,
+            1,
+            false,
+            AudioFormat::Layout::INTERLEAVED};
+}
+
+/**
+ * Create @c AUDIO_SECONDS of a tone with some noise, so that the encoder has real work to do.
+ *
+ * @param bigEndian Whether to store the samples big endian.
+ * @return The samples, as bytes.
+ */
+static Bytes createAudio(bool bigEndian) {
+    Bytes audio(AUDIO_SECONDS * SAMPLE_RATE * 2);
+    std::srand(1);
+    for (size_t i = 0; i < AUDIO_SECONDS * SAMPLE_RATE; ++i) {
+        auto sample = static_cast<int16_t>(
+            8000 * std::sin(2 * M_PI * TONE_HZ * i / SAMPLE_RATE) + (std::rand() % 1000) - 500);
+        auto word = static_cast<uint16_t>(sample);
+        audio[i * 2 + (bigEndian ? 1 : 0)] = static_cast<Byte>(word & 0xFF);
+        audio[i * 2 + (bigEndian ? 0 : 1)] = static_cast<Byte>(word >> 8);
+    }
+    return audio;
+}
+
+/**
+ * Get the CPU time used by the process so far.
+ *
+ * @return The CPU time.
+ */
+static std::chrono::microseconds processCpuTime() {
+    return std::chrono::microseconds(static_cast<long long>(std::clock()) * 1000000 / CLOCKS_PER_SEC);
+}
+
+/**
+ * Encode audio frame by frame.
+ *
+ * @param endianness The byte order of @c audio.
+ * @param audio The audio.
+ * @param offset Offset of the first sample in @c audio, to exercise misaligned input.
+ * @param[out] packets The encoded packets.
+ * @param[out] allocations The number of allocations made while encoding.
+ * @return The CPU time spent encoding.
+ */
+static std::chrono::microseconds encode(
+    AudioFormat::Endianness endianness,
+    const Bytes& audio,
+    size_t offset,
+    Bytes* packets,
+    size_t* allocations) {
+    OpusAudioEncoder encoder;
+    EXPECT_TRUE(encoder.init(createInputFormat(endianness)));
+    EXPECT_TRUE(encoder.start(*packets));
+    const size_t frameSizeBytes = encoder.getInputFrameSize() * 2;
+    const size_t frames = (audio.size() - offset) / frameSizeBytes;
+    packets->reserve(packets->size() + frames * encoder.getOutputFrameSize() * 2);
+
+    AllocationCounter::start();
+    auto cpuStart = processCpuTime();
+    for (size_t frame = 0; frame < frames; ++frame) {
+        const Byte* begin = audio.data() + offset + frame * frameSizeBytes;
+        if (!encoder.processSampleBuffer(begin, begin + frameSizeBytes, *packets)) {
+            ADD_FAILURE() << "processSampleBufferFailed frame=" << frame;
+            break;
+        }
+    }
+    auto cpuTime = processCpuTime() - cpuStart;
+    *allocations = AllocationCounter::stop();
+    encoder.close();
+    return cpuTime;
+}
+
+/**
+ * Report the CPU time spent encoding.
+ *
+ * @param description What was encoded.
+ * @param cpuTime The CPU time spent encoding @c AUDIO_SECONDS of audio.
+ */
+static void report(const std::string& description, std::chrono::microseconds cpuTime) {
+    std::cout << "[ BENCHMARK ] " << description << ": " << cpuTime.count() / AUDIO_SECONDS
+              << " us CPU per second of 16 kHz audio (" << cpuTime.count() / (AUDIO_SECONDS * 1e4)
+              << "% of one core)" << std::endl;
+}
+
+class OpusAudioEncoderBenchmarkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Debug logging would dominate the measurements.
+        getConsoleLogger()->setLevel(Level::WARN);
+    }
+};
+
+/**
+ * Verify that little endian audio is encoded in place without allocating, and report the CPU time it takes.
+ */
+TEST_F(OpusAudioEncoderBenchmarkTest, test_encodeLittleEndianAudio) {
+    auto audio = createAudio(false);
+    Bytes packets;
+    size_t allocations = 0;
+    auto cpuTime = encode(AudioFormat::Endianness::LITTLE, audio, 0, &packets, &allocations);
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_FALSE(packets.empty());
+    report("OPUS little endian", cpuTime);
+}
+
+/**
+ * Verify that big endian audio is encoded without allocating and into the same packets as little endian audio, and
+ * report the CPU time it takes.
+ */
+TEST_F(OpusAudioEncoderBenchmarkTest, test_encodeBigEndianAudio) {
+    Bytes expected;
+    size_t allocations = 0;
+    encode(AudioFormat::Endianness::LITTLE, createAudio(false), 0, &expected, &allocations);
+
+    Bytes packets;
+    auto cpuTime = encode(AudioFormat::Endianness::BIG, createAudio(true), 0, &packets, &allocations);
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(packets, expected);
+    report("OPUS big endian", cpuTime);
+}
+
+/**
+ * Verify that misaligned audio, which can not be encoded in place, is encoded into the same packets.
+ */
+TEST_F(OpusAudioEncoderBenchmarkTest, test_encodeMisalignedAudio) {
+    auto audio = createAudio(false);
+    Bytes expected;
+    size_t allocations = 0;
+    encode(AudioFormat::Endianness::LITTLE, audio, 0, &expected, &allocations);
+
+    Bytes misaligned(1);
+    misaligned.insert(misaligned.end(), audio.begin(), audio.end());
+    Bytes packets;
+    encode(AudioFormat::Endianness::LITTLE, misaligned, 1, &packets, &allocations);
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(packets, expected);
+}
+
+}  // namespace test
+}  // namespace opusAudioEncoder
+}  // namespace alexaClientSDK
@@ -110,14 +110,10 @@ bool AuthorizationManagerStorage::store(const std::string& adapterId, const std:
         ACSDK_WARN(LX("storeFailed").d("reason", "tableNotEmpty"));
     }
 
-    if (!m_storage->put(COMPONENT_NAME, AUTH_STATE_TABLE, AUTH_ADAPTER_ID_KEY, adapterId)) {
-        ACSDK_ERROR(LX("storeFailed").d("reason", "storeAdapterIdFailed").d("adapterId", adapterId));
-
-        return false;
-    }
-
-    if (!m_storage->put(COMPONENT_NAME, AUTH_STATE_TABLE, USER_ID_KEY, userId)) {
-        ACSDK_ERROR(LX("storeFailed").d("reason", "storeUserIdFailed").d("userId", userId));
+    // Both keys are written together, so a failure can't leave an adapter id stored without its user id.
+    if (!m_storage->putMany(
+            COMPONENT_NAME, AUTH_STATE_TABLE, {{AUTH_ADAPTER_ID_KEY, adapterId}, {USER_ID_KEY, userId}})) {
+        ACSDK_ERROR(LX("storeFailed").d("reason", "storeStateFailed").d("adapterId", adapterId).d("userId", userId));
         return false;
     }
 
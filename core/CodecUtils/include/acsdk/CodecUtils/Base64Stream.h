@@ -0,0 +1,170 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ACSDK_CODECUTILS_BASE64STREAM_H_
+#define ACSDK_CODECUTILS_BASE64STREAM_H_
+
+#include <cstddef>
+
+#include <acsdk/CodecUtils/Types.h>
+
+namespace alexaClientSDK {
+namespace codecUtils {
+
+/**
+ * @brief Returns the number of characters needed to Base64-encode data.
+ *
+ * The result includes padding. It is also the largest number of characters a single Base64Encoder::update() call can
+ * produce for \a binarySize input bytes.
+ *
+ * @param[in] binarySize Size of the data in bytes.
+ * @return Number of Base64 characters.
+ * @ingroup CodecUtils
+ */
+size_t getBase64EncodedSize(size_t binarySize) noexcept;
+
+/**
+ * @brief Returns the largest number of bytes that Base64-decoding a number of characters can produce.
+ *
+ * This is also the largest number of bytes a single Base64Decoder::update() call can produce for \a base64Size input
+ * characters.
+ *
+ * @param[in] base64Size Number of Base64 characters, including whitespace and padding.
+ * @return Maximum number of decoded bytes.
+ * @ingroup CodecUtils
+ */
+size_t getBase64MaxDecodedSize(size_t base64Size) noexcept;
+
+/**
+ * @brief Incremental Base64 encoder writing into caller-provided buffers.
+ *
+ * Data may be passed in pieces of any size; the encoder carries incomplete 3-byte blocks over to the next call. The
+ * output is the same as that of encodeBase64() for the concatenated input. With the SIMD codec backend, vector
+ * instructions are used when the CPU supports them.
+ *
+ * @code
+ * Base64Encoder encoder;
+ * char* out = buffer;
+ * out += encoder.update(chunk1, chunk1Size, out);
+ * out += encoder.update(chunk2, chunk2Size, out);
+ * out += encoder.finish(out);
+ * @endcode
+ *
+ * @sa encodeBase64()
+ * @ingroup CodecUtils
+ */
+class Base64Encoder {
+public:
+    /// @brief Number of characters finish() writes at most.
+    static constexpr size_t MAX_FINISH_SIZE = 4;
+
+    /**
+     * @brief Constructs an encoder.
+     */
+    Base64Encoder() noexcept;
+
+    /**
+     * @brief Encodes a piece of data.
+     *
+     * @param[in] binary Data to encode.
+     * @param[in] size Size of \a binary in bytes.
+     * @param[out] base64 Destination with room for at least getBase64EncodedSize(\a size) characters. No terminating
+     * null character is written.
+     * @return Number of characters written.
+     */
+    size_t update(const Byte* binary, size_t size, char* base64) noexcept;
+
+    /**
+     * @brief Encodes the data carried over from previous updates, adding padding, and resets the encoder.
+     *
+     * @param[out] base64 Destination with room for at least @c MAX_FINISH_SIZE characters.
+     * @return Number of characters written.
+     */
+    size_t finish(char* base64) noexcept;
+
+private:
+    /// Bytes of an incomplete block carried over to the next update.
+    Byte m_tail[2];
+
+    /// Number of bytes in \a m_tail.
+    size_t m_tailSize;
+};
+
+/**
+ * @brief Incremental Base64 decoder writing into caller-provided buffers.
+ *
+ * Characters may be passed in pieces of any size; the decoder carries incomplete 4-character blocks over to the next
+ * call. The decoder accepts the same input as decodeBase64(): ignorable whitespace is skipped, and padding may only
+ * appear at the end of the input. With the SIMD codec backend, vector instructions are used when the CPU supports
+ * them.
+ *
+ * Once an update fails, the decoder rejects all further input until it is reset.
+ *
+ * @sa decodeBase64()
+ * @ingroup CodecUtils
+ */
+class Base64Decoder {
+public:
+    /**
+     * @brief Constructs a decoder.
+     */
+    Base64Decoder() noexcept;
+
+    /**
+     * @brief Decodes a piece of Base64 text.
+     *
+     * @param[in] base64 Characters to decode.
+     * @param[in] size Number of characters in \a base64.
+     * @param[out] binary Destination with room for at least getBase64MaxDecodedSize(\a size) bytes.
+     * @param[out] written Number of bytes written to \a binary. On failure, the bytes written before the error was
+     * detected are counted.
+     *
+     * @return True if the input is valid so far, false otherwise.
+     */
+    bool update(const char* base64, size_t size, Byte* binary, size_t* written) noexcept;
+
+    /**
+     * @brief Checks that the input ended on a block boundary, and resets the decoder.
+     *
+     * @return True if all updates succeeded and no incomplete block is pending, false otherwise.
+     */
+    bool finish() noexcept;
+
+    /**
+     * @brief Discards all state, including a previous error.
+     */
+    void reset() noexcept;
+
+private:
+    /// Values of the characters of an incomplete block carried over to the next update.
+    Byte m_block[4];
+
+    /// Number of characters in \a m_block.
+    size_t m_blockSize;
+
+    /// Number of padding characters in the current block.
+    size_t m_padding;
+
+    /// Whether a padded block has been decoded, after which only whitespace is accepted.
+    bool m_padded;
+
+    /// Whether an update has failed.
+    bool m_failed;
+};
+
+}  // namespace codecUtils
+}  // namespace alexaClientSDK
+
+#endif  // ACSDK_CODECUTILS_BASE64STREAM_H_
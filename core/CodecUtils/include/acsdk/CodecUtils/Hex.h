@@ -16,6 +16,7 @@
 #ifndef ACSDK_CODECUTILS_HEX_H_
 #define ACSDK_CODECUTILS_HEX_H_
 
+#include <cstddef>
 #include <string>
 #include <acsdk/CodecUtils/Types.h>
 
@@ -58,6 +59,40 @@ bool encodeHex(const Bytes& binary, std::string& hexString) noexcept;
  */
 bool decodeHex(const std::string& hexString, Bytes& binary) noexcept;
 
+/**
+ * @brief Encodes binary data into a caller-provided buffer using hex encoding.
+ *
+ * Method produces the same characters as encodeHex(const Bytes&, std::string&). With the SIMD codec backend, vector
+ * instructions are used when the CPU supports them. No terminating null character is written.
+ *
+ * @param[in] binary Binary data to encode.
+ * @param[in] size Size of \a binary in bytes.
+ * @param[out] hexString Destination with room for at least 2 * \a size characters.
+ *
+ * @return Number of characters written, which is 2 * \a size.
+ *
+ * @ingroup CodecUtils
+ */
+size_t encodeHex(const Byte* binary, size_t size, char* hexString) noexcept;
+
+/**
+ * @brief Decodes hex data into a caller-provided buffer.
+ *
+ * Method accepts the same input as decodeHex(const std::string&, Bytes&). With the SIMD codec backend, vector
+ * instructions are used when the CPU supports them.
+ *
+ * @param[in] hexString Characters to decode.
+ * @param[in] size Number of characters in \a hexString.
+ * @param[out] binary Destination with room for at least \a size / 2 bytes. If operation fails, the contents is
+ * undefined.
+ * @param[out] written Number of bytes written to \a binary.
+ *
+ * @return True, if operation succeeds.
+ *
+ * @ingroup CodecUtils
+ */
+bool decodeHex(const char* hexString, size_t size, Byte* binary, size_t* written) noexcept;
+
 }  // namespace codecUtils
 }  // namespace alexaClientSDK
 
@@ -0,0 +1,105 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ACSDK_CODECUTILS_PRIVATE_SIMDKERNELS_H_
+#define ACSDK_CODECUTILS_PRIVATE_SIMDKERNELS_H_
+
+#include <cstddef>
+#include <vector>
+
+#include <acsdk/CodecUtils/Types.h>
+
+namespace alexaClientSDK {
+namespace codecUtils {
+
+/**
+ * @brief Set of vectorized codec kernels for one instruction set.
+ *
+ * Each kernel converts the longest prefix of its input that it can process with full vectors, and returns the number
+ * of input characters or bytes it consumed. The caller converts the rest with scalar code. Decoding kernels stop at
+ * the first vector which contains a character they do not accept (including whitespace and Base64 padding), so that
+ * the scalar code can deal with it.
+ *
+ * Kernels never write more than the output of the input they consume, and never read past the end of their input.
+ * @private
+ */
+struct SimdKernels {
+    /// Name of the instruction set.
+    const char* name;
+
+    /**
+     * Base64-encodes whole 3-byte blocks.
+     *
+     * @param[in] binary Data to encode.
+     * @param[in] size Size of \a binary in bytes.
+     * @param[out] base64 Destination for 4 characters per 3 bytes consumed.
+     * @return Number of bytes consumed, which is a multiple of 3.
+     */
+    size_t (*encodeBase64)(const Byte* binary, size_t size, char* base64);
+
+    /**
+     * Base64-decodes whole 4-character blocks without padding or whitespace.
+     *
+     * @param[in] base64 Characters to decode.
+     * @param[in] size Number of characters in \a base64.
+     * @param[out] binary Destination for 3 bytes per 4 characters consumed.
+     * @return Number of characters consumed, which is a multiple of 4.
+     */
+    size_t (*decodeBase64)(const char* base64, size_t size, Byte* binary);
+
+    /**
+     * Hex-encodes bytes using lowercase letters.
+     *
+     * @param[in] binary Data to encode.
+     * @param[in] size Size of \a binary in bytes.
+     * @param[out] hex Destination for 2 characters per byte consumed.
+     * @return Number of bytes consumed.
+     */
+    size_t (*encodeHex)(const Byte* binary, size_t size, char* hex);
+
+    /**
+     * Hex-decodes pairs of characters without whitespace.
+     *
+     * @param[in] hex Characters to decode.
+     * @param[in] size Number of characters in \a hex.
+     * @param[out] binary Destination for 1 byte per 2 characters consumed.
+     * @return Number of characters consumed, which is a multiple of 2.
+     */
+    size_t (*decodeHex)(const char* hex, size_t size, Byte* binary);
+};
+
+/**
+ * @brief Returns the kernels of the best instruction set supported by the CPU.
+ *
+ * The kernels are selected once, on first use. If no instruction set is supported, or the library is not built with
+ * the SIMD codec backend, the kernels consume nothing.
+ *
+ * @return Kernels to use.
+ * @private
+ */
+const SimdKernels& getSimdKernels() noexcept;
+
+/**
+ * @brief Returns the kernels of all instruction sets supported by the CPU.
+ *
+ * @return Supported kernels, best first. The last entry is the scalar placeholder which consumes nothing.
+ * @private
+ */
+std::vector<const SimdKernels*> getSupportedSimdKernels();
+
+}  // namespace codecUtils
+}  // namespace alexaClientSDK
+
+#endif  // ACSDK_CODECUTILS_PRIVATE_SIMDKERNELS_H_
@@ -0,0 +1,55 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <acsdk/CodecUtils/Base64.h>
+#include <acsdk/CodecUtils/Base64Stream.h>
+
+namespace alexaClientSDK {
+namespace codecUtils {
+
+bool encodeBase64(const Bytes& binary, std::string& base64String) noexcept {
+    if (binary.empty()) {
+        return true;
+    }
+
+    size_t index = base64String.size();
+    base64String.resize(index + getBase64EncodedSize(binary.size()));
+    Base64Encoder encoder;
+    size_t len = encoder.update(binary.data(), binary.size(), &base64String[index]);
+    encoder.finish(&base64String[index + len]);
+
+    return true;
+}
+
+bool decodeBase64(const std::string& base64String, Bytes& binary) noexcept {
+    if (base64String.empty()) {
+        return true;
+    }
+
+    size_t index = binary.size();
+    binary.resize(index + getBase64MaxDecodedSize(base64String.size()));
+    Base64Decoder decoder;
+    size_t len = 0;
+    if (!decoder.update(base64String.data(), base64String.size(), &binary[index], &len) || !decoder.finish()) {
+        binary.resize(index);
+        return false;
+    }
+    binary.resize(index + len);
+
+    return true;
+}
+
+}  // namespace codecUtils
+}  // namespace alexaClientSDK
@@ -0,0 +1,217 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstdint>
+
+#include <acsdk/CodecUtils/Base64Stream.h>
+#include <acsdk/CodecUtils/private/Base64Common.h>
+#include <acsdk/CodecUtils/private/CodecsCommon.h>
+#include <acsdk/CodecUtils/private/SimdKernels.h>
+
+namespace alexaClientSDK {
+namespace codecUtils {
+
+/// @brief Base64 alphabet.
+/// @private
+static const char BASE64_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/// @brief Marker for characters which are not in the Base64 alphabet.
+/// @private
+static constexpr uint8_t INVALID_VALUE = 0xff;
+
+/// @brief Number of characters decoded with scalar code after the vector kernel stopped, before it is tried again.
+/// @private
+static constexpr size_t SCALAR_RUN = 16;
+
+/**
+ * @brief Table mapping characters to their Base64 values.
+ * @private
+ */
+struct Base64DecodeTable {
+    /// Constructs the table from @c BASE64_ALPHABET.
+    Base64DecodeTable() {
+        for (auto& value : values) {
+            value = INVALID_VALUE;
+        }
+        for (uint8_t i = 0; i < 64; ++i) {
+            values[static_cast<unsigned char>(BASE64_ALPHABET[i])] = i;
+        }
+    }
+
+    /// Value of each character, or @c INVALID_VALUE.
+    uint8_t values[256];
+};
+
+/// @brief The decoding table.
+/// @private
+static const Base64DecodeTable DECODE_TABLE;
+
+/**
+ * @brief Encodes one complete 3-byte block.
+ *
+ * @param[in] binary Three bytes to encode.
+ * @param[out] base64 Destination for four characters.
+ * @private
+ */
+static inline void encodeBlock(const Byte* binary, char* base64) {
+    uint32_t block = (static_cast<uint32_t>(binary[0]) << 16) | (static_cast<uint32_t>(binary[1]) << 8) | binary[2];
+    base64[0] = BASE64_ALPHABET[block >> 18];
+    base64[1] = BASE64_ALPHABET[(block >> 12) & 0x3f];
+    base64[2] = BASE64_ALPHABET[(block >> 6) & 0x3f];
+    base64[3] = BASE64_ALPHABET[block & 0x3f];
+}
+
+size_t getBase64EncodedSize(size_t binarySize) noexcept {
+    return (binarySize + B64BIN_BLOCK - 1) / B64BIN_BLOCK * B64CHAR_BLOCK;
+}
+
+size_t getBase64MaxDecodedSize(size_t base64Size) noexcept {
+    return (base64Size + B64CHAR_BLOCK - 1) / B64CHAR_BLOCK * B64BIN_BLOCK;
+}
+
+constexpr size_t Base64Encoder::MAX_FINISH_SIZE;
+
+Base64Encoder::Base64Encoder() noexcept : m_tail{0, 0}, m_tailSize{0} {
+}
+
+size_t Base64Encoder::update(const Byte* binary, size_t size, char* base64) noexcept {
+    char* out = base64;
+    if (m_tailSize) {
+        while (m_tailSize < B64BIN_BLOCK - 1 && size) {
+            m_tail[m_tailSize++] = *binary++;
+            --size;
+        }
+        if (!size) {
+            return 0;
+        }
+        Byte block[B64BIN_BLOCK] = {m_tail[0], m_tail[1], *binary++};
+        --size;
+        m_tailSize = 0;
+        encodeBlock(block, out);
+        out += B64CHAR_BLOCK;
+    }
+
+    size_t consumed = getSimdKernels().encodeBase64(binary, size, out);
+    out += consumed / B64BIN_BLOCK * B64CHAR_BLOCK;
+    for (; size - consumed >= B64BIN_BLOCK; consumed += B64BIN_BLOCK, out += B64CHAR_BLOCK) {
+        encodeBlock(binary + consumed, out);
+    }
+    while (consumed < size) {
+        m_tail[m_tailSize++] = binary[consumed++];
+    }
+    return static_cast<size_t>(out - base64);
+}
+
+size_t Base64Encoder::finish(char* base64) noexcept {
+    if (!m_tailSize) {
+        return 0;
+    }
+    Byte block[B64BIN_BLOCK] = {m_tail[0], static_cast<Byte>(m_tailSize > 1 ? m_tail[1] : 0), 0};
+    encodeBlock(block, base64);
+    base64[3] = '=';
+    if (1 == m_tailSize) {
+        base64[2] = '=';
+    }
+    m_tailSize = 0;
+    return B64CHAR_BLOCK;
+}
+
+Base64Decoder::Base64Decoder() noexcept {
+    reset();
+}
+
+void Base64Decoder::reset() noexcept {
+    m_blockSize = 0;
+    m_padding = 0;
+    m_padded = false;
+    m_failed = false;
+}
+
+bool Base64Decoder::update(const char* base64, size_t size, Byte* binary, size_t* written) noexcept {
+    Byte* out = binary;
+    auto fail = [this, &out, binary, written]() {
+        m_failed = true;
+        *written = static_cast<size_t>(out - binary);
+        return false;
+    };
+    if (m_failed) {
+        return fail();
+    }
+
+    const auto decodeKernel = getSimdKernels().decodeBase64;
+    size_t index = 0;
+    size_t kernelIndex = 0;
+    while (index < size) {
+        if (!m_blockSize && !m_padded && index >= kernelIndex) {
+            // At a block boundary the vector kernel can take over until it hits whitespace or padding.
+            size_t consumed = decodeKernel(base64 + index, size - index, out);
+            index += consumed;
+            out += consumed / B64CHAR_BLOCK * B64BIN_BLOCK;
+            if (index == size) {
+                break;
+            }
+            kernelIndex = index + SCALAR_RUN;
+        }
+
+        char ch = base64[index++];
+        if (isIgnorableWhitespace(ch)) {
+            continue;
+        }
+        if (m_padded) {
+            // Bad input: data after a padded block.
+            return fail();
+        }
+        uint8_t value = DECODE_TABLE.values[static_cast<unsigned char>(ch)];
+        if (m_padding) {
+            if ('=' != ch) {
+                // Bad input: data after '=' character.
+                return fail();
+            }
+            ++m_padding;
+            value = 0;
+        } else if ('=' == ch && m_blockSize >= B64BIN_BLOCK - 1) {
+            m_padding = 1;
+            value = 0;
+        } else if (INVALID_VALUE == value) {
+            return fail();
+        }
+        m_block[m_blockSize++] = value;
+
+        if (B64CHAR_BLOCK == m_blockSize) {
+            uint32_t block = (static_cast<uint32_t>(m_block[0]) << 18) | (static_cast<uint32_t>(m_block[1]) << 12) |
+                             (static_cast<uint32_t>(m_block[2]) << 6) | static_cast<uint32_t>(m_block[3]);
+            *out++ = static_cast<Byte>(block >> 16);
+            if (m_padding < 2) {
+                *out++ = static_cast<Byte>(block >> 8);
+            }
+            if (!m_padding) {
+                *out++ = static_cast<Byte>(block);
+            }
+            m_padded = m_padding != 0;
+            m_blockSize = 0;
+        }
+    }
+    *written = static_cast<size_t>(out - binary);
+    return true;
+}
+
+bool Base64Decoder::finish() noexcept {
+    bool result = !m_failed && !m_blockSize;
+    reset();
+    return result;
+}
+
+}  // namespace codecUtils
+}  // namespace alexaClientSDK
@@ -15,6 +15,7 @@
 
 #include <acsdk/CodecUtils/Hex.h>
 #include <acsdk/CodecUtils/private/CodecsCommon.h>
+#include <acsdk/CodecUtils/private/SimdKernels.h>
 
 namespace alexaClientSDK {
 namespace codecUtils {
@@ -27,17 +28,31 @@ namespace codecUtils {
  */
 static const char BINARY_TO_HEX[] = "0123456789abcdef";
 
-bool encodeHex(const Bytes& binary, std::string& hexString) noexcept {
-    hexString.reserve(hexString.size() + binary.size() * 2);
+/// @brief Number of characters decoded with scalar code after the vector kernel stopped, before it is tried again.
+/// @private
+static constexpr size_t SCALAR_RUN = 32;
 
-    for (Byte b : binary) {
-        hexString.push_back(BINARY_TO_HEX[b >> 4]);
-        hexString.push_back(BINARY_TO_HEX[b & 15u]);
+bool encodeHex(const Bytes& binary, std::string& hexString) noexcept {
+    if (binary.empty()) {
+        return true;
     }
 
+    size_t index = hexString.size();
+    hexString.resize(index + binary.size() * 2);
+    encodeHex(binary.data(), binary.size(), &hexString[index]);
+
     return true;
 }
 
+size_t encodeHex(const Byte* binary, size_t size, char* hexString) noexcept {
+    size_t consumed = getSimdKernels().encodeHex(binary, size, hexString);
+    for (size_t i = consumed; i < size; ++i) {
+        hexString[i * 2] = BINARY_TO_HEX[binary[i] >> 4];
+        hexString[i * 2 + 1] = BINARY_TO_HEX[binary[i] & 15u];
+    }
+    return size * 2;
+}
+
 /**
  * @brief Converts character code into binary.
  * This method converts hex-encoded code into binary form. The input must be one of 0-9,a-f,A-F characters.
@@ -71,43 +86,65 @@ static bool isValidHexChar(char ch) {
 }
 
 bool decodeHex(const std::string& hexString, Bytes& binary) noexcept {
-    binary.reserve(hexString.size() / 2 + binary.size());
+    if (hexString.empty()) {
+        return true;
+    }
+
+    size_t index = binary.size();
+    binary.resize(index + hexString.size() / 2);
+    size_t len = 0;
+    if (!decodeHex(hexString.data(), hexString.size(), &binary[index], &len)) {
+        binary.resize(index);
+        return false;
+    }
+    binary.resize(index + len);
+
+    return true;
+}
 
+bool decodeHex(const char* hexString, size_t size, Byte* binary, size_t* written) noexcept {
+    const auto decodeKernel = getSimdKernels().decodeHex;
+    Byte* out = binary;
     int b0 = 0;
     bool accumulator = false;
+    size_t index = 0;
+    size_t kernelIndex = 0;
+
+    while (index < size) {
+        if (!accumulator && index >= kernelIndex) {
+            // Between bytes the vector kernel can take over until it hits whitespace or an invalid character.
+            size_t consumed = decodeKernel(hexString + index, size - index, out);
+            index += consumed;
+            out += consumed / 2;
+            if (index == size) {
+                break;
+            }
+            kernelIndex = index + SCALAR_RUN;
+        }
 
-    // validate the input.
-    for (char ch : hexString) {
+        char ch = hexString[index++];
         if (isIgnorableWhitespace(ch)) {
             continue;
         }
         if (!isValidHexChar(ch)) {
+            *written = static_cast<size_t>(out - binary);
             return false;
         }
-        accumulator = !accumulator;
-    }
-    if (accumulator) {
-        // We have an odd number of input characters, which is an error.
-        return false;
-    }
-
-    for (char ch : hexString) {
-        if (isIgnorableWhitespace(ch)) {
-            continue;
-        }
 
         int b1 = charToInt(ch);
 
         if (accumulator) {
             accumulator = false;
-            binary.push_back(static_cast<Byte>((b0 << 4) | b1));
+            *out++ = static_cast<Byte>((b0 << 4) | b1);
         } else {
             accumulator = true;
             b0 = b1;
         }
     }
 
-    return true;
+    *written = static_cast<size_t>(out - binary);
+    // An odd number of input characters is an error.
+    return !accumulator;
 }
 
 }  // namespace codecUtils
@@ -0,0 +1,556 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ACSDK_CODECUTILS_X86_KERNELS
+#include <immintrin.h>
+#elif defined(ACSDK_CODECUTILS_NEON_ENABLED) && defined(__aarch64__) && defined(__ARM_NEON)
+#define ACSDK_CODECUTILS_NEON_KERNELS
+#include <arm_neon.h>
+#endif
+
+#include <acsdk/CodecUtils/private/SimdKernels.h>
+
+namespace alexaClientSDK {
+namespace codecUtils {
+
+/// @brief Kernel which consumes nothing, leaving all the work to the scalar code.
+/// @private
+static size_t encodeNothing(const Byte*, size_t, char*) {
+    return 0;
+}
+
+/// @brief Kernel which consumes nothing, leaving all the work to the scalar code.
+/// @private
+static size_t decodeNothing(const char*, size_t, Byte*) {
+    return 0;
+}
+
+/// @brief Placeholder kernels used when no instruction set is supported.
+/// @private
+static const SimdKernels SCALAR_KERNELS = {"scalar", encodeNothing, decodeNothing, encodeNothing, decodeNothing};
+
+#ifdef ACSDK_CODECUTILS_X86_KERNELS
+
+/**
+ * @brief Stores the low 12 bytes of a vector.
+ *
+ * @param[out] destination Destination for 12 bytes.
+ * @param[in] value Vector to store.
+ * @private
+ */
+__attribute__((target("ssse3"))) static inline void store12(Byte* destination, __m128i value) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(destination), value);
+    int32_t high = _mm_cvtsi128_si32(_mm_srli_si128(value, 8));
+    std::memcpy(destination + 8, &high, sizeof(high));
+}
+
+/**
+ * @brief Converts 16 6-bit values into Base64 characters.
+ *
+ * @param[in] indices Values in range 0..63, one per byte.
+ * @return Base64 characters.
+ * @private
+ */
+__attribute__((target("ssse3"))) static inline __m128i base64Lookup(__m128i indices) {
+    // Reduce each value to an index into a table of offsets from value to character: 0..25 map to 13, 26..51 to 0,
+    // and 52..63 to 1..12.
+    __m128i offsetIndex = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    __m128i isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    offsetIndex = _mm_or_si128(offsetIndex, _mm_and_si128(isUpper, _mm_set1_epi8(13)));
+    const __m128i offsets = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, offsetIndex), indices);
+}
+
+/**
+ * @brief Splits 12 bytes (in the layout produced by the shuffle in encodeBase64Ssse3()) into 16 6-bit values.
+ *
+ * @param[in] shuffled Input bytes, with each 32-bit lane holding bytes 1, 0, 2, 1 of a 3-byte block.
+ * @return Values in range 0..63, one per byte.
+ * @private
+ */
+__attribute__((target("ssse3"))) static inline __m128i base64Unpack(__m128i shuffled) {
+    __m128i t0 = _mm_and_si128(shuffled, _mm_set1_epi32(0x0fc0fc00));
+    __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    __m128i t2 = _mm_and_si128(shuffled, _mm_set1_epi32(0x003f03f0));
+    __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t1, t3);
+}
+
+/// @brief SSSE3 Base64 encoder, 12 bytes per iteration.
+/// @private
+__attribute__((target("ssse3"))) static size_t encodeBase64Ssse3(const Byte* binary, size_t size, char* base64) {
+    const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    size_t consumed = 0;
+    // Each iteration loads 16 bytes but consumes 12.
+    for (; size - consumed >= 16; consumed += 12, base64 += 16) {
+        __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(binary + consumed));
+        __m128i indices = base64Unpack(_mm_shuffle_epi8(input, shuffle));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(base64), base64Lookup(indices));
+    }
+    return consumed;
+}
+
+/**
+ * @brief Converts 16 Base64 characters into 6-bit values.
+ *
+ * @param[in] input Characters to convert.
+ * @param[out] values Values in range 0..63, one per byte.
+ * @return Whether all characters are valid Base64 characters (padding excluded).
+ * @private
+ */
+__attribute__((target("ssse3"))) static inline bool base64Translate(__m128i input, __m128i* values) {
+    const __m128i highNibble = _mm_and_si128(_mm_srli_epi32(input, 4), _mm_set1_epi8(0x0f));
+    const __m128i lowNibble = _mm_and_si128(input, _mm_set1_epi8(0x0f));
+    // For each high nibble, the bit set in the mask of the low nibbles which are valid characters.
+    const __m128i highNibbleBits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    // For each low nibble, the high nibbles with which it forms a valid character.
+    const __m128i validHighNibbles = _mm_setr_epi8(
+        static_cast<char>(0xa8), static_cast<char>(0xf8), static_cast<char>(0xf8), static_cast<char>(0xf8),
+        static_cast<char>(0xf8), static_cast<char>(0xf8), static_cast<char>(0xf8), static_cast<char>(0xf8),
+        static_cast<char>(0xf8), static_cast<char>(0xf8), static_cast<char>(0xf0), 0x54, 0x50, 0x50, 0x50, 0x54);
+    // For each high nibble, the offset from character to value ('/' is fixed up below).
+    const __m128i offsets = _mm_setr_epi8(0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+
+    __m128i valid = _mm_and_si128(
+        _mm_shuffle_epi8(validHighNibbles, lowNibble), _mm_shuffle_epi8(highNibbleBits, highNibble));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(valid, _mm_setzero_si128()))) {
+        return false;
+    }
+    __m128i offset = _mm_shuffle_epi8(offsets, highNibble);
+    __m128i isSlash = _mm_cmpeq_epi8(input, _mm_set1_epi8('/'));
+    offset = _mm_add_epi8(offset, _mm_and_si128(isSlash, _mm_set1_epi8(-3)));
+    *values = _mm_add_epi8(input, offset);
+    return true;
+}
+
+/**
+ * @brief Packs 16 6-bit values into 12 bytes.
+ *
+ * @param[in] values Values in range 0..63, one per byte.
+ * @return The 12 bytes in the low part of the vector.
+ * @private
+ */
+__attribute__((target("ssse3"))) static inline __m128i base64Pack(__m128i values) {
+    __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    __m128i blocks = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(blocks, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+/// @brief SSSE3 Base64 decoder, 16 characters per iteration.
+/// @private
+__attribute__((target("ssse3"))) static size_t decodeBase64Ssse3(const char* base64, size_t size, Byte* binary) {
+    size_t consumed = 0;
+    for (; size - consumed >= 16; consumed += 16, binary += 12) {
+        __m128i values;
+        if (!base64Translate(_mm_loadu_si128(reinterpret_cast<const __m128i*>(base64 + consumed)), &values)) {
+            break;
+        }
+        store12(binary, base64Pack(values));
+    }
+    return consumed;
+}
+
+/// @brief SSSE3 hex encoder, 16 bytes per iteration.
+/// @private
+__attribute__((target("ssse3"))) static size_t encodeHexSsse3(const Byte* binary, size_t size, char* hex) {
+    const __m128i digits =
+        _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const __m128i lowMask = _mm_set1_epi8(0x0f);
+    size_t consumed = 0;
+    for (; size - consumed >= 16; consumed += 16, hex += 32) {
+        __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(binary + consumed));
+        __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(input, 4), lowMask));
+        __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(input, lowMask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(hex), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(hex + 16), _mm_unpackhi_epi8(high, low));
+    }
+    return consumed;
+}
+
+/**
+ * @brief Converts 16 hex characters into nibble values.
+ *
+ * @param[in] input Characters to convert.
+ * @param[out] values Values in range 0..15, one per byte.
+ * @return Whether all characters are valid hex characters.
+ * @private
+ */
+__attribute__((target("ssse3"))) static inline bool hexTranslate(__m128i input, __m128i* values) {
+    __m128i digit = _mm_sub_epi8(input, _mm_set1_epi8('0'));
+    __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    __m128i letter = _mm_sub_epi8(_mm_or_si128(input, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+    if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xffff) {
+        return false;
+    }
+    *values = _mm_or_si128(
+        _mm_and_si128(isDigit, digit), _mm_and_si128(isLetter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+    return true;
+}
+
+/// @brief SSSE3 hex decoder, 32 characters per iteration.
+/// @private
+__attribute__((target("ssse3"))) static size_t decodeHexSsse3(const char* hex, size_t size, Byte* binary) {
+    // Multiplies the high nibble of each pair by 16 and adds the low nibble.
+    const __m128i pairWeights = _mm_set1_epi16(0x0110);
+    size_t consumed = 0;
+    for (; size - consumed >= 32; consumed += 32, binary += 16) {
+        __m128i first;
+        __m128i second;
+        if (!hexTranslate(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hex + consumed)), &first) ||
+            !hexTranslate(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hex + consumed + 16)), &second)) {
+            break;
+        }
+        __m128i bytes =
+            _mm_packus_epi16(_mm_maddubs_epi16(first, pairWeights), _mm_maddubs_epi16(second, pairWeights));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(binary), bytes);
+    }
+    return consumed;
+}
+
+/// @brief AVX2 Base64 encoder, 24 bytes per iteration.
+/// @private
+__attribute__((target("avx2"))) static size_t encodeBase64Avx2(const Byte* binary, size_t size, char* base64) {
+    const __m256i shuffle = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m256i offsets = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    size_t consumed = 0;
+    // Each iteration loads 28 bytes (two overlapping 16 byte halves) but consumes 24.
+    for (; size - consumed >= 28; consumed += 24, base64 += 32) {
+        __m256i input = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(binary + consumed))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(binary + consumed + 12)),
+            1);
+        input = _mm256_shuffle_epi8(input, shuffle);
+        __m256i t0 = _mm256_and_si256(input, _mm256_set1_epi32(0x0fc0fc00));
+        __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        __m256i t2 = _mm256_and_si256(input, _mm256_set1_epi32(0x003f03f0));
+        __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        __m256i indices = _mm256_or_si256(t1, t3);
+
+        __m256i offsetIndex = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        __m256i isUpper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        offsetIndex = _mm256_or_si256(offsetIndex, _mm256_and_si256(isUpper, _mm256_set1_epi8(13)));
+        __m256i output = _mm256_add_epi8(_mm256_shuffle_epi8(offsets, offsetIndex), indices);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(base64), output);
+    }
+    return consumed;
+}
+
+/// @brief AVX2 Base64 decoder, 32 characters per iteration.
+/// @private
+__attribute__((target("avx2"))) static size_t decodeBase64Avx2(const char* base64, size_t size, Byte* binary) {
+    const __m256i highNibbleBits = _mm256_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i validHighNibbles = _mm256_setr_epi8(
+        static_cast<char>(0xa8), static_cast<char>(0xf8), static_cast<char>(0xf8), static_cast<char>(0xf8),
+        static_cast<char>(0xf8), static_cast<char>(0xf8), static_cast<char>(0xf8), static_cast<char>(0xf8),
+        static_cast<char>(0xf8), static_cast<char>(0xf8), static_cast<char>(0xf0), 0x54, 0x50, 0x50, 0x50, 0x54,
+        static_cast<char>(0xa8), static_cast<char>(0xf8), static_cast<char>(0xf8), static_cast<char>(0xf8),
+        static_cast<char>(0xf8), static_cast<char>(0xf8), static_cast<char>(0xf8), static_cast<char>(0xf8),
+        static_cast<char>(0xf8), static_cast<char>(0xf8), static_cast<char>(0xf0), 0x54, 0x50, 0x50, 0x50, 0x54);
+    const __m256i offsets = _mm256_setr_epi8(
+        0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i pack = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i lowMask = _mm256_set1_epi8(0x0f);
+    size_t consumed = 0;
+    for (; size - consumed >= 32; consumed += 32, binary += 24) {
+        __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(base64 + consumed));
+        __m256i highNibble = _mm256_and_si256(_mm256_srli_epi32(input, 4), lowMask);
+        __m256i lowNibble = _mm256_and_si256(input, lowMask);
+        __m256i valid = _mm256_and_si256(
+            _mm256_shuffle_epi8(validHighNibbles, lowNibble), _mm256_shuffle_epi8(highNibbleBits, highNibble));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(valid, _mm256_setzero_si256()))) {
+            break;
+        }
+        __m256i offset = _mm256_shuffle_epi8(offsets, highNibble);
+        __m256i isSlash = _mm256_cmpeq_epi8(input, _mm256_set1_epi8('/'));
+        offset = _mm256_add_epi8(offset, _mm256_and_si256(isSlash, _mm256_set1_epi8(-3)));
+        __m256i values = _mm256_add_epi8(input, offset);
+        __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        __m256i blocks = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        __m256i packed = _mm256_shuffle_epi8(blocks, pack);
+        store12(binary, _mm256_castsi256_si128(packed));
+        store12(binary + 12, _mm256_extracti128_si256(packed, 1));
+    }
+    return consumed;
+}
+
+/// @brief AVX2 hex encoder, 32 bytes per iteration.
+/// @private
+__attribute__((target("avx2"))) static size_t encodeHexAvx2(const Byte* binary, size_t size, char* hex) {
+    const __m256i digits = _mm256_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const __m256i lowMask = _mm256_set1_epi8(0x0f);
+    size_t consumed = 0;
+    for (; size - consumed >= 32; consumed += 32, hex += 64) {
+        __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(binary + consumed));
+        __m256i high = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(input, 4), lowMask));
+        __m256i low = _mm256_shuffle_epi8(digits, _mm256_and_si256(input, lowMask));
+        // Unpacking works within 128 bit lanes, so the halves of the results have to be put back in order.
+        __m256i first = _mm256_unpacklo_epi8(high, low);
+        __m256i second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(hex), _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(hex + 32), _mm256_permute2x128_si256(first, second, 0x31));
+    }
+    return consumed;
+}
+
+/**
+ * @brief Converts 32 hex characters into nibble values.
+ *
+ * @param[in] input Characters to convert.
+ * @param[out] values Values in range 0..15, one per byte.
+ * @return Whether all characters are valid hex characters.
+ * @private
+ */
+__attribute__((target("avx2"))) static inline bool hexTranslateAvx2(__m256i input, __m256i* values) {
+    __m256i digit = _mm256_sub_epi8(input, _mm256_set1_epi8('0'));
+    __m256i isDigit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+    __m256i letter = _mm256_sub_epi8(_mm256_or_si256(input, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    __m256i isLetter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+    if (_mm256_movemask_epi8(_mm256_or_si256(isDigit, isLetter)) != -1) {
+        return false;
+    }
+    *values = _mm256_or_si256(
+        _mm256_and_si256(isDigit, digit), _mm256_and_si256(isLetter, _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+    return true;
+}
+
+/// @brief AVX2 hex decoder, 64 characters per iteration.
+/// @private
+__attribute__((target("avx2"))) static size_t decodeHexAvx2(const char* hex, size_t size, Byte* binary) {
+    const __m256i pairWeights = _mm256_set1_epi16(0x0110);
+    size_t consumed = 0;
+    for (; size - consumed >= 64; consumed += 64, binary += 32) {
+        __m256i first;
+        __m256i second;
+        if (!hexTranslateAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hex + consumed)), &first) ||
+            !hexTranslateAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hex + consumed + 32)), &second)) {
+            break;
+        }
+        // Packing works within 128 bit lanes, so the 64 bit quarters of the result have to be put back in order.
+        __m256i bytes = _mm256_packus_epi16(
+            _mm256_maddubs_epi16(first, pairWeights), _mm256_maddubs_epi16(second, pairWeights));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(binary), _mm256_permute4x64_epi64(bytes, 0xd8));
+    }
+    return consumed;
+}
+
+/// @brief SSSE3 kernels.
+/// @private
+static const SimdKernels SSSE3_KERNELS = {
+    "ssse3", encodeBase64Ssse3, decodeBase64Ssse3, encodeHexSsse3, decodeHexSsse3};
+
+/// @brief AVX2 kernels.
+/// @private
+static const SimdKernels AVX2_KERNELS = {"avx2", encodeBase64Avx2, decodeBase64Avx2, encodeHexAvx2, decodeHexAvx2};
+
+#endif  // ACSDK_CODECUTILS_X86_KERNELS
+
+#ifdef ACSDK_CODECUTILS_NEON_KERNELS
+
+/// @brief Base64 alphabet.
+/// @private
+static const uint8_t BASE64_ALPHABET[64] = {'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
+                                            'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
+                                            'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm',
+                                            'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
+                                            '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'};
+
+/// @brief Values of characters 0..63 ('+', '/' and digits), 0xff for characters which are not in the alphabet.
+/// @private
+static const uint8_t BASE64_VALUES_LOW[64] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 62,   0xff, 0xff, 0xff, 63,
+    52,   53,   54,   55,   56,   57,   58,   59,   60,   61,   0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+
+/// @brief Values of characters 64..127 (letters), 0xff for characters which are not in the alphabet.
+/// @private
+static const uint8_t BASE64_VALUES_HIGH[64] = {
+    0xff, 0,    1,    2,    3,    4,    5,    6,    7,    8,    9,    10,   11,   12,   13,   14,
+    15,   16,   17,   18,   19,   20,   21,   22,   23,   24,   25,   0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 26,   27,   28,   29,   30,   31,   32,   33,   34,   35,   36,   37,   38,   39,   40,
+    41,   42,   43,   44,   45,   46,   47,   48,   49,   50,   51,   0xff, 0xff, 0xff, 0xff, 0xff};
+
+/**
+ * @brief Loads a 64-entry lookup table.
+ *
+ * @param[in] table Table to load.
+ * @return The table in four registers.
+ * @private
+ */
+static inline uint8x16x4_t loadTable(const uint8_t* table) {
+    uint8x16x4_t result;
+    for (int i = 0; i < 4; ++i) {
+        result.val[i] = vld1q_u8(table + i * 16);
+    }
+    return result;
+}
+
+/// @brief NEON Base64 encoder, 48 bytes per iteration.
+/// @private
+static size_t encodeBase64Neon(const Byte* binary, size_t size, char* base64) {
+    const uint8x16x4_t alphabet = loadTable(BASE64_ALPHABET);
+    const uint8x16_t sixBits = vdupq_n_u8(0x3f);
+    size_t consumed = 0;
+    for (; size - consumed >= 48; consumed += 48, base64 += 64) {
+        uint8x16x3_t input = vld3q_u8(binary + consumed);
+        uint8x16x4_t output;
+        output.val[0] = vshrq_n_u8(input.val[0], 2);
+        output.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(input.val[0], 4), vshrq_n_u8(input.val[1], 4)), sixBits);
+        output.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(input.val[1], 2), vshrq_n_u8(input.val[2], 6)), sixBits);
+        output.val[3] = vandq_u8(input.val[2], sixBits);
+        for (int i = 0; i < 4; ++i) {
+            output.val[i] = vqtbl4q_u8(alphabet, output.val[i]);
+        }
+        vst4q_u8(reinterpret_cast<uint8_t*>(base64), output);
+    }
+    return consumed;
+}
+
+/// @brief NEON Base64 decoder, 64 characters per iteration.
+/// @private
+static size_t decodeBase64Neon(const char* base64, size_t size, Byte* binary) {
+    const uint8x16x4_t valuesLow = loadTable(BASE64_VALUES_LOW);
+    const uint8x16x4_t valuesHigh = loadTable(BASE64_VALUES_HIGH);
+    const uint8x16_t highOffset = vdupq_n_u8(64);
+    const uint8x16_t maxValue = vdupq_n_u8(63);
+    size_t consumed = 0;
+    for (; size - consumed >= 64; consumed += 64, binary += 48) {
+        uint8x16x4_t input = vld4q_u8(reinterpret_cast<const uint8_t*>(base64 + consumed));
+        uint8x16x4_t values;
+        uint8x16_t invalid = vdupq_n_u8(0);
+        for (int i = 0; i < 4; ++i) {
+            // Out of range indices look up 0, and leave the destination unchanged for vqtbx4q_u8.
+            uint8x16_t value = vqtbl4q_u8(valuesLow, input.val[i]);
+            value = vqtbx4q_u8(value, valuesHigh, vsubq_u8(input.val[i], highOffset));
+            // Characters from 128 up look up 0 in both tables.
+            invalid = vorrq_u8(invalid, vcgtq_u8(value, maxValue));
+            invalid = vorrq_u8(invalid, vcltzq_s8(vreinterpretq_s8_u8(input.val[i])));
+            values.val[i] = value;
+        }
+        if (vmaxvq_u8(invalid)) {
+            break;
+        }
+        uint8x16x3_t output;
+        output.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+        output.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+        output.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+        vst3q_u8(binary, output);
+    }
+    return consumed;
+}
+
+/// @brief NEON hex encoder, 16 bytes per iteration.
+/// @private
+static size_t encodeHexNeon(const Byte* binary, size_t size, char* hex) {
+    const uint8x16_t digits = vld1q_u8(reinterpret_cast<const uint8_t*>("0123456789abcdef"));
+    const uint8x16_t lowMask = vdupq_n_u8(0x0f);
+    size_t consumed = 0;
+    for (; size - consumed >= 16; consumed += 16, hex += 32) {
+        uint8x16_t input = vld1q_u8(binary + consumed);
+        uint8x16x2_t output;
+        output.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(input, 4));
+        output.val[1] = vqtbl1q_u8(digits, vandq_u8(input, lowMask));
+        vst2q_u8(reinterpret_cast<uint8_t*>(hex), output);
+    }
+    return consumed;
+}
+
+/**
+ * @brief Converts 16 hex characters into nibble values.
+ *
+ * @param[in] input Characters to convert.
+ * @param[out] valid All ones for each valid character, zero otherwise.
+ * @return Values in range 0..15, one per byte, for the valid characters.
+ * @private
+ */
+static inline uint8x16_t hexTranslateNeon(uint8x16_t input, uint8x16_t* valid) {
+    uint8x16_t digit = vsubq_u8(input, vdupq_n_u8('0'));
+    uint8x16_t isDigit = vcltq_u8(digit, vdupq_n_u8(10));
+    uint8x16_t letter = vsubq_u8(vorrq_u8(input, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+    uint8x16_t isLetter = vcltq_u8(letter, vdupq_n_u8(6));
+    *valid = vorrq_u8(isDigit, isLetter);
+    return vbslq_u8(isDigit, digit, vaddq_u8(letter, vdupq_n_u8(10)));
+}
+
+/// @brief NEON hex decoder, 32 characters per iteration.
+/// @private
+static size_t decodeHexNeon(const char* hex, size_t size, Byte* binary) {
+    size_t consumed = 0;
+    for (; size - consumed >= 32; consumed += 32, binary += 16) {
+        uint8x16x2_t input = vld2q_u8(reinterpret_cast<const uint8_t*>(hex + consumed));
+        uint8x16_t highValid;
+        uint8x16_t lowValid;
+        uint8x16_t high = hexTranslateNeon(input.val[0], &highValid);
+        uint8x16_t low = hexTranslateNeon(input.val[1], &lowValid);
+        if (0 == vminvq_u8(vandq_u8(highValid, lowValid))) {
+            break;
+        }
+        vst1q_u8(binary, vorrq_u8(vshlq_n_u8(high, 4), low));
+    }
+    return consumed;
+}
+
+/// @brief NEON kernels.
+/// @private
+static const SimdKernels NEON_KERNELS = {"neon", encodeBase64Neon, decodeBase64Neon, encodeHexNeon, decodeHexNeon};
+
+#endif  // ACSDK_CODECUTILS_NEON_KERNELS
+
+std::vector<const SimdKernels*> getSupportedSimdKernels() {
+    std::vector<const SimdKernels*> kernels;
+#ifdef ACSDK_CODECUTILS_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        kernels.push_back(&AVX2_KERNELS);
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        kernels.push_back(&SSSE3_KERNELS);
+    }
+#endif
+#ifdef ACSDK_CODECUTILS_NEON_KERNELS
+    // NEON is part of the AArch64 baseline.
+    kernels.push_back(&NEON_KERNELS);
+#endif
+    kernels.push_back(&SCALAR_KERNELS);
+    return kernels;
+}
+
+const SimdKernels& getSimdKernels() noexcept {
+#ifdef ACSDK_CODECUTILS_SIMD_ENABLED
+    static const SimdKernels* kernels = getSupportedSimdKernels().front();
+    return *kernels;
+#else
+    return SCALAR_KERNELS;
+#endif  // ACSDK_CODECUTILS_SIMD_ENABLED
+}
+
+}  // namespace codecUtils
+}  // namespace alexaClientSDK
@@ -0,0 +1,214 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <acsdk/CodecUtils/Base64.h>
+#include <acsdk/CodecUtils/Base64Stream.h>
+
+namespace alexaClientSDK {
+namespace codecUtils {
+namespace test {
+
+using namespace ::testing;
+
+// Test string.
+static const std::string TEST_STR{"A quick brown fox jumps over the lazy dog."};
+
+// Test string encoded in Base64.
+static const std::string TEST_STR_B64{"QSBxdWljayBicm93biBmb3gganVtcHMgb3ZlciB0aGUgbGF6eSBkb2cu"};
+
+// Size of the random data used in tests, large enough for every vector kernel.
+static constexpr size_t RANDOM_SIZE = 1000;
+
+// Creates random data.
+static Bytes randomBytes(size_t size) {
+    std::mt19937 engine(static_cast<std::mt19937::result_type>(size));
+    std::uniform_int_distribution<int> distribution(0, 255);
+    Bytes result(size);
+    for (auto& b : result) {
+        b = static_cast<Byte>(distribution(engine));
+    }
+    return result;
+}
+
+// Encodes data in two pieces split at the given position.
+static std::string encodeSplit(const Bytes& binary, size_t split) {
+    std::string result(getBase64EncodedSize(binary.size()) + Base64Encoder::MAX_FINISH_SIZE, '\0');
+    Base64Encoder encoder;
+    size_t len = encoder.update(binary.data(), split, &result[0]);
+    len += encoder.update(binary.data() + split, binary.size() - split, &result[len]);
+    len += encoder.finish(&result[len]);
+    result.resize(len);
+    return result;
+}
+
+// Decodes text in two pieces split at the given position.
+static bool decodeSplit(const std::string& base64, size_t split, Bytes& binary) {
+    binary.assign(getBase64MaxDecodedSize(base64.size()) + 3, 0);
+    Base64Decoder decoder;
+    size_t first = 0;
+    size_t second = 0;
+    if (!decoder.update(base64.data(), split, binary.data(), &first) ||
+        !decoder.update(base64.data() + split, base64.size() - split, binary.data() + first, &second) ||
+        !decoder.finish()) {
+        return false;
+    }
+    binary.resize(first + second);
+    return true;
+}
+
+// Inserts line breaks every 76 characters, as MIME does.
+static std::string wrapLines(const std::string& base64) {
+    std::string result;
+    for (size_t i = 0; i < base64.size(); i += 76) {
+        result += base64.substr(i, 76) + "\r\n";
+    }
+    return result;
+}
+
+// Verify the size helpers account for padding and partial blocks.
+TEST(Base64StreamTest, test_sizes) {
+    ASSERT_EQ(0u, getBase64EncodedSize(0));
+    ASSERT_EQ(4u, getBase64EncodedSize(1));
+    ASSERT_EQ(4u, getBase64EncodedSize(3));
+    ASSERT_EQ(8u, getBase64EncodedSize(4));
+    ASSERT_EQ(0u, getBase64MaxDecodedSize(0));
+    ASSERT_EQ(3u, getBase64MaxDecodedSize(1));
+    ASSERT_EQ(3u, getBase64MaxDecodedSize(4));
+    ASSERT_EQ(6u, getBase64MaxDecodedSize(5));
+}
+
+// Verify encoding the test string in pieces gives the known result for every split position.
+TEST(Base64StreamTest, test_encodeTestStrSplit) {
+    Bytes binary{TEST_STR.begin(), TEST_STR.end()};
+    for (size_t split = 0; split <= binary.size(); ++split) {
+        ASSERT_EQ(TEST_STR_B64, encodeSplit(binary, split)) << "split=" << split;
+    }
+}
+
+// Verify the encoder pads the final block.
+TEST(Base64StreamTest, test_encodePadding) {
+    ASSERT_EQ("Zg==", encodeSplit(Bytes{'f'}, 0));
+    ASSERT_EQ("Zm8=", encodeSplit(Bytes{'f', 'o'}, 1));
+    ASSERT_EQ("Zm9v", encodeSplit(Bytes{'f', 'o', 'o'}, 2));
+    ASSERT_EQ("Zm9vYg==", encodeSplit(Bytes{'f', 'o', 'o', 'b'}, 4));
+}
+
+// Verify the encoder carries partial blocks over when fed one byte at a time.
+TEST(Base64StreamTest, test_encodeByteByByte) {
+    Bytes binary = randomBytes(RANDOM_SIZE);
+    std::string expected;
+    ASSERT_TRUE(encodeBase64(binary, expected));
+
+    std::string result(getBase64EncodedSize(binary.size()), '\0');
+    Base64Encoder encoder;
+    size_t len = 0;
+    for (Byte b : binary) {
+        len += encoder.update(&b, 1, &result[len]);
+    }
+    len += encoder.finish(&result[len]);
+    ASSERT_EQ(result.size(), len);
+    ASSERT_EQ(expected, result);
+}
+
+// Verify large random data survives a round trip for every split position near the ends.
+TEST(Base64StreamTest, test_roundTripSplit) {
+    for (size_t size : {RANDOM_SIZE - 2, RANDOM_SIZE - 1, RANDOM_SIZE}) {
+        Bytes binary = randomBytes(size);
+        std::string expected = encodeSplit(binary, 0);
+        for (size_t split = 0; split <= size; split += (split < 100 || split > size - 100) ? 1 : 37) {
+            ASSERT_EQ(expected, encodeSplit(binary, split)) << "size=" << size << " split=" << split;
+        }
+        Bytes decoded;
+        for (size_t split = 0; split <= expected.size(); split += (split < 100) ? 1 : 41) {
+            ASSERT_TRUE(decodeSplit(expected, split, decoded)) << "size=" << size << " split=" << split;
+            ASSERT_EQ(binary, decoded) << "size=" << size << " split=" << split;
+        }
+    }
+}
+
+// Verify whitespace is skipped wherever it appears, including inside blocks split across updates.
+TEST(Base64StreamTest, test_decodeWhitespace) {
+    Bytes binary = randomBytes(RANDOM_SIZE);
+    std::string wrapped = wrapLines(encodeSplit(binary, 0));
+    Bytes decoded;
+    for (size_t split = 0; split <= wrapped.size(); split += 13) {
+        ASSERT_TRUE(decodeSplit(wrapped, split, decoded)) << "split=" << split;
+        ASSERT_EQ(binary, decoded);
+    }
+    ASSERT_TRUE(decodeSplit(" Zm9v\tYg =\n= ", 7, decoded));
+    ASSERT_EQ((Bytes{'f', 'o', 'o', 'b'}), decoded);
+}
+
+// Verify decoding fails when data follows padding, even in a later update.
+TEST(Base64StreamTest, test_decodeErrorDataAfterEnd) {
+    Bytes decoded;
+    ASSERT_FALSE(decodeSplit("Zg==Zg==", 4, decoded));
+    ASSERT_FALSE(decodeSplit("Zg==\n=", 5, decoded));
+    ASSERT_FALSE(decodeSplit("Zg=a", 3, decoded));
+}
+
+// Verify decoding fails on padding too early in a block, and on invalid characters anywhere.
+TEST(Base64StreamTest, test_decodeErrorBadCharacters) {
+    Bytes decoded;
+    ASSERT_FALSE(decodeSplit("=AAA", 0, decoded));
+    ASSERT_FALSE(decodeSplit("A===", 2, decoded));
+    std::string base64 = encodeSplit(randomBytes(RANDOM_SIZE), 0);
+    for (size_t position : {size_t{0}, size_t{100}, base64.size() - 1}) {
+        std::string bad = base64;
+        bad[position] = '-';
+        ASSERT_FALSE(decodeSplit(bad, 0, decoded)) << "position=" << position;
+    }
+}
+
+// Verify finish() fails if the input ends inside a block.
+TEST(Base64StreamTest, test_decodeErrorEarlyEnd) {
+    Base64Decoder decoder;
+    Bytes decoded(8);
+    size_t len = 0;
+    ASSERT_TRUE(decoder.update("Zm9vY", 5, decoded.data(), &len));
+    ASSERT_EQ(3u, len);
+    ASSERT_FALSE(decoder.finish());
+}
+
+// Verify the decoder keeps failing after an error until it is reset.
+TEST(Base64StreamTest, test_decodeErrorIsSticky) {
+    Base64Decoder decoder;
+    Bytes decoded(8);
+    size_t len = 0;
+    ASSERT_FALSE(decoder.update("Zm9v!", 5, decoded.data(), &len));
+    ASSERT_EQ(3u, len);
+    ASSERT_FALSE(decoder.update("Zm9v", 4, decoded.data(), &len));
+    decoder.reset();
+    ASSERT_TRUE(decoder.update("Zm9v", 4, decoded.data(), &len));
+    ASSERT_EQ(3u, len);
+    ASSERT_TRUE(decoder.finish());
+}
+
+// Verify a failed decodeBase64() leaves the output container unmodified.
+TEST(Base64StreamTest, test_decodeBase64ErrorKeepsOutput) {
+    std::string bad = encodeSplit(randomBytes(RANDOM_SIZE), 0) + "A";
+    Bytes decoded{1, 2, 3};
+    ASSERT_FALSE(decodeBase64(bad, decoded));
+    ASSERT_EQ((Bytes{1, 2, 3}), decoded);
+}
+
+}  // namespace test
+}  // namespace codecUtils
+}  // namespace alexaClientSDK
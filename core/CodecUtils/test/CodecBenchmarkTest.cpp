@@ -0,0 +1,164 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#ifdef CRYPTO_FOUND
+#include <openssl/evp.h>
+#endif
+
+#include <acsdk/CodecUtils/Base64Stream.h>
+#include <acsdk/CodecUtils/Hex.h>
+#include <acsdk/CodecUtils/private/Base64Common.h>
+#include <acsdk/CodecUtils/private/SimdKernels.h>
+
+// The portable backend provides encodeBase64() and decodeBase64() for this executable.
+#include <Base64Internal.cpp>
+
+namespace alexaClientSDK {
+namespace codecUtils {
+namespace test {
+
+using namespace ::testing;
+
+// Input sizes to measure.
+static const std::vector<size_t> INPUT_SIZES = {1024, 64 * 1024, 1024 * 1024};
+
+// Amount of data processed per measurement, so that small inputs are repeated often enough to be timed.
+static constexpr size_t BYTES_PER_MEASUREMENT = 64 * 1024 * 1024;
+
+/**
+ * Runs an operation repeatedly and returns its throughput.
+ *
+ * @param size Number of input bytes processed by one run.
+ * @param operation Operation to measure; returns false on failure.
+ * @return Throughput in MB/s, or 0 if the operation failed.
+ */
+static double measure(size_t size, const std::function<bool()>& operation) {
+    size_t iterations = std::max<size_t>(1, BYTES_PER_MEASUREMENT / size);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        if (!operation()) {
+            return 0;
+        }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(size) * iterations / elapsed.count() / (1024 * 1024);
+}
+
+/**
+ * Prints one line of results.
+ *
+ * @param name Name of the implementation.
+ * @param size Input size.
+ * @param encodeRate Encoding throughput in MB/s of binary data.
+ * @param decodeRate Decoding throughput in MB/s of text.
+ */
+static void report(const std::string& name, size_t size, double encodeRate, double decodeRate) {
+    std::cout << "  " << std::left << std::setw(24) << name << std::right << std::setw(8) << size / 1024 << " KB"
+              << std::fixed << std::setprecision(1) << std::setw(12) << encodeRate << " MB/s encode"
+              << std::setw(12) << decodeRate << " MB/s decode" << std::endl;
+}
+
+/// Create deterministic binary test data.
+static Bytes createData(size_t size) {
+    Bytes data(size);
+    uint32_t state = 12345;
+    for (auto& b : data) {
+        state = state * 1103515245u + 12345u;
+        b = static_cast<Byte>(state >> 16);
+    }
+    return data;
+}
+
+/**
+ * Compare the portable, OpenSSL and vectorized Base64 implementations, and the vectorized hex codec, on 1 KB, 64 KB
+ * and 1 MB inputs. The OpenSSL figures include the input validation the OpenSSL backend performs before decoding.
+ */
+TEST(CodecBenchmarkTest, testSlow_base64AndHexThroughput) {
+    std::cout << "Vector kernels: " << getSimdKernels().name << std::endl;
+    for (auto size : INPUT_SIZES) {
+        const Bytes data = createData(size);
+        std::string expected;
+        ASSERT_TRUE(encodeBase64(data, expected));
+
+        std::string text;
+        Bytes binary;
+        double encodeRate = measure(size, [&] {
+            text.clear();
+            return encodeBase64(data, text);
+        });
+        double decodeRate = measure(expected.size(), [&] {
+            binary.clear();
+            return decodeBase64(expected, binary);
+        });
+        ASSERT_EQ(data, binary);
+        report("internal", size, encodeRate, decodeRate);
+
+#ifdef CRYPTO_FOUND
+        std::vector<unsigned char> encodeBuffer(getBase64EncodedSize(size) + 1);
+        Bytes stripped;
+        encodeRate = measure(size, [&] {
+            return EVP_EncodeBlock(encodeBuffer.data(), data.data(), static_cast<int>(size)) > 0;
+        });
+        decodeRate = measure(expected.size(), [&] {
+            stripped.clear();
+            binary.resize(getBase64MaxDecodedSize(expected.size()));
+            return preprocessBase64(expected, stripped) &&
+                   EVP_DecodeBlock(binary.data(), stripped.data(), static_cast<int>(stripped.size())) > 0;
+        });
+        ASSERT_EQ(expected, std::string(encodeBuffer.begin(), encodeBuffer.end() - 1));
+        report("openssl", size, encodeRate, decodeRate);
+#endif
+
+        std::string streamText(getBase64EncodedSize(size) + Base64Encoder::MAX_FINISH_SIZE, '\0');
+        Bytes streamBinary(getBase64MaxDecodedSize(expected.size()));
+        size_t decoded = 0;
+        encodeRate = measure(size, [&] {
+            Base64Encoder encoder;
+            size_t len = encoder.update(data.data(), size, &streamText[0]);
+            return len + encoder.finish(&streamText[len]) == expected.size();
+        });
+        decodeRate = measure(expected.size(), [&] {
+            Base64Decoder decoder;
+            return decoder.update(expected.data(), expected.size(), streamBinary.data(), &decoded) &&
+                   decoder.finish();
+        });
+        ASSERT_EQ(expected, streamText.substr(0, expected.size()));
+        ASSERT_EQ(data, Bytes(streamBinary.begin(), streamBinary.begin() + decoded));
+        report(std::string("simd stream (") + getSimdKernels().name + ")", size, encodeRate, decodeRate);
+
+        std::string hex(size * 2, '\0');
+        encodeRate = measure(size, [&] { return encodeHex(data.data(), size, &hex[0]) == hex.size(); });
+        decodeRate = measure(hex.size(), [&] {
+            return decodeHex(hex.data(), hex.size(), streamBinary.data(), &decoded);
+        });
+        ASSERT_EQ(data, Bytes(streamBinary.begin(), streamBinary.begin() + decoded));
+        report(std::string("hex (") + getSimdKernels().name + ")", size, encodeRate, decodeRate);
+
+        EXPECT_GT(encodeRate, 0);
+        EXPECT_GT(decodeRate, 0);
+    }
+}
+
+}  // namespace test
+}  // namespace codecUtils
+}  // namespace alexaClientSDK
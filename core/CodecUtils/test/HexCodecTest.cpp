@@ -146,6 +146,43 @@ TEST(HexCodecTest, test_hexDecodeWithWhitespace) {
     ASSERT_EQ((Bytes{0xAB, 0xCD}), decoded);
 }
 
+// Verify the buffer encoder matches the container encoder for inputs long enough to use vector instructions.
+TEST(HexCodecTest, test_hexEncodeBuffer) {
+    Bytes binary;
+    for (int i = 0; i < 1000; ++i) {
+        binary.push_back(static_cast<Byte>(i * 7));
+    }
+    std::string expected;
+    ASSERT_TRUE(encodeHex(binary, expected));
+    std::string encoded(binary.size() * 2, '\0');
+    ASSERT_EQ(encoded.size(), encodeHex(binary.data(), binary.size(), &encoded[0]));
+    ASSERT_EQ(expected, encoded);
+}
+
+// Verify the buffer decoder handles long mixed case input with whitespace.
+TEST(HexCodecTest, test_hexDecodeBuffer) {
+    std::string hex;
+    for (int i = 0; i < 20; ++i) {
+        hex += TEST_STR_HEX_U + "\n" + TEST_STR_HEX_L;
+    }
+    Bytes decoded(hex.size() / 2);
+    size_t len = 0;
+    ASSERT_TRUE(decodeHex(hex.data(), hex.size(), decoded.data(), &len));
+    decoded.resize(len);
+    std::string expected;
+    for (int i = 0; i < 40; ++i) {
+        expected += TEST_STR;
+    }
+    ASSERT_EQ(expected, std::string(decoded.begin(), decoded.end()));
+}
+
+// Verify a bad character after a long valid prefix fails and leaves the output container unmodified.
+TEST(HexCodecTest, test_hexDecodeBadCharLongInput) {
+    Bytes decoded{1, 2};
+    ASSERT_FALSE(decodeHex(TEST_STR_HEX_L + TEST_STR_HEX_L + "0Z" + TEST_STR_HEX_L, decoded));
+    ASSERT_EQ((Bytes{1, 2}), decoded);
+}
+
 }  // namespace test
 }  // namespace codecUtils
 }  // namespace alexaClientSDK
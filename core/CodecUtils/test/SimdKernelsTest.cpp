@@ -0,0 +1,223 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <acsdk/CodecUtils/private/SimdKernels.h>
+
+namespace alexaClientSDK {
+namespace codecUtils {
+namespace test {
+
+using namespace ::testing;
+
+// Base64 alphabet used by the reference encoder.
+static const char BASE64_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Hex alphabet used by the reference encoder.
+static const char HEX_ALPHABET[] = "0123456789abcdef";
+
+// Largest input size used in tests.
+static constexpr size_t MAX_SIZE = 300;
+
+// Value of bytes past the expected output, which kernels must not overwrite.
+static constexpr char CANARY = '#';
+
+// Characters the Base64 kernels must not accept.
+static const std::string BASE64_REJECTED{" \n=-_.:@[`{\x80\xff"};
+
+// Characters the hex kernels must not accept.
+static const std::string HEX_REJECTED{" \n/:@G`g\x80\xff\x10\x1a"};
+
+// Reference Base64 encoder for whole blocks.
+static std::string referenceEncodeBase64(const Bytes& binary) {
+    std::string result;
+    for (size_t i = 0; i + 3 <= binary.size(); i += 3) {
+        unsigned block = (binary[i] << 16) | (binary[i + 1] << 8) | binary[i + 2];
+        result.push_back(BASE64_ALPHABET[block >> 18]);
+        result.push_back(BASE64_ALPHABET[(block >> 12) & 0x3f]);
+        result.push_back(BASE64_ALPHABET[(block >> 6) & 0x3f]);
+        result.push_back(BASE64_ALPHABET[block & 0x3f]);
+    }
+    return result;
+}
+
+// Reference hex encoder.
+static std::string referenceEncodeHex(const Bytes& binary) {
+    std::string result;
+    for (Byte b : binary) {
+        result.push_back(HEX_ALPHABET[b >> 4]);
+        result.push_back(HEX_ALPHABET[b & 15]);
+    }
+    return result;
+}
+
+// Creates random data.
+static Bytes randomBytes(std::mt19937& engine, size_t size) {
+    std::uniform_int_distribution<int> distribution(0, 255);
+    Bytes result(size);
+    for (auto& b : result) {
+        b = static_cast<Byte>(distribution(engine));
+    }
+    return result;
+}
+
+class SimdKernelsTest : public TestWithParam<const SimdKernels*> {};
+
+// Verify the Base64 encoder produces the reference output for what it consumes, and stays within its output.
+TEST_P(SimdKernelsTest, test_encodeBase64) {
+    std::mt19937 engine(1);
+    for (size_t size = 0; size <= MAX_SIZE; ++size) {
+        Bytes binary = randomBytes(engine, size);
+        std::string output(size * 2 + 4, CANARY);
+        size_t consumed = GetParam()->encodeBase64(binary.data(), binary.size(), &output[0]);
+        ASSERT_EQ(0u, consumed % 3);
+        ASSERT_LE(consumed, size);
+        size_t encoded = consumed / 3 * 4;
+        Bytes prefix(binary.begin(), binary.begin() + consumed);
+        ASSERT_EQ(referenceEncodeBase64(prefix), output.substr(0, encoded)) << "size=" << size;
+        ASSERT_EQ(std::string(output.size() - encoded, CANARY), output.substr(encoded));
+    }
+}
+
+// Verify the Base64 decoder reverses the reference encoder and stays within its output.
+TEST_P(SimdKernelsTest, test_decodeBase64) {
+    std::mt19937 engine(2);
+    for (size_t size = 0; size <= MAX_SIZE; size += 3) {
+        Bytes binary = randomBytes(engine, size);
+        std::string base64 = referenceEncodeBase64(binary);
+        Bytes output(size + 4, CANARY);
+        size_t consumed = GetParam()->decodeBase64(base64.data(), base64.size(), output.data());
+        ASSERT_EQ(0u, consumed % 4);
+        ASSERT_LE(consumed, base64.size());
+        size_t decoded = consumed / 4 * 3;
+        ASSERT_TRUE(std::equal(binary.begin(), binary.begin() + decoded, output.begin())) << "size=" << size;
+        ASSERT_EQ(Bytes(output.size() - decoded, CANARY), Bytes(output.begin() + decoded, output.end()));
+    }
+}
+
+// Verify the Base64 decoder stops before any character it does not accept.
+TEST_P(SimdKernelsTest, test_decodeBase64StopsAtRejectedCharacters) {
+    std::mt19937 engine(3);
+    Bytes binary = randomBytes(engine, MAX_SIZE);
+    const std::string base64 = referenceEncodeBase64(binary);
+    for (char rejected : BASE64_REJECTED) {
+        for (size_t position = 0; position < base64.size(); position += 7) {
+            std::string input = base64;
+            input[position] = rejected;
+            Bytes output(MAX_SIZE);
+            size_t consumed = GetParam()->decodeBase64(input.data(), input.size(), output.data());
+            ASSERT_LE(consumed, position) << "char=" << static_cast<int>(rejected) << " position=" << position;
+            ASSERT_TRUE(std::equal(output.begin(), output.begin() + consumed / 4 * 3, binary.begin()));
+        }
+    }
+}
+
+// Verify the hex encoder produces the reference output for what it consumes, and stays within its output.
+TEST_P(SimdKernelsTest, test_encodeHex) {
+    std::mt19937 engine(4);
+    for (size_t size = 0; size <= MAX_SIZE; ++size) {
+        Bytes binary = randomBytes(engine, size);
+        std::string output(size * 2 + 4, CANARY);
+        size_t consumed = GetParam()->encodeHex(binary.data(), binary.size(), &output[0]);
+        ASSERT_LE(consumed, size);
+        Bytes prefix(binary.begin(), binary.begin() + consumed);
+        ASSERT_EQ(referenceEncodeHex(prefix), output.substr(0, consumed * 2)) << "size=" << size;
+        ASSERT_EQ(std::string(output.size() - consumed * 2, CANARY), output.substr(consumed * 2));
+    }
+}
+
+// Verify the hex decoder reverses the reference encoder, accepting both cases, and stays within its output.
+TEST_P(SimdKernelsTest, test_decodeHex) {
+    std::mt19937 engine(5);
+    for (size_t size = 0; size <= MAX_SIZE; ++size) {
+        Bytes binary = randomBytes(engine, size);
+        std::string hex = referenceEncodeHex(binary);
+        for (size_t i = 0; i < hex.size(); i += 3) {
+            hex[i] = static_cast<char>(toupper(hex[i]));
+        }
+        Bytes output(size + 4, CANARY);
+        size_t consumed = GetParam()->decodeHex(hex.data(), hex.size(), output.data());
+        ASSERT_EQ(0u, consumed % 2);
+        ASSERT_LE(consumed, hex.size());
+        size_t decoded = consumed / 2;
+        ASSERT_TRUE(std::equal(binary.begin(), binary.begin() + decoded, output.begin())) << "size=" << size;
+        ASSERT_EQ(Bytes(output.size() - decoded, CANARY), Bytes(output.begin() + decoded, output.end()));
+    }
+}
+
+// Verify the hex decoder stops before any character it does not accept.
+TEST_P(SimdKernelsTest, test_decodeHexStopsAtRejectedCharacters) {
+    std::mt19937 engine(6);
+    Bytes binary = randomBytes(engine, MAX_SIZE);
+    const std::string hex = referenceEncodeHex(binary);
+    for (char rejected : HEX_REJECTED) {
+        for (size_t position = 0; position < hex.size(); position += 5) {
+            std::string input = hex;
+            input[position] = rejected;
+            Bytes output(MAX_SIZE);
+            size_t consumed = GetParam()->decodeHex(input.data(), input.size(), output.data());
+            ASSERT_LE(consumed, position) << "char=" << static_cast<int>(rejected) << " position=" << position;
+            ASSERT_TRUE(std::equal(output.begin(), output.begin() + consumed / 2, binary.begin()));
+        }
+    }
+}
+
+// Verify the vector kernels consume all of a clean input except a tail shorter than a vector.
+TEST_P(SimdKernelsTest, test_vectorKernelsConsumeCleanInput) {
+    if (GetParam() == getSupportedSimdKernels().back()) {
+        // The scalar placeholder consumes nothing.
+        return;
+    }
+    std::mt19937 engine(7);
+    Bytes binary = randomBytes(engine, MAX_SIZE);
+    std::string base64 = referenceEncodeBase64(binary);
+    std::string hex = referenceEncodeHex(binary);
+    std::string text(MAX_SIZE * 2, ' ');
+    Bytes output(MAX_SIZE);
+    // No kernel works on more than 64 input bytes or characters at a time.
+    EXPECT_GE(GetParam()->encodeBase64(binary.data(), binary.size(), &text[0]) + 64, binary.size());
+    EXPECT_GE(GetParam()->decodeBase64(base64.data(), base64.size(), output.data()) + 64, base64.size());
+    EXPECT_GE(GetParam()->encodeHex(binary.data(), binary.size(), &text[0]) + 64, binary.size());
+    EXPECT_GE(GetParam()->decodeHex(hex.data(), hex.size(), output.data()) + 64, hex.size());
+}
+
+// Verify the selected kernels are the best supported ones with the SIMD backend, the scalar placeholder otherwise, and
+// the scalar placeholder is always available.
+TEST(SimdKernelsSelectionTest, test_selectsBestSupportedKernels) {
+    auto supported = getSupportedSimdKernels();
+    ASSERT_FALSE(supported.empty());
+#ifdef ACSDK_CODECUTILS_SIMD_ENABLED
+    ASSERT_EQ(supported.front(), &getSimdKernels());
+#else
+    ASSERT_EQ(supported.back(), &getSimdKernels());
+#endif
+    ASSERT_EQ(std::string("scalar"), supported.back()->name);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    AllSupported,
+    SimdKernelsTest,
+    ValuesIn(getSupportedSimdKernels()),
+    [](const TestParamInfo<const SimdKernels*>& info) { return std::string(info.param->name); });
+
+}  // namespace test
+}  // namespace codecUtils
+}  // namespace alexaClientSDK
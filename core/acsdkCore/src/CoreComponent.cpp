@@ -86,7 +86,7 @@ CoreComponent getComponent() {
         .addRetainedFactory(AlexaInterfaceMessageSender::createAlexaInterfaceMessageSender)
         .addRetainedFactory(AlexaInterfaceMessageSender::createAlexaInterfaceMessageSenderInternalInterface)
         .addRequiredFactory(AlexaInterfaceCapabilityAgent::createDefaultAlexaInterfaceCapabilityAgent)
-        .addRetainedFactory(AttachmentManager::createInProcessAttachmentManagerInterface)
+        .addRetainedFactory(AttachmentManager::createAttachmentManagerInterfaceFromConfiguration)
         .addRequiredFactory(AVSGatewayManager::createAVSGatewayManagerInterface)
         .addUniqueFactory(AVSGatewayManagerStorage::createAVSGatewayManagerStorageInterface)
         .addRetainedFactory(avsCommon::avs::ExceptionEncounteredSender::createExceptionEncounteredSenderInterface)
@@ -0,0 +1,65 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ACSDKMANUFACTORY_CONSTRUCTIONOPTIONS_H_
+#define ACSDKMANUFACTORY_CONSTRUCTIONOPTIONS_H_
+
+#include <cstddef>
+#include <memory>
+
+#include <AVSCommon/Utils/Timing/TraceEventRecorder.h>
+
+namespace alexaClientSDK {
+namespace acsdkManufactory {
+
+/**
+ * Options controlling how a @c Manufactory constructs its primary and required instances.
+ */
+struct ConstructionOptions {
+    /**
+     * Constructor.
+     *
+     * @param maxConstructionThreads The maximum number of threads used to construct required instances.
+     * @param traceRecorder Recorder for the time spent in each factory, or nullptr to disable tracing.
+     */
+    ConstructionOptions(
+        size_t maxConstructionThreads = 1,
+        std::shared_ptr<avsCommon::utils::timing::TraceEventRecorder> traceRecorder = nullptr);
+
+    /**
+     * The maximum number of threads used to construct required instances.  With the default of 1 everything is
+     * constructed serially on the calling thread.  With more than 1, primary instances are still constructed
+     * first and serially, after which required (and the retained instances they depend upon) are constructed on a
+     * bounded set of threads, each instance starting only once all of its dependencies are available.  This is
+     * opt-in because the factories of independent instances then run concurrently, so they must not depend on
+     * side effects of each other beyond what their declared dependencies express.
+     */
+    size_t maxConstructionThreads;
+
+    /// If set, the time spent in each factory is recorded here (category "factory", named after the type).
+    std::shared_ptr<avsCommon::utils::timing::TraceEventRecorder> traceRecorder;
+};
+
+inline ConstructionOptions::ConstructionOptions(
+    size_t maxConstructionThreads,
+    std::shared_ptr<avsCommon::utils::timing::TraceEventRecorder> traceRecorder) :
+        maxConstructionThreads{maxConstructionThreads},
+        traceRecorder{std::move(traceRecorder)} {
+}
+
+}  // namespace acsdkManufactory
+}  // namespace alexaClientSDK
+
+#endif  // ACSDKMANUFACTORY_CONSTRUCTIONOPTIONS_H_
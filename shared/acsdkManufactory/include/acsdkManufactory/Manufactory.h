@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "acsdkManufactory/Component.h"
+#include "acsdkManufactory/ConstructionOptions.h"
 #include "acsdkManufactory/internal/RuntimeManufactory.h"
 
 namespace alexaClientSDK {
@@ -47,6 +48,20 @@ public:
     template <typename... Parameters>
     static std::unique_ptr<Manufactory<Exports...>> create(const Component<Parameters...>& component);
 
+    /**
+     * Create an @c Manufactory based upon the recipes in @c Component, controlling how its primary and required
+     * instances are constructed.
+     *
+     * @tparam Parameters interfaces provided by @c Component.
+     * @param component The @c Component to base the Manufactory upon.
+     * @param options How to construct the primary and required instances.
+     * @return A new Manufactory or nullptr if the @c Component was invalid.
+     */
+    template <typename... Parameters>
+    static std::unique_ptr<Manufactory<Exports...>> create(
+        const Component<Parameters...>& component,
+        const ConstructionOptions& options);
+
     /**
      * Create an @c Manufactory that is a subset of another @c Manufactory.
      *
@@ -100,8 +115,9 @@ private:
      * Constructor.
      *
      * @param cookBook The @c CookBook to use to create instances.
+     * @param options How to construct the primary and required instances.
      */
-    Manufactory(const internal::CookBook& cookBook);
+    Manufactory(const internal::CookBook& cookBook, const ConstructionOptions& options);
 
     /**
      * Constructor.
@@ -17,12 +17,15 @@
 #define ACSDKMANUFACTORY_INTERNAL_COOKBOOK_H_
 
 #include <functional>
+#include <map>
 #include <memory>
+#include <set>
 #include <typeindex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include <AVSCommon/Utils/Timing/TraceEventRecorder.h>
 #include <AVSCommon/Utils/TypeIndex.h>
 
 #include "acsdkManufactory/Annotated.h"
@@ -315,6 +318,19 @@ public:
      */
     bool doRequiredGets(RuntimeManufactory& runtimeManufactory);
 
+    /**
+     * Variant of @c doRequiredGets() that constructs independent instances concurrently.  Primary types are
+     * constructed first, serially.  Then required types, and the retained types they depend upon, are constructed
+     * on up to @c maxThreads threads, each starting once all of its dependencies have been constructed.  Finally
+     * the required gets are performed as in @c doRequiredGets(), finding the instances already cached.
+     *
+     * @param runtimeManufactory The @c RuntimeManufactory from which to retrieve the Required<Type>s and
+     * any of their dependencies.
+     * @param maxThreads The maximum number of threads to construct instances on.
+     * @return Whether all get<Type>() operations were successful.
+     */
+    bool doRequiredGetsInParallel(RuntimeManufactory& runtimeManufactory, size_t maxThreads);
+
     /**
      * Create a new instance @c Type and return it via @c std::unique_ptr<>.
      *
@@ -334,6 +350,14 @@ public:
     template <typename Type>
     std::unique_ptr<AbstractPointerCache> createPointerCache();
 
+    /**
+     * Create a @c PointerCache for the specified type.
+     *
+     * @param type The @c TypeIndex of the type of object to be cached.
+     * @return A new @c PointerCache instance, or nullptr if there is no recipe for @c type.
+     */
+    std::unique_ptr<AbstractPointerCache> createPointerCache(avsCommon::utils::TypeIndex type);
+
 private:
     /**
      * A recipe that wraps a function pointer to a factory that can create new instances of a type.
@@ -782,6 +806,12 @@ private:
          */
         ConstGetWrapperIterator end() const;
 
+        /**
+         * Get the types in this collection, in the order their @c GetWrappers will be called.
+         * @return The types in this collection.
+         */
+        std::vector<avsCommon::utils::TypeIndex> getTypes() const;
+
     private:
         /// Map of TypeIndex to the index of the GetWrapper in m_orderedGetWrappers.
         std::unordered_map<avsCommon::utils::TypeIndex, std::size_t> m_types;
@@ -863,12 +893,30 @@ private:
      * @tparam Type The type of interface to return.
      * @tparam FunctionType The type of function to invoke.
      * @tparam Dependencies The types of arguments to pass to the @c function.
+     * @param traceRecorder If not null, where to record the time spent in @c function.
      * @param function The function to invoke.
      * @param dependencies The arguments to pass to the @c function.
      * @return An instance of the interface @c Type.
      */
     template <typename Type, typename FunctionType, typename... Dependencies>
-    static Type innerInvokeWithDependencies(FunctionType function, Dependencies... dependencies);
+    static Type innerInvokeWithDependencies(
+        const std::shared_ptr<avsCommon::utils::timing::TraceEventRecorder>& traceRecorder,
+        FunctionType function,
+        Dependencies... dependencies);
+
+    /**
+     * Find the types that must be constructed before @c type by @c doRequiredGetsInParallel().  These are the
+     * scheduled types reachable from @c type through dependencies that are not themselves scheduled.
+     *
+     * @param type The type whose dependencies to find.
+     * @param scheduled The types scheduled for construction.
+     * @param[in,out] memo Results already computed, keyed by type.
+     * @return The scheduled types @c type depends upon.
+     */
+    const std::set<avsCommon::utils::TypeIndex>& getScheduledDependencies(
+        avsCommon::utils::TypeIndex type,
+        const std::set<avsCommon::utils::TypeIndex>& scheduled,
+        std::map<avsCommon::utils::TypeIndex, std::set<avsCommon::utils::TypeIndex>>* memo) const;
 
     /**
      * Returns the Tag used by CookBook for logging.
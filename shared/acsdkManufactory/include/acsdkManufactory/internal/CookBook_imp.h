@@ -668,11 +668,14 @@ inline std::unique_ptr<Type> CookBook::createUniquePointer(RuntimeManufactory& r
 
 template <typename Type>
 inline std::unique_ptr<AbstractPointerCache> CookBook::createPointerCache() {
+    return createPointerCache(avsCommon::utils::getTypeIndex<Type>());
+}
+
+inline std::unique_ptr<AbstractPointerCache> CookBook::createPointerCache(avsCommon::utils::TypeIndex type) {
     if (!checkIsValid(__func__)) {
         return std::unique_ptr<SharedPointerCache>();
     }
 
-    auto type = avsCommon::utils::getTypeIndex<Type>();
     auto it = m_recipes.find(type);
     if (it != m_recipes.end()) {
         if (it->second) {
@@ -725,12 +728,27 @@ inline Type CookBook::invokeWithDependencies(
     std::function<Type(Dependencies...)> function) {
     using FcnType = typename std::function<Type(Dependencies...)>;
     return CookBook::template innerInvokeWithDependencies<Type, FcnType, Dependencies...>(
-        function, runtimeManufactory.get<RemoveCvref_t<Dependencies>>()...);
+        runtimeManufactory.getTraceRecorder(), function, runtimeManufactory.get<RemoveCvref_t<Dependencies>>()...);
 };
 
 template <typename Type, typename FunctionType, typename... Dependencies>
-inline Type CookBook::innerInvokeWithDependencies(FunctionType function, Dependencies... dependencies) {
-    return function(std::move(dependencies)...);
+inline Type CookBook::innerInvokeWithDependencies(
+    const std::shared_ptr<avsCommon::utils::timing::TraceEventRecorder>& traceRecorder,
+    FunctionType function,
+    Dependencies... dependencies) {
+    if (!traceRecorder) {
+        return function(std::move(dependencies)...);
+    }
+
+    // Only the factory itself is timed; the dependencies were all acquired before this was called.
+    auto start = avsCommon::utils::timing::TraceEventRecorder::Clock::now();
+    auto result = function(std::move(dependencies)...);
+    traceRecorder->recordCompleteEvent(
+        avsCommon::utils::getTypeIndex<Type>().getName(),
+        "factory",
+        start,
+        avsCommon::utils::timing::TraceEventRecorder::Clock::now());
+    return result;
 }
 
 template <typename Type, typename... Dependencies>
@@ -31,6 +31,14 @@ template <typename... Exports>
 template <typename... Parameters>
 inline std::unique_ptr<Manufactory<Exports...>> Manufactory<Exports...>::create(
     const Component<Parameters...>& component) {
+    return create(component, ConstructionOptions());
+}
+
+template <typename... Exports>
+template <typename... Parameters>
+inline std::unique_ptr<Manufactory<Exports...>> Manufactory<Exports...>::create(
+    const Component<Parameters...>& component,
+    const ConstructionOptions& options) {
     static_assert(!internal::HasRequiredImport<Parameters...>::value, "Component has non satisfied Import<Type>.");
 
     // Check if any export is missing. If missing, assertion will fail and PrintMissingExport will print a compilation
@@ -44,7 +52,7 @@ inline std::unique_ptr<Manufactory<Exports...>> Manufactory<Exports...>::create(
     if (!cookBook.checkCompleteness()) {
         return nullptr;
     }
-    return std::unique_ptr<Manufactory>(new Manufactory(cookBook));
+    return std::unique_ptr<Manufactory>(new Manufactory(cookBook, options));
 }
 
 template <typename... Exports>
@@ -100,8 +108,8 @@ inline std::unique_ptr<Manufactory<Exports...>> Manufactory<Exports...>::create(
 }
 
 template <typename... Exports>
-inline Manufactory<Exports...>::Manufactory(const internal::CookBook& cookBook) {
-    m_runtimeManufactory.reset(new internal::RuntimeManufactory(cookBook));
+inline Manufactory<Exports...>::Manufactory(const internal::CookBook& cookBook, const ConstructionOptions& options) {
+    m_runtimeManufactory.reset(new internal::RuntimeManufactory(cookBook, options));
 }
 
 template <typename... Exports>
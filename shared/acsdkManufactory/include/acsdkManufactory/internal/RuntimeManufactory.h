@@ -17,6 +17,7 @@
 #define ACSDKMANUFACTORY_INTERNAL_RUNTIMEMANUFACTORY_H_
 
 #include <memory>
+#include <mutex>
 #include <typeindex>
 #include <unordered_map>
 #include <vector>
@@ -24,6 +25,7 @@
 #include <AVSCommon/Utils/TypeIndex.h>
 
 #include "acsdkManufactory/Annotated.h"
+#include "acsdkManufactory/ConstructionOptions.h"
 #include "acsdkManufactory/internal/AbstractPointerCache.h"
 
 namespace alexaClientSDK {
@@ -35,6 +37,9 @@ class CookBook;
 /**
  * @c RuntimeManufactory provides instances of interfaces supported by a @c CookBook, automatically
  * creating instances of other interfaces that the requested instance depends upon.
+ *
+ * @note Instances may be requested from multiple threads.  Construction of each type is serialized, so at most one
+ * instance of a cached type is ever created, while independent types can be constructed concurrently.
  */
 class RuntimeManufactory {
 public:
@@ -42,8 +47,9 @@ public:
      * Constructor.
      *
      * @param cookBook The @c CookBook that specifies the recipes for the instances to be provided.
+     * @param options How to construct the primary and required instances.
      */
-    RuntimeManufactory(const CookBook& cookBook);
+    RuntimeManufactory(const CookBook& cookBook, const ConstructionOptions& options = ConstructionOptions());
 
     /**
      * Get an instance of the specified @c Type.
@@ -55,6 +61,42 @@ public:
     Type get();
 
 private:
+    /// @c CookBook drives construction of the required instances through @c prewarm().
+    friend class CookBook;
+
+    /**
+     * The cached value of one type, along with the lock serializing its construction.
+     */
+    struct CacheEntry {
+        /// Held while getting a value from @c cache.
+        std::mutex mutex;
+
+        /// The cache, or nullptr if there is no recipe for the type.
+        std::unique_ptr<AbstractPointerCache> cache;
+    };
+
+    /**
+     * Get the @c CacheEntry for a type, creating it if needed.
+     *
+     * @param type The type whose @c CacheEntry to get.
+     * @return The @c CacheEntry for @c type.
+     */
+    std::shared_ptr<CacheEntry> getCacheEntry(avsCommon::utils::TypeIndex type);
+
+    /**
+     * Construct and cache the instance of a type (if not already cached) without returning it.
+     *
+     * @param type The type to construct.
+     */
+    void prewarm(avsCommon::utils::TypeIndex type);
+
+    /**
+     * Get the recorder of the time spent in each factory.
+     *
+     * @return The recorder, or nullptr if tracing is disabled.
+     */
+    const std::shared_ptr<avsCommon::utils::timing::TraceEventRecorder>& getTraceRecorder() const;
+
     /**
      * Get a std::unique_ptr<Type>
      *
@@ -86,8 +128,14 @@ private:
     /// The @c CookBook to use to create instances of requested interfaces.
     std::unique_ptr<CookBook> m_cookBook;
 
+    /// The recorder of the time spent in each factory, if any.
+    std::shared_ptr<avsCommon::utils::timing::TraceEventRecorder> m_traceRecorder;
+
+    /// Serializes access to @c m_values.
+    std::mutex m_valuesMutex;
+
     /// Map from interface types to cached values.
-    std::unordered_map<avsCommon::utils::TypeIndex, std::shared_ptr<AbstractPointerCache>> m_values;
+    std::unordered_map<avsCommon::utils::TypeIndex, std::shared_ptr<CacheEntry>> m_values;
 };
 
 }  // namespace internal
@@ -26,8 +26,14 @@ namespace alexaClientSDK {
 namespace acsdkManufactory {
 namespace internal {
 
-inline RuntimeManufactory::RuntimeManufactory(const CookBook& cookBook) : m_cookBook{new CookBook{cookBook}} {
-    m_cookBook->doRequiredGets(*this);
+inline RuntimeManufactory::RuntimeManufactory(const CookBook& cookBook, const ConstructionOptions& options) :
+        m_cookBook{new CookBook{cookBook}},
+        m_traceRecorder{options.traceRecorder} {
+    if (options.maxConstructionThreads > 1) {
+        m_cookBook->doRequiredGetsInParallel(*this, options.maxConstructionThreads);
+    } else {
+        m_cookBook->doRequiredGets(*this);
+    }
 }
 
 template <typename Type>
@@ -46,18 +52,11 @@ inline std::shared_ptr<Type> RuntimeManufactory::innerGet(std::shared_ptr<Type>*
     using ResultType = std::shared_ptr<Type>;
     ResultType ret;
 
-    auto resultTypeIndex = avsCommon::utils::getTypeIndex<ResultType>();
-
-    auto it = m_values.find(resultTypeIndex);
-    if (m_values.end() == it || !it->second) {
-        std::shared_ptr<AbstractPointerCache> cache(std::move(m_cookBook->createPointerCache<ResultType>()));
-        m_values[resultTypeIndex] = cache;
-        ret = *static_cast<ResultType*>(cache->get(*this));
-        cache->cleanup();
-    } else {
-        auto cache = static_cast<AbstractPointerCache*>(it->second.get());
-        ret = *static_cast<ResultType*>(cache->get(*this));
-        cache->cleanup();
+    auto entry = getCacheEntry(avsCommon::utils::getTypeIndex<ResultType>());
+    if (entry->cache) {
+        std::lock_guard<std::mutex> lock(entry->mutex);
+        ret = *static_cast<ResultType*>(entry->cache->get(*this));
+        entry->cache->cleanup();
     }
 
     return ret;
@@ -68,23 +67,43 @@ inline Annotated<Annotation, Type> RuntimeManufactory::innerGet(Annotated<Annota
     using ResultType = Annotated<Annotation, Type>;
     ResultType ret;
 
-    auto resultTypeIndex = avsCommon::utils::getTypeIndex<ResultType>();
-
-    auto it = m_values.find(resultTypeIndex);
-    if (m_values.end() == it || !it->second) {
-        std::shared_ptr<AbstractPointerCache> cache(std::move(m_cookBook->createPointerCache<ResultType>()));
-        m_values[resultTypeIndex] = cache;
-        ret = *static_cast<std::shared_ptr<Type>*>(cache->get(*this));
-        cache->cleanup();
-    } else {
-        auto cache = static_cast<AbstractPointerCache*>(it->second.get());
-        ret = *static_cast<std::shared_ptr<Type>*>(cache->get(*this));
-        cache->cleanup();
+    auto entry = getCacheEntry(avsCommon::utils::getTypeIndex<ResultType>());
+    if (entry->cache) {
+        std::lock_guard<std::mutex> lock(entry->mutex);
+        ret = *static_cast<std::shared_ptr<Type>*>(entry->cache->get(*this));
+        entry->cache->cleanup();
     }
 
     return ret;
 }
 
+inline std::shared_ptr<RuntimeManufactory::CacheEntry> RuntimeManufactory::getCacheEntry(
+    avsCommon::utils::TypeIndex type) {
+    std::lock_guard<std::mutex> lock(m_valuesMutex);
+    auto& entry = m_values[type];
+    if (!entry) {
+        entry = std::make_shared<CacheEntry>();
+        entry->cache = m_cookBook->createPointerCache(type);
+    }
+    return entry;
+}
+
+inline void RuntimeManufactory::prewarm(avsCommon::utils::TypeIndex type) {
+    auto entry = getCacheEntry(type);
+    if (entry->cache) {
+        // Lock order follows the (acyclic) dependency graph, so holding this while dependencies are acquired on
+        // this or other threads can't deadlock.
+        std::lock_guard<std::mutex> lock(entry->mutex);
+        entry->cache->get(*this);
+        entry->cache->cleanup();
+    }
+}
+
+inline const std::shared_ptr<avsCommon::utils::timing::TraceEventRecorder>& RuntimeManufactory::getTraceRecorder()
+    const {
+    return m_traceRecorder;
+}
+
 }  // namespace internal
 }  // namespace acsdkManufactory
 }  // namespace alexaClientSDK
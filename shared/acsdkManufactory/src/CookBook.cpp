@@ -13,6 +13,12 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include <AVSCommon/Utils/Logger/Logger.h>
 
 #include "acsdkManufactory/internal/CookBook.h"
@@ -95,6 +101,122 @@ bool CookBook::checkForCyclicDependencies() {
     return true;
 }
 
+bool CookBook::doRequiredGetsInParallel(RuntimeManufactory& runtimeManufactory, size_t maxThreads) {
+    for (auto getFcn : *m_primaryGets) {
+        if (!getFcn || !getFcn(runtimeManufactory)) {
+            return false;
+        }
+    }
+
+    // Schedule the required types and every required or retained type they (transitively) depend upon.  Other
+    // dependencies are either already constructed (primary, instances) or are created on demand by whichever
+    // factory needs them (unique, unloadable).
+    std::set<avsCommon::utils::TypeIndex> scheduled;
+    std::vector<avsCommon::utils::TypeIndex> toVisit = m_requiredGets->getTypes();
+    std::set<avsCommon::utils::TypeIndex> visited(toVisit.begin(), toVisit.end());
+    while (!toVisit.empty()) {
+        auto type = toVisit.back();
+        toVisit.pop_back();
+        auto recipeIt = m_recipes.find(type);
+        if (m_recipes.end() == recipeIt || !recipeIt->second) {
+            continue;
+        }
+        auto lifecycle = recipeIt->second->getLifecycle();
+        if (AbstractRecipe::CachedInstanceLifecycle::REQUIRED == lifecycle ||
+            AbstractRecipe::CachedInstanceLifecycle::RETAINED == lifecycle) {
+            scheduled.insert(type);
+        }
+        for (auto it = recipeIt->second->begin(); it != recipeIt->second->end(); ++it) {
+            if (visited.insert(*it).second) {
+                toVisit.push_back(*it);
+            }
+        }
+    }
+
+    // Construct in topological order (Kahn's algorithm), handing each type to a worker once all of the scheduled
+    // types it depends upon are constructed.
+    std::map<avsCommon::utils::TypeIndex, std::set<avsCommon::utils::TypeIndex>> memo;
+    std::map<avsCommon::utils::TypeIndex, size_t> pendingCounts;
+    std::map<avsCommon::utils::TypeIndex, std::vector<avsCommon::utils::TypeIndex>> dependents;
+    std::deque<avsCommon::utils::TypeIndex> ready;
+    for (const auto& type : scheduled) {
+        size_t count = 0;
+        for (const auto& dependency : getScheduledDependencies(type, scheduled, &memo)) {
+            dependents[dependency].push_back(type);
+            ++count;
+        }
+        pendingCounts[type] = count;
+        if (0 == count) {
+            ready.push_back(type);
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable wakeTrigger;
+    size_t remaining = scheduled.size();
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            wakeTrigger.wait(lock, [&]() { return !ready.empty() || 0 == remaining; });
+            if (ready.empty()) {
+                return;
+            }
+            auto type = ready.front();
+            ready.pop_front();
+            lock.unlock();
+            runtimeManufactory.prewarm(type);
+            lock.lock();
+            --remaining;
+            for (const auto& dependent : dependents[type]) {
+                if (0 == --pendingCounts[dependent]) {
+                    ready.push_back(dependent);
+                }
+            }
+            wakeTrigger.notify_all();
+        }
+    };
+
+    ACSDK_DEBUG5(LX(__func__).d("scheduled", scheduled.size()).d("maxThreads", maxThreads));
+    std::vector<std::thread> threads;
+    auto threadCount = std::min(maxThreads, scheduled.size());
+    for (size_t i = 1; i < threadCount; ++i) {
+        threads.emplace_back(worker);
+    }
+    // The calling thread is one of the workers.
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Everything required is now cached, so this only verifies that construction succeeded.
+    return doRequiredGets(runtimeManufactory);
+}
+
+const std::set<avsCommon::utils::TypeIndex>& CookBook::getScheduledDependencies(
+    avsCommon::utils::TypeIndex type,
+    const std::set<avsCommon::utils::TypeIndex>& scheduled,
+    std::map<avsCommon::utils::TypeIndex, std::set<avsCommon::utils::TypeIndex>>* memo) const {
+    auto memoIt = memo->find(type);
+    if (memo->end() != memoIt) {
+        return memoIt->second;
+    }
+
+    std::set<avsCommon::utils::TypeIndex> result;
+    auto recipeIt = m_recipes.find(type);
+    if (m_recipes.end() != recipeIt && recipeIt->second) {
+        for (auto it = recipeIt->second->begin(); it != recipeIt->second->end(); ++it) {
+            if (scheduled.count(*it)) {
+                result.insert(*it);
+            } else {
+                // Recursion terminates because checkCompleteness() has rejected cyclic dependencies.
+                const auto& indirect = getScheduledDependencies(*it, scheduled, memo);
+                result.insert(indirect.begin(), indirect.end());
+            }
+        }
+    }
+    return (*memo)[type] = std::move(result);
+}
+
 void CookBook::logDependencies() const {
     ACSDK_INFO(LX(__func__));
     for (const auto& item : m_recipes) {
@@ -258,6 +380,18 @@ CookBook::GetWrapperCollection::ConstGetWrapperIterator CookBook::GetWrapperColl
     return m_orderedGetWrappers.end();
 }
 
+std::vector<avsCommon::utils::TypeIndex> CookBook::GetWrapperCollection::getTypes() const {
+    std::map<std::size_t, avsCommon::utils::TypeIndex> typesByPosition;
+    for (const auto& item : m_types) {
+        typesByPosition.insert({item.second, item.first});
+    }
+    std::vector<avsCommon::utils::TypeIndex> types;
+    for (const auto& item : typesByPosition) {
+        types.push_back(item.second);
+    }
+    return types;
+}
+
 }  // namespace internal
 }  // namespace acsdkManufactory
 }  // namespace alexaClientSDK
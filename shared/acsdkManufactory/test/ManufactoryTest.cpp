@@ -15,7 +15,10 @@
 
 /// @file ManufactoryTest.cpp
 
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -727,6 +730,124 @@ TEST_F(ManufactoryTest, test_withOptionalImportUsesProvidedImplementation) {
     EXPECT_EQ(manufactory->get<shared_ptr<Type1>>()->m_dependency, myDependency);
 }
 
+// ----- test_parallelConstruction -----
+
+/// How long the factories of test_parallelConstruction wait for each other.
+static const chrono::seconds RENDEZVOUS_TIMEOUT{5};
+
+/**
+ * Type constructed by the factories of test_parallelConstruction.
+ *
+ * @tparam X Number used to differentiate types.
+ */
+template <int X>
+struct Node {
+    /**
+     * Constructor.
+     *
+     * @param metPeer Whether the factory saw its peer factory running at the same time.
+     */
+    explicit Node(bool metPeer = false) : metPeer{metPeer} {
+    }
+
+    /// Whether the factory saw its peer factory running at the same time.
+    const bool metPeer;
+};
+
+/// Lets the two slow factories of test_parallelConstruction detect that they are running at the same time.
+static mutex g_rendezvousMutex;
+
+/// Notified when a slow factory arrives.
+static condition_variable g_rendezvousTrigger;
+
+/// The number of slow factories that have arrived.
+static int g_rendezvousCount = 0;
+
+/// Factory of the primary instance of test_parallelConstruction.
+static shared_ptr<Node<0>> createRoot() {
+    return make_shared<Node<0>>();
+}
+
+/**
+ * Factory that only completes promptly if another instance of it is running at the same time.
+ *
+ * @tparam X Number used to differentiate types.
+ * @param root The primary instance, which must already exist.
+ * @return A new @c Node<X>.
+ */
+template <int X>
+static shared_ptr<Node<X>> createSlowNode(shared_ptr<Node<0>> root) {
+    if (!root) {
+        return nullptr;
+    }
+    unique_lock<mutex> lock(g_rendezvousMutex);
+    ++g_rendezvousCount;
+    g_rendezvousTrigger.notify_all();
+    auto metPeer = g_rendezvousTrigger.wait_for(lock, RENDEZVOUS_TIMEOUT, []() { return g_rendezvousCount >= 2; });
+    return make_shared<Node<X>>(metPeer);
+}
+
+/// Retained factory depending on one of the slow factories.
+static shared_ptr<Node<3>> createMiddleNode(shared_ptr<Node<2>> slow) {
+    return slow ? make_shared<Node<3>>() : nullptr;
+}
+
+/// Required factory depending on all of the others, directly or indirectly.
+static shared_ptr<Node<4>> createJoinNode(shared_ptr<Node<1>> slow, shared_ptr<Node<3>> middle) {
+    return slow && middle ? make_shared<Node<4>>() : nullptr;
+}
+
+/**
+ * Component whose two slow required factories are independent of each other.
+ *
+ * @return A component for test_parallelConstruction.
+ */
+Component<shared_ptr<Node<0>>, shared_ptr<Node<1>>, shared_ptr<Node<2>>, shared_ptr<Node<3>>, shared_ptr<Node<4>>>
+getParallelTestComponent() {
+    return ComponentAccumulator<>()
+        .addRequiredFactory(createJoinNode)
+        .addPrimaryFactory(createRoot)
+        .addRequiredFactory(createSlowNode<1>)
+        .addRetainedFactory(createMiddleNode)
+        .addRequiredFactory(createSlowNode<2>);
+}
+
+/**
+ * Verify that with multiple construction threads independent factories run concurrently, every factory still
+ * gets all of its dependencies, and each factory is traced.
+ */
+TEST_F(ManufactoryTest, test_parallelConstruction) {
+    g_rendezvousCount = 0;
+    auto recorder = make_shared<avsCommon::utils::timing::TraceEventRecorder>();
+    auto manufactory = Manufactory<shared_ptr<Node<1>>, shared_ptr<Node<2>>, shared_ptr<Node<4>>>::create(
+        getParallelTestComponent(), ConstructionOptions(4, recorder));
+    ASSERT_TRUE(manufactory);
+
+    // Nothing is constructed on demand, so the event count shows all were constructed along with the Manufactory.
+    EXPECT_EQ(recorder->getEventCount(), 5u);
+    auto slow1 = manufactory->get<shared_ptr<Node<1>>>();
+    auto slow2 = manufactory->get<shared_ptr<Node<2>>>();
+    ASSERT_TRUE(slow1);
+    ASSERT_TRUE(slow2);
+    EXPECT_TRUE(slow1->metPeer);
+    EXPECT_TRUE(slow2->metPeer);
+    EXPECT_TRUE(manufactory->get<shared_ptr<Node<4>>>());
+    EXPECT_EQ(recorder->getEventCount(), 5u);
+}
+
+/**
+ * Verify that serial construction records one trace event per factory invoked.
+ */
+TEST_F(ManufactoryTest, test_traceFactories) {
+    auto recorder = make_shared<avsCommon::utils::timing::TraceEventRecorder>();
+    auto manufactory =
+        Manufactory<shared_ptr<ABSubclass<1>>, shared_ptr<ABSubclass<2>>, shared_ptr<ABSubclass<3>>>::create(
+            getPrimaryTestComponent(), ConstructionOptions(1, recorder));
+    ASSERT_TRUE(manufactory);
+    EXPECT_EQ(recorder->getEventCount(), 3u);
+    EXPECT_NE(recorder->toJson().find("\"cat\":\"factory\""), string::npos);
+}
+
 }  // namespace test
 }  // namespace acsdkManufactory
 }  // namespace alexaClientSDK